@@ -0,0 +1,219 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmark comparing the computation of the panel inclinations and pressure coefficients of a
+ *      HypersonicLocalInclinationAnalysis panel-by-panel, as previously done in the analysis, to the computation
+ *      with the vectorized panel functions, for the Apollo capsule with the panel distribution used in the unit
+ *      tests and for the same capsule with a finer panel distribution. Only built if BUILD_BENCHMARKS is set.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
+#include "Tudat/Astrodynamics/Aerodynamics/hypersonicLocalInclinationAnalysis.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/GeometricShapes/capsule.h"
+
+using namespace tudat;
+using namespace tudat::aerodynamics;
+using mathematical_constants::PI;
+
+//! Function to retrieve the per-panel compression pressure function, as previously selected in
+//! HypersonicLocalInclinationAnalysis::updateCompressionPressures (methods used in this benchmark only).
+std::function< double( double ) > getPerPanelCompressionFunction( const int method, const double machNumber )
+{
+    std::function< double( double ) > pressureFunction;
+    switch( method )
+    {
+    case 1:
+        pressureFunction = std::bind( computeModifiedNewtonianPressureCoefficient, std::placeholders::_1,
+                                      computeStagnationPressure( machNumber, 1.4 ) );
+        break;
+    case 5:
+        pressureFunction = std::bind( computeEmpiricalTangentConePressureCoefficient, std::placeholders::_1,
+                                      machNumber );
+        break;
+    default:
+        throw std::runtime_error( "Error, compression method " + std::to_string( method ) +
+                                  " not used in benchmark" );
+    }
+    return pressureFunction;
+}
+
+//! Function to retrieve the per-panel expansion pressure function, as previously selected in
+//! HypersonicLocalInclinationAnalysis::updateExpansionPressures (methods used in this benchmark only).
+std::function< double( double ) > getPerPanelExpansionFunction( const int method, const double machNumber )
+{
+    std::function< double( double ) > pressureFunction;
+    switch( method )
+    {
+    case 3:
+        pressureFunction = std::bind( computePrandtlMeyerFreestreamPressureCoefficient, std::placeholders::_1,
+                                      machNumber, 1.4, computePrandtlMeyerFunction( machNumber, 1.4 ) );
+        break;
+    case 6:
+        pressureFunction = std::bind( computeAcmEmpiricalPressureCoefficient, std::placeholders::_1, machNumber );
+        break;
+    default:
+        throw std::runtime_error( "Error, expansion method " + std::to_string( method ) +
+                                  " not used in benchmark" );
+    }
+    return pressureFunction;
+}
+
+//! Function to time the panel-by-panel and vectorized computation of the panel pressure coefficients of all parts
+//! of an analysis, for a grid of Mach numbers, angles of attack and angles of sideslip.
+void benchmarkPanelMethods( const std::string& geometryName,
+                            const std::vector< int >& numberOfLines,
+                            const std::vector< int >& numberOfPoints )
+{
+    // Create Apollo capsule, and analysis with single independent variable point (only panels are used here).
+    std::shared_ptr< geometric_shapes::Capsule > capsule = std::make_shared< geometric_shapes::Capsule >(
+                4.694, 1.956, 2.662, -1.0 * 33.0 * PI / 180.0, 0.196 );
+    std::vector< std::vector< double > > independentVariableDataPoints = { { 10.0 }, { 0.0 }, { 0.0 } };
+    std::vector< std::vector< int > > selectedMethods = { { 1, 5, 5, 1 }, { 6, 3, 3, 3 } };
+    HypersonicLocalInclinationAnalysis analysis(
+                independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
+                std::vector< bool >( 4, false ), selectedMethods, PI * std::pow( capsule->getMiddleRadius( ), 2.0 ),
+                3.9116, ( Eigen::Vector3d( ) << -0.6624, 0.0, -0.1369 ).finished( ) );
+
+    const std::vector< double > machNumbers = { 3.0, 5.0, 10.0, 20.0 };
+    std::vector< double > anglesOfAttack;
+    for( int i = 0; i < 31; i++ )
+    {
+        anglesOfAttack.push_back( static_cast< double >( i - 15 ) * 2.0 * PI / 180.0 );
+    }
+    const std::vector< double > anglesOfSideslip = { 0.0, 0.05, 0.1 };
+
+    int numberOfPanels = 0;
+    for( int k = 0; k < analysis.getNumberOfVehicleParts( ); k++ )
+    {
+        numberOfPanels += analysis.getVehiclePart( k )->getPanelSurfaceNormalMatrix( ).rows( );
+    }
+
+    // Compute pressure coefficients panel-by-panel
+    std::vector< std::vector< std::vector< double > > > panelByPanelPressureCoefficients;
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    for( unsigned int m = 0; m < machNumbers.size( ); m++ )
+    {
+        for( unsigned int i = 0; i < anglesOfAttack.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < anglesOfSideslip.size( ); j++ )
+            {
+                Eigen::Vector3d freestreamDirection;
+                freestreamDirection << std::cos( anglesOfAttack.at( i ) ) * std::cos( anglesOfSideslip.at( j ) ),
+                        std::sin( anglesOfSideslip.at( j ) ),
+                        std::sin( anglesOfAttack.at( i ) ) * std::cos( anglesOfSideslip.at( j ) );
+
+                std::vector< std::vector< double > > pressureCoefficients( analysis.getNumberOfVehicleParts( ) );
+                for( int k = 0; k < analysis.getNumberOfVehicleParts( ); k++ )
+                {
+                    std::shared_ptr< geometric_shapes::LawgsPartGeometry > vehiclePart = analysis.getVehiclePart( k );
+                    std::function< double( double ) > compressionFunction =
+                            getPerPanelCompressionFunction( selectedMethods[ 0 ][ k ], machNumbers.at( m ) );
+                    std::function< double( double ) > expansionFunction =
+                            getPerPanelExpansionFunction( selectedMethods[ 1 ][ k ], machNumbers.at( m ) );
+
+                    for( int l = 0; l < vehiclePart->getNumberOfLines( ) - 1; l++ )
+                    {
+                        for( int n = 0; n < vehiclePart->getNumberOfPoints( ) - 1; n++ )
+                        {
+                            double inclination = PI / 2.0 - std::acos(
+                                        vehiclePart->getPanelSurfaceNormal( l, n ).dot( freestreamDirection ) );
+                            pressureCoefficients[ k ].push_back(
+                                        ( inclination > 0.0 ) ? compressionFunction( inclination ) :
+                                                                expansionFunction( inclination ) );
+                        }
+                    }
+                }
+                panelByPanelPressureCoefficients.push_back( pressureCoefficients );
+            }
+        }
+    }
+    const double panelByPanelTime = std::chrono::duration< double >(
+                std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    // Compute pressure coefficients with vectorized functions
+    std::vector< std::vector< Eigen::VectorXd > > vectorizedPressureCoefficients;
+    Eigen::VectorXd panelInclinations;
+    startTime = std::chrono::steady_clock::now( );
+    for( unsigned int m = 0; m < machNumbers.size( ); m++ )
+    {
+        for( unsigned int i = 0; i < anglesOfAttack.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < anglesOfSideslip.size( ); j++ )
+            {
+                Eigen::Vector3d freestreamDirection;
+                freestreamDirection << std::cos( anglesOfAttack.at( i ) ) * std::cos( anglesOfSideslip.at( j ) ),
+                        std::sin( anglesOfSideslip.at( j ) ),
+                        std::sin( anglesOfAttack.at( i ) ) * std::cos( anglesOfSideslip.at( j ) );
+
+                std::vector< Eigen::VectorXd > pressureCoefficients( analysis.getNumberOfVehicleParts( ) );
+                for( int k = 0; k < analysis.getNumberOfVehicleParts( ); k++ )
+                {
+                    computePanelInclinationAngles( analysis.getVehiclePart( k )->getPanelSurfaceNormalMatrix( ),
+                                                   freestreamDirection, panelInclinations );
+                    pressureCoefficients[ k ].setZero( panelInclinations.rows( ) );
+                    computeLocalInclinationCompressionPressureCoefficients(
+                                selectedMethods[ 0 ][ k ], machNumbers.at( m ), 1.4,
+                                panelInclinations, pressureCoefficients[ k ] );
+                    computeLocalInclinationExpansionPressureCoefficients(
+                                selectedMethods[ 1 ][ k ], machNumbers.at( m ), 1.4,
+                                panelInclinations, pressureCoefficients[ k ] );
+                }
+                vectorizedPressureCoefficients.push_back( pressureCoefficients );
+            }
+        }
+    }
+    const double vectorizedTime = std::chrono::duration< double >(
+                std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    // Compare results (panels for which the Prandtl-Meyer function cannot be inverted are NaN in both).
+    double maximumDifference = 0.0;
+    for( unsigned int i = 0; i < panelByPanelPressureCoefficients.size( ); i++ )
+    {
+        for( unsigned int k = 0; k < panelByPanelPressureCoefficients.at( i ).size( ); k++ )
+        {
+            for( unsigned int l = 0; l < panelByPanelPressureCoefficients.at( i ).at( k ).size( ); l++ )
+            {
+                double difference = std::fabs( panelByPanelPressureCoefficients.at( i ).at( k ).at( l ) -
+                                               vectorizedPressureCoefficients.at( i ).at( k )( l ) );
+                if( difference > maximumDifference )
+                {
+                    maximumDifference = difference;
+                }
+            }
+        }
+    }
+
+    std::cout << geometryName << ", " << numberOfPanels << " panels, "
+              << panelByPanelPressureCoefficients.size( ) << " flow conditions" << std::endl
+              << "  Panel-by-panel:  " << panelByPanelTime << " s" << std::endl
+              << "  Vectorized:      " << vectorizedTime << " s, maximum difference " << maximumDifference
+              << std::endl;
+}
+
+int main( )
+{
+    // Apollo capsule, panel distribution as used in unit tests
+    benchmarkPanelMethods( "Apollo capsule", { 31, 31, 31, 11 }, { 31, 31, 10, 11 } );
+
+    // Capsule, finer panel distribution
+    benchmarkPanelMethods( "Capsule (fine mesh)", { 121, 121, 121, 41 }, { 121, 121, 40, 41 } );
+
+    return EXIT_SUCCESS;
+}
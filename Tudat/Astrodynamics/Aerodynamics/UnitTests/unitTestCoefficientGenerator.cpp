@@ -15,7 +15,16 @@
 
 #define BOOST_TEST_MAIN
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <string>
+
 #include <boost/array.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/make_shared.hpp>
 #include <memory>
 #include <boost/test/floating_point_comparison.hpp>
@@ -24,6 +33,7 @@
 #include <Eigen/Core>
 
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
 #include "Tudat/Astrodynamics/Aerodynamics/hypersonicLocalInclinationAnalysis.h"
 #include "Tudat/Astrodynamics/Aerodynamics/customAerodynamicCoefficientInterface.h"
 #include "Tudat/Basics/basicTypedefs.h"
@@ -244,7 +254,10 @@ BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientGeneratorHypersonicLocalInclinat
     }
 }
 
-std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface( )
+std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface(
+        const unsigned int numberOfThreads = 1,
+        const std::string& coefficientDatabaseFile = "",
+        const bool savePressureCoefficients = false )
 {
 
     // Create test capsule.
@@ -302,7 +315,7 @@ std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterf
     return std::make_shared< HypersonicLocalInclinationAnalysis >(
                 independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
                 invertOrders, selectedMethods, PI * pow( capsule->getMiddleRadius( ), 2.0 ),
-                3.9116, momentReference );
+                3.9116, momentReference, savePressureCoefficients, numberOfThreads, coefficientDatabaseFile );
 }
 
 //! Apollo capsule test case.
@@ -391,6 +404,225 @@ BOOST_AUTO_TEST_CASE( testApolloCapsule )
                        toleranceAerodynamicCoefficients5 );
 }
 
+//! Test multi-threaded database generation, and saving/loading database to/from file.
+BOOST_AUTO_TEST_CASE( testParallelGenerationAndDatabaseFile )
+{
+    const std::string fileName =
+            ( boost::filesystem::temp_directory_path( ) /
+              boost::filesystem::unique_path( "localInclinationDatabaseTest-%%%%-%%%%.dat" ) ).string( );
+
+    // Create Apollo coefficients using a single thread, and using multiple threads (saving results to file).
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > serialInterface =
+            getApolloCoefficientInterface( 1, "", true );
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > parallelInterface =
+            getApolloCoefficientInterface( 4, fileName );
+
+    // Create Apollo coefficients from file.
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > fileInterface =
+            getApolloCoefficientInterface( 1, fileName );
+    BOOST_CHECK( fileInterface->loadCoefficientDatabaseFromFile( fileName ) );
+
+    // Check whether all coefficients are identical.
+    boost::array< int, 3 > independentVariables;
+    for( int i = 0; i < serialInterface->getNumberOfValuesOfIndependentVariable( 0 ); i++ )
+    {
+        independentVariables[ 0 ] = i;
+        for( int j = 0; j < serialInterface->getNumberOfValuesOfIndependentVariable( 1 ); j++ )
+        {
+            independentVariables[ 1 ] = j;
+            for( int k = 0; k < serialInterface->getNumberOfValuesOfIndependentVariable( 2 ); k++ )
+            {
+                independentVariables[ 2 ] = k;
+                Eigen::Vector6d serialCoefficients =
+                        serialInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                Eigen::Vector6d parallelCoefficients =
+                        parallelInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                Eigen::Vector6d fileCoefficients =
+                        fileInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                for( int l = 0; l < 6; l++ )
+                {
+                    BOOST_CHECK_EQUAL( serialCoefficients( l ), parallelCoefficients( l ) );
+                    BOOST_CHECK_EQUAL( serialCoefficients( l ), fileCoefficients( l ) );
+                }
+
+                // Check size of saved pressure coefficients.
+                std::vector< std::vector< std::vector< double > > > pressureCoefficients =
+                        serialInterface->getPressureCoefficientList( independentVariables );
+                BOOST_CHECK_EQUAL( pressureCoefficients.size( ), 4 );
+                BOOST_CHECK_EQUAL( pressureCoefficients.at( 0 ).size( ), 31 );
+                BOOST_CHECK_EQUAL( pressureCoefficients.at( 2 ).at( 0 ).size( ), 10 );
+            }
+        }
+    }
+
+    // Check that database file is not used for analysis with different settings.
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > sphereInterface =
+            std::make_shared< HypersonicLocalInclinationAnalysis >(
+                serialInterface->getDataPointsOfIndependentVariables( ),
+                std::make_shared< geometric_shapes::SphereSegment >( 1.0 ),
+                std::vector< int >( 1, 11 ), std::vector< int >( 1, 11 ), std::vector< bool >( 1, false ),
+                std::vector< std::vector< int > >( 2, std::vector< int >( 1, 1 ) ), PI, 1.0,
+                Eigen::Vector3d::Zero( ) );
+    BOOST_CHECK( !sphereInterface->loadCoefficientDatabaseFromFile( fileName ) );
+
+    // Check that database file is not used for a mesh with identical settings and number of panels, but inverted panel
+    // order.
+    sphereInterface->saveCoefficientDatabaseToFile( fileName );
+    BOOST_CHECK( sphereInterface->loadCoefficientDatabaseFromFile( fileName ) );
+
+    // Check that database file is not used if it was written with a different byte order (emulated by reversing the
+    // byte order marker, which follows the 8-character identifier and the 4-byte version), and is used again after
+    // the marker is restored.
+    char byteOrderMarker[ 4 ];
+    std::fstream databaseFile( fileName.c_str( ), std::ios::in | std::ios::out | std::ios::binary );
+    databaseFile.seekg( 12 );
+    databaseFile.read( byteOrderMarker, 4 );
+    std::reverse( byteOrderMarker, byteOrderMarker + 4 );
+    databaseFile.seekp( 12 );
+    databaseFile.write( byteOrderMarker, 4 );
+    databaseFile.close( );
+    BOOST_CHECK( !sphereInterface->loadCoefficientDatabaseFromFile( fileName ) );
+
+    std::reverse( byteOrderMarker, byteOrderMarker + 4 );
+    databaseFile.open( fileName.c_str( ), std::ios::in | std::ios::out | std::ios::binary );
+    databaseFile.seekp( 12 );
+    databaseFile.write( byteOrderMarker, 4 );
+    databaseFile.close( );
+    BOOST_CHECK( sphereInterface->loadCoefficientDatabaseFromFile( fileName ) );
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > invertedSphereInterface =
+            std::make_shared< HypersonicLocalInclinationAnalysis >(
+                serialInterface->getDataPointsOfIndependentVariables( ),
+                std::make_shared< geometric_shapes::SphereSegment >( 1.0 ),
+                std::vector< int >( 1, 11 ), std::vector< int >( 1, 11 ), std::vector< bool >( 1, true ),
+                std::vector< std::vector< int > >( 2, std::vector< int >( 1, 1 ) ), PI, 1.0,
+                Eigen::Vector3d::Zero( ) );
+    BOOST_CHECK( !invertedSphereInterface->loadCoefficientDatabaseFromFile( fileName ) );
+
+    std::remove( fileName.c_str( ) );
+}
+
+//! Test vectorized panel inclination and pressure coefficient computations against per-panel functions.
+BOOST_AUTO_TEST_CASE( testVectorizedPanelMethods )
+{
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > coefficientInterface = getApolloCoefficientInterface( );
+    const double ratioOfSpecificHeats = 1.4;
+
+    // Define per-panel compression and expansion methods.
+    std::map< int, std::function< double( const double, const double ) > > compressionMethods;
+    compressionMethods[ 0 ] = [ = ]( const double angle, const double ){
+        return computeNewtonianPressureCoefficient( angle ); };
+    compressionMethods[ 1 ] = [ = ]( const double angle, const double machNumber ){
+        return computeModifiedNewtonianPressureCoefficient(
+                    angle, computeStagnationPressure( machNumber, ratioOfSpecificHeats ) ); };
+    compressionMethods[ 4 ] = &computeEmpiricalTangentWedgePressureCoefficient;
+    compressionMethods[ 5 ] = &computeEmpiricalTangentConePressureCoefficient;
+    compressionMethods[ 6 ] = &computeModifiedDahlemBuckPressureCoefficient;
+    compressionMethods[ 7 ] = [ = ]( const double angle, const double machNumber ){
+        return computeVanDykeUnifiedPressureCoefficient( angle, machNumber, ratioOfSpecificHeats, 1 ); };
+    compressionMethods[ 8 ] = &computeSmythDeltaWingPressureCoefficient;
+    compressionMethods[ 9 ] = &computeHankeyFlatSurfacePressureCoefficient;
+
+    std::map< int, std::function< double( const double, const double ) > > expansionMethods;
+    expansionMethods[ 0 ] = [ = ]( const double, const double machNumber ){
+        return computeVacuumPressureCoefficient( machNumber, ratioOfSpecificHeats ); };
+    expansionMethods[ 1 ] = [ = ]( const double, const double ){ return 0.0; };
+    expansionMethods[ 3 ] = [ = ]( const double angle, const double machNumber ){
+        return computePrandtlMeyerFreestreamPressureCoefficient(
+                    angle, machNumber, ratioOfSpecificHeats,
+                    computePrandtlMeyerFunction( machNumber, ratioOfSpecificHeats ) ); };
+    expansionMethods[ 4 ] = [ = ]( const double, const double machNumber ){
+        return computeHighMachBasePressure( machNumber ); };
+    expansionMethods[ 5 ] = [ = ]( const double angle, const double machNumber ){
+        return computePrandtlMeyerFreestreamPressureCoefficient(
+                    angle, machNumber, ratioOfSpecificHeats, -1.0 ); };
+    expansionMethods[ 6 ] = &computeAcmEmpiricalPressureCoefficient;
+
+    std::vector< double > machNumbers = { 3.0, 8.0, 25.0 };
+    std::vector< double > anglesOfAttack = { -0.5, 0.0, 0.3 };
+    std::vector< double > anglesOfSideslip = { 0.0, 0.02 };
+
+    Eigen::VectorXd panelInclinations, pressureCoefficients;
+    for( int i = 0; i < coefficientInterface->getNumberOfVehicleParts( ); i++ )
+    {
+        std::shared_ptr< geometric_shapes::LawgsPartGeometry > vehiclePart = coefficientInterface->getVehiclePart( i );
+        int numberOfPanelPoints = vehiclePart->getNumberOfPoints( ) - 1;
+        BOOST_CHECK_EQUAL( vehiclePart->getPanelSurfaceNormalMatrix( ).rows( ),
+                           ( vehiclePart->getNumberOfLines( ) - 1 ) * numberOfPanelPoints );
+
+        for( unsigned int j = 0; j < anglesOfAttack.size( ); j++ )
+        {
+            for( unsigned int k = 0; k < anglesOfSideslip.size( ); k++ )
+            {
+                Eigen::Vector3d freestreamDirection;
+                freestreamDirection << std::cos( anglesOfAttack.at( j ) ) * std::cos( anglesOfSideslip.at( k ) ),
+                        std::sin( anglesOfSideslip.at( k ) ),
+                        std::sin( anglesOfAttack.at( j ) ) * std::cos( anglesOfSideslip.at( k ) );
+
+                // Compare panel inclinations to per-panel computation.
+                computePanelInclinationAngles(
+                            vehiclePart->getPanelSurfaceNormalMatrix( ), freestreamDirection, panelInclinations );
+                for( int l = 0; l < panelInclinations.rows( ); l++ )
+                {
+                    double expectedInclination = PI / 2.0 - std::acos(
+                                vehiclePart->getPanelSurfaceNormal( l / numberOfPanelPoints, l % numberOfPanelPoints ).dot(
+                                    freestreamDirection ) );
+                    BOOST_CHECK_SMALL( panelInclinations( l ) - expectedInclination, 1.0E-14 );
+                }
+
+                // Compare pressure coefficients to per-panel computation.
+                for( unsigned int m = 0; m < machNumbers.size( ); m++ )
+                {
+                    for( auto methodIterator : compressionMethods )
+                    {
+                        pressureCoefficients.setZero( panelInclinations.rows( ) );
+                        computeLocalInclinationCompressionPressureCoefficients(
+                                    methodIterator.first, machNumbers.at( m ), ratioOfSpecificHeats,
+                                    panelInclinations, pressureCoefficients );
+                        for( int l = 0; l < panelInclinations.rows( ); l++ )
+                        {
+                            double expectedPressureCoefficient = ( panelInclinations( l ) > 0.0 ) ?
+                                        methodIterator.second( panelInclinations( l ), machNumbers.at( m ) ) : 0.0;
+                            BOOST_CHECK_CLOSE_FRACTION( pressureCoefficients( l ), expectedPressureCoefficient, 1.0E-12 );
+                        }
+                    }
+
+                    for( auto methodIterator : expansionMethods )
+                    {
+                        pressureCoefficients.setOnes( panelInclinations.rows( ) );
+                        computeLocalInclinationExpansionPressureCoefficients(
+                                    methodIterator.first, machNumbers.at( m ), ratioOfSpecificHeats,
+                                    panelInclinations, pressureCoefficients );
+                        for( int l = 0; l < panelInclinations.rows( ); l++ )
+                        {
+                            double expectedPressureCoefficient = ( panelInclinations( l ) <= 0.0 ) ?
+                                        methodIterator.second( panelInclinations( l ), machNumbers.at( m ) ) : 1.0;
+
+                            // Prandtl-Meyer function cannot be inverted for all panels with method 5.
+                            if( std::isnan( expectedPressureCoefficient ) )
+                            {
+                                BOOST_CHECK( std::isnan( pressureCoefficients( l ) ) );
+                            }
+                            else
+                            {
+                                BOOST_CHECK_CLOSE_FRACTION( pressureCoefficients( l ), expectedPressureCoefficient,
+                                                            1.0E-12 );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Check that unavailable methods are rejected.
+    BOOST_CHECK_THROW( computeLocalInclinationCompressionPressureCoefficients(
+                           2, 5.0, ratioOfSpecificHeats, Eigen::VectorXd::Ones( 3 ), pressureCoefficients ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( computeLocalInclinationExpansionPressureCoefficients(
+                           2, 5.0, ratioOfSpecificHeats, Eigen::VectorXd::Ones( 3 ), pressureCoefficients ),
+                       std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
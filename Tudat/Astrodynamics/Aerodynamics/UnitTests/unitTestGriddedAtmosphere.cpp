@@ -0,0 +1,250 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/exponentialAtmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/griddedAtmosphere.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace aerodynamics;
+
+//! Function to compute the local solar time at a given longitude and time, as used by the gridded atmosphere
+double computeLocalSolarTime( const double longitude, const double time )
+{
+    return basic_astrodynamics::calculateLocalSolarTime(
+                basic_astrodynamics::calculateSecondsInCurrentDay( time ), longitude );
+}
+
+//! Atmosphere model with simple analytical dependency on all independent variables, used for testing
+class AnalyticalTestAtmosphere: public AtmosphereModel
+{
+public:
+
+    double getDensity( const double altitude, const double longitude,
+                       const double latitude, const double time )
+    {
+        return 1.0E-10 * std::exp( -( altitude - 300.0E3 ) / 50.0E3 ) *
+                ( 1.0 + 0.1 * latitude + 0.01 * std::cos( computeLocalSolarTime( longitude, time ) *
+                                                          mathematical_constants::PI / 12.0 ) );
+    }
+
+    double getPressure( const double altitude, const double longitude,
+                        const double latitude, const double time )
+    {
+        return 287.0 * getDensity( altitude, longitude, latitude, time ) *
+                getTemperature( altitude, longitude, latitude, time );
+    }
+
+    double getTemperature( const double altitude, const double longitude,
+                           const double latitude, const double time )
+    {
+        return 1000.0 + 1.0E-3 * altitude + 100.0 * latitude + 1.0E-6 * time +
+                10.0 * std::cos( computeLocalSolarTime( longitude, time ) * mathematical_constants::PI / 12.0 );
+    }
+
+    double getSpeedOfSound( const double altitude, const double longitude,
+                            const double latitude, const double time )
+    {
+        return std::sqrt( 1.4 * 287.0 * getTemperature( altitude, longitude, latitude, time ) );
+    }
+};
+
+BOOST_AUTO_TEST_SUITE( test_gridded_atmosphere )
+
+//! Test conversion between longitude and local solar time
+BOOST_AUTO_TEST_CASE( testLocalSolarTimeConversion )
+{
+    // At J2000 (noon), local solar time at zero longitude is 12 hours
+    BOOST_CHECK_SMALL( computeLocalSolarTime( 0.0, 0.0 ) - 12.0, 1.0E-12 );
+    BOOST_CHECK_SMALL( computeLocalSolarTime( mathematical_constants::PI / 2.0, 0.0 ) - 18.0, 1.0E-12 );
+    BOOST_CHECK_SMALL( computeLocalSolarTime( 0.0, -12.0 * 3600.0 ), 1.0E-12 );
+
+    for( int i = 0; i < 20; i++ )
+    {
+        double time = -1.0E8 + 1.2345E7 * static_cast< double >( i );
+        double longitude = -3.1 + 0.31 * static_cast< double >( i );
+        BOOST_CHECK_SMALL( computeLongitudeFromLocalSolarTime( computeLocalSolarTime( longitude, time ), time ) - longitude,
+                           1.0E-12 );
+    }
+}
+
+//! Test gridded atmosphere created from exponential atmosphere, which should be reproduced (almost) exactly
+BOOST_AUTO_TEST_CASE( testGriddedExponentialAtmosphere )
+{
+    std::shared_ptr< ExponentialAtmosphere > exponentialAtmosphere =
+            std::make_shared< ExponentialAtmosphere >( 7.050E3, 246.0, 1.225 );
+
+    // Create grid only in altitude
+    std::array< AtmosphereGridAxis, GriddedAtmosphere::numberOfIndependentVariables > gridAxes;
+    gridAxes[ altitude_grid_variable ] = AtmosphereGridAxis( 0.0, 10.0E3, 11 );
+    std::shared_ptr< GriddedAtmosphere > griddedAtmosphere = createGriddedAtmosphere( exponentialAtmosphere, gridAxes );
+
+    for( int i = 0; i < 25; i++ )
+    {
+        double altitude = 4.0E3 * static_cast< double >( i );
+        double longitude = 0.1 * static_cast< double >( i );
+        double latitude = -0.05 * static_cast< double >( i );
+        double time = 1.0E6 * static_cast< double >( i );
+
+        BOOST_CHECK_CLOSE_FRACTION( griddedAtmosphere->getDensity( altitude, longitude, latitude, time ),
+                                    exponentialAtmosphere->getDensity( altitude, longitude, latitude, time ),
+                                    1.0E-12 );
+        BOOST_CHECK_CLOSE_FRACTION( griddedAtmosphere->getPressure( altitude, longitude, latitude, time ),
+                                    exponentialAtmosphere->getPressure( altitude, longitude, latitude, time ),
+                                    1.0E-12 );
+        BOOST_CHECK_CLOSE_FRACTION( griddedAtmosphere->getTemperature( altitude, longitude, latitude, time ),
+                                    exponentialAtmosphere->getTemperature( altitude, longitude, latitude, time ),
+                                    1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( griddedAtmosphere->getSpeedOfSound( altitude, longitude, latitude, time ),
+                                    exponentialAtmosphere->getSpeedOfSound( altitude, longitude, latitude, time ),
+                                    1.0E-14 );
+    }
+}
+
+//! Test gridded atmosphere in four dimensions, and its binary file representation
+BOOST_AUTO_TEST_CASE( testFourDimensionalGriddedAtmosphere )
+{
+    std::shared_ptr< AnalyticalTestAtmosphere > analyticalAtmosphere = std::make_shared< AnalyticalTestAtmosphere >( );
+
+    std::array< AtmosphereGridAxis, GriddedAtmosphere::numberOfIndependentVariables > gridAxes;
+    gridAxes[ altitude_grid_variable ] = AtmosphereGridAxis( 200.0E3, 20.0E3, 11 );
+    gridAxes[ latitude_grid_variable ] = AtmosphereGridAxis( -1.5, 0.1, 31 );
+    gridAxes[ local_solar_time_grid_variable ] = AtmosphereGridAxis( 0.0, 1.0, 24 );
+    gridAxes[ epoch_grid_variable ] = AtmosphereGridAxis( 0.0, 86400.0, 5 );
+    std::shared_ptr< GriddedAtmosphere > griddedAtmosphere = createGriddedAtmosphere( analyticalAtmosphere, gridAxes );
+
+    // Write atmosphere to file, and read it again
+    const std::string fileName = ( boost::filesystem::temp_directory_path( ) /
+                                   boost::filesystem::unique_path( "griddedAtmosphereTest-%%%%-%%%%.dat" ) ).string( );
+    writeGriddedAtmosphereToFile( griddedAtmosphere, fileName );
+    std::shared_ptr< GriddedAtmosphere > griddedAtmosphereFromFile = readGriddedAtmosphereFromFile( fileName );
+    std::remove( fileName.c_str( ) );
+
+    BOOST_CHECK_EQUAL( griddedAtmosphereFromFile->getGridValues( ).size( ), griddedAtmosphere->getGridValues( ).size( ) );
+    for( unsigned int i = 0; i < griddedAtmosphere->getGridValues( ).size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( griddedAtmosphereFromFile->getGridValues( ).at( i ), griddedAtmosphere->getGridValues( ).at( i ) );
+    }
+
+    for( int i = 0; i < 40; i++ )
+    {
+        double altitude = 205.0E3 + 4.87E3 * static_cast< double >( i );
+        double latitude = -1.23 + 0.061 * static_cast< double >( i );
+        double time = 1234.0 + 8000.0 * static_cast< double >( i );
+
+        // Use longitude on local solar time grid point: temperature is linear in remaining variables
+        double longitude = computeLongitudeFromLocalSolarTime( static_cast< double >( i % 24 ), time );
+        BOOST_CHECK_SMALL( griddedAtmosphere->getTemperature( altitude, longitude, latitude, time ) -
+                           analyticalAtmosphere->getTemperature( altitude, longitude, latitude, time ), 1.0E-9 );
+        BOOST_CHECK_EQUAL( griddedAtmosphere->getTemperature( altitude, longitude, latitude, time ),
+                           griddedAtmosphereFromFile->getTemperature( altitude, longitude, latitude, time ) );
+
+        // Use arbitrary longitude (including local solar time wrap-around): check interpolation errors
+        longitude = -3.0 + 0.15 * static_cast< double >( i );
+        BOOST_CHECK_SMALL( griddedAtmosphere->getTemperature( altitude, longitude, latitude, time ) -
+                           analyticalAtmosphere->getTemperature( altitude, longitude, latitude, time ), 0.1 );
+        BOOST_CHECK_CLOSE_FRACTION( griddedAtmosphere->getDensity( altitude, longitude, latitude, time ),
+                                    analyticalAtmosphere->getDensity( altitude, longitude, latitude, time ), 1.0E-3 );
+        BOOST_CHECK_CLOSE_FRACTION( griddedAtmosphere->getPressure( altitude, longitude, latitude, time ),
+                                    analyticalAtmosphere->getPressure( altitude, longitude, latitude, time ), 1.0E-3 );
+        BOOST_CHECK_CLOSE_FRACTION( griddedAtmosphere->getSpeedOfSound( altitude, longitude, latitude, time ),
+                                    analyticalAtmosphere->getSpeedOfSound( altitude, longitude, latitude, time ), 1.0E-4 );
+    }
+
+    // Check use of boundary values outside of grid
+    BOOST_CHECK_EQUAL( griddedAtmosphere->getTemperature( 1000.0E3, 0.0, 0.0, 0.0 ),
+                       griddedAtmosphere->getTemperature( 400.0E3, 0.0, 0.0, 0.0 ) );
+    BOOST_CHECK_SMALL( griddedAtmosphere->getTemperature(
+                           300.0E3, computeLongitudeFromLocalSolarTime( 5.0, -1.0E6 ), 0.0, -1.0E6 ) -
+                       griddedAtmosphere->getTemperature(
+                           300.0E3, computeLongitudeFromLocalSolarTime( 5.0, 0.0 ), 0.0, 0.0 ), 1.0E-10 );
+
+    // Check rejection of values outside of grid, if requested
+    std::shared_ptr< GriddedAtmosphere > rejectingGriddedAtmosphere = std::make_shared< GriddedAtmosphere >(
+                gridAxes, griddedAtmosphere->getGridValues( ), interpolators::throw_exception_at_boundary );
+    BOOST_CHECK_EQUAL( rejectingGriddedAtmosphere->getTemperature( 400.0E3, 0.0, 0.0, 0.0 ),
+                       griddedAtmosphere->getTemperature( 400.0E3, 0.0, 0.0, 0.0 ) );
+    BOOST_CHECK_THROW( rejectingGriddedAtmosphere->getTemperature( 1000.0E3, 0.0, 0.0, 0.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( rejectingGriddedAtmosphere->getTemperature( 1000.0E3, 0.0, 0.0, 0.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( rejectingGriddedAtmosphere->getDensity( 300.0E3, 0.0, 0.0, -1.0E6 ), std::runtime_error );
+    BOOST_CHECK_THROW( std::make_shared< GriddedAtmosphere >(
+                           gridAxes, griddedAtmosphere->getGridValues( ), interpolators::extrapolate_at_boundary ),
+                       std::runtime_error );
+}
+
+//! Test rejection of gridded atmosphere files with other byte order, or grid definition inconsistent with file size
+BOOST_AUTO_TEST_CASE( testCorruptGriddedAtmosphereFile )
+{
+    std::array< AtmosphereGridAxis, GriddedAtmosphere::numberOfIndependentVariables > gridAxes;
+    gridAxes[ altitude_grid_variable ] = AtmosphereGridAxis( 200.0E3, 20.0E3, 11 );
+    std::shared_ptr< GriddedAtmosphere > griddedAtmosphere = createGriddedAtmosphere(
+                std::make_shared< ExponentialAtmosphere >( 7.050E3, 246.0, 1.225 ), gridAxes );
+
+    const std::string fileName =
+            ( boost::filesystem::temp_directory_path( ) /
+              boost::filesystem::unique_path( "griddedAtmosphereCorruptTest-%%%%-%%%%.dat" ) ).string( );
+
+    // Overwrite byte order marker with byte-swapped value, as if file was written on machine with other byte order
+    // (offset of field: identifier, version)
+    writeGriddedAtmosphereToFile( griddedAtmosphere, fileName );
+    BOOST_CHECK_NO_THROW( readGriddedAtmosphereFromFile( fileName ) );
+    {
+        std::fstream file( fileName.c_str( ), std::ios::binary | std::ios::in | std::ios::out );
+        const std::uint32_t byteSwappedMarker = 0x04030201;
+        file.seekp( 8 + sizeof( std::uint32_t ) );
+        file.write( reinterpret_cast< const char* >( &byteSwappedMarker ), sizeof( std::uint32_t ) );
+    }
+    BOOST_CHECK_THROW( readGriddedAtmosphereFromFile( fileName ), std::runtime_error );
+
+    // Overwrite number of altitude points with a very large value (offset of field: identifier, version, byte order
+    // marker, initial value and step size)
+    writeGriddedAtmosphereToFile( griddedAtmosphere, fileName );
+    {
+        std::fstream file( fileName.c_str( ), std::ios::binary | std::ios::in | std::ios::out );
+        const std::uint32_t numberOfPoints = std::numeric_limits< std::uint32_t >::max( );
+        file.seekp( 8 + 2 * sizeof( std::uint32_t ) + 2 * sizeof( double ) );
+        file.write( reinterpret_cast< const char* >( &numberOfPoints ), sizeof( std::uint32_t ) );
+    }
+    BOOST_CHECK_THROW( readGriddedAtmosphereFromFile( fileName ), std::runtime_error );
+
+    // Append data to file
+    writeGriddedAtmosphereToFile( griddedAtmosphere, fileName );
+    {
+        std::ofstream file( fileName.c_str( ), std::ios::binary | std::ios::app );
+        const double extraValue = 0.0;
+        file.write( reinterpret_cast< const char* >( &extraValue ), sizeof( double ) );
+    }
+    BOOST_CHECK_THROW( readGriddedAtmosphereFromFile( fileName ), std::runtime_error );
+    std::remove( fileName.c_str( ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -1102,6 +1102,85 @@ BOOST_AUTO_TEST_CASE( test_nrlmise_InputFunction_with_adjustment )
     BOOST_CHECK_CLOSE_FRACTION(verificationData[5]*1000 , computedDensity , 1E-11);
 }
 
+//! Test NRLMSISE-00 input function with cached time-dependent input.
+BOOST_AUTO_TEST_CASE( test_nrlmise_CachedInputFunction )
+{
+    // find space weather file
+    std::string cppPath( __FILE__ );
+    std::string folder = cppPath.substr( 0, cppPath.find_last_of("/\\")+1);
+    std::string spaceWeatherFilePath = folder + "swAtmosTestWithAdjust.txt";
+
+    tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
+            tudat::input_output::solar_activity::readSolarActivityData(spaceWeatherFilePath) ;
+
+    // Create atmosphere models using uncached and cached NRLMISE00 input function
+    std::function< tudat::aerodynamics::NRLMSISE00Input (double,double,double,double) > inputFunction =
+            std::bind(&tudat::aerodynamics::nrlmsiseInputFunction, std::placeholders::_1, std::placeholders::_2,
+                      std::placeholders::_3, std::placeholders::_4, solarActivityData , false , 0.0 );
+    tudat::aerodynamics::NRLMSISE00Atmosphere atmosphereModel( inputFunction );
+
+    std::shared_ptr< tudat::aerodynamics::NRLMSISE00TimeDependentInputCache > inputCache =
+            std::make_shared< tudat::aerodynamics::NRLMSISE00TimeDependentInputCache >( solarActivityData );
+    std::function< tudat::aerodynamics::NRLMSISE00Input (double,double,double,double) > cachedInputFunction =
+            std::bind( &tudat::aerodynamics::NRLMSISE00TimeDependentInputCache::getInput, inputCache,
+                       std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4 );
+    tudat::aerodynamics::NRLMSISE00Atmosphere cachedAtmosphereModel( cachedInputFunction );
+
+    // Define test positions
+    std::vector< double > altitudes = { 400.0E3, 250.0E3, 800.0E3, 120.0E3, 400.0E3 };
+    std::vector< double > longitudes = { -70.0 * PI / 180.0, 10.0 * PI / 180.0, 160.0 * PI / 180.0,
+                                         -120.0 * PI / 180.0, 30.0 * PI / 180.0 };
+    std::vector< double > latitudes = { 60.0 * PI / 180.0, -20.0 * PI / 180.0, 5.0 * PI / 180.0,
+                                        80.0 * PI / 180.0, 0.0 };
+
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        double julianDate = tudat::basic_astrodynamics::convertCalendarDateToJulianDay< double >(
+                    2030, 6, 21, 8 + i, 3, 20.0 );
+        double time = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                    julianDate , tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000) ;
+
+        // Compute densities and temperatures at all positions
+        std::vector< double > densities, temperatures;
+        for( unsigned int j = 0; j < altitudes.size( ); j++ )
+        {
+            densities.push_back( cachedAtmosphereModel.getDensity(
+                                     altitudes.at( j ), longitudes.at( j ), latitudes.at( j ), time ) );
+            temperatures.push_back( cachedAtmosphereModel.getTemperature(
+                                        altitudes.at( j ), longitudes.at( j ), latitudes.at( j ), time ) );
+        }
+
+        // Time-dependent input should only be computed once per epoch
+        BOOST_CHECK_EQUAL( inputCache->getNumberOfTimeDependentInputComputations( ), i + 1 );
+
+        for( unsigned int j = 0; j < altitudes.size( ); j++ )
+        {
+            // Compare input for cached and uncached input functions
+            tudat::aerodynamics::NRLMSISE00Input input = inputFunction(
+                        altitudes.at( j ), longitudes.at( j ), latitudes.at( j ), time );
+            tudat::aerodynamics::NRLMSISE00Input cachedInput = cachedInputFunction(
+                        altitudes.at( j ), longitudes.at( j ), latitudes.at( j ), time );
+            BOOST_CHECK_EQUAL( input.year, cachedInput.year );
+            BOOST_CHECK_EQUAL( input.dayOfTheYear, cachedInput.dayOfTheYear );
+            BOOST_CHECK_EQUAL( input.secondOfTheDay, cachedInput.secondOfTheDay );
+            BOOST_CHECK_EQUAL( input.localSolarTime, cachedInput.localSolarTime );
+            BOOST_CHECK_EQUAL( input.f107, cachedInput.f107 );
+            BOOST_CHECK_EQUAL( input.f107a, cachedInput.f107a );
+            BOOST_CHECK_EQUAL( input.apDaily, cachedInput.apDaily );
+            for( unsigned int k = 0; k < input.apVector.size( ); k++ )
+            {
+                BOOST_CHECK_EQUAL( input.apVector.at( k ), cachedInput.apVector.at( k ) );
+            }
+
+            // Compare atmosphere properties for cached and uncached input functions
+            BOOST_CHECK_EQUAL( densities.at( j ), atmosphereModel.getDensity(
+                                   altitudes.at( j ), longitudes.at( j ), latitudes.at( j ), time ) );
+            BOOST_CHECK_EQUAL( temperatures.at( j ), atmosphereModel.getTemperature(
+                                   altitudes.at( j ), longitudes.at( j ), latitudes.at( j ), time ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,393 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/Aerodynamics/griddedAtmosphere.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace aerodynamics
+{
+
+//! Identifier at start of gridded atmosphere file
+static const char griddedAtmosphereFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'G', 'R', 'D' };
+
+//! Version of gridded atmosphere file format
+static const std::uint32_t griddedAtmosphereFileVersion = 2;
+
+//! Marker written after the file version, from which the byte order in which the file was written is determined
+static const std::uint32_t griddedAtmosphereByteOrderMarker = 0x01020304;
+
+//! Function to compute the longitude at which a given local solar time is attained
+double computeLongitudeFromLocalSolarTime( const double localSolarTime, const double time )
+{
+    double hourOfDay = basic_astrodynamics::calculateSecondsInCurrentDay( time ) / 3600.0;
+    double longitude = std::fmod( ( localSolarTime - hourOfDay ) * mathematical_constants::PI / 12.0 +
+                                  mathematical_constants::PI, 2.0 * mathematical_constants::PI );
+    if( longitude < 0.0 )
+    {
+        longitude += 2.0 * mathematical_constants::PI;
+    }
+    return longitude - mathematical_constants::PI;
+}
+
+//! Constructor
+GriddedAtmosphere::GriddedAtmosphere(
+        const std::array< AtmosphereGridAxis, numberOfIndependentVariables >& gridAxes,
+        const std::vector< double >& gridValues,
+        const interpolators::BoundaryInterpolationType boundaryHandling ):
+    gridAxes_( gridAxes ), gridValues_( gridValues ), boundaryHandling_( boundaryHandling ), density_( TUDAT_NAN ),
+    pressure_( TUDAT_NAN ), temperature_( TUDAT_NAN ), speedOfSound_( TUDAT_NAN )
+{
+    if( boundaryHandling_ != interpolators::throw_exception_at_boundary &&
+            boundaryHandling_ != interpolators::use_boundary_value &&
+            boundaryHandling_ != interpolators::use_boundary_value_with_warning )
+    {
+        throw std::runtime_error( "Error when creating gridded atmosphere, boundary handling " +
+                                  std::to_string( boundaryHandling_ ) + " not supported" );
+    }
+
+    // Check grid definition, and compute strides
+    std::size_t currentStride = numberOfGridQuantities;
+    for( int i = 0; i < numberOfIndependentVariables; i++ )
+    {
+        if( gridAxes_.at( i ).numberOfPoints_ < 1 )
+        {
+            throw std::runtime_error( "Error when creating gridded atmosphere, grid of independent variable " +
+                                      std::to_string( i ) + " has no points" );
+        }
+        else if( gridAxes_.at( i ).numberOfPoints_ > 1 && !( gridAxes_.at( i ).stepSize_ > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when creating gridded atmosphere, grid of independent variable " +
+                                      std::to_string( i ) + " has non-positive step size" );
+        }
+
+        gridStrides_[ i ] = currentStride;
+        currentStride *= gridAxes_.at( i ).numberOfPoints_;
+    }
+
+    if( gridValues_.size( ) != currentStride )
+    {
+        throw std::runtime_error( "Error when creating gridded atmosphere, number of grid values is inconsistent with grid" );
+    }
+
+    // Check if local solar time grid is periodic
+    const AtmosphereGridAxis& localSolarTimeAxis = gridAxes_.at( local_solar_time_grid_variable );
+    if( localSolarTimeAxis.numberOfPoints_ > 1 &&
+            std::fabs( localSolarTimeAxis.stepSize_ * static_cast< double >( localSolarTimeAxis.numberOfPoints_ ) - 24.0 )
+            > 1.0E-10 )
+    {
+        throw std::runtime_error( "Error when creating gridded atmosphere, local solar time grid must span 24 hours" );
+    }
+
+    currentIndependentVariables_.fill( TUDAT_NAN );
+}
+
+//! Function to handle an independent variable outside of the grid, according to boundaryHandling_
+void GriddedAtmosphere::handleValueOutsideOfGrid( const int independentVariableIndex, const double independentVariable )
+{
+    if( boundaryHandling_ == interpolators::use_boundary_value )
+    {
+        return;
+    }
+
+    const AtmosphereGridAxis& currentAxis = gridAxes_[ independentVariableIndex ];
+    std::string message = "requesting gridded atmosphere outside of grid, independent variable " +
+            std::to_string( independentVariableIndex ) + " is " + std::to_string( independentVariable ) +
+            " but limit values are " + std::to_string( currentAxis.getValue( 0 ) ) + " and " +
+            std::to_string( currentAxis.getValue( currentAxis.numberOfPoints_ - 1 ) );
+    if( boundaryHandling_ == interpolators::throw_exception_at_boundary )
+    {
+        throw std::runtime_error( "Error, " + message );
+    }
+    else
+    {
+        std::cerr << "Warning, " << message << ", taking boundary value instead." << std::endl;
+    }
+}
+
+//! Function to compute all atmospheric properties at given conditions, if they differ from the previous call.
+void GriddedAtmosphere::computeProperties( const double altitude, const double longitude,
+                                           const double latitude, const double time )
+{
+    if( altitude == currentIndependentVariables_[ 0 ] && longitude == currentIndependentVariables_[ 1 ] &&
+            latitude == currentIndependentVariables_[ 2 ] && time == currentIndependentVariables_[ 3 ] )
+    {
+        return;
+    }
+
+    // Determine grid cell, and position in grid cell, for each independent variable
+    std::array< double, numberOfIndependentVariables > independentVariables =
+    { { altitude, latitude, basic_astrodynamics::calculateLocalSolarTime(
+            basic_astrodynamics::calculateSecondsInCurrentDay( time ), longitude ), time } };
+    std::array< std::size_t, numberOfIndependentVariables > lowerOffsets;
+    std::array< std::size_t, numberOfIndependentVariables > upperOffsets;
+    std::array< double, numberOfIndependentVariables > fractions;
+    for( int i = 0; i < numberOfIndependentVariables; i++ )
+    {
+        const AtmosphereGridAxis& currentAxis = gridAxes_[ i ];
+        std::size_t lowerIndex = 0, upperIndex = 0;
+        double fraction = 0.0;
+        if( currentAxis.numberOfPoints_ > 1 )
+        {
+            double scaledValue = ( independentVariables[ i ] - currentAxis.initialValue_ ) / currentAxis.stepSize_;
+            double maximumIndex = static_cast< double >( currentAxis.numberOfPoints_ - 1 );
+            if( i == local_solar_time_grid_variable )
+            {
+                // Wrap local solar time around grid
+                scaledValue = std::fmod( scaledValue, maximumIndex + 1.0 );
+                if( scaledValue < 0.0 )
+                {
+                    scaledValue += maximumIndex + 1.0;
+                }
+                lowerIndex = std::min( static_cast< std::size_t >( scaledValue ),
+                                       static_cast< std::size_t >( currentAxis.numberOfPoints_ - 1 ) );
+                upperIndex = ( lowerIndex + 1 ) % currentAxis.numberOfPoints_;
+                fraction = scaledValue - static_cast< double >( lowerIndex );
+            }
+            else if( !( scaledValue > 0.0 ) )
+            {
+                // Use boundary value below grid
+                if( scaledValue < 0.0 )
+                {
+                    handleValueOutsideOfGrid( i, independentVariables[ i ] );
+                }
+                lowerIndex = 0;
+                upperIndex = 1;
+                fraction = 0.0;
+            }
+            else if( scaledValue >= maximumIndex )
+            {
+                // Use boundary value above grid
+                if( scaledValue > maximumIndex )
+                {
+                    handleValueOutsideOfGrid( i, independentVariables[ i ] );
+                }
+                lowerIndex = currentAxis.numberOfPoints_ - 2;
+                upperIndex = currentAxis.numberOfPoints_ - 1;
+                fraction = 1.0;
+            }
+            else
+            {
+                lowerIndex = static_cast< std::size_t >( scaledValue );
+                upperIndex = lowerIndex + 1;
+                fraction = scaledValue - static_cast< double >( lowerIndex );
+            }
+        }
+        lowerOffsets[ i ] = lowerIndex * gridStrides_[ i ];
+        upperOffsets[ i ] = upperIndex * gridStrides_[ i ];
+        fractions[ i ] = fraction;
+    }
+
+    // Perform quadrilinear interpolation of all quantities, by summing contributions of corners of grid cell
+    std::array< double, numberOfGridQuantities > interpolatedValues = { { 0.0, 0.0, 0.0, 0.0 } };
+    for( unsigned int corner = 0; corner < ( 1u << numberOfIndependentVariables ); corner++ )
+    {
+        double weight = 1.0;
+        std::size_t offset = 0;
+        for( int i = 0; i < numberOfIndependentVariables; i++ )
+        {
+            if( corner & ( 1u << i ) )
+            {
+                weight *= fractions[ i ];
+                offset += upperOffsets[ i ];
+            }
+            else
+            {
+                weight *= 1.0 - fractions[ i ];
+                offset += lowerOffsets[ i ];
+            }
+        }
+
+        if( weight != 0.0 )
+        {
+            for( int j = 0; j < numberOfGridQuantities; j++ )
+            {
+                interpolatedValues[ j ] += weight * gridValues_[ offset + j ];
+            }
+        }
+    }
+
+    density_ = std::exp( interpolatedValues[ logarithm_of_density_grid_quantity ] );
+    pressure_ = std::exp( interpolatedValues[ logarithm_of_pressure_grid_quantity ] );
+    temperature_ = interpolatedValues[ temperature_grid_quantity ];
+    speedOfSound_ = interpolatedValues[ speed_of_sound_grid_quantity ];
+    currentIndependentVariables_ = { { altitude, longitude, latitude, time } };
+}
+
+//! Function to create a gridded atmosphere by sampling an atmosphere model
+std::shared_ptr< GriddedAtmosphere > createGriddedAtmosphere(
+        const std::shared_ptr< AtmosphereModel > atmosphereModel,
+        const std::array< AtmosphereGridAxis, GriddedAtmosphere::numberOfIndependentVariables >& gridAxes,
+        const interpolators::BoundaryInterpolationType boundaryHandling )
+{
+    const AtmosphereGridAxis& altitudeAxis = gridAxes.at( altitude_grid_variable );
+    const AtmosphereGridAxis& latitudeAxis = gridAxes.at( latitude_grid_variable );
+    const AtmosphereGridAxis& localSolarTimeAxis = gridAxes.at( local_solar_time_grid_variable );
+    const AtmosphereGridAxis& epochAxis = gridAxes.at( epoch_grid_variable );
+
+    // Evaluate atmosphere model at all grid points, in order of storage
+    std::vector< double > gridValues;
+    gridValues.reserve( static_cast< std::size_t >( GriddedAtmosphere::numberOfGridQuantities ) *
+                        altitudeAxis.numberOfPoints_ * latitudeAxis.numberOfPoints_ *
+                        localSolarTimeAxis.numberOfPoints_ * epochAxis.numberOfPoints_ );
+    for( unsigned int i = 0; i < epochAxis.numberOfPoints_; i++ )
+    {
+        double currentTime = epochAxis.getValue( i );
+        for( unsigned int j = 0; j < localSolarTimeAxis.numberOfPoints_; j++ )
+        {
+            double currentLongitude = computeLongitudeFromLocalSolarTime( localSolarTimeAxis.getValue( j ), currentTime );
+            for( unsigned int k = 0; k < latitudeAxis.numberOfPoints_; k++ )
+            {
+                double currentLatitude = latitudeAxis.getValue( k );
+                for( unsigned int l = 0; l < altitudeAxis.numberOfPoints_; l++ )
+                {
+                    double currentAltitude = altitudeAxis.getValue( l );
+                    gridValues.push_back( std::log( atmosphereModel->getDensity(
+                                                        currentAltitude, currentLongitude, currentLatitude, currentTime ) ) );
+                    gridValues.push_back( std::log( atmosphereModel->getPressure(
+                                                        currentAltitude, currentLongitude, currentLatitude, currentTime ) ) );
+                    gridValues.push_back( atmosphereModel->getTemperature(
+                                              currentAltitude, currentLongitude, currentLatitude, currentTime ) );
+                    gridValues.push_back( atmosphereModel->getSpeedOfSound(
+                                              currentAltitude, currentLongitude, currentLatitude, currentTime ) );
+                }
+            }
+        }
+    }
+
+    return std::make_shared< GriddedAtmosphere >( gridAxes, gridValues, boundaryHandling );
+}
+
+//! Function to write a gridded atmosphere to a binary file
+void writeGriddedAtmosphereToFile(
+        const std::shared_ptr< GriddedAtmosphere > griddedAtmosphere,
+        const std::string& fileName )
+{
+    std::ofstream outputFile( fileName.c_str( ), std::ios::binary );
+    if( !outputFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing gridded atmosphere, could not open file " + fileName );
+    }
+
+    // Write header
+    outputFile.write( griddedAtmosphereFileIdentifier, sizeof( griddedAtmosphereFileIdentifier ) );
+    outputFile.write( reinterpret_cast< const char* >( &griddedAtmosphereFileVersion ), sizeof( std::uint32_t ) );
+    outputFile.write( reinterpret_cast< const char* >( &griddedAtmosphereByteOrderMarker ), sizeof( std::uint32_t ) );
+
+    std::array< AtmosphereGridAxis, GriddedAtmosphere::numberOfIndependentVariables > gridAxes =
+            griddedAtmosphere->getGridAxes( );
+    for( unsigned int i = 0; i < gridAxes.size( ); i++ )
+    {
+        std::uint32_t numberOfPoints = gridAxes.at( i ).numberOfPoints_;
+        outputFile.write( reinterpret_cast< const char* >( &gridAxes.at( i ).initialValue_ ), sizeof( double ) );
+        outputFile.write( reinterpret_cast< const char* >( &gridAxes.at( i ).stepSize_ ), sizeof( double ) );
+        outputFile.write( reinterpret_cast< const char* >( &numberOfPoints ), sizeof( std::uint32_t ) );
+    }
+
+    // Write grid values
+    const std::vector< double >& gridValues = griddedAtmosphere->getGridValues( );
+    outputFile.write( reinterpret_cast< const char* >( gridValues.data( ) ), gridValues.size( ) * sizeof( double ) );
+
+    if( !outputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when writing gridded atmosphere to file " + fileName );
+    }
+}
+
+//! Function to read a gridded atmosphere from a binary file
+std::shared_ptr< GriddedAtmosphere > readGriddedAtmosphereFromFile(
+        const std::string& fileName,
+        const interpolators::BoundaryInterpolationType boundaryHandling )
+{
+    std::ifstream inputFile( fileName.c_str( ), std::ios::binary );
+    if( !inputFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading gridded atmosphere, could not open file " + fileName );
+    }
+
+    // Read and check header
+    char fileIdentifier[ sizeof( griddedAtmosphereFileIdentifier ) ];
+    std::uint32_t fileVersion = 0;
+    std::uint32_t byteOrderMarker = 0;
+    inputFile.read( fileIdentifier, sizeof( fileIdentifier ) );
+    inputFile.read( reinterpret_cast< char* >( &fileVersion ), sizeof( std::uint32_t ) );
+    inputFile.read( reinterpret_cast< char* >( &byteOrderMarker ), sizeof( std::uint32_t ) );
+    if( !inputFile.good( ) ||
+            std::memcmp( fileIdentifier, griddedAtmosphereFileIdentifier, sizeof( fileIdentifier ) ) != 0 ||
+            fileVersion != griddedAtmosphereFileVersion )
+    {
+        throw std::runtime_error( "Error when reading gridded atmosphere, file " + fileName +
+                                  " is not a (compatible) gridded atmosphere file" );
+    }
+    if( byteOrderMarker != griddedAtmosphereByteOrderMarker )
+    {
+        throw std::runtime_error( "Error when reading gridded atmosphere, file " + fileName +
+                                  " was written with a different byte order than that of this machine" );
+    }
+
+    // Read grid definition
+    std::array< AtmosphereGridAxis, GriddedAtmosphere::numberOfIndependentVariables > gridAxes;
+    std::size_t numberOfGridValues = GriddedAtmosphere::numberOfGridQuantities;
+    for( unsigned int i = 0; i < gridAxes.size( ); i++ )
+    {
+        std::uint32_t numberOfPoints = 0;
+        inputFile.read( reinterpret_cast< char* >( &gridAxes.at( i ).initialValue_ ), sizeof( double ) );
+        inputFile.read( reinterpret_cast< char* >( &gridAxes.at( i ).stepSize_ ), sizeof( double ) );
+        inputFile.read( reinterpret_cast< char* >( &numberOfPoints ), sizeof( std::uint32_t ) );
+        if( !inputFile.good( ) || numberOfPoints == 0 ||
+                numberOfGridValues > std::numeric_limits< std::size_t >::max( ) / sizeof( double ) / numberOfPoints )
+        {
+            throw std::runtime_error( "Error when reading gridded atmosphere, file " + fileName +
+                                      " has invalid grid definition" );
+        }
+        gridAxes.at( i ).numberOfPoints_ = numberOfPoints;
+        numberOfGridValues *= numberOfPoints;
+    }
+
+    // Check that size of grid in header is consistent with file size, before allocating grid values
+    const std::streampos headerEnd = inputFile.tellg( );
+    inputFile.seekg( 0, std::ios::end );
+    const std::streamoff remainingFileSize = inputFile.tellg( ) - headerEnd;
+    inputFile.seekg( headerEnd );
+    if( !inputFile.good( ) || remainingFileSize < 0 ||
+            static_cast< std::size_t >( remainingFileSize ) != numberOfGridValues * sizeof( double ) )
+    {
+        throw std::runtime_error( "Error when reading gridded atmosphere, size of file " + fileName +
+                                  " is inconsistent with grid definition" );
+    }
+
+    // Read grid values
+    std::vector< double > gridValues( numberOfGridValues );
+    inputFile.read( reinterpret_cast< char* >( gridValues.data( ) ), numberOfGridValues * sizeof( double ) );
+    if( !inputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when reading gridded atmosphere, file " + fileName + " is incomplete" );
+    }
+
+    return std::make_shared< GriddedAtmosphere >( gridAxes, gridValues, boundaryHandling );
+}
+
+} // namespace aerodynamics
+
+} // namespace tudat
@@ -0,0 +1,331 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_GRIDDED_ATMOSPHERE_H
+#define TUDAT_GRIDDED_ATMOSPHERE_H
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
+#include "Tudat/Mathematics/Interpolators/interpolator.h"
+
+namespace tudat
+{
+
+namespace aerodynamics
+{
+
+//! Function to compute the longitude at which a given local solar time is attained
+/*!
+ *  Function to compute the longitude at which a given local solar time is attained at a given time (inverse of
+ *  basic_astrodynamics::calculateLocalSolarTime, with the second of the day computed from the time by
+ *  basic_astrodynamics::calculateSecondsInCurrentDay).
+ *  \param localSolarTime Local solar time, in hours.
+ *  \param time Time at which longitude is to be computed (seconds since J2000).
+ *  \return Longitude, in the range [-pi,pi).
+ */
+double computeLongitudeFromLocalSolarTime( const double localSolarTime, const double time );
+
+//! Enum defining the independent variables of a gridded atmosphere, with the order of the grid dimensions
+enum GriddedAtmosphereIndependentVariables
+{
+    altitude_grid_variable = 0,
+    latitude_grid_variable = 1,
+    local_solar_time_grid_variable = 2,
+    epoch_grid_variable = 3
+};
+
+//! Enum defining the quantities that are stored for each grid point of a gridded atmosphere
+enum GriddedAtmosphereQuantities
+{
+    logarithm_of_density_grid_quantity = 0,
+    logarithm_of_pressure_grid_quantity = 1,
+    temperature_grid_quantity = 2,
+    speed_of_sound_grid_quantity = 3
+};
+
+//! Class defining an equidistant grid of a single independent variable of a gridded atmosphere
+struct AtmosphereGridAxis
+{
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param initialValue Value of independent variable at first grid point
+     *  \param stepSize Step size between grid points
+     *  \param numberOfPoints Number of grid points (if equal to 1, the atmosphere is taken as independent of this
+     *  variable).
+     */
+    AtmosphereGridAxis( const double initialValue = 0.0, const double stepSize = 1.0,
+                        const unsigned int numberOfPoints = 1 ):
+        initialValue_( initialValue ), stepSize_( stepSize ), numberOfPoints_( numberOfPoints ){ }
+
+    //! Function to retrieve the value of the independent variable at a given grid point
+    /*!
+     *  Function to retrieve the value of the independent variable at a given grid point
+     *  \param index Index of grid point
+     *  \return Value of the independent variable at grid point
+     */
+    double getValue( const unsigned int index ) const
+    {
+        return initialValue_ + static_cast< double >( index ) * stepSize_;
+    }
+
+    //! Value of independent variable at first grid point
+    double initialValue_;
+
+    //! Step size between grid points
+    double stepSize_;
+
+    //! Number of grid points
+    unsigned int numberOfPoints_;
+};
+
+//! Atmosphere model that interpolates values precomputed on an equidistant grid
+/*!
+ *  Atmosphere model that interpolates values precomputed on an equidistant four-dimensional grid in altitude, latitude,
+ *  local solar time and epoch (typically generated from a more expensive model, such as NRLMSISE-00, using the
+ *  createGriddedAtmosphere function). Since the grid is equidistant and of fixed dimension, the grid cell and
+ *  interpolation weights are computed directly, without any lookup of the independent variables, and all
+ *  quantities are obtained from a single quadrilinear interpolation. The logarithm of the density and pressure is
+ *  interpolated, so that (locally) exponential altitude profiles are reproduced accurately.
+ *
+ *  The local solar time grid is taken to be periodic, with a period of 24 hours. The behaviour for altitudes, latitudes
+ *  and epochs outside of the grid is set by the boundary handling provided to the constructor: the query is either
+ *  rejected (throw_exception_at_boundary), or the value at the grid boundary is used, with or without a warning
+ *  (use_boundary_value and use_boundary_value_with_warning). Note that using the boundary value above the top of the
+ *  altitude grid results in a density that no longer decreases with altitude.
+ */
+class GriddedAtmosphere: public AtmosphereModel
+{
+public:
+
+    //! Number of independent variables of grid
+    static const int numberOfIndependentVariables = 4;
+
+    //! Number of quantities stored at each grid point
+    static const int numberOfGridQuantities = 4;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param gridAxes Definition of grid of each of the independent variables, in the order of the
+     *  GriddedAtmosphereIndependentVariables enum.
+     *  \param gridValues Values of quantities at each of the grid points, in the order of the GriddedAtmosphereQuantities
+     *  enum, with the quantities as the fastest changing index, followed by altitude, latitude, local solar time and
+     *  epoch, respectively.
+     *  \param boundaryHandling Method for handling altitudes, latitudes and epochs outside of the grid (only
+     *  throw_exception_at_boundary, use_boundary_value and use_boundary_value_with_warning are supported).
+     */
+    GriddedAtmosphere( const std::array< AtmosphereGridAxis, numberOfIndependentVariables >& gridAxes,
+                       const std::vector< double >& gridValues,
+                       const interpolators::BoundaryInterpolationType boundaryHandling =
+            interpolators::use_boundary_value );
+
+    //! Destructor
+    ~GriddedAtmosphere( ){ }
+
+    //! Get local density.
+    /*!
+     *  Returns the local density of the atmosphere in kg per meter^3, at the specified conditions.
+     *  \param altitude Altitude at which density is to be computed.
+     *  \param longitude Longitude at which density is to be computed.
+     *  \param latitude Latitude at which density is to be computed.
+     *  \param time Time at which density is to be computed.
+     *  \return Atmospheric density at specified conditions.
+     */
+    double getDensity( const double altitude, const double longitude,
+                       const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return density_;
+    }
+
+    //! Get local pressure.
+    /*!
+     *  Returns the local pressure of the atmosphere in Newton per meter^2, at the specified conditions.
+     *  \param altitude Altitude at which pressure is to be computed.
+     *  \param longitude Longitude at which pressure is to be computed.
+     *  \param latitude Latitude at which pressure is to be computed.
+     *  \param time Time at which pressure is to be computed.
+     *  \return Atmospheric pressure at specified conditions.
+     */
+    double getPressure( const double altitude, const double longitude,
+                        const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return pressure_;
+    }
+
+    //! Get local temperature.
+    /*!
+     *  Returns the local temperature of the atmosphere in Kelvin, at the specified conditions.
+     *  \param altitude Altitude at which temperature is to be computed.
+     *  \param longitude Longitude at which temperature is to be computed.
+     *  \param latitude Latitude at which temperature is to be computed.
+     *  \param time Time at which temperature is to be computed.
+     *  \return Atmospheric temperature at specified conditions.
+     */
+    double getTemperature( const double altitude, const double longitude,
+                           const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return temperature_;
+    }
+
+    //! Get local speed of sound.
+    /*!
+     *  Returns the local speed of sound of the atmosphere in m/s, at the specified conditions.
+     *  \param altitude Altitude at which speed of sound is to be computed.
+     *  \param longitude Longitude at which speed of sound is to be computed.
+     *  \param latitude Latitude at which speed of sound is to be computed.
+     *  \param time Time at which speed of sound is to be computed.
+     *  \return Atmospheric speed of sound at specified conditions.
+     */
+    double getSpeedOfSound( const double altitude, const double longitude,
+                            const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return speedOfSound_;
+    }
+
+    //! Function to retrieve the definition of grid of each of the independent variables
+    /*!
+     *  Function to retrieve the definition of grid of each of the independent variables
+     *  \return Definition of grid of each of the independent variables
+     */
+    std::array< AtmosphereGridAxis, numberOfIndependentVariables > getGridAxes( )
+    {
+        return gridAxes_;
+    }
+
+    //! Function to retrieve the values of quantities at each of the grid points
+    /*!
+     *  Function to retrieve the values of quantities at each of the grid points (see constructor for ordering)
+     *  \return Values of quantities at each of the grid points
+     */
+    const std::vector< double >& getGridValues( )
+    {
+        return gridValues_;
+    }
+
+    //! Function to retrieve the method for handling independent variables outside of the grid
+    /*!
+     *  Function to retrieve the method for handling altitudes, latitudes and epochs outside of the grid
+     *  \return Method for handling independent variables outside of the grid
+     */
+    interpolators::BoundaryInterpolationType getBoundaryHandling( )
+    {
+        return boundaryHandling_;
+    }
+
+private:
+
+    //! Function to handle an independent variable outside of the grid, according to boundaryHandling_
+    /*!
+     *  Function to handle an independent variable outside of the grid, according to boundaryHandling_: throws an
+     *  exception, or prints a warning, if requested.
+     *  \param independentVariableIndex Index of independent variable (see GriddedAtmosphereIndependentVariables)
+     *  \param independentVariable Value of independent variable that is outside of the grid
+     */
+    void handleValueOutsideOfGrid( const int independentVariableIndex, const double independentVariable );
+
+    //! Function to compute all atmospheric properties at given conditions, if they differ from the previous call.
+    /*!
+     *  Function to compute all atmospheric properties at given conditions, if they differ from the previous call.
+     *  \param altitude Altitude at which properties are to be computed.
+     *  \param longitude Longitude at which properties are to be computed.
+     *  \param latitude Latitude at which properties are to be computed.
+     *  \param time Time at which properties are to be computed.
+     */
+    void computeProperties( const double altitude, const double longitude,
+                            const double latitude, const double time );
+
+    //! Definition of grid of each of the independent variables
+    std::array< AtmosphereGridAxis, numberOfIndependentVariables > gridAxes_;
+
+    //! Values of quantities at each of the grid points (see constructor for ordering)
+    std::vector< double > gridValues_;
+
+    //! Distance in gridValues_ between subsequent grid points of each independent variable.
+    std::array< std::size_t, numberOfIndependentVariables > gridStrides_;
+
+    //! Method for handling altitudes, latitudes and epochs outside of the grid
+    interpolators::BoundaryInterpolationType boundaryHandling_;
+
+    //! Independent variables (altitude, longitude, latitude, time) at which properties were last computed
+    std::array< double, 4 > currentIndependentVariables_;
+
+    //! Density at currentIndependentVariables_
+    double density_;
+
+    //! Pressure at currentIndependentVariables_
+    double pressure_;
+
+    //! Temperature at currentIndependentVariables_
+    double temperature_;
+
+    //! Speed of sound at currentIndependentVariables_
+    double speedOfSound_;
+};
+
+//! Function to create a gridded atmosphere by sampling an atmosphere model
+/*!
+ *  Function to create a gridded atmosphere by sampling an atmosphere model at each of the grid points, where the
+ *  longitude at which the model is evaluated is computed from the local solar time and epoch of the grid point.
+ *  The grid points are evaluated sequentially, as the atmosphere models (e.g. NRLMSISE-00) are not thread-safe.
+ *  \param atmosphereModel Atmosphere model that is to be sampled
+ *  \param gridAxes Definition of grid of each of the independent variables, in the order of the
+ *  GriddedAtmosphereIndependentVariables enum.
+ *  \param boundaryHandling Method for handling altitudes, latitudes and epochs outside of the grid (see
+ *  GriddedAtmosphere constructor).
+ *  \return Gridded atmosphere, generated from atmosphereModel
+ */
+std::shared_ptr< GriddedAtmosphere > createGriddedAtmosphere(
+        const std::shared_ptr< AtmosphereModel > atmosphereModel,
+        const std::array< AtmosphereGridAxis, GriddedAtmosphere::numberOfIndependentVariables >& gridAxes,
+        const interpolators::BoundaryInterpolationType boundaryHandling = interpolators::use_boundary_value );
+
+//! Function to write a gridded atmosphere to a binary file
+/*!
+ *  Function to write a gridded atmosphere to a binary file, which can be read using readGriddedAtmosphereFromFile. The
+ *  file contains a short header with a byte order marker and the grid definition, followed by the raw grid values.
+ *  Values are written in the native byte order of the machine, so the file can only be read on machines with the same
+ *  byte order.
+ *  \param griddedAtmosphere Gridded atmosphere that is to be written to file
+ *  \param fileName Name of file to which the gridded atmosphere is to be written
+ */
+void writeGriddedAtmosphereToFile(
+        const std::shared_ptr< GriddedAtmosphere > griddedAtmosphere,
+        const std::string& fileName );
+
+//! Function to read a gridded atmosphere from a binary file
+/*!
+ *  Function to read a gridded atmosphere from a binary file, written by writeGriddedAtmosphereToFile. An exception is
+ *  thrown if the byte order marker in the header shows that the file was written with a different byte order. The grid
+ *  dimensions in the header are checked against the size of the file before the grid values are read.
+ *  \param fileName Name of file from which the gridded atmosphere is to be read
+ *  \param boundaryHandling Method for handling altitudes, latitudes and epochs outside of the grid (see
+ *  GriddedAtmosphere constructor).
+ *  \return Gridded atmosphere read from file
+ */
+std::shared_ptr< GriddedAtmosphere > readGriddedAtmosphereFromFile(
+        const std::string& fileName,
+        const interpolators::BoundaryInterpolationType boundaryHandling = interpolators::use_boundary_value );
+
+} // namespace aerodynamics
+
+} // namespace tudat
+
+#endif // TUDAT_GRIDDED_ATMOSPHERE_H
@@ -13,6 +13,10 @@
  *
  */
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
 #include <string>
 
 #include <boost/bind.hpp>
@@ -24,6 +28,8 @@
 
 #include <Eigen/Geometry>
 
+#include "Tudat/Basics/dataContentHash.h"
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
@@ -42,6 +48,15 @@ using mathematical_constants::PI;
 
 using namespace geometric_shapes;
 
+//! Identifier at start of local inclination coefficient database file
+static const char localInclinationDatabaseFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'H', 'L', 'A' };
+
+//! Version of local inclination coefficient database file format
+static const std::uint32_t localInclinationDatabaseFileVersion = 3;
+
+//! Marker written after the file version, from which the byte order in which the file was written is determined
+static const std::uint32_t localInclinationDatabaseByteOrderMarker = 0x01020304;
+
 //! Returns default values of mach number for use in HypersonicLocalInclinationAnalysis.
 std::vector< double > getDefaultHypersonicLocalInclinationMachPoints(
         const std::string& machRegime )
@@ -165,6 +180,170 @@ void saveVehicleMeshToFile(
 }
 
 
+//! Function to compute the inclination angles of a set of panels w.r.t. the freestream flow.
+void computePanelInclinationAngles(
+        const Eigen::Matrix< double, Eigen::Dynamic, 3 >& panelSurfaceNormals,
+        const Eigen::Vector3d& freestreamVelocityDirection,
+        Eigen::VectorXd& panelInclinations )
+{
+    // Determine cosine of inclination angles from inner product between surface normals and
+    // free-stream direction, and convert to inclination angles.
+    panelInclinations.noalias( ) = panelSurfaceNormals * freestreamVelocityDirection;
+    panelInclinations.array( ) = PI / 2.0 - panelInclinations.array( ).acos( );
+}
+
+//! Function to compute the pressure coefficients of all compression panels (inclination > 0) of a set of panels.
+void computeLocalInclinationCompressionPressureCoefficients(
+        const int method, const double machNumber, const double ratioOfSpecificHeats,
+        const Eigen::VectorXd& panelInclinations, Eigen::VectorXd& pressureCoefficients )
+{
+    const Eigen::ArrayXd& inclinations = panelInclinations.array( );
+    Eigen::ArrayXd sineOfInclinations = inclinations.sin( );
+
+    // Compute pressure coefficients for all panels using selected method.
+    Eigen::ArrayXd compressionPressureCoefficients;
+    switch( method )
+    {
+    case 0:
+        compressionPressureCoefficients = 2.0 * sineOfInclinations.square( );
+        break;
+    case 1:
+        compressionPressureCoefficients =
+                computeStagnationPressure( machNumber, ratioOfSpecificHeats ) * sineOfInclinations.square( );
+        break;
+    case 4:
+    {
+        Eigen::ArrayXd machNumberSines = machNumber * sineOfInclinations;
+        compressionPressureCoefficients =
+                ( ( 1.2 * machNumberSines + ( -0.6 * machNumberSines ).exp( ) ).square( ) - 1.0 ) /
+                ( 0.6 * machNumber * machNumber );
+        break;
+    }
+    case 5:
+    {
+        Eigen::ArrayXd machNumberSines = machNumber * sineOfInclinations;
+        Eigen::ArrayXd temporaryValues =
+                ( 1.090909 * machNumberSines + ( -0.5454545 * machNumberSines ).exp( ) ).square( );
+        compressionPressureCoefficients =
+                ( 48.0 * temporaryValues * sineOfInclinations.square( ) ) / ( 23.0 * temporaryValues - 5.0 );
+        break;
+    }
+    case 6:
+    {
+        // Use Newtonian approximation above check angle, Dahlem-Buck method otherwise.
+        compressionPressureCoefficients =
+                ( inclinations > 22.5 * PI / 180.0 ).select(
+                    2.0 * sineOfInclinations.square( ),
+                    ( 1.0 + ( 4.0 * inclinations.pow( 0.75 ) ).sin( ) ) /
+                    ( 4.0 * inclinations.cos( ) * ( 2.0 * inclinations ).cos( ) ).pow( 0.75 ) *
+                    sineOfInclinations.pow( 1.25 ) );
+
+        // For mach < 20, a correction term should be applied.
+        if ( machNumber <= 20.0 )
+        {
+            double factor = ( 6.0 - 0.3 * machNumber ) + std::sin( PI * ( std::log( machNumber ) - 0.588 ) / 1.20 );
+            double exponent = 1.15 + 0.5 * std::sin( PI * ( std::log( machNumber ) - 0.916 ) / 3.29 );
+            compressionPressureCoefficients *= 1.0 + factor * ( inclinations * 180.0 / PI ).pow( -1.0 * exponent );
+        }
+        break;
+    }
+    case 7:
+    {
+        double ratioOfSpecificHeatsTerm = ( ratioOfSpecificHeats + 1.0 ) / 2.0;
+        double machNumberTerm = std::sqrt( machNumber * machNumber - 1.0 );
+        compressionPressureCoefficients =
+                inclinations.square( ) * ( ratioOfSpecificHeatsTerm +
+                                           ( ratioOfSpecificHeatsTerm * ratioOfSpecificHeatsTerm +
+                                             4.0 / ( inclinations * machNumberTerm ).square( ) ).sqrt( ) );
+        break;
+    }
+    case 8:
+    {
+        // Angles lower than 1 degree are not allowed.
+        Eigen::ArrayXd machNumberSines = machNumber * inclinations.max( PI / 180.0 ).sin( );
+        compressionPressureCoefficients =
+                1.66667 * ( ( 1.09 * machNumberSines + ( -0.49 * machNumberSines ).exp( ) ).square( ) - 1.0 ) /
+                ( machNumber * machNumber );
+        break;
+    }
+    case 9:
+    {
+        // Calculate 'effective' stagnation pressure coefficient, and corresponding pressure coefficient.
+        double machNumberTerm = std::pow( machNumber, 0.3 );
+        compressionPressureCoefficients =
+                ( inclinations < PI / 18.0 ).select(
+                    ( 0.195 + 0.222594 / machNumberTerm - 0.4 ) * inclinations * 180.0 / PI + 4.0,
+                    1.95 + 0.3925 / ( machNumberTerm * inclinations.tan( ) ) ) * sineOfInclinations.square( );
+        break;
+    }
+    default:
+        // Methods 2 and 3 currently disabled.
+        if( ( inclinations > 0.0 ).any( ) )
+        {
+            throw std::runtime_error( "Error, compression local inclination method number "
+                                      + std::to_string( method ) + " not available" );
+        }
+        return;
+    }
+
+    // Set pressure coefficients of compression panels.
+    pressureCoefficients.array( ) =
+            ( inclinations > 0.0 ).select( compressionPressureCoefficients, pressureCoefficients.array( ) );
+}
+
+//! Function to compute the pressure coefficients of all expansion panels (inclination <= 0) of a set of panels.
+void computeLocalInclinationExpansionPressureCoefficients(
+        const int method, const double machNumber, const double ratioOfSpecificHeats,
+        const Eigen::VectorXd& panelInclinations, Eigen::VectorXd& pressureCoefficients )
+{
+    const Eigen::ArrayXd& inclinations = panelInclinations.array( );
+
+    switch( method )
+    {
+    case 0:
+        pressureCoefficients.array( ) = ( inclinations <= 0.0 ).select(
+                    computeVacuumPressureCoefficient( machNumber, ratioOfSpecificHeats ),
+                    pressureCoefficients.array( ) );
+        break;
+    case 1:
+        pressureCoefficients.array( ) = ( inclinations <= 0.0 ).select( 0.0, pressureCoefficients.array( ) );
+        break;
+    case 4:
+        pressureCoefficients.array( ) = ( inclinations <= 0.0 ).select(
+                    computeHighMachBasePressure( machNumber ), pressureCoefficients.array( ) );
+        break;
+    case 3:
+    case 5:
+    {
+        // Prandtl-Meyer expansion requires iterative inversion of Prandtl-Meyer function, evaluate per panel.
+        double freestreamPrandtlMeyerFunction = ( method == 3 ) ?
+                    computePrandtlMeyerFunction( machNumber, ratioOfSpecificHeats ) : -1.0;
+        for ( int i = 0 ; i < panelInclinations.rows( ); i++ )
+        {
+            if ( panelInclinations( i ) <= 0 )
+            {
+                pressureCoefficients( i ) = computePrandtlMeyerFreestreamPressureCoefficient(
+                            panelInclinations( i ), machNumber, ratioOfSpecificHeats,
+                            freestreamPrandtlMeyerFunction );
+            }
+        }
+        break;
+    }
+    case 6:
+    {
+        // Compute preliminary pressure coefficients, limited by minimum pressure coefficient.
+        double squaredMachNumber = machNumber * machNumber;
+        pressureCoefficients.array( ) = ( inclinations <= 0.0 ).select(
+                    ( 180.0 / PI * inclinations / ( 16.0 * squaredMachNumber ) ).max( -1.0 / squaredMachNumber ),
+                    pressureCoefficients.array( ) );
+        break;
+    }
+    default:
+        throw std::runtime_error( "Error, expansion local inclination method number "
+                                  + std::to_string( method ) + " not recognized" );
+    }
+}
+
 //! Default constructor.
 HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         const std::vector< std::vector< double > >& dataPointsOfIndependentVariables,
@@ -176,14 +355,16 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         const double referenceArea,
         const double referenceLength,
         const Eigen::Vector3d& momentReferencePoint,
-        const bool savePressureCoefficients )
+        const bool savePressureCoefficients,
+        const unsigned int numberOfThreads,
+        const std::string& coefficientDatabaseFile )
     : AerodynamicCoefficientGenerator< 3, 6 >(
           dataPointsOfIndependentVariables, referenceLength, referenceArea, referenceLength,
           momentReferencePoint, { mach_number_dependent, angle_of_attack_dependent, angle_of_sideslip_dependent },true, false ),
-      stagnationPressureCoefficient( 2.0 ),
       ratioOfSpecificHeats( 1.4 ),
       selectedMethods_( selectedMethods ),
-      savePressureCoefficients_( savePressureCoefficients )
+      savePressureCoefficients_( savePressureCoefficients ),
+      numberOfThreads_( numberOfThreads )
 {
     // Set geometry if it is a single surface.
     if ( std::dynamic_pointer_cast< SingleSurfaceGeometry > ( inputVehicleSurface ) !=
@@ -253,19 +434,8 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         }
     }
 
-    // Allocate memory for panel inclinations and pressureCoefficient_.
-    inclination_.resize( vehicleParts_.size( ) );
-    pressureCoefficient_.resize( vehicleParts_.size( ) );
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
-    {
-        inclination_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        pressureCoefficient_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        for ( int j = 0 ; j < vehicleParts_[ i ]->getNumberOfLines( ) ; j++ )
-        {
-            inclination_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-            pressureCoefficient_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-        }
-    }
+    // Set contiguous panel property buffers.
+    setPanelProperties( );
 
     boost::array< int, 3 > numberOfPointsPerIndependentVariables;
     for( int i = 0; i < 3; i++ )
@@ -279,7 +449,16 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
     std::fill( isCoefficientGenerated_.origin( ),
                isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 0 );
 
-    generateCoefficients( );
+    // Load coefficients from file if possible, generate (and save) them otherwise.
+    if( coefficientDatabaseFile == "" )
+    {
+        generateCoefficients( );
+    }
+    else if( savePressureCoefficients_ || !loadCoefficientDatabaseFromFile( coefficientDatabaseFile ) )
+    {
+        generateCoefficients( );
+        saveCoefficientDatabaseToFile( coefficientDatabaseFile );
+    }
     createInterpolator( );
 }
 
@@ -296,27 +475,72 @@ Vector6d HypersonicLocalInclinationAnalysis::getAerodynamicCoefficientsDataPoint
     return aerodynamicCoefficients_( independentVariables );
 }
 
+//! Function to retrieve the panel pressure coefficients at a given data point
+std::vector< std::vector< std::vector< double > > > HypersonicLocalInclinationAnalysis::getPressureCoefficientList(
+        const boost::array< int, 3 > independentVariables )
+{
+    if( pressureCoefficientList_.count( independentVariables ) == 0 )
+    {
+        throw std::runtime_error( "Error, pressure coefficients of local inclination analysis not saved at requested "
+                                  "data point" );
+    }
+    const std::vector< Eigen::VectorXd >& pressureCoefficients = pressureCoefficientList_.at( independentVariables );
+
+    // Set pressure coefficients in part-line-point format.
+    std::vector< std::vector< std::vector< double > > > pressureCoefficientList( vehicleParts_.size( ) );
+    for ( unsigned int k = 0 ; k < vehicleParts_.size( ); k++ )
+    {
+        int numberOfLines = vehicleParts_[ k ]->getNumberOfLines( );
+        int numberOfPoints = vehicleParts_[ k ]->getNumberOfPoints( );
+        pressureCoefficientList[ k ].resize(
+                    numberOfLines, std::vector< double >( numberOfPoints, 0.0 ) );
+        for ( int i = 0 ; i < numberOfLines - 1 ; i++ )
+        {
+            for ( int j = 0 ; j < numberOfPoints - 1 ; j++ )
+            {
+                pressureCoefficientList[ k ][ i ][ j ] =
+                        pressureCoefficients[ k ]( i * ( numberOfPoints - 1 ) + j );
+            }
+        }
+    }
+    return pressureCoefficientList;
+}
+
 //! Generate aerodynamic database.
 void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 {
-    // Allocate variable to pass to coefficient determination for independent
-    // variable indices.
-    boost::array< int, 3 > independentVariableIndices;
+    int numberOfAnglesOfAttack = dataPointsOfIndependentVariables_[ 1 ].size( );
+    int numberOfAnglesOfSideslip = dataPointsOfIndependentVariables_[ 2 ].size( );
+
+    // Generate coefficients for all combinations of angle of attack and sideslip, each of which is handled
+    // independently (possibly concurrently).
+    std::vector< std::vector< std::vector< Eigen::VectorXd > > > pressureCoefficientsPerAttitude(
+                numberOfAnglesOfAttack * numberOfAnglesOfSideslip );
+    utilities::executeParallelForLoop(
+                numberOfAnglesOfAttack * numberOfAnglesOfSideslip,
+                [ & ]( const unsigned int attitudeIndex, const unsigned int )
+    {
+        determineVehicleCoefficientsAtAttitude(
+                    attitudeIndex / numberOfAnglesOfSideslip, attitudeIndex % numberOfAnglesOfSideslip,
+                    pressureCoefficientsPerAttitude.at( attitudeIndex ) );
+    }, numberOfThreads_ );
 
-    // Iterate over all combinations of independent variables.
-    for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
+    // Store pressure coefficients, if required.
+    if( savePressureCoefficients_ )
     {
-        independentVariableIndices[ 0 ] = i;
-        for ( unsigned  int j = 0 ; j < dataPointsOfIndependentVariables_[
-              1 ].size( ) ; j++ )
+        boost::array< int, 3 > independentVariableIndices;
+        for ( int j = 0 ; j < numberOfAnglesOfAttack ; j++ )
         {
             independentVariableIndices[ 1 ] = j;
-            for ( unsigned  int k = 0 ; k < dataPointsOfIndependentVariables_[
-                  2 ].size( ) ; k++ )
+            for ( int k = 0 ; k < numberOfAnglesOfSideslip ; k++ )
             {
                 independentVariableIndices[ 2 ] = k;
-
-                determineVehicleCoefficients( independentVariableIndices );
+                for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
+                {
+                    independentVariableIndices[ 0 ] = i;
+                    pressureCoefficientList_[ independentVariableIndices ] =
+                            pressureCoefficientsPerAttitude.at( j * numberOfAnglesOfSideslip + k ).at( i );
+                }
             }
         }
     }
@@ -326,149 +550,105 @@ void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
         const boost::array< int, 3 > independentVariableIndices )
 {
-    // Declare coefficients vector and initialize to zeros.
-    Vector6d coefficients = Vector6d::Zero( );
-
-    // Loop over all vehicle parts, calculate aerodynamic coefficients and add
-    // to aerodynamicCoefficients_.
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
-    {
-        coefficients += determinePartCoefficients( i, independentVariableIndices );
-    }
+    // Determine panel inclinations.
+    std::vector< Eigen::VectorXd > panelInclinations;
+    determineInclinations( dataPointsOfIndependentVariables_[ 1 ][ independentVariableIndices[ 1 ] ],
+                           dataPointsOfIndependentVariables_[ 2 ][ independentVariableIndices[ 2 ] ],
+                           panelInclinations );
+
+    // Compute and set coefficients.
+    std::vector< Eigen::VectorXd > pressureCoefficients;
+    aerodynamicCoefficients_( independentVariableIndices ) = computeVehicleCoefficients(
+                dataPointsOfIndependentVariables_[ 0 ][ independentVariableIndices[ 0 ] ],
+                panelInclinations, pressureCoefficients );
+    isCoefficientGenerated_( independentVariableIndices ) = 1;
 
     if( savePressureCoefficients_ )
     {
-        pressureCoefficientList_[ independentVariableIndices ] = pressureCoefficient_;
+        pressureCoefficientList_[ independentVariableIndices ] = pressureCoefficients;
     }
-
-    aerodynamicCoefficients_( independentVariableIndices ) = coefficients;
-    isCoefficientGenerated_( independentVariableIndices ) = 1;
 }
 
-//! Determine aerodynamic coefficients of a single vehicle part.
-Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+//! Generate aerodynamic coefficients at all Mach numbers, for a single angle of attack and sideslip.
+void HypersonicLocalInclinationAnalysis::determineVehicleCoefficientsAtAttitude(
+        const int angleOfAttackIndex, const int angleOfSideslipIndex,
+        std::vector< std::vector< Eigen::VectorXd > >& pressureCoefficientsPerMachNumber )
 {
-    // Declare and determine angles of attack and sideslip for analysis.
-    double angleOfAttack =  dataPointsOfIndependentVariables_[ 1 ]
-            [ independentVariableIndices[ 1 ] ];
-
-    double angleOfSideslip =  dataPointsOfIndependentVariables_[ 2 ]
-            [ independentVariableIndices[ 2 ] ];
-
-    // Declare partCoefficient vector.
-    Vector6d partCoefficients = Vector6d::Zero( );
-
-    // Check whether the inclinations of the vehicle part have already been computed.
-    if ( previouslyComputedInclinations_.count( std::pair< double, double >(
-                                                    angleOfAttack, angleOfSideslip ) ) == 0 )
+    // Determine panel inclinations, which are independent of Mach number.
+    std::vector< Eigen::VectorXd > panelInclinations;
+    determineInclinations( dataPointsOfIndependentVariables_[ 1 ][ angleOfAttackIndex ],
+                           dataPointsOfIndependentVariables_[ 2 ][ angleOfSideslipIndex ],
+                           panelInclinations );
+
+    // Compute coefficients at all Mach numbers.
+    std::vector< Eigen::VectorXd > pressureCoefficients;
+    boost::array< int, 3 > independentVariableIndices;
+    independentVariableIndices[ 1 ] = angleOfAttackIndex;
+    independentVariableIndices[ 2 ] = angleOfSideslipIndex;
+    for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
     {
-        // Determine panel inclinations for part.
-        determineInclinations( angleOfAttack, angleOfSideslip );
-
-        // Add panel inclinations to container
-        previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ] = inclination_;
-    }
+        independentVariableIndices[ 0 ] = i;
+        aerodynamicCoefficients_( independentVariableIndices ) = computeVehicleCoefficients(
+                    dataPointsOfIndependentVariables_[ 0 ][ i ], panelInclinations, pressureCoefficients );
+        isCoefficientGenerated_( independentVariableIndices ) = 1;
 
-    else
-    {
-        // Fetch inclinations from container
-        inclination_ = previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ];
+        if( savePressureCoefficients_ )
+        {
+            pressureCoefficientsPerMachNumber.push_back( pressureCoefficients );
+        }
     }
-
-    // Set pressureCoefficient_ array for given independent variables.
-    determinePressureCoefficients( partNumber, independentVariableIndices );
-
-    // Calculate force coefficients from pressure coefficients.
-    partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( partNumber );
-
-    // Calculate moment coefficients from pressure coefficients.
-    partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( partNumber );
-
-    return partCoefficients;
-}
-
-//! Determine the pressure coefficients on a single vehicle part.
-void HypersonicLocalInclinationAnalysis::determinePressureCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
-{
-    // Retrieve Mach number.
-    double machNumber = dataPointsOfIndependentVariables_[ 0 ]
-            [ independentVariableIndices[ 0 ] ];
-
-    // Determine stagnation point pressure coefficients. Value is computed once
-    // here to prevent its calculation in inner loop.
-    stagnationPressureCoefficient = computeStagnationPressure(
-                machNumber, ratioOfSpecificHeats );
-
-    updateCompressionPressures( machNumber, partNumber );
-    updateExpansionPressures( machNumber, partNumber );
 }
 
-//! Determine force coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients(
-        const int partNumber )
+//! Determine aerodynamic coefficients for all LaWGS parts at given Mach number and panel inclinations.
+Vector6d HypersonicLocalInclinationAnalysis::computeVehicleCoefficients(
+        const double machNumber,
+        const std::vector< Eigen::VectorXd >& panelInclinations,
+        std::vector< Eigen::VectorXd >& pressureCoefficients ) const
 {
-    // Declare force coefficient vector and intialize to zeros.
-    Eigen::Vector3d forceCoefficients = Eigen::Vector3d::Zero( );
+    // Declare coefficients vector and initialize to zeros.
+    Vector6d coefficients = Vector6d::Zero( );
 
-    // Loop over all panels and add pressures, scaled by panel area, to force
+    // Loop over all vehicle parts, calculate pressure coefficients, and add resulting aerodynamic
     // coefficients.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+    pressureCoefficients.resize( vehicleParts_.size( ) );
+    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++)
-        {
-            forceCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    vehicleParts_[ partNumber ]->getPanelSurfaceNormal( i, j );
-        }
+        determinePressureCoefficients(
+                    machNumber, i, panelInclinations.at( i ), pressureCoefficients.at( i ) );
+
+        // Sum panel pressures, scaled by panel area, to obtain force and moment coefficients.
+        coefficients.segment( 0, 3 ) -=
+                areaWeightedSurfaceNormals_.at( i ).transpose( ) * pressureCoefficients.at( i );
+        coefficients.segment( 3, 3 ) -=
+                areaWeightedMomentArms_.at( i ).transpose( ) * pressureCoefficients.at( i );
     }
 
-    // Normalize result by reference area.
-    forceCoefficients /= referenceArea_;
+    // Normalize result by reference area (and length).
+    coefficients.segment( 0, 3 ) /= referenceArea_;
+    coefficients.segment( 3, 3 ) /= ( referenceLength_ * referenceArea_ );
 
-    return forceCoefficients;
+    return coefficients;
 }
 
-//! Determine moment coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateMomentCoefficients(
-        const int partNumber )
+//! Determine the pressure coefficients on a single vehicle part.
+void HypersonicLocalInclinationAnalysis::determinePressureCoefficients(
+        const double machNumber, const int partNumber,
+        const Eigen::VectorXd& panelInclinations,
+        Eigen::VectorXd& pressureCoefficients ) const
 {
-    // Declare moment coefficient vector and intialize to zeros.
-    Eigen::Vector3d momentCoefficients = Eigen::Vector3d::Zero( );
-
-    // Declare moment arm for panel moment determination.
-    Eigen::Vector3d referenceDistance;
-
-    // Loop over all panels and add moments due pressures.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-    {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            // Determine moment arm for given panel centroid.
-            referenceDistance = ( vehicleParts_[ partNumber ]->getPanelCentroid( i, j ) -
-                                  momentReferencePoint_ );
-
-            momentCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    ( referenceDistance.cross( vehicleParts_[ partNumber ]->
-                                               getPanelSurfaceNormal( i, j ) ) );
-        }
-    }
-
-    // Scale result by reference length and area.
-    momentCoefficients /= ( referenceLength_ * referenceArea_ );
-
-    return momentCoefficients;
+    pressureCoefficients.setZero( panelInclinations.rows( ) );
+    computeLocalInclinationCompressionPressureCoefficients(
+                selectedMethods_[ 0 ][ partNumber ], machNumber, ratioOfSpecificHeats,
+                panelInclinations, pressureCoefficients );
+    computeLocalInclinationExpansionPressureCoefficients(
+                selectedMethods_[ 1 ][ partNumber ], machNumber, ratioOfSpecificHeats,
+                panelInclinations, pressureCoefficients );
 }
 
-//! Determines the inclination angle of panels on a single part.
-void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack,
-                                                                const double angleOfSideslip )
+//! Determines the inclination angle of panels on all parts.
+void HypersonicLocalInclinationAnalysis::determineInclinations(
+        const double angleOfAttack, const double angleOfSideslip,
+        std::vector< Eigen::VectorXd >& panelInclinations ) const
 {
     // Declare free-stream velocity vector.
     Eigen::Vector3d freestreamVelocityDirection;
@@ -481,213 +661,206 @@ void HypersonicLocalInclinationAnalysis::determineInclinations( const double ang
     freestreamVelocityDirection( 1 ) = freestreamVelocityDirectionY;
     freestreamVelocityDirection( 2 ) = freestreamVelocityDirectionZ;
 
-    // Declare cosine of inclination angle.
-    double cosineOfInclination;
-
-    // Loop over all panels of given vehicle part and set inclination angles.
+    // Loop over all vehicle parts and set inclination angles.
+    panelInclinations.resize( vehicleParts_.size( ) );
     for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
-        {
-            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
+        computePanelInclinationAngles( vehicleParts_[ k ]->getPanelSurfaceNormalMatrix( ),
+                                       freestreamVelocityDirection, panelInclinations[ k ] );
+    }
+}
 
-                // Determine cosine of inclination angle from inner product between
-                // surface normal and free-stream direction.
-                cosineOfInclination = vehicleParts_[ k ]->
-                        getPanelSurfaceNormal( i, j ).
-                        dot( freestreamVelocityDirection );
+//! Function to set the contiguous panel property buffers from the vehicle parts.
+void HypersonicLocalInclinationAnalysis::setPanelProperties( )
+{
+    areaWeightedSurfaceNormals_.resize( vehicleParts_.size( ) );
+    areaWeightedMomentArms_.resize( vehicleParts_.size( ) );
 
-                // Set inclination angle.
-                inclination_[ k ][ i ][ j ] = PI / 2.0 - acos( cosineOfInclination );
-            }
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
+    {
+        const Eigen::Matrix< double, Eigen::Dynamic, 3 >& surfaceNormals =
+                vehicleParts_[ k ]->getPanelSurfaceNormalMatrix( );
+        const Eigen::VectorXd& panelAreas = vehicleParts_[ k ]->getPanelAreaVector( );
+        Eigen::Matrix< double, Eigen::Dynamic, 3 > momentArms =
+                vehicleParts_[ k ]->getPanelCentroidMatrix( ).rowwise( ) - momentReferencePoint_.transpose( );
+
+        // Scale surface normals by panel area.
+        areaWeightedSurfaceNormals_[ k ] = surfaceNormals.array( ).colwise( ) * panelAreas.array( );
+
+        // Compute cross product of moment arm and surface normal, scaled by panel area, component-wise.
+        areaWeightedMomentArms_[ k ].resize( surfaceNormals.rows( ), 3 );
+        for( int i = 0; i < 3; i++ )
+        {
+            int j = ( i + 1 ) % 3;
+            int l = ( i + 2 ) % 3;
+            areaWeightedMomentArms_[ k ].col( i ) = panelAreas.array( ) * (
+                        momentArms.col( j ).array( ) * surfaceNormals.col( l ).array( ) -
+                        momentArms.col( l ).array( ) * surfaceNormals.col( j ).array( ) );
         }
     }
 }
 
-//! Determine compression pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const double machNumber,
-                                                                     const int partNumber )
+//! Function to add the hash of a panel property array to a database signature (as two exactly representable values).
+template< typename MatrixType >
+void addPanelPropertyHashToSignature( const MatrixType& panelProperties, std::vector< double >& signature )
 {
-    int method = selectedMethods_[ 0 ][ partNumber ];
+    const std::uint64_t panelPropertyHash = utilities::computeDataContentHash(
+                reinterpret_cast< const char* >( panelProperties.data( ) ),
+                static_cast< std::size_t >( panelProperties.size( ) ) * sizeof( double ) );
+    signature.push_back( static_cast< double >( panelPropertyHash >> 32 ) );
+    signature.push_back( static_cast< double >( panelPropertyHash & 0xffffffffULL ) );
+}
 
-    std::function< double( double ) > pressureFunction;
+//! Function to compute the signature of the analysis settings, used to check compatibility of database files
+std::vector< double > HypersonicLocalInclinationAnalysis::getCoefficientDatabaseSignature( )
+{
+    std::vector< double > signature;
 
-    // Switch to analyze part using correct method.
-    switch( method )
+    // Add data points of independent variables.
+    for( unsigned int i = 0; i < dataPointsOfIndependentVariables_.size( ); i++ )
     {
-    case 0:
-        pressureFunction =
-                std::bind( aerodynamics::computeNewtonianPressureCoefficient, std::placeholders::_1 );
-        break;
-
-    case 1:
-        pressureFunction =
-                std::bind( aerodynamics::computeModifiedNewtonianPressureCoefficient, std::placeholders::_1,
-                           stagnationPressureCoefficient );
-        break;
-
-    case 2:
-        // Method currently disabled.
-        break;
-
-    case 3:
-        // Method currently disabled.
-        break;
-
-    case 4:
-        pressureFunction =
-                std::bind( aerodynamics::computeEmpiricalTangentWedgePressureCoefficient, std::placeholders::_1,
-                           machNumber );
-        break;
-
-    case 5:
-        pressureFunction =
-                std::bind( aerodynamics::computeEmpiricalTangentConePressureCoefficient, std::placeholders::_1,
-                           machNumber );
-        break;
-
-    case 6:
-        pressureFunction =
-                std::bind( aerodynamics::computeModifiedDahlemBuckPressureCoefficient, std::placeholders::_1,
-                           machNumber );
-        break;
-
-    case 7:
-        pressureFunction =
-                std::bind( aerodynamics::computeVanDykeUnifiedPressureCoefficient, std::placeholders::_1,
-                           machNumber, ratioOfSpecificHeats, 1 );
-        break;
-
-    case 8:
-        pressureFunction =
-                std::bind( aerodynamics::computeSmythDeltaWingPressureCoefficient, std::placeholders::_1,
-                           machNumber );
-        break;
-
-    case 9:
-        pressureFunction =
-                std::bind( aerodynamics::computeHankeyFlatSurfacePressureCoefficient, std::placeholders::_1,
-                           machNumber );
-        break;
+        signature.push_back( static_cast< double >( dataPointsOfIndependentVariables_[ i ].size( ) ) );
+        signature.insert( signature.end( ), dataPointsOfIndependentVariables_[ i ].begin( ),
+                          dataPointsOfIndependentVariables_[ i ].end( ) );
+    }
 
-    default:
-        break;
+    // Add reference quantities.
+    signature.push_back( referenceArea_ );
+    signature.push_back( referenceLength_ );
+    for( int i = 0; i < 3; i++ )
+    {
+        signature.push_back( momentReferencePoint_( i ) );
     }
+    signature.push_back( ratioOfSpecificHeats );
 
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
+    // Add selected methods and panel geometry of each part.
+    signature.push_back( static_cast< double >( vehicleParts_.size( ) ) );
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            if ( inclination_[ partNumber ][ i ][ j ] > 0 )
-            {
-                // If panel inclination is positive, calculate pressure coefficient.
-                pressureCoefficient_[ partNumber ][ i ][ j ] =
-                        pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-            }
-        }
+        signature.push_back( static_cast< double >( selectedMethods_[ 0 ][ k ] ) );
+        signature.push_back( static_cast< double >( selectedMethods_[ 1 ][ k ] ) );
+        signature.push_back( static_cast< double >( areaWeightedSurfaceNormals_[ k ].rows( ) ) );
+        addPanelPropertyHashToSignature( vehicleParts_[ k ]->getPanelSurfaceNormalMatrix( ), signature );
+        addPanelPropertyHashToSignature( vehicleParts_[ k ]->getPanelCentroidMatrix( ), signature );
+        addPanelPropertyHashToSignature( vehicleParts_[ k ]->getPanelAreaVector( ), signature );
+        addPanelPropertyHashToSignature( areaWeightedMomentArms_[ k ], signature );
     }
+
+    return signature;
 }
 
-//! Determines expansion pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double machNumber,
-                                                                   const int partNumber )
+//! Function to save the aerodynamic coefficient database to a binary file
+void HypersonicLocalInclinationAnalysis::saveCoefficientDatabaseToFile( const std::string& fileName )
 {
-    // Get analysis method of part to analyze.
-    int method = selectedMethods_[ 1 ][ partNumber ];
-
-    if ( method == 0 || method == 1 || method == 4 )
+    std::ofstream outputFile( fileName.c_str( ), std::ios::binary );
+    if( !outputFile.is_open( ) )
     {
-        std::function< double( ) > pressureFunction;
-        switch( method )
-        {
-        case 0:
-            pressureFunction = std::bind( &aerodynamics::computeVacuumPressureCoefficient,
-                                          machNumber, ratioOfSpecificHeats );
-            break;
-
-        case 1:
-            pressureFunction = [ ]( ){ return 0.0; };
-            break;
-
-        case 4:
-            pressureFunction = std::bind( &aerodynamics::computeHighMachBasePressure,
-                                          machNumber );
-            break;
-
-        }
+        throw std::runtime_error( "Error when writing local inclination coefficient database, could not open file " +
+                                  fileName );
+    }
 
-        // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+    // Make sure that all coefficients have been computed.
+    boost::array< int, 3 > independentVariableIndices;
+    for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
+    {
+        independentVariableIndices[ 0 ] = i;
+        for ( unsigned int j = 0 ; j < dataPointsOfIndependentVariables_[ 1 ].size( ) ; j++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            independentVariableIndices[ 1 ] = j;
+            for ( unsigned int k = 0 ; k < dataPointsOfIndependentVariables_[ 2 ].size( ) ; k++ )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( );
-                }
+                independentVariableIndices[ 2 ] = k;
+                getAerodynamicCoefficientsDataPoint( independentVariableIndices );
             }
         }
     }
 
-    else if( method == 3 || method == 5 || method == 6 )
+    // Write header and settings signature.
+    std::vector< double > signature = getCoefficientDatabaseSignature( );
+    std::uint32_t signatureSize = signature.size( );
+    outputFile.write( localInclinationDatabaseFileIdentifier, sizeof( localInclinationDatabaseFileIdentifier ) );
+    outputFile.write( reinterpret_cast< const char* >( &localInclinationDatabaseFileVersion ),
+                      sizeof( std::uint32_t ) );
+    outputFile.write( reinterpret_cast< const char* >( &localInclinationDatabaseByteOrderMarker ),
+                      sizeof( std::uint32_t ) );
+    outputFile.write( reinterpret_cast< const char* >( &signatureSize ), sizeof( std::uint32_t ) );
+    outputFile.write( reinterpret_cast< const char* >( signature.data( ) ), signatureSize * sizeof( double ) );
+
+    // Write coefficients, in storage order of multi-array.
+    for( unsigned int i = 0; i < aerodynamicCoefficients_.num_elements( ); i++ )
     {
+        outputFile.write( reinterpret_cast< const char* >( aerodynamicCoefficients_.data( )[ i ].data( ) ),
+                          6 * sizeof( double ) );
+    }
 
-        std::function< double( double ) > pressureFunction;
+    if( !outputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when writing local inclination coefficient database to file " + fileName );
+    }
+}
 
-        // Declare local variable.
-        double freestreamPrandtlMeyerFunction;
+//! Function to load the aerodynamic coefficient database from a binary file
+bool HypersonicLocalInclinationAnalysis::loadCoefficientDatabaseFromFile( const std::string& fileName )
+{
+    std::ifstream inputFile( fileName.c_str( ), std::ios::binary );
+    if( !inputFile.is_open( ) )
+    {
+        return false;
+    }
 
-        // Switch to analyze part using correct method.
-        switch( method )
-        {
-        case 3:
-            // Calculate freestream Prandtl-Meyer function.
-            freestreamPrandtlMeyerFunction = aerodynamics::computePrandtlMeyerFunction(
-                        machNumber, ratioOfSpecificHeats );
-            pressureFunction =
-                    std::bind( &aerodynamics::computePrandtlMeyerFreestreamPressureCoefficient,
-                               std::placeholders::_1, machNumber, ratioOfSpecificHeats,
-                               freestreamPrandtlMeyerFunction );
-            break;
-
-        case 5:
-            pressureFunction =
-                    std::bind( &aerodynamics::computePrandtlMeyerFreestreamPressureCoefficient,
-                               std::placeholders::_1, machNumber, ratioOfSpecificHeats, -1 );
-            break;
-
-        case 6:
-            pressureFunction = std::bind( &aerodynamics::computeAcmEmpiricalPressureCoefficient,
-                                          std::placeholders::_1, machNumber );
-            break;
-        }
+    // Read and check header.
+    char fileIdentifier[ sizeof( localInclinationDatabaseFileIdentifier ) ];
+    std::uint32_t fileVersion = 0;
+    std::uint32_t byteOrderMarker = 0;
+    std::uint32_t signatureSize = 0;
+    inputFile.read( fileIdentifier, sizeof( fileIdentifier ) );
+    inputFile.read( reinterpret_cast< char* >( &fileVersion ), sizeof( std::uint32_t ) );
+    inputFile.read( reinterpret_cast< char* >( &byteOrderMarker ), sizeof( std::uint32_t ) );
+    inputFile.read( reinterpret_cast< char* >( &signatureSize ), sizeof( std::uint32_t ) );
+    if( !inputFile.good( ) ||
+            std::memcmp( fileIdentifier, localInclinationDatabaseFileIdentifier, sizeof( fileIdentifier ) ) != 0 ||
+            fileVersion != localInclinationDatabaseFileVersion )
+    {
+        std::cerr << "Warning, file " << fileName << " is not a (compatible) local inclination coefficient database, "
+                  << "coefficients will be regenerated" << std::endl;
+        return false;
+    }
+    if( byteOrderMarker != localInclinationDatabaseByteOrderMarker )
+    {
+        std::cerr << "Warning, local inclination coefficient database " << fileName << " was written with a different "
+                  << "byte order than that of this machine, coefficients will be regenerated" << std::endl;
+        return false;
+    }
 
-        // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-        {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-                }
-            }
-        }
+    // Check whether settings are identical to those of this analysis.
+    std::vector< double > signature = getCoefficientDatabaseSignature( );
+    if( signatureSize != signature.size( ) )
+    {
+        return false;
+    }
+    std::vector< double > fileSignature( signatureSize );
+    inputFile.read( reinterpret_cast< char* >( fileSignature.data( ) ), signatureSize * sizeof( double ) );
+    if( !inputFile.good( ) || fileSignature != signature )
+    {
+        return false;
     }
 
-    else
+    // Read coefficients, in storage order of multi-array.
+    std::vector< Eigen::Vector6d > coefficients( aerodynamicCoefficients_.num_elements( ) );
+    for( unsigned int i = 0; i < coefficients.size( ); i++ )
     {
-        std::string errorMessage = "Error, expansion local inclination method number "
-                + std::to_string( method ) + " not recognized";
-        throw std::runtime_error( errorMessage );
+        inputFile.read( reinterpret_cast< char* >( coefficients.at( i ).data( ) ), 6 * sizeof( double ) );
     }
+    if( !inputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when reading local inclination coefficient database, file " + fileName +
+                                  " is incomplete" );
+    }
+
+    std::copy( coefficients.begin( ), coefficients.end( ), aerodynamicCoefficients_.data( ) );
+    std::fill( isCoefficientGenerated_.origin( ),
+               isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 1 );
+    return true;
 }
 
 } // namespace aerodynamics
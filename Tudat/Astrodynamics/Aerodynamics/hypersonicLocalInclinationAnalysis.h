@@ -56,6 +56,56 @@ std::vector< double > getDefaultHypersonicLocalInclinationAngleOfAttackPoints( )
  */
 std::vector< double > getDefaultHypersonicLocalInclinationAngleOfSideslipPoints( );
 
+//! Function to compute the inclination angles of a set of panels w.r.t. the freestream flow.
+/*!
+ *  Function to compute the inclination angles of a set of panels w.r.t. the freestream flow, from a single
+ *  matrix-vector product of the (contiguously stored) panel surface normals and the freestream direction.
+ *  Outward pointing surface-normals are assumed.
+ *  \param panelSurfaceNormals Outward surface normals of panels, one panel per row.
+ *  \param freestreamVelocityDirection Unit vector in direction of freestream velocity.
+ *  \param panelInclinations Inclination angles of panels (returned by reference).
+ */
+void computePanelInclinationAngles(
+        const Eigen::Matrix< double, Eigen::Dynamic, 3 >& panelSurfaceNormals,
+        const Eigen::Vector3d& freestreamVelocityDirection,
+        Eigen::VectorXd& panelInclinations );
+
+//! Function to compute the pressure coefficients of all compression panels (inclination > 0) of a set of panels.
+/*!
+ *  Function to compute the pressure coefficients of all compression panels (inclination > 0) of a set of panels,
+ *  using a given local inclination method. The pressure coefficients of all panels are evaluated as a single
+ *  (vectorized) array expression, equivalent to the per-panel functions in aerodynamics.h, after which the values
+ *  are set for the panels with positive inclination only. Available methods are: 0 = Newtonian,
+ *  1 = modified Newtonian, 4 = empirical tangent wedge, 5 = empirical tangent cone, 6 = modified Dahlem-Buck,
+ *  7 = Van Dyke unified, 8 = Smyth delta wing, 9 = Hankey flat surface (methods 2 and 3 currently disabled).
+ *  \param method Index of compression method.
+ *  \param machNumber Freestream Mach number.
+ *  \param ratioOfSpecificHeats Ratio of specific heats.
+ *  \param panelInclinations Inclination angles of panels.
+ *  \param pressureCoefficients Pressure coefficients of panels (modified by reference, for compression panels only).
+ */
+void computeLocalInclinationCompressionPressureCoefficients(
+        const int method, const double machNumber, const double ratioOfSpecificHeats,
+        const Eigen::VectorXd& panelInclinations, Eigen::VectorXd& pressureCoefficients );
+
+//! Function to compute the pressure coefficients of all expansion panels (inclination <= 0) of a set of panels.
+/*!
+ *  Function to compute the pressure coefficients of all expansion panels (inclination <= 0) of a set of panels,
+ *  using a given local inclination method. Available methods are: 0 = vacuum, 1 = zero pressure,
+ *  3 = Prandtl-Meyer expansion from freestream, 4 = high Mach base pressure, 5 = Prandtl-Meyer expansion (with
+ *  fixed freestream Prandtl-Meyer function), 6 = ACM empirical. All methods except the Prandtl-Meyer methods (which
+ *  require an iterative inversion of the Prandtl-Meyer function per panel) are evaluated as a single (vectorized)
+ *  array expression.
+ *  \param method Index of expansion method.
+ *  \param machNumber Freestream Mach number.
+ *  \param ratioOfSpecificHeats Ratio of specific heats.
+ *  \param panelInclinations Inclination angles of panels.
+ *  \param pressureCoefficients Pressure coefficients of panels (modified by reference, for expansion panels only).
+ */
+void computeLocalInclinationExpansionPressureCoefficients(
+        const int method, const double machNumber, const double ratioOfSpecificHeats,
+        const Eigen::VectorXd& panelInclinations, Eigen::VectorXd& pressureCoefficients );
+
 //! Class for inviscid hypersonic aerodynamic analysis using local inclination methods.
 /*!
  * Class for inviscid hypersonic aerodynamic analysis using local inclination
@@ -67,6 +117,13 @@ std::vector< double > getDefaultHypersonicLocalInclinationAngleOfSideslipPoints(
  * panel inclination determination process, a geometry with outward surface-normals is assumed.
  * The resulting coefficients are expressed in the same reference frame as that of the input
  * geometry.
+ *
+ * The panel properties of each vehicle part are copied to contiguous (structure-of-arrays) buffers upon
+ * construction, so that the panel inclinations at a given attitude, and the force and moment coefficients
+ * from the panel pressure coefficients, are computed by single matrix-vector products. The full coefficient
+ * database is generated upon construction, for which the combinations of angle of attack and sideslip
+ * may be distributed over multiple threads. The resulting database can be saved to a binary file, and
+ * reloaded when creating an analysis with identical settings, so that it does not need to be regenerated.
  */
 class HypersonicLocalInclinationAnalysis: public AerodynamicCoefficientGenerator< 3, 6 >
 {
@@ -93,12 +150,21 @@ public:
      *  (i.e. inward-facing->outward facing or vice versa)
      *  \param selectedMethods Array of selected local inclination methods, the first index
      *  represents compression/expansion, the second index denotes the vehicle part index.
-     *  The value for each separate method can be found in the updateCompressionPressures and
-     *  updateExpansionPressures functions, respectively.
+     *  The value for each separate method can be found in the
+     *  computeLocalInclinationCompressionPressureCoefficients and
+     *  computeLocalInclinationExpansionPressureCoefficients functions, respectively.
      *  \param referenceArea Reference area used to non-dimensionalize aerodynamic forces
      *  and moments.
      *  \param referenceLength Reference length used to non-dimensionalize aerodynamic moments.
      *  \param momentReferencePoint Reference point wrt which aerodynamic moments are calculated.
+     *  \param savePressureCoefficients Boolean denoting whether the panel pressure coefficients at each of the
+     *  data points are to be saved (retrieved by getPressureCoefficientList).
+     *  \param numberOfThreads Number of threads over which the generation of the coefficient database is to be
+     *  distributed.
+     *  \param coefficientDatabaseFile Name of binary file from which the coefficient database is to be loaded, if it
+     *  exists and was generated with identical settings (see loadCoefficientDatabaseFromFile). Otherwise, the
+     *  database is generated, and saved to this file. If empty (default), no file is used. The file is not loaded
+     *  if savePressureCoefficients is true, since the pressure coefficients are not stored in the file.
      */
     HypersonicLocalInclinationAnalysis(
             const std::vector< std::vector< double > >& dataPointsOfIndependentVariables,
@@ -110,7 +176,9 @@ public:
             const double referenceArea,
             const double referenceLength,
             const Eigen::Vector3d& momentReferencePoint,
-            const bool savePressureCoefficients = false );
+            const bool savePressureCoefficients = false,
+            const unsigned int numberOfThreads = 1,
+            const std::string& coefficientDatabaseFile = "" );
 
     //! Default destructor.
     /*!
@@ -130,15 +198,18 @@ public:
     Eigen::Vector6d getAerodynamicCoefficientsDataPoint(
             const boost::array< int, 3 > independentVariables );
 
-    //! Determine inclination angles of panels on a given part.
+    //! Determine inclination angles of panels on all parts.
     /*!
      * Determines panel inclinations for all panels on all parts for given attitude.
      * Outward pointing surface-normals are assumed!
      * \param angleOfAttack Angle of attack at which to determine inclination angles.
      * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
+     * \param panelInclinations Inclination angles of all panels (returned by reference), one vector per part,
+     * with panels ordered by line and then by point.
      */
     void determineInclinations( const double angleOfAttack,
-                                const double angleOfSideslip );
+                                const double angleOfSideslip,
+                                std::vector< Eigen::VectorXd >& panelInclinations ) const;
 
     //! Get the number of vehicle parts.
     /*!
@@ -205,11 +276,37 @@ public:
         return paneSurfaceNormalList;
     }
 
+    //! Function to retrieve the panel pressure coefficients at a given data point
+    /*!
+     * Function to retrieve the panel pressure coefficients at a given data point (only available if
+     * savePressureCoefficients was set to true upon construction).
+     * \param independentVariables Array of indices of independent variables.
+     * \return Panel pressure coefficients, with indices indicating part-line-point.
+     */
     std::vector< std::vector< std::vector< double > > > getPressureCoefficientList(
-            const boost::array< int, 3 > independentVariables )
-    {
-        return pressureCoefficientList_.at( independentVariables );
-    }
+            const boost::array< int, 3 > independentVariables );
+
+    //! Function to save the aerodynamic coefficient database to a binary file
+    /*!
+     * Function to save the aerodynamic coefficient database to a binary file. Along with the coefficients, the
+     * file contains a signature of the analysis settings (data points of independent variables, reference
+     * quantities, selected methods and panel geometry), which is used to check whether the file can be reused
+     * by loadCoefficientDatabaseFromFile. Values are written in the native byte order of the machine, preceded by a
+     * file identifier, the file format version and a byte order marker.
+     * \param fileName Name of file to which the database is to be written.
+     */
+    void saveCoefficientDatabaseToFile( const std::string& fileName );
+
+    //! Function to load the aerodynamic coefficient database from a binary file
+    /*!
+     * Function to load the aerodynamic coefficient database from a binary file, written by
+     * saveCoefficientDatabaseToFile. The database is only loaded if the signature of the analysis settings in
+     * the file is identical to that of this object.
+     * \param fileName Name of file from which the database is to be loaded.
+     * \return True if the database was loaded, false if the file does not exist, is not a database file of the current
+     * format version, was written with a different byte order, or was generated with different analysis settings.
+     */
+    bool loadCoefficientDatabaseFromFile( const std::string& fileName );
 
 
 private:
@@ -231,63 +328,61 @@ private:
      */
     void determineVehicleCoefficients( const boost::array< int, 3 > independentVariableIndices );
 
-    //! Determine aerodynamic coefficients for a single LaWGS part.
-    /*!
-     * Determines aerodynamic coefficients for a single LaWGS part,
-     * calls determinepressureCoefficient_ function for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
-     * \return Force and moment coefficients for requested vehicle part.
-     */
-    Eigen::Vector6d determinePartCoefficients(
-            const int partNumber, const boost::array< int, 3 > independentVariableIndices );
-
-    //! Determine pressure coefficients on a given part.
+    //! Generate aerodynamic coefficients at all Mach numbers, for a single angle of attack and sideslip.
     /*!
-     * Determines pressure coefficients on a single vehicle part.
-     * Calls the updateExpansionPressures and updateCompressionPressures for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
+     * Generates aerodynamic coefficients at all Mach numbers, for a single angle of attack and sideslip, and sets
+     * the corresponding entries in the aerodynamicCoefficients_ array. Only entries associated with the given
+     * angles are modified, so that this function may be called concurrently for different angles.
+     * \param angleOfAttackIndex Index of angle of attack in list of data points.
+     * \param angleOfSideslipIndex Index of angle of sideslip in list of data points.
+     * \param pressureCoefficientsPerMachNumber Panel pressure coefficients at each Mach number (returned by reference;
+     *          only set if savePressureCoefficients_ is true).
      */
-    void determinePressureCoefficients( const int partNumber,
-                                        const boost::array< int, 3 > independentVariableIndices );
+    void determineVehicleCoefficientsAtAttitude(
+            const int angleOfAttackIndex, const int angleOfSideslipIndex,
+            std::vector< std::vector< Eigen::VectorXd > >& pressureCoefficientsPerMachNumber );
 
-    //! Determine force coefficients of a part.
+    //! Determine aerodynamic coefficients for all LaWGS parts at given Mach number and panel inclinations.
     /*!
-     * Sums the pressure coefficients of given part and determines force coefficients from it by
-     * non-dimensionalization with reference area.
-     * \param partNumber Index from vehicleParts_ array for which determine coefficients.
-     * \return Force coefficients for requested vehicle part.
+     * Determines aerodynamic coefficients for all LaWGS parts at given Mach number and panel inclinations,
+     * calls determinePressureCoefficients function for each of the vehicle parts.
+     * \param machNumber Mach number at which to perform analysis.
+     * \param panelInclinations Inclination angles of all panels, one vector per part.
+     * \param pressureCoefficients Pressure coefficients of all panels (returned by reference), one vector per part.
+     * \return Force and moment coefficients of vehicle.
      */
-    Eigen::Vector3d calculateForceCoefficients( const int partNumber );
+    Eigen::Vector6d computeVehicleCoefficients(
+            const double machNumber,
+            const std::vector< Eigen::VectorXd >& panelInclinations,
+            std::vector< Eigen::VectorXd >& pressureCoefficients ) const;
 
-    //! Determine moment coefficients of a part.
+    //! Determine pressure coefficients on a given part.
     /*!
-     * Determines the moment coefficients of a given part by summing the contributions of all
-     * panels on the part. Moment arms are taken from panel centroid to momentReferencePoint. Non-
-     * dimensionalization is performed by product of referenceLength and referenceArea.
+     * Determines pressure coefficients on a single vehicle part.
+     * Calls the computeLocalInclinationCompressionPressureCoefficients and
+     * computeLocalInclinationExpansionPressureCoefficients functions for given vehicle part.
+     * \param machNumber Mach number at which to perform analysis.
      * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \return Moment coefficients for requested vehicle part.
+     * \param panelInclinations Inclination angles of panels on part.
+     * \param pressureCoefficients Pressure coefficients of panels on part (returned by reference).
      */
-    Eigen::Vector3d calculateMomentCoefficients( const int partNumber );
+    void determinePressureCoefficients( const double machNumber, const int partNumber,
+                                        const Eigen::VectorXd& panelInclinations,
+                                        Eigen::VectorXd& pressureCoefficients ) const;
 
-    //! Determine the compression pressure coefficients of a given part.
-    /*!
-     * Sets the values of pressureCoefficient_ on given part and at given Mach number for which
-     * inclination > 0.
-     * \param machNumber Mach number at which to perform analysis.
-     * \param partNumber of part from vehicleParts_ which is to be analyzed.
-     */
-    void updateCompressionPressures( const double machNumber, const int partNumber );
+    //! Function to set the contiguous panel property buffers from the vehicle parts.
+    void setPanelProperties( );
 
-    //! Determine the expansion pressure coefficients of a given part.
+    //! Function to compute the signature of the analysis settings, used to check compatibility of database files
     /*!
-     * Determine the values of pressureCoefficient_ on given part and at given Mach number for
-     * which inclination <= 0.
-     * \param machNumber Mach number at which to perform analysis.
-     * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * Function to compute the signature of the analysis settings, used to check compatibility of database files.
+     * The signature consists of the data points of the independent variables, the reference quantities, the ratio of
+     * specific heats, the selected methods and, for each part, the number of panels and a hash of the full panel
+     * surface normal, centroid, area and moment arm arrays (so that any change of the mesh, including a permutation or
+     * mirroring of panels, invalidates the database).
+     * \return Signature of the analysis settings.
      */
-    void updateExpansionPressures( const double machNumber, const int partNumber );
+    std::vector< double > getCoefficientDatabaseSignature( );
 
     //! Array of vehicle parts.
     /*!
@@ -302,42 +397,22 @@ private:
      */
     boost::multi_array< bool, 3 > isCoefficientGenerated_;
 
-    //! Three-dimensional array of panel inclination angles.
-    /*!
-     * Three-dimensional array of panel inclination angles at current values of
-     * independent variables. Indices indicate part-line-point.
-     */
-    std::vector< std::vector< std::vector< double > > > inclination_;
-
-    //! Map of angle of attack and -sideslip pair and associated panel inclinations.
-    /*!
-     * Map of angle of attack and -sideslip pair and associated panel inclinations.
-     */
-    std::map< std::pair< double, double >, std::vector< std::vector< std::vector< double > > > >
-    previouslyComputedInclinations_;
-
-    //! Three-dimensional array of panel pressure coefficients.
-    /*!
-     * Three-dimensional array of panel pressure coefficients at current values
-     * of independent variables. Indices indicate part-line-point.
-     */
-     std::vector< std::vector< std::vector< double > > > pressureCoefficient_;
+    //! Outward surface normals of panels, multiplied by panel area, per part (one panel per row).
+    std::vector< Eigen::Matrix< double, Eigen::Dynamic, 3 > > areaWeightedSurfaceNormals_;
 
-     std::map< boost::array< int, 3 >,  std::vector< std::vector< std::vector< double > > > > pressureCoefficientList_;
+    //! Cross product of panel moment arm w.r.t. moment reference point and outward surface normal, multiplied by
+    //! panel area, per part.
+    std::vector< Eigen::Matrix< double, Eigen::Dynamic, 3 > > areaWeightedMomentArms_;
 
-    //! Stagnation pressure coefficient.
-    /*!
-     * Stagnation pressure coefficient for flow which has passed through a
-     * normal shock wave at current Mach number.
-     */
-    double stagnationPressureCoefficient;
+    //! Map of panel pressure coefficients (one vector per part) per set of independent variable indices.
+    std::map< boost::array< int, 3 >, std::vector< Eigen::VectorXd > > pressureCoefficientList_;
 
     //! Ratio of specific heats.
     /*!
      * Ratio of specific heat at constant pressure to specific heat at constant pressure.
      */
     double ratioOfSpecificHeats;
-    \
+
     //! Array of selected methods.
     /*!
      * Array of selected methods, first index represents compression/expansion,
@@ -345,7 +420,11 @@ private:
      */
     std::vector< std::vector< int > > selectedMethods_;
 
+    //! Boolean denoting whether the panel pressure coefficients at each data point are to be saved.
     bool savePressureCoefficients_;
+
+    //! Number of threads over which the generation of the coefficient database is distributed.
+    unsigned int numberOfThreads_;
 };
 
 
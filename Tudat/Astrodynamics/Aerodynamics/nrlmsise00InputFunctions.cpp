@@ -33,11 +33,34 @@ std::vector< double >  eigenToStlVector(
 }
 
 //! NRLMSISE00Input function
-NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longitude,
-                                       const double latitude, const double time,
-                                       const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
-                                       const bool adjustSolarTime,
-                                       const double localSolarTime ) {
+NRLMSISE00Input nrlmsiseInputFunction(
+        const double altitude, const double longitude,
+        const double latitude, const double time,
+        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
+        const bool adjustSolarTime,
+        const double localSolarTime ) {
+    // Compute input that depends only on time
+    NRLMSISE00Input nrlmsiseInputData = computeTimeDependentNrlmsiseInput( time, solarActivityMap );
+
+    // Compute local solar time
+    if( adjustSolarTime )
+    {
+        nrlmsiseInputData.localSolarTime = localSolarTime;
+    }
+    else
+    {
+        nrlmsiseInputData.localSolarTime = basic_astrodynamics::calculateLocalSolarTime(
+                    nrlmsiseInputData.secondOfTheDay, longitude );
+    }
+
+    return nrlmsiseInputData;
+}
+
+//! Function to compute the time-dependent part of the NRLMSISE00 input
+NRLMSISE00Input computeTimeDependentNrlmsiseInput(
+        const double time,
+        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap )
+{
     using namespace tudat::input_output::solar_activity;
 
     // Declare input data class member
@@ -49,13 +72,14 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
     double julianDay = std::floor( julianDate - 0.5 ) + 0.5;
 
     // Check if solar activity is found for current day.
-    if( solarActivityMap.count( julianDay ) == 0 )
+    SolarActivityDataMap::const_iterator solarActivityIterator = solarActivityMap.find( julianDay );
+    if( solarActivityIterator == solarActivityMap.end( ) )
     {
         std::string errorMessage = "Solar activity data could not be found for this julian date: "
                 + std::to_string( julianDay ) + " in nrlmsiseInputFunction";
         throw std::runtime_error( errorMessage );
     }
-    SolarActivityDataPtr solarActivity = solarActivityMap.at( julianDay );
+    SolarActivityDataPtr solarActivity = solarActivityIterator->second;
 
 
     // Compute julian date at the first of januari
@@ -81,18 +105,6 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
     nrlmsiseInputData.apDaily = solarActivity->planetaryEquivalentAmplitudeAverage;
     nrlmsiseInputData.apVector = eigenToStlVector( solarActivity->planetaryEquivalentAmplitudeVector );
 
-    // Compute local solar time
-    // Hrs since begin of the day at longitude 0 (GMT) + Hrs passed at current longitude
-    if( adjustSolarTime )
-    {
-        nrlmsiseInputData.localSolarTime = localSolarTime;
-    }
-    else
-    {
-        nrlmsiseInputData.localSolarTime = nrlmsiseInputData.secondOfTheDay / 3600.0
-                + longitude / ( tudat::mathematical_constants::PI / 12.0 );
-    }
-
     return nrlmsiseInputData;
 }
 
@@ -14,8 +14,12 @@
 #include <vector>
 #include <cmath>
 
+#include "Tudat/Basics/utilityMacros.h"
+
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/InputOutput/solarActivityData.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 
 namespace tudat
@@ -39,10 +43,119 @@ namespace aerodynamics
  * \param localSolarTime Local solar time that is used when adjustSolarTime is set to true.
  * \return NRLMSISE00Input nrlmsiseInputFunction
  */
-NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longitude,
-                                       const double latitude, const double time,
-                                       const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
-                                       const bool adjustSolarTime = false, const double localSolarTime = 0.0 );
+NRLMSISE00Input nrlmsiseInputFunction(
+        const double altitude, const double longitude,
+        const double latitude, const double time,
+        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
+        const bool adjustSolarTime = false, const double localSolarTime = 0.0 );
+
+//! Function to compute the time-dependent part of the NRLMSISE00 input
+/*!
+ * Function to compute the part of the NRLMSISE00 input that depends only on time and space weather data (i.e. all
+ * input except the local solar time, which is set to zero by this function).
+ * \param time Time at which output is to be computed (seconds since J2000).
+ * \param solarActivityMap SolarActivityData structure
+ * \return Time-dependent part of NRLMSISE00 input
+ */
+NRLMSISE00Input computeTimeDependentNrlmsiseInput(
+        const double time,
+        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap );
+
+//! Class to compute the NRLMSISE00 input, caching the part of the input that depends only on time.
+/*!
+ * Class to compute the NRLMSISE00 input, caching the part of the input that depends only on time and space weather data
+ * (solar flux and geomagnetic indices, day of the year, etc.). When evaluating the atmosphere for a number of positions
+ * at the same time (e.g. for multiple vehicles propagated concurrently), this part is only computed once. Only the
+ * preparation of the input is shared in this way: the NRLMSISE00 model itself is still evaluated in full for each
+ * position. The getInput function of an object of this class can be used as input function of an
+ * NRLMSISE00Atmosphere object, and produces the same result as the nrlmsiseInputFunction function.
+ */
+class NRLMSISE00TimeDependentInputCache
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param solarActivityMap SolarActivityData structure
+     * \param adjustSolarTime Boolean denoting whether the computed local solar time should be overidden with
+     * localSolarTime input.
+     * \param localSolarTime Local solar time that is used when adjustSolarTime is set to true.
+     */
+    NRLMSISE00TimeDependentInputCache(
+            const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
+            const bool adjustSolarTime = false, const double localSolarTime = 0.0 ):
+        solarActivityMap_( solarActivityMap ), adjustSolarTime_( adjustSolarTime ), localSolarTime_( localSolarTime ),
+        currentTime_( TUDAT_NAN ), numberOfTimeDependentInputComputations_( 0 ){ }
+
+    //! Function to retrieve the NRLMSISE00 input at given position and time
+    /*!
+     * Function to retrieve the NRLMSISE00 input at given position and time, recomputing the time-dependent part only if
+     * the time differs from that of the previous call.
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param longitude Longitude at which output is to be computed [rad].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param time Time at which output is to be computed (seconds since J2000).
+     * \return NRLMSISE00 input at given position and time
+     */
+    NRLMSISE00Input getInput( const double altitude, const double longitude, const double latitude, const double time )
+    {
+        TUDAT_UNUSED_PARAMETER( altitude );
+        TUDAT_UNUSED_PARAMETER( latitude );
+        NRLMSISE00Input nrlmsiseInputData = getTimeDependentInput( time );
+        nrlmsiseInputData.localSolarTime = adjustSolarTime_ ? localSolarTime_ :
+                    basic_astrodynamics::calculateLocalSolarTime( nrlmsiseInputData.secondOfTheDay, longitude );
+        return nrlmsiseInputData;
+    }
+
+    //! Function to retrieve the time-dependent part of the NRLMSISE00 input at given time
+    /*!
+     * Function to retrieve the time-dependent part of the NRLMSISE00 input at given time, recomputing it only if
+     * the time differs from that of the previous call.
+     * \param time Time at which output is to be computed (seconds since J2000).
+     * \return Time-dependent part of NRLMSISE00 input (with local solar time set to zero)
+     */
+    const NRLMSISE00Input& getTimeDependentInput( const double time )
+    {
+        if( !( time == currentTime_ ) )
+        {
+            currentTimeDependentInput_ = computeTimeDependentNrlmsiseInput( time, solarActivityMap_ );
+            currentTime_ = time;
+            numberOfTimeDependentInputComputations_++;
+        }
+        return currentTimeDependentInput_;
+    }
+
+    //! Function to retrieve the number of times the time-dependent input has been computed since object creation
+    /*!
+     * Function to retrieve the number of times the time-dependent input has been computed since object creation
+     * \return Number of times the time-dependent input has been computed since object creation
+     */
+    unsigned int getNumberOfTimeDependentInputComputations( )
+    {
+        return numberOfTimeDependentInputComputations_;
+    }
+
+private:
+
+    //! SolarActivityData structure
+    tudat::input_output::solar_activity::SolarActivityDataMap solarActivityMap_;
+
+    //! Boolean denoting whether the computed local solar time should be overidden with localSolarTime_
+    bool adjustSolarTime_;
+
+    //! Local solar time that is used when adjustSolarTime_ is set to true.
+    double localSolarTime_;
+
+    //! Time at which currentTimeDependentInput_ was computed
+    double currentTime_;
+
+    //! Time-dependent part of NRLMSISE00 input at currentTime_
+    NRLMSISE00Input currentTimeDependentInput_;
+
+    //! Number of times the time-dependent input has been computed since object creation
+    unsigned int numberOfTimeDependentInputComputations_;
+};
 
 }  // namespace aerodynamics
 }  // namespace tudat
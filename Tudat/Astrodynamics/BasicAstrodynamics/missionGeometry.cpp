@@ -14,7 +14,10 @@
  */
 
 #include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/missionGeometry.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
@@ -145,6 +148,238 @@ double computeShadowFunction( const Eigen::Vector3d& occultedBodyPosition,
     return shadowFunction;
 }
 
+//! Compute the fraction of the apparent disk of an occulted body that is covered by an occulting body.
+double computeOccultedDiskFraction( const double occultedBodyApparentRadius,
+                                    const double occultingBodyApparentRadius,
+                                    const double apparentSeparation )
+{
+    double occultedFraction = 0.0;
+
+    if( apparentSeparation >= occultedBodyApparentRadius + occultingBodyApparentRadius )
+    {
+        // No occultation.
+        occultedFraction = 0.0;
+    }
+    else if( apparentSeparation <= occultingBodyApparentRadius - occultedBodyApparentRadius )
+    {
+        // Total occultation.
+        occultedFraction = 1.0;
+    }
+    else if( apparentSeparation <= occultedBodyApparentRadius - occultingBodyApparentRadius )
+    {
+        // Annular occultation: occulting disk is fully inside occulted disk.
+        occultedFraction = ( occultingBodyApparentRadius * occultingBodyApparentRadius ) /
+                ( occultedBodyApparentRadius * occultedBodyApparentRadius );
+    }
+    else
+    {
+        // Partial occultation, compute area of intersection of the two disks.
+        const double occultedBodyApparentRadiusSquared = occultedBodyApparentRadius * occultedBodyApparentRadius;
+        const double occultingBodyApparentRadiusSquared = occultingBodyApparentRadius * occultingBodyApparentRadius;
+
+        const double distanceToChord = ( apparentSeparation * apparentSeparation + occultedBodyApparentRadiusSquared
+                                         - occultingBodyApparentRadiusSquared ) / ( 2.0 * apparentSeparation );
+        const double halfChordLength = std::sqrt(
+                    std::max( occultedBodyApparentRadiusSquared - distanceToChord * distanceToChord, 0.0 ) );
+        const double occultedArea =
+                occultedBodyApparentRadiusSquared * std::acos(
+                    std::min( std::max( distanceToChord / occultedBodyApparentRadius, -1.0 ), 1.0 ) ) +
+                occultingBodyApparentRadiusSquared * std::acos(
+                    std::min( std::max( ( apparentSeparation - distanceToChord ) / occultingBodyApparentRadius,
+                                        -1.0 ), 1.0 ) ) -
+                apparentSeparation * halfChordLength;
+        occultedFraction = occultedArea / ( mathematical_constants::PI * occultedBodyApparentRadiusSquared );
+    }
+
+    return std::min( std::max( occultedFraction, 0.0 ), 1.0 );
+}
+
+//! Compute the position of a point in a frame in which an oblate spheroid is mapped to a sphere.
+Eigen::Vector3d computePositionInSphericalizedFrame( const Eigen::Vector3d& position,
+                                                    const Eigen::Vector3d& spheroidCenter,
+                                                    const double flattening,
+                                                    const Eigen::Vector3d& poleDirection )
+{
+    const Eigen::Vector3d relativePosition = position - spheroidCenter;
+    return relativePosition + flattening / ( 1.0 - flattening ) *
+            relativePosition.dot( poleDirection ) * poleDirection;
+}
+
+//! Compute the shadow function due to an arbitrary number of (possibly oblate) occulting bodies.
+double computeMultipleOccultationShadowFunction(
+        const Eigen::Vector3d& occultedBodyPosition,
+        const double occultedBodyRadius,
+        const std::vector< Eigen::Vector3d >& occultingBodyPositions,
+        const std::vector< double >& occultingBodyRadii,
+        const Eigen::Vector3d& satellitePosition,
+        const std::vector< double >& occultingBodyFlattenings,
+        const std::vector< Eigen::Vector3d >& occultingBodyPoleDirections,
+        const int numberOfQuadratureRings )
+{
+    if( occultingBodyPositions.size( ) != occultingBodyRadii.size( ) )
+    {
+        throw std::runtime_error( "Error when computing shadow function, inconsistent number of occulting body "
+                                  "positions and radii." );
+    }
+
+    const bool useOblateOccultingBodies = ( occultingBodyFlattenings.size( ) > 0 );
+    if( useOblateOccultingBodies && ( occultingBodyFlattenings.size( ) != occultingBodyPositions.size( ) ||
+                                      occultingBodyPoleDirections.size( ) != occultingBodyPositions.size( ) ) )
+    {
+        throw std::runtime_error( "Error when computing shadow function, inconsistent number of occulting body "
+                                  "positions, flattenings and pole directions." );
+    }
+
+    // Compute direction and apparent radius of occulted body.
+    const Eigen::Vector3d occultedBodyRelativePosition = occultedBodyPosition - satellitePosition;
+    const double occultedBodyDistance = occultedBodyRelativePosition.norm( );
+    const Eigen::Vector3d occultedBodyDirection = occultedBodyRelativePosition / occultedBodyDistance;
+    const double occultedBodyApparentRadius =
+            std::asin( std::min( occultedBodyRadius / occultedBodyDistance, 1.0 ) );
+
+    // Determine apparent geometry of all bodies that (partially) occult the occulted body.
+    std::vector< double > partiallyOccultingApparentRadii;
+    std::vector< double > partiallyOccultingSeparations;
+    std::vector< Eigen::Vector3d > partiallyOccultingDirections;
+    for( unsigned int i = 0; i < occultingBodyPositions.size( ); i++ )
+    {
+        const Eigen::Vector3d occultingBodyRelativePosition = occultingBodyPositions.at( i ) - satellitePosition;
+
+        // Occulting body cannot occult if it is further away than occulted body.
+        if( occultingBodyRelativePosition.dot( occultedBodyDirection ) > occultedBodyDistance )
+        {
+            continue;
+        }
+
+        double occultingBodyApparentRadius, apparentSeparation;
+        if( useOblateOccultingBodies && occultingBodyFlattenings.at( i ) != 0.0 )
+        {
+            // Compute apparent geometry in frame in which occulting body is a sphere.
+            const Eigen::Vector3d sphericalizedSatellitePosition = computePositionInSphericalizedFrame(
+                        satellitePosition, occultingBodyPositions.at( i ), occultingBodyFlattenings.at( i ),
+                        occultingBodyPoleDirections.at( i ) );
+            const Eigen::Vector3d sphericalizedOccultedBodyPosition = computePositionInSphericalizedFrame(
+                        occultedBodyPosition, occultingBodyPositions.at( i ), occultingBodyFlattenings.at( i ),
+                        occultingBodyPoleDirections.at( i ) ) - sphericalizedSatellitePosition;
+            const double sphericalizedSatelliteDistance = sphericalizedSatellitePosition.norm( );
+
+            occultingBodyApparentRadius = std::asin(
+                        std::min( occultingBodyRadii.at( i ) / sphericalizedSatelliteDistance, 1.0 ) );
+            apparentSeparation = std::acos(
+                        std::min( std::max( -sphericalizedSatellitePosition.dot( sphericalizedOccultedBodyPosition ) /
+                                            ( sphericalizedSatelliteDistance *
+                                              sphericalizedOccultedBodyPosition.norm( ) ), -1.0 ), 1.0 ) );
+        }
+        else
+        {
+            const double occultingBodyDistance = occultingBodyRelativePosition.norm( );
+            occultingBodyApparentRadius = std::asin(
+                        std::min( occultingBodyRadii.at( i ) / occultingBodyDistance, 1.0 ) );
+            apparentSeparation = std::acos(
+                        std::min( std::max( occultingBodyRelativePosition.dot( occultedBodyDirection ) /
+                                            occultingBodyDistance, -1.0 ), 1.0 ) );
+        }
+
+        if( apparentSeparation <= occultingBodyApparentRadius - occultedBodyApparentRadius )
+        {
+            // Total occultation by single body.
+            return 0.0;
+        }
+        else if( apparentSeparation < occultingBodyApparentRadius + occultedBodyApparentRadius )
+        {
+            partiallyOccultingApparentRadii.push_back( occultingBodyApparentRadius );
+            partiallyOccultingSeparations.push_back( apparentSeparation );
+            partiallyOccultingDirections.push_back( occultingBodyRelativePosition );
+        }
+    }
+
+    // Compute sum of fractions occulted by the individual bodies.
+    double occultedFraction = 0.0;
+    for( unsigned int i = 0; i < partiallyOccultingApparentRadii.size( ); i++ )
+    {
+        occultedFraction += computeOccultedDiskFraction(
+                    occultedBodyApparentRadius, partiallyOccultingApparentRadii.at( i ),
+                    partiallyOccultingSeparations.at( i ) );
+    }
+
+    if( partiallyOccultingApparentRadii.size( ) > 1 )
+    {
+        // Compute (azimuthal equidistant) coordinates of occulting disk centers, in plane normal to direction of
+        // occulted body.
+        const Eigen::Vector3d firstPlaneAxis = occultedBodyDirection.unitOrthogonal( );
+        const Eigen::Vector3d secondPlaneAxis = occultedBodyDirection.cross( firstPlaneAxis );
+
+        std::vector< Eigen::Vector2d > occultingDiskCenters;
+        for( unsigned int i = 0; i < partiallyOccultingApparentRadii.size( ); i++ )
+        {
+            Eigen::Vector2d projectedDirection;
+            projectedDirection << partiallyOccultingDirections.at( i ).dot( firstPlaneAxis ),
+                    partiallyOccultingDirections.at( i ).dot( secondPlaneAxis );
+            if( projectedDirection.norm( ) > 0.0 )
+            {
+                projectedDirection.normalize( );
+            }
+            occultingDiskCenters.push_back( partiallyOccultingSeparations.at( i ) * projectedDirection );
+        }
+
+        // Check if any of the occulting disks overlap.
+        bool occultingDisksOverlap = false;
+        for( unsigned int i = 0; i < occultingDiskCenters.size( ); i++ )
+        {
+            for( unsigned int j = i + 1; j < occultingDiskCenters.size( ); j++ )
+            {
+                if( ( occultingDiskCenters.at( i ) - occultingDiskCenters.at( j ) ).norm( ) <
+                        partiallyOccultingApparentRadii.at( i ) + partiallyOccultingApparentRadii.at( j ) )
+                {
+                    occultingDisksOverlap = true;
+                }
+            }
+        }
+
+        // If occulting disks overlap, subtract multiply occulted area, computed by quadrature over occulted disk
+        // (using rings of equal area).
+        if( occultingDisksOverlap )
+        {
+            const int numberOfPointsPerRing = 4 * numberOfQuadratureRings;
+            const double pointWeight = 1.0 / static_cast< double >( numberOfQuadratureRings * numberOfPointsPerRing );
+
+            double multiplyOccultedFraction = 0.0;
+            for( int i = 0; i < numberOfQuadratureRings; i++ )
+            {
+                const double ringRadius = occultedBodyApparentRadius * std::sqrt(
+                            ( static_cast< double >( i ) + 0.5 ) / static_cast< double >( numberOfQuadratureRings ) );
+                for( int j = 0; j < numberOfPointsPerRing; j++ )
+                {
+                    // Offset azimuth of subsequent rings by half a point spacing.
+                    const double azimuth = 2.0 * mathematical_constants::PI *
+                            ( static_cast< double >( j ) + 0.5 * static_cast< double >( i % 2 ) ) /
+                            static_cast< double >( numberOfPointsPerRing );
+                    const Eigen::Vector2d quadraturePoint(
+                                ringRadius * std::cos( azimuth ), ringRadius * std::sin( azimuth ) );
+
+                    int numberOfOccultations = 0;
+                    for( unsigned int k = 0; k < occultingDiskCenters.size( ); k++ )
+                    {
+                        if( ( quadraturePoint - occultingDiskCenters.at( k ) ).norm( ) <
+                                partiallyOccultingApparentRadii.at( k ) )
+                        {
+                            numberOfOccultations++;
+                        }
+                    }
+
+                    if( numberOfOccultations > 1 )
+                    {
+                        multiplyOccultedFraction += pointWeight * static_cast< double >( numberOfOccultations - 1 );
+                    }
+                }
+            }
+            occultedFraction -= multiplyOccultedFraction;
+        }
+    }
+
+    return std::min( std::max( 1.0 - occultedFraction, 0.0 ), 1.0 );
+}
+
 double computeSphereOfInfluence( const double distanceToCentralBody,
                                  const double ratioOfOrbitingToCentralBodyMass )
 {
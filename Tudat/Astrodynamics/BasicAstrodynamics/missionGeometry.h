@@ -20,6 +20,8 @@
 #ifndef TUDAT_MISSION_GEOMETRY_H
 #define TUDAT_MISSION_GEOMETRY_H
 
+#include <vector>
+
 #include <Eigen/Core>
 
 #include "Tudat/Basics/basicTypedefs.h"
@@ -81,6 +83,73 @@ double computeShadowFunction( const Eigen::Vector3d& occultedBodyPosition,
                               const double occultingBodyRadius,
                               const Eigen::Vector3d& satellitePosition );
 
+//! Compute the fraction of the apparent disk of an occulted body that is covered by an occulting body.
+/*!
+ * Computes the fraction of the apparent disk of an occulted body (for example the Sun) that is covered by the apparent
+ * disk of an occulting body, as seen from the satellite. Contrary to computeShadowFunction, an annular occultation (i.e.
+ * occulting disk entirely inside occulted disk) results in the ratio of the areas of the disks.
+ * \param occultedBodyApparentRadius Apparent (angular) radius of occulted body [rad].
+ * \param occultingBodyApparentRadius Apparent (angular) radius of occulting body [rad].
+ * \param apparentSeparation Apparent (angular) separation of the centers of both bodies [rad].
+ * \return Fraction of occulted disk that is covered, 0 for no occultation, 1 for total occultation.
+ */
+double computeOccultedDiskFraction( const double occultedBodyApparentRadius,
+                                    const double occultingBodyApparentRadius,
+                                    const double apparentSeparation );
+
+//! Compute the position of a point in a frame in which an oblate spheroid is mapped to a sphere.
+/*!
+ * Computes the position of a point in a frame in which an oblate spheroid (with given flattening and pole direction) is
+ * mapped to a sphere with the equatorial radius of the spheroid, by stretching the component along the pole. As this
+ * transformation is linear, straight lines (i.e. light rays) are mapped onto straight lines, so that occultation by the
+ * spheroid is equivalent to occultation by the sphere in the transformed frame.
+ * \param position Position of point that is to be transformed.
+ * \param spheroidCenter Position of center of spheroid.
+ * \param flattening Flattening of spheroid.
+ * \param poleDirection Unit vector along the polar axis of the spheroid.
+ * \return Position of point w.r.t. spheroid center, in frame in which spheroid is a sphere.
+ */
+Eigen::Vector3d computePositionInSphericalizedFrame( const Eigen::Vector3d& position,
+                                                    const Eigen::Vector3d& spheroidCenter,
+                                                    const double flattening,
+                                                    const Eigen::Vector3d& poleDirection );
+
+//! Compute the shadow function due to an arbitrary number of (possibly oblate) occulting bodies.
+/*!
+ * Returns the value of of the shadow function, due to an arbitrary number of occulting bodies (for example the Earth and
+ * the Moon), which may occult the occulted body (for example the Sun) concurrently. Returns 0 if the satellite is in
+ * umbra, 1 if the satellite is fully exposed and a value between 0 and 1 if the satellite is in penumbra. Unlike
+ * multiplying the individual shadow functions, the occulted area is computed consistently: if only one occultation
+ * takes place, or the disks of the concurrently occulting bodies do not overlap, the occulted fractions are computed
+ * analytically. If the disks do overlap, the occulted fraction is computed by numerical quadrature over the apparent
+ * disk of the occulted body (with numberOfQuadratureRings rings of equal area, using 4 * numberOfQuadratureRings points
+ * per ring).
+ *
+ * Occulting bodies may be modelled as oblate spheroids, in which case the apparent radius and separation of the
+ * occulting body are computed in the frame in which the spheroid is a sphere (see computePositionInSphericalizedFrame),
+ * and the radius of the body must be its equatorial radius.
+ *
+ * \param occultedBodyPosition Vector containing Cartesian coordinates of the occulted body.
+ * \param occultedBodyRadius Mean radius of occulted body.
+ * \param occultingBodyPositions List of Cartesian coordinates of the occulting bodies.
+ * \param occultingBodyRadii List of (mean or equatorial) radii of the occulting bodies.
+ * \param satellitePosition Vector containing Cartesian coordinates of the satellite.
+ * \param occultingBodyFlattenings List of flattenings of the occulting bodies (empty if all are spherical).
+ * \param occultingBodyPoleDirections List of unit vectors along polar axes of the occulting bodies (empty if all are
+ * spherical).
+ * \param numberOfQuadratureRings Number of rings used for numerical quadrature over occulted disk.
+ * \return Shadow function value.
+ */
+double computeMultipleOccultationShadowFunction(
+        const Eigen::Vector3d& occultedBodyPosition,
+        const double occultedBodyRadius,
+        const std::vector< Eigen::Vector3d >& occultingBodyPositions,
+        const std::vector< double >& occultingBodyRadii,
+        const Eigen::Vector3d& satellitePosition,
+        const std::vector< double >& occultingBodyFlattenings = std::vector< double >( ),
+        const std::vector< Eigen::Vector3d >& occultingBodyPoleDirections = std::vector< Eigen::Vector3d >( ),
+        const int numberOfQuadratureRings = 16 );
+
 //! Compute the radius of the sphere of influence.
 /*!
  * Returns the radius of the the Sphere of Influence (SOI) for a body orbiting a central body.
@@ -9,11 +9,14 @@
  *
  */
 
+#include <cmath>
+
 #include <boost/date_time/gregorian/gregorian.hpp>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/Basics/timeType.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 namespace tudat
 {
@@ -216,6 +219,31 @@ double calculateSecondsInCurrentJulianDay( const double julianDay )
     return ( julianDay + 0.5 - std::floor( julianDay + 0.5 ) ) * physical_constants::JULIAN_DAY;
 }
 
+//! Function to compute the number of seconds into the current day from the number of seconds since J2000
+double calculateSecondsInCurrentDay( const double secondsSinceJ2000 )
+{
+    // Shift by half a day, since J2000 is at 12:00 and result starts counting at 00:00
+    double secondsInCurrentDay =
+            std::fmod( secondsSinceJ2000 + physical_constants::JULIAN_DAY / 2.0, physical_constants::JULIAN_DAY );
+    if( secondsInCurrentDay < 0.0 )
+    {
+        secondsInCurrentDay += physical_constants::JULIAN_DAY;
+    }
+    return secondsInCurrentDay;
+}
+
+//! Function to compute the local (mean) solar time from the number of seconds into the current day and the longitude
+double calculateLocalSolarTime( const double secondOfTheDay, const double longitude )
+{
+    // Hours since begin of the day at longitude 0 (GMT) + hours passed at current longitude
+    double localSolarTime = std::fmod( secondOfTheDay / 3600.0 + longitude * 12.0 / mathematical_constants::PI, 24.0 );
+    if( localSolarTime < 0.0 )
+    {
+        localSolarTime += 24.0;
+    }
+    return localSolarTime;
+}
+
 //! Function to create the calendar date from the year and the number of days in the year
 boost::gregorian::date convertYearAndDaysInYearToDate( const int year, const int daysInYear )
 {
@@ -343,6 +343,26 @@ int convertDayMonthYearToDayOfYear( const boost::gregorian::date calendarDate );
  */
 double calculateSecondsInCurrentJulianDay( const double julianDay );
 
+//! Function to compute the number of seconds into the current day from the number of seconds since J2000
+/*!
+ *  Function to compute the number of seconds into the current day (counted from 00:00) from the number of seconds since
+ *  J2000 (which is at 12:00). No distinction between time scales is made, and leap seconds are not taken into account.
+ *  \param secondsSinceJ2000 Number of seconds since J2000.
+ *  \return Number of seconds into current day, in the range [0,86400).
+ */
+double calculateSecondsInCurrentDay( const double secondsSinceJ2000 );
+
+//! Function to compute the local (mean) solar time from the number of seconds into the current day and the longitude
+/*!
+ *  Function to compute the local (mean) solar time from the number of seconds into the current (UT) day and the
+ *  longitude, defined as the hour of the day, plus the longitude (in hours). This is the definition used for the local
+ *  solar time input of the NRLMSISE-00 atmosphere model.
+ *  \param secondOfTheDay Number of seconds into the current day.
+ *  \param longitude Longitude at which local solar time is to be computed [rad].
+ *  \return Local solar time, in hours, in the range [0,24).
+ */
+double calculateLocalSolarTime( const double secondOfTheDay, const double longitude );
+
 //! Function to create the calendar date from the year and the number of days in the year
 /*!
  *  Function to create the calendar date from the year and the number of days in the year, where Jan. 1 is day in year 0.
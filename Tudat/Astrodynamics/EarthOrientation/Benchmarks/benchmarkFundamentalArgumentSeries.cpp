@@ -0,0 +1,134 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmark comparing the evaluation of the short-period polar motion correction series (libration and ocean
+ *      tides) term-by-term, as previously done in ShortPeriodEarthOrientationCorrectionCalculator, to evaluation with
+ *      FundamentalArgumentSeriesEvaluator, for single epochs and for all epochs at once. Only built if
+ *      BUILD_BENCHMARKS is set.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "Tudat/Astrodynamics/EarthOrientation/fundamentalArgumentSeriesEvaluator.h"
+#include "Tudat/Astrodynamics/EarthOrientation/readAmplitudeAndArgumentMultipliers.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+
+//! Function to sum the series term-by-term, as done in ShortPeriodEarthOrientationCorrectionCalculator before the
+//! series were evaluated with FundamentalArgumentSeriesEvaluator (including the copies of the series matrices).
+Eigen::Vector2d sumCorrectionTermsTermByTerm(
+        const std::vector< Eigen::MatrixXd >& argumentAmplitudes,
+        const std::vector< Eigen::MatrixXd >& argumentMultipliers,
+        const Eigen::Vector6d& arguments )
+{
+    Eigen::Vector2d currentCorrection = Eigen::Vector2d::Zero( );
+    double tideAngle = 0.0;
+    for( unsigned int i = 0; i < argumentAmplitudes.size( ); i++ )
+    {
+        Eigen::MatrixXd currentArgumentMultipliers = argumentMultipliers.at( i );
+        Eigen::MatrixXd currentAmplitudes = argumentAmplitudes.at( i );
+        for( int j = 0; j < currentAmplitudes.rows( ); j++ )
+        {
+            tideAngle = ( arguments.transpose( ) *
+                          currentArgumentMultipliers.block( j, 0, 1, 6 ).transpose( ) )( 0, 0 );
+            currentCorrection.x( ) += currentAmplitudes( j, 0 ) * std::sin( tideAngle ) +
+                    currentAmplitudes( j, 1 ) * std::cos( tideAngle );
+            currentCorrection.y( ) += currentAmplitudes( j, 2 ) * std::sin( tideAngle ) +
+                    currentAmplitudes( j, 3 ) * std::cos( tideAngle );
+        }
+    }
+    return currentCorrection;
+}
+
+int main( )
+{
+    using namespace tudat;
+    using namespace tudat::earth_orientation;
+
+    const int numberOfEpochs = 100000;
+
+    // Read polar motion correction series
+    std::vector< std::pair< std::string, std::string > > seriesFiles =
+    { { "polarMotionLibrationAmplitudesQuasiDiurnalOnly.txt",
+        "polarMotionLibrationFundamentalArgumentMultipliersQuasiDiurnalOnly.txt" },
+      { "polarMotionOceanTidesAmplitudes.txt", "polarMotionOceanTidesFundamentalArgumentMultipliers.txt" } };
+    std::vector< Eigen::MatrixXd > argumentAmplitudes;
+    std::vector< Eigen::MatrixXd > argumentMultipliers;
+    std::vector< FundamentalArgumentSeriesEvaluator > seriesEvaluators;
+    int numberOfTerms = 0;
+    for( unsigned int i = 0; i < seriesFiles.size( ); i++ )
+    {
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > dataFromFile = readAmplitudesAndFundamentalArgumentMultipliers(
+                    input_output::getEarthOrientationDataFilesPath( ) + seriesFiles.at( i ).first,
+                    input_output::getEarthOrientationDataFilesPath( ) + seriesFiles.at( i ).second );
+        argumentAmplitudes.push_back( dataFromFile.first );
+        argumentMultipliers.push_back( dataFromFile.second );
+        seriesEvaluators.push_back( FundamentalArgumentSeriesEvaluator( dataFromFile.second, dataFromFile.first ) );
+        numberOfTerms += dataFromFile.first.rows( );
+    }
+
+    // Define fundamental arguments at all epochs (linear in time, rates of order of those of the Delaunay arguments
+    // and GMST + pi, in rad/day)
+    Eigen::Vector6d initialArguments, argumentRates;
+    initialArguments << 2.1, 6.2, 1.6, 5.2, 0.9, 4.4;
+    argumentRates << 0.228, 0.017, 0.231, 0.213, -0.001, 6.300;
+    Eigen::MatrixXd fundamentalArguments = Eigen::MatrixXd( 6, numberOfEpochs );
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        fundamentalArguments.col( i ) = initialArguments + 0.01 * static_cast< double >( i ) * argumentRates;
+    }
+
+    // Evaluate term-by-term
+    Eigen::MatrixXd termByTermCorrections = Eigen::MatrixXd( 2, numberOfEpochs );
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        termByTermCorrections.col( i ) = sumCorrectionTermsTermByTerm(
+                    argumentAmplitudes, argumentMultipliers, fundamentalArguments.col( i ) );
+    }
+    const double termByTermTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    // Evaluate with series evaluators, one epoch at a time
+    Eigen::MatrixXd singleEpochCorrections = Eigen::MatrixXd::Zero( 2, numberOfEpochs );
+    startTime = std::chrono::steady_clock::now( );
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        for( unsigned int j = 0; j < seriesEvaluators.size( ); j++ )
+        {
+            singleEpochCorrections.col( i ) += seriesEvaluators.at( j ).evaluate(
+                        Eigen::Vector6d( fundamentalArguments.col( i ) ) );
+        }
+    }
+    const double singleEpochTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    // Evaluate with series evaluators, all epochs at once
+    Eigen::MatrixXd batchCorrections = Eigen::MatrixXd::Zero( 2, numberOfEpochs );
+    startTime = std::chrono::steady_clock::now( );
+    for( unsigned int j = 0; j < seriesEvaluators.size( ); j++ )
+    {
+        batchCorrections += seriesEvaluators.at( j ).evaluate( fundamentalArguments );
+    }
+    const double batchTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    std::cout << "Polar motion correction series, " << numberOfTerms << " terms, " << numberOfEpochs << " epochs"
+              << std::endl
+              << "  Term-by-term:                    " << termByTermTime << " s" << std::endl
+              << "  Series evaluator, single epoch:  " << singleEpochTime << " s, maximum difference "
+              << ( singleEpochCorrections - termByTermCorrections ).cwiseAbs( ).maxCoeff( ) << " microarcseconds"
+              << std::endl
+              << "  Series evaluator, all epochs:    " << batchTime << " s, maximum difference "
+              << ( batchCorrections - termByTermCorrections ).cwiseAbs( ).maxCoeff( ) << " microarcseconds"
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,187 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmark comparing repeated ITRS to GCRS rotation angle evaluations with the time conversions done per time
+ *      scale (separate getCurrentTime calls for TT, UTC and UT1, as previously done in
+ *      EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs) to the evaluations with all time scales
+ *      computed in a single pass (getCurrentTimes), for the epochs at which the rotation is evaluated by a
+ *      Runge-Kutta-Fehlberg 7(8) integrator and in the light-time iterations of a GNSS observation simulation. The
+ *      time conversions are also timed separately. Only built if BUILD_BENCHMARKS is set.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+
+using namespace tudat;
+using namespace tudat::earth_orientation;
+
+//! Function to compute the rotation angles from ITRS to GCRS with the time scales converted one at a time, as done
+//! in EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs before the single-pass conversion was used.
+std::pair< Eigen::Vector5d, double > getRotationAnglesFromItrsToGcrsPerScale(
+        const std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const double timeValue,
+        const basic_astrodynamics::TimeScales timeScale )
+{
+    std::shared_ptr< TerrestrialTimeScaleConverter > timeScaleConverter =
+            earthOrientationCalculator->getTerrestrialTimeScaleConverter( );
+    double terrestrialTime = timeScaleConverter->getCurrentTime< double >(
+                timeScale, basic_astrodynamics::tt_scale, timeValue, Eigen::Vector3d::Zero( ) );
+    double utc = timeScaleConverter->getCurrentTime< double >(
+                timeScale, basic_astrodynamics::utc_scale, timeValue, Eigen::Vector3d::Zero( ) );
+    double ut1 = timeScaleConverter->getCurrentTime< double >(
+                timeScale, basic_astrodynamics::ut1_scale, timeValue, Eigen::Vector3d::Zero( ) );
+
+    std::pair< Eigen::Vector2d, double > positionOfCipInGcrs =
+            earthOrientationCalculator->getPrecessionNutationCalculator( )->getPositionOfCipInGcrs(
+                terrestrialTime, utc );
+    Eigen::Vector2d positionOfCipInItrs =
+            earthOrientationCalculator->getPolarMotionCalculator( )->getPositionOfCipInItrs( terrestrialTime, utc );
+
+    Eigen::Vector5d rotationAngles;
+    rotationAngles << positionOfCipInGcrs.first.x( ), positionOfCipInGcrs.first.y( ), positionOfCipInGcrs.second,
+            positionOfCipInItrs.x( ), positionOfCipInItrs.y( );
+    return std::make_pair( rotationAngles, ut1 );
+}
+
+//! Function to time the time conversions and rotation angle evaluations, per time scale and in a single pass, for a
+//! given list of (TDB) epochs.
+void benchmarkItrsToGcrsEvaluations(
+        const std::string& caseName,
+        const std::vector< double >& epochs,
+        const std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator )
+{
+    std::shared_ptr< TerrestrialTimeScaleConverter > timeScaleConverter =
+            earthOrientationCalculator->getTerrestrialTimeScaleConverter( );
+    const basic_astrodynamics::TimeScales inputScale = basic_astrodynamics::tdb_scale;
+
+    // Time conversions only, per time scale
+    double perScaleSum = 0.0;
+    timeScaleConverter->resetTimes< double >( );
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    for( unsigned int i = 0; i < epochs.size( ); i++ )
+    {
+        perScaleSum += timeScaleConverter->getCurrentTime< double >(
+                    inputScale, basic_astrodynamics::tt_scale, epochs.at( i ) );
+        perScaleSum += timeScaleConverter->getCurrentTime< double >(
+                    inputScale, basic_astrodynamics::utc_scale, epochs.at( i ) );
+        perScaleSum += timeScaleConverter->getCurrentTime< double >(
+                    inputScale, basic_astrodynamics::ut1_scale, epochs.at( i ) );
+    }
+    const double perScaleConversionTime = std::chrono::duration< double >(
+                std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    // Time conversions only, single pass
+    double singlePassSum = 0.0;
+    timeScaleConverter->resetTimes< double >( );
+    startTime = std::chrono::steady_clock::now( );
+    for( unsigned int i = 0; i < epochs.size( ); i++ )
+    {
+        CurrentTimes< double > currentTimes = timeScaleConverter->getCurrentTimes< double >(
+                    inputScale, epochs.at( i ) );
+        singlePassSum += currentTimes.tt + currentTimes.utc + currentTimes.ut1;
+    }
+    const double singlePassConversionTime = std::chrono::duration< double >(
+                std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    // Rotation angles, per time scale
+    std::vector< std::pair< Eigen::Vector5d, double > > perScaleAngles;
+    perScaleAngles.reserve( epochs.size( ) );
+    timeScaleConverter->resetTimes< double >( );
+    startTime = std::chrono::steady_clock::now( );
+    for( unsigned int i = 0; i < epochs.size( ); i++ )
+    {
+        perScaleAngles.push_back( getRotationAnglesFromItrsToGcrsPerScale(
+                                      earthOrientationCalculator, epochs.at( i ), inputScale ) );
+    }
+    const double perScaleAnglesTime = std::chrono::duration< double >(
+                std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    // Rotation angles, single pass
+    std::vector< std::pair< Eigen::Vector5d, double > > singlePassAngles;
+    singlePassAngles.reserve( epochs.size( ) );
+    timeScaleConverter->resetTimes< double >( );
+    startTime = std::chrono::steady_clock::now( );
+    for( unsigned int i = 0; i < epochs.size( ); i++ )
+    {
+        singlePassAngles.push_back( earthOrientationCalculator->getRotationAnglesFromItrsToGcrs< double >(
+                                        epochs.at( i ), inputScale ) );
+    }
+    const double singlePassAnglesTime = std::chrono::duration< double >(
+                std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    // Compare results
+    double maximumAngleDifference = 0.0;
+    double maximumUt1Difference = 0.0;
+    for( unsigned int i = 0; i < epochs.size( ); i++ )
+    {
+        maximumAngleDifference = std::max(
+                    maximumAngleDifference,
+                    ( perScaleAngles.at( i ).first - singlePassAngles.at( i ).first ).cwiseAbs( ).maxCoeff( ) );
+        maximumUt1Difference = std::max(
+                    maximumUt1Difference,
+                    std::fabs( perScaleAngles.at( i ).second - singlePassAngles.at( i ).second ) );
+    }
+
+    std::cout << caseName << ", " << epochs.size( ) << " evaluations" << std::endl
+              << "  Time conversions, per scale:      " << perScaleConversionTime << " s" << std::endl
+              << "  Time conversions, single pass:    " << singlePassConversionTime << " s, difference of sums "
+              << singlePassSum - perScaleSum << " s" << std::endl
+              << "  ITRS to GCRS angles, per scale:   " << perScaleAnglesTime << " s" << std::endl
+              << "  ITRS to GCRS angles, single pass: " << singlePassAnglesTime << " s, maximum difference "
+              << maximumAngleDifference << " rad, " << maximumUt1Difference << " s (UT1)" << std::endl;
+}
+
+int main( )
+{
+    std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator =
+            createStandardEarthOrientationCalculator( );
+
+    const double initialEpoch = 1.0E8;
+
+    // Epochs of state derivative evaluations of a Runge-Kutta-Fehlberg 7(8) integrator with 60 s steps
+    const std::vector< double > stageNodes =
+    { 0.0, 2.0 / 27.0, 1.0 / 9.0, 1.0 / 6.0, 5.0 / 12.0, 1.0 / 2.0, 5.0 / 6.0, 1.0 / 6.0, 2.0 / 3.0, 1.0 / 3.0, 1.0,
+      0.0, 1.0 };
+    std::vector< double > integrationEpochs;
+    for( int i = 0; i < 5000; i++ )
+    {
+        for( unsigned int j = 0; j < stageNodes.size( ); j++ )
+        {
+            integrationEpochs.push_back( initialEpoch + 60.0 * ( static_cast< double >( i ) + stageNodes.at( j ) ) );
+        }
+    }
+    benchmarkItrsToGcrsEvaluations( "Integration stages (RKF7(8), 60 s steps)", integrationEpochs,
+                                    earthOrientationCalculator );
+
+    // Epochs of a GNSS observation simulation every 30 s, with the rotation evaluated alternately at the reception
+    // time and at the (converging) transmission time in each of four light-time iterations
+    const std::vector< double > lightTimeIterates = { 0.0, 0.07, 0.0699, 0.06989 };
+    std::vector< double > observationEpochs;
+    for( int i = 0; i < 5000; i++ )
+    {
+        const double receptionEpoch = initialEpoch + 30.0 * static_cast< double >( i );
+        for( unsigned int j = 0; j < lightTimeIterates.size( ); j++ )
+        {
+            observationEpochs.push_back( receptionEpoch );
+            observationEpochs.push_back( receptionEpoch - lightTimeIterates.at( j ) );
+        }
+    }
+    benchmarkItrsToGcrsEvaluations( "GNSS light-time iterations (30 s cadence)", observationEpochs,
+                                    earthOrientationCalculator );
+
+    return EXIT_SUCCESS;
+}
@@ -234,6 +234,69 @@ BOOST_AUTO_TEST_CASE( testShortPeriodUt1CombinedCorrections )
     BOOST_CHECK_SMALL( std::fabs( ut1CorrectionTotal - ( ut1CorrectionLibration + ut1CorrectionOceanTides ) ), 1.0E-20 );
 }
 
+//! Test evaluation of short-period variations at multiple epochs, by comparing to single-epoch evaluation, and to manual
+//! term-by-term evaluation of the series
+BOOST_AUTO_TEST_CASE( testShortPeriodCorrectionsAtMultipleEpochs )
+{
+    std::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< double > > ut1CorrectionCalculator =
+            getDefaultUT1CorrectionCalculator( );
+    std::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > > polarMotionCorrectionCalculator =
+            getDefaultPolarMotionCorrectionCalculator( );
+
+    // Read series for manual evaluation
+    std::vector< std::pair< Eigen::MatrixXd, Eigen::MatrixXd > > ut1Series;
+    ut1Series.push_back( readAmplitudesAndFundamentalArgumentMultipliers(
+                             getEarthOrientationDataFilesPath( ) + "utcLibrationAmplitudes.txt",
+                             getEarthOrientationDataFilesPath( ) + "utcLibrationFundamentalArgumentMultipliers.txt" ) );
+    ut1Series.push_back( readAmplitudesAndFundamentalArgumentMultipliers(
+                             getEarthOrientationDataFilesPath( ) + "utcOceanTidesAmplitudes.txt",
+                             getEarthOrientationDataFilesPath( ) + "utcOceanTidesFundamentalArgumentMultipliers.txt" ) );
+
+    // Define test times
+    std::vector< double > testTimes;
+    for( int i = 0; i < 50; i++ )
+    {
+        testTimes.push_back( -5.0E8 + static_cast< double >( i ) * 2.0E7 + 1234.5 * static_cast< double >( i * i ) );
+    }
+
+    // Compute corrections at all epochs at once
+    Eigen::MatrixXd ut1Corrections = ut1CorrectionCalculator->getCorrectionsAtEpochs( testTimes );
+    Eigen::MatrixXd polarMotionCorrections = polarMotionCorrectionCalculator->getCorrectionsAtEpochs( testTimes );
+
+    BOOST_CHECK_EQUAL( ut1Corrections.rows( ), 1 );
+    BOOST_CHECK_EQUAL( ut1Corrections.cols( ), static_cast< int >( testTimes.size( ) ) );
+    BOOST_CHECK_EQUAL( polarMotionCorrections.rows( ), 2 );
+    BOOST_CHECK_EQUAL( polarMotionCorrections.cols( ), static_cast< int >( testTimes.size( ) ) );
+
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        // Compare to single-epoch evaluation
+        BOOST_CHECK_SMALL( std::fabs( ut1Corrections( 0, i ) - ut1CorrectionCalculator->getCorrections( testTimes.at( i ) ) ),
+                           1.0E-18 );
+
+        Eigen::Vector2d singlePolarMotionCorrection = polarMotionCorrectionCalculator->getCorrections( testTimes.at( i ) );
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( polarMotionCorrections( j, i ) - singlePolarMotionCorrection( j ) ), 1.0E-20 );
+        }
+
+        // Compare to manual evaluation of UT1 series
+        Eigen::Vector6d fundamentalArguments =
+                calculateApproximateDelaunayFundamentalArgumentsWithGmst( testTimes.at( i ) );
+        double manualUt1Correction = 0.0;
+        for( unsigned int j = 0; j < ut1Series.size( ); j++ )
+        {
+            for( int k = 0; k < ut1Series.at( j ).first.rows( ); k++ )
+            {
+                double currentArgument = ut1Series.at( j ).second.row( k ).dot( fundamentalArguments.transpose( ) );
+                manualUt1Correction += 1.0E-6 * ( ut1Series.at( j ).first( k, 0 ) * std::sin( currentArgument ) +
+                                                  ut1Series.at( j ).first( k, 1 ) * std::cos( currentArgument ) );
+            }
+        }
+        BOOST_CHECK_SMALL( std::fabs( ut1Corrections( 0, i ) - manualUt1Correction ), 1.0E-18 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
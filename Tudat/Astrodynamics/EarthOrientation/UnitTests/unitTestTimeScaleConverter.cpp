@@ -401,6 +401,59 @@ BOOST_AUTO_TEST_CASE( testTimeScaleConversionDuringLeapSeconds )
     }
 }
 
+//! Test single-pass conversion to all time scales, and reuse of conversions at alternating epochs
+BOOST_AUTO_TEST_CASE( testSinglePassTimeScaleConversions )
+{
+    // Create time converters: one to be used with alternating epochs, one reset before each conversion
+    std::shared_ptr< TerrestrialTimeScaleConverter > timeScaleConverter =
+            createStandardEarthOrientationCalculator( )->getTerrestrialTimeScaleConverter( );
+    std::shared_ptr< TerrestrialTimeScaleConverter > referenceTimeScaleConverter =
+            createStandardEarthOrientationCalculator( )->getTerrestrialTimeScaleConverter( );
+
+    Eigen::Vector3d stationCartesianPosition;
+    stationCartesianPosition << -5492333.306498738, -2453018.508911721, 2113645.653406073;
+
+    std::vector< TimeScales > timeScales = { tt_scale, utc_scale, ut1_scale, tai_scale, tdb_scale };
+
+    // Define epochs/positions at which conversions are alternated (more than the number of cached entries).
+    std::vector< double > testTimes = { 1.0E8, 1.0E8 + 150.0, 1.0E8 + 300.0, 1.0E8, 1.0E8 + 150.0, 1.0E8 + 300.0,
+                                        2.0E8, 1.0E8, 3.0E8, 4.0E8, 1.0E8, 1.0E8 + 150.0 };
+    std::vector< Eigen::Vector3d > testPositions = { Eigen::Vector3d::Zero( ), stationCartesianPosition };
+
+    for( unsigned int i = 0; i < timeScales.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < testTimes.size( ); j++ )
+        {
+            for( unsigned int k = 0; k < testPositions.size( ); k++ )
+            {
+                CurrentTimes< double > currentTimes = timeScaleConverter->getCurrentTimes< double >(
+                            timeScales.at( i ), testTimes.at( j ), testPositions.at( k ) );
+                CurrentTimes< Time > currentTimesSplit = timeScaleConverter->getCurrentTimes< Time >(
+                            timeScales.at( i ), Time( testTimes.at( j ) ), testPositions.at( k ) );
+
+                for( unsigned int l = 0; l < timeScales.size( ); l++ )
+                {
+                    // Compare against conversion without cached values
+                    referenceTimeScaleConverter->resetTimes< double >( );
+                    referenceTimeScaleConverter->resetTimes< Time >( );
+                    double expectedTime = referenceTimeScaleConverter->getCurrentTime< double >(
+                                timeScales.at( i ), timeScales.at( l ), testTimes.at( j ), testPositions.at( k ) );
+                    Time expectedTimeSplit = referenceTimeScaleConverter->getCurrentTime< Time >(
+                                timeScales.at( i ), timeScales.at( l ), Time( testTimes.at( j ) ), testPositions.at( k ) );
+
+                    BOOST_CHECK_EQUAL( currentTimes.getTimeValue( timeScales.at( l ) ), expectedTime );
+                    BOOST_CHECK_EQUAL( currentTimesSplit.getTimeValue( timeScales.at( l ) ) == expectedTimeSplit, true );
+
+                    // Compare against single-scale conversion with same object
+                    BOOST_CHECK_EQUAL( timeScaleConverter->getCurrentTime< double >(
+                                           timeScales.at( i ), timeScales.at( l ), testTimes.at( j ),
+                                           testPositions.at( k ) ), expectedTime );
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -218,13 +218,12 @@ public:
             const double timeValue,
             basic_astrodynamics::TimeScales timeScale = basic_astrodynamics::tt_scale )
     {
-        // Compute required time values
-        TimeType terrestrialTime = terrestrialTimeScaleConverter_->getCurrentTime< TimeType >(
-                    timeScale, basic_astrodynamics::tt_scale, timeValue, Eigen::Vector3d::Zero( ) );
-        TimeType utc = terrestrialTimeScaleConverter_->getCurrentTime< TimeType >(
-                    timeScale, basic_astrodynamics::utc_scale, timeValue, Eigen::Vector3d::Zero( ) );
-        TimeType ut1 = terrestrialTimeScaleConverter_->getCurrentTime< TimeType >(
-                    timeScale, basic_astrodynamics::ut1_scale, timeValue, Eigen::Vector3d::Zero( ) );
+        // Compute required time values in single pass
+        CurrentTimes< TimeType > currentTimes = terrestrialTimeScaleConverter_->getCurrentTimes< TimeType >(
+                    timeScale, TimeType( timeValue ), Eigen::Vector3d::Zero( ) );
+        TimeType terrestrialTime = currentTimes.tt;
+        TimeType utc = currentTimes.utc;
+        TimeType ut1 = currentTimes.ut1;
 
         // Compute nutation/precession parameters
         std::pair< Eigen::Vector2d, double > positionOfCipInGcrs =
@@ -0,0 +1,92 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/EarthOrientation/fundamentalArgumentSeriesEvaluator.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Constructor
+FundamentalArgumentSeriesEvaluator::FundamentalArgumentSeriesEvaluator(
+        const Eigen::MatrixXd& argumentMultipliers,
+        const Eigen::MatrixXd& amplitudes ):
+    argumentMultipliers_( argumentMultipliers )
+{
+    if( argumentMultipliers.rows( ) != amplitudes.rows( ) )
+    {
+        throw std::runtime_error( "Error when creating fundamental argument series, number of multipliers and amplitudes "
+                                  "is inconsistent" );
+    }
+
+    if( argumentMultipliers.cols( ) != 6 )
+    {
+        throw std::runtime_error( "Error when creating fundamental argument series, six argument multipliers per term "
+                                  "required" );
+    }
+
+    if( amplitudes.cols( ) % 2 != 0 )
+    {
+        throw std::runtime_error( "Error when creating fundamental argument series, amplitudes must be provided as "
+                                  "sine/cosine pairs" );
+    }
+
+    // Split amplitudes into (transposed) sine and cosine amplitudes
+    int numberOfComponents = amplitudes.cols( ) / 2;
+    sineAmplitudes_.resize( numberOfComponents, amplitudes.rows( ) );
+    cosineAmplitudes_.resize( numberOfComponents, amplitudes.rows( ) );
+    for( int i = 0; i < numberOfComponents; i++ )
+    {
+        sineAmplitudes_.row( i ) = amplitudes.col( 2 * i ).transpose( );
+        cosineAmplitudes_.row( i ) = amplitudes.col( 2 * i + 1 ).transpose( );
+    }
+
+    currentArguments_.resize( argumentMultipliers_.rows( ) );
+    currentSines_.resize( argumentMultipliers_.rows( ) );
+    currentCosines_.resize( argumentMultipliers_.rows( ) );
+    currentSeriesValue_.resize( numberOfComponents );
+}
+
+//! Function to evaluate the series for a single set of fundamental arguments
+const Eigen::VectorXd& FundamentalArgumentSeriesEvaluator::evaluate( const Eigen::Vector6d& fundamentalArguments )
+{
+    // Compute arguments of all terms, and their sines and cosines
+    currentArguments_.noalias( ) = argumentMultipliers_ * fundamentalArguments;
+    currentSines_.array( ) = currentArguments_.array( ).sin( );
+    currentCosines_.array( ) = currentArguments_.array( ).cos( );
+
+    // Sum all terms
+    currentSeriesValue_.noalias( ) = sineAmplitudes_ * currentSines_;
+    currentSeriesValue_.noalias( ) += cosineAmplitudes_ * currentCosines_;
+    return currentSeriesValue_;
+}
+
+//! Function to evaluate the series for a list of sets of fundamental arguments
+Eigen::MatrixXd FundamentalArgumentSeriesEvaluator::evaluate( const Eigen::MatrixXd& fundamentalArguments )
+{
+    // Compute arguments of all terms at all epochs, and their sines and cosines
+    Eigen::MatrixXd termArguments = argumentMultipliers_ * fundamentalArguments;
+    Eigen::MatrixXd termSines = termArguments.array( ).sin( ).matrix( );
+    Eigen::MatrixXd termCosines = termArguments.array( ).cos( ).matrix( );
+
+    // Sum all terms
+    Eigen::MatrixXd seriesValues = sineAmplitudes_ * termSines;
+    seriesValues.noalias( ) += cosineAmplitudes_ * termCosines;
+    return seriesValues;
+}
+
+} // namespace earth_orientation
+
+} // namespace tudat
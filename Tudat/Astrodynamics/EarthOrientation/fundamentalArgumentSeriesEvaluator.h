@@ -0,0 +1,122 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_FUNDAMENTALARGUMENTSERIESEVALUATOR_H
+#define TUDAT_FUNDAMENTALARGUMENTSERIESEVALUATOR_H
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Class to evaluate a series of sine and cosine terms, with arguments that are linear combinations of fundamental arguments
+/*!
+ *  Class to evaluate a series of sine and cosine terms, with arguments that are linear combinations of six fundamental
+ *  arguments, as used for short-period Earth orientation corrections (IERS 2010 Conventions, Tables 5.1 and 8.2)
+ *  and nutation series. Each term i contributes to output component k:
+ *  S_{ik} sin( theta_i ) + C_{ik} cos( theta_i ), with theta_i = sum_j M_{ij} phi_j,
+ *  where phi_j are the fundamental arguments. The multipliers and amplitudes are stored as contiguous matrices, so that the
+ *  arguments of all terms are computed by a single matrix-vector product, their sines and cosines by a single (vectorized)
+ *  array operation, and the output by a matrix-vector product with the amplitudes. The series can also be evaluated for
+ *  many sets of fundamental arguments (e.g. many epochs) at once, in which case all operations become matrix-matrix
+ *  products.
+ */
+class FundamentalArgumentSeriesEvaluator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param argumentMultipliers Fundamental argument multipliers M, one term per row (six columns).
+     *  \param amplitudes Amplitudes of terms, one term per row, columns ordered as: sine (component 1),
+     *  cosine (component 1), sine (component 2), cosine (component 2), etc.
+     */
+    FundamentalArgumentSeriesEvaluator(
+            const Eigen::MatrixXd& argumentMultipliers,
+            const Eigen::MatrixXd& amplitudes );
+
+    //! Function to evaluate the series for a single set of fundamental arguments
+    /*!
+     *  Function to evaluate the series for a single set of fundamental arguments.
+     *  The result is written into a pre-allocated member of this object, to which a reference is returned. The value
+     *  it refers to is overwritten by the next call of this function, so it must be copied if it is to be retained.
+     *  For the same reason, this function is not reentrant: a single object must not be used by several threads
+     *  concurrently.
+     *  \param fundamentalArguments Fundamental arguments at which series is to be evaluated
+     *  \return Value of each of the output components of the series (reference to member that is overwritten by the
+     *  next call of this function)
+     */
+    const Eigen::VectorXd& evaluate( const Eigen::Vector6d& fundamentalArguments );
+
+    //! Function to evaluate the series for a list of sets of fundamental arguments
+    /*!
+     *  Function to evaluate the series for a list of sets of fundamental arguments (e.g. at a list of epochs)
+     *  \param fundamentalArguments Fundamental arguments at which series is to be evaluated, one set per column.
+     *  \return Value of each of the output components (rows) of the series, for each set of fundamental arguments (columns)
+     */
+    Eigen::MatrixXd evaluate( const Eigen::MatrixXd& fundamentalArguments );
+
+    //! Function to retrieve the number of terms in the series
+    /*!
+     *  Function to retrieve the number of terms in the series
+     *  \return Number of terms in the series
+     */
+    int getNumberOfTerms( )
+    {
+        return argumentMultipliers_.rows( );
+    }
+
+    //! Function to retrieve the number of output components of the series
+    /*!
+     *  Function to retrieve the number of output components of the series
+     *  \return Number of output components of the series
+     */
+    int getNumberOfComponents( )
+    {
+        return sineAmplitudes_.rows( );
+    }
+
+private:
+
+    //! Fundamental argument multipliers, one term per row.
+    Eigen::MatrixXd argumentMultipliers_;
+
+    //! Amplitudes of sine terms, one output component per row, one term per column
+    Eigen::MatrixXd sineAmplitudes_;
+
+    //! Amplitudes of cosine terms, one output component per row, one term per column
+    Eigen::MatrixXd cosineAmplitudes_;
+
+    //! Pre-allocated vector of arguments of each term, used for single evaluation
+    Eigen::VectorXd currentArguments_;
+
+    //! Pre-allocated vector of sines of arguments of each term, used for single evaluation
+    Eigen::VectorXd currentSines_;
+
+    //! Pre-allocated vector of cosines of arguments of each term, used for single evaluation
+    Eigen::VectorXd currentCosines_;
+
+    //! Pre-allocated vector of output components of the series, used for single evaluation
+    Eigen::VectorXd currentSeriesValue_;
+
+};
+
+} // namespace earth_orientation
+
+} // namespace tudat
+
+#endif // TUDAT_FUNDAMENTALARGUMENTSERIESEVALUATOR_H
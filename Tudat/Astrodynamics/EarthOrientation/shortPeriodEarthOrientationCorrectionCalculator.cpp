@@ -21,29 +21,13 @@ namespace earth_orientation
 template< >
 double ShortPeriodEarthOrientationCorrectionCalculator< double >::sumCorrectionTerms( const Eigen::Vector6d& arguments )
 {
-    // Initialize corrections to zero.
-    double currentCorrection = 0;
-    double tideAngle = 0.0;
-
-    // Iterate over all correction types
-    for( unsigned int i = 0; i < argumentAmplitudes_.size( ); i++ )
+    // Iterate over all correction types, and add contributions
+    double currentCorrection = 0.0;
+    for( unsigned int i = 0; i < seriesEvaluators_.size( ); i++ )
     {
-        Eigen::MatrixXd currentArgumentMultipliers = argumentMultipliers_.at( i );
-        Eigen::MatrixXd currentAmplitudes = argumentAmplitudes_.at( i );
-
-        // Iterte over all libration corrections.
-        for( int i = 0; i < currentAmplitudes.rows( ); i++ )
-        {
-            // Calculate current phase angle of tide.
-            tideAngle = ( arguments.transpose( ) *
-                          currentArgumentMultipliers.block( i, 0, 1, 6 ).transpose( ) )( 0, 0 );
-
-            currentCorrection += currentAmplitudes( i, 0 ) * std::sin( tideAngle ) +
-                    currentAmplitudes( i, 1 ) * std::cos( tideAngle );
-        }
+        currentCorrection += seriesEvaluators_.at( i ).evaluate( arguments )( 0 );
     }
 
-
     return currentCorrection;
 }
 
@@ -52,32 +36,13 @@ template< >
 Eigen::Vector2d ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d >::sumCorrectionTerms(
         const Eigen::Vector6d& arguments )
 {
-    // Initialize corrections to zero.
+    // Iterate over all correction types, and add contributions
     Eigen::Vector2d currentCorrection = Eigen::Vector2d::Zero( );
-    double tideAngle = 0.0;
-
-    // Iterate over all correction types
-    for( unsigned int i = 0; i < argumentAmplitudes_.size( ); i++ )
+    for( unsigned int i = 0; i < seriesEvaluators_.size( ); i++ )
     {
-        Eigen::MatrixXd currentArgumentMultipliers = argumentMultipliers_.at( i );
-        Eigen::MatrixXd currentAmplitudes = argumentAmplitudes_.at( i );
-
-        // Iterte over all libration corrections.
-        for( int i = 0; i < currentAmplitudes.rows( ); i++ )
-        {
-            // Calculate current phase angle of tide.
-            tideAngle = ( arguments.transpose( ) *
-                          currentArgumentMultipliers.block( i, 0, 1, 6 ).transpose( ) )( 0, 0 );
-
-            // Calculate and add sine and cosine terms
-            currentCorrection.x( ) += currentAmplitudes( i, 0 ) * std::sin( tideAngle ) +
-                    currentAmplitudes( i, 1 ) * std::cos( tideAngle );
-            currentCorrection.y( ) += currentAmplitudes( i, 2 ) * std::sin( tideAngle ) +
-                    currentAmplitudes( i, 3 ) * std::cos( tideAngle );
-        }
+        currentCorrection += seriesEvaluators_.at( i ).evaluate( arguments ).segment( 0, 2 );
     }
 
-
     return currentCorrection;
 }
 
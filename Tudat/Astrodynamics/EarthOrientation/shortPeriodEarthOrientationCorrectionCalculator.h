@@ -25,6 +25,7 @@
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/Astrodynamics/EarthOrientation/fundamentalArgumentSeriesEvaluator.h"
 #include "Tudat/Astrodynamics/EarthOrientation/readAmplitudeAndArgumentMultipliers.h"
 
 #include "Tudat/External/SofaInterface/fundamentalArguments.h"
@@ -79,8 +80,8 @@ public:
         {
             dataFromFile = readAmplitudesAndFundamentalArgumentMultipliers(
                         amplitudesFiles.at( i ), argumentMultipliersFile.at( i ), minimumAmplitude );
-            argumentAmplitudes_.push_back( conversionFactor * dataFromFile.first );
-            argumentMultipliers_.push_back( dataFromFile.second );
+            seriesEvaluators_.push_back( FundamentalArgumentSeriesEvaluator(
+                                             dataFromFile.second, conversionFactor * dataFromFile.first ) );
         }
     }
 
@@ -106,6 +107,42 @@ public:
         return sumCorrectionTerms( fundamentalArguments );
     }
 
+    //! Function to obtain short period corrections at a list of epochs.
+    /*!
+     *  Function to obtain short period corrections at a list of epochs. Fundamental arguments are calculated internally,
+     *  after which the correction series are evaluated for all epochs at once, which is considerably more efficient
+     *  than calling getCorrections for each epoch separately.
+     *  \param ephemerisTimes Times (TDB seconds since J2000) at which corretions are to be determined
+     *  \return Short period corrections, one component per row (1 for UT1, 2 for polar motion) and one epoch per column.
+     */
+    Eigen::MatrixXd getCorrectionsAtEpochs( const std::vector< double >& ephemerisTimes )
+    {
+        Eigen::MatrixXd fundamentalArguments = Eigen::MatrixXd( 6, ephemerisTimes.size( ) );
+        for( unsigned int i = 0; i < ephemerisTimes.size( ); i++ )
+        {
+            fundamentalArguments.col( i ) = argumentFunction_( ephemerisTimes.at( i ) );
+        }
+        return getCorrectionsFromArguments( fundamentalArguments );
+    }
+
+    //! Function to obtain short period corrections for a list of sets of fundamental arguments.
+    /*!
+     *  Function to obtain short period corrections for a list of sets of fundamental arguments.
+     *  \param fundamentalArguments Fundamental arguments from which corretions are to be determined, one set per column.
+     *  \return Short period corrections, one component per row and one set of fundamental arguments per column.
+     */
+    Eigen::MatrixXd getCorrectionsFromArguments( const Eigen::MatrixXd& fundamentalArguments )
+    {
+        Eigen::MatrixXd corrections = Eigen::MatrixXd::Zero(
+                    ( seriesEvaluators_.size( ) > 0 ) ? seriesEvaluators_.at( 0 ).getNumberOfComponents( ) : 0,
+                    fundamentalArguments.cols( ) );
+        for( unsigned int i = 0; i < seriesEvaluators_.size( ); i++ )
+        {
+            corrections += seriesEvaluators_.at( i ).evaluate( fundamentalArguments );
+        }
+        return corrections;
+    }
+
 private:
 
     //! Function to sum all the corrcetion terms.
@@ -116,11 +153,8 @@ private:
      */
     OutputType sumCorrectionTerms( const Eigen::Vector6d& arguments );
 
-    //! Amplitudes of libration-induced variations
-    std::vector< Eigen::MatrixXd > argumentAmplitudes_;
-
-    //! Fundamental argument multipliers of libration-induced variations.
-    std::vector< Eigen::MatrixXd > argumentMultipliers_;
+    //! Objects evaluating the correction series, one per pair of amplitude and argument multiplier files
+    std::vector< FundamentalArgumentSeriesEvaluator > seriesEvaluators_;
 
     //! Fundamental argument functions associated with multipliers.
     std::function< Eigen::Vector6d( const double ) > argumentFunction_;
@@ -0,0 +1,116 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include "Tudat/Astrodynamics/EarthOrientation/tabulatedEarthOrientationAnglesCalculator.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Constructor
+TabulatedEarthOrientationAnglesCalculator::TabulatedEarthOrientationAnglesCalculator(
+        const std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator,
+        const basic_astrodynamics::TimeScales inputTimeScale,
+        const double blockDuration,
+        const double timeStep,
+        const int numberOfInterpolationPoints,
+        const unsigned int maximumNumberOfBlocks ):
+    anglesCalculator_( anglesCalculator ), inputTimeScale_( inputTimeScale ),
+    blockDuration_( blockDuration ), timeStep_( timeStep ),
+    numberOfInterpolationPoints_( numberOfInterpolationPoints ),
+    maximumNumberOfBlocks_( maximumNumberOfBlocks ),
+    currentBlockIndex_( 0 ), currentBlockInterpolator_( nullptr ), numberOfGeneratedBlocks_( 0 )
+{
+    if( numberOfInterpolationPoints_ < 2 || numberOfInterpolationPoints_ % 2 != 0 )
+    {
+        throw std::runtime_error( "Error when creating tabulated Earth orientation angles, number of interpolation points "
+                                  "must be even, and at least 2" );
+    }
+
+    if( !( timeStep_ > 0.0 ) || !( blockDuration_ >= timeStep_ ) )
+    {
+        throw std::runtime_error( "Error when creating tabulated Earth orientation angles, inconsistent block duration "
+                                  "and time step" );
+    }
+
+    if( maximumNumberOfBlocks_ < 1 )
+    {
+        throw std::runtime_error( "Error when creating tabulated Earth orientation angles, at least one block must be "
+                                  "retained" );
+    }
+}
+
+//! Function to set the current block to the block with given index, generating it if it is not stored.
+void TabulatedEarthOrientationAnglesCalculator::updateCurrentBlock( const int blockIndex )
+{
+    // Check if block is already available
+    std::map< int, std::shared_ptr< BlockInterpolator > >::const_iterator blockIterator =
+            blockInterpolators_.find( blockIndex );
+    if( blockIterator != blockInterpolators_.end( ) )
+    {
+        // Move block to front of usage list
+        blockUsageOrder_.remove( blockIndex );
+        blockUsageOrder_.push_front( blockIndex );
+        currentBlockInterpolator_ = blockIterator->second;
+    }
+    else
+    {
+        // Discard least recently used block if needed
+        if( blockInterpolators_.size( ) >= maximumNumberOfBlocks_ )
+        {
+            blockInterpolators_.erase( blockUsageOrder_.back( ) );
+            blockUsageOrder_.pop_back( );
+        }
+
+        // Generate and store new block
+        currentBlockInterpolator_ = generateBlockInterpolator( blockIndex );
+        blockInterpolators_[ blockIndex ] = currentBlockInterpolator_;
+        blockUsageOrder_.push_front( blockIndex );
+    }
+    currentBlockIndex_ = blockIndex;
+}
+
+//! Function to generate the interpolator for a single block of tabulated values
+std::shared_ptr< TabulatedEarthOrientationAnglesCalculator::BlockInterpolator >
+TabulatedEarthOrientationAnglesCalculator::generateBlockInterpolator( const int blockIndex )
+{
+    // Determine number of nodes in block, and number of nodes to add on either side so that the centered Lagrange
+    // polynomial can be used over the full block.
+    int numberOfNodesInBlock = static_cast< int >( std::ceil( blockDuration_ / timeStep_ - 1.0E-12 ) );
+    int numberOfPaddingNodes = numberOfInterpolationPoints_ / 2 + 1;
+
+    // Compute Earth orientation angles at all nodes.
+    double blockStartTime = static_cast< double >( blockIndex ) * blockDuration_;
+    std::map< double, Eigen::Vector6d > tabulatedValues;
+    std::pair< Eigen::Vector5d, Time > currentRotationAngles;
+    Eigen::Vector6d currentTabulatedValue;
+    for( int i = -numberOfPaddingNodes; i <= numberOfNodesInBlock + numberOfPaddingNodes; i++ )
+    {
+        double currentTime = blockStartTime + static_cast< double >( i ) * timeStep_;
+        currentRotationAngles = anglesCalculator_->getRotationAnglesFromItrsToGcrs< Time >( currentTime, inputTimeScale_ );
+
+        currentTabulatedValue.segment( 0, 5 ) = currentRotationAngles.first;
+        currentTabulatedValue( 5 ) = ( currentRotationAngles.second - Time( currentTime ) ).getSeconds< double >( );
+        tabulatedValues[ currentTime ] = currentTabulatedValue;
+    }
+
+    numberOfGeneratedBlocks_++;
+
+    return std::make_shared< BlockInterpolator >(
+                tabulatedValues, numberOfInterpolationPoints_, interpolators::huntingAlgorithm,
+                interpolators::lagrange_no_boundary_interpolation );
+}
+
+} // namespace earth_orientation
+
+} // namespace tudat
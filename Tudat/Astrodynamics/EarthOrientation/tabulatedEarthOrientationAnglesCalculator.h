@@ -0,0 +1,205 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_TABULATEDEARTHORIENTATIONANGLESCALCULATOR_H
+#define TUDAT_TABULATEDEARTHORIENTATIONANGLESCALCULATOR_H
+
+#include <cmath>
+#include <list>
+#include <map>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Class to retrieve Earth orientation angles from tabulated values that are generated on demand
+/*!
+ *  Class to retrieve Earth orientation angles (X, Y, s, x_p, y_p and UT1) from tabulated values, which are generated on
+ *  demand from an EarthOrientationAnglesCalculator in blocks of fixed duration (one day by default). Each block is
+ *  interpolated using a Lagrange interpolator, with a number of additional nodes on both sides of the block, so that
+ *  the centered Lagrange polynomial can be used over the full block. Only a limited number of blocks is retained, the
+ *  least recently used block being discarded when a new block is generated. The UT1 is tabulated as its offset w.r.t.
+ *  the input time, so that no precision is lost when using a Time object as input.
+ *
+ *  For the default settings (8-point Lagrange interpolation, 1 hour time step), the interpolation error of the angles is
+ *  below 1.0E-11 rad, and that of UT1 below 1.0E-7 s, where both values are dominated by the discontinuity in the
+ *  derivative of the (linearly interpolated) daily IERS values. This corresponds to sub-mm position differences on the
+ *  Earth's surface. The evaluation time is reduced to (approximately) that of a single interpolation per call, compared
+ *  to evaluating the full IERS 2010 nutation and short-period correction series.
+ */
+class TabulatedEarthOrientationAnglesCalculator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param anglesCalculator Object used to compute the Earth orientation angles when generating a new block.
+     *  \param inputTimeScale Time scale in which input to this class is provided.
+     *  \param blockDuration Duration of single block of tabulated values.
+     *  \param timeStep Time step between tabulated values (blockDuration should be an integer multiple of this value).
+     *  \param numberOfInterpolationPoints Number of Lagrange interpolation points (must be even, and at least 2)
+     *  \param maximumNumberOfBlocks Maximum number of blocks that is retained in memory.
+     */
+    TabulatedEarthOrientationAnglesCalculator(
+            const std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator,
+            const basic_astrodynamics::TimeScales inputTimeScale = basic_astrodynamics::tdb_scale,
+            const double blockDuration = physical_constants::JULIAN_DAY,
+            const double timeStep = 3600.0,
+            const int numberOfInterpolationPoints = 8,
+            const unsigned int maximumNumberOfBlocks = 8 );
+
+    //! Calculate rotation angles from ITRS to GCRS at given time value.
+    /*!
+     *  Calculate rotation angles from ITRS to GCRS at given time value, by interpolating tabulated values. If no
+     *  tabulated values are available at the requested time, a new block is generated.
+     *  \param timeValue Number of seconds since J2000 at which orientation is to be evaluated, in inputTimeScale_.
+     *  \return Rotation angles for ITRS<->GCRS transformation at given epoch. First pair entry is: X, Y, s, x_p, y_p.
+     *  Second defines UT1.
+     */
+    template< typename TimeType >
+    std::pair< Eigen::Vector5d, TimeType > getRotationAnglesFromItrsToGcrs( const TimeType timeValue )
+    {
+        // Retrieve interpolated values, and separate angles and UT1
+        Eigen::Vector6d interpolatedValues = getBlockInterpolator(
+                    static_cast< double >( timeValue ) )->interpolate( static_cast< double >( timeValue ) );
+        return std::make_pair( Eigen::Vector5d( interpolatedValues.segment( 0, 5 ) ),
+                               static_cast< TimeType >( timeValue + interpolatedValues( 5 ) ) );
+    }
+
+    //! Function to retrieve the object used to compute the Earth orientation angles when generating a new block.
+    /*!
+     *  Function to retrieve the object used to compute the Earth orientation angles when generating a new block.
+     *  \return Object used to compute the Earth orientation angles when generating a new block.
+     */
+    std::shared_ptr< EarthOrientationAnglesCalculator > getAnglesCalculator( )
+    {
+        return anglesCalculator_;
+    }
+
+    //! Function to retrieve the time scale in which input to this class is provided.
+    /*!
+     *  Function to retrieve the time scale in which input to this class is provided.
+     *  \return Time scale in which input to this class is provided.
+     */
+    basic_astrodynamics::TimeScales getInputTimeScale( )
+    {
+        return inputTimeScale_;
+    }
+
+    //! Function to retrieve the number of blocks currently retained in memory
+    /*!
+     *  Function to retrieve the number of blocks currently retained in memory
+     *  \return Number of blocks currently retained in memory
+     */
+    unsigned int getNumberOfStoredBlocks( )
+    {
+        return blockInterpolators_.size( );
+    }
+
+    //! Function to retrieve the number of blocks that has been generated since object creation.
+    /*!
+     *  Function to retrieve the number of blocks that has been generated since object creation (including those that
+     *  have since been discarded).
+     *  \return Number of blocks that has been generated since object creation.
+     */
+    unsigned int getNumberOfGeneratedBlocks( )
+    {
+        return numberOfGeneratedBlocks_;
+    }
+
+private:
+
+    //! Typedef for interpolator of single block of (X, Y, s, x_p, y_p, UT1 - input time)
+    typedef interpolators::LagrangeInterpolator< double, Eigen::Vector6d > BlockInterpolator;
+
+    //! Function to retrieve the interpolator for the block containing the given time (generated if needed)
+    /*!
+     *  Function to retrieve the interpolator for the block containing the given time. The most recently used block is
+     *  checked first. If no block is available, a new block is generated, and the least recently used block is
+     *  discarded if the maximum number of blocks is exceeded.
+     *  \param timeValue Number of seconds since J2000 at which orientation is to be evaluated, in inputTimeScale_.
+     *  \return Interpolator for the block containing the given time
+     */
+    std::shared_ptr< BlockInterpolator > getBlockInterpolator( const double timeValue )
+    {
+        int blockIndex = static_cast< int >( std::floor( timeValue / blockDuration_ ) );
+        if( blockIndex != currentBlockIndex_ || currentBlockInterpolator_ == nullptr )
+        {
+            updateCurrentBlock( blockIndex );
+        }
+        return currentBlockInterpolator_;
+    }
+
+    //! Function to set the current block to the block with given index, generating it if it is not stored.
+    /*!
+     *  Function to set the current block to the block with given index, generating it if it is not stored, and updating
+     *  the least-recently used ordering of the blocks.
+     *  \param blockIndex Index of block that is to be set as current block
+     */
+    void updateCurrentBlock( const int blockIndex );
+
+    //! Function to generate the interpolator for a single block of tabulated values
+    /*!
+     *  Function to generate the interpolator for a single block of tabulated values
+     *  \param blockIndex Index of block that is to be generated
+     *  \return Interpolator for the requested block
+     */
+    std::shared_ptr< BlockInterpolator > generateBlockInterpolator( const int blockIndex );
+
+    //! Object used to compute the Earth orientation angles when generating a new block.
+    std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator_;
+
+    //! Time scale in which input to this class is provided.
+    basic_astrodynamics::TimeScales inputTimeScale_;
+
+    //! Duration of single block of tabulated values.
+    double blockDuration_;
+
+    //! Time step between tabulated values
+    double timeStep_;
+
+    //! Number of points used in Lagrange interpolation
+    int numberOfInterpolationPoints_;
+
+    //! Maximum number of blocks that is retained in memory.
+    unsigned int maximumNumberOfBlocks_;
+
+    //! List of indices of blocks retained in memory, ordered from most to least recently used.
+    std::list< int > blockUsageOrder_;
+
+    //! Interpolators for blocks retained in memory, with block index as key.
+    std::map< int, std::shared_ptr< BlockInterpolator > > blockInterpolators_;
+
+    //! Index of block that was most recently used.
+    int currentBlockIndex_;
+
+    //! Interpolator of block that was most recently used.
+    std::shared_ptr< BlockInterpolator > currentBlockInterpolator_;
+
+    //! Number of blocks that has been generated since object creation.
+    unsigned int numberOfGeneratedBlocks_;
+
+};
+
+} // namespace earth_orientation
+
+} // namespace tudat
+
+#endif // TUDAT_TABULATEDEARTHORIENTATIONANGLESCALCULATOR_H
@@ -19,49 +19,20 @@ namespace tudat
 namespace earth_orientation
 {
 
-//! Function to get current time list at double precision
+//! Function to get cache of recent time conversions at double precision
 template< >
-CurrentTimes< double >& TerrestrialTimeScaleConverter::getCurrentTimeList< double >( )
+CurrentTimesCache< double >& TerrestrialTimeScaleConverter::getCurrentTimesCache< double >( )
 {
-    return currentTimes_;
+    return currentTimesCache_;
 }
 
-//! Function to get current time list at Time precision
+//! Function to get cache of recent time conversions at Time precision
 template< >
-CurrentTimes< Time >& TerrestrialTimeScaleConverter::getCurrentTimeList< Time >( )
+CurrentTimesCache< Time >& TerrestrialTimeScaleConverter::getCurrentTimesCache< Time >( )
 {
-    return currentTimesSplit_;
+    return currentTimesCacheSplit_;
 }
 
-//! Function to get ground station position used on last call to updateTimes function at double precision
-template< >
-Eigen::Vector3d& TerrestrialTimeScaleConverter::getPreviousGroundStationPosition< double >( )
-{
-    return previousEarthFixedPosition_;
-}
-
-//! Function to get ground station position used on last call to updateTimes function at Time precision
-template< >
-Eigen::Vector3d& TerrestrialTimeScaleConverter::getPreviousGroundStationPosition< Time >( )
-{
-    return previousEarthFixedPositionSplit_;
-}
-
-//! Function to reset ground station position used on last call to updateTimes function at double precision
-template< >
-void TerrestrialTimeScaleConverter::setCurrentGroundStation< double >( const Eigen::Vector3d& currentGroundStation )
-{
-    previousEarthFixedPosition_ = currentGroundStation;
-}
-
-//! Function to reset ground station position used on last call to updateTimes function at Time precision
-template< >
-void TerrestrialTimeScaleConverter::setCurrentGroundStation< Time >( const Eigen::Vector3d& currentGroundStation )
-{
-    previousEarthFixedPositionSplit_ = currentGroundStation;
-}
-
-
 
 //! Function to create the default Earth time scales conversion object
 std::shared_ptr< TerrestrialTimeScaleConverter > createDefaultTimeConverter( const std::shared_ptr< EOPReader > eopReader )
@@ -39,7 +39,7 @@ struct CurrentTimes
      * \param requestedScale Time scale for which time is to be returned
      * \return Current time in requested scale.
      */
-    TimeType getTimeValue( basic_astrodynamics::TimeScales requestedScale )
+    TimeType getTimeValue( basic_astrodynamics::TimeScales requestedScale ) const
     {
         TimeType valueToReturn = -0.0;
         switch( requestedScale )
@@ -82,6 +82,110 @@ struct CurrentTimes
 
 };
 
+//! Data structure to save the current time in several time scales for a limited number of recent epochs/positions
+/*!
+ *  Data structure to save the current time in several time scales for a limited number of recent epochs/positions, so
+ *  that repeated conversions at a small number of alternating epochs (for instance at the stages of a single
+ *  integration step, or at the transmission/reception times of an observation) do not require repeated computations.
+ *  When a new entry is added to a full cache, the oldest entry is overwritten.
+ */
+template< typename TimeType >
+struct CurrentTimesCache
+{
+    //! Number of epochs/positions that are retained
+    static const unsigned int NUMBER_OF_ENTRIES = 4;
+
+    //! Default constructor
+    CurrentTimesCache( ):currentEntry_( 0 ), numberOfFilledEntries_( 0 )
+    {
+        for( unsigned int i = 0; i < NUMBER_OF_ENTRIES; i++ )
+        {
+            earthFixedPositions_[ i ].setZero( );
+        }
+    }
+
+    //! Function to find the entry in which the time in a given scale and the Earth-fixed position are as requested.
+    /*!
+     *  Function to find the entry in which the time in a given scale and the Earth-fixed position are as requested. If found,
+     *  this entry is set as the current entry.
+     *  \param inputScale Time scale of inputTimeValue.
+     *  \param inputTimeValue Time value that is to be found in cache.
+     *  \param earthFixedPosition Earth-fixed position at which time conversions are to be evaluated
+     *  \return True if entry is found, false otherwise
+     */
+    bool findEntry( const basic_astrodynamics::TimeScales inputScale, const TimeType& inputTimeValue,
+                    const Eigen::Vector3d& earthFixedPosition )
+    {
+        bool entryIsFound = false;
+
+        // Check current entry first, then any previous entries.
+        for( unsigned int i = 0; i < numberOfFilledEntries_; i++ )
+        {
+            unsigned int entryToCheck = ( currentEntry_ + NUMBER_OF_ENTRIES - i ) % NUMBER_OF_ENTRIES;
+            if( ( times_[ entryToCheck ].getTimeValue( inputScale ) == inputTimeValue ) &&
+                    ( earthFixedPositions_[ entryToCheck ] == earthFixedPosition ) )
+            {
+                currentEntry_ = entryToCheck;
+                entryIsFound = true;
+                break;
+            }
+        }
+        return entryIsFound;
+    }
+
+    //! Function to add a new entry to the cache (overwriting the oldest entry if needed) and set it as current.
+    /*!
+     *  Function to add a new entry to the cache (overwriting the oldest entry if needed) and set it as current. Times in
+     *  new entry are not set by this function.
+     *  \param earthFixedPosition Earth-fixed position at which time conversions of new entry are to be evaluated
+     *  \return Time values of new entry, to be set by calling function
+     */
+    CurrentTimes< TimeType >& addEntry( const Eigen::Vector3d& earthFixedPosition )
+    {
+        if( numberOfFilledEntries_ > 0 )
+        {
+            currentEntry_ = ( currentEntry_ + 1 ) % NUMBER_OF_ENTRIES;
+        }
+        if( numberOfFilledEntries_ < NUMBER_OF_ENTRIES )
+        {
+            numberOfFilledEntries_++;
+        }
+        earthFixedPositions_[ currentEntry_ ] = earthFixedPosition;
+        return times_[ currentEntry_ ];
+    }
+
+    //! Function to remove all entries from cache.
+    void clear( )
+    {
+        numberOfFilledEntries_ = 0;
+        currentEntry_ = 0;
+    }
+
+    //! Function to retrieve current times of current entry.
+    /*!
+     *  Function to retrieve current times of current entry (i.e. most recently found or added entry).
+     *  \return Current times of current entry
+     */
+    CurrentTimes< TimeType >& getCurrentTimes( )
+    {
+        return times_[ currentEntry_ ];
+    }
+
+private:
+
+    //! Current times in each entry
+    CurrentTimes< TimeType > times_[ NUMBER_OF_ENTRIES ];
+
+    //! Earth-fixed position used for each entry.
+    Eigen::Vector3d earthFixedPositions_[ NUMBER_OF_ENTRIES ];
+
+    //! Index of current entry
+    unsigned int currentEntry_;
+
+    //! Number of entries that have been set since creation/clearing of cache.
+    unsigned int numberOfFilledEntries_;
+};
+
 //! Class used to convert between terrestrial time scales TAI, TT, TDB, UTC ans UT1
 class TerrestrialTimeScaleConverter
 {
@@ -102,8 +206,7 @@ public:
             const std::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< double > >
             shortPeriodUt1CorrectionCalculator = getDefaultUT1CorrectionCalculator( ) ):
         dailyUtcUt1CorrectionInterpolator_( dailyUtcUt1CorrectionInterpolator ),
-        shortPeriodUt1CorrectionCalculator_( shortPeriodUt1CorrectionCalculator ),
-        previousEarthFixedPosition_( Eigen::Vector3d::Zero( ) )
+        shortPeriodUt1CorrectionCalculator_( shortPeriodUt1CorrectionCalculator )
     { }
 
     //! Function to convert a time value from the input to the output scale.
@@ -130,33 +233,46 @@ public:
         }
         else
         {
-            // Check if update is required
-            if( !( static_cast< TimeType >( getCurrentTimeList< TimeType >( ).getTimeValue( inputScale ) ) ==
-                   static_cast< TimeType >( inputTimeValue ) ) ||
-                    !( getPreviousGroundStationPosition< TimeType >( ) == earthFixedPosition ) )
-            {
-                updateTimes< TimeType >( inputScale, inputTimeValue, earthFixedPosition );
-            }
-            convertedTime = getCurrentTimeList< TimeType >( ).getTimeValue( outputScale );
+            convertedTime = getCurrentTimes< TimeType >( inputScale, inputTimeValue, earthFixedPosition ).getTimeValue(
+                        outputScale );
         }
         return convertedTime;
     }
 
-    //! Function to reset all current times at given precision to NaN.
+    //! Function to convert a time value from the input scale to all other scales in a single pass.
+    /*!
+     *  This function converts a time value from the input scale to all other scales (TAI, TT, TDB, UTC, UT1), with all
+     *  intermediate values computed only once. Conversions for a limited number of recent input epochs/positions are
+     *  retained, so that repeated calls for the same input do not require any recomputation.
+     *  \param inputScale Time scale of inputTimeValue.
+     *  \param inputTimeValue Time value that is to be converted.
+     *  \param earthFixedPosition Earth-fixed position at which time conversions are to be evaluated
+     *  \return Time values in all time scales
+     */
+    template< typename TimeType >
+    CurrentTimes< TimeType > getCurrentTimes(
+            const basic_astrodynamics::TimeScales inputScale, const TimeType& inputTimeValue,
+            const Eigen::Vector3d& earthFixedPosition = Eigen::Vector3d::Zero( ) )
+    {
+        // Check if update is required
+        if( !getCurrentTimesCache< TimeType >( ).findEntry( inputScale, inputTimeValue, earthFixedPosition ) )
+        {
+            updateTimes< TimeType >( inputScale, inputTimeValue, earthFixedPosition );
+        }
+        return getCurrentTimesCache< TimeType >( ).getCurrentTimes( );
+    }
+
+    //! Function to reset all current times at given precision (i.e. clear cache of previous conversions).
     template< typename TimeType >
     void resetTimes( )
     {
-        CurrentTimes< TimeType >& timesToUpdate = getCurrentTimeList< TimeType >( );
-        timesToUpdate.tai = TUDAT_NAN;
-        timesToUpdate.tt = TUDAT_NAN;
-        timesToUpdate.tdb = TUDAT_NAN;
-        timesToUpdate.ut1 = TUDAT_NAN;
-        timesToUpdate.utc = TUDAT_NAN;
+        getCurrentTimesCache< TimeType >( ).clear( );
     }
 
     //! Function to recalculate time-values at all time scales from given unput values.
     /*!
-     * Function to recalculate time-values at all time scales from given unput values.
+     * Function to recalculate time-values at all time scales from given unput values. The results are added to the cache
+     * of previous conversions.
      *  \param inputScale Time scale of inputTimeValue.
      *  \param inputTimeValue Time value from which there is to be converted.
      *  \param earthFixedPosition Earth-fixed position at which time conversions are to be evaluated
@@ -166,10 +282,9 @@ public:
                       const Eigen::Vector3d& earthFixedPosition )
     {
         // Retrieve CurrentTimes object that is to be updated
-        CurrentTimes< TimeType >& timesToUpdate = getCurrentTimeList< TimeType >( );
+        CurrentTimes< TimeType >& timesToUpdate = getCurrentTimesCache< TimeType >( ).addEntry( earthFixedPosition );
 
         // Convert position to SOFA input valies
-        setCurrentGroundStation< TimeType >( earthFixedPosition );
 
         double siteLongitude = std::atan2( earthFixedPosition.y( ), earthFixedPosition.x( ) );
         double distanceFromSpinAxis = std::sqrt( earthFixedPosition.x( ) * earthFixedPosition.x( ) +
@@ -188,7 +303,7 @@ public:
             timesToUpdate.tt = timesToUpdate.tdb - tdbMinusTt;
             timesToUpdate.tai = basic_astrodynamics::convertTTtoTAI< TimeType >( timesToUpdate.tt );
 
-            calculateUniversalTimes< TimeType >( );
+            calculateUniversalTimes< TimeType >( timesToUpdate );
             break;
 
         case basic_astrodynamics::tt_scale:
@@ -198,7 +313,7 @@ public:
             timesToUpdate.tdb = timesToUpdate.tt + tdbMinusTt;
             timesToUpdate.tai = basic_astrodynamics::convertTTtoTAI< TimeType >( timesToUpdate.tt );
 
-            calculateUniversalTimes< TimeType >( );
+            calculateUniversalTimes< TimeType >( timesToUpdate );
             break;
 
         case basic_astrodynamics::tai_scale:
@@ -208,7 +323,7 @@ public:
                         timesToUpdate.tt, siteLongitude, distanceFromSpinAxis, distanceFromEquatorialPlane ) );
             timesToUpdate.tdb = timesToUpdate.tt + tdbMinusTt;
 
-            calculateUniversalTimes< TimeType >( );
+            calculateUniversalTimes< TimeType >( timesToUpdate );
 
             break;
         case basic_astrodynamics::utc_scale:
@@ -264,11 +379,10 @@ public:
             const basic_astrodynamics::TimeScales inputScale, const TimeType& inputTimeValue,
             const Eigen::Vector3d currentPosition = Eigen::Vector3d::Zero( ) )
     {
-        TimeType currentUtc = getCurrentTime( inputScale, basic_astrodynamics::utc_scale, inputTimeValue, currentPosition );
-        TimeType currentTt = getCurrentTime( inputScale, basic_astrodynamics::tt_scale, inputTimeValue, currentPosition );
+        CurrentTimes< TimeType > currentTimes = getCurrentTimes( inputScale, inputTimeValue, currentPosition );
 
-        return dailyUtcUt1CorrectionInterpolator_->interpolate( currentUtc ) +
-                shortPeriodUt1CorrectionCalculator_->getCorrections( currentTt );
+        return dailyUtcUt1CorrectionInterpolator_->interpolate( currentTimes.utc ) +
+                shortPeriodUt1CorrectionCalculator_->getCorrections( currentTimes.tt );
 
     }
 
@@ -280,43 +394,29 @@ public:
 
 private:
 
-    //! Function to get current time list at requested numerical precision
+    //! Function to get cache of recent time conversions at requested numerical precision
     /*!
-     *  Function to get current time list at requested numerical precision
-     *  \return Current time list at requested numerical precision
+     *  Function to get cache of recent time conversions at requested numerical precision
+     *  \return Cache of recent time conversions at requested numerical precision
      */
     template< typename TimeType >
-    CurrentTimes< TimeType >& getCurrentTimeList( );
+    CurrentTimesCache< TimeType >& getCurrentTimesCache( );
 
-    //! Function to get ground station position used on last call to updateTimes function at requested numerical precision
+    //! Function to update the universal times (UT1 and UTC) from TAI and TT in CurrentTimes object at requested precision
     /*!
-     * Function to get ground station position used on last call to updateTimes function at requested numerical precision
-     *  \return Ground station position used on last call to updateTimes function at requested numerical precision
+     *  Function to update the universal times (UT1 and UTC) from TAI and TT in CurrentTimes object at requested precision
+     *  \param timesToUpdate Object in which TAI and TT have been set, and in which UTC and UT1 are to be set.
      */
     template< typename TimeType >
-    Eigen::Vector3d& getPreviousGroundStationPosition( );
-
-    //! Function to reset ground station position used on last call to updateTimes function at requested numerical precision
-    /*!
-     * Function to reset ground station position used on last call to updateTimes function at requested numerical precision
-     *  \return Ground station position used on last call to updateTimes function at requested numerical precision
-     */
-    template< typename TimeType >
-    void setCurrentGroundStation( const Eigen::Vector3d& currentGroundStation );
-
-    //! Function to update the universal times (UT1 and UTC) in CurrentTimes member at requested precision
-    template< typename TimeType >
-    void calculateUniversalTimes( )
+    void calculateUniversalTimes( CurrentTimes< TimeType >& timesToUpdate )
     {
-        getCurrentTimeList< TimeType >( ).utc = sofa_interface::convertTAItoUTC< TimeType >(
-                    getCurrentTimeList< TimeType >( ).tai );
+        timesToUpdate.utc = sofa_interface::convertTAItoUTC< TimeType >( timesToUpdate.tai );
 
-        getCurrentTimeList< TimeType >( ).ut1 = static_cast< TimeType >( dailyUtcUt1CorrectionInterpolator_->interpolate(
-                    getCurrentTimeList< TimeType >( ).utc ) ) + getCurrentTimeList< TimeType >( ).utc;
+        timesToUpdate.ut1 = static_cast< TimeType >( dailyUtcUt1CorrectionInterpolator_->interpolate(
+                    timesToUpdate.utc ) ) + timesToUpdate.utc;
 
-        getCurrentTimeList< TimeType >( ).ut1 +=
-                static_cast< TimeType >( shortPeriodUt1CorrectionCalculator_->getCorrections(
-                    getCurrentTimeList< TimeType >( ).tt ) );
+        timesToUpdate.ut1 += static_cast< TimeType >( shortPeriodUt1CorrectionCalculator_->getCorrections(
+                                                           timesToUpdate.tt ) );
     }
 
     //! Interpolator for UT1 corrections, values published daily by IERS
@@ -326,17 +426,11 @@ private:
     //! Object to compute the short-period variations in UT1
     std::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< double > > shortPeriodUt1CorrectionCalculator_;
 
-    //! Object containing current times, as set by last updateTimes< double > function.
-    CurrentTimes< double > currentTimes_;
-
-    //! Object containing current times, as set by last updateTimes< Time > function.
-    CurrentTimes< Time > currentTimesSplit_;
-
-    //! Value of ground station position used on last call to updateTimes< double > function
-    Eigen::Vector3d previousEarthFixedPosition_;
+    //! Object containing recent time conversions, as set by updateTimes< double > function.
+    CurrentTimesCache< double > currentTimesCache_;
 
-    //! Value of ground station position used on last call to updateTimes< Time > function
-    Eigen::Vector3d previousEarthFixedPositionSplit_;
+    //! Object containing recent time conversions, as set by updateTimes< Time > function.
+    CurrentTimesCache< Time > currentTimesCacheSplit_;
 };
 
 //! Function to create the default Earth time scales conversion object
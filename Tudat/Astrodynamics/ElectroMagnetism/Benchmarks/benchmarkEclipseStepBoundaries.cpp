@@ -0,0 +1,71 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmark comparing the number of rejected steps, number of function evaluations and position error of RKF7(8)
+ *      propagation of a shadowed orbit across 5 eclipses, with and without eclipse times imposed as step boundaries.
+ *      Only built if BUILD_BENCHMARKS is set.
+ */
+
+#include <cstdlib>
+#include <iostream>
+
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Astrodynamics/ElectroMagnetism/UnitTests/shadowedOrbitIntegration.h"
+
+int main( )
+{
+    using namespace tudat;
+    using namespace tudat::electro_magnetism;
+    using namespace tudat::unit_tests;
+
+    const double orbitRadius = 7.0E6;
+    const double orbitalPeriod = 2.0 * mathematical_constants::PI *
+            std::sqrt( std::pow( orbitRadius, 3.0 ) / earthGravitationalParameter );
+    const double endTime = 5.0 * orbitalPeriod;
+
+    // Precompute eclipse events on (unperturbed) reference trajectory.
+    std::vector< EclipseEvent > eclipseEvents = findEclipseEvents(
+                std::bind( &getCircularOrbitPosition, std::placeholders::_1, orbitRadius ),
+                [ = ]( const double ){ return sunPosition; },
+                sunRadius, { [ = ]( const double ){ return Eigen::Vector3d::Zero( ).eval( ); } }, { earthRadius },
+                0.0, endTime, 60.0, 1.0E-6 );
+
+    // Compute reference solution, using small step size and tight tolerances
+    Eigen::VectorXd referenceFinalState;
+    int referenceEvaluations;
+    integrateShadowedOrbit( endTime, getEclipseEventTimes( eclipseEvents ), 1.0E-14, 5.0,
+                            referenceFinalState, referenceEvaluations );
+
+    std::cout << "RKF7(8) propagation across " << eclipseEvents.size( ) / 4 << " eclipses" << std::endl;
+
+    for( double tolerance: { 1.0E-10, 1.0E-12 } )
+    {
+        // Propagate with and without eclipse times imposed as step boundaries
+        Eigen::VectorXd finalStateWithoutBoundaries, finalStateWithBoundaries;
+        int evaluationsWithoutBoundaries, evaluationsWithBoundaries;
+        const int rejectedStepsWithoutBoundaries = integrateShadowedOrbit(
+                    endTime, std::vector< double >( ), tolerance, 600.0,
+                    finalStateWithoutBoundaries, evaluationsWithoutBoundaries );
+        const int rejectedStepsWithBoundaries = integrateShadowedOrbit(
+                    endTime, getEclipseEventTimes( eclipseEvents ), tolerance, 600.0,
+                    finalStateWithBoundaries, evaluationsWithBoundaries );
+
+        std::cout << "  Tolerance " << tolerance << std::endl
+                  << "    without eclipse step boundaries: " << rejectedStepsWithoutBoundaries << " rejected steps, "
+                  << evaluationsWithoutBoundaries << " function evaluations, position error "
+                  << ( finalStateWithoutBoundaries - referenceFinalState ).segment( 0, 3 ).norm( ) << " m"
+                  << std::endl
+                  << "    with eclipse step boundaries:    " << rejectedStepsWithBoundaries << " rejected steps, "
+                  << evaluationsWithBoundaries << " function evaluations, position error "
+                  << ( finalStateWithBoundaries - referenceFinalState ).segment( 0, 3 ).norm( ) << " m" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
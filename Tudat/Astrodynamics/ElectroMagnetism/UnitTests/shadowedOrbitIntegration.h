@@ -0,0 +1,102 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_SHADOWED_ORBIT_INTEGRATION_H
+#define TUDAT_SHADOWED_ORBIT_INTEGRATION_H
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/missionGeometry.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/ElectroMagnetism/eclipseEvents.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+const double sunRadius = 6.96E8;
+const double earthRadius = 6.378137E6;
+const double earthGravitationalParameter = 3.986004418E14;
+const Eigen::Vector3d sunPosition = Eigen::Vector3d( physical_constants::ASTRONOMICAL_UNIT, 0.0, 0.0 );
+
+//! Function returning position on circular equatorial orbit around the Earth
+inline Eigen::Vector3d getCircularOrbitPosition( const double time, const double orbitRadius )
+{
+    const double meanMotion = std::sqrt( earthGravitationalParameter / std::pow( orbitRadius, 3.0 ) );
+    return orbitRadius * Eigen::Vector3d( std::cos( meanMotion * time ), std::sin( meanMotion * time ), 0.0 );
+}
+
+//! Function to compute state derivative of orbit around the Earth, perturbed by (strongly exaggerated) cannonball
+//! radiation pressure with Earth shadow.
+inline Eigen::VectorXd computeShadowedOrbitStateDerivative( const double, const Eigen::VectorXd& state,
+                                                            int& numberOfFunctionEvaluations )
+{
+    numberOfFunctionEvaluations++;
+
+    const Eigen::Vector3d position = state.segment( 0, 3 );
+    const Eigen::Vector3d sunDirection = ( sunPosition - position ).normalized( );
+    const double radiationPressureAcceleration = 1.0E-5 * mission_geometry::computeMultipleOccultationShadowFunction(
+                sunPosition, sunRadius, { Eigen::Vector3d::Zero( ) }, { earthRadius }, position );
+
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd( 6 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -earthGravitationalParameter * position / std::pow( position.norm( ), 3.0 )
+            - radiationPressureAcceleration * sunDirection;
+    return stateDerivative;
+}
+
+//! Function to integrate shadowed orbit with RKF7(8) integrator, returning number of rejected steps
+inline int integrateShadowedOrbit( const double endTime, const std::vector< double >& forcedStepBoundaries,
+                                   const double tolerance, const double maximumStepSize,
+                                   Eigen::VectorXd& finalState, int& numberOfFunctionEvaluations )
+{
+    const double orbitRadius = 7.0E6;
+    const Eigen::VectorXd initialState = ( Eigen::VectorXd( 6 ) << orbitRadius, 0.0, 0.0, 0.0,
+                                           std::sqrt( earthGravitationalParameter / orbitRadius ), 0.0 ).finished( );
+
+    std::shared_ptr< numerical_integrators::RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >
+            integratorSettings = std::make_shared< numerical_integrators::
+            RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                0.0, 60.0, numerical_integrators::RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                1.0E-4, maximumStepSize, tolerance, tolerance );
+    integratorSettings->setForcedStepBoundaries( forcedStepBoundaries );
+
+    numberOfFunctionEvaluations = 0;
+    std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd, double > >
+            integrator = numerical_integrators::createIntegrator< double, Eigen::VectorXd, double >(
+                std::bind( &computeShadowedOrbitStateDerivative, std::placeholders::_1, std::placeholders::_2,
+                           std::ref( numberOfFunctionEvaluations ) ), initialState, integratorSettings );
+
+    double timeStep = integratorSettings->initialTimeStep_;
+    while( integrator->getCurrentIndependentVariable( ) < endTime )
+    {
+        integrator->performIntegrationStep(
+                    std::min( timeStep, endTime - integrator->getCurrentIndependentVariable( ) ) );
+        timeStep = integrator->getNextStepSize( );
+    }
+    finalState = integrator->getCurrentState( );
+
+    return std::dynamic_pointer_cast< numerical_integrators::RungeKuttaVariableStepSizeIntegrator<
+            double, Eigen::VectorXd, Eigen::VectorXd, double > >( integrator )->getNumberOfRejectedSteps( );
+}
+
+} // namespace unit_tests
+
+} // namespace tudat
+
+#endif // TUDAT_SHADOWED_ORBIT_INTEGRATION_H
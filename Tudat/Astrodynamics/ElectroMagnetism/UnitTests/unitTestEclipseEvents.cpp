@@ -0,0 +1,248 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/missionGeometry.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/ElectroMagnetism/eclipseEvents.h"
+#include "Tudat/Astrodynamics/ElectroMagnetism/UnitTests/shadowedOrbitIntegration.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_eclipse_events )
+
+using namespace mission_geometry;
+using namespace electro_magnetism;
+
+//! Test shadow function computation with multiple concurrent (and oblate) occulting bodies.
+BOOST_AUTO_TEST_CASE( testMultipleOccultationShadowFunction )
+{
+    // Satellite in penumbra behind Earth (Earth at origin).
+    const Eigen::Vector3d satellitePosition( -7.0E6, earthRadius + 1.0E3, 0.0 );
+    const double singleShadowFunction = computeShadowFunction(
+                sunPosition, sunRadius, Eigen::Vector3d::Zero( ), earthRadius, satellitePosition );
+    BOOST_CHECK( singleShadowFunction > 0.0 && singleShadowFunction < 1.0 );
+
+    // Check that result for single occulting body is equal to existing shadow function
+    BOOST_CHECK_SMALL( computeMultipleOccultationShadowFunction(
+                           sunPosition, sunRadius, { Eigen::Vector3d::Zero( ) }, { earthRadius }, satellitePosition ) -
+                       singleShadowFunction, 1.0E-9 );
+
+    // Check that an occulting body that does not occult has no influence
+    BOOST_CHECK_SMALL( computeMultipleOccultationShadowFunction(
+                           sunPosition, sunRadius, { Eigen::Vector3d::Zero( ), Eigen::Vector3d( 0.0, 0.0, 4.0E8 ) },
+                           { earthRadius, 1.7374E6 }, satellitePosition ) - singleShadowFunction, 1.0E-9 );
+
+    // Check that total occultation by any body results in zero shadow function
+    BOOST_CHECK_EQUAL( computeMultipleOccultationShadowFunction(
+                           sunPosition, sunRadius, { Eigen::Vector3d( 0.0, 0.0, 4.0E8 ), Eigen::Vector3d::Zero( ) },
+                           { 1.7374E6, earthRadius }, Eigen::Vector3d( -7.0E6, 0.0, 0.0 ) ), 0.0 );
+
+    // Check that occulting body beyond the source does not occult.
+    BOOST_CHECK_EQUAL( computeMultipleOccultationShadowFunction(
+                           sunPosition, sunRadius, { 2.0 * sunPosition }, { 10.0 * sunRadius },
+                           Eigen::Vector3d( -7.0E6, 0.0, 0.0 ) ), 1.0 );
+
+    // Place two occulting bodies at opposite sides of the solar disk, such that their disks do not overlap: occulted
+    // fractions should be additive.
+    const double occultingBodyDistance = 1.0E6;
+    const double occultingBodyRadius = 2.0E3;
+    const double apparentSunRadius = std::asin( sunRadius / physical_constants::ASTRONOMICAL_UNIT );
+    const double apparentSeparation = apparentSunRadius;
+    const Eigen::Vector3d firstOccultingBodyPosition =
+            occultingBodyDistance * Eigen::Vector3d( std::cos( apparentSeparation ), std::sin( apparentSeparation ), 0.0 );
+    const Eigen::Vector3d secondOccultingBodyPosition =
+            occultingBodyDistance * Eigen::Vector3d( std::cos( apparentSeparation ), 0.0, -std::sin( apparentSeparation ) );
+    const double firstShadowFunction = computeShadowFunction(
+                sunPosition, sunRadius, firstOccultingBodyPosition, occultingBodyRadius, Eigen::Vector3d::Zero( ) );
+    const double secondShadowFunction = computeShadowFunction(
+                sunPosition, sunRadius, secondOccultingBodyPosition, 1.5 * occultingBodyRadius, Eigen::Vector3d::Zero( ) );
+    BOOST_CHECK( firstShadowFunction < 1.0 && secondShadowFunction < firstShadowFunction );
+
+    const double disjointShadowFunction = computeMultipleOccultationShadowFunction(
+                sunPosition, sunRadius, { firstOccultingBodyPosition, secondOccultingBodyPosition },
+                { occultingBodyRadius, 1.5 * occultingBodyRadius }, Eigen::Vector3d::Zero( ) );
+    BOOST_CHECK_SMALL( disjointShadowFunction - ( firstShadowFunction + secondShadowFunction - 1.0 ), 1.0E-12 );
+
+    // Place two identical occulting bodies at the same apparent position: result should be equal to single occultation
+    // (up to quadrature error), where simply multiplying shadow functions would double the occulted area.
+    const Eigen::Vector3d thirdOccultingBodyPosition = 2.0 * firstOccultingBodyPosition;
+    const double coincidentShadowFunction = computeMultipleOccultationShadowFunction(
+                sunPosition, sunRadius, { firstOccultingBodyPosition, thirdOccultingBodyPosition },
+                { occultingBodyRadius, 2.0 * occultingBodyRadius }, Eigen::Vector3d::Zero( ) );
+    const double accurateCoincidentShadowFunction = computeMultipleOccultationShadowFunction(
+                sunPosition, sunRadius, { firstOccultingBodyPosition, thirdOccultingBodyPosition },
+                { occultingBodyRadius, 2.0 * occultingBodyRadius }, Eigen::Vector3d::Zero( ),
+                std::vector< double >( ), std::vector< Eigen::Vector3d >( ), 256 );
+    BOOST_CHECK_SMALL( coincidentShadowFunction - firstShadowFunction, 2.0E-3 );
+    BOOST_CHECK_SMALL( accurateCoincidentShadowFunction - firstShadowFunction, 1.0E-4 );
+
+    // Check that zero flattening reproduces spherical result.
+    BOOST_CHECK_SMALL( computeMultipleOccultationShadowFunction(
+                           sunPosition, sunRadius, { Eigen::Vector3d::Zero( ) }, { earthRadius }, satellitePosition,
+                           { 0.0 }, { Eigen::Vector3d::UnitZ( ) } ) - singleShadowFunction, 1.0E-9 );
+
+    // Check that flattening has no influence for geometry in equatorial plane.
+    const double earthFlattening = 1.0 / 298.257223563;
+    BOOST_CHECK_SMALL( computeMultipleOccultationShadowFunction(
+                           sunPosition, sunRadius, { Eigen::Vector3d::Zero( ) }, { earthRadius }, satellitePosition,
+                           { earthFlattening }, { Eigen::Vector3d::UnitZ( ) } ) - singleShadowFunction, 1.0E-9 );
+
+    // Check that flattening reduces shadow for satellite behind the polar region, and is equal to shadow function of a
+    // spherical body with polar radius.
+    const Eigen::Vector3d polarSatellitePosition( -7.0E6, 0.0, earthRadius * ( 1.0 - earthFlattening ) + 1.0E3 );
+    const double oblateShadowFunction = computeMultipleOccultationShadowFunction(
+                sunPosition, sunRadius, { Eigen::Vector3d::Zero( ) }, { earthRadius }, polarSatellitePosition,
+                { earthFlattening }, { Eigen::Vector3d::UnitZ( ) } );
+    const double sphericalShadowFunction = computeMultipleOccultationShadowFunction(
+                sunPosition, sunRadius, { Eigen::Vector3d::Zero( ) }, { earthRadius }, polarSatellitePosition );
+    const double polarRadiusShadowFunction = computeMultipleOccultationShadowFunction(
+                sunPosition, sunRadius, { Eigen::Vector3d::Zero( ) }, { earthRadius * ( 1.0 - earthFlattening ) },
+                polarSatellitePosition );
+    BOOST_CHECK( oblateShadowFunction > sphericalShadowFunction && oblateShadowFunction < 1.0 );
+    BOOST_CHECK_SMALL( oblateShadowFunction - polarRadiusShadowFunction, 5.0E-2 );
+}
+
+//! Test detection of eclipse entry and exit times along a circular orbit.
+BOOST_AUTO_TEST_CASE( testEclipseEventDetection )
+{
+    const double orbitRadius = 7.0E6;
+    const double orbitalPeriod = 2.0 * mathematical_constants::PI *
+            std::sqrt( std::pow( orbitRadius, 3.0 ) / earthGravitationalParameter );
+
+    std::function< Eigen::Vector3d( const double ) > satellitePositionFunction =
+            std::bind( &getCircularOrbitPosition, std::placeholders::_1, orbitRadius );
+    std::function< Eigen::Vector3d( const double ) > sunPositionFunction =
+            [ = ]( const double ){ return sunPosition; };
+    std::function< Eigen::Vector3d( const double ) > earthPositionFunction =
+            [ = ]( const double ){ return Eigen::Vector3d::Zero( ).eval( ); };
+
+    const double timeTolerance = 1.0E-4;
+    std::vector< EclipseEvent > eclipseEvents = findEclipseEvents(
+                satellitePositionFunction, sunPositionFunction, sunRadius, { earthPositionFunction }, { earthRadius },
+                0.0, 2.0 * orbitalPeriod, 60.0, timeTolerance );
+
+    // Check number and order of events
+    BOOST_CHECK_EQUAL( eclipseEvents.size( ), 8 );
+    for( unsigned int i = 0; i < eclipseEvents.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( eclipseEvents.at( i ).eventType_, static_cast< EclipseEventType >( i % 4 ) );
+        BOOST_CHECK_EQUAL( eclipseEvents.at( i ).occultingBodyIndex_, 0 );
+
+        // Check shadow function just before and after event.
+        const double timeOffset = 10.0 * timeTolerance;
+        const double shadowBeforeEvent = computeMultipleOccultationShadowFunction(
+                    sunPosition, sunRadius, { Eigen::Vector3d::Zero( ) }, { earthRadius },
+                    satellitePositionFunction( eclipseEvents.at( i ).time_ - timeOffset ) );
+        const double shadowAfterEvent = computeMultipleOccultationShadowFunction(
+                    sunPosition, sunRadius, { Eigen::Vector3d::Zero( ) }, { earthRadius },
+                    satellitePositionFunction( eclipseEvents.at( i ).time_ + timeOffset ) );
+        switch( eclipseEvents.at( i ).eventType_ )
+        {
+        case penumbra_entry:
+            BOOST_CHECK_EQUAL( shadowBeforeEvent, 1.0 );
+            BOOST_CHECK( shadowAfterEvent < 1.0 );
+            break;
+        case umbra_entry:
+            BOOST_CHECK( shadowBeforeEvent > 0.0 );
+            BOOST_CHECK_EQUAL( shadowAfterEvent, 0.0 );
+            break;
+        case umbra_exit:
+            BOOST_CHECK_EQUAL( shadowBeforeEvent, 0.0 );
+            BOOST_CHECK( shadowAfterEvent > 0.0 );
+            break;
+        case penumbra_exit:
+            BOOST_CHECK( shadowBeforeEvent < 1.0 );
+            BOOST_CHECK_EQUAL( shadowAfterEvent, 1.0 );
+            break;
+        }
+    }
+
+    // Check that eclipses are symmetric w.r.t. anti-solar point, and are repeated every orbit.
+    const double antiSolarPointTime = 0.5 * orbitalPeriod;
+    BOOST_CHECK_SMALL( ( eclipseEvents.at( 0 ).time_ + eclipseEvents.at( 3 ).time_ ) / 2.0 - antiSolarPointTime,
+                       10.0 * timeTolerance );
+    BOOST_CHECK_SMALL( ( eclipseEvents.at( 1 ).time_ + eclipseEvents.at( 2 ).time_ ) / 2.0 - antiSolarPointTime,
+                       10.0 * timeTolerance );
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        BOOST_CHECK_SMALL( eclipseEvents.at( i + 4 ).time_ - eclipseEvents.at( i ).time_ - orbitalPeriod,
+                           10.0 * timeTolerance );
+    }
+
+    std::vector< double > eclipseEventTimes = getEclipseEventTimes( eclipseEvents );
+    BOOST_CHECK_EQUAL( eclipseEventTimes.size( ), eclipseEvents.size( ) );
+    BOOST_CHECK( std::is_sorted( eclipseEventTimes.begin( ), eclipseEventTimes.end( ) ) );
+}
+
+//! Compare the number of rejected integration steps for propagation across eclipses, with and without eclipse times
+//! imposed as step boundaries.
+BOOST_AUTO_TEST_CASE( testEclipseStepBoundaries )
+{
+    const double orbitRadius = 7.0E6;
+    const double orbitalPeriod = 2.0 * mathematical_constants::PI *
+            std::sqrt( std::pow( orbitRadius, 3.0 ) / earthGravitationalParameter );
+    const double endTime = 5.0 * orbitalPeriod;
+
+    // Precompute eclipse events on (unperturbed) reference trajectory.
+    std::vector< EclipseEvent > eclipseEvents = findEclipseEvents(
+                std::bind( &getCircularOrbitPosition, std::placeholders::_1, orbitRadius ),
+                [ = ]( const double ){ return sunPosition; },
+                sunRadius, { [ = ]( const double ){ return Eigen::Vector3d::Zero( ).eval( ); } }, { earthRadius },
+                0.0, endTime, 60.0, 1.0E-6 );
+    BOOST_CHECK_EQUAL( eclipseEvents.size( ), 20 );
+
+    // Compute reference solution, using small step size and tight tolerances
+    Eigen::VectorXd referenceFinalState;
+    int referenceEvaluations;
+    integrateShadowedOrbit( endTime, getEclipseEventTimes( eclipseEvents ), 1.0E-14, 5.0,
+                            referenceFinalState, referenceEvaluations );
+
+    std::vector< double > tolerances = { 1.0E-10, 1.0E-12 };
+    for( unsigned int i = 0; i < tolerances.size( ); i++ )
+    {
+        // Propagate with and without eclipse times imposed as step boundaries
+        Eigen::VectorXd finalStateWithoutBoundaries, finalStateWithBoundaries;
+        int evaluationsWithoutBoundaries, evaluationsWithBoundaries;
+        const int rejectedStepsWithoutBoundaries = integrateShadowedOrbit(
+                    endTime, std::vector< double >( ), tolerances.at( i ), 600.0,
+                    finalStateWithoutBoundaries, evaluationsWithoutBoundaries );
+        const int rejectedStepsWithBoundaries = integrateShadowedOrbit(
+                    endTime, getEclipseEventTimes( eclipseEvents ), tolerances.at( i ), 600.0,
+                    finalStateWithBoundaries, evaluationsWithBoundaries );
+
+        const double positionErrorWithoutBoundaries =
+                ( finalStateWithoutBoundaries - referenceFinalState ).segment( 0, 3 ).norm( );
+        const double positionErrorWithBoundaries =
+                ( finalStateWithBoundaries - referenceFinalState ).segment( 0, 3 ).norm( );
+
+        // Check that stepping exactly to shadow boundaries results in fewer rejected steps, and a more accurate solution
+        BOOST_CHECK( rejectedStepsWithBoundaries <= rejectedStepsWithoutBoundaries );
+        BOOST_CHECK( positionErrorWithBoundaries < positionErrorWithoutBoundaries );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
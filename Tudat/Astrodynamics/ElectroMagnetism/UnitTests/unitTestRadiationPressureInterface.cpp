@@ -19,6 +19,7 @@
 
 #include <Eigen/Core>
 
+#include "Tudat/Astrodynamics/BasicAstrodynamics/missionGeometry.h"
 #include "Tudat/Astrodynamics/ElectroMagnetism/radiationPressureInterface.h"
 
 namespace tudat
@@ -117,6 +118,12 @@ BOOST_AUTO_TEST_CASE( testShadowFunctionLink )
                 unoccultedRadiationPressureInterface->getCurrentRadiationPressure( ) , 0.4547,
                                 1.0E-4 );
 
+    // Check that a single (spherical) occulting body uses the conical shadow function model.
+    BOOST_CHECK_EQUAL( occultedRadiationPressureInterface->getCurrentShadowFunction( ),
+                       mission_geometry::computeShadowFunction(
+                           occultedBodyPosition, occultedBodyRadius, occultingBodyPosition,
+                           occultingBodyRadius, satellitePosition ) );
+
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
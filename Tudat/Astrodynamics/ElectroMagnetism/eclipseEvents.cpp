@@ -0,0 +1,192 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/ElectroMagnetism/eclipseEvents.h"
+#include "Tudat/Mathematics/BasicMathematics/functionProxy.h"
+#include "Tudat/Mathematics/RootFinders/bisection.h"
+
+namespace tudat
+{
+
+namespace electro_magnetism
+{
+
+//! Function to compute the apparent radii of source and occulting body, and their apparent separation.
+void computeApparentOccultationGeometry( const Eigen::Vector3d& satellitePosition,
+                                         const Eigen::Vector3d& sourcePosition,
+                                         const double sourceRadius,
+                                         const Eigen::Vector3d& occultingBodyPosition,
+                                         const double occultingBodyRadius,
+                                         double& sourceApparentRadius,
+                                         double& occultingBodyApparentRadius,
+                                         double& apparentSeparation )
+{
+    const Eigen::Vector3d sourceRelativePosition = sourcePosition - satellitePosition;
+    const Eigen::Vector3d occultingBodyRelativePosition = occultingBodyPosition - satellitePosition;
+    const double sourceDistance = sourceRelativePosition.norm( );
+    const double occultingBodyDistance = occultingBodyRelativePosition.norm( );
+
+    sourceApparentRadius = std::asin( std::min( sourceRadius / sourceDistance, 1.0 ) );
+    occultingBodyApparentRadius = std::asin( std::min( occultingBodyRadius / occultingBodyDistance, 1.0 ) );
+    apparentSeparation = std::acos(
+                std::min( std::max( sourceRelativePosition.dot( occultingBodyRelativePosition ) /
+                                    ( sourceDistance * occultingBodyDistance ), -1.0 ), 1.0 ) );
+}
+
+//! Function to compute the penumbra condition function for a single occulting body.
+double computePenumbraConditionFunction( const Eigen::Vector3d& satellitePosition,
+                                         const Eigen::Vector3d& sourcePosition,
+                                         const double sourceRadius,
+                                         const Eigen::Vector3d& occultingBodyPosition,
+                                         const double occultingBodyRadius )
+{
+    double sourceApparentRadius, occultingBodyApparentRadius, apparentSeparation;
+    computeApparentOccultationGeometry(
+                satellitePosition, sourcePosition, sourceRadius, occultingBodyPosition, occultingBodyRadius,
+                sourceApparentRadius, occultingBodyApparentRadius, apparentSeparation );
+    return apparentSeparation - ( sourceApparentRadius + occultingBodyApparentRadius );
+}
+
+//! Function to compute the umbra condition function for a single occulting body.
+double computeUmbraConditionFunction( const Eigen::Vector3d& satellitePosition,
+                                      const Eigen::Vector3d& sourcePosition,
+                                      const double sourceRadius,
+                                      const Eigen::Vector3d& occultingBodyPosition,
+                                      const double occultingBodyRadius )
+{
+    double sourceApparentRadius, occultingBodyApparentRadius, apparentSeparation;
+    computeApparentOccultationGeometry(
+                satellitePosition, sourcePosition, sourceRadius, occultingBodyPosition, occultingBodyRadius,
+                sourceApparentRadius, occultingBodyApparentRadius, apparentSeparation );
+    return apparentSeparation - ( occultingBodyApparentRadius - sourceApparentRadius );
+}
+
+//! Function to find the root of a condition function in an interval in which it changes sign.
+double findConditionFunctionRoot( const std::function< double( const double ) > conditionFunction,
+                                  const double lowerBound, const double upperBound, const double timeTolerance )
+{
+    std::shared_ptr< basic_mathematics::FunctionProxy< double, double > > rootFunction =
+            std::make_shared< basic_mathematics::FunctionProxy< double, double > >( conditionFunction );
+    root_finders::BisectionCore< double > bisection(
+                std::bind( &root_finders::termination_conditions::
+                           RootAbsoluteToleranceTerminationCondition< double >::checkTerminationCondition,
+                           std::make_shared< root_finders::termination_conditions::
+                           RootAbsoluteToleranceTerminationCondition< double > >( timeTolerance, 100, false ),
+                           std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+                           std::placeholders::_4, std::placeholders::_5 ),
+                lowerBound, upperBound );
+    return bisection.execute( rootFunction );
+}
+
+//! Function to find all eclipse events along a trajectory.
+std::vector< EclipseEvent > findEclipseEvents(
+        const std::function< Eigen::Vector3d( const double ) > satellitePositionFunction,
+        const std::function< Eigen::Vector3d( const double ) > sourcePositionFunction,
+        const double sourceRadius,
+        const std::vector< std::function< Eigen::Vector3d( const double ) > >& occultingBodyPositionFunctions,
+        const std::vector< double >& occultingBodyRadii,
+        const double startTime,
+        const double endTime,
+        const double searchTimeStep,
+        const double timeTolerance )
+{
+    if( occultingBodyPositionFunctions.size( ) != occultingBodyRadii.size( ) )
+    {
+        throw std::runtime_error( "Error when finding eclipse events, inconsistent number of occulting body "
+                                  "positions and radii." );
+    }
+
+    if( !( searchTimeStep > 0.0 ) || !( endTime > startTime ) )
+    {
+        throw std::runtime_error( "Error when finding eclipse events, search step and interval must be positive." );
+    }
+
+    std::vector< EclipseEvent > eclipseEvents;
+    for( unsigned int i = 0; i < occultingBodyPositionFunctions.size( ); i++ )
+    {
+        // Define penumbra and umbra condition functions of current occulting body, as a function of time.
+        const std::function< Eigen::Vector3d( const double ) > occultingBodyPositionFunction =
+                occultingBodyPositionFunctions.at( i );
+        const double occultingBodyRadius = occultingBodyRadii.at( i );
+        const std::function< double( const double ) > penumbraConditionFunction = [ = ]( const double time )
+        {
+            return computePenumbraConditionFunction(
+                        satellitePositionFunction( time ), sourcePositionFunction( time ), sourceRadius,
+                        occultingBodyPositionFunction( time ), occultingBodyRadius );
+        };
+        const std::function< double( const double ) > umbraConditionFunction = [ = ]( const double time )
+        {
+            return computeUmbraConditionFunction(
+                        satellitePositionFunction( time ), sourcePositionFunction( time ), sourceRadius,
+                        occultingBodyPositionFunction( time ), occultingBodyRadius );
+        };
+
+        // Evaluate condition functions at regular interval, and refine sign changes to event times.
+        double lowerBound = startTime;
+        double lowerPenumbraValue = penumbraConditionFunction( lowerBound );
+        double lowerUmbraValue = umbraConditionFunction( lowerBound );
+        while( lowerBound < endTime )
+        {
+            const double upperBound = std::min( lowerBound + searchTimeStep, endTime );
+            const double upperPenumbraValue = penumbraConditionFunction( upperBound );
+            const double upperUmbraValue = umbraConditionFunction( upperBound );
+
+            if( ( lowerPenumbraValue < 0.0 ) != ( upperPenumbraValue < 0.0 ) )
+            {
+                eclipseEvents.push_back(
+                            EclipseEvent( findConditionFunctionRoot(
+                                              penumbraConditionFunction, lowerBound, upperBound, timeTolerance ),
+                                          ( upperPenumbraValue < 0.0 ) ? penumbra_entry : penumbra_exit, i ) );
+            }
+
+            if( ( lowerUmbraValue < 0.0 ) != ( upperUmbraValue < 0.0 ) )
+            {
+                eclipseEvents.push_back(
+                            EclipseEvent( findConditionFunctionRoot(
+                                              umbraConditionFunction, lowerBound, upperBound, timeTolerance ),
+                                          ( upperUmbraValue < 0.0 ) ? umbra_entry : umbra_exit, i ) );
+            }
+
+            lowerBound = upperBound;
+            lowerPenumbraValue = upperPenumbraValue;
+            lowerUmbraValue = upperUmbraValue;
+        }
+    }
+
+    // Sort events by time (and by type for simultaneous events).
+    std::stable_sort( eclipseEvents.begin( ), eclipseEvents.end( ),
+                      [ ]( const EclipseEvent& event1, const EclipseEvent& event2 )
+    {
+        return ( event1.time_ < event2.time_ ) ||
+                ( event1.time_ == event2.time_ && event1.eventType_ < event2.eventType_ );
+    } );
+
+    return eclipseEvents;
+}
+
+//! Function to retrieve the times of a list of eclipse events.
+std::vector< double > getEclipseEventTimes( const std::vector< EclipseEvent >& eclipseEvents )
+{
+    std::vector< double > eclipseEventTimes;
+    for( unsigned int i = 0; i < eclipseEvents.size( ); i++ )
+    {
+        eclipseEventTimes.push_back( eclipseEvents.at( i ).time_ );
+    }
+    return eclipseEventTimes;
+}
+
+} // namespace electro_magnetism
+
+} // namespace tudat
@@ -0,0 +1,139 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_ECLIPSEEVENTS_H
+#define TUDAT_ECLIPSEEVENTS_H
+
+#include <functional>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace electro_magnetism
+{
+
+//! Types of eclipse events, i.e. crossings of the shadow boundaries of an occulting body.
+enum EclipseEventType
+{
+    penumbra_entry,
+    umbra_entry,
+    umbra_exit,
+    penumbra_exit
+};
+
+//! Object describing a single eclipse event (crossing of a shadow boundary).
+struct EclipseEvent
+{
+    //! Constructor
+    /*!
+     * Constructor
+     * \param time Time at which the shadow boundary is crossed.
+     * \param eventType Type of shadow boundary crossing.
+     * \param occultingBodyIndex Index (in list provided to findEclipseEvents) of body causing the eclipse.
+     */
+    EclipseEvent( const double time, const EclipseEventType eventType, const int occultingBodyIndex ):
+        time_( time ), eventType_( eventType ), occultingBodyIndex_( occultingBodyIndex ){ }
+
+    //! Time at which the shadow boundary is crossed.
+    double time_;
+
+    //! Type of shadow boundary crossing.
+    EclipseEventType eventType_;
+
+    //! Index (in list provided to findEclipseEvents) of body causing the eclipse.
+    int occultingBodyIndex_;
+};
+
+//! Function to compute the penumbra condition function for a single occulting body.
+/*!
+ * Function to compute the penumbra condition function for a single occulting body, defined as the apparent separation
+ * of the occulting and occulted body, minus the sum of their apparent radii. The function is negative if the satellite
+ * is in (partial or full) shadow, and positive otherwise, so that its roots define penumbra entry and exit.
+ * \param satellitePosition Position of satellite.
+ * \param sourcePosition Position of occulted (source) body.
+ * \param sourceRadius Radius of occulted (source) body.
+ * \param occultingBodyPosition Position of occulting body.
+ * \param occultingBodyRadius Radius of occulting body.
+ * \return Penumbra condition function value [rad].
+ */
+double computePenumbraConditionFunction( const Eigen::Vector3d& satellitePosition,
+                                         const Eigen::Vector3d& sourcePosition,
+                                         const double sourceRadius,
+                                         const Eigen::Vector3d& occultingBodyPosition,
+                                         const double occultingBodyRadius );
+
+//! Function to compute the umbra condition function for a single occulting body.
+/*!
+ * Function to compute the umbra condition function for a single occulting body, defined as the apparent separation
+ * of the occulting and occulted body, minus the difference of the apparent radii of the occulting and occulted body.
+ * The function is negative if the satellite is in umbra, and positive otherwise, so that its roots define umbra entry
+ * and exit.
+ * \param satellitePosition Position of satellite.
+ * \param sourcePosition Position of occulted (source) body.
+ * \param sourceRadius Radius of occulted (source) body.
+ * \param occultingBodyPosition Position of occulting body.
+ * \param occultingBodyRadius Radius of occulting body.
+ * \return Umbra condition function value [rad].
+ */
+double computeUmbraConditionFunction( const Eigen::Vector3d& satellitePosition,
+                                      const Eigen::Vector3d& sourcePosition,
+                                      const double sourceRadius,
+                                      const Eigen::Vector3d& occultingBodyPosition,
+                                      const double occultingBodyRadius );
+
+//! Function to find all eclipse events along a trajectory.
+/*!
+ * Function to find all eclipse events (penumbra and umbra entries and exits) along a trajectory, for any number of
+ * occulting bodies. The trajectory is typically obtained from an interpolated preliminary propagation (for instance
+ * without radiation pressure), or an ephemeris. The condition functions (see computePenumbraConditionFunction and
+ * computeUmbraConditionFunction) are evaluated at a regular interval, and each sign change is refined to the requested
+ * tolerance using a bisection root finder. The search step must be small compared to the shortest penumbra/umbra
+ * duration that is to be detected. The resulting event times can be passed to the numerical integrator (see
+ * RungeKuttaVariableStepSizeIntegrator::setForcedStepBoundaries) to prevent the integrator stepping across shadow
+ * boundaries.
+ * \param satellitePositionFunction Function returning the satellite position as a function of time.
+ * \param sourcePositionFunction Function returning the position of the occulted (source) body as a function of time.
+ * \param sourceRadius Radius of occulted (source) body.
+ * \param occultingBodyPositionFunctions List of functions returning the positions of the occulting bodies as a function
+ * of time.
+ * \param occultingBodyRadii List of radii of the occulting bodies.
+ * \param startTime Start time of search interval.
+ * \param endTime End time of search interval.
+ * \param searchTimeStep Time interval at which condition functions are evaluated to detect sign changes.
+ * \param timeTolerance Tolerance to which event times are computed.
+ * \return List of eclipse events, sorted by time.
+ */
+std::vector< EclipseEvent > findEclipseEvents(
+        const std::function< Eigen::Vector3d( const double ) > satellitePositionFunction,
+        const std::function< Eigen::Vector3d( const double ) > sourcePositionFunction,
+        const double sourceRadius,
+        const std::vector< std::function< Eigen::Vector3d( const double ) > >& occultingBodyPositionFunctions,
+        const std::vector< double >& occultingBodyRadii,
+        const double startTime,
+        const double endTime,
+        const double searchTimeStep,
+        const double timeTolerance = 1.0E-3 );
+
+//! Function to retrieve the times of a list of eclipse events.
+/*!
+ * Function to retrieve the times of a list of eclipse events.
+ * \param eclipseEvents List of eclipse events.
+ * \return Times of eclipse events, in the same order as the input.
+ */
+std::vector< double > getEclipseEventTimes( const std::vector< EclipseEvent >& eclipseEvents );
+
+} // namespace electro_magnetism
+
+} // namespace tudat
+
+#endif // TUDAT_ECLIPSEEVENTS_H
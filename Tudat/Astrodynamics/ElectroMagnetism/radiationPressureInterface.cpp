@@ -9,8 +9,6 @@
  *
  */
 
-#include <iostream>
-
 #include "Tudat/Astrodynamics/BasicAstrodynamics/missionGeometry.h"
 #include "Tudat/Astrodynamics/ElectroMagnetism/radiationPressureInterface.h"
 
@@ -34,31 +32,49 @@ void RadiationPressureInterface::updateInterface(
 {
     currentTime_ = currentTime;
 
+    // Retrieve current positions of source and target (once per update)
+    const Eigen::Vector3d currentSourcePosition = sourcePositionFunction_( );
+    const Eigen::Vector3d currentTargetPosition = targetPositionFunction_( );
+
     // Calculate current radiation pressure
-    currentSolarVector_ = sourcePositionFunction_( ) - targetPositionFunction_( );
+    currentSolarVector_ = currentSourcePosition - currentTargetPosition;
     double distanceFromSource = currentSolarVector_.norm( );
     currentRadiationPressure_ = calculateRadiationPressure(
                 sourcePower_( ), distanceFromSource );
 
-    // Calculate total shadowing due to occulting body; note that multiple concurrent
-    // occultations are not completely correctly (prints warning).
-    double shadowFunction = 1.0;
-    double currentShadowFunction = 1.0;
-    for( unsigned int i = 0; i < occultingBodyPositions_.size( ); i++ )
+    // Calculate shadowing due to single spherical occulting body, using the (conical) shadow function model
+    if( occultingBodyPositions_.size( ) == 1 &&
+            ( occultingBodyFlattenings_.size( ) == 0 || occultingBodyFlattenings_.at( 0 ) == 0.0 ) )
+    {
+        currentOccultingBodyPositions_[ 0 ] = occultingBodyPositions_[ 0 ]( );
+        currentShadowFunction_ = mission_geometry::computeShadowFunction(
+                    currentSourcePosition, sourceRadius_, currentOccultingBodyPositions_[ 0 ],
+                    occultingBodyRadii_[ 0 ], currentTargetPosition );
+    }
+    // Calculate total shadowing due to (possibly concurrently) occulting bodies
+    else if( occultingBodyPositions_.size( ) > 0 )
     {
-        currentShadowFunction *= mission_geometry::computeShadowFunction(
-                    sourcePositionFunction_( ), sourceRadius_, occultingBodyPositions_[ i ]( ),
-                    occultingBodyRadii_[ i ], targetPositionFunction_( ) );
+        for( unsigned int i = 0; i < occultingBodyPositions_.size( ); i++ )
+        {
+            currentOccultingBodyPositions_[ i ] = occultingBodyPositions_[ i ]( );
+        }
 
-        if( currentShadowFunction != 1.0 && shadowFunction != 1.0 )
+        for( unsigned int i = 0; i < occultingBodyPoleDirections_.size( ); i++ )
         {
-            std::cerr << "Warning, multiple occultation occured in radiation pressure interface, results may be slightly in error" << std::endl;
+            currentOccultingBodyPoleDirections_[ i ] = occultingBodyPoleDirections_[ i ]( currentTime );
         }
 
-        shadowFunction *= currentShadowFunction;
+        currentShadowFunction_ = mission_geometry::computeMultipleOccultationShadowFunction(
+                    currentSourcePosition, sourceRadius_, currentOccultingBodyPositions_,
+                    occultingBodyRadii_, currentTargetPosition, occultingBodyFlattenings_,
+                    currentOccultingBodyPoleDirections_ );
+    }
+    else
+    {
+        currentShadowFunction_ = 1.0;
     }
 
-    currentRadiationPressure_ *= shadowFunction;
+    currentRadiationPressure_ *= currentShadowFunction_;
 
     radiationPressureCoefficient_ = radiationPressureCoefficientFunction_( currentTime );
 }
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include <functional>
+#include <stdexcept>
 #include <boost/lambda/lambda.hpp>
 
 #include <Eigen/Core>
@@ -57,8 +58,9 @@ public:
      *  \param radiationPressureCoefficient Reflectivity coefficient of the target body.
      *  \param area Reflecting area of the target body.
      *  \param occultingBodyPositions List of functions returning the positions of the bodies
-     *  causing occultations (default none) NOTE: Multiple concurrent occultations may currently
-     *  result in slighlty underestimted radiation pressure.
+     *  causing occultations (default none). A single spherical occulting body is handled by
+     *  mission_geometry::computeShadowFunction; multiple concurrent (or oblate) occulting bodies
+     *  are handled by mission_geometry::computeMultipleOccultationShadowFunction.
      *  \param occultingBodyRadii List of radii of the bodies causing occultations (default none).
      *  \param sourceRadius Radius of the source body (used for occultation calculations) (default 0).
      */
@@ -80,7 +82,9 @@ public:
         occultingBodyPositions_( occultingBodyPositions ),
         occultingBodyRadii_( occultingBodyRadii ),
         sourceRadius_( sourceRadius ),
+        currentOccultingBodyPositions_( occultingBodyPositions.size( ) ),
         currentRadiationPressure_( TUDAT_NAN ),
+        currentShadowFunction_( TUDAT_NAN ),
         currentSolarVector_( Eigen::Vector3d::Zero( ) ),
         currentTime_( TUDAT_NAN ){ }
 
@@ -105,6 +109,17 @@ public:
         return currentRadiationPressure_;
     }
 
+    //! Function to return the current value of the shadow function.
+    /*!
+     *  Function to return the current value of the shadow function (0 for umbra, 1 for full exposure), as computed
+     *  during last call to updateInterface.
+     *  \return Current value of the shadow function.
+     */
+    double getCurrentShadowFunction( ) const
+    {
+        return currentShadowFunction_;
+    }
+
     //! Function to return the current vector from the target to the source.
     /*!
      *  Function to return the current vector from the target to the source.
@@ -222,6 +237,39 @@ public:
         return occultingBodyRadii_;
     }
 
+    //! Function to set the occulting bodies to be modelled as oblate spheroids.
+    /*!
+     *  Function to set the occulting bodies to be modelled as oblate spheroids, in which case the radii provided to the
+     *  constructor are to be the equatorial radii of the bodies.
+     *  \param occultingBodyFlattenings List of flattenings of the occulting bodies (0 for spherical body).
+     *  \param occultingBodyPoleDirections List of functions returning the unit vector along the polar axis of the
+     *  occulting bodies as a function of time, in the same frame as the positions.
+     */
+    void setOblateOccultingBodies(
+            const std::vector< double >& occultingBodyFlattenings,
+            const std::vector< std::function< Eigen::Vector3d( const double ) > >& occultingBodyPoleDirections )
+    {
+        if( occultingBodyFlattenings.size( ) != occultingBodyPositions_.size( ) ||
+                occultingBodyPoleDirections.size( ) != occultingBodyPositions_.size( ) )
+        {
+            throw std::runtime_error( "Error when setting oblate occulting bodies in radiation pressure interface, "
+                                      "inconsistent number of bodies." );
+        }
+        occultingBodyFlattenings_ = occultingBodyFlattenings;
+        occultingBodyPoleDirections_ = occultingBodyPoleDirections;
+        currentOccultingBodyPoleDirections_.resize( occultingBodyPositions_.size( ) );
+    }
+
+    //! Function to return the list of flattenings of the bodies causing occultations.
+    /*!
+     *  Function to return the list of flattenings of the bodies causing occultations (empty if all are spherical).
+     *  \return List of flattenings of the bodies causing occultations.
+     */
+    std::vector< double > getOccultingBodyFlattenings( )
+    {
+        return occultingBodyFlattenings_;
+    }
+
     //! Function to return the radius of the source body.
     /*!
      *  Function to return the source radius of the target body.
@@ -262,9 +310,25 @@ protected:
     //! Radius of the source body.
     double sourceRadius_;
 
+    //! List of flattenings of the bodies causing occultations (empty if all are spherical).
+    std::vector< double > occultingBodyFlattenings_;
+
+    //! List of functions returning the unit vectors along the polar axes of the bodies causing occultations, as a
+    //! function of time.
+    std::vector< std::function< Eigen::Vector3d( const double ) > > occultingBodyPoleDirections_;
+
+    //! Current positions of the bodies causing occultations (retrieved once per call to updateInterface).
+    std::vector< Eigen::Vector3d > currentOccultingBodyPositions_;
+
+    //! Current pole directions of the bodies causing occultations (retrieved once per call to updateInterface).
+    std::vector< Eigen::Vector3d > currentOccultingBodyPoleDirections_;
+
     //! Current radiation pressure due to source at target (in N/m^2).
     double currentRadiationPressure_;
 
+    //! Current value of the shadow function.
+    double currentShadowFunction_;
+
     //! Current vector from the target to the source.
     Eigen::Vector3d currentSolarVector_;
 
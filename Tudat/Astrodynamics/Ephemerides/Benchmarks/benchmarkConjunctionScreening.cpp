@@ -0,0 +1,48 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmark of the conjunction screening of a synthetic catalogue of 5000 objects over 6 hours, using a single
+ *      thread and all available hardware threads. Only built if BUILD_BENCHMARKS is set.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+#include "Tudat/Astrodynamics/Ephemerides/conjunctionScreening.h"
+#include "Tudat/Astrodynamics/Ephemerides/UnitTests/syntheticObjectCatalogue.h"
+
+int main( )
+{
+    using namespace tudat::ephemerides;
+
+    const double earthGravitationalParameter = 3.986004418E14;
+    const int numberOfObjects = 5000;
+
+    std::vector< std::shared_ptr< Ephemeris > > catalogue = tudat::unit_tests::createSyntheticCatalogue(
+                numberOfObjects, 400.0E3, 1400.0E3, earthGravitationalParameter, 1 );
+
+    unsigned int maximumNumberOfThreads = std::max( std::thread::hardware_concurrency( ), 2u );
+    for( unsigned int numberOfThreads: { 1u, maximumNumberOfThreads } )
+    {
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+        std::vector< ConjunctionEvent > conjunctionEvents =
+                screenConjunctions( catalogue, std::make_shared< ConjunctionScreeningSettings >(
+                                        5.0E3, 0.0, 6.0 * 3600.0, 60.0, earthGravitationalParameter,
+                                        numberOfThreads ) );
+        std::cout << "Screening of " << numberOfObjects << " objects over 6 hours using " << numberOfThreads
+                  << " thread(s): " << conjunctionEvents.size( ) << " conjunctions in "
+                  << std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( )
+                  << " s" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
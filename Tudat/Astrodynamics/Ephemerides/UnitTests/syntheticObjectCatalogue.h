@@ -0,0 +1,69 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_SYNTHETIC_OBJECT_CATALOGUE_H
+#define TUDAT_SYNTHETIC_OBJECT_CATALOGUE_H
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to create a synthetic catalogue of objects in low Earth orbit.
+/*!
+ *  Function to create a synthetic catalogue of objects in near-circular low Earth orbits, with uniformly distributed
+ *  semi-major axes, random orientations and random phases. Used by the unit tests and benchmark of the conjunction
+ *  screening.
+ *  \param numberOfObjects Number of objects in the catalogue.
+ *  \param minimumAltitude Minimum altitude of the objects.
+ *  \param maximumAltitude Maximum altitude of the objects.
+ *  \param earthGravitationalParameter Gravitational parameter of the Earth.
+ *  \param seed Seed of the random number generator.
+ *  \return Kepler ephemerides of the objects in the catalogue.
+ */
+inline std::vector< std::shared_ptr< ephemerides::Ephemeris > > createSyntheticCatalogue(
+        const int numberOfObjects, const double minimumAltitude, const double maximumAltitude,
+        const double earthGravitationalParameter, const int seed )
+{
+    const double earthRadius = 6378.137E3;
+    std::mt19937 randomNumberGenerator( seed );
+    std::uniform_real_distribution< double > unitDistribution( 0.0, 1.0 );
+
+    std::vector< std::shared_ptr< ephemerides::Ephemeris > > catalogue;
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        Eigen::Vector6d keplerElements;
+        keplerElements( 0 ) = earthRadius + minimumAltitude +
+                ( maximumAltitude - minimumAltitude ) * unitDistribution( randomNumberGenerator );
+        keplerElements( 1 ) = 0.005 * unitDistribution( randomNumberGenerator );
+        keplerElements( 2 ) = std::acos( 1.0 - 2.0 * unitDistribution( randomNumberGenerator ) );
+        keplerElements( 3 ) = 2.0 * mathematical_constants::PI * unitDistribution( randomNumberGenerator );
+        keplerElements( 4 ) = 2.0 * mathematical_constants::PI * unitDistribution( randomNumberGenerator );
+        keplerElements( 5 ) = 2.0 * mathematical_constants::PI * unitDistribution( randomNumberGenerator );
+        catalogue.push_back( std::make_shared< ephemerides::KeplerEphemeris >(
+                                 keplerElements, 0.0, earthGravitationalParameter, "Earth", "J2000" ) );
+    }
+    return catalogue;
+}
+
+} // namespace unit_tests
+
+} // namespace tudat
+
+#endif // TUDAT_SYNTHETIC_OBJECT_CATALOGUE_H
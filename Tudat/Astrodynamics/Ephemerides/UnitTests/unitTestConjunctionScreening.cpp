@@ -0,0 +1,224 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <thread>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/conjunctionScreening.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/UnitTests/syntheticObjectCatalogue.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::ephemerides;
+
+BOOST_AUTO_TEST_SUITE( test_conjunction_screening )
+
+//! Test close approach of two circular orbits with a known time of closest approach and miss distance.
+BOOST_AUTO_TEST_CASE( testConjunctionScreeningKnownEncounter )
+{
+    const double earthGravitationalParameter = 3.986004418E14;
+    const double firstRadius = 7000.0E3;
+    const double secondRadius = firstRadius + 100.0;
+    const double timeOfClosestApproach = 1234.5;
+
+    // First object in equatorial orbit, second object in polar orbit; both are on the x-axis at timeOfClosestApproach,
+    // so that the distance is minimum (and equal to the difference in radii) at that time.
+    std::vector< std::shared_ptr< Ephemeris > > ephemerides;
+    ephemerides.push_back( std::make_shared< KeplerEphemeris >(
+                               ( Eigen::Vector6d( ) << firstRadius, 0.0, 0.0, 0.0, 0.0, 0.0 ).finished( ),
+                               timeOfClosestApproach, earthGravitationalParameter ) );
+    ephemerides.push_back( std::make_shared< KeplerEphemeris >(
+                               ( Eigen::Vector6d( ) << secondRadius, 0.0, mathematical_constants::PI / 2.0,
+                                 0.0, 0.0, 0.0 ).finished( ),
+                               timeOfClosestApproach, earthGravitationalParameter ) );
+
+    // Add object far away, which should be removed by the apogee/perigee filter
+    ephemerides.push_back( std::make_shared< KeplerEphemeris >(
+                               ( Eigen::Vector6d( ) << 42164.0E3, 0.0, 0.0, 0.0, 0.0, 0.0 ).finished( ),
+                               0.0, earthGravitationalParameter ) );
+
+    for( unsigned int numberOfThreads = 1; numberOfThreads <= 2; numberOfThreads++ )
+    {
+        for( unsigned int useApsisFilter = 0; useApsisFilter < 2; useApsisFilter++ )
+        {
+            std::shared_ptr< ConjunctionScreeningSettings > screeningSettings =
+                    std::make_shared< ConjunctionScreeningSettings >(
+                        1.0E3, 0.0, 3600.0, 60.0, useApsisFilter ? earthGravitationalParameter : TUDAT_NAN,
+                        numberOfThreads );
+
+            std::vector< ConjunctionEvent > conjunctionEvents = screenConjunctions( ephemerides, screeningSettings );
+
+            // Orbits only approach each other at the nodes; next encounter (at other node) is after end of screening.
+            BOOST_CHECK_EQUAL( conjunctionEvents.size( ), 1 );
+            BOOST_CHECK_EQUAL( conjunctionEvents.at( 0 ).firstObjectIndex_, 0 );
+            BOOST_CHECK_EQUAL( conjunctionEvents.at( 0 ).secondObjectIndex_, 1 );
+            BOOST_CHECK_SMALL( conjunctionEvents.at( 0 ).timeOfClosestApproach_ - timeOfClosestApproach, 1.0E-3 );
+            BOOST_CHECK_SMALL( conjunctionEvents.at( 0 ).missDistance_ - 100.0, 1.0E-1 );
+            BOOST_CHECK_CLOSE_FRACTION(
+                        conjunctionEvents.at( 0 ).relativeSpeed_,
+                        std::sqrt( 2.0 ) * std::sqrt( earthGravitationalParameter / firstRadius ), 1.0E-4 );
+        }
+    }
+
+    // Check that invalid sampling settings are caught.
+    BOOST_CHECK_THROW( screenConjunctions(
+                           ephemerides, std::make_shared< ConjunctionScreeningSettings >( 1.0E3, 0.0, 3600.0, 0.0 ) ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( screenConjunctions(
+                           ephemerides, std::make_shared< ConjunctionScreeningSettings >( 1.0E3, 0.0, -1.0, 60.0 ) ),
+                       std::runtime_error );
+}
+
+//! Test conjunction screening of a small catalogue against brute-force evaluation of all pairs.
+BOOST_AUTO_TEST_CASE( testConjunctionScreeningAgainstBruteForce )
+{
+    const double earthGravitationalParameter = 3.986004418E14;
+    const double screeningDistance = 20.0E3;
+    const int numberOfObjects = 150;
+
+    std::vector< std::shared_ptr< Ephemeris > > catalogue = createSyntheticCatalogue(
+                numberOfObjects, 700.0E3, 710.0E3, earthGravitationalParameter, 42 );
+
+    std::shared_ptr< ConjunctionScreeningSettings > screeningSettings =
+            std::make_shared< ConjunctionScreeningSettings >(
+                screeningDistance, 0.0, 7200.0, 60.0, earthGravitationalParameter, 4 );
+    std::vector< ConjunctionEvent > conjunctionEvents = screenConjunctions( catalogue, screeningSettings );
+
+    // Check reported events against directly evaluated ephemerides
+    for( unsigned int i = 0; i < conjunctionEvents.size( ); i++ )
+    {
+        ConjunctionEvent currentEvent = conjunctionEvents.at( i );
+        Eigen::Vector6d relativeState =
+                catalogue.at( currentEvent.secondObjectIndex_ )->getCartesianState(
+                    currentEvent.timeOfClosestApproach_ ) -
+                catalogue.at( currentEvent.firstObjectIndex_ )->getCartesianState(
+                    currentEvent.timeOfClosestApproach_ );
+        BOOST_CHECK_SMALL( relativeState.segment( 0, 3 ).norm( ) - currentEvent.missDistance_, 1.0 );
+        BOOST_CHECK_SMALL( relativeState.segment( 3, 3 ).norm( ) - currentEvent.relativeSpeed_, 1.0E-2 );
+
+        // Check that time is a local minimum of the distance
+        BOOST_CHECK_SMALL( relativeState.segment( 0, 3 ).normalized( ).dot(
+                               relativeState.segment( 3, 3 ).normalized( ) ), 1.0E-4 );
+
+        if( i > 0 )
+        {
+            BOOST_CHECK( currentEvent.timeOfClosestApproach_ >=
+                         conjunctionEvents.at( i - 1 ).timeOfClosestApproach_ );
+        }
+    }
+
+    // Find all local minima of the distance with brute-force sampling of all pairs (1 s step).
+    const double bruteForceTimeStep = 1.0;
+    const int numberOfBruteForceEpochs = 7201;
+    std::vector< SampledCartesianStates > bruteForcePositions( numberOfObjects );
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        bruteForcePositions[ i ].resize( 6, numberOfBruteForceEpochs );
+        for( int j = 0; j < numberOfBruteForceEpochs; j++ )
+        {
+            bruteForcePositions[ i ].col( j ) = catalogue.at( i )->getCartesianState( j * bruteForceTimeStep );
+        }
+    }
+
+    int numberOfBruteForceEvents = 0;
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        for( int j = i + 1; j < numberOfObjects; j++ )
+        {
+            Eigen::RowVectorXd distances =
+                    ( bruteForcePositions[ j ].topRows( 3 ) - bruteForcePositions[ i ].topRows( 3 ) ).colwise( ).norm( );
+            for( int k = 1; k < numberOfBruteForceEpochs - 1; k++ )
+            {
+                if( distances( k ) <= distances( k - 1 ) && distances( k ) < distances( k + 1 ) )
+                {
+                    // Check that clear conjunctions are found by the screening.
+                    bool isEventFound = false;
+                    for( unsigned int l = 0; l < conjunctionEvents.size( ); l++ )
+                    {
+                        if( conjunctionEvents.at( l ).firstObjectIndex_ == i &&
+                                conjunctionEvents.at( l ).secondObjectIndex_ == j &&
+                                std::fabs( conjunctionEvents.at( l ).timeOfClosestApproach_ - k * bruteForceTimeStep )
+                                <= bruteForceTimeStep )
+                        {
+                            isEventFound = true;
+                            BOOST_CHECK( conjunctionEvents.at( l ).missDistance_ <= distances( k ) + 1.0 );
+                        }
+                    }
+
+                    if( distances( k ) < 0.9 * screeningDistance )
+                    {
+                        numberOfBruteForceEvents++;
+                        BOOST_CHECK( isEventFound );
+                    }
+                    else if( distances( k ) > 1.1 * screeningDistance )
+                    {
+                        BOOST_CHECK( !isEventFound );
+                    }
+                }
+            }
+        }
+    }
+
+    // Check that the test is meaningful.
+    BOOST_CHECK( numberOfBruteForceEvents > 5 );
+    BOOST_CHECK( conjunctionEvents.size( ) >= static_cast< unsigned int >( numberOfBruteForceEvents ) );
+}
+
+//! Test that conjunction screening of a synthetic catalogue is independent of the number of threads.
+BOOST_AUTO_TEST_CASE( testConjunctionScreeningSyntheticCatalogue )
+{
+    const double earthGravitationalParameter = 3.986004418E14;
+    const int numberOfObjects = 1000;
+
+    std::vector< std::shared_ptr< Ephemeris > > catalogue = createSyntheticCatalogue(
+                numberOfObjects, 400.0E3, 1400.0E3, earthGravitationalParameter, 1 );
+
+    unsigned int maximumNumberOfThreads = std::max( std::thread::hardware_concurrency( ), 2u );
+    std::vector< std::vector< ConjunctionEvent > > conjunctionEvents;
+    for( unsigned int numberOfThreads: { 1u, maximumNumberOfThreads } )
+    {
+        conjunctionEvents.push_back(
+                    screenConjunctions( catalogue, std::make_shared< ConjunctionScreeningSettings >(
+                                            5.0E3, 0.0, 6.0 * 3600.0, 60.0, earthGravitationalParameter,
+                                            numberOfThreads ) ) );
+    }
+
+    BOOST_CHECK( conjunctionEvents.at( 0 ).size( ) > 0 );
+    BOOST_CHECK_EQUAL( conjunctionEvents.at( 0 ).size( ), conjunctionEvents.at( 1 ).size( ) );
+    for( unsigned int i = 0; i < std::min( conjunctionEvents.at( 0 ).size( ), conjunctionEvents.at( 1 ).size( ) );
+         i++ )
+    {
+        BOOST_CHECK_EQUAL( conjunctionEvents.at( 0 ).at( i ).firstObjectIndex_,
+                           conjunctionEvents.at( 1 ).at( i ).firstObjectIndex_ );
+        BOOST_CHECK_EQUAL( conjunctionEvents.at( 0 ).at( i ).secondObjectIndex_,
+                           conjunctionEvents.at( 1 ).at( i ).secondObjectIndex_ );
+        BOOST_CHECK_EQUAL( conjunctionEvents.at( 0 ).at( i ).timeOfClosestApproach_,
+                           conjunctionEvents.at( 1 ).at( i ).timeOfClosestApproach_ );
+        BOOST_CHECK_EQUAL( conjunctionEvents.at( 0 ).at( i ).missDistance_,
+                           conjunctionEvents.at( 1 ).at( i ).missDistance_ );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
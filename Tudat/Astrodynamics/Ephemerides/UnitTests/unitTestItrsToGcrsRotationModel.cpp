@@ -172,6 +172,77 @@ BOOST_AUTO_TEST_CASE( test_ItrsToGcrsRotationAgainstSofaCookbook )
     }
 }
 
+//! Test ITRS <-> GCRS rotation from tabulated Earth orientation angles against direct computation
+BOOST_AUTO_TEST_CASE( test_ItrsToGcrsRotationFromTabulatedAngles )
+{
+    // Create rotation models, with and without tabulated angles
+    std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator =
+            earth_orientation::createStandardEarthOrientationCalculator( );
+    std::shared_ptr< TabulatedEarthOrientationAnglesCalculator > tabulatedAnglesCalculator =
+            std::make_shared< TabulatedEarthOrientationAnglesCalculator >( anglesCalculator, tdb_scale );
+
+    std::shared_ptr< GcrsToItrsRotationModel > directEarthRotationModel =
+            std::make_shared< GcrsToItrsRotationModel >( anglesCalculator, tdb_scale );
+    std::shared_ptr< GcrsToItrsRotationModel > tabulatedEarthRotationModel =
+            std::make_shared< GcrsToItrsRotationModel >( anglesCalculator, tdb_scale, "GCRS", tabulatedAnglesCalculator );
+
+    // Compare rotation matrices and angles over three days, at times not coinciding with tabulation nodes
+    double startTime = 1.0E8 + 123.4;
+    double timeStep = 1234.5;
+    double testTime;
+    for( unsigned int i = 0; i < 200; i++ )
+    {
+        testTime = startTime + static_cast< double >( i ) * timeStep;
+
+        std::pair< Eigen::Vector5d, double > directAngles =
+                anglesCalculator->getRotationAnglesFromItrsToGcrs< double >( testTime, tdb_scale );
+        std::pair< Eigen::Vector5d, double > tabulatedAngles =
+                tabulatedAnglesCalculator->getRotationAnglesFromItrsToGcrs< double >( testTime );
+        for( unsigned int j = 0; j < 5; j++ )
+        {
+            BOOST_CHECK_SMALL( directAngles.first( j ) - tabulatedAngles.first( j ), 1.0E-11 );
+        }
+        BOOST_CHECK_SMALL( directAngles.second - tabulatedAngles.second, 1.0E-7 );
+
+        Eigen::Matrix3d directRotation =
+                directEarthRotationModel->getRotationToBaseFrame( testTime ).toRotationMatrix( );
+        Eigen::Matrix3d tabulatedRotation =
+                tabulatedEarthRotationModel->getRotationToBaseFrame( testTime ).toRotationMatrix( );
+        Eigen::Matrix3d directRotationDerivative =
+                directEarthRotationModel->getDerivativeOfRotationToBaseFrame( testTime );
+        Eigen::Matrix3d tabulatedRotationDerivative =
+                tabulatedEarthRotationModel->getDerivativeOfRotationToBaseFrame( testTime );
+
+        // Tolerance corresponds to < 1 mm on the Earth's surface
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( directRotation( j, k ) - tabulatedRotation( j, k ), 1.0E-10 );
+                BOOST_CHECK_SMALL( directRotationDerivative( j, k ) - tabulatedRotationDerivative( j, k ), 1.0E-14 );
+            }
+        }
+    }
+
+    // Check that only required blocks have been generated (up to four days covered by test times)
+    BOOST_CHECK_EQUAL( tabulatedAnglesCalculator->getNumberOfGeneratedBlocks( ) <= 4, true );
+
+    // Check that blocks are regenerated after being discarded
+    std::shared_ptr< TabulatedEarthOrientationAnglesCalculator > smallTabulatedAnglesCalculator =
+            std::make_shared< TabulatedEarthOrientationAnglesCalculator >(
+                anglesCalculator, tdb_scale, physical_constants::JULIAN_DAY, 3600.0, 8, 2 );
+    smallTabulatedAnglesCalculator->getRotationAnglesFromItrsToGcrs< double >( 0.5 * physical_constants::JULIAN_DAY );
+    smallTabulatedAnglesCalculator->getRotationAnglesFromItrsToGcrs< double >( 1.5 * physical_constants::JULIAN_DAY );
+    smallTabulatedAnglesCalculator->getRotationAnglesFromItrsToGcrs< double >( 0.6 * physical_constants::JULIAN_DAY );
+    smallTabulatedAnglesCalculator->getRotationAnglesFromItrsToGcrs< double >( 2.5 * physical_constants::JULIAN_DAY );
+    BOOST_CHECK_EQUAL( smallTabulatedAnglesCalculator->getNumberOfStoredBlocks( ), 2 );
+    BOOST_CHECK_EQUAL( smallTabulatedAnglesCalculator->getNumberOfGeneratedBlocks( ), 3 );
+    smallTabulatedAnglesCalculator->getRotationAnglesFromItrsToGcrs< double >( 1.5 * physical_constants::JULIAN_DAY );
+    BOOST_CHECK_EQUAL( smallTabulatedAnglesCalculator->getNumberOfGeneratedBlocks( ), 4 );
+    smallTabulatedAnglesCalculator->getRotationAnglesFromItrsToGcrs< double >( 0.7 * physical_constants::JULIAN_DAY );
+    BOOST_CHECK_EQUAL( smallTabulatedAnglesCalculator->getNumberOfGeneratedBlocks( ), 5 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -0,0 +1,413 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "Tudat/Astrodynamics/Ephemerides/conjunctionScreening.h"
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Mathematics/BasicMathematics/functionProxy.h"
+#include "Tudat/Mathematics/RootFinders/bisection.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Function to retrieve the epochs at which the states of the objects are sampled.
+std::vector< double > ConjunctionScreeningSettings::getSamplingEpochs( ) const
+{
+    if( !( endTime_ > startTime_ ) )
+    {
+        throw std::runtime_error( "Error in conjunction screening, end time must be larger than start time." );
+    }
+
+    if( !( samplingTimeStep_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error in conjunction screening, sampling time step must be positive." );
+    }
+
+    std::vector< double > epochs;
+    int numberOfFullSteps = static_cast< int >( std::floor( ( endTime_ - startTime_ ) / samplingTimeStep_ ) );
+    for( int i = 0; i <= numberOfFullSteps; i++ )
+    {
+        epochs.push_back( startTime_ + static_cast< double >( i ) * samplingTimeStep_ );
+    }
+
+    // Add final epoch, unless it (nearly) coincides with last full step.
+    if( endTime_ - epochs.back( ) > 1.0E-3 * samplingTimeStep_ )
+    {
+        epochs.push_back( endTime_ );
+    }
+    else
+    {
+        epochs.back( ) = endTime_;
+    }
+
+    return epochs;
+}
+
+//! Function to compute the minimum periapsis and maximum apoapsis distance of an object from its sampled states.
+std::pair< double, double > computeApsisDistanceRange( const SampledCartesianStates& sampledStates,
+                                                       const double centralBodyGravitationalParameter )
+{
+    double minimumPeriapsisDistance = std::numeric_limits< double >::infinity( );
+    double maximumApoapsisDistance = 0.0;
+
+    for( int i = 0; i < sampledStates.cols( ); i++ )
+    {
+        Eigen::Vector3d position = sampledStates.block( 0, i, 3, 1 );
+        Eigen::Vector3d velocity = sampledStates.block( 3, i, 3, 1 );
+        double distance = position.norm( );
+
+        // Compute eccentricity vector and semi-latus rectum of osculating orbit.
+        Eigen::Vector3d angularMomentum = position.cross( velocity );
+        Eigen::Vector3d eccentricityVector =
+                velocity.cross( angularMomentum ) / centralBodyGravitationalParameter - position / distance;
+        double eccentricity = eccentricityVector.norm( );
+        double semiLatusRectum = angularMomentum.squaredNorm( ) / centralBodyGravitationalParameter;
+
+        minimumPeriapsisDistance = std::min(
+                    { minimumPeriapsisDistance, semiLatusRectum / ( 1.0 + eccentricity ), distance } );
+        if( eccentricity < 1.0 )
+        {
+            maximumApoapsisDistance = std::max(
+                        { maximumApoapsisDistance, semiLatusRectum / ( 1.0 - eccentricity ), distance } );
+        }
+        else
+        {
+            maximumApoapsisDistance = std::numeric_limits< double >::infinity( );
+        }
+    }
+
+    return std::make_pair( minimumPeriapsisDistance, maximumApoapsisDistance );
+}
+
+//! Cubic Hermite polynomial representation of the relative motion of two objects in between two sampling epochs.
+class RelativeHermiteArc
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param initialTime Start time of arc.
+     * \param finalTime End time of arc.
+     * \param initialRelativeState Relative Cartesian state at start of arc.
+     * \param finalRelativeState Relative Cartesian state at end of arc.
+     */
+    RelativeHermiteArc( const double initialTime, const double finalTime,
+                        const Eigen::Vector6d& initialRelativeState, const Eigen::Vector6d& finalRelativeState ):
+        initialTime_( initialTime ), timeStep_( finalTime - initialTime ),
+        initialRelativeState_( initialRelativeState ), finalRelativeState_( finalRelativeState ){ }
+
+    //! Function to compute the relative position and velocity at a given time.
+    /*!
+     * Function to compute the relative position and velocity at a given time.
+     * \param time Time at which relative state is to be computed.
+     * \param relativePosition Relative position (returned by reference).
+     * \param relativeVelocity Relative velocity (returned by reference).
+     */
+    void computeRelativeState( const double time, Eigen::Vector3d& relativePosition,
+                               Eigen::Vector3d& relativeVelocity ) const
+    {
+        double t = ( time - initialTime_ ) / timeStep_;
+        double t2 = t * t;
+        double t3 = t2 * t;
+
+        relativePosition =
+                ( 2.0 * t3 - 3.0 * t2 + 1.0 ) * initialRelativeState_.segment( 0, 3 ) +
+                ( t3 - 2.0 * t2 + t ) * timeStep_ * initialRelativeState_.segment( 3, 3 ) +
+                ( -2.0 * t3 + 3.0 * t2 ) * finalRelativeState_.segment( 0, 3 ) +
+                ( t3 - t2 ) * timeStep_ * finalRelativeState_.segment( 3, 3 );
+        relativeVelocity =
+                ( 6.0 * t2 - 6.0 * t ) / timeStep_ * initialRelativeState_.segment( 0, 3 ) +
+                ( 3.0 * t2 - 4.0 * t + 1.0 ) * initialRelativeState_.segment( 3, 3 ) +
+                ( -6.0 * t2 + 6.0 * t ) / timeStep_ * finalRelativeState_.segment( 0, 3 ) +
+                ( 3.0 * t2 - 2.0 * t ) * finalRelativeState_.segment( 3, 3 );
+    }
+
+    //! Function to compute the inner product of relative position and velocity (zero at closest approach).
+    /*!
+     * Function to compute the inner product of relative position and velocity (zero at closest approach).
+     * \param time Time at which range rate function is to be computed.
+     * \return Inner product of relative position and velocity.
+     */
+    double computeRangeRateFunction( const double time ) const
+    {
+        Eigen::Vector3d relativePosition, relativeVelocity;
+        computeRelativeState( time, relativePosition, relativeVelocity );
+        return relativePosition.dot( relativeVelocity );
+    }
+
+private:
+
+    //! Start time of arc.
+    double initialTime_;
+
+    //! Duration of arc.
+    double timeStep_;
+
+    //! Relative Cartesian state at start of arc.
+    Eigen::Vector6d initialRelativeState_;
+
+    //! Relative Cartesian state at end of arc.
+    Eigen::Vector6d finalRelativeState_;
+};
+
+//! Function to find the close approaches of two objects in between two sampling epochs.
+/*!
+ * Function to find the close approaches of two objects in between two sampling epochs, as the roots of the range rate
+ * function, from negative to positive.
+ * \param firstObjectIndex Index of first object.
+ * \param secondObjectIndex Index of second object.
+ * \param initialTime Start time of interval.
+ * \param finalTime End time of interval.
+ * \param initialRelativeState Relative Cartesian state at start of interval.
+ * \param finalRelativeState Relative Cartesian state at end of interval.
+ * \param screeningSettings Settings for the screening.
+ * \param conjunctionEvents List of close approaches to which the events are added.
+ */
+void refineConjunctionInInterval(
+        const int firstObjectIndex, const int secondObjectIndex,
+        const double initialTime, const double finalTime,
+        const Eigen::Vector6d& initialRelativeState, const Eigen::Vector6d& finalRelativeState,
+        const std::shared_ptr< ConjunctionScreeningSettings > screeningSettings,
+        std::vector< ConjunctionEvent >& conjunctionEvents )
+{
+    // Number of subintervals in which root of range rate function is bracketed.
+    static const int numberOfSubIntervals = 8;
+
+    RelativeHermiteArc relativeArc( initialTime, finalTime, initialRelativeState, finalRelativeState );
+
+    double subIntervalStep = ( finalTime - initialTime ) / static_cast< double >( numberOfSubIntervals );
+    double lowerBound = initialTime;
+    double lowerBoundValue = relativeArc.computeRangeRateFunction( lowerBound );
+    for( int i = 1; i <= numberOfSubIntervals; i++ )
+    {
+        double upperBound = ( i == numberOfSubIntervals ) ? finalTime :
+                                                            initialTime + static_cast< double >( i ) * subIntervalStep;
+        double upperBoundValue = relativeArc.computeRangeRateFunction( upperBound );
+
+        // Distance has local minimum in subinterval if range rate goes from negative to positive.
+        if( lowerBoundValue < 0.0 && !( upperBoundValue < 0.0 ) )
+        {
+            double timeOfClosestApproach = upperBound;
+            if( upperBoundValue > 0.0 )
+            {
+                std::shared_ptr< basic_mathematics::FunctionProxy< double, double > > rangeRateFunction =
+                        std::make_shared< basic_mathematics::FunctionProxy< double, double > >(
+                            std::bind( &RelativeHermiteArc::computeRangeRateFunction, &relativeArc,
+                                       std::placeholders::_1 ) );
+                root_finders::BisectionCore< double > bisection(
+                            std::bind( &root_finders::termination_conditions::
+                                       RootAbsoluteToleranceTerminationCondition< double >::checkTerminationCondition,
+                                       std::make_shared< root_finders::termination_conditions::
+                                       RootAbsoluteToleranceTerminationCondition< double > >(
+                                           screeningSettings->timeOfClosestApproachTolerance_, 100, false ),
+                                       std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+                                       std::placeholders::_4, std::placeholders::_5 ),
+                            lowerBound, upperBound );
+                timeOfClosestApproach = bisection.execute( rangeRateFunction );
+            }
+
+            Eigen::Vector3d relativePosition, relativeVelocity;
+            relativeArc.computeRelativeState( timeOfClosestApproach, relativePosition, relativeVelocity );
+            double missDistance = relativePosition.norm( );
+            if( missDistance < screeningSettings->screeningDistance_ )
+            {
+                conjunctionEvents.push_back(
+                            ConjunctionEvent( firstObjectIndex, secondObjectIndex, timeOfClosestApproach,
+                                              missDistance, relativeVelocity.norm( ) ) );
+            }
+        }
+
+        lowerBound = upperBound;
+        lowerBoundValue = upperBoundValue;
+    }
+}
+
+//! Function to find all close approaches between a set of objects, from their sampled states.
+std::vector< ConjunctionEvent > screenConjunctions(
+        const std::vector< double >& epochs,
+        const std::vector< SampledCartesianStates >& sampledStates,
+        const std::shared_ptr< ConjunctionScreeningSettings > screeningSettings )
+{
+    const int numberOfObjects = static_cast< int >( sampledStates.size( ) );
+    const int numberOfEpochs = static_cast< int >( epochs.size( ) );
+    const double screeningDistance = screeningSettings->screeningDistance_;
+
+    if( numberOfEpochs < 2 )
+    {
+        throw std::runtime_error( "Error in conjunction screening, at least two sampling epochs are required." );
+    }
+
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        if( sampledStates.at( i ).cols( ) != numberOfEpochs )
+        {
+            throw std::runtime_error( "Error in conjunction screening, number of sampled states of object " +
+                                      std::to_string( i ) + " is inconsistent with number of epochs." );
+        }
+    }
+
+    // Compute apsis distance ranges for apogee/perigee filter.
+    bool useApsisFilter = !std::isnan( screeningSettings->centralBodyGravitationalParameter_ );
+    std::vector< std::pair< double, double > > apsisDistanceRanges;
+    if( useApsisFilter )
+    {
+        apsisDistanceRanges.resize( numberOfObjects );
+        utilities::executeParallelForLoop(
+                    numberOfObjects, [ & ]( const unsigned int objectIndex, const unsigned int )
+        {
+            apsisDistanceRanges[ objectIndex ] = computeApsisDistanceRange(
+                        sampledStates[ objectIndex ], screeningSettings->centralBodyGravitationalParameter_ );
+        }, screeningSettings->numberOfThreads_ );
+    }
+
+    // Create work memory for each thread.
+    unsigned int numberOfThreads = std::max( screeningSettings->numberOfThreads_, 1u );
+    std::vector< std::vector< ConjunctionEvent > > threadConjunctionEvents( numberOfThreads );
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > threadBoundingBoxes(
+                numberOfThreads, Eigen::Matrix< double, 6, Eigen::Dynamic >( 6, numberOfObjects ) );
+    std::vector< std::vector< int > > threadSortedIndices( numberOfThreads, std::vector< int >( numberOfObjects ) );
+
+    // Screen each interval in between two sampling epochs.
+    utilities::executeParallelForLoop(
+                numberOfEpochs - 1, [ & ]( const unsigned int intervalIndex, const unsigned int threadIndex )
+    {
+        const double initialTime = epochs[ intervalIndex ];
+        const double finalTime = epochs[ intervalIndex + 1 ];
+        const double timeStep = finalTime - initialTime;
+
+        // Compute bounding box of each arc (rows 0-2: lower bounds; rows 3-5: upper bounds), from the Bezier control
+        // points of its Hermite polynomial.
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& boundingBoxes = threadBoundingBoxes[ threadIndex ];
+        for( int i = 0; i < numberOfObjects; i++ )
+        {
+            Eigen::Vector3d initialPosition = sampledStates[ i ].block( 0, intervalIndex, 3, 1 );
+            Eigen::Vector3d finalPosition = sampledStates[ i ].block( 0, intervalIndex + 1, 3, 1 );
+            Eigen::Vector3d firstControlPoint =
+                    initialPosition + sampledStates[ i ].block( 3, intervalIndex, 3, 1 ) * timeStep / 3.0;
+            Eigen::Vector3d secondControlPoint =
+                    finalPosition - sampledStates[ i ].block( 3, intervalIndex + 1, 3, 1 ) * timeStep / 3.0;
+
+            boundingBoxes.block( 0, i, 3, 1 ) = initialPosition.cwiseMin( finalPosition ).cwiseMin(
+                        firstControlPoint ).cwiseMin( secondControlPoint );
+            boundingBoxes.block( 3, i, 3, 1 ) = initialPosition.cwiseMax( finalPosition ).cwiseMax(
+                        firstControlPoint ).cwiseMax( secondControlPoint );
+        }
+
+        // Sort boxes along x-axis.
+        std::vector< int >& sortedIndices = threadSortedIndices[ threadIndex ];
+        std::iota( sortedIndices.begin( ), sortedIndices.end( ), 0 );
+        std::sort( sortedIndices.begin( ), sortedIndices.end( ), [ & ]( const int first, const int second )
+        {
+            return boundingBoxes( 0, first ) < boundingBoxes( 0, second );
+        } );
+
+        // Sweep along x-axis, and prune pairs that are separated along y- or z-axis, or by their apsis distances.
+        for( int i = 0; i < numberOfObjects; i++ )
+        {
+            const int firstIndex = sortedIndices[ i ];
+            const double sweepLimit = boundingBoxes( 3, firstIndex ) + screeningDistance;
+            for( int j = i + 1; j < numberOfObjects; j++ )
+            {
+                const int secondIndex = sortedIndices[ j ];
+                if( boundingBoxes( 0, secondIndex ) > sweepLimit )
+                {
+                    break;
+                }
+
+                if( boundingBoxes( 1, secondIndex ) > boundingBoxes( 4, firstIndex ) + screeningDistance ||
+                        boundingBoxes( 1, firstIndex ) > boundingBoxes( 4, secondIndex ) + screeningDistance ||
+                        boundingBoxes( 2, secondIndex ) > boundingBoxes( 5, firstIndex ) + screeningDistance ||
+                        boundingBoxes( 2, firstIndex ) > boundingBoxes( 5, secondIndex ) + screeningDistance )
+                {
+                    continue;
+                }
+
+                if( useApsisFilter &&
+                        ( apsisDistanceRanges[ firstIndex ].first - apsisDistanceRanges[ secondIndex ].second >
+                          screeningDistance ||
+                          apsisDistanceRanges[ secondIndex ].first - apsisDistanceRanges[ firstIndex ].second >
+                          screeningDistance ) )
+                {
+                    continue;
+                }
+
+                const int lowerIndex = std::min( firstIndex, secondIndex );
+                const int upperIndex = std::max( firstIndex, secondIndex );
+                refineConjunctionInInterval(
+                            lowerIndex, upperIndex, initialTime, finalTime,
+                            sampledStates[ upperIndex ].col( intervalIndex ) -
+                            sampledStates[ lowerIndex ].col( intervalIndex ),
+                            sampledStates[ upperIndex ].col( intervalIndex + 1 ) -
+                            sampledStates[ lowerIndex ].col( intervalIndex + 1 ),
+                            screeningSettings, threadConjunctionEvents[ threadIndex ] );
+            }
+        }
+    }, numberOfThreads );
+
+    // Merge events found by each of the threads, and sort by time of closest approach.
+    std::vector< ConjunctionEvent > conjunctionEvents;
+    for( unsigned int i = 0; i < numberOfThreads; i++ )
+    {
+        conjunctionEvents.insert( conjunctionEvents.end( ), threadConjunctionEvents[ i ].begin( ),
+                                  threadConjunctionEvents[ i ].end( ) );
+    }
+    std::sort( conjunctionEvents.begin( ), conjunctionEvents.end( ),
+               [ ]( const ConjunctionEvent& first, const ConjunctionEvent& second )
+    {
+        if( first.timeOfClosestApproach_ != second.timeOfClosestApproach_ )
+        {
+            return first.timeOfClosestApproach_ < second.timeOfClosestApproach_;
+        }
+        else if( first.firstObjectIndex_ != second.firstObjectIndex_ )
+        {
+            return first.firstObjectIndex_ < second.firstObjectIndex_;
+        }
+        else
+        {
+            return first.secondObjectIndex_ < second.secondObjectIndex_;
+        }
+    } );
+
+    return conjunctionEvents;
+}
+
+//! Function to find all close approaches between a set of objects, from their ephemerides.
+std::vector< ConjunctionEvent > screenConjunctions(
+        const std::vector< std::shared_ptr< Ephemeris > >& ephemerides,
+        const std::shared_ptr< ConjunctionScreeningSettings > screeningSettings )
+{
+    std::vector< double > epochs = screeningSettings->getSamplingEpochs( );
+
+    // Sample states of all objects; each ephemeris is only accessed by a single thread.
+    std::vector< SampledCartesianStates > sampledStates(
+                ephemerides.size( ), SampledCartesianStates( 6, epochs.size( ) ) );
+    utilities::executeParallelForLoop(
+                ephemerides.size( ), [ & ]( const unsigned int objectIndex, const unsigned int )
+    {
+        for( unsigned int i = 0; i < epochs.size( ); i++ )
+        {
+            sampledStates[ objectIndex ].col( i ) = ephemerides[ objectIndex ]->getCartesianState( epochs[ i ] );
+        }
+    }, screeningSettings->numberOfThreads_ );
+
+    return screenConjunctions( epochs, sampledStates, screeningSettings );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,196 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_CONJUNCTION_SCREENING_H
+#define TUDAT_CONJUNCTION_SCREENING_H
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Typedef for the sampled Cartesian states of a single object (one state per column, at the screening epochs).
+typedef Eigen::Matrix< double, 6, Eigen::Dynamic > SampledCartesianStates;
+
+//! Structure containing a close approach between two objects, found by conjunction screening.
+struct ConjunctionEvent
+{
+    //! Default constructor
+    ConjunctionEvent( ):
+        firstObjectIndex_( -1 ), secondObjectIndex_( -1 ),
+        timeOfClosestApproach_( TUDAT_NAN ), missDistance_( TUDAT_NAN ), relativeSpeed_( TUDAT_NAN ){ }
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param firstObjectIndex Index of first object (in list of screened objects); always smaller than secondObjectIndex.
+     * \param secondObjectIndex Index of second object (in list of screened objects).
+     * \param timeOfClosestApproach Time of closest approach (TCA).
+     * \param missDistance Distance between the objects at TCA.
+     * \param relativeSpeed Relative speed of the objects at TCA.
+     */
+    ConjunctionEvent( const int firstObjectIndex, const int secondObjectIndex,
+                      const double timeOfClosestApproach, const double missDistance,
+                      const double relativeSpeed ):
+        firstObjectIndex_( firstObjectIndex ), secondObjectIndex_( secondObjectIndex ),
+        timeOfClosestApproach_( timeOfClosestApproach ), missDistance_( missDistance ),
+        relativeSpeed_( relativeSpeed ){ }
+
+    //! Index of first object (in list of screened objects); always smaller than secondObjectIndex_.
+    int firstObjectIndex_;
+
+    //! Index of second object (in list of screened objects).
+    int secondObjectIndex_;
+
+    //! Time of closest approach (TCA).
+    double timeOfClosestApproach_;
+
+    //! Distance between the objects at TCA.
+    double missDistance_;
+
+    //! Relative speed of the objects at TCA.
+    double relativeSpeed_;
+};
+
+//! Class defining the settings for conjunction screening.
+class ConjunctionScreeningSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param screeningDistance Distance below which a close approach is reported.
+     * \param startTime Start time of screening window.
+     * \param endTime End time of screening window.
+     * \param samplingTimeStep Time step with which the states of the objects are sampled. The motion in between two
+     * samples is represented by a cubic Hermite polynomial, so the time step should be (much) smaller than the orbital
+     * period of the objects (typically 30-120 s for objects in low Earth orbit).
+     * \param centralBodyGravitationalParameter Gravitational parameter of the central body, used to compute the apsis
+     * distances of the objects for the apogee/perigee filter. If NaN, this filter is not used.
+     * \param numberOfThreads Number of threads over which the screening is distributed.
+     * \param timeOfClosestApproachTolerance Absolute tolerance on the time of closest approach.
+     */
+    ConjunctionScreeningSettings( const double screeningDistance,
+                                  const double startTime,
+                                  const double endTime,
+                                  const double samplingTimeStep,
+                                  const double centralBodyGravitationalParameter = TUDAT_NAN,
+                                  const unsigned int numberOfThreads = 1,
+                                  const double timeOfClosestApproachTolerance = 1.0E-6 ):
+        screeningDistance_( screeningDistance ), startTime_( startTime ), endTime_( endTime ),
+        samplingTimeStep_( samplingTimeStep ), centralBodyGravitationalParameter_( centralBodyGravitationalParameter ),
+        numberOfThreads_( numberOfThreads ), timeOfClosestApproachTolerance_( timeOfClosestApproachTolerance ){ }
+
+    //! Destructor
+    virtual ~ConjunctionScreeningSettings( ){ }
+
+    //! Function to retrieve the epochs at which the states of the objects are sampled.
+    /*!
+     * Function to retrieve the epochs at which the states of the objects are sampled, from startTime_ to endTime_
+     * (inclusive) with a step of samplingTimeStep_ (last step may be shorter).
+     * \return Epochs at which the states of the objects are sampled.
+     */
+    std::vector< double > getSamplingEpochs( ) const;
+
+    //! Distance below which a close approach is reported.
+    double screeningDistance_;
+
+    //! Start time of screening window.
+    double startTime_;
+
+    //! End time of screening window.
+    double endTime_;
+
+    //! Time step with which the states of the objects are sampled.
+    double samplingTimeStep_;
+
+    //! Gravitational parameter of the central body (NaN if apogee/perigee filter is not used).
+    double centralBodyGravitationalParameter_;
+
+    //! Number of threads over which the screening is distributed.
+    unsigned int numberOfThreads_;
+
+    //! Absolute tolerance on the time of closest approach.
+    double timeOfClosestApproachTolerance_;
+};
+
+//! Function to compute the minimum periapsis and maximum apoapsis distance of an object from its sampled states.
+/*!
+ * Function to compute the minimum periapsis and maximum apoapsis distance of an object from the osculating Kepler
+ * orbits at its sampled states, in addition to the minimum and maximum sampled distance. For an unbound (parabolic or
+ * hyperbolic) state, the apoapsis distance is infinite.
+ * \param sampledStates Cartesian states of object w.r.t. central body, one state per column.
+ * \param centralBodyGravitationalParameter Gravitational parameter of the central body.
+ * \return Pair with minimum periapsis distance (first) and maximum apoapsis distance (second).
+ */
+std::pair< double, double > computeApsisDistanceRange( const SampledCartesianStates& sampledStates,
+                                                       const double centralBodyGravitationalParameter );
+
+//! Function to find all close approaches between a set of objects, from their sampled states.
+/*!
+ * Function to find all close approaches between a set of objects, from their states sampled at a common set of epochs.
+ * The motion of each object in between two epochs is represented by a cubic Hermite polynomial (using the sampled
+ * positions and velocities). The candidate pairs are found in three stages:
+ *
+ *  - Apogee/perigee filter: a pair of objects is rejected if the range of apsis distances of one of the objects (see
+ *    computeApsisDistanceRange) is separated from that of the other object by more than the screening distance (only
+ *    if the central body gravitational parameter is provided in the settings).
+ *  - Spatial filter: for each interval between two epochs, the polynomial arc of each object is enclosed in an
+ *    axis-aligned bounding box (from the convex hull of its Bezier control points). The boxes are sorted along the
+ *    x-axis and swept (sweep-and-prune), and pairs for which the boxes are separated by less than the screening distance
+ *    along all axes are retained. The intervals are distributed over the threads.
+ *  - Refinement: for each candidate pair and interval, the times of closest approach are found as the roots of the
+ *    range rate (i.e. inner product of relative position and relative velocity) going from negative to positive, using
+ *    a bisection root finder. An event is reported if the miss distance is below the screening distance.
+ *
+ * Minima of the distance at the start and end of the screening window (which are not a root of the range rate) are not
+ * reported.
+ * \param epochs Epochs at which the states are sampled (in ascending order).
+ * \param sampledStates Sampled Cartesian states of each object, one state per column for each of the epochs (w.r.t.
+ * the central body, if the apogee/perigee filter is used).
+ * \param screeningSettings Settings for the screening (the start/end time and sampling time step are not used).
+ * \return List of close approaches, sorted by time of closest approach.
+ */
+std::vector< ConjunctionEvent > screenConjunctions(
+        const std::vector< double >& epochs,
+        const std::vector< SampledCartesianStates >& sampledStates,
+        const std::shared_ptr< ConjunctionScreeningSettings > screeningSettings );
+
+//! Function to find all close approaches between a set of objects, from their ephemerides.
+/*!
+ * Function to find all close approaches between a set of objects, from their ephemerides (for instance
+ * TabulatedCartesianEphemeris objects created from propagation results). The states of the objects are sampled at the
+ * epochs defined by the screening settings, distributed over the threads such that each ephemeris object is only
+ * accessed by a single thread (ephemerides for different objects must therefore not share an interpolator). See the
+ * other screenConjunctions function for the screening algorithm.
+ * \param ephemerides Ephemerides of the objects that are to be screened (w.r.t. the central body, if the
+ * apogee/perigee filter is used).
+ * \param screeningSettings Settings for the screening.
+ * \return List of close approaches, sorted by time of closest approach.
+ */
+std::vector< ConjunctionEvent > screenConjunctions(
+        const std::vector< std::shared_ptr< Ephemeris > >& ephemerides,
+        const std::shared_ptr< ConjunctionScreeningSettings > screeningSettings );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CONJUNCTION_SCREENING_H
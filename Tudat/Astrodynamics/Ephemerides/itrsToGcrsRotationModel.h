@@ -20,6 +20,7 @@
 #include "Tudat/Mathematics/Interpolators/interpolator.h"
 #include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
 #include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+#include "Tudat/Astrodynamics/EarthOrientation/tabulatedEarthOrientationAnglesCalculator.h"
 
 namespace tudat
 {
@@ -64,17 +65,39 @@ public:
      *  \param anglesCalculator Class performing calculation to obtain earth orientation angle.
      *  \param timeScale Time scale in which input to this class (in getRotationToBaseFrame, getDerivativeOfRotationFromFrame) is provided,
      *  needed for correct input to EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs.
+     *  \param baseFrame Name of base frame (GCRS or J2000)
+     *  \param tabulatedAnglesCalculator Object providing the earth orientation angles from tabulated values (generated on
+     *  demand from anglesCalculator). If nullptr (default), the angles are computed directly by anglesCalculator at each call.
      */
     GcrsToItrsRotationModel( const std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator,
                              const basic_astrodynamics::TimeScales inputTimeScale  = basic_astrodynamics::tdb_scale,
-                             const std::string& baseFrame = "GCRS" ):
-        RotationalEphemeris( baseFrame, "ITRS" ), anglesCalculator_( anglesCalculator ), inputTimeScale_( inputTimeScale ),
+                             const std::string& baseFrame = "GCRS",
+                             const std::shared_ptr< earth_orientation::TabulatedEarthOrientationAnglesCalculator >
+                             tabulatedAnglesCalculator = nullptr ):
+        RotationalEphemeris( baseFrame, "ITRS" ), anglesCalculator_( anglesCalculator ),
+        tabulatedAnglesCalculator_( tabulatedAnglesCalculator ), inputTimeScale_( inputTimeScale ),
         frameBias_( Eigen::Matrix3d::Identity( ) )
 
     {
-        functionToGetRotationAngles = std::bind(
-                    &earth_orientation::EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs< double >,
-                    anglesCalculator, std::placeholders::_1, inputTimeScale );
+        if( tabulatedAnglesCalculator_ == nullptr )
+        {
+            functionToGetRotationAngles = std::bind(
+                        &earth_orientation::EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs< double >,
+                        anglesCalculator, std::placeholders::_1, inputTimeScale );
+        }
+        else
+        {
+            if( tabulatedAnglesCalculator_->getInputTimeScale( ) != inputTimeScale )
+            {
+                throw std::runtime_error( "Error in GCRS<->ITRS model, tabulated angles use inconsistent time scale" );
+            }
+
+            functionToGetRotationAngles = std::bind(
+                        &earth_orientation::TabulatedEarthOrientationAnglesCalculator::
+                        getRotationAnglesFromItrsToGcrs< double >,
+                        tabulatedAnglesCalculator_, std::placeholders::_1 );
+        }
+
         if( baseFrame == "J2000" )
         {
             frameBias_ = sofa_interface::getFrameBias(
@@ -95,8 +118,7 @@ public:
     Eigen::Quaterniond getRotationToBaseFrame( const double ephemerisTime )
     {
         return Eigen::Quaterniond( frameBias_ ) * earth_orientation::calculateRotationFromItrsToGcrs< double >(
-                    anglesCalculator_->getRotationAnglesFromItrsToGcrs< double >( ephemerisTime, inputTimeScale_ ),
-                    ephemerisTime );
+                    functionToGetRotationAngles( ephemerisTime ), ephemerisTime );
     }
 
     //! Function to calculate the rotation quaternion from ITRS to base frame
@@ -108,9 +130,18 @@ public:
      */
     Eigen::Quaterniond getRotationToBaseFrameFromExtendedTime( const Time ephemerisTime )
     {
-        return Eigen::Quaterniond( frameBias_ ) * earth_orientation::calculateRotationFromItrsToGcrs< Time >(
-                    anglesCalculator_->getRotationAnglesFromItrsToGcrs< Time >( ephemerisTime, inputTimeScale_ ),
-                    ephemerisTime );
+        if( tabulatedAnglesCalculator_ == nullptr )
+        {
+            return Eigen::Quaterniond( frameBias_ ) * earth_orientation::calculateRotationFromItrsToGcrs< Time >(
+                        anglesCalculator_->getRotationAnglesFromItrsToGcrs< Time >( ephemerisTime, inputTimeScale_ ),
+                        ephemerisTime );
+        }
+        else
+        {
+            return Eigen::Quaterniond( frameBias_ ) * earth_orientation::calculateRotationFromItrsToGcrs< Time >(
+                        tabulatedAnglesCalculator_->getRotationAnglesFromItrsToGcrs< Time >( ephemerisTime ),
+                        ephemerisTime );
+        }
     }
 
 
@@ -172,6 +203,16 @@ public:
         return anglesCalculator_;
     }
 
+    //! Function to retrieve object providing the earth orientation angles from tabulated values
+    /*!
+     * Function to retrieve object providing the earth orientation angles from tabulated values
+     * \return Object providing the earth orientation angles from tabulated values (nullptr if angles are not tabulated)
+     */
+    std::shared_ptr< earth_orientation::TabulatedEarthOrientationAnglesCalculator > getTabulatedAnglesCalculator( )
+    {
+        return tabulatedAnglesCalculator_;
+    }
+
     //! Function to retrieve time scale in which the input time for class functions are interpreted
     /*!
      * Function to retrieve time scale in which the input time for class functions are interpreted
@@ -200,6 +241,9 @@ private:
      */
     std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator_;
 
+    //! Object providing the earth orientation angles from tabulated values (nullptr if angles are not tabulated)
+    std::shared_ptr< earth_orientation::TabulatedEarthOrientationAnglesCalculator > tabulatedAnglesCalculator_;
+
     //! Time scale in which the input time for class functions are interpreted
     basic_astrodynamics::TimeScales inputTimeScale_;
 
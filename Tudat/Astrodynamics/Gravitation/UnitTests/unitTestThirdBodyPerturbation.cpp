@@ -283,6 +283,105 @@ BOOST_AUTO_TEST_CASE( testRealisticThirdBodyPerturbation )
                                        tolerance );
 }
 
+//! Test computation of third-body perturbations on many bodies in a single pass.
+BOOST_AUTO_TEST_CASE( testVectorizedThirdBodyPerturbation )
+{
+    // Define Sun-like perturber, and Earth-like central body.
+    const double gravitationalParameterOfPerturbingBody = 1.32712440018e20;
+    const Eigen::Vector3d perturberPosition( 1.2E11, -8.0E10, 3.0E10 );
+    const Eigen::Vector3d centralBodyPosition( 1.0E9, 2.0E9, -5.0E8 );
+
+    // Define set of orbiting bodies, spanning several blocks of the vectorized computation.
+    const int numberOfBodies = 600;
+    Eigen::Matrix3Xd positionsOfAffectedBodies = Eigen::Matrix3Xd::Random( 3, numberOfBodies ) * 4.2E7;
+    positionsOfAffectedBodies.colwise( ) += centralBodyPosition;
+
+    // Set tolerance w.r.t. direct acceleration, as third-body perturbation is a difference of two similar terms.
+    const double tolerance = 1.0E-13 * gravitation::computeGravitationalAcceleration(
+                centralBodyPosition, gravitationalParameterOfPerturbingBody, perturberPosition ).norm( );
+
+    for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        Eigen::Matrix3Xd computedAccelerations = gravitation::computeThirdBodyPerturbingAccelerations(
+                    gravitationalParameterOfPerturbingBody, perturberPosition, positionsOfAffectedBodies,
+                    centralBodyPosition, numberOfThreads );
+
+        // Compare against single-body computation.
+        BOOST_CHECK_EQUAL( computedAccelerations.cols( ), numberOfBodies );
+        for( int i = 0; i < numberOfBodies; i++ )
+        {
+            Eigen::Vector3d expectedAcceleration = gravitation::computeThirdBodyPerturbingAcceleration(
+                        gravitationalParameterOfPerturbingBody, perturberPosition,
+                        positionsOfAffectedBodies.col( i ), centralBodyPosition );
+            for( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( computedAccelerations( j, i ) - expectedAcceleration( j ), tolerance );
+            }
+        }
+    }
+}
+
+//! Test whether a central body acceleration model that is shared by third-body accelerations is updated once per time.
+BOOST_AUTO_TEST_CASE( testSharedCentralBodyThirdBodyPerturbation )
+{
+    const double gravitationalParameterOfPerturbingBody = 4.9028E12;
+    Eigen::Vector3d perturberPosition( 3.8E8, 1.0E7, 0.0 );
+    Eigen::Vector3d centralBodyPosition( 1.0E6, 0.0, 0.0 );
+    Eigen::Vector3d firstBodyPosition( 7.0E6, 0.0, 1.0E5 );
+    Eigen::Vector3d secondBodyPosition( 0.0, -2.6E7, 3.0E5 );
+
+    // Create central body model, counting number of retrievals of central body position.
+    int numberOfCentralBodyPositionCalls = 0;
+    gravitation::CentralGravitationalAccelerationModel3dPointer centralBodyAccelerationModel =
+            std::make_shared< gravitation::CentralGravitationalAccelerationModel3d >(
+                [ & ]( ){ numberOfCentralBodyPositionCalls++; return centralBodyPosition; },
+                gravitationalParameterOfPerturbingBody,
+                [ & ]( ){ return perturberPosition; } );
+
+    // Create third-body accelerations of two bodies, sharing central body model.
+    std::shared_ptr< gravitation::ThirdBodyCentralGravityAcceleration > firstThirdBodyAcceleration =
+            std::make_shared< gravitation::ThirdBodyCentralGravityAcceleration >(
+                std::make_shared< gravitation::CentralGravitationalAccelerationModel3d >(
+                    [ & ]( ){ return firstBodyPosition; }, gravitationalParameterOfPerturbingBody,
+                    [ & ]( ){ return perturberPosition; } ),
+                centralBodyAccelerationModel, "centralBody" );
+    std::shared_ptr< gravitation::ThirdBodyCentralGravityAcceleration > secondThirdBodyAcceleration =
+            std::make_shared< gravitation::ThirdBodyCentralGravityAcceleration >(
+                std::make_shared< gravitation::CentralGravitationalAccelerationModel3d >(
+                    [ & ]( ){ return secondBodyPosition; }, gravitationalParameterOfPerturbingBody,
+                    [ & ]( ){ return perturberPosition; } ),
+                centralBodyAccelerationModel, "centralBody" );
+
+    for( int i = 0; i < 3; i++ )
+    {
+        // Move bodies, reset models (as done before each state derivative evaluation), and update both models.
+        const double currentTime = 10.0 * static_cast< double >( i );
+        perturberPosition.y( ) += 1.0E6;
+        centralBodyPosition.x( ) += 1.0E3;
+        firstBodyPosition.z( ) -= 2.0E3;
+        secondBodyPosition.x( ) += 5.0E3;
+        firstThirdBodyAcceleration->resetTime( TUDAT_NAN );
+        secondThirdBodyAcceleration->resetTime( TUDAT_NAN );
+
+        numberOfCentralBodyPositionCalls = 0;
+        firstThirdBodyAcceleration->updateMembers( currentTime );
+        secondThirdBodyAcceleration->updateMembers( currentTime );
+        BOOST_CHECK_EQUAL( numberOfCentralBodyPositionCalls, 1 );
+
+        // Check that shared model provides up-to-date accelerations to both third-body accelerations.
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    firstThirdBodyAcceleration->getAcceleration( ),
+                    gravitation::computeThirdBodyPerturbingAcceleration(
+                        gravitationalParameterOfPerturbingBody, perturberPosition,
+                        firstBodyPosition, centralBodyPosition ), 1.0E-14 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    secondThirdBodyAcceleration->getAcceleration( ),
+                    gravitation::computeThirdBodyPerturbingAcceleration(
+                        gravitationalParameterOfPerturbingBody, perturberPosition,
+                        secondBodyPosition, centralBodyPosition ), 1.0E-14 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
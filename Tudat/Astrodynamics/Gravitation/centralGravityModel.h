@@ -130,7 +130,11 @@ Eigen::Vector3d computeGravitationalForce(
 //! Template class for central gravitational acceleration model.
 /*!
  * This template class implements a central gravitational acceleration model, i.e., only the
- * central term of the general spherical harmonics expansion.
+ * central term of the general spherical harmonics expansion. The acceleration is computed in updateMembers, and is
+ * not recomputed when updateMembers is called again with the same time, unless resetTime is called in between (as is
+ * done by the state derivative models before each evaluation). This applies to all instances, not only to those that
+ * are shared between third-body accelerations. Users that change the body positions without changing the time must
+ * therefore call resetTime (or update with a time of NaN, which is always recomputed) before updateMembers.
  * \tparam StateMatrix Data type for state matrix (default = Eigen::Vector3d).
  */
 template< typename StateMatrix = Eigen::Vector3d >
@@ -215,22 +219,22 @@ public:
     //! Get gravitational acceleration.
     /*!
      * Returns the gravitational acceleration computed using the input parameters provided to the
-     * class. This function serves as a wrapper for the computeGravitationalAcceleration()
-     * function.
+     * class, as calculated by the last call to updateMembers (using the
+     * computeGravitationalAcceleration() function).
      * \return Computed gravitational acceleration vector.
      */
     StateMatrix getAcceleration( )
     {
-        return computeGravitationalAcceleration(
-                    this->positionOfBodySubjectToAcceleration,
-                    this->gravitationalParameter,
-                    this->positionOfBodyExertingAcceleration );
+        return currentAcceleration_;
     }
 
     //! Update members.
     /*!
-     * Updates class members relevant for computing the central gravitational acceleration. In this
-     * case the function simply updates the members in the base class.
+     * Updates class members relevant for computing the central gravitational acceleration, and computes the
+     * acceleration. The update is skipped if the model was already updated to the requested time (and not reset since),
+     * so that a single model may be shared by several acceleration models (e.g. the acceleration of the central body
+     * in the third-body accelerations of a number of bodies orbiting that central body), and is evaluated only once
+     * per time.
      * \sa SphericalHarmonicsGravitationalAccelerationModelBase.
      * \param currentTime Time at which acceleration model is to be updated.
      */
@@ -239,12 +243,20 @@ public:
         if( !( this->currentTime_ == currentTime ) )
         {
             this->updateBaseMembers( );
+            currentAcceleration_ = computeGravitationalAcceleration(
+                        this->positionOfBodySubjectToAcceleration,
+                        this->gravitationalParameter,
+                        this->positionOfBodyExertingAcceleration );
+            this->currentTime_ = currentTime;
         }
     }
 
 
 protected:
 private:
+
+    //! Current gravitational acceleration, as computed by last call to updateMembers.
+    StateMatrix currentAcceleration_;
 };
 
 //! Typedef for CentralGravitationalAccelerationModel3d.
@@ -13,6 +13,9 @@
  *
  */
 
+#include <algorithm>
+
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Astrodynamics/Gravitation/centralGravityModel.h"
 #include "Tudat/Astrodynamics/Gravitation/thirdBodyPerturbation.h"
 
@@ -38,5 +41,44 @@ Eigen::Vector3d computeThirdBodyPerturbingAcceleration(
                                               positionOfPerturbingBody );
 }
 
+//! Compute perturbing accelerations by third body on a set of bodies orbiting the same central body.
+Eigen::Matrix3Xd computeThirdBodyPerturbingAccelerations(
+        const double gravitationalParameterOfPerturbingBody,
+        const Eigen::Vector3d& positionOfPerturbingBody,
+        const Eigen::Matrix3Xd& positionsOfAffectedBodies,
+        const Eigen::Vector3d& positionOfCentralBody,
+        const unsigned int numberOfThreads )
+{
+    // Compute acceleration of central body once for all affected bodies.
+    const Eigen::Vector3d centralBodyAcceleration = computeGravitationalAcceleration(
+                positionOfCentralBody, gravitationalParameterOfPerturbingBody, positionOfPerturbingBody );
+
+    // Compute direct accelerations per block of columns, so that blocks can be distributed over threads.
+    const unsigned int numberOfBodies = static_cast< unsigned int >( positionsOfAffectedBodies.cols( ) );
+    const unsigned int blockSize = 256;
+    const unsigned int numberOfBlocks = ( numberOfBodies + blockSize - 1 ) / blockSize;
+
+    Eigen::Matrix3Xd perturbingAccelerations( 3, numberOfBodies );
+    utilities::executeParallelForLoop(
+                numberOfBlocks, [ & ]( const unsigned int blockIndex, const unsigned int )
+    {
+        const unsigned int startColumn = blockIndex * blockSize;
+        const unsigned int numberOfColumns = std::min( blockSize, numberOfBodies - startColumn );
+
+        // Relative position of perturbing body w.r.t. affected bodies, and mu/r^3 per affected body.
+        const Eigen::Matrix3Xd relativePositions =
+                ( -positionsOfAffectedBodies.middleCols( startColumn, numberOfColumns ) ).colwise( ) +
+                positionOfPerturbingBody;
+        const Eigen::ArrayXd squaredDistances = relativePositions.colwise( ).squaredNorm( ).transpose( ).array( );
+        const Eigen::ArrayXd scalingFactors =
+                gravitationalParameterOfPerturbingBody / ( squaredDistances * squaredDistances.sqrt( ) );
+
+        perturbingAccelerations.middleCols( startColumn, numberOfColumns ) =
+                ( relativePositions * scalingFactors.matrix( ).asDiagonal( ) ).colwise( ) - centralBodyAcceleration;
+    }, numberOfThreads );
+
+    return perturbingAccelerations;
+}
+
 } // namespace gravitation
 } // namespace tudat
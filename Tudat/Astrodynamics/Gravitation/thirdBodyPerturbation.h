@@ -65,6 +65,30 @@ Eigen::Vector3d computeThirdBodyPerturbingAcceleration(
         const Eigen::Vector3d& positionOfAffectedBody,
         const Eigen::Vector3d& positionOfCentralBody = Eigen::Vector3d::Zero( ) );
 
+//! Compute perturbing accelerations by third body on a set of bodies orbiting the same central body.
+/*!
+ * Computes the perturbing accelerations on a set of point masses in orbit about the same central body (point mass),
+ * caused by a single third body (point mass), in a single pass (see computeThirdBodyPerturbingAcceleration for the
+ * acceleration model). The acceleration of the central body due to the third body is computed only once, and the
+ * direct accelerations are evaluated column-wise on the matrix of positions, so that the computation is vectorized
+ * over the affected bodies. For large sets of bodies, the columns may be distributed over several threads.
+ * \param gravitationalParameterOfPerturbingBody The gravitational parameter of the perturbing body [m^3/s^2].
+ * \param positionOfPerturbingBody The position of the third body, the body that causes the perturbations [m].
+ * \param positionsOfAffectedBodies The positions of the bodies that experience the perturbation, one body per
+ * column [m].
+ * \param positionOfCentralBody The position of the central body, the body w.r.t. which the accelerations are
+ * calculated (default=origin) [m].
+ * \param numberOfThreads Maximum number of threads that is to be used (default 1).
+ * \return Perturbing accelerations on the affected bodies, in the same column order as positionsOfAffectedBodies
+ * [m/s^2].
+ */
+Eigen::Matrix3Xd computeThirdBodyPerturbingAccelerations(
+        const double gravitationalParameterOfPerturbingBody,
+        const Eigen::Vector3d& positionOfPerturbingBody,
+        const Eigen::Matrix3Xd& positionsOfAffectedBodies,
+        const Eigen::Vector3d& positionOfCentralBody = Eigen::Vector3d::Zero( ),
+        const unsigned int numberOfThreads = 1 );
+
 //! Class for calculating third-body (gravitational) accelerations.
 /*!
  *  Class for calculating third-body (gravitational accelerations),
@@ -0,0 +1,129 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmark comparing the batch Izzo Lambert solver (solveLambertProblemsIzzo, Householder iterations) to a
+ *      loop over the single-problem solver (solveLambertProblemIzzo), for a grid of zero-revolution heliocentric
+ *      transfers between two near-circular orbits. The batch solver is timed with one thread and with all hardware
+ *      threads. Only built if BUILD_BENCHMARKS is set.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/MissionSegments/batchLambertSolverIzzo.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+using namespace tudat;
+using namespace tudat::mission_segments;
+
+//! Function to generate a position on a circular orbit in the ecliptic with a small random out-of-plane component.
+Eigen::Vector3d getPositionOnOrbit( const double radius, const double angle, std::mt19937& generator )
+{
+    std::uniform_real_distribution< double > outOfPlaneDistribution( -0.02, 0.02 );
+    return radius * Eigen::Vector3d( std::cos( angle ), std::sin( angle ), outOfPlaneDistribution( generator ) );
+}
+
+int main( )
+{
+    const double gravitationalParameter = 1.32712440018e20;
+    const double departureRadius = physical_constants::ASTRONOMICAL_UNIT;
+    const double arrivalRadius = 1.524 * physical_constants::ASTRONOMICAL_UNIT;
+    const int numberOfProblems = 200000;
+    const int numberOfRepetitions = 5;
+
+    // Generate transfers with random departure and arrival phases and times-of-flight between 100 and 400 days
+    std::mt19937 generator( 42 );
+    std::uniform_real_distribution< double > angleDistribution( 0.0, 2.0 * mathematical_constants::PI );
+    std::uniform_real_distribution< double > timeOfFlightDistribution(
+                100.0 * physical_constants::JULIAN_DAY, 400.0 * physical_constants::JULIAN_DAY );
+
+    Eigen::Matrix3Xd departurePositions( 3, numberOfProblems );
+    Eigen::Matrix3Xd arrivalPositions( 3, numberOfProblems );
+    Eigen::VectorXd timesOfFlight( numberOfProblems );
+    for( int i = 0; i < numberOfProblems; i++ )
+    {
+        const double departureAngle = angleDistribution( generator );
+        departurePositions.col( i ) = getPositionOnOrbit( departureRadius, departureAngle, generator );
+
+        // Keep the transfer angle away from 0 and 180 degrees, where the transfer plane is ill-defined
+        const double transferAngle = 0.1 + ( mathematical_constants::PI - 0.2 ) *
+                ( angleDistribution( generator ) / ( 2.0 * mathematical_constants::PI ) );
+        arrivalPositions.col( i ) = getPositionOnOrbit( arrivalRadius, departureAngle + transferAngle, generator );
+        timesOfFlight( i ) = timeOfFlightDistribution( generator );
+    }
+
+    // Loop over single-problem solver
+    Eigen::Matrix3Xd loopDepartureVelocities( 3, numberOfProblems );
+    Eigen::Matrix3Xd loopArrivalVelocities( 3, numberOfProblems );
+    double loopTime = TUDAT_NAN;
+    for( int repetition = 0; repetition < numberOfRepetitions; repetition++ )
+    {
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+        Eigen::Vector3d departureVelocity, arrivalVelocity;
+        for( int i = 0; i < numberOfProblems; i++ )
+        {
+            solveLambertProblemIzzo( departurePositions.col( i ), arrivalPositions.col( i ), timesOfFlight( i ),
+                                     gravitationalParameter, departureVelocity, arrivalVelocity );
+            loopDepartureVelocities.col( i ) = departureVelocity;
+            loopArrivalVelocities.col( i ) = arrivalVelocity;
+        }
+        const double currentTime = std::chrono::duration< double >(
+                    std::chrono::steady_clock::now( ) - startTime ).count( );
+        loopTime = ( repetition == 0 ) ? currentTime : std::min( loopTime, currentTime );
+    }
+
+    // Batch solver, single- and multi-threaded
+    const unsigned int numberOfHardwareThreads = std::max( 1u, std::thread::hardware_concurrency( ) );
+    Eigen::Matrix3Xd batchDepartureVelocities( 3, numberOfProblems );
+    Eigen::Matrix3Xd batchArrivalVelocities( 3, numberOfProblems );
+    double singleThreadedBatchTime = TUDAT_NAN;
+    double multiThreadedBatchTime = TUDAT_NAN;
+    for( int repetition = 0; repetition < numberOfRepetitions; repetition++ )
+    {
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+        solveLambertProblemsIzzo( departurePositions, arrivalPositions, timesOfFlight, gravitationalParameter,
+                                  batchDepartureVelocities, batchArrivalVelocities );
+        double currentTime = std::chrono::duration< double >(
+                    std::chrono::steady_clock::now( ) - startTime ).count( );
+        singleThreadedBatchTime = ( repetition == 0 ) ? currentTime : std::min( singleThreadedBatchTime, currentTime );
+
+        startTime = std::chrono::steady_clock::now( );
+        solveLambertProblemsIzzo( departurePositions, arrivalPositions, timesOfFlight, gravitationalParameter,
+                                  batchDepartureVelocities, batchArrivalVelocities, 0, false, false,
+                                  numberOfHardwareThreads );
+        currentTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+        multiThreadedBatchTime = ( repetition == 0 ) ? currentTime : std::min( multiThreadedBatchTime, currentTime );
+    }
+
+    // Compare results
+    const double maximumVelocityDifference = std::max(
+                ( batchDepartureVelocities - loopDepartureVelocities ).cwiseAbs( ).maxCoeff( ),
+                ( batchArrivalVelocities - loopArrivalVelocities ).cwiseAbs( ).maxCoeff( ) );
+
+    std::cout << numberOfProblems << " zero-revolution Lambert problems, best of " << numberOfRepetitions
+              << " runs" << std::endl
+              << "  Loop over solveLambertProblemIzzo:       " << loopTime << " s" << std::endl
+              << "  solveLambertProblemsIzzo, 1 thread:      " << singleThreadedBatchTime << " s, speed-up "
+              << loopTime / singleThreadedBatchTime << std::endl
+              << "  solveLambertProblemsIzzo, " << numberOfHardwareThreads << " thread(s):   "
+              << multiThreadedBatchTime << " s, speed-up " << loopTime / multiThreadedBatchTime << std::endl
+              << "  Maximum velocity difference:             " << maximumVelocityDifference << " m/s" << std::endl;
+
+    return EXIT_SUCCESS;
+}
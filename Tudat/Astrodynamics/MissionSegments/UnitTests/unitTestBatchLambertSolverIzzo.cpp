@@ -0,0 +1,246 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Izzo, D., Keplerian_Toolbox.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
+#include "Tudat/Astrodynamics/MissionSegments/batchLambertSolverIzzo.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace mission_segments;
+
+BOOST_AUTO_TEST_SUITE( test_batch_lambert_solver_izzo )
+
+//! Test single- and multi-revolution solutions against output from Keplerian_Toolbox PyKEP.
+BOOST_AUTO_TEST_CASE( testHouseholderLambertSolver )
+{
+    // Define problem (identical to multi-revolution Lambert targeter test).
+    const Eigen::Vector3d departurePosition( 4949101.422118526, 859402.44303969538,
+                                             -151535.83799466802 );
+    const Eigen::Vector3d arrivalPosition( 3648349.9884584765, 4281879.3154454567,
+                                           -755010.85145052616 );
+    const double timeOfFlight = 1.0307431655832210e+004;
+    const double gravitationalParameter = 398600.4418e9;
+
+    // Expected velocities at departure and arrival (0-rev, followed by left and right branches
+    // of 1- to 4-rev solutions).
+    std::vector< Eigen::Vector3d > expectedVelocitiesAtDeparture, expectedVelocitiesAtArrival;
+    expectedVelocitiesAtDeparture.push_back(
+                Eigen::Vector3d( 10096.683162831092, 4333.9040463806396, -764.1842151784972 ) );
+    expectedVelocitiesAtArrival.push_back(
+                Eigen::Vector3d( -8110.7563754983421, -6018.4641067312887, 1061.2176044421969 ) );
+    expectedVelocitiesAtDeparture.push_back(
+                Eigen::Vector3d( 8918.2511158620255, 4409.3440789101496, -777.48632833897398 ) );
+    expectedVelocitiesAtArrival.push_back(
+                Eigen::Vector3d( -7506.6196898648195, -4929.4928888157147, 869.20259750872378 ) );
+    expectedVelocitiesAtDeparture.push_back(
+                Eigen::Vector3d( -1265.9264854521089, 10660.067181950877, -1879.6574603427925 ) );
+    expectedVelocitiesAtArrival.push_back(
+                Eigen::Vector3d( -5584.601938281151, 8204.5589196619731, -1446.6851023487009 ) );
+    expectedVelocitiesAtDeparture.push_back(
+                Eigen::Vector3d( 7764.4367242290973, 4541.6234715146611, -800.81075424687731 ) );
+    expectedVelocitiesAtArrival.push_back(
+                Eigen::Vector3d( -6949.5242141064518, -3824.4260382745611, 674.34949627178969 ) );
+    expectedVelocitiesAtDeparture.push_back(
+                Eigen::Vector3d( -515.62716630712907, 9592.5976150608458, -1691.4337746149008 ) );
+    expectedVelocitiesAtArrival.push_back(
+                Eigen::Vector3d( -5368.5573571177865, 6833.3233167245971, -1204.8992686428019 ) );
+    expectedVelocitiesAtDeparture.push_back(
+                Eigen::Vector3d( 6500.2809323521278, 4773.7410262238855, -841.73934183818676 ) );
+    expectedVelocitiesAtArrival.push_back(
+                Eigen::Vector3d( -6390.5274190589034, -2555.7021700082605, 450.63924722762863 ) );
+    expectedVelocitiesAtDeparture.push_back(
+                Eigen::Vector3d( 339.85968372598705, 8524.895950642951, -1503.1691638306909 ) );
+    expectedVelocitiesAtArrival.push_back(
+                Eigen::Vector3d( -5210.2694492213532, 5369.2089601340958, -946.73640473328203 ) );
+    expectedVelocitiesAtDeparture.push_back(
+                Eigen::Vector3d( 4812.3627329648789, 5280.0203047688119, -931.01003841927343 ) );
+    expectedVelocitiesAtArrival.push_back(
+                Eigen::Vector3d( -5759.8462467502432, -731.11592991390376, 128.91546446958043 ) );
+    expectedVelocitiesAtDeparture.push_back(
+                Eigen::Vector3d( 1618.0817850471631, 7225.3760295124985, -1274.0287397672555 ) );
+    expectedVelocitiesAtArrival.push_back(
+                Eigen::Vector3d( -5148.0510872930045, 3378.294822960549, -595.68452607567178 ) );
+
+    HouseholderLambertSolverIzzo lambertSolver(
+                departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter );
+    BOOST_CHECK_EQUAL( lambertSolver.getMaximumNumberOfRevolutions( ), 4 );
+
+    Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+    for( unsigned int i = 0; i < expectedVelocitiesAtDeparture.size( ); i++ )
+    {
+        int numberOfRevolutions = ( i + 1 ) / 2;
+        bool isRightBranch = ( i > 0 ) && ( i % 2 == 0 );
+        BOOST_CHECK( lambertSolver.computeSolution(
+                         velocityAtDeparture, velocityAtArrival, numberOfRevolutions, isRightBranch ) );
+
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( velocityAtDeparture, expectedVelocitiesAtDeparture.at( i ), 1.0E-6 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( velocityAtArrival, expectedVelocitiesAtArrival.at( i ), 1.0E-6 );
+    }
+
+    // Check that no solution is returned for too many revolutions.
+    BOOST_CHECK( !lambertSolver.computeSolution( velocityAtDeparture, velocityAtArrival, 5, false ) );
+
+    // Check that invalid input is rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        HouseholderLambertSolverIzzo invalidLambertSolver(
+                    departurePosition, arrivalPosition, -timeOfFlight, gravitationalParameter );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+//! Test batch solution of Lambert problems against existing Izzo Lambert routine.
+BOOST_AUTO_TEST_CASE( testBatchLambertSolution )
+{
+    const double gravitationalParameter = 1.32712440018e20;
+    const double astronomicalUnit = 1.495978707e11;
+
+    // Generate set of heliocentric (prograde and long-way) transfers.
+    const int numberOfProblems = 200;
+    Eigen::Matrix3Xd departurePositions( 3, numberOfProblems );
+    Eigen::Matrix3Xd arrivalPositions( 3, numberOfProblems );
+    Eigen::VectorXd timesOfFlight( numberOfProblems );
+    for( int i = 0; i < numberOfProblems; i++ )
+    {
+        double departureAngle = 0.1 * static_cast< double >( i );
+        double arrivalAngle = departureAngle + 0.3 + 0.0271 * static_cast< double >( i );
+        departurePositions.col( i ) = astronomicalUnit * Eigen::Vector3d(
+                    std::cos( departureAngle ), std::sin( departureAngle ), 0.01 );
+        arrivalPositions.col( i ) = 1.5 * astronomicalUnit * Eigen::Vector3d(
+                    std::cos( arrivalAngle ), std::sin( arrivalAngle ), -0.02 );
+        timesOfFlight( i ) = ( 100.0 + 2.0 * static_cast< double >( i ) ) * physical_constants::JULIAN_DAY;
+    }
+
+    for( int isRetrograde = 0; isRetrograde < 2; isRetrograde++ )
+    {
+        // Solve problems in a single thread and in multiple threads.
+        Eigen::Matrix3Xd velocitiesAtDeparture, velocitiesAtArrival;
+        solveLambertProblemsIzzo( departurePositions, arrivalPositions, timesOfFlight, gravitationalParameter,
+                                  velocitiesAtDeparture, velocitiesAtArrival, 0, false, isRetrograde );
+
+        Eigen::Matrix3Xd parallelVelocitiesAtDeparture, parallelVelocitiesAtArrival;
+        solveLambertProblemsIzzo( departurePositions, arrivalPositions, timesOfFlight, gravitationalParameter,
+                                  parallelVelocitiesAtDeparture, parallelVelocitiesAtArrival, 0, false,
+                                  isRetrograde, 4 );
+
+        BOOST_CHECK( velocitiesAtDeparture == parallelVelocitiesAtDeparture );
+        BOOST_CHECK( velocitiesAtArrival == parallelVelocitiesAtArrival );
+
+        // Compare with existing routine.
+        Eigen::Vector3d expectedVelocityAtDeparture, expectedVelocityAtArrival;
+        for( int i = 0; i < numberOfProblems; i++ )
+        {
+            mission_segments::solveLambertProblemIzzo(
+                        departurePositions.col( i ), arrivalPositions.col( i ), timesOfFlight( i ),
+                        gravitationalParameter, expectedVelocityAtDeparture, expectedVelocityAtArrival,
+                        isRetrograde, 1.0E-12 );
+
+            BOOST_CHECK_SMALL( ( velocitiesAtDeparture.col( i ) - expectedVelocityAtDeparture ).norm( ) /
+                               expectedVelocityAtDeparture.norm( ), 1.0E-8 );
+            BOOST_CHECK_SMALL( ( velocitiesAtArrival.col( i ) - expectedVelocityAtArrival ).norm( ) /
+                               expectedVelocityAtArrival.norm( ), 1.0E-8 );
+        }
+    }
+
+    // Check that infeasible multi-revolution problems are flagged with NaN.
+    Eigen::Matrix3Xd velocitiesAtDeparture, velocitiesAtArrival;
+    solveLambertProblemsIzzo( departurePositions, arrivalPositions, timesOfFlight, gravitationalParameter,
+                              velocitiesAtDeparture, velocitiesAtArrival, 1 );
+    BOOST_CHECK( std::isnan( velocitiesAtDeparture( 0, 0 ) ) );
+    BOOST_CHECK( std::isnan( velocitiesAtArrival( 0, 0 ) ) );
+}
+
+//! Test porkchop plot generation for Earth-Mars transfers.
+BOOST_AUTO_TEST_CASE( testPorkchopExcessVelocities )
+{
+    using namespace ephemerides;
+
+    const double gravitationalParameter = 1.32712440018e20;
+
+    std::shared_ptr< Ephemeris > earthEphemeris =
+            std::make_shared< ApproximatePlanetPositions >( ApproximatePlanetPositions::earthMoonBarycenter );
+    std::shared_ptr< Ephemeris > marsEphemeris =
+            std::make_shared< ApproximatePlanetPositions >( ApproximatePlanetPositions::mars );
+
+    std::vector< double > departureTimes, timesOfFlight;
+    for( int i = 0; i < 12; i++ )
+    {
+        departureTimes.push_back( ( 7000.0 + 10.0 * static_cast< double >( i ) ) * physical_constants::JULIAN_DAY );
+    }
+    for( int i = 0; i < 9; i++ )
+    {
+        timesOfFlight.push_back( ( 150.0 + 20.0 * static_cast< double >( i ) ) * physical_constants::JULIAN_DAY );
+    }
+
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > excessVelocities = computePorkchopExcessVelocities(
+                earthEphemeris, marsEphemeris, gravitationalParameter, departureTimes, timesOfFlight );
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > parallelExcessVelocities = computePorkchopExcessVelocities(
+                earthEphemeris, marsEphemeris, gravitationalParameter, departureTimes, timesOfFlight, 0, false, 3 );
+
+    BOOST_CHECK_EQUAL( excessVelocities.first.rows( ), 12 );
+    BOOST_CHECK_EQUAL( excessVelocities.first.cols( ), 9 );
+    BOOST_CHECK( excessVelocities.first == parallelExcessVelocities.first );
+    BOOST_CHECK( excessVelocities.second == parallelExcessVelocities.second );
+
+    // Compare with direct computation using existing routine.
+    Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+    for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < timesOfFlight.size( ); j++ )
+        {
+            Eigen::Vector6d departureState = earthEphemeris->getCartesianState( departureTimes.at( i ) );
+            Eigen::Vector6d arrivalState = marsEphemeris->getCartesianState(
+                        departureTimes.at( i ) + timesOfFlight.at( j ) );
+            mission_segments::solveLambertProblemIzzo(
+                        departureState.segment( 0, 3 ), arrivalState.segment( 0, 3 ), timesOfFlight.at( j ),
+                        gravitationalParameter, velocityAtDeparture, velocityAtArrival, false, 1.0E-12 );
+
+            BOOST_CHECK_CLOSE_FRACTION( excessVelocities.first( i, j ),
+                                        ( velocityAtDeparture - departureState.segment( 3, 3 ) ).norm( ), 1.0E-6 );
+            BOOST_CHECK_CLOSE_FRACTION( excessVelocities.second( i, j ),
+                                        ( arrivalState.segment( 3, 3 ) - velocityAtArrival ).norm( ), 1.0E-6 );
+        }
+    }
+
+    // Allowing multiple revolutions can only decrease the total excess velocity.
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > multiRevolutionExcessVelocities = computePorkchopExcessVelocities(
+                earthEphemeris, marsEphemeris, gravitationalParameter, departureTimes, timesOfFlight, 2 );
+    BOOST_CHECK( ( ( multiRevolutionExcessVelocities.first + multiRevolutionExcessVelocities.second ).array( ) <=
+                   ( excessVelocities.first + excessVelocities.second ).array( ) ).all( ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,526 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Izzo, D. Revisiting Lambert's problem, Celestial Mechanics and Dynamical Astronomy,
+ *          121(1):1-15, 2015.
+ *      Izzo, D. lambert_problem.cpp, pykep.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <boost/math/special_functions.hpp> // for asinh and acosh
+
+#include <Eigen/Geometry>
+
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+#include "Tudat/Astrodynamics/MissionSegments/batchLambertSolverIzzo.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Constructor.
+HouseholderLambertSolverIzzo::HouseholderLambertSolverIzzo(
+        const Eigen::Vector3d& cartesianPositionAtDeparture,
+        const Eigen::Vector3d& cartesianPositionAtArrival,
+        const double timeOfFlight,
+        const double gravitationalParameter,
+        const bool isRetrograde,
+        const double convergenceTolerance,
+        const unsigned int maximumNumberOfIterations ):
+    gravitationalParameter_( gravitationalParameter ),
+    convergenceTolerance_( convergenceTolerance ),
+    maximumNumberOfIterations_( maximumNumberOfIterations ),
+    maximumNumberOfRevolutions_( -1 )
+{
+    // Sanity checks for specified time-of-flight and gravitational parameter.
+    if ( timeOfFlight <= 0.0 )
+    {
+        throw std::runtime_error( "Specified time-of-flight must be strictly positive: " +
+                                  std::to_string( timeOfFlight ) );
+    }
+    if ( gravitationalParameter <= 0.0 )
+    {
+        throw std::runtime_error( "Specified gravitational parameter must be strictly positive: " +
+                                  std::to_string( gravitationalParameter ) );
+    }
+
+    // Compute geometry of transfer triangle.
+    radiusAtDeparture_ = cartesianPositionAtDeparture.norm( );
+    radiusAtArrival_ = cartesianPositionAtArrival.norm( );
+    chord_ = ( cartesianPositionAtArrival - cartesianPositionAtDeparture ).norm( );
+    semiPerimeter_ = ( chord_ + radiusAtDeparture_ + radiusAtArrival_ ) / 2.0;
+
+    // Determine unit vectors, assuming prograde motion.
+    radialUnitVectorAtDeparture_ = cartesianPositionAtDeparture / radiusAtDeparture_;
+    radialUnitVectorAtArrival_ = cartesianPositionAtArrival / radiusAtArrival_;
+    const Eigen::Vector3d angularMomentumUnitVector =
+            radialUnitVectorAtDeparture_.cross( radialUnitVectorAtArrival_ ).normalized( );
+
+    lambdaParameter_ = std::sqrt( std::max( 1.0 - chord_ / semiPerimeter_, 0.0 ) );
+
+    // Long-way transfer if angular momentum of short-way transfer points 'down'.
+    if ( angularMomentumUnitVector.z( ) < 0.0 )
+    {
+        lambdaParameter_ = -lambdaParameter_;
+        transverseUnitVectorAtDeparture_ =
+                radialUnitVectorAtDeparture_.cross( angularMomentumUnitVector );
+        transverseUnitVectorAtArrival_ =
+                radialUnitVectorAtArrival_.cross( angularMomentumUnitVector );
+    }
+    else
+    {
+        transverseUnitVectorAtDeparture_ =
+                angularMomentumUnitVector.cross( radialUnitVectorAtDeparture_ );
+        transverseUnitVectorAtArrival_ =
+                angularMomentumUnitVector.cross( radialUnitVectorAtArrival_ );
+    }
+
+    // For retrograde motion, transfer direction is reversed.
+    if ( isRetrograde )
+    {
+        lambdaParameter_ = -lambdaParameter_;
+        transverseUnitVectorAtDeparture_ = -transverseUnitVectorAtDeparture_;
+        transverseUnitVectorAtArrival_ = -transverseUnitVectorAtArrival_;
+    }
+
+    // Compute normalized time-of-flight.
+    normalizedTimeOfFlight_ = std::sqrt( 2.0 * gravitationalParameter_ /
+                                         ( semiPerimeter_ * semiPerimeter_ * semiPerimeter_ ) ) *
+            timeOfFlight;
+}
+
+//! Get maximum number of revolutions for which a solution exists.
+int HouseholderLambertSolverIzzo::getMaximumNumberOfRevolutions( )
+{
+    using mathematical_constants::PI;
+
+    if ( maximumNumberOfRevolutions_ < 0 )
+    {
+        const double lambdaSquared = lambdaParameter_ * lambdaParameter_;
+
+        // Upper bound from time-of-flight of x=0 solution for each number of revolutions.
+        maximumNumberOfRevolutions_ = static_cast< int >( std::floor( normalizedTimeOfFlight_ / PI ) );
+        const double zeroRevolutionMinimumEnergyTimeOfFlight =
+                std::acos( lambdaParameter_ ) + lambdaParameter_ * std::sqrt( 1.0 - lambdaSquared );
+        const double minimumEnergyTimeOfFlight = zeroRevolutionMinimumEnergyTimeOfFlight +
+                static_cast< double >( maximumNumberOfRevolutions_ ) * PI;
+
+        // If time-of-flight is below that of minimum energy solution, find minimum time-of-flight
+        // for maximum number of revolutions using Halley iterations.
+        if ( maximumNumberOfRevolutions_ > 0 && normalizedTimeOfFlight_ < minimumEnergyTimeOfFlight )
+        {
+            double minimumTimeOfFlight = minimumEnergyTimeOfFlight;
+            double xOld = 0.0, xNew = 0.0;
+            double firstDerivative, secondDerivative, thirdDerivative;
+            for ( unsigned int i = 0; i < 13; i++ )
+            {
+                computeTimeOfFlightDerivatives( xOld, minimumTimeOfFlight, firstDerivative,
+                                                secondDerivative, thirdDerivative );
+                if ( firstDerivative != 0.0 )
+                {
+                    xNew = xOld - firstDerivative * secondDerivative /
+                            ( secondDerivative * secondDerivative -
+                              firstDerivative * thirdDerivative / 2.0 );
+                }
+                if ( std::fabs( xOld - xNew ) < 1.0e-13 )
+                {
+                    break;
+                }
+                minimumTimeOfFlight = computeNormalizedTimeOfFlight( xNew, maximumNumberOfRevolutions_ );
+                xOld = xNew;
+            }
+
+            if ( minimumTimeOfFlight > normalizedTimeOfFlight_ )
+            {
+                maximumNumberOfRevolutions_--;
+            }
+        }
+    }
+
+    return maximumNumberOfRevolutions_;
+}
+
+//! Compute solution for given number of revolutions and branch.
+bool HouseholderLambertSolverIzzo::computeSolution( Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                                    Eigen::Vector3d& cartesianVelocityAtArrival,
+                                                    const int numberOfRevolutions,
+                                                    const bool isRightBranch )
+{
+    using mathematical_constants::PI;
+
+    if ( numberOfRevolutions < 0 ||
+         ( numberOfRevolutions > 0 && numberOfRevolutions > getMaximumNumberOfRevolutions( ) ) )
+    {
+        return false;
+    }
+
+    const double lambdaSquared = lambdaParameter_ * lambdaParameter_;
+    const double lambdaCubed = lambdaSquared * lambdaParameter_;
+
+    // Compute initial guess of x-parameter (Izzo, 2015).
+    double xParameter;
+    if ( numberOfRevolutions == 0 )
+    {
+        const double minimumEnergyTimeOfFlight =
+                std::acos( lambdaParameter_ ) + lambdaParameter_ * std::sqrt( 1.0 - lambdaSquared );
+        const double parabolicTimeOfFlight = 2.0 / 3.0 * ( 1.0 - lambdaCubed );
+
+        if ( normalizedTimeOfFlight_ >= minimumEnergyTimeOfFlight )
+        {
+            xParameter = -( normalizedTimeOfFlight_ - minimumEnergyTimeOfFlight ) /
+                    ( normalizedTimeOfFlight_ - minimumEnergyTimeOfFlight + 4.0 );
+        }
+        else if ( normalizedTimeOfFlight_ <= parabolicTimeOfFlight )
+        {
+            xParameter = parabolicTimeOfFlight * ( parabolicTimeOfFlight - normalizedTimeOfFlight_ ) /
+                    ( 2.0 / 5.0 * ( 1.0 - lambdaSquared * lambdaCubed ) * normalizedTimeOfFlight_ ) + 1.0;
+        }
+        else
+        {
+            xParameter = std::pow( normalizedTimeOfFlight_ / minimumEnergyTimeOfFlight,
+                                   std::log( 2.0 ) / std::log( parabolicTimeOfFlight /
+                                                               minimumEnergyTimeOfFlight ) ) - 1.0;
+        }
+    }
+    else
+    {
+        const double revolutionAngle = static_cast< double >( numberOfRevolutions ) * PI;
+        double temporaryValue;
+        if ( isRightBranch )
+        {
+            temporaryValue = std::pow( 8.0 * normalizedTimeOfFlight_ / revolutionAngle, 2.0 / 3.0 );
+        }
+        else
+        {
+            temporaryValue = std::pow( ( revolutionAngle + PI ) / ( 8.0 * normalizedTimeOfFlight_ ),
+                                       2.0 / 3.0 );
+        }
+        xParameter = ( temporaryValue - 1.0 ) / ( temporaryValue + 1.0 );
+    }
+
+    // Solve time-of-flight equation.
+    if ( !solveTimeOfFlightEquation( xParameter, numberOfRevolutions ) )
+    {
+        return false;
+    }
+
+    // Reconstruct velocities (Izzo, 2015).
+    const double gammaParameter = std::sqrt( gravitationalParameter_ * semiPerimeter_ / 2.0 );
+    const double rhoParameter = ( radiusAtDeparture_ - radiusAtArrival_ ) / chord_;
+    const double sigmaParameter = std::sqrt( 1.0 - rhoParameter * rhoParameter );
+    const double yParameter = std::sqrt( 1.0 - lambdaSquared + lambdaSquared * xParameter * xParameter );
+
+    const double radialVelocityAtDeparture =
+            gammaParameter * ( ( lambdaParameter_ * yParameter - xParameter ) -
+                               rhoParameter * ( lambdaParameter_ * yParameter + xParameter ) ) /
+            radiusAtDeparture_;
+    const double radialVelocityAtArrival =
+            -gammaParameter * ( ( lambdaParameter_ * yParameter - xParameter ) +
+                                rhoParameter * ( lambdaParameter_ * yParameter + xParameter ) ) /
+            radiusAtArrival_;
+    const double transverseVelocityTimesRadius =
+            gammaParameter * sigmaParameter * ( yParameter + lambdaParameter_ * xParameter );
+
+    cartesianVelocityAtDeparture = radialVelocityAtDeparture * radialUnitVectorAtDeparture_ +
+            transverseVelocityTimesRadius / radiusAtDeparture_ * transverseUnitVectorAtDeparture_;
+    cartesianVelocityAtArrival = radialVelocityAtArrival * radialUnitVectorAtArrival_ +
+            transverseVelocityTimesRadius / radiusAtArrival_ * transverseUnitVectorAtArrival_;
+
+    return true;
+}
+
+//! Compute normalized time-of-flight as a function of the x-parameter.
+double HouseholderLambertSolverIzzo::computeNormalizedTimeOfFlight( const double xParameter,
+                                                                     const int numberOfRevolutions )
+{
+    using mathematical_constants::PI;
+
+    const double revolutionAngle = static_cast< double >( numberOfRevolutions ) * PI;
+    const double distanceToParabola = std::fabs( xParameter - 1.0 );
+
+    // Use Lagrange's equation in vicinity of parabolic solution.
+    if ( distanceToParabola < 0.2 && distanceToParabola > 0.01 )
+    {
+        const double semiMajorAxis = 1.0 / ( 1.0 - xParameter * xParameter );
+        if ( semiMajorAxis > 0.0 )
+        {
+            const double alphaParameter = 2.0 * std::acos( xParameter );
+            double betaParameter = 2.0 * std::asin(
+                        std::sqrt( lambdaParameter_ * lambdaParameter_ / semiMajorAxis ) );
+            if ( lambdaParameter_ < 0.0 )
+            {
+                betaParameter = -betaParameter;
+            }
+            return semiMajorAxis * std::sqrt( semiMajorAxis ) *
+                    ( ( alphaParameter - std::sin( alphaParameter ) ) -
+                      ( betaParameter - std::sin( betaParameter ) ) + 2.0 * revolutionAngle ) / 2.0;
+        }
+        else
+        {
+            const double alphaParameter = 2.0 * boost::math::acosh( xParameter );
+            double betaParameter = 2.0 * boost::math::asinh(
+                        std::sqrt( -lambdaParameter_ * lambdaParameter_ / semiMajorAxis ) );
+            if ( lambdaParameter_ < 0.0 )
+            {
+                betaParameter = -betaParameter;
+            }
+            return -semiMajorAxis * std::sqrt( -semiMajorAxis ) *
+                    ( ( betaParameter - std::sinh( betaParameter ) ) -
+                      ( alphaParameter - std::sinh( alphaParameter ) ) ) / 2.0;
+        }
+    }
+
+    const double energyParameter = xParameter * xParameter - 1.0;
+    const double absoluteEnergyParameter = std::fabs( energyParameter );
+    const double zParameter = std::sqrt( 1.0 + lambdaParameter_ * lambdaParameter_ * energyParameter );
+
+    // Use Battin's series close to parabolic solution.
+    if ( distanceToParabola < 0.01 )
+    {
+        const double etaParameter = zParameter - lambdaParameter_ * xParameter;
+        const double seriesArgument = 0.5 * ( 1.0 - lambdaParameter_ - xParameter * etaParameter );
+
+        // Evaluate hypergeometric function 2F1(3,1,5/2,S1).
+        double hypergeometricFunction = 1.0, currentTerm = 1.0;
+        for ( unsigned int j = 0; std::fabs( currentTerm ) > 1.0e-11; j++ )
+        {
+            currentTerm *= ( 3.0 + j ) * ( 1.0 + j ) / ( 2.5 + j ) * seriesArgument / ( j + 1.0 );
+            hypergeometricFunction += currentTerm;
+        }
+        hypergeometricFunction *= 4.0 / 3.0;
+
+        return ( etaParameter * etaParameter * etaParameter * hypergeometricFunction +
+                 4.0 * lambdaParameter_ * etaParameter ) / 2.0 +
+                revolutionAngle / std::pow( absoluteEnergyParameter, 1.5 );
+    }
+
+    // Otherwise, use Lancaster's expression.
+    const double yParameter = std::sqrt( absoluteEnergyParameter );
+    const double gParameter = xParameter * zParameter - lambdaParameter_ * energyParameter;
+    double dParameter;
+    if ( energyParameter < 0.0 )
+    {
+        dParameter = revolutionAngle + std::acos( gParameter );
+    }
+    else
+    {
+        const double fParameter = yParameter * ( zParameter - lambdaParameter_ * xParameter );
+        dParameter = std::log( fParameter + gParameter );
+    }
+    return ( xParameter - lambdaParameter_ * zParameter - dParameter / yParameter ) / energyParameter;
+}
+
+//! Compute first three derivatives of normalized time-of-flight w.r.t. the x-parameter.
+void HouseholderLambertSolverIzzo::computeTimeOfFlightDerivatives( const double xParameter,
+                                                                   const double normalizedTimeOfFlight,
+                                                                   double& firstDerivative,
+                                                                   double& secondDerivative,
+                                                                   double& thirdDerivative )
+{
+    const double lambdaSquared = lambdaParameter_ * lambdaParameter_;
+    const double lambdaCubed = lambdaSquared * lambdaParameter_;
+    const double oneMinusXSquared = 1.0 - xParameter * xParameter;
+    const double yParameter = std::sqrt( 1.0 - lambdaSquared * oneMinusXSquared );
+    const double ySquared = yParameter * yParameter;
+    const double yCubed = ySquared * yParameter;
+
+    firstDerivative = ( 3.0 * normalizedTimeOfFlight * xParameter - 2.0 +
+                        2.0 * lambdaCubed * xParameter / yParameter ) / oneMinusXSquared;
+    secondDerivative = ( 3.0 * normalizedTimeOfFlight + 5.0 * xParameter * firstDerivative +
+                         2.0 * ( 1.0 - lambdaSquared ) * lambdaCubed / yCubed ) / oneMinusXSquared;
+    thirdDerivative = ( 7.0 * xParameter * secondDerivative + 8.0 * firstDerivative -
+                        6.0 * ( 1.0 - lambdaSquared ) * lambdaSquared * lambdaCubed * xParameter /
+                        yCubed / ySquared ) / oneMinusXSquared;
+}
+
+//! Solve the time-of-flight equation using Householder iterations.
+bool HouseholderLambertSolverIzzo::solveTimeOfFlightEquation( double& xParameter,
+                                                              const int numberOfRevolutions )
+{
+    double firstDerivative, secondDerivative, thirdDerivative;
+    for ( unsigned int i = 0; i < maximumNumberOfIterations_; i++ )
+    {
+        const double currentTimeOfFlight = computeNormalizedTimeOfFlight( xParameter, numberOfRevolutions );
+        computeTimeOfFlightDerivatives( xParameter, currentTimeOfFlight, firstDerivative,
+                                        secondDerivative, thirdDerivative );
+
+        // Compute Householder (third-order) step.
+        const double timeOfFlightError = currentTimeOfFlight - normalizedTimeOfFlight_;
+        const double firstDerivativeSquared = firstDerivative * firstDerivative;
+        const double xNew = xParameter - timeOfFlightError *
+                ( firstDerivativeSquared - timeOfFlightError * secondDerivative / 2.0 ) /
+                ( firstDerivative * ( firstDerivativeSquared - timeOfFlightError * secondDerivative ) +
+                  thirdDerivative * timeOfFlightError * timeOfFlightError / 6.0 );
+
+        if ( !std::isfinite( xNew ) )
+        {
+            return false;
+        }
+
+        const double stepSize = std::fabs( xNew - xParameter );
+        xParameter = xNew;
+        if ( stepSize < convergenceTolerance_ )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! Solve a set of Lambert problems using Izzo's (2015) algorithm.
+void solveLambertProblemsIzzo( const Eigen::Matrix3Xd& cartesianPositionsAtDeparture,
+                               const Eigen::Matrix3Xd& cartesianPositionsAtArrival,
+                               const Eigen::VectorXd& timesOfFlight,
+                               const double gravitationalParameter,
+                               Eigen::Matrix3Xd& cartesianVelocitiesAtDeparture,
+                               Eigen::Matrix3Xd& cartesianVelocitiesAtArrival,
+                               const int numberOfRevolutions,
+                               const bool isRightBranch,
+                               const bool isRetrograde,
+                               const unsigned int numberOfThreads )
+{
+    const int numberOfProblems = timesOfFlight.rows( );
+    if ( cartesianPositionsAtDeparture.cols( ) != numberOfProblems ||
+         cartesianPositionsAtArrival.cols( ) != numberOfProblems )
+    {
+        throw std::runtime_error( "Error when solving Lambert problems, number of departure positions (" +
+                                  std::to_string( cartesianPositionsAtDeparture.cols( ) ) +
+                                  "), arrival positions (" +
+                                  std::to_string( cartesianPositionsAtArrival.cols( ) ) +
+                                  ") and times of flight (" + std::to_string( numberOfProblems ) +
+                                  ") is inconsistent" );
+    }
+
+    cartesianVelocitiesAtDeparture.resize( 3, numberOfProblems );
+    cartesianVelocitiesAtArrival.resize( 3, numberOfProblems );
+
+    utilities::executeParallelForLoop(
+                numberOfProblems, [ & ]( const unsigned int problemIndex, const unsigned int )
+    {
+        HouseholderLambertSolverIzzo lambertSolver(
+                    cartesianPositionsAtDeparture.col( problemIndex ),
+                    cartesianPositionsAtArrival.col( problemIndex ),
+                    timesOfFlight( problemIndex ), gravitationalParameter, isRetrograde );
+
+        Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+        if ( lambertSolver.computeSolution( velocityAtDeparture, velocityAtArrival,
+                                            numberOfRevolutions, isRightBranch ) )
+        {
+            cartesianVelocitiesAtDeparture.col( problemIndex ) = velocityAtDeparture;
+            cartesianVelocitiesAtArrival.col( problemIndex ) = velocityAtArrival;
+        }
+        else
+        {
+            cartesianVelocitiesAtDeparture.col( problemIndex ).setConstant(
+                        std::numeric_limits< double >::quiet_NaN( ) );
+            cartesianVelocitiesAtArrival.col( problemIndex ).setConstant(
+                        std::numeric_limits< double >::quiet_NaN( ) );
+        }
+    }, numberOfThreads );
+}
+
+//! Compute the excess velocities of a grid of Lambert transfers between two bodies (porkchop plot).
+std::pair< Eigen::MatrixXd, Eigen::MatrixXd > computePorkchopExcessVelocities(
+        const std::shared_ptr< ephemerides::Ephemeris > departureBodyEphemeris,
+        const std::shared_ptr< ephemerides::Ephemeris > arrivalBodyEphemeris,
+        const double gravitationalParameter,
+        const std::vector< double >& departureTimes,
+        const std::vector< double >& timesOfFlight,
+        const int maximumNumberOfRevolutions,
+        const bool isRetrograde,
+        const unsigned int numberOfThreads )
+{
+    const int numberOfDepartureTimes = departureTimes.size( );
+    const int numberOfTimesOfFlight = timesOfFlight.size( );
+
+    // Retrieve all body states in calling thread (ephemerides are not necessarily thread-safe).
+    Eigen::Matrix< double, 6, Eigen::Dynamic > departureBodyStates( 6, numberOfDepartureTimes );
+    Eigen::Matrix< double, 6, Eigen::Dynamic > arrivalBodyStates(
+                6, numberOfDepartureTimes * numberOfTimesOfFlight );
+    for ( int i = 0; i < numberOfDepartureTimes; i++ )
+    {
+        departureBodyStates.col( i ) = departureBodyEphemeris->getCartesianState( departureTimes.at( i ) );
+        for ( int j = 0; j < numberOfTimesOfFlight; j++ )
+        {
+            arrivalBodyStates.col( i * numberOfTimesOfFlight + j ) =
+                    arrivalBodyEphemeris->getCartesianState( departureTimes.at( i ) + timesOfFlight.at( j ) );
+        }
+    }
+
+    Eigen::MatrixXd departureExcessVelocities( numberOfDepartureTimes, numberOfTimesOfFlight );
+    Eigen::MatrixXd arrivalExcessVelocities( numberOfDepartureTimes, numberOfTimesOfFlight );
+
+    // Solve Lambert problems for all grid points.
+    utilities::executeParallelForLoop(
+                numberOfDepartureTimes * numberOfTimesOfFlight,
+                [ & ]( const unsigned int gridIndex, const unsigned int )
+    {
+        const int departureIndex = gridIndex / numberOfTimesOfFlight;
+        const int timeOfFlightIndex = gridIndex % numberOfTimesOfFlight;
+
+        const Eigen::Vector6d departureBodyState = departureBodyStates.col( departureIndex );
+        const Eigen::Vector6d arrivalBodyState = arrivalBodyStates.col( gridIndex );
+
+        HouseholderLambertSolverIzzo lambertSolver(
+                    departureBodyState.segment( 0, 3 ), arrivalBodyState.segment( 0, 3 ),
+                    timesOfFlight.at( timeOfFlightIndex ), gravitationalParameter, isRetrograde );
+
+        int numberOfRevolutionsToEvaluate = 0;
+        if ( maximumNumberOfRevolutions > 0 )
+        {
+            numberOfRevolutionsToEvaluate = std::min(
+                        maximumNumberOfRevolutions, lambertSolver.getMaximumNumberOfRevolutions( ) );
+        }
+
+        // Select solution with lowest total excess velocity.
+        double departureExcessVelocity = std::numeric_limits< double >::quiet_NaN( );
+        double arrivalExcessVelocity = std::numeric_limits< double >::quiet_NaN( );
+        Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+        for ( int numberOfRevolutions = 0; numberOfRevolutions <= numberOfRevolutionsToEvaluate;
+              numberOfRevolutions++ )
+        {
+            for ( int branch = 0; branch < ( numberOfRevolutions == 0 ? 1 : 2 ); branch++ )
+            {
+                if ( lambertSolver.computeSolution( velocityAtDeparture, velocityAtArrival,
+                                                    numberOfRevolutions, branch == 1 ) )
+                {
+                    const double currentDepartureExcessVelocity =
+                            ( velocityAtDeparture - departureBodyState.segment( 3, 3 ) ).norm( );
+                    const double currentArrivalExcessVelocity =
+                            ( arrivalBodyState.segment( 3, 3 ) - velocityAtArrival ).norm( );
+                    if ( std::isnan( departureExcessVelocity ) ||
+                         ( currentDepartureExcessVelocity + currentArrivalExcessVelocity <
+                           departureExcessVelocity + arrivalExcessVelocity ) )
+                    {
+                        departureExcessVelocity = currentDepartureExcessVelocity;
+                        arrivalExcessVelocity = currentArrivalExcessVelocity;
+                    }
+                }
+            }
+        }
+
+        departureExcessVelocities( departureIndex, timeOfFlightIndex ) = departureExcessVelocity;
+        arrivalExcessVelocities( departureIndex, timeOfFlightIndex ) = arrivalExcessVelocity;
+    }, numberOfThreads );
+
+    return std::make_pair( departureExcessVelocities, arrivalExcessVelocities );
+}
+
+} // namespace mission_segments
+} // namespace tudat
@@ -0,0 +1,250 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Izzo, D. Revisiting Lambert's problem, Celestial Mechanics and Dynamical Astronomy,
+ *          121(1):1-15, 2015.
+ *      Izzo, D. lambert_problem.cpp, pykep.
+ *
+ *    Notes
+ *      The solver in this file uses the formulation of Izzo (2015), in which the time-of-flight
+ *      equation is solved with Householder iterations from an analytical initial guess, typically
+ *      converging in two to four iterations. Contrary to the LambertTargeterIzzo classes, no
+ *      memory is allocated when solving a problem, so that large sets of problems (e.g. for
+ *      porkchop plots) can be solved efficiently, and in parallel.
+ *
+ */
+
+#ifndef TUDAT_BATCH_LAMBERT_SOLVER_IZZO_H
+#define TUDAT_BATCH_LAMBERT_SOLVER_IZZO_H
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Lambert problem solver using Izzo's (2015) algorithm with Householder iterations.
+/*!
+ * Lambert problem solver using Izzo's (2015) algorithm with Householder iterations. The geometry of
+ * the problem is processed upon construction, after which the solution for any number of
+ * revolutions and branch can be computed. The object is lightweight (no dynamic memory), and is
+ * intended to be created on the stack for each problem that is to be solved. The definition of the
+ * retrograde flag and the left/right branches is identical to that of the
+ * MultiRevolutionLambertTargeterIzzo class.
+ */
+class HouseholderLambertSolverIzzo
+{
+public:
+
+    // Ensure that correctly aligned pointers are generated (Eigen, 2013).
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    //! Constructor.
+    /*!
+     * Constructor, processes the geometry of the Lambert problem.
+     * \param cartesianPositionAtDeparture The position at departure in Cartesian coordinates.  [m]
+     * \param cartesianPositionAtArrival The position at arrival in Cartesian coordinates.      [m]
+     * \param timeOfFlight The time-of-flight between departure and arrival.                    [s]
+     * \param gravitationalParameter The gravitational parameter of the main body.       [m^3 s^-2]
+     * \param isRetrograde Flag to indicate retrograde motion, (default is false).
+     * \param convergenceTolerance Convergence tolerance for the change in the x-parameter in
+     *          the Householder iterations, (default is 1e-9).
+     * \param maximumNumberOfIterations The maximum number of Householder iterations,
+     *          (default is 15).
+     */
+    HouseholderLambertSolverIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                  const Eigen::Vector3d& cartesianPositionAtArrival,
+                                  const double timeOfFlight,
+                                  const double gravitationalParameter,
+                                  const bool isRetrograde = false,
+                                  const double convergenceTolerance = 1e-9,
+                                  const unsigned int maximumNumberOfIterations = 15 );
+
+    //! Get maximum number of revolutions for which a solution exists.
+    /*!
+     * Returns the maximum number of revolutions for which a solution to the problem exists
+     * (computed upon first call).
+     * \return Maximum number of revolutions.
+     */
+    int getMaximumNumberOfRevolutions( );
+
+    //! Compute solution for given number of revolutions and branch.
+    /*!
+     * Computes the velocities at departure and arrival for the given number of revolutions and
+     * branch. No exception is thrown if no solution is found, so that this function can be used
+     * efficiently when scanning a large number of (possibly infeasible) problems.
+     * \param cartesianVelocityAtDeparture Velocity at departure [m/s]. [Output]
+     * \param cartesianVelocityAtArrival Velocity at arrival [m/s]. [Output]
+     * \param numberOfRevolutions Number of full revolutions of the transfer (default 0).
+     * \param isRightBranch Flag to indicate whether the right (true) or left (false) branch is to
+     *          be used for multi-revolution solutions (ignored for zero revolutions).
+     * \return True if a solution was found, false if no solution exists for the number of
+     *          revolutions, or if the iterations did not converge (output velocities unchanged).
+     */
+    bool computeSolution( Eigen::Vector3d& cartesianVelocityAtDeparture,
+                          Eigen::Vector3d& cartesianVelocityAtArrival,
+                          const int numberOfRevolutions = 0,
+                          const bool isRightBranch = false );
+
+private:
+
+    //! Compute normalized time-of-flight as a function of the x-parameter.
+    /*!
+     * Computes normalized time-of-flight as a function of the x-parameter, using Battin's series
+     * close to the parabolic case, Lagrange's equation in its vicinity, and Lancaster's
+     * expression otherwise (Izzo, 2015).
+     * \param xParameter x-parameter.
+     * \param numberOfRevolutions Number of full revolutions.
+     * \return Normalized time-of-flight.
+     */
+    double computeNormalizedTimeOfFlight( const double xParameter,
+                                          const int numberOfRevolutions );
+
+    //! Compute first three derivatives of normalized time-of-flight w.r.t. the x-parameter.
+    /*!
+     * Computes first three derivatives of normalized time-of-flight w.r.t. the x-parameter.
+     * \param xParameter x-parameter.
+     * \param normalizedTimeOfFlight Normalized time-of-flight at xParameter.
+     * \param firstDerivative First derivative [Output].
+     * \param secondDerivative Second derivative [Output].
+     * \param thirdDerivative Third derivative [Output].
+     */
+    void computeTimeOfFlightDerivatives( const double xParameter,
+                                         const double normalizedTimeOfFlight,
+                                         double& firstDerivative,
+                                         double& secondDerivative,
+                                         double& thirdDerivative );
+
+    //! Solve the time-of-flight equation using Householder iterations.
+    /*!
+     * Solves the time-of-flight equation using Householder iterations.
+     * \param xParameter Initial guess of x-parameter, set to root upon return [Input/Output].
+     * \param numberOfRevolutions Number of full revolutions.
+     * \return True if the iterations converged.
+     */
+    bool solveTimeOfFlightEquation( double& xParameter, const int numberOfRevolutions );
+
+    //! Radial unit vector at departure.
+    Eigen::Vector3d radialUnitVectorAtDeparture_;
+
+    //! Radial unit vector at arrival.
+    Eigen::Vector3d radialUnitVectorAtArrival_;
+
+    //! Transverse unit vector at departure.
+    Eigen::Vector3d transverseUnitVectorAtDeparture_;
+
+    //! Transverse unit vector at arrival.
+    Eigen::Vector3d transverseUnitVectorAtArrival_;
+
+    //! Radius at departure.
+    double radiusAtDeparture_;
+
+    //! Radius at arrival.
+    double radiusAtArrival_;
+
+    //! Chord of transfer.
+    double chord_;
+
+    //! Semi-perimeter of transfer triangle.
+    double semiPerimeter_;
+
+    //! Lambda parameter of transfer geometry (negative for transfer angles larger than pi).
+    double lambdaParameter_;
+
+    //! Normalized time-of-flight.
+    double normalizedTimeOfFlight_;
+
+    //! Gravitational parameter.
+    double gravitationalParameter_;
+
+    //! Convergence tolerance of Householder iterations.
+    double convergenceTolerance_;
+
+    //! Maximum number of Householder iterations.
+    unsigned int maximumNumberOfIterations_;
+
+    //! Maximum number of revolutions (negative if not yet computed).
+    int maximumNumberOfRevolutions_;
+};
+
+//! Solve a set of Lambert problems using Izzo's (2015) algorithm.
+/*!
+ * Solves a set of Lambert problems using Izzo's (2015) algorithm (see HouseholderLambertSolverIzzo),
+ * where the problems are distributed over the requested number of threads. Problems for which no
+ * solution is found (e.g. a number of revolutions that is larger than possible) are not considered
+ * an error: the corresponding columns of the output velocities are set to NaN.
+ * \param cartesianPositionsAtDeparture Positions at departure (one column per problem) [m].
+ * \param cartesianPositionsAtArrival Positions at arrival (one column per problem) [m].
+ * \param timesOfFlight Time-of-flight of each problem [s].
+ * \param gravitationalParameter Gravitational parameter of the central body [m^3 s^-2].
+ * \param cartesianVelocitiesAtDeparture Velocities at departure (one column per problem) [Output].
+ * \param cartesianVelocitiesAtArrival Velocities at arrival (one column per problem) [Output].
+ * \param numberOfRevolutions Number of full revolutions of the transfers (default 0).
+ * \param isRightBranch Flag to indicate whether the right (true) or left (false) branch is to be
+ *          used for multi-revolution solutions (default false).
+ * \param isRetrograde Flag to indicate retrograde motion, (default is false).
+ * \param numberOfThreads Number of threads over which problems are distributed (default 1).
+ */
+void solveLambertProblemsIzzo( const Eigen::Matrix3Xd& cartesianPositionsAtDeparture,
+                               const Eigen::Matrix3Xd& cartesianPositionsAtArrival,
+                               const Eigen::VectorXd& timesOfFlight,
+                               const double gravitationalParameter,
+                               Eigen::Matrix3Xd& cartesianVelocitiesAtDeparture,
+                               Eigen::Matrix3Xd& cartesianVelocitiesAtArrival,
+                               const int numberOfRevolutions = 0,
+                               const bool isRightBranch = false,
+                               const bool isRetrograde = false,
+                               const unsigned int numberOfThreads = 1 );
+
+//! Compute the excess velocities of a grid of Lambert transfers between two bodies (porkchop plot).
+/*!
+ * Computes the norms of the excess velocities at departure and arrival of Lambert transfers between
+ * two bodies, for a grid of departure times and times of flight, as used for porkchop plots. The
+ * states of the bodies are retrieved from their ephemerides (e.g. ApproximatePlanetPositions or
+ * TabulatedCartesianEphemeris) before the Lambert problems are solved. The ephemerides are
+ * evaluated in the calling thread, so that they need not be thread-safe, after which the Lambert
+ * problems are distributed over the requested number of threads. If multiple revolutions are
+ * allowed, the solution (number of revolutions and branch) with the lowest sum of departure and
+ * arrival excess velocity is selected for each grid point. Grid points for which no solution is
+ * found are set to NaN.
+ * \param departureBodyEphemeris Ephemeris of departure body, w.r.t. the central body.
+ * \param arrivalBodyEphemeris Ephemeris of arrival body, w.r.t. the central body.
+ * \param gravitationalParameter Gravitational parameter of the central body [m^3 s^-2].
+ * \param departureTimes Departure times (in the time argument of the ephemerides) [s].
+ * \param timesOfFlight Times of flight [s].
+ * \param maximumNumberOfRevolutions Maximum number of full revolutions of the transfers
+ *          (default 0).
+ * \param isRetrograde Flag to indicate retrograde motion, (default is false).
+ * \param numberOfThreads Number of threads over which problems are distributed (default 1).
+ * \return Pair of matrices with the norms of the excess velocities at departure (first) and
+ *          arrival (second), with departure times along the rows and times of flight along the
+ *          columns [m/s].
+ */
+std::pair< Eigen::MatrixXd, Eigen::MatrixXd > computePorkchopExcessVelocities(
+        const std::shared_ptr< ephemerides::Ephemeris > departureBodyEphemeris,
+        const std::shared_ptr< ephemerides::Ephemeris > arrivalBodyEphemeris,
+        const double gravitationalParameter,
+        const std::vector< double >& departureTimes,
+        const std::vector< double >& timesOfFlight,
+        const int maximumNumberOfRevolutions = 0,
+        const bool isRetrograde = false,
+        const unsigned int numberOfThreads = 1 );
+
+} // namespace mission_segments
+} // namespace tudat
+
+#endif // TUDAT_BATCH_LAMBERT_SOLVER_IZZO_H
@@ -0,0 +1,271 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/missionGeometry.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/ElectroMagnetism/cannonBallRadiationPressureAcceleration.h"
+#include "Tudat/Astrodynamics/Gravitation/centralJ2J3J4GravityModel.h"
+#include "Tudat/Astrodynamics/Gravitation/thirdBodyPerturbation.h"
+#include "Tudat/Astrodynamics/Propagators/constellationStateDerivative.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createStateDerivativeModel.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_constellation_propagation )
+
+using namespace propagators;
+using namespace numerical_integrators;
+using namespace orbital_element_conversions;
+
+//! Function to create a set of initial Keplerian elements for a constellation of satellites in low Earth orbit.
+Eigen::MatrixXd getConstellationKeplerianElements( const int numberOfSatellites )
+{
+    Eigen::MatrixXd keplerianElements = Eigen::MatrixXd( numberOfSatellites, 6 );
+    for( int i = 0; i < numberOfSatellites; i++ )
+    {
+        keplerianElements( i, semiMajorAxisIndex ) = 6.778E6 + 5.0E3 * static_cast< double >( i % 50 );
+        keplerianElements( i, eccentricityIndex ) = 1.0E-3 * static_cast< double >( i % 7 );
+        keplerianElements( i, inclinationIndex ) = 0.1 + 1.4 * static_cast< double >( i % 11 ) / 11.0;
+        keplerianElements( i, argumentOfPeriapsisIndex ) = 0.3 * static_cast< double >( i % 13 );
+        keplerianElements( i, longitudeOfAscendingNodeIndex ) = 0.7 * static_cast< double >( i % 17 );
+        keplerianElements( i, trueAnomalyIndex ) = 0.9 * static_cast< double >( i );
+    }
+    return keplerianElements;
+}
+
+//! Function to convert a set of Keplerian elements (one row per satellite) to a constellation state.
+Eigen::MatrixXd getConstellationCartesianState( const Eigen::MatrixXd& keplerianElements,
+                                                const double gravitationalParameter )
+{
+    Eigen::MatrixXd cartesianStates = Eigen::MatrixXd( keplerianElements.rows( ), 6 );
+    for( int i = 0; i < keplerianElements.rows( ); i++ )
+    {
+        cartesianStates.row( i ) = convertKeplerianToCartesianElements(
+                    Eigen::Vector6d( keplerianElements.row( i ).transpose( ) ), gravitationalParameter ).transpose( );
+    }
+    return cartesianStates;
+}
+
+//! Test whether the accelerations of the constellation state derivative match those of the existing acceleration models
+BOOST_AUTO_TEST_CASE( testConstellationStateDerivative )
+{
+    const int numberOfSatellites = 700;
+    const double earthGravitationalParameter = 3.986004418E14;
+    const double earthRadius = 6378.1363E3;
+
+    // Define gravity field
+    const double j2 = 1.082626683E-3;
+    const double j3 = -2.53265649E-6;
+    const double j4 = -1.61962159E-6;
+    std::map< int, double > zonalCoefficients;
+    zonalCoefficients[ 2 ] = j2;
+    zonalCoefficients[ 3 ] = j3;
+    zonalCoefficients[ 4 ] = j4;
+
+    // Define atmosphere
+    const double densityAtReferenceAltitude = 1.0E-11;
+    const double referenceAltitude = 400.0E3;
+    const double scaleHeight = 60.0E3;
+    const double earthRotationRate = 7.2921150E-5;
+
+    // Define Sun and Moon
+    const double sunLuminosity = 3.839E26;
+    const double sunRadius = 6.96E8;
+    const double sunGravitationalParameter = 1.32712440018E20;
+    const double moonGravitationalParameter = 4.9028E12;
+    const Eigen::Vector3d sunPosition = ( Eigen::Vector3d( ) << 1.496E11, 1.0E9, 2.0E9 ).finished( );
+    const Eigen::Vector3d moonPosition = ( Eigen::Vector3d( ) << -1.0E8, 3.5E8, 1.0E7 ).finished( );
+
+    // Define satellite properties
+    Eigen::VectorXd dragCoefficientAreaToMassRatios = Eigen::VectorXd( numberOfSatellites );
+    Eigen::VectorXd radiationPressureCoefficientAreaToMassRatios = Eigen::VectorXd( numberOfSatellites );
+    for( int i = 0; i < numberOfSatellites; i++ )
+    {
+        dragCoefficientAreaToMassRatios( i ) = 0.01 + 1.0E-4 * static_cast< double >( i % 23 );
+        radiationPressureCoefficientAreaToMassRatios( i ) = 0.02 + 1.0E-4 * static_cast< double >( i % 29 );
+    }
+
+    const Eigen::MatrixXd constellationState = getConstellationCartesianState(
+                getConstellationKeplerianElements( numberOfSatellites ), earthGravitationalParameter );
+
+    // Compute state derivative with one and with several threads
+    std::vector< Eigen::MatrixXd > stateDerivatives;
+    std::vector< ConstellationStateDerivativePointer > stateDerivativeModels;
+    for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        ConstellationStateDerivativePointer stateDerivativeModel = std::make_shared< ConstellationStateDerivative >(
+                    numberOfSatellites, earthGravitationalParameter, numberOfThreads );
+        stateDerivativeModel->setZonalGravityField( earthRadius, { j2, j3, j4 } );
+        stateDerivativeModel->setExponentialAtmosphereDrag(
+                    densityAtReferenceAltitude, referenceAltitude, scaleHeight, earthRadius, earthRotationRate,
+                    dragCoefficientAreaToMassRatios );
+        stateDerivativeModel->setCannonballRadiationPressure(
+                    [ = ]( const double ){ return sunPosition; }, sunLuminosity, sunRadius, earthRadius,
+                    radiationPressureCoefficientAreaToMassRatios );
+        stateDerivativeModel->addPointMassThirdBody(
+                    sunGravitationalParameter, [ = ]( const double ){ return sunPosition; } );
+        stateDerivativeModel->addPointMassThirdBody(
+                    moonGravitationalParameter, [ = ]( const double ){ return moonPosition; } );
+
+        stateDerivatives.push_back( stateDerivativeModel->computeStateDerivative( 0.0, constellationState ) );
+        stateDerivativeModels.push_back( stateDerivativeModel );
+    }
+
+    // Check that results are independent of number of threads, and unchanged when the threads are reused.
+    BOOST_CHECK_EQUAL( ( stateDerivatives.at( 0 ) - stateDerivatives.at( 1 ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        BOOST_CHECK_EQUAL( ( stateDerivativeModels.at( 1 )->computeStateDerivative( 0.0, constellationState ) -
+                             stateDerivatives.at( 0 ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    }
+
+    // Compare each satellite's state derivative to that computed with existing acceleration models.
+    int numberOfShadowedSatellites = 0;
+    for( int i = 0; i < numberOfSatellites; i++ )
+    {
+        const Eigen::Vector3d position = constellationState.block( i, 0, 1, 3 ).transpose( );
+        const Eigen::Vector3d velocity = constellationState.block( i, 3, 1, 3 ).transpose( );
+
+        // Compute gravitational accelerations
+        const Eigen::Vector3d centralGravityAcceleration = gravitation::computeGravitationalAccelerationZonalSum(
+                    position, earthGravitationalParameter, earthRadius, zonalCoefficients, Eigen::Vector3d::Zero( ) );
+        const Eigen::Vector3d thirdBodyAcceleration =
+                gravitation::computeThirdBodyPerturbingAcceleration(
+                    sunGravitationalParameter, sunPosition, position ) +
+                gravitation::computeThirdBodyPerturbingAcceleration(
+                    moonGravitationalParameter, moonPosition, position );
+
+        // Compute drag acceleration
+        const Eigen::Vector3d airspeed = velocity - Eigen::Vector3d::UnitZ( ).cross( position ) * earthRotationRate;
+        const double density = densityAtReferenceAltitude *
+                std::exp( -( position.norm( ) - earthRadius - referenceAltitude ) / scaleHeight );
+        const Eigen::Vector3d dragAcceleration =
+                -0.5 * density * dragCoefficientAreaToMassRatios( i ) * airspeed.norm( ) * airspeed;
+
+        // Compute radiation pressure acceleration
+        const Eigen::Vector3d vectorToSun = sunPosition - position;
+        const double shadowFunction = mission_geometry::computeShadowFunction(
+                    sunPosition, sunRadius, Eigen::Vector3d::Zero( ), earthRadius, position );
+        if( shadowFunction < 1.0 )
+        {
+            numberOfShadowedSatellites++;
+        }
+        const double radiationPressure = shadowFunction * sunLuminosity / (
+                    4.0 * mathematical_constants::PI * vectorToSun.squaredNorm( ) * physical_constants::SPEED_OF_LIGHT );
+        const Eigen::Vector3d radiationPressureAcceleration =
+                electro_magnetism::computeCannonBallRadiationPressureAcceleration(
+                    radiationPressure, vectorToSun.normalized( ),
+                    radiationPressureCoefficientAreaToMassRatios( i ), 1.0, 1.0 );
+
+        // Compare each contribution at the level of its own magnitude.
+        const Eigen::Vector3d computedAcceleration = stateDerivatives.at( 0 ).block( i, 3, 1, 3 ).transpose( );
+        const double tolerance = 1.0E-14 * centralGravityAcceleration.norm( ) +
+                1.0E-12 * ( thirdBodyAcceleration.norm( ) + dragAcceleration.norm( ) +
+                            radiationPressureAcceleration.norm( ) );
+        BOOST_CHECK_SMALL( ( computedAcceleration - centralGravityAcceleration - thirdBodyAcceleration -
+                             dragAcceleration - radiationPressureAcceleration ).norm( ), tolerance );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( stateDerivatives.at( 0 )( i, j ), velocity( j ) );
+        }
+
+        // Check single-satellite state derivative
+        const Eigen::MatrixXd satelliteStateDerivative = stateDerivativeModels.at( 1 )->computeSatelliteStateDerivative(
+                    0.0, constellationState.row( i ), i );
+        BOOST_CHECK_EQUAL( ( satelliteStateDerivative - stateDerivatives.at( 0 ).row( i ) ).cwiseAbs( ).maxCoeff( ),
+                           0.0 );
+    }
+
+    // Check that the shadow model has been tested.
+    BOOST_CHECK( numberOfShadowedSatellites > 0 );
+
+    // Check that inconsistent input is rejected.
+    BOOST_CHECK_THROW( stateDerivativeModels.at( 0 )->computeStateDerivative(
+                           0.0, constellationState.topRows( numberOfSatellites - 1 ) ), std::runtime_error );
+
+    // Check that computing the state derivative from a loop on the threads of the same model is rejected (instead of
+    // deadlocking), and that the model can still be used afterwards.
+    BOOST_CHECK_THROW( stateDerivativeModels.at( 1 )->getParallelForLoopExecutor( )->executeParallelForLoop(
+                           4, [ & ]( const unsigned int, const unsigned int )
+    {
+        stateDerivativeModels.at( 1 )->computeStateDerivative( 0.0, constellationState );
+    } ), std::runtime_error );
+    BOOST_CHECK_EQUAL( ( stateDerivativeModels.at( 1 )->computeStateDerivative( 0.0, constellationState ) -
+                         stateDerivatives.at( 1 ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+}
+
+//! Test constellation propagation with common and per-satellite step size against Kepler orbit propagation.
+BOOST_AUTO_TEST_CASE( testConstellationKeplerPropagation )
+{
+    const int numberOfSatellites = 40;
+    const double earthGravitationalParameter = 3.986004418E14;
+    const double finalTime = 6000.0;
+
+    const Eigen::MatrixXd keplerianElements = getConstellationKeplerianElements( numberOfSatellites );
+    const Eigen::MatrixXd initialStates = getConstellationCartesianState(
+                keplerianElements, earthGravitationalParameter );
+
+    ConstellationStateDerivativePointer stateDerivativeModel = std::make_shared< ConstellationStateDerivative >(
+                numberOfSatellites, earthGravitationalParameter, 4 );
+
+    // Propagate with common fixed step size
+    std::map< double, Eigen::MatrixXd > commonStepStateHistory = performConstellationIntegration(
+                std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 5.0 ),
+                stateDerivativeModel, initialStates, finalTime );
+
+    // Propagate with per-satellite variable step size
+    std::vector< std::map< double, Eigen::Vector6d > > perSatelliteStateHistories =
+            performConstellationIntegrationPerSatellite(
+                std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                    0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0E-3, 1.0E3, 1.0E-12, 1.0E-12 ),
+                stateDerivativeModel, initialStates, finalTime );
+
+    BOOST_CHECK_EQUAL( commonStepStateHistory.rbegin( )->first, finalTime );
+    BOOST_CHECK_EQUAL( static_cast< int >( perSatelliteStateHistories.size( ) ), numberOfSatellites );
+
+    for( int i = 0; i < numberOfSatellites; i++ )
+    {
+        const Eigen::Vector6d expectedFinalState = convertKeplerianToCartesianElements(
+                    propagateKeplerOrbit( Eigen::Vector6d( keplerianElements.row( i ).transpose( ) ),
+                                          finalTime, earthGravitationalParameter ),
+                    earthGravitationalParameter );
+
+        const Eigen::Vector6d commonStepFinalState = commonStepStateHistory.rbegin( )->second.row( i ).transpose( );
+        BOOST_CHECK_EQUAL( perSatelliteStateHistories.at( i ).rbegin( )->first, finalTime );
+        const Eigen::Vector6d perSatelliteFinalState = perSatelliteStateHistories.at( i ).rbegin( )->second;
+
+        BOOST_CHECK_SMALL( ( commonStepFinalState - expectedFinalState ).segment( 0, 3 ).norm( ), 5.0E-3 );
+        BOOST_CHECK_SMALL( ( commonStepFinalState - expectedFinalState ).segment( 3, 3 ).norm( ), 5.0E-6 );
+        BOOST_CHECK_SMALL( ( perSatelliteFinalState - expectedFinalState ).segment( 0, 3 ).norm( ), 1.0E-3 );
+        BOOST_CHECK_SMALL( ( perSatelliteFinalState - expectedFinalState ).segment( 3, 3 ).norm( ), 1.0E-6 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
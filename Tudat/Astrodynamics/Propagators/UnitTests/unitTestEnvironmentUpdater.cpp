@@ -585,6 +585,98 @@ BOOST_AUTO_TEST_CASE( test_NonConservativeForceEnvironmentUpdate )
     }
 }
 
+//! Test whether time-only environment updates are skipped if the time is unchanged, and state-dependent updates are not.
+BOOST_AUTO_TEST_CASE( test_TimeOnlyEnvironmentUpdateSkipping )
+{
+    // Load Spice kernels
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Create bodies
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( { "Earth", "Sun", "Moon" }, 0.0, 10.0 * 86400.0 );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Create accelerations, requiring translational states of Earth and Sun, and rotational state of Earth.
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Moon" ][ "Sun" ].push_back(
+                std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationSettingsMap[ "Moon" ][ "Earth" ].push_back(
+                std::make_shared< SphericalHarmonicAccelerationSettings >( 2, 2 ) );
+    std::map< std::string, std::string > centralBodies;
+    centralBodies[ "Moon" ] = "SSB";
+    AccelerationMap accelerationsMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettingsMap, centralBodies );
+
+    double testTime = 2.0 * 86400.0;
+    std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                std::vector< std::string >{ "SSB" }, accelerationsMap, std::vector< std::string >{ "Moon" },
+                getInitialStateOfBody( "Moon", "SSB", bodyMap, 0.0 ), testTime );
+    std::shared_ptr< propagators::EnvironmentUpdater< double, double > > updater =
+            createEnvironmentUpdaterForDynamicalEquations< double, double >( propagatorSettings, bodyMap );
+    updater->setUpdateTimingActive( true );
+
+    // Check dependency type of all update functions.
+    std::vector< EnvironmentUpdateStatistics > updateStatistics = updater->getUpdateStatistics( );
+    BOOST_CHECK_EQUAL( updateStatistics.size( ), 3 );
+    for( unsigned int i = 0; i < updateStatistics.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( updateStatistics.at( i ).isTimeOnlyUpdate_, true );
+        BOOST_CHECK_EQUAL( updateStatistics.at( i ).numberOfEvaluations_, 0 );
+    }
+
+    // Update environment, and manually modify state of Earth.
+    std::unordered_map< IntegratedStateType, Eigen::VectorXd > integratedStateToSet;
+    integratedStateToSet[ translational_state ] =
+            ( Eigen::VectorXd( 6 ) << 1.44E6, 2.234E8, -3343.246E7, 1.2E4, 1.344E3, -22.343E3 ).finished( );
+    updater->updateEnvironment( testTime, integratedStateToSet );
+    bodyMap.at( "Earth" )->setState( Eigen::Vector6d::Zero( ) );
+
+    // Update environment at same time, with different state: only integrated state should be modified.
+    integratedStateToSet[ translational_state ] *= 1.1;
+    updater->updateEnvironment( testTime, integratedStateToSet );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                bodyMap.at( "Earth" )->getState( ), Eigen::Vector6d::Zero( ),
+                std::numeric_limits< double >::epsilon( ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                bodyMap.at( "Moon" )->getState( ), integratedStateToSet.at( translational_state ),
+                std::numeric_limits< double >::epsilon( ) );
+
+    updateStatistics = updater->getUpdateStatistics( );
+    for( unsigned int i = 0; i < updateStatistics.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( updateStatistics.at( i ).numberOfEvaluations_, 1 );
+        BOOST_CHECK_EQUAL( updateStatistics.at( i ).numberOfSkippedEvaluations_, 1 );
+        BOOST_CHECK( updateStatistics.at( i ).totalEvaluationTime_ >= 0.0 );
+    }
+
+    // Force update at same time, and check whether state of Earth is recomputed.
+    updater->resetCurrentTime( );
+    updater->updateEnvironment( testTime, integratedStateToSet );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                bodyMap.at( "Earth" )->getState( ),
+                bodyMap.at( "Earth" )->getEphemeris( )->getCartesianState( testTime ),
+                std::numeric_limits< double >::epsilon( ) );
+
+    // Update at new time, and check whether all models are updated.
+    updater->updateEnvironment( 0.5 * testTime, integratedStateToSet );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                bodyMap.at( "Sun" )->getState( ),
+                bodyMap.at( "Sun" )->getEphemeris( )->getCartesianState( 0.5 * testTime ),
+                std::numeric_limits< double >::epsilon( ) );
+
+    updateStatistics = updater->getUpdateStatistics( );
+    for( unsigned int i = 0; i < updateStatistics.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( updateStatistics.at( i ).numberOfEvaluations_, 3 );
+        BOOST_CHECK_EQUAL( updateStatistics.at( i ).numberOfSkippedEvaluations_, 1 );
+    }
+
+    updater->resetUpdateStatistics( );
+    BOOST_CHECK_EQUAL( updater->getUpdateStatistics( ).at( 0 ).numberOfEvaluations_, 0 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -390,6 +390,304 @@ BOOST_AUTO_TEST_CASE( testFullPropagationMGAwithDSM )
     }
 }
 
+//! Test of the repeated (multi-threaded) full propagation of a MGA trajectory including deep-space manoeuvres, using
+//! PatchedConicsFullProblemPropagator, against the results of fullPropagationPatchedConicsTrajectory
+BOOST_AUTO_TEST_CASE( testPatchedConicsFullProblemPropagator )
+{
+    // Specify number and type of legs.
+    int numberOfLegs = 5;
+    std::vector< transfer_trajectories::TransferLegType > legTypeVector;
+    legTypeVector.resize( numberOfLegs );
+    legTypeVector[ 0 ] = transfer_trajectories::mga1DsmVelocity_Departure;
+    legTypeVector[ 1 ] = transfer_trajectories::mga1DsmVelocity_Swingby;
+    legTypeVector[ 2 ] = transfer_trajectories::mga1DsmVelocity_Swingby;
+    legTypeVector[ 3 ] = transfer_trajectories::mga1DsmVelocity_Swingby;
+    legTypeVector[ 4 ] = transfer_trajectories::capture;
+
+    // Name of the bodies involved in the trajectory
+    std::vector< std::string > transferBodyTrajectory;
+    transferBodyTrajectory.push_back("Earth");
+    transferBodyTrajectory.push_back("Earth");
+    transferBodyTrajectory.push_back("Venus");
+    transferBodyTrajectory.push_back("Venus");
+    transferBodyTrajectory.push_back("Mercury");
+
+    std::string centralBody = "Sun";
+    std::string bodyToPropagate = "spacecraft";
+
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Define gravitational parameter for each transfer body.
+    std::vector< double > gravitationalParametersTransferBodies;
+    for( unsigned int i = 0; i < transferBodyTrajectory.size( ); i++ )
+    {
+        gravitationalParametersTransferBodies.push_back(
+                    simulation_setup::createGravityFieldModel(
+                        simulation_setup::getDefaultGravityFieldSettings( transferBodyTrajectory.at( i ), TUDAT_NAN, TUDAT_NAN ),
+                        transferBodyTrajectory.at( i ) )->getGravitationalParameter( ) );
+    }
+
+    // Define function to create body map, with new (not thread-safe) ephemeris objects for each call.
+    std::map< std::string, ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData > ephemerisBodies;
+    ephemerisBodies[ "Earth" ] = ephemerides::ApproximatePlanetPositionsBase::earthMoonBarycenter;
+    ephemerisBodies[ "Venus" ] = ephemerides::ApproximatePlanetPositionsBase::venus;
+    ephemerisBodies[ "Mercury" ] = ephemerides::ApproximatePlanetPositionsBase::mercury;
+    std::function< simulation_setup::NamedBodyMap( ) > bodyMapCreationFunction = [ & ]( )
+    {
+        std::vector< ephemerides::EphemerisPointer > ephemerisVectorTransferBodies;
+        for( unsigned int i = 0; i < transferBodyTrajectory.size( ); i++ )
+        {
+            ephemerisVectorTransferBodies.push_back(
+                        std::make_shared< ephemerides::ApproximatePlanetPositions >(
+                            ephemerisBodies.at( transferBodyTrajectory.at( i ) ) ) );
+        }
+        return propagators::setupBodyMapFromUserDefinedEphemeridesForPatchedConicsTrajectory(
+                    centralBody, bodyToPropagate, transferBodyTrajectory, ephemerisVectorTransferBodies,
+                    gravitationalParametersTransferBodies, "ECLIPJ2000" );
+    };
+
+    // Define accelerations (point-mass gravity of central body).
+    simulation_setup::SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ bodyToPropagate ][ centralBody ].push_back(
+                std::make_shared< simulation_setup::AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+
+    // Create variable vector (see testFullPropagationMGAwithDSM).
+    std::vector< double > variableVector;
+    variableVector.push_back( 1171.64503236 * physical_constants::JULIAN_DAY);
+    variableVector.push_back( 399.999999715 * physical_constants::JULIAN_DAY);
+    variableVector.push_back( 178.372255301 * physical_constants::JULIAN_DAY);
+    variableVector.push_back( 299.223139512 * physical_constants::JULIAN_DAY);
+    variableVector.push_back( 180.510754824 * physical_constants::JULIAN_DAY);
+    variableVector.push_back( 1.0);
+    variableVector.push_back( 0.234594654679 );
+    variableVector.push_back( 1408.99421278 );
+    variableVector.push_back( 0.37992647165 * 2 * 3.14159265358979 );
+    variableVector.push_back( std::acos(  2 * 0.498004040298 - 1. ) - 3.14159265358979 / 2 );
+    variableVector.push_back( 0.0964769387134 );
+    variableVector.push_back( 1.35077257078 );
+    variableVector.push_back( 1.80629232251 * 6.378e6 );
+    variableVector.push_back( 0.0 );
+    variableVector.push_back( 0.829948744508);
+    variableVector.push_back( 1.09554368115 );
+    variableVector.push_back( 3.04129845698 * 6.052e6 );
+    variableVector.push_back( 0.0 );
+    variableVector.push_back( 0.317174785637 );
+    variableVector.push_back( 1.34317576594 );
+    variableVector.push_back( 1.10000000891 * 6.052e6 );
+    variableVector.push_back( 0.0 );
+
+    std::vector< double > minimumPericenterRadii( numberOfLegs, TUDAT_NAN );
+    std::vector< double > semiMajorAxes( 2, std::numeric_limits< double >::infinity( ) );
+    std::vector< double > eccentricities( 2, 0.0 );
+
+    // Define integrator settings.
+    std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings =
+            std::make_shared < numerical_integrators::IntegratorSettings < > >(
+                numerical_integrators::rungeKutta4, 0.0, 1000.0 );
+
+    for( int terminationType = 0; terminationType < 2; terminationType++ )
+    {
+        // Compute reference results.
+        simulation_setup::NamedBodyMap bodyMap = bodyMapCreationFunction( );
+        std::vector< basic_astrodynamics::AccelerationMap > accelerationMap = propagators::setupAccelerationMapPatchedConicsTrajectory(
+                    transferBodyTrajectory.size( ), centralBody, bodyToPropagate, bodyMap );
+
+        std::map< int, std::map< double, Eigen::Vector6d > > referencePatchedConicsResultForEachLeg;
+        std::map< int, std::map< double, Eigen::Vector6d > > referenceFullProblemResultForEachLeg;
+        std::map< int, std::map< double, Eigen::VectorXd > > referenceDependentVariableResultForEachLeg;
+        propagators::fullPropagationPatchedConicsTrajectory(
+                    bodyMap, accelerationMap, transferBodyTrajectory, centralBody, bodyToPropagate, legTypeVector, variableVector,
+                    minimumPericenterRadii, semiMajorAxes, eccentricities, integratorSettings, referencePatchedConicsResultForEachLeg,
+                    referenceFullProblemResultForEachLeg, referenceDependentVariableResultForEachLeg,
+                    static_cast< bool >( terminationType ) );
+
+        for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+        {
+            propagators::PatchedConicsFullProblemPropagator fullProblemPropagator(
+                        bodyMapCreationFunction, { accelerationSettings }, transferBodyTrajectory, centralBody, bodyToPropagate,
+                        legTypeVector, minimumPericenterRadii, semiMajorAxes, eccentricities, integratorSettings, numberOfThreads,
+                        static_cast< bool >( terminationType ) );
+            BOOST_CHECK_EQUAL( fullProblemPropagator.getNumberOfThreads( ), numberOfThreads );
+
+            // Propagate twice, to check reuse of body maps.
+            for( int run = 0; run < 2; run++ )
+            {
+                std::map< int, std::map< double, Eigen::Vector6d > > patchedConicsResultForEachLeg;
+                std::map< int, std::map< double, Eigen::Vector6d > > fullProblemResultForEachLeg;
+                std::map< int, std::map< double, Eigen::VectorXd > > dependentVariableResultForEachLeg;
+                fullProblemPropagator.propagateTrajectory(
+                            variableVector, patchedConicsResultForEachLeg, fullProblemResultForEachLeg,
+                            dependentVariableResultForEachLeg );
+
+                BOOST_CHECK_EQUAL( patchedConicsResultForEachLeg.size( ), referencePatchedConicsResultForEachLeg.size( ) );
+                BOOST_CHECK_EQUAL( fullProblemResultForEachLeg.size( ), referenceFullProblemResultForEachLeg.size( ) );
+                for( auto itr : referenceFullProblemResultForEachLeg )
+                {
+                    BOOST_CHECK_EQUAL( fullProblemResultForEachLeg.at( itr.first ).size( ), itr.second.size( ) );
+                    for( auto innerItr : itr.second )
+                    {
+                        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                                    fullProblemResultForEachLeg.at( itr.first ).at( innerItr.first ), innerItr.second, 1.0E-12 );
+                        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                                    patchedConicsResultForEachLeg.at( itr.first ).at( innerItr.first ),
+                                    referencePatchedConicsResultForEachLeg.at( itr.first ).at( innerItr.first ), 1.0E-12 );
+                    }
+                }
+            }
+
+            // Check state differences at departure and arrival.
+            std::map< int, std::pair< Eigen::Vector6d, Eigen::Vector6d > > stateDifferences =
+                    fullProblemPropagator.getDifferenceFullProblemWrtPatchedConicsTrajectory( variableVector );
+            BOOST_CHECK_EQUAL( stateDifferences.size( ), referenceFullProblemResultForEachLeg.size( ) );
+            for( auto itr : stateDifferences )
+            {
+                Eigen::Vector6d referenceDepartureDifference =
+                        referencePatchedConicsResultForEachLeg.at( itr.first ).begin( )->second -
+                        referenceFullProblemResultForEachLeg.at( itr.first ).begin( )->second;
+                Eigen::Vector6d referenceArrivalDifference =
+                        referencePatchedConicsResultForEachLeg.at( itr.first ).rbegin( )->second -
+                        referenceFullProblemResultForEachLeg.at( itr.first ).rbegin( )->second;
+                for( int i = 0; i < 6; i++ )
+                {
+                    BOOST_CHECK_SMALL( std::fabs( itr.second.first( i ) - referenceDepartureDifference( i ) ),
+                                       ( i < 3 ) ? 1.0E-3 : 1.0E-9 );
+                    BOOST_CHECK_SMALL( std::fabs( itr.second.second( i ) - referenceArrivalDifference( i ) ),
+                                       ( i < 3 ) ? 1.0E-3 : 1.0E-9 );
+                }
+            }
+        }
+    }
+}
+
+//! Test of the repeated (multi-threaded) full propagation of a MGA trajectory without deep-space manoeuvres, terminated at a
+//! scaled sphere of influence, using PatchedConicsFullProblemPropagator, against the results of the sequential
+//! fullPropagationPatchedConicsTrajectory for the same legs and settings
+BOOST_AUTO_TEST_CASE( testPatchedConicsFullProblemPropagatorMGA )
+{
+    // Specify number and type of legs (Cassini trajectory, see testFullPropagationMGA).
+    int numberOfLegs = 6;
+    std::vector< transfer_trajectories::TransferLegType > legTypeVector;
+    legTypeVector.resize( numberOfLegs );
+    legTypeVector[ 0 ] = transfer_trajectories::mga_Departure;
+    legTypeVector[ 1 ] = transfer_trajectories::mga_Swingby;
+    legTypeVector[ 2 ] = transfer_trajectories::mga_Swingby;
+    legTypeVector[ 3 ] = transfer_trajectories::mga_Swingby;
+    legTypeVector[ 4 ] = transfer_trajectories::mga_Swingby;
+    legTypeVector[ 5 ] = transfer_trajectories::capture;
+
+    std::vector< std::string > transferBodyTrajectory = { "Earth", "Venus", "Venus", "Earth", "Jupiter", "Saturn" };
+    std::string centralBody = "Sun";
+    std::string bodyToPropagate = "spacecraft";
+
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Define gravitational parameter for each transfer body.
+    std::vector< double > gravitationalParametersTransferBodies;
+    for( unsigned int i = 0; i < transferBodyTrajectory.size( ); i++ )
+    {
+        gravitationalParametersTransferBodies.push_back(
+                    simulation_setup::createGravityFieldModel(
+                        simulation_setup::getDefaultGravityFieldSettings( transferBodyTrajectory.at( i ), TUDAT_NAN, TUDAT_NAN ),
+                        transferBodyTrajectory.at( i ) )->getGravitationalParameter( ) );
+    }
+
+    // Define function to create body map, with new (not thread-safe) ephemeris objects for each call.
+    std::map< std::string, ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData > ephemerisBodies;
+    ephemerisBodies[ "Earth" ] = ephemerides::ApproximatePlanetPositionsBase::earthMoonBarycenter;
+    ephemerisBodies[ "Venus" ] = ephemerides::ApproximatePlanetPositionsBase::venus;
+    ephemerisBodies[ "Jupiter" ] = ephemerides::ApproximatePlanetPositionsBase::jupiter;
+    ephemerisBodies[ "Saturn" ] = ephemerides::ApproximatePlanetPositionsBase::saturn;
+    std::function< simulation_setup::NamedBodyMap( ) > bodyMapCreationFunction = [ & ]( )
+    {
+        std::vector< ephemerides::EphemerisPointer > ephemerisVectorTransferBodies;
+        for( unsigned int i = 0; i < transferBodyTrajectory.size( ); i++ )
+        {
+            ephemerisVectorTransferBodies.push_back(
+                        std::make_shared< ephemerides::ApproximatePlanetPositions >(
+                            ephemerisBodies.at( transferBodyTrajectory.at( i ) ) ) );
+        }
+        return propagators::setupBodyMapFromUserDefinedEphemeridesForPatchedConicsTrajectory(
+                    centralBody, bodyToPropagate, transferBodyTrajectory, ephemerisVectorTransferBodies,
+                    gravitationalParametersTransferBodies, "ECLIPJ2000" );
+    };
+
+    // Define accelerations (point-mass gravity of central body).
+    simulation_setup::SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ bodyToPropagate ][ centralBody ].push_back(
+                std::make_shared< simulation_setup::AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+
+    // Create variable vector.
+    std::vector< double > variableVector =
+    { -789.8117 * physical_constants::JULIAN_DAY, 158.302027105278 * physical_constants::JULIAN_DAY,
+      449.385873819743 * physical_constants::JULIAN_DAY, 54.7489684339665 * physical_constants::JULIAN_DAY,
+      1024.36205846918 * physical_constants::JULIAN_DAY, 4552.30796805542 * physical_constants::JULIAN_DAY,
+      1.0 * physical_constants::JULIAN_DAY };
+
+    std::vector< double > minimumPericenterRadii = { 6778000.0, 6351800.0, 6351800.0, 6778000.0, 600000000.0, 600000000.0 };
+    std::vector< double > semiMajorAxes = { std::numeric_limits< double >::infinity( ), 1.0895e8 / 0.02 };
+    std::vector< double > eccentricities = { 0.0, 0.98 };
+
+    // Define integrator settings.
+    std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings =
+            std::make_shared < numerical_integrators::IntegratorSettings < > >(
+                numerical_integrators::rungeKutta4, variableVector.at( 0 ), 3600.0 );
+
+    // Terminate propagation at twice the sphere of influence of departure and arrival bodies.
+    const double terminationDistanceScaler = 2.0;
+
+    // Compute reference results sequentially.
+    simulation_setup::NamedBodyMap bodyMap = bodyMapCreationFunction( );
+    std::vector< basic_astrodynamics::AccelerationMap > accelerationMap = propagators::setupAccelerationMapPatchedConicsTrajectory(
+                transferBodyTrajectory.size( ), centralBody, bodyToPropagate, bodyMap );
+    std::vector< std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
+            std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > > propagatorSettings =
+            propagators::getPatchedConicPropagatorSettings(
+                bodyMap, accelerationMap, transferBodyTrajectory, centralBody, bodyToPropagate, legTypeVector, variableVector,
+                minimumPericenterRadii, semiMajorAxes, eccentricities,
+                std::vector< std::shared_ptr< propagators::DependentVariableSaveSettings > >( ), propagators::cowell, true,
+                terminationDistanceScaler );
+
+    std::map< int, std::map< double, Eigen::Vector6d > > referencePatchedConicsResultForEachLeg;
+    std::map< int, std::map< double, Eigen::Vector6d > > referenceFullProblemResultForEachLeg;
+    std::map< int, std::map< double, Eigen::VectorXd > > referenceDependentVariableResultForEachLeg;
+    propagators::fullPropagationPatchedConicsTrajectory(
+                bodyMap, transferBodyTrajectory, centralBody, legTypeVector, variableVector, minimumPericenterRadii,
+                semiMajorAxes, eccentricities, propagatorSettings, integratorSettings, referencePatchedConicsResultForEachLeg,
+                referenceFullProblemResultForEachLeg, referenceDependentVariableResultForEachLeg );
+    BOOST_CHECK_EQUAL( referenceFullProblemResultForEachLeg.size( ), numberOfLegs - 1 );
+
+    for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        propagators::PatchedConicsFullProblemPropagator fullProblemPropagator(
+                    bodyMapCreationFunction, { accelerationSettings }, transferBodyTrajectory, centralBody, bodyToPropagate,
+                    legTypeVector, minimumPericenterRadii, semiMajorAxes, eccentricities, integratorSettings, numberOfThreads,
+                    true, std::vector< std::shared_ptr< propagators::DependentVariableSaveSettings > >( ), propagators::cowell,
+                    terminationDistanceScaler );
+        BOOST_CHECK_EQUAL( fullProblemPropagator.getNumberOfThreads( ), numberOfThreads );
+
+        std::map< int, std::map< double, Eigen::Vector6d > > patchedConicsResultForEachLeg;
+        std::map< int, std::map< double, Eigen::Vector6d > > fullProblemResultForEachLeg;
+        std::map< int, std::map< double, Eigen::VectorXd > > dependentVariableResultForEachLeg;
+        fullProblemPropagator.propagateTrajectory(
+                    variableVector, patchedConicsResultForEachLeg, fullProblemResultForEachLeg, dependentVariableResultForEachLeg );
+
+        BOOST_CHECK_EQUAL( patchedConicsResultForEachLeg.size( ), referencePatchedConicsResultForEachLeg.size( ) );
+        BOOST_CHECK_EQUAL( fullProblemResultForEachLeg.size( ), referenceFullProblemResultForEachLeg.size( ) );
+        for( auto itr : referenceFullProblemResultForEachLeg )
+        {
+            BOOST_CHECK_EQUAL( fullProblemResultForEachLeg.at( itr.first ).size( ), itr.second.size( ) );
+            for( auto innerItr : itr.second )
+            {
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                            fullProblemResultForEachLeg.at( itr.first ).at( innerItr.first ), innerItr.second, 1.0E-12 );
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                            patchedConicsResultForEachLeg.at( itr.first ).at( innerItr.first ),
+                            referencePatchedConicsResultForEachLeg.at( itr.first ).at( innerItr.first ), 1.0E-12 );
+            }
+        }
+    }
+}
+
 }
 
 }
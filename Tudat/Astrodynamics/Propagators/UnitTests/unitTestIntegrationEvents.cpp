@@ -0,0 +1,322 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Propagators/integrateEquations.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_integration_events )
+
+using namespace propagators;
+using namespace numerical_integrators;
+
+//! State derivative of a harmonic oscillator with unit frequency (state is position and velocity)
+Eigen::VectorXd computeHarmonicOscillatorStateDerivative( const double, const Eigen::VectorXd& state )
+{
+    return ( Eigen::VectorXd( 2 ) << state( 1 ), -state( 0 ) ).finished( );
+}
+
+//! State derivative of a falling ball (state is height and vertical velocity)
+Eigen::VectorXd computeFallingBallStateDerivative( const double, const Eigen::VectorXd& state )
+{
+    return ( Eigen::VectorXd( 2 ) << state( 1 ), -9.81 ).finished( );
+}
+
+//! Function to integrate a given state derivative function with a variable step size integrator, and given events.
+std::shared_ptr< PropagationTerminationDetails > integrateWithEvents(
+        const std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction,
+        const Eigen::VectorXd& initialState,
+        const double finalTime,
+        const double tolerance,
+        const std::shared_ptr< IntegrationEventHandler< Eigen::VectorXd, double > > integrationEventHandler,
+        std::map< double, Eigen::VectorXd >& solutionHistory,
+        int& numberOfRejectedSteps )
+{
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                0.0, 0.1, RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0E-10, 1.0, tolerance, tolerance );
+    std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd, double > > integrator =
+            createIntegrator< double, Eigen::VectorXd >( stateDerivativeFunction, initialState, integratorSettings );
+
+    std::map< double, Eigen::VectorXd > dependentVariableHistory;
+    std::map< double, double > cumulativeComputationTimeHistory;
+    std::shared_ptr< PropagationTerminationDetails > terminationDetails =
+            integrateEquationsFromIntegrator< Eigen::VectorXd, double, double >(
+                integrator, integratorSettings->initialTimeStep_,
+                std::make_shared< FixedTimePropagationTerminationCondition >( finalTime, true ),
+                solutionHistory, dependentVariableHistory, cumulativeComputationTimeHistory,
+                std::function< Eigen::VectorXd( ) >( ), std::function< void( Eigen::VectorXd& ) >( ),
+                1, TUDAT_NAN, std::chrono::steady_clock::now( ), integrationEventHandler );
+
+    numberOfRejectedSteps = std::dynamic_pointer_cast< RungeKuttaVariableStepSizeIntegrator<
+            double, Eigen::VectorXd, Eigen::VectorXd, double > >( integrator )->getNumberOfRejectedSteps( );
+    return terminationDetails;
+}
+
+//! Test logging of events, with and without direction filter, and stopping the integration on an event
+BOOST_AUTO_TEST_CASE( testLoggedAndStoppingEvents )
+{
+    const Eigen::VectorXd initialState = ( Eigen::VectorXd( 2 ) << 1.0, 0.0 ).finished( );
+    const std::function< double( const double, const Eigen::VectorXd& ) > positionEventFunction =
+            [ ]( const double, const Eigen::VectorXd& state ){ return state( 0 ); };
+
+    // Log all zero crossings of position, and only those with increasing position
+    std::vector< std::shared_ptr< IntegrationEvent< Eigen::VectorXd, double > > > integrationEvents;
+    integrationEvents.push_back( std::make_shared< IntegrationEvent< Eigen::VectorXd, double > >(
+                                     positionEventFunction, log_integration_event, any_event_crossing,
+                                     nullptr, 1.0E-10, "Any crossing" ) );
+    integrationEvents.push_back( std::make_shared< IntegrationEvent< Eigen::VectorXd, double > >(
+                                     positionEventFunction, log_integration_event, increasing_event_crossing,
+                                     nullptr, 1.0E-10, "Increasing crossing" ) );
+    std::shared_ptr< IntegrationEventHandler< Eigen::VectorXd, double > > integrationEventHandler =
+            std::make_shared< IntegrationEventHandler< Eigen::VectorXd, double > >( integrationEvents );
+
+    std::map< double, Eigen::VectorXd > solutionHistory;
+    int numberOfRejectedSteps;
+    std::shared_ptr< PropagationTerminationDetails > terminationDetails = integrateWithEvents(
+                &computeHarmonicOscillatorStateDerivative, initialState, 18.0, 1.0E-12, integrationEventHandler,
+                solutionHistory, numberOfRejectedSteps );
+    BOOST_CHECK_EQUAL( terminationDetails->getPropagationTerminationReason( ), termination_condition_reached );
+
+    // Check event times (x = 0 at t = pi/2 + k pi, increasing for odd k), and states at events. Logged events are located
+    // using the interpolated state over the integration step, so their accuracy is limited by that of the interpolation.
+    std::vector< double > anyCrossingTimes = integrationEventHandler->getEventTimes( 0 );
+    std::vector< double > increasingCrossingTimes = integrationEventHandler->getEventTimes( 1 );
+    const int expectedNumberOfCrossings = static_cast< int >(
+                std::floor( solutionHistory.rbegin( )->first / mathematical_constants::PI + 0.5 ) );
+    BOOST_CHECK_EQUAL( anyCrossingTimes.size( ), expectedNumberOfCrossings );
+    BOOST_CHECK_EQUAL( increasingCrossingTimes.size( ), expectedNumberOfCrossings / 2 );
+    for( unsigned int i = 0; i < anyCrossingTimes.size( ); i++ )
+    {
+        BOOST_CHECK_SMALL( anyCrossingTimes.at( i ) -
+                           ( mathematical_constants::PI / 2.0 + i * mathematical_constants::PI ), 1.0E-7 );
+    }
+    for( unsigned int i = 0; i < increasingCrossingTimes.size( ); i++ )
+    {
+        BOOST_CHECK_SMALL( increasingCrossingTimes.at( i ) -
+                           ( 3.0 * mathematical_constants::PI / 2.0 + 2.0 * i * mathematical_constants::PI ), 1.0E-7 );
+    }
+
+    std::vector< IntegrationEventRecord< Eigen::VectorXd, double > > eventRecords =
+            integrationEventHandler->getEventRecords( );
+    BOOST_CHECK_EQUAL( eventRecords.size( ), anyCrossingTimes.size( ) + increasingCrossingTimes.size( ) );
+    for( unsigned int i = 0; i < eventRecords.size( ); i++ )
+    {
+        BOOST_CHECK_SMALL( eventRecords.at( i ).stateAtEvent_( 0 ), 1.0E-7 );
+        BOOST_CHECK_CLOSE_FRACTION( std::fabs( eventRecords.at( i ).stateAtEvent_( 1 ) ), 1.0, 1.0E-5 );
+        BOOST_CHECK_EQUAL( eventRecords.at( i ).isIncreasing_, ( eventRecords.at( i ).stateAtEvent_( 1 ) > 0.0 ) );
+        if( i > 0 )
+        {
+            BOOST_CHECK( eventRecords.at( i ).eventTime_ >= eventRecords.at( i - 1 ).eventTime_ );
+        }
+    }
+
+    // Stop integration when position decreases through -0.5, i.e. at t = 2 pi / 3
+    integrationEvents.push_back( std::make_shared< IntegrationEvent< Eigen::VectorXd, double > >(
+                                     [ ]( const double, const Eigen::VectorXd& state ){ return state( 0 ) + 0.5; },
+                                     stop_integration_at_event, decreasing_event_crossing,
+                                     nullptr, 1.0E-12, "Stop" ) );
+    integrationEventHandler = std::make_shared< IntegrationEventHandler< Eigen::VectorXd, double > >(
+                integrationEvents );
+    terminationDetails = integrateWithEvents(
+                &computeHarmonicOscillatorStateDerivative, initialState, 20.0, 1.0E-12, integrationEventHandler,
+                solutionHistory, numberOfRejectedSteps );
+
+    BOOST_CHECK_EQUAL( terminationDetails->getPropagationTerminationReason( ), integration_event_reached );
+    BOOST_CHECK( integrationEventHandler->getStopIntegration( ) );
+    BOOST_CHECK_EQUAL( integrationEventHandler->getEventTimes( 0 ).size( ), 1 );
+    BOOST_CHECK_EQUAL( integrationEventHandler->getEventTimes( 1 ).size( ), 0 );
+    BOOST_CHECK_EQUAL( integrationEventHandler->getEventTimes( 2 ).size( ), 1 );
+
+    // Final state is propagated exactly to event, by re-integration of last step
+    const double expectedStopTime = 2.0 * mathematical_constants::PI / 3.0;
+    BOOST_CHECK_SMALL( solutionHistory.rbegin( )->first - expectedStopTime, 1.0E-11 );
+    BOOST_CHECK_SMALL( solutionHistory.rbegin( )->second( 0 ) + 0.5, 1.0E-11 );
+    BOOST_CHECK_SMALL( solutionHistory.rbegin( )->second( 1 ) + std::sin( expectedStopTime ), 1.0E-11 );
+}
+
+//! Test resetting the state on an event, for a bouncing ball
+BOOST_AUTO_TEST_CASE( testStateResetEvents )
+{
+    const double gravitationalAcceleration = 9.81;
+    const double initialHeight = 10.0;
+    const double restitutionCoefficient = 0.8;
+
+    std::vector< std::shared_ptr< IntegrationEvent< Eigen::VectorXd, double > > > integrationEvents;
+    integrationEvents.push_back(
+                std::make_shared< IntegrationEvent< Eigen::VectorXd, double > >(
+                    [ ]( const double, const Eigen::VectorXd& state ){ return state( 0 ); },
+                    reset_state_at_event, decreasing_event_crossing,
+                    [ = ]( const double, const Eigen::VectorXd& state )
+    {
+        return ( Eigen::VectorXd( 2 ) << state( 0 ), -restitutionCoefficient * state( 1 ) ).finished( );
+    }, 1.0E-10, "Bounce" ) );
+    std::shared_ptr< IntegrationEventHandler< Eigen::VectorXd, double > > integrationEventHandler =
+            std::make_shared< IntegrationEventHandler< Eigen::VectorXd, double > >( integrationEvents );
+
+    std::map< double, Eigen::VectorXd > solutionHistory;
+    int numberOfRejectedSteps;
+    integrateWithEvents( &computeFallingBallStateDerivative, ( Eigen::VectorXd( 2 ) << initialHeight, 0.0 ).finished( ),
+                         6.0, 1.0E-12, integrationEventHandler, solutionHistory, numberOfRejectedSteps );
+
+    // Compute analytical bounce times
+    std::vector< double > expectedBounceTimes;
+    double impactVelocity = std::sqrt( 2.0 * gravitationalAcceleration * initialHeight );
+    double currentBounceTime = impactVelocity / gravitationalAcceleration;
+    while( currentBounceTime < solutionHistory.rbegin( )->first )
+    {
+        expectedBounceTimes.push_back( currentBounceTime );
+        impactVelocity *= restitutionCoefficient;
+        currentBounceTime += 2.0 * impactVelocity / gravitationalAcceleration;
+    }
+
+    std::vector< IntegrationEventRecord< Eigen::VectorXd, double > > eventRecords =
+            integrationEventHandler->getEventRecords( );
+    BOOST_CHECK_EQUAL( eventRecords.size( ), expectedBounceTimes.size( ) );
+    for( unsigned int i = 0; i < eventRecords.size( ); i++ )
+    {
+        BOOST_CHECK_SMALL( eventRecords.at( i ).eventTime_ - expectedBounceTimes.at( i ), 1.0E-9 );
+        BOOST_CHECK_SMALL( eventRecords.at( i ).stateAtEvent_( 0 ), 1.0E-9 );
+
+        // Check that the state after the reset is saved at the event time
+        BOOST_CHECK_EQUAL( solutionHistory.count( eventRecords.at( i ).eventTime_ ), 1 );
+        BOOST_CHECK_CLOSE_FRACTION( solutionHistory.at( eventRecords.at( i ).eventTime_ )( 1 ),
+                                    -restitutionCoefficient * eventRecords.at( i ).stateAtEvent_( 1 ),
+                                    std::numeric_limits< double >::epsilon( ) );
+    }
+
+    // Ball should never be below ground
+    for( auto stateIterator : solutionHistory )
+    {
+        BOOST_CHECK( stateIterator.second( 0 ) > -1.0E-9 );
+    }
+}
+
+//! Test use of events to switch a discontinuous state derivative model, avoiding step size reduction at discontinuity
+BOOST_AUTO_TEST_CASE( testDiscontinuityEvents )
+{
+    // Exponential growth, with growth rate doubled once x exceeds 1 (at t = ln 2 for x(0) = 0.5)
+    const Eigen::VectorXd initialState = ( Eigen::VectorXd( 1 ) << 0.5 ).finished( );
+    const double finalTime = 2.0;
+
+    // Integrate model in which switch is determined directly from state
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDependentDerivativeFunction =
+            [ ]( const double, const Eigen::VectorXd& state )
+    {
+        return ( ( state( 0 ) < 1.0 ) ? 1.0 : 2.0 ) * state;
+    };
+
+    std::map< double, Eigen::VectorXd > solutionHistoryWithoutEvent;
+    int numberOfRejectedStepsWithoutEvent;
+    integrateWithEvents( stateDependentDerivativeFunction, initialState, finalTime, 1.0E-12, nullptr,
+                         solutionHistoryWithoutEvent, numberOfRejectedStepsWithoutEvent );
+
+    // Integrate model in which switch is triggered by event
+    bool isSwitched = false;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > eventDependentDerivativeFunction =
+            [ & ]( const double, const Eigen::VectorXd& state )
+    {
+        return ( isSwitched ? 2.0 : 1.0 ) * state;
+    };
+    std::vector< std::shared_ptr< IntegrationEvent< Eigen::VectorXd, double > > > integrationEvents;
+    integrationEvents.push_back(
+                std::make_shared< IntegrationEvent< Eigen::VectorXd, double > >(
+                    [ ]( const double, const Eigen::VectorXd& state ){ return state( 0 ) - 1.0; },
+                    reset_state_at_event, increasing_event_crossing,
+                    [ & ]( const double, const Eigen::VectorXd& state )
+    {
+        isSwitched = true;
+        return state;
+    }, 1.0E-12, "Switch" ) );
+    std::shared_ptr< IntegrationEventHandler< Eigen::VectorXd, double > > integrationEventHandler =
+            std::make_shared< IntegrationEventHandler< Eigen::VectorXd, double > >( integrationEvents );
+
+    std::map< double, Eigen::VectorXd > solutionHistoryWithEvent;
+    int numberOfRejectedStepsWithEvent;
+    integrateWithEvents( eventDependentDerivativeFunction, initialState, finalTime, 1.0E-12, integrationEventHandler,
+                         solutionHistoryWithEvent, numberOfRejectedStepsWithEvent );
+
+    BOOST_CHECK_EQUAL( integrationEventHandler->getEventTimes( 0 ).size( ), 1 );
+    BOOST_CHECK_SMALL( integrationEventHandler->getEventTimes( 0 ).at( 0 ) - std::log( 2.0 ), 1.0E-11 );
+
+    // Compare final state errors, and number of rejected steps
+    const double finalTimeWithoutEvent = solutionHistoryWithoutEvent.rbegin( )->first;
+    const double finalStateErrorWithoutEvent = std::fabs(
+                solutionHistoryWithoutEvent.rbegin( )->second( 0 ) -
+                std::exp( 2.0 * ( finalTimeWithoutEvent - std::log( 2.0 ) ) ) );
+    const double finalTimeWithEvent = solutionHistoryWithEvent.rbegin( )->first;
+    const double finalStateErrorWithEvent = std::fabs(
+                solutionHistoryWithEvent.rbegin( )->second( 0 ) -
+                std::exp( 2.0 * ( finalTimeWithEvent - std::log( 2.0 ) ) ) );
+
+    BOOST_CHECK( numberOfRejectedStepsWithEvent <= numberOfRejectedStepsWithoutEvent );
+    BOOST_CHECK( finalStateErrorWithEvent < finalStateErrorWithoutEvent );
+    BOOST_CHECK( finalStateErrorWithEvent / solutionHistoryWithEvent.rbegin( )->second( 0 ) < 1.0E-11 );
+}
+
+//! Test event function that depends on the environment, which is updated by the state derivative function
+BOOST_AUTO_TEST_CASE( testEnvironmentDependentEvents )
+{
+    // State derivative function that sets an environment variable (here simply the position) as a side effect
+    double environmentPosition = TUDAT_NAN;
+    const std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state )
+    {
+        environmentPosition = state( 0 );
+        return computeHarmonicOscillatorStateDerivative( time, state );
+    };
+    const std::function< double( const double, const Eigen::VectorXd& ) > environmentEventFunction =
+            createEnvironmentDependentEventFunction< Eigen::VectorXd, double >(
+                stateDerivativeFunction, [ & ]( ){ return environmentPosition; }, -0.5 );
+
+    // Check that the environment is updated to, and left at, the point at which the event function is evaluated
+    const Eigen::VectorXd trialState = ( Eigen::VectorXd( 2 ) << 0.25, -1.0 ).finished( );
+    BOOST_CHECK_EQUAL( environmentEventFunction( 1.0, trialState ), 0.75 );
+    BOOST_CHECK_EQUAL( environmentPosition, 0.25 );
+
+    // Stop integration when the environment variable decreases through -0.5, i.e. at t = 2 pi / 3
+    const Eigen::VectorXd initialState = ( Eigen::VectorXd( 2 ) << 1.0, 0.0 ).finished( );
+    std::vector< std::shared_ptr< IntegrationEvent< Eigen::VectorXd, double > > > integrationEvents;
+    integrationEvents.push_back( std::make_shared< IntegrationEvent< Eigen::VectorXd, double > >(
+                                     environmentEventFunction, stop_integration_at_event, decreasing_event_crossing,
+                                     nullptr, 1.0E-12, "Environment" ) );
+    std::shared_ptr< IntegrationEventHandler< Eigen::VectorXd, double > > integrationEventHandler =
+            std::make_shared< IntegrationEventHandler< Eigen::VectorXd, double > >( integrationEvents );
+
+    std::map< double, Eigen::VectorXd > solutionHistory;
+    int numberOfRejectedSteps;
+    std::shared_ptr< PropagationTerminationDetails > terminationDetails = integrateWithEvents(
+                stateDerivativeFunction, initialState, 20.0, 1.0E-12, integrationEventHandler,
+                solutionHistory, numberOfRejectedSteps );
+
+    BOOST_CHECK_EQUAL( terminationDetails->getPropagationTerminationReason( ), integration_event_reached );
+    const double expectedStopTime = 2.0 * mathematical_constants::PI / 3.0;
+    BOOST_CHECK_SMALL( solutionHistory.rbegin( )->first - expectedStopTime, 1.0E-11 );
+    BOOST_CHECK_SMALL( solutionHistory.rbegin( )->second( 0 ) + 0.5, 1.0E-11 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,332 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/missionGeometry.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Gravitation/thirdBodyPerturbation.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Astrodynamics/Propagators/constellationStateDerivative.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Constructor
+ConstellationStateDerivative::ConstellationStateDerivative( const int numberOfSatellites,
+                                                            const double centralBodyGravitationalParameter,
+                                                            const unsigned int numberOfThreads ):
+    numberOfSatellites_( numberOfSatellites ),
+    centralBodyGravitationalParameter_( centralBodyGravitationalParameter ),
+    numberOfThreads_( numberOfThreads ),
+    parallelForLoopExecutor_( std::make_shared< utilities::ParallelForLoopExecutor >( numberOfThreads ) ),
+    gravityFieldReferenceRadius_( 0.0 ),
+    useDrag_( false ),
+    useRadiationPressure_( false )
+{
+    if( numberOfSatellites_ <= 0 )
+    {
+        throw std::runtime_error( "Error when creating constellation state derivative, number of satellites must be "
+                                  "positive." );
+    }
+}
+
+//! Function to set the zonal gravity field terms of the central body.
+void ConstellationStateDerivative::setZonalGravityField(
+        const double referenceRadius, const std::vector< double >& zonalCoefficients )
+{
+    gravityFieldReferenceRadius_ = referenceRadius;
+    zonalCoefficients_ = zonalCoefficients;
+}
+
+//! Function to set the atmospheric drag acceleration, using an exponential atmosphere.
+void ConstellationStateDerivative::setExponentialAtmosphereDrag(
+        const double densityAtReferenceAltitude,
+        const double referenceAltitude,
+        const double scaleHeight,
+        const double centralBodyRadius,
+        const double atmosphereRotationRate,
+        const Eigen::VectorXd& dragCoefficientAreaToMassRatios )
+{
+    if( dragCoefficientAreaToMassRatios.rows( ) != numberOfSatellites_ )
+    {
+        throw std::runtime_error( "Error when setting constellation drag, found " +
+                                  std::to_string( dragCoefficientAreaToMassRatios.rows( ) ) +
+                                  " drag properties for " + std::to_string( numberOfSatellites_ ) + " satellites." );
+    }
+
+    useDrag_ = true;
+    densityAtReferenceAltitude_ = densityAtReferenceAltitude;
+    referenceAltitude_ = referenceAltitude;
+    scaleHeight_ = scaleHeight;
+    dragCentralBodyRadius_ = centralBodyRadius;
+    atmosphereRotationRate_ = atmosphereRotationRate;
+    dragCoefficientAreaToMassRatios_ = dragCoefficientAreaToMassRatios;
+}
+
+//! Function to set the cannonball solar radiation pressure acceleration.
+void ConstellationStateDerivative::setCannonballRadiationPressure(
+        const std::function< Eigen::Vector3d( const double ) > sunPositionFunction,
+        const double sunLuminosity,
+        const double sunRadius,
+        const double centralBodyRadius,
+        const Eigen::VectorXd& radiationPressureCoefficientAreaToMassRatios )
+{
+    if( radiationPressureCoefficientAreaToMassRatios.rows( ) != numberOfSatellites_ )
+    {
+        throw std::runtime_error( "Error when setting constellation radiation pressure, found " +
+                                  std::to_string( radiationPressureCoefficientAreaToMassRatios.rows( ) ) +
+                                  " radiation pressure properties for " + std::to_string( numberOfSatellites_ ) +
+                                  " satellites." );
+    }
+
+    useRadiationPressure_ = true;
+    sunPositionFunction_ = sunPositionFunction;
+    sunLuminosity_ = sunLuminosity;
+    sunRadius_ = sunRadius;
+    shadowingBodyRadius_ = centralBodyRadius;
+    radiationPressureCoefficientAreaToMassRatios_ = radiationPressureCoefficientAreaToMassRatios;
+}
+
+//! Function to add a point-mass third-body perturbation.
+void ConstellationStateDerivative::addPointMassThirdBody(
+        const double gravitationalParameter,
+        const std::function< Eigen::Vector3d( const double ) > positionFunction )
+{
+    thirdBodyGravitationalParameters_.push_back( gravitationalParameter );
+    thirdBodyPositionFunctions_.push_back( positionFunction );
+}
+
+//! Function to compute the state derivative of the full constellation.
+Eigen::MatrixXd ConstellationStateDerivative::computeStateDerivative( const double time, const Eigen::MatrixXd& state )
+{
+    if( state.rows( ) != numberOfSatellites_ || state.cols( ) != 6 )
+    {
+        throw std::runtime_error( "Error when computing constellation state derivative, state has incorrect size." );
+    }
+
+    // Retrieve perturbing body positions once for all satellites.
+    Eigen::Vector3d sunPosition = Eigen::Vector3d::Zero( );
+    std::vector< Eigen::Vector3d > thirdBodyPositions;
+    getPerturbingBodyPositions( time, sunPosition, thirdBodyPositions );
+
+    // Compute state derivative per block of satellites, so that blocks can be distributed over threads.
+    Eigen::MatrixXd stateDerivative( numberOfSatellites_, 6 );
+    const int blockSize = 256;
+    const int numberOfBlocks = ( numberOfSatellites_ + blockSize - 1 ) / blockSize;
+    parallelForLoopExecutor_->executeParallelForLoop(
+                static_cast< unsigned int >( numberOfBlocks ), [ & ]( const unsigned int blockIndex, const unsigned int )
+    {
+        const int startRow = static_cast< int >( blockIndex ) * blockSize;
+        computeStateDerivativeOfSatellites(
+                    state, stateDerivative, startRow, std::min( blockSize, numberOfSatellites_ - startRow ), startRow,
+                    sunPosition, thirdBodyPositions );
+    } );
+
+    return stateDerivative;
+}
+
+//! Function to compute the state derivative of a single satellite of the constellation.
+Eigen::MatrixXd ConstellationStateDerivative::computeSatelliteStateDerivative(
+        const double time, const Eigen::MatrixXd& state, const int satelliteIndex )
+{
+    if( state.rows( ) != 1 || state.cols( ) != 6 )
+    {
+        throw std::runtime_error( "Error when computing constellation satellite state derivative, state has incorrect "
+                                  "size." );
+    }
+
+    if( satelliteIndex < 0 || satelliteIndex >= numberOfSatellites_ )
+    {
+        throw std::runtime_error( "Error when computing constellation satellite state derivative, satellite index " +
+                                  std::to_string( satelliteIndex ) + " is not in constellation." );
+    }
+
+    Eigen::Vector3d sunPosition = Eigen::Vector3d::Zero( );
+    std::vector< Eigen::Vector3d > thirdBodyPositions;
+    getPerturbingBodyPositions( time, sunPosition, thirdBodyPositions );
+
+    Eigen::MatrixXd stateDerivative( 1, 6 );
+    computeStateDerivativeOfSatellites( state, stateDerivative, 0, 1, satelliteIndex, sunPosition, thirdBodyPositions );
+    return stateDerivative;
+}
+
+//! Function to retrieve the positions of the Sun and the third bodies at the current time.
+void ConstellationStateDerivative::getPerturbingBodyPositions( const double time,
+                                                              Eigen::Vector3d& sunPosition,
+                                                              std::vector< Eigen::Vector3d >& thirdBodyPositions )
+{
+    // Position functions (e.g. ephemerides with a lookup scheme) need not be thread-safe.
+    std::lock_guard< std::mutex > lock( perturbingBodyPositionMutex_ );
+
+    if( useRadiationPressure_ )
+    {
+        sunPosition = sunPositionFunction_( time );
+    }
+
+    thirdBodyPositions.resize( thirdBodyPositionFunctions_.size( ) );
+    for( unsigned int i = 0; i < thirdBodyPositionFunctions_.size( ); i++ )
+    {
+        thirdBodyPositions[ i ] = thirdBodyPositionFunctions_.at( i )( time );
+    }
+}
+
+//! Function to compute the state derivative of a contiguous set of satellites.
+void ConstellationStateDerivative::computeStateDerivativeOfSatellites(
+        const Eigen::MatrixXd& state,
+        Eigen::MatrixXd& stateDerivative,
+        const int startRow,
+        const int numberOfRows,
+        const int firstSatelliteIndex,
+        const Eigen::Vector3d& sunPosition,
+        const std::vector< Eigen::Vector3d >& thirdBodyPositions ) const
+{
+    // Retrieve position and velocity components (each contiguous in memory).
+    const Eigen::ArrayXd x = state.col( 0 ).segment( startRow, numberOfRows ).array( );
+    const Eigen::ArrayXd y = state.col( 1 ).segment( startRow, numberOfRows ).array( );
+    const Eigen::ArrayXd z = state.col( 2 ).segment( startRow, numberOfRows ).array( );
+    const Eigen::ArrayXd vx = state.col( 3 ).segment( startRow, numberOfRows ).array( );
+    const Eigen::ArrayXd vy = state.col( 4 ).segment( startRow, numberOfRows ).array( );
+    const Eigen::ArrayXd vz = state.col( 5 ).segment( startRow, numberOfRows ).array( );
+
+    const Eigen::ArrayXd distance = ( x.square( ) + y.square( ) + z.square( ) ).sqrt( );
+    const Eigen::ArrayXd inverseDistance = distance.inverse( );
+
+    // Compute central body point-mass acceleration.
+    Eigen::ArrayXd centralTermFactor = -centralBodyGravitationalParameter_ * inverseDistance.cube( );
+    Eigen::ArrayXd ax = centralTermFactor * x;
+    Eigen::ArrayXd ay = centralTermFactor * y;
+    Eigen::ArrayXd az = centralTermFactor * z;
+
+    // Compute zonal accelerations, using recursions for Legendre polynomials P_n(u) and their derivatives, with u = z/r.
+    if( zonalCoefficients_.size( ) > 0 )
+    {
+        const Eigen::ArrayXd sineOfLatitude = z * inverseDistance;
+        const Eigen::ArrayXd radiusRatio = gravityFieldReferenceRadius_ * inverseDistance;
+
+        Eigen::ArrayXd previousLegendrePolynomial = Eigen::ArrayXd::Ones( numberOfRows );
+        Eigen::ArrayXd currentLegendrePolynomial = sineOfLatitude;
+        Eigen::ArrayXd currentLegendrePolynomialDerivative = Eigen::ArrayXd::Ones( numberOfRows );
+        Eigen::ArrayXd radiusRatioPower = radiusRatio;
+
+        Eigen::ArrayXd radialTermSum = Eigen::ArrayXd::Zero( numberOfRows );
+        Eigen::ArrayXd polarTermSum = Eigen::ArrayXd::Zero( numberOfRows );
+        for( unsigned int i = 0; i < zonalCoefficients_.size( ); i++ )
+        {
+            const double degree = static_cast< double >( i + 2 );
+
+            // Update Legendre polynomial (and derivative) from degree n-1 to degree n.
+            const Eigen::ArrayXd nextLegendrePolynomial =
+                    ( ( 2.0 * degree - 1.0 ) * sineOfLatitude * currentLegendrePolynomial -
+                      ( degree - 1.0 ) * previousLegendrePolynomial ) / degree;
+            currentLegendrePolynomialDerivative =
+                    sineOfLatitude * currentLegendrePolynomialDerivative + degree * currentLegendrePolynomial;
+            previousLegendrePolynomial = currentLegendrePolynomial;
+            currentLegendrePolynomial = nextLegendrePolynomial;
+            radiusRatioPower *= radiusRatio;
+
+            // Add contributions of current degree.
+            radialTermSum += zonalCoefficients_.at( i ) * radiusRatioPower *
+                    ( ( degree + 1.0 ) * currentLegendrePolynomial +
+                      sineOfLatitude * currentLegendrePolynomialDerivative );
+            polarTermSum += zonalCoefficients_.at( i ) * radiusRatioPower * currentLegendrePolynomialDerivative;
+        }
+
+        const Eigen::ArrayXd zonalTermFactor = centralBodyGravitationalParameter_ * inverseDistance.square( );
+        const Eigen::ArrayXd radialTermFactor = zonalTermFactor * radialTermSum * inverseDistance;
+        ax += radialTermFactor * x;
+        ay += radialTermFactor * y;
+        az += radialTermFactor * z - zonalTermFactor * polarTermSum;
+    }
+
+    // Compute drag acceleration in co-rotating exponential atmosphere.
+    if( useDrag_ )
+    {
+        const Eigen::ArrayXd relativeVx = vx + atmosphereRotationRate_ * y;
+        const Eigen::ArrayXd relativeVy = vy - atmosphereRotationRate_ * x;
+        const Eigen::ArrayXd airspeed = ( relativeVx.square( ) + relativeVy.square( ) + vz.square( ) ).sqrt( );
+        const Eigen::ArrayXd density = densityAtReferenceAltitude_ * (
+                    -( distance - dragCentralBodyRadius_ - referenceAltitude_ ) / scaleHeight_ ).exp( );
+        const Eigen::ArrayXd dragFactor = -0.5 * density * airspeed *
+                dragCoefficientAreaToMassRatios_.segment( firstSatelliteIndex, numberOfRows ).array( );
+
+        ax += dragFactor * relativeVx;
+        ay += dragFactor * relativeVy;
+        az += dragFactor * vz;
+    }
+
+    // Compute cannonball radiation pressure acceleration.
+    if( useRadiationPressure_ )
+    {
+        const Eigen::ArrayXd sunRelativeX = x - sunPosition.x( );
+        const Eigen::ArrayXd sunRelativeY = y - sunPosition.y( );
+        const Eigen::ArrayXd sunRelativeZ = z - sunPosition.z( );
+        const Eigen::ArrayXd squaredSunDistance =
+                sunRelativeX.square( ) + sunRelativeY.square( ) + sunRelativeZ.square( );
+
+        // Compute radiation pressure (divided by Sun distance, to normalize the direction vector).
+        Eigen::ArrayXd radiationPressureFactor =
+                sunLuminosity_ / ( 4.0 * mathematical_constants::PI * physical_constants::SPEED_OF_LIGHT ) /
+                ( squaredSunDistance * squaredSunDistance.sqrt( ) ) *
+                radiationPressureCoefficientAreaToMassRatios_.segment( firstSatelliteIndex, numberOfRows ).array( );
+
+        // Apply shadow function for satellites that may be behind the central body (i.e. not on the side of the plane
+        // through the central body, perpendicular to the Sun direction, that faces the Sun, with a margin for the
+        // apparent radius of the Sun).
+        if( shadowingBodyRadius_ > 0.0 )
+        {
+            for( int i = 0; i < numberOfRows; i++ )
+            {
+                if( x( i ) * sunPosition.x( ) + y( i ) * sunPosition.y( ) + z( i ) * sunPosition.z( ) <
+                        distance( i ) * sunRadius_ )
+                {
+                    radiationPressureFactor( i ) *= mission_geometry::computeShadowFunction(
+                                sunPosition, sunRadius_, Eigen::Vector3d::Zero( ), shadowingBodyRadius_,
+                                Eigen::Vector3d( x( i ), y( i ), z( i ) ) );
+                }
+            }
+        }
+
+        ax += radiationPressureFactor * sunRelativeX;
+        ay += radiationPressureFactor * sunRelativeY;
+        az += radiationPressureFactor * sunRelativeZ;
+    }
+
+    // Compute third-body accelerations (central body term computed once for all satellites). The satellites are
+    // already distributed over the threads by the caller, so the accelerations are computed on the current thread.
+    if( thirdBodyPositions.size( ) > 0 )
+    {
+        const Eigen::Matrix3Xd positions = state.block( startRow, 0, numberOfRows, 3 ).transpose( );
+        for( unsigned int j = 0; j < thirdBodyPositions.size( ); j++ )
+        {
+            const Eigen::Matrix3Xd thirdBodyAccelerations = gravitation::computeThirdBodyPerturbingAccelerations(
+                        thirdBodyGravitationalParameters_.at( j ), thirdBodyPositions.at( j ), positions );
+            ax += thirdBodyAccelerations.row( 0 ).transpose( ).array( );
+            ay += thirdBodyAccelerations.row( 1 ).transpose( ).array( );
+            az += thirdBodyAccelerations.row( 2 ).transpose( ).array( );
+        }
+    }
+
+    // Set state derivative.
+    stateDerivative.block( startRow, 0, numberOfRows, 3 ) = state.block( startRow, 3, numberOfRows, 3 );
+    stateDerivative.col( 3 ).segment( startRow, numberOfRows ) = ax.matrix( );
+    stateDerivative.col( 4 ).segment( startRow, numberOfRows ) = ay.matrix( );
+    stateDerivative.col( 5 ).segment( startRow, numberOfRows ) = az.matrix( );
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -0,0 +1,285 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_CONSTELLATION_STATE_DERIVATIVE_H
+#define TUDAT_CONSTELLATION_STATE_DERIVATIVE_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/parallelExecution.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! State derivative model class for a constellation of mutually non-interacting satellites.
+/*!
+ * State derivative model class for a constellation of satellites that do not interact with one another, and that are
+ * all subject to the same force models (with satellite-specific drag and radiation pressure properties). The dynamics
+ * are expressed in a non-rotating frame centered on the central body, w.r.t. which the Cowell formulation is used.
+ * Contrary to the general propagation framework (NBodyStateDerivative, with AccelerationModel objects per body), the
+ * state of the constellation is stored in structure-of-arrays form: a matrix with one row per satellite, and the
+ * columns containing x, y, z, vx, vy, vz, so that each state component of all satellites is contiguous in memory. The
+ * accelerations are evaluated component-wise over all satellites, using Eigen array operations, and the satellites may
+ * be distributed over several threads (which are created once, with this object, and reused for each state derivative
+ * evaluation). The following force models are supported:
+ *  - Point-mass gravity of the central body, plus (unnormalized) zonal terms J2...Jn.
+ *  - Atmospheric drag in an exponential atmosphere co-rotating with the central body (about its z-axis).
+ *  - Cannonball solar radiation pressure, with conical shadow of the central body.
+ *  - Point-mass third-body perturbations.
+ * Time-dependent positions of the Sun and third bodies are evaluated only once per state derivative evaluation (in the
+ * calling thread), and are shared by all satellites. When the satellites are propagated with separate step sizes
+ * (computeSatelliteStateDerivative called from several threads), the position functions are never called concurrently:
+ * their evaluation is serialized by this object, so that they need not be thread-safe. The threads may be reused for
+ * other loops (see getParallelForLoopExecutor), but computeStateDerivative must not be called from such a loop, as
+ * this would deadlock (a std::runtime_error is thrown instead).
+ */
+class ConstellationStateDerivative
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor, sets the central body gravity, and the number of satellites. Additional force models are added by
+     * the set/add member functions.
+     * \param numberOfSatellites Number of satellites in the constellation.
+     * \param centralBodyGravitationalParameter Gravitational parameter of the central body.
+     * \param numberOfThreads Maximum number of threads that is used to evaluate the state derivative (default 1).
+     */
+    ConstellationStateDerivative( const int numberOfSatellites,
+                                  const double centralBodyGravitationalParameter,
+                                  const unsigned int numberOfThreads = 1 );
+
+    //! Function to set the zonal gravity field terms of the central body.
+    /*!
+     * Function to set the zonal gravity field terms of the central body.
+     * \param referenceRadius Reference radius of the gravity field.
+     * \param zonalCoefficients Unnormalized zonal coefficients, starting at J2 (so entry i contains J_{i+2}).
+     */
+    void setZonalGravityField( const double referenceRadius, const std::vector< double >& zonalCoefficients );
+
+    //! Function to set the atmospheric drag acceleration, using an exponential atmosphere.
+    /*!
+     * Function to set the atmospheric drag acceleration, using an exponential atmosphere co-rotating with the central
+     * body about the z-axis of the propagation frame. The altitude is computed w.r.t. a spherical central body.
+     * \param densityAtReferenceAltitude Atmospheric density at reference altitude.
+     * \param referenceAltitude Reference altitude of the exponential atmosphere.
+     * \param scaleHeight Scale height of the exponential atmosphere.
+     * \param centralBodyRadius Radius of the central body (w.r.t. which altitudes are computed).
+     * \param atmosphereRotationRate Rotation rate of the atmosphere about the z-axis.
+     * \param dragCoefficientAreaToMassRatios Drag coefficient times reference area, divided by mass, per satellite.
+     */
+    void setExponentialAtmosphereDrag( const double densityAtReferenceAltitude,
+                                       const double referenceAltitude,
+                                       const double scaleHeight,
+                                       const double centralBodyRadius,
+                                       const double atmosphereRotationRate,
+                                       const Eigen::VectorXd& dragCoefficientAreaToMassRatios );
+
+    //! Function to set the cannonball solar radiation pressure acceleration.
+    /*!
+     * Function to set the cannonball solar radiation pressure acceleration, with the radiation pressure computed from
+     * the luminosity of the Sun and the Sun-satellite distance. The conical shadow of the central body is included if
+     * a non-zero central body radius is provided.
+     * \param sunPositionFunction Function returning the position of the Sun w.r.t. the central body, as a function of
+     * time (not called concurrently by this object, see class description).
+     * \param sunLuminosity Total radiated power of the Sun.
+     * \param sunRadius Radius of the Sun (used for shadow computation).
+     * \param centralBodyRadius Radius of the central body (used for shadow computation, no shadow if zero).
+     * \param radiationPressureCoefficientAreaToMassRatios Radiation pressure coefficient times reference area, divided
+     * by mass, per satellite.
+     */
+    void setCannonballRadiationPressure( const std::function< Eigen::Vector3d( const double ) > sunPositionFunction,
+                                         const double sunLuminosity,
+                                         const double sunRadius,
+                                         const double centralBodyRadius,
+                                         const Eigen::VectorXd& radiationPressureCoefficientAreaToMassRatios );
+
+    //! Function to add a point-mass third-body perturbation.
+    /*!
+     * Function to add a point-mass third-body perturbation.
+     * \param gravitationalParameter Gravitational parameter of the perturbing body.
+     * \param positionFunction Function returning the position of the perturbing body w.r.t. the central body, as a
+     * function of time (not called concurrently by this object, see class description).
+     */
+    void addPointMassThirdBody( const double gravitationalParameter,
+                                const std::function< Eigen::Vector3d( const double ) > positionFunction );
+
+    //! Function to compute the state derivative of the full constellation.
+    /*!
+     * Function to compute the state derivative of the full constellation.
+     * \param time Current time.
+     * \param state Current state of the constellation (one row per satellite, columns x, y, z, vx, vy, vz).
+     * \return State derivative of the constellation, in same format as state.
+     */
+    Eigen::MatrixXd computeStateDerivative( const double time, const Eigen::MatrixXd& state );
+
+    //! Function to compute the state derivative of a single satellite of the constellation.
+    /*!
+     * Function to compute the state derivative of a single satellite of the constellation, used to propagate each
+     * satellite with its own step size. This function may be called concurrently from several threads (the positions
+     * of the Sun and third bodies are then retrieved by one thread at a time).
+     * \param time Current time.
+     * \param state Current state of the satellite (single row, columns x, y, z, vx, vy, vz).
+     * \param satelliteIndex Index of the satellite in the constellation.
+     * \return State derivative of the satellite, in same format as state.
+     */
+    Eigen::MatrixXd computeSatelliteStateDerivative(
+            const double time, const Eigen::MatrixXd& state, const int satelliteIndex );
+
+    //! Function to retrieve the number of satellites in the constellation.
+    /*!
+     * Function to retrieve the number of satellites in the constellation.
+     * \return Number of satellites in the constellation.
+     */
+    int getNumberOfSatellites( )
+    {
+        return numberOfSatellites_;
+    }
+
+    //! Function to retrieve the maximum number of threads that is used.
+    /*!
+     * Function to retrieve the maximum number of threads that is used.
+     * \return Maximum number of threads that is used.
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+    //! Function to retrieve the object holding the threads used to evaluate the state derivative.
+    /*!
+     * Function to retrieve the object holding the threads used to evaluate the state derivative, so that these threads
+     * can be reused for other loops over the satellites. Such loops must not call computeStateDerivative, which uses
+     * the same threads: this would deadlock, so a std::runtime_error is thrown instead (computeSatelliteStateDerivative
+     * may be called).
+     * \return Object holding the threads used to evaluate the state derivative.
+     */
+    std::shared_ptr< utilities::ParallelForLoopExecutor > getParallelForLoopExecutor( )
+    {
+        return parallelForLoopExecutor_;
+    }
+
+private:
+
+    //! Function to retrieve the positions of the Sun and the third bodies at the current time.
+    /*!
+     * Function to retrieve the positions of the Sun and the third bodies at the current time. Calls to the position
+     * functions from different threads are executed one after the other.
+     * \param time Current time.
+     * \param sunPosition Position of the Sun (returned by reference, unchanged if no radiation pressure is used).
+     * \param thirdBodyPositions Positions of the third bodies (returned by reference).
+     */
+    void getPerturbingBodyPositions( const double time,
+                                     Eigen::Vector3d& sunPosition,
+                                     std::vector< Eigen::Vector3d >& thirdBodyPositions );
+
+    //! Function to compute the state derivative of a contiguous set of satellites.
+    /*!
+     * Function to compute the state derivative of a contiguous set of satellites (rows of state matrix).
+     * \param state State matrix (one row per satellite).
+     * \param stateDerivative State derivative matrix to which results are written (one row per satellite).
+     * \param startRow First row of state (and stateDerivative) that is to be processed.
+     * \param numberOfRows Number of rows of state (and stateDerivative) that are to be processed.
+     * \param firstSatelliteIndex Index in constellation of satellite at startRow.
+     * \param sunPosition Position of the Sun at the current time.
+     * \param thirdBodyPositions Positions of the third bodies at the current time.
+     */
+    void computeStateDerivativeOfSatellites( const Eigen::MatrixXd& state,
+                                             Eigen::MatrixXd& stateDerivative,
+                                             const int startRow,
+                                             const int numberOfRows,
+                                             const int firstSatelliteIndex,
+                                             const Eigen::Vector3d& sunPosition,
+                                             const std::vector< Eigen::Vector3d >& thirdBodyPositions ) const;
+
+    //! Number of satellites in the constellation.
+    int numberOfSatellites_;
+
+    //! Gravitational parameter of the central body.
+    double centralBodyGravitationalParameter_;
+
+    //! Maximum number of threads that is used to evaluate the state derivative.
+    unsigned int numberOfThreads_;
+
+    //! Object holding the threads over which the blocks of satellites are distributed in computeStateDerivative.
+    std::shared_ptr< utilities::ParallelForLoopExecutor > parallelForLoopExecutor_;
+
+    //! Mutex ensuring that the Sun and third-body position functions are not called concurrently.
+    std::mutex perturbingBodyPositionMutex_;
+
+    //! Reference radius of the gravity field.
+    double gravityFieldReferenceRadius_;
+
+    //! Unnormalized zonal coefficients, starting at J2.
+    std::vector< double > zonalCoefficients_;
+
+    //! Boolean denoting whether atmospheric drag is used.
+    bool useDrag_;
+
+    //! Atmospheric density at reference altitude.
+    double densityAtReferenceAltitude_;
+
+    //! Reference altitude of the exponential atmosphere.
+    double referenceAltitude_;
+
+    //! Scale height of the exponential atmosphere.
+    double scaleHeight_;
+
+    //! Radius of the central body (w.r.t. which altitudes are computed).
+    double dragCentralBodyRadius_;
+
+    //! Rotation rate of the atmosphere about the z-axis.
+    double atmosphereRotationRate_;
+
+    //! Drag coefficient times reference area, divided by mass, per satellite.
+    Eigen::VectorXd dragCoefficientAreaToMassRatios_;
+
+    //! Boolean denoting whether solar radiation pressure is used.
+    bool useRadiationPressure_;
+
+    //! Function returning the position of the Sun w.r.t. the central body.
+    std::function< Eigen::Vector3d( const double ) > sunPositionFunction_;
+
+    //! Total radiated power of the Sun.
+    double sunLuminosity_;
+
+    //! Radius of the Sun.
+    double sunRadius_;
+
+    //! Radius of the central body, used for shadow computation.
+    double shadowingBodyRadius_;
+
+    //! Radiation pressure coefficient times reference area, divided by mass, per satellite.
+    Eigen::VectorXd radiationPressureCoefficientAreaToMassRatios_;
+
+    //! Gravitational parameters of the third bodies.
+    std::vector< double > thirdBodyGravitationalParameters_;
+
+    //! Functions returning the positions of the third bodies w.r.t. the central body.
+    std::vector< std::function< Eigen::Vector3d( const double ) > > thirdBodyPositionFunctions_;
+};
+
+//! Typedef for shared-pointer to ConstellationStateDerivative object.
+typedef std::shared_ptr< ConstellationStateDerivative > ConstellationStateDerivativePointer;
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_CONSTELLATION_STATE_DERIVATIVE_H
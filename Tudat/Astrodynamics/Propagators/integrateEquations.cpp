@@ -18,7 +18,8 @@ Eigen::MatrixXd, double, double >(
         const std::function< void( Eigen::MatrixXd& ) > statePostProcessingFunction,
         const int saveFrequency,
         const double printInterval,
-        const std::chrono::steady_clock::time_point initialClockTime );
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::shared_ptr< IntegrationEventHandler< Eigen::MatrixXd, double > > integrationEventHandler );
 
 template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
 Eigen::VectorXd, double, double >(
@@ -32,7 +33,8 @@ Eigen::VectorXd, double, double >(
         const std::function< void( Eigen::VectorXd& ) > statePostProcessingFunction,
         const int saveFrequency,
         const double printInterval,
-        const std::chrono::steady_clock::time_point initialClockTime );
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::shared_ptr< IntegrationEventHandler< Eigen::VectorXd, double > > integrationEventHandler );
 
 } // namespace propagators
 
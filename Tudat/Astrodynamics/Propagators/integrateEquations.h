@@ -22,6 +22,7 @@
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/Basics/timeType.h"
+#include "Tudat/Astrodynamics/Propagators/integrationEvents.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
@@ -439,6 +440,7 @@ void propagateToExactTerminationCondition(
  *  \param printInterval Frequency with which to print progress to console (nan = never).
  *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
  *  By default now(), i.e. the moment at which this function is called.
+ *  \param integrationEventHandler Object to detect, locate and process integration events after each step (default none).
  *  \return Event that triggered the termination of the propagation
  */
 template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
@@ -453,7 +455,8 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
         const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
         const int saveFrequency = TUDAT_NAN,
         const TimeType printInterval = TUDAT_NAN,
-        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+        const std::shared_ptr< IntegrationEventHandler< StateType, TimeType > > integrationEventHandler = nullptr )
 {
     std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason;
 
@@ -462,6 +465,12 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
     TimeType initialTime = currentTime;
     StateType newState = integrator->getCurrentState( );
 
+    // Evaluate event functions at initial state
+    if( integrationEventHandler != nullptr )
+    {
+        integrationEventHandler->initialize( integrator );
+    }
+
     // Initialization of numerical solutions for variational equations
     solutionHistory.clear( );
     solutionHistory[ currentTime ] = newState;
@@ -523,10 +532,24 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
                 currentTime = integrator->getCurrentIndependentVariable( );
                 timeStep = integrator->getNextStepSize( );
 
+                // Detect and process integration events in last step. If an event requiring an action is found, the
+                // integrator is moved to the event, and the state at the event is always saved.
+                bool isIntegrationEventProcessed = false;
+                if( integrationEventHandler != nullptr )
+                {
+                    isIntegrationEventProcessed = integrationEventHandler->processIntegrationStep( integrator );
+                    if( isIntegrationEventProcessed )
+                    {
+                        currentTime = integrator->getCurrentIndependentVariable( );
+                        newState = integrator->getCurrentState( );
+                        timeStep = integrator->getNextStepSize( );
+                    }
+                }
+
                 // Save integration result in map
                 saveIndex++;
                 saveIndex = saveIndex % saveFrequency;
-                if( saveIndex == 0 )
+                if( saveIndex == 0 || isIntegrationEventProcessed )
                 {
                     solutionHistory[ currentTime ] = newState;
 
@@ -563,7 +586,13 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
                 }
             }
 
-            if( propagationTerminationCondition->checkStopCondition( static_cast< double >( currentTime ), currentCPUTime ) )
+            if( integrationEventHandler != nullptr && integrationEventHandler->getStopIntegration( ) )
+            {
+                propagationTerminationReason = std::make_shared< PropagationTerminationDetails >(
+                            integration_event_reached );
+                breakPropagation = true;
+            }
+            else if( propagationTerminationCondition->checkStopCondition( static_cast< double >( currentTime ), currentCPUTime ) )
             {
                 if( propagationTerminationCondition->getTerminateExactlyOnFinalCondition( ) )
                 {
@@ -622,7 +651,8 @@ Eigen::MatrixXd, double, double >(
         const std::function< void( Eigen::MatrixXd& ) > statePostProcessingFunction,
         const int saveFrequency,
         const double printInterval,
-        const std::chrono::steady_clock::time_point initialClockTime );
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::shared_ptr< IntegrationEventHandler< Eigen::MatrixXd, double > > integrationEventHandler );
 
 
 extern template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
@@ -637,7 +667,8 @@ Eigen::VectorXd, double, double >(
         const std::function< void( Eigen::VectorXd& ) > statePostProcessingFunction,
         const int saveFrequency,
         const double printInterval,
-        const std::chrono::steady_clock::time_point initialClockTime );
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::shared_ptr< IntegrationEventHandler< Eigen::VectorXd, double > > integrationEventHandler );
 
 
 //! Interface class for integrating some state derivative function.
@@ -671,6 +702,8 @@ public:
      *  \param printInterval Frequency with which to print progress to console (nan = never).
      *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
      *  By default now(), i.e. the moment at which this function is called.
+     *  \param integrationEventHandler Object to detect, locate and process integration events after each step (default
+     *  none).
      *  \return Event that triggered the termination of the propagation
      */
     static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
@@ -684,7 +717,8 @@ public:
             const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
             const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
             const TimeType printInterval = TUDAT_NAN,
-            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) );
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::shared_ptr< IntegrationEventHandler< StateType, TimeType > > integrationEventHandler = nullptr );
 
 };
 
@@ -713,6 +747,8 @@ public:
      *  \param printInterval Frequency with which to print progress to console (nan = never).
      *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
      *  By default now(), i.e. the moment at which this function is called.
+     *  \param integrationEventHandler Object to detect, locate and process integration events after each step (default
+     *  none).
      *  \return Event that triggered the termination of the propagation
      */
     static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
@@ -726,7 +762,8 @@ public:
             const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
             const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
             const double printInterval = TUDAT_NAN,
-            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::shared_ptr< IntegrationEventHandler< StateType, double > > integrationEventHandler = nullptr )
     {
         std::function< bool( const double, const double ) > stopPropagationFunction =
                 std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
@@ -749,7 +786,8 @@ public:
                     statePostProcessingFunction,
                     integratorSettings->saveFrequency_,
                     printInterval,
-                    initialClockTime );
+                    initialClockTime,
+                    integrationEventHandler );
     }
 
 };
@@ -779,6 +817,8 @@ public:
      *  \param printInterval Frequency with which to print progress to console (nan = never).
      *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
      *  By default now(), i.e. the moment at which this function is called.
+     *  \param integrationEventHandler Object to detect, locate and process integration events after each step (default
+     *  none).
      *  \return Event that triggered the termination of the propagation
      */
     static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
@@ -792,7 +832,8 @@ public:
             const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
             const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
             const Time printInterval = TUDAT_NAN,
-            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::shared_ptr< IntegrationEventHandler< StateType, Time > > integrationEventHandler = nullptr )
     {
         std::function< bool( const double, const double ) > stopPropagationFunction =
                 std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
@@ -815,7 +856,8 @@ public:
                     statePostProcessingFunction,
                     integratorSettings->saveFrequency_,
                     printInterval,
-                    initialClockTime );
+                    initialClockTime,
+                    integrationEventHandler );
     }
 
 };
@@ -0,0 +1,721 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_INTEGRATIONEVENTS_H
+#define TUDAT_INTEGRATIONEVENTS_H
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/BasicMathematics/functionProxy.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/numericalIntegrator.h"
+#include "Tudat/Mathematics/RootFinders/bisection.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Actions that can be taken when an integration event (zero crossing of an event function) is detected.
+enum IntegrationEventAction
+{
+    log_integration_event,
+    restart_integration_at_event,
+    reset_state_at_event,
+    stop_integration_at_event
+};
+
+//! Direction of the zero crossing of an event function that is to be detected.
+enum IntegrationEventDirection
+{
+    any_event_crossing,
+    increasing_event_crossing,
+    decreasing_event_crossing
+};
+
+//! Class defining an event that is to be monitored during the numerical integration.
+/*!
+ *  Class defining an event that is to be monitored during the numerical integration. An event is defined as a zero
+ *  crossing of a scalar event function of time and state (e.g. the z-component of the position for a node crossing, the
+ *  altitude w.r.t. a threshold value, or a shadow condition function). When a crossing is detected, the action defined
+ *  by this object is taken:
+ *  log_integration_event: The event is recorded, and the integration continues unaltered.
+ *  restart_integration_at_event: The integrator is stepped exactly to the event, after which the integration is
+ *  restarted, so that no integration step crosses the event (for instance, when the state derivative model is
+ *  discontinuous at the event, such as thrust switching or shadow boundaries).
+ *  reset_state_at_event: As restart_integration_at_event, but with the state replaced by the output of the state reset
+ *  function (for instance an impulsive manoeuvre).
+ *  stop_integration_at_event: The integrator is stepped exactly to the event, after which the integration is stopped.
+ */
+template< typename StateType = Eigen::VectorXd, typename TimeType = double >
+class IntegrationEvent
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventFunction Event function, as a function of time and state, of which the zero crossings are to be
+     * detected.
+     * \param eventAction Action that is to be taken when the event is detected.
+     * \param eventDirection Direction of the zero crossings that are to be detected.
+     * \param stateResetFunction Function returning the state after the event, as a function of the time and state at
+     * the event (only used for reset_state_at_event action).
+     * \param timeTolerance Tolerance to which the time of the event is to be determined.
+     * \param eventName Name of the event (for identification in output only).
+     */
+    IntegrationEvent(
+            const std::function< double( const TimeType, const StateType& ) > eventFunction,
+            const IntegrationEventAction eventAction = log_integration_event,
+            const IntegrationEventDirection eventDirection = any_event_crossing,
+            const std::function< StateType( const TimeType, const StateType& ) > stateResetFunction =
+            std::function< StateType( const TimeType, const StateType& ) >( ),
+            const double timeTolerance = 1.0E-6,
+            const std::string& eventName = "" ):
+        eventFunction_( eventFunction ), eventAction_( eventAction ), eventDirection_( eventDirection ),
+        stateResetFunction_( stateResetFunction ), timeTolerance_( timeTolerance ), eventName_( eventName )
+    {
+        if( eventAction_ == reset_state_at_event && stateResetFunction_ == nullptr )
+        {
+            throw std::runtime_error( "Error when creating integration event " + eventName_ +
+                                      ", state reset action requires a state reset function." );
+        }
+
+        if( !( timeTolerance_ > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when creating integration event " + eventName_ +
+                                      ", time tolerance must be positive." );
+        }
+    }
+
+    //! Function to evaluate the event function
+    /*!
+     * Function to evaluate the event function
+     * \param time Time at which event function is to be evaluated.
+     * \param state State at which event function is to be evaluated.
+     * \return Event function value
+     */
+    double evaluateEventFunction( const TimeType time, const StateType& state )
+    {
+        return eventFunction_( time, state );
+    }
+
+    //! Function to check whether a sign change of the event function is to be detected as an event
+    /*!
+     * Function to check whether a sign change of the event function is to be detected as an event, based on the
+     * requested crossing direction.
+     * \param isIncreasing True if the event function changes from negative to non-negative, false if it changes from
+     * non-negative to negative.
+     * \return True if the crossing is to be detected as an event.
+     */
+    bool isCrossingDirectionDetected( const bool isIncreasing )
+    {
+        return ( eventDirection_ == any_event_crossing ) ||
+                ( eventDirection_ == increasing_event_crossing && isIncreasing ) ||
+                ( eventDirection_ == decreasing_event_crossing && !isIncreasing );
+    }
+
+    //! Function to retrieve the state after the event
+    /*!
+     * Function to retrieve the state after the event, from the state reset function (if any).
+     * \param time Time of the event.
+     * \param state State at the event.
+     * \return State after the event.
+     */
+    StateType getStateAfterEvent( const TimeType time, const StateType& state )
+    {
+        return ( stateResetFunction_ == nullptr ) ? state : stateResetFunction_( time, state );
+    }
+
+    //! Function to retrieve the action that is to be taken when the event is detected.
+    /*!
+     * Function to retrieve the action that is to be taken when the event is detected.
+     * \return Action that is to be taken when the event is detected.
+     */
+    IntegrationEventAction getEventAction( )
+    {
+        return eventAction_;
+    }
+
+    //! Function to retrieve the direction of the zero crossings that are to be detected.
+    /*!
+     * Function to retrieve the direction of the zero crossings that are to be detected.
+     * \return Direction of the zero crossings that are to be detected.
+     */
+    IntegrationEventDirection getEventDirection( )
+    {
+        return eventDirection_;
+    }
+
+    //! Function to retrieve the tolerance to which the time of the event is to be determined.
+    /*!
+     * Function to retrieve the tolerance to which the time of the event is to be determined.
+     * \return Tolerance to which the time of the event is to be determined.
+     */
+    double getTimeTolerance( )
+    {
+        return timeTolerance_;
+    }
+
+    //! Function to retrieve the name of the event.
+    /*!
+     * Function to retrieve the name of the event.
+     * \return Name of the event.
+     */
+    std::string getEventName( )
+    {
+        return eventName_;
+    }
+
+protected:
+
+    //! Event function, as a function of time and state, of which the zero crossings are to be detected.
+    std::function< double( const TimeType, const StateType& ) > eventFunction_;
+
+    //! Action that is to be taken when the event is detected.
+    IntegrationEventAction eventAction_;
+
+    //! Direction of the zero crossings that are to be detected.
+    IntegrationEventDirection eventDirection_;
+
+    //! Function returning the state after the event, as a function of the time and state at the event.
+    std::function< StateType( const TimeType, const StateType& ) > stateResetFunction_;
+
+    //! Tolerance to which the time of the event is to be determined.
+    double timeTolerance_;
+
+    //! Name of the event (for identification in output only).
+    std::string eventName_;
+};
+
+//! Object recording a single detected integration event.
+template< typename StateType = Eigen::VectorXd, typename TimeType = double >
+struct IntegrationEventRecord
+{
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventIndex Index of event (in list of events provided to IntegrationEventHandler) that was detected.
+     * \param eventTime Time at which the event function crosses zero.
+     * \param stateAtEvent State at the event (before any reset of the state).
+     * \param isIncreasing True if the event function changes from negative to non-negative, false otherwise.
+     */
+    IntegrationEventRecord( const int eventIndex, const TimeType eventTime, const StateType& stateAtEvent,
+                            const bool isIncreasing ):
+        eventIndex_( eventIndex ), eventTime_( eventTime ), stateAtEvent_( stateAtEvent ),
+        isIncreasing_( isIncreasing ){ }
+
+    //! Index of event (in list of events provided to IntegrationEventHandler) that was detected.
+    int eventIndex_;
+
+    //! Time at which the event function crosses zero.
+    TimeType eventTime_;
+
+    //! State at the event (before any reset of the state).
+    StateType stateAtEvent_;
+
+    //! True if the event function changes from negative to non-negative, false otherwise.
+    bool isIncreasing_;
+};
+
+//! Function to create an event function that depends on the environment, rather than only on the propagated state.
+/*!
+ * Function to create an event function that depends on the environment (for instance a dependent variable, such as the
+ * altitude or shadow function), rather than only on the propagated state. Before the variable is retrieved, the state
+ * derivative function is evaluated, so that the environment is updated to the time and state at which the event
+ * function is evaluated. Since the event handler evaluates the event functions at trial points (interpolated states
+ * and refinement steps), the environment is left at the last trial point on return, rather than at the current state
+ * of the integrator. The environment is only consistent with the propagation again after the next evaluation of the
+ * state derivative by the integrator.
+ * \param stateDerivativeFunction State derivative function of the propagation, used to update the environment.
+ * \param variableFunction Function returning the variable on which the event depends, from the current environment.
+ * \param thresholdValue Value of the variable at which the event occurs.
+ * \return Event function, which is zero when the variable is equal to the threshold value.
+ */
+template< typename StateType = Eigen::VectorXd, typename TimeType = double >
+std::function< double( const TimeType, const StateType& ) > createEnvironmentDependentEventFunction(
+        const std::function< StateType( const TimeType, const StateType& ) > stateDerivativeFunction,
+        const std::function< double( ) > variableFunction,
+        const double thresholdValue = 0.0 )
+{
+    return [ = ]( const TimeType time, const StateType& state )
+    {
+        stateDerivativeFunction( time, state );
+        return variableFunction( ) - thresholdValue;
+    };
+}
+
+//! Class to detect, locate and process integration events during a numerical integration.
+/*!
+ *  Class to detect, locate and process integration events during a numerical integration. After each accepted
+ *  integration step, all event functions are evaluated, and sign changes w.r.t. the previous step are detected. The
+ *  zero crossings are located by a bisection root finder applied to the event functions evaluated on a cubic Hermite
+ *  interpolant of the state over the step (using the states and state derivatives at both ends of the step), so that no
+ *  additional integration steps are needed to locate the event. Logged events are recorded using the interpolated state
+ *  (with an accuracy limited by that of the interpolation). For the first event in the step that requires an action
+ *  (restart, reset or stop), the integrator is rolled back, and the event time is refined by integrating from the start
+ *  of the step to trial times (with step-size control switched off), starting from the interpolated event time, after
+ *  which the action is applied. Subsequent integration steps then start exactly at the event, so that the integrator
+ *  does not need to reduce its step size to resolve a discontinuity in the state derivative. Events that are found
+ *  later in the same step are detected again in the next step.
+ */
+template< typename StateType = Eigen::VectorXd, typename TimeType = double >
+class IntegrationEventHandler
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param integrationEvents List of events that are to be monitored.
+     */
+    IntegrationEventHandler(
+            const std::vector< std::shared_ptr< IntegrationEvent< StateType, TimeType > > >& integrationEvents ):
+        integrationEvents_( integrationEvents ), stopIntegration_( false )
+    {
+        for( unsigned int i = 0; i < integrationEvents_.size( ); i++ )
+        {
+            if( integrationEvents_.at( i ) == nullptr )
+            {
+                throw std::runtime_error( "Error when creating integration event handler, event " +
+                                          std::to_string( i ) + " not defined." );
+            }
+        }
+    }
+
+    //! Function to initialize the event handler at the start of the numerical integration
+    /*!
+     * Function to initialize the event handler at the start of the numerical integration, evaluating all event
+     * functions at the initial state of the integrator, and clearing the events recorded in any previous integration.
+     * \param integrator Numerical integrator used for the propagation.
+     */
+    template< typename TimeStepType >
+    void initialize( const std::shared_ptr< numerical_integrators::NumericalIntegrator<
+                     TimeType, StateType, StateType, TimeStepType > > integrator )
+    {
+        eventRecords_.clear( );
+        stopIntegration_ = false;
+        resetStepStartData( integrator, -1, false );
+    }
+
+    //! Function to detect and process the integration events in the integration step that was last taken.
+    /*!
+     * Function to detect and process the integration events in the integration step that was last taken. If an event
+     * that requires an action is found, the current time and state of the integrator are modified to those at the
+     * event (after reset of the state, if applicable), and the next step size of the integrator is set to the value it
+     * had before the event was processed.
+     * \param integrator Numerical integrator used for the propagation, of which the last step is to be checked.
+     * \return True if the current time/state of the integrator was modified to that of an event, false otherwise.
+     */
+    template< typename TimeStepType >
+    bool processIntegrationStep( const std::shared_ptr< numerical_integrators::NumericalIntegrator<
+                                 TimeType, StateType, StateType, TimeStepType > > integrator )
+    {
+        // Retrieve data at end of step (state derivative is retrieved from the integrator, so that it is reused in the
+        // next step), and evaluate event functions.
+        const TimeType stepEndTime = integrator->getCurrentIndependentVariable( );
+        const StateType stepEndState = integrator->getCurrentState( );
+        const StateType stepEndStateDerivative = integrator->getCurrentStateDerivative( );
+
+        std::vector< double > stepEndEventValues;
+        for( unsigned int i = 0; i < integrationEvents_.size( ); i++ )
+        {
+            stepEndEventValues.push_back(
+                        integrationEvents_.at( i )->evaluateEventFunction( stepEndTime, stepEndState ) );
+        }
+
+        // Locate all zero crossings (as fraction of step) that are to be detected
+        const double stepSize = static_cast< double >( stepEndTime - stepStartTime_ );
+        std::vector< std::pair< double, int > > detectedCrossings;
+        for( unsigned int i = 0; i < integrationEvents_.size( ); i++ )
+        {
+            const bool isIncreasing = ( stepStartEventValues_.at( i ) < 0.0 );
+            if( ( stepStartEventValues_.at( i ) < 0.0 ) != ( stepEndEventValues.at( i ) < 0.0 ) &&
+                    integrationEvents_.at( i )->isCrossingDirectionDetected( isIncreasing ) )
+            {
+                detectedCrossings.push_back(
+                            std::make_pair( locateZeroCrossing(
+                                                i, stepSize, stepEndState, stepEndStateDerivative ), i ) );
+            }
+        }
+        std::stable_sort( detectedCrossings.begin( ), detectedCrossings.end( ),
+                          [ ]( const std::pair< double, int >& crossing1, const std::pair< double, int >& crossing2 )
+        {
+            return crossing1.first < crossing2.first;
+        } );
+
+        // Record logged events, up to first event requiring an action.
+        int actingEventIndex = -1;
+        double actingEventStepFraction = TUDAT_NAN;
+        for( unsigned int i = 0; i < detectedCrossings.size( ); i++ )
+        {
+            const int eventIndex = detectedCrossings.at( i ).second;
+            if( integrationEvents_.at( eventIndex )->getEventAction( ) == log_integration_event )
+            {
+                eventRecords_.push_back(
+                            IntegrationEventRecord< StateType, TimeType >(
+                                eventIndex, stepStartTime_ + detectedCrossings.at( i ).first * stepSize,
+                                interpolateState( detectedCrossings.at( i ).first, stepSize, stepEndState,
+                                                  stepEndStateDerivative ),
+                                stepStartEventValues_.at( eventIndex ) < 0.0 ) );
+            }
+            else
+            {
+                actingEventIndex = eventIndex;
+                actingEventStepFraction = detectedCrossings.at( i ).first;
+                break;
+            }
+        }
+
+        if( actingEventIndex < 0 )
+        {
+            stepStartTime_ = stepEndTime;
+            stepStartState_ = stepEndState;
+            stepStartStateDerivative_ = stepEndStateDerivative;
+            stepStartEventValues_ = stepEndEventValues;
+            return false;
+        }
+
+        // Re-integrate exactly to the event requiring an action (retaining the step size planned for the next step,
+        // as the integrator's step size is modified when locating the event).
+        const bool isIncreasing = ( stepStartEventValues_.at( actingEventIndex ) < 0.0 );
+        const TimeStepType nextStepSize = integrator->getNextStepSize( );
+        if( !integrator->rollbackToPreviousState( ) )
+        {
+            throw std::runtime_error( "Error when processing integration event " +
+                                      integrationEvents_.at( actingEventIndex )->getEventName( ) +
+                                      ", integrator could not be rolled back to start of step." );
+        }
+        refineZeroCrossing( integrator, actingEventIndex, stepSize, actingEventStepFraction,
+                            stepEndEventValues.at( actingEventIndex ) );
+
+        // Record and apply event
+        const StateType stateAtEvent = integrator->getCurrentState( );
+        eventRecords_.push_back(
+                    IntegrationEventRecord< StateType, TimeType >(
+                        actingEventIndex, integrator->getCurrentIndependentVariable( ), stateAtEvent, isIncreasing ) );
+        switch( integrationEvents_.at( actingEventIndex )->getEventAction( ) )
+        {
+        case restart_integration_at_event:
+            break;
+        case reset_state_at_event:
+            integrator->modifyCurrentState(
+                        integrationEvents_.at( actingEventIndex )->getStateAfterEvent(
+                            integrator->getCurrentIndependentVariable( ), stateAtEvent ) );
+            break;
+        case stop_integration_at_event:
+            stopIntegration_ = true;
+            break;
+        default:
+            throw std::runtime_error( "Error when processing integration event, action not recognized." );
+        }
+
+        integrator->setNextStepSize( nextStepSize );
+        resetStepStartData( integrator, actingEventIndex, isIncreasing );
+        return true;
+    }
+
+    //! Function to retrieve whether an event requiring the integration to be stopped has been detected.
+    /*!
+     * Function to retrieve whether an event requiring the integration to be stopped has been detected.
+     * \return True if an event requiring the integration to be stopped has been detected.
+     */
+    bool getStopIntegration( )
+    {
+        return stopIntegration_;
+    }
+
+    //! Function to retrieve the list of events detected during the integration.
+    /*!
+     * Function to retrieve the list of events detected during the integration, in the order in which they occurred.
+     * \return List of events detected during the integration.
+     */
+    std::vector< IntegrationEventRecord< StateType, TimeType > > getEventRecords( )
+    {
+        return eventRecords_;
+    }
+
+    //! Function to retrieve the times of events detected during the integration, for a single event.
+    /*!
+     * Function to retrieve the times of events detected during the integration, for a single event.
+     * \param eventIndex Index of event (in list of events provided to constructor) for which times are to be retrieved.
+     * \return Times at which the given event was detected.
+     */
+    std::vector< TimeType > getEventTimes( const int eventIndex )
+    {
+        std::vector< TimeType > eventTimes;
+        for( unsigned int i = 0; i < eventRecords_.size( ); i++ )
+        {
+            if( eventRecords_.at( i ).eventIndex_ == eventIndex )
+            {
+                eventTimes.push_back( eventRecords_.at( i ).eventTime_ );
+            }
+        }
+        return eventTimes;
+    }
+
+    //! Function to retrieve the list of events that are monitored.
+    /*!
+     * Function to retrieve the list of events that are monitored.
+     * \return List of events that are monitored.
+     */
+    std::vector< std::shared_ptr< IntegrationEvent< StateType, TimeType > > > getIntegrationEvents( )
+    {
+        return integrationEvents_;
+    }
+
+protected:
+
+    //! Function to set the data at the start of the next step from the current state of the integrator.
+    /*!
+     * Function to set the data at the start of the next step from the current state of the integrator.
+     * \param integrator Numerical integrator used for the propagation.
+     * \param processedEventIndex Index of event that was processed at the current time (-1 if none), for which the
+     * event function value is set to the value after the zero crossing, to prevent the event from being detected twice.
+     * \param isProcessedEventIncreasing True if the processed event function changes from negative to non-negative.
+     */
+    template< typename TimeStepType >
+    void resetStepStartData( const std::shared_ptr< numerical_integrators::NumericalIntegrator<
+                             TimeType, StateType, StateType, TimeStepType > > integrator,
+                             const int processedEventIndex, const bool isProcessedEventIncreasing )
+    {
+        stepStartTime_ = integrator->getCurrentIndependentVariable( );
+        stepStartState_ = integrator->getCurrentState( );
+        stepStartStateDerivative_ = integrator->getCurrentStateDerivative( );
+
+        stepStartEventValues_.clear( );
+        for( unsigned int i = 0; i < integrationEvents_.size( ); i++ )
+        {
+            if( static_cast< int >( i ) == processedEventIndex )
+            {
+                stepStartEventValues_.push_back( isProcessedEventIncreasing ? 0.0 : -1.0 );
+            }
+            else
+            {
+                stepStartEventValues_.push_back(
+                            integrationEvents_.at( i )->evaluateEventFunction( stepStartTime_, stepStartState_ ) );
+            }
+        }
+    }
+
+    //! Function to compute the state at a given fraction of the current step, from cubic Hermite interpolation.
+    /*!
+     * Function to compute the state at a given fraction of the current step, from cubic Hermite interpolation between
+     * the states and state derivatives at the start and end of the step.
+     * \param stepFraction Fraction of the step (between 0 and 1) at which the state is to be computed.
+     * \param stepSize Size of the current step.
+     * \param stepEndState State at the end of the current step.
+     * \param stepEndStateDerivative State derivative at the end of the current step.
+     * \return Interpolated state.
+     */
+    StateType interpolateState( const double stepFraction, const double stepSize,
+                                const StateType& stepEndState, const StateType& stepEndStateDerivative )
+    {
+        typedef typename StateType::Scalar StateScalarType;
+
+        const double squaredStepFraction = stepFraction * stepFraction;
+        const double cubedStepFraction = squaredStepFraction * stepFraction;
+        return static_cast< StateScalarType >( 2.0 * cubedStepFraction - 3.0 * squaredStepFraction + 1.0 ) *
+                stepStartState_ +
+                static_cast< StateScalarType >( ( cubedStepFraction - 2.0 * squaredStepFraction + stepFraction ) *
+                                                stepSize ) * stepStartStateDerivative_ +
+                static_cast< StateScalarType >( -2.0 * cubedStepFraction + 3.0 * squaredStepFraction ) *
+                stepEndState +
+                static_cast< StateScalarType >( ( cubedStepFraction - squaredStepFraction ) * stepSize ) *
+                stepEndStateDerivative;
+    }
+
+    //! Function to locate the zero crossing of a single event function in the current step.
+    /*!
+     * Function to locate the zero crossing of a single event function in the current step, using a bisection root
+     * finder applied to the event function evaluated on the interpolated state.
+     * \param eventIndex Index of event for which the zero crossing is to be located.
+     * \param stepSize Size of the current step.
+     * \param stepEndState State at the end of the current step.
+     * \param stepEndStateDerivative State derivative at the end of the current step.
+     * \return Fraction of the step (between 0 and 1) at which the event function crosses zero.
+     */
+    double locateZeroCrossing( const int eventIndex, const double stepSize,
+                               const StateType& stepEndState, const StateType& stepEndStateDerivative )
+    {
+        const std::shared_ptr< IntegrationEvent< StateType, TimeType > > integrationEvent =
+                integrationEvents_.at( eventIndex );
+        const double startValue = stepStartEventValues_.at( eventIndex );
+
+        // Define event function as function of step fraction, using exact values at ends of the step.
+        std::function< double( const double ) > interpolatedEventFunction = [ & ]( const double stepFraction )
+        {
+            if( stepFraction <= 0.0 )
+            {
+                return startValue;
+            }
+            return integrationEvent->evaluateEventFunction(
+                        stepStartTime_ + stepFraction * stepSize,
+                        interpolateState( stepFraction, stepSize, stepEndState, stepEndStateDerivative ) );
+        };
+
+        root_finders::BisectionCore< double > bisection(
+                    std::bind( &root_finders::termination_conditions::
+                               RootAbsoluteToleranceTerminationCondition< double >::checkTerminationCondition,
+                               std::make_shared< root_finders::termination_conditions::
+                               RootAbsoluteToleranceTerminationCondition< double > >(
+                                   integrationEvent->getTimeTolerance( ) / std::fabs( stepSize ), 100, false ),
+                               std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+                               std::placeholders::_4, std::placeholders::_5 ),
+                    0.0, 1.0 );
+        return bisection.execute(
+                    std::make_shared< basic_mathematics::FunctionProxy< double, double > >(
+                        interpolatedEventFunction ) );
+    }
+
+    //! Function to refine the zero crossing of an event function in the current step by numerical integration.
+    /*!
+     * Function to refine the zero crossing of an event function in the current step, by repeatedly integrating from the
+     * start of the step (with step-size control switched off) to trial times, and evaluating the event function at the
+     * resulting state. A safeguarded secant method is used, starting from the zero crossing found from the interpolated
+     * state, which is typically converged in a few iterations. On output, the integrator is at the refined event time.
+     * \param integrator Numerical integrator used for the propagation, rolled back to the start of the step on input.
+     * \param eventIndex Index of event for which the zero crossing is to be refined.
+     * \param stepSize Size of the current step.
+     * \param initialStepFraction Fraction of the step at which the zero crossing was found from the interpolated state.
+     * \param stepEndValue Value of the event function at the end of the current step.
+     */
+    template< typename TimeStepType >
+    void refineZeroCrossing( const std::shared_ptr< numerical_integrators::NumericalIntegrator<
+                             TimeType, StateType, StateType, TimeStepType > > integrator,
+                             const int eventIndex, const double stepSize, const double initialStepFraction,
+                             const double stepEndValue )
+    {
+        const std::shared_ptr< IntegrationEvent< StateType, TimeType > > integrationEvent =
+                integrationEvents_.at( eventIndex );
+        const double fractionTolerance = integrationEvent->getTimeTolerance( ) / std::fabs( stepSize );
+
+        // Define event function as function of step fraction, from integration over part of the step.
+        bool isIntegratorAtStepStart = true;
+        std::function< double( const double ) > integratedEventFunction = [ & ]( const double stepFraction )
+        {
+            if( !isIntegratorAtStepStart )
+            {
+                integrator->rollbackToPreviousState( );
+            }
+            integrator->setStepSizeControl( false );
+            integrator->performIntegrationStep( static_cast< TimeStepType >( stepFraction * stepSize ) );
+            integrator->setStepSizeControl( true );
+            isIntegratorAtStepStart = false;
+            return integrationEvent->evaluateEventFunction(
+                        integrator->getCurrentIndependentVariable( ), integrator->getCurrentState( ) );
+        };
+
+        // Initialize bracket, and function to update bracket with new iterate.
+        const bool isStartValueNegative = ( stepStartEventValues_.at( eventIndex ) < 0.0 );
+        double lowerFraction = 0.0;
+        double upperFraction = 1.0;
+        double lowerValue = stepStartEventValues_.at( eventIndex );
+        double upperValue = stepEndValue;
+        std::function< void( const double, const double ) > updateBracket =
+                [ & ]( const double stepFraction, const double eventValue )
+        {
+            if( ( ( eventValue < 0.0 ) == isStartValueNegative ) && ( stepFraction > lowerFraction ) )
+            {
+                lowerFraction = stepFraction;
+                lowerValue = eventValue;
+            }
+            else if( ( ( eventValue < 0.0 ) != isStartValueNegative ) && ( stepFraction < upperFraction ) )
+            {
+                upperFraction = stepFraction;
+                upperValue = eventValue;
+            }
+        };
+
+        // Evaluate first two iterates, at and close to the zero crossing of the interpolated state
+        double previousFraction = std::min( std::max( initialStepFraction, 0.0 ), 1.0 );
+        double previousValue = integratedEventFunction( previousFraction );
+        updateBracket( previousFraction, previousValue );
+
+        double currentFraction = std::min( std::max( previousFraction + (
+                ( ( previousValue < 0.0 ) == isStartValueNegative ) ? fractionTolerance : -fractionTolerance ),
+                                                     0.0 ), 1.0 );
+        double currentValue = integratedEventFunction( currentFraction );
+        updateBracket( currentFraction, currentValue );
+
+        // Iterate until converged, keeping zero crossing bracketed
+        for( unsigned int i = 0; i < 20; i++ )
+        {
+            if( currentValue == 0.0 || ( upperFraction - lowerFraction ) < fractionTolerance )
+            {
+                break;
+            }
+
+            double nextFraction = ( currentValue != previousValue ) ?
+                        currentFraction - currentValue * ( currentFraction - previousFraction ) /
+                        ( currentValue - previousValue ) : TUDAT_NAN;
+            if( !( nextFraction > lowerFraction && nextFraction < upperFraction ) )
+            {
+                nextFraction = lowerFraction - lowerValue * ( upperFraction - lowerFraction ) /
+                        ( upperValue - lowerValue );
+            }
+            const bool isConverged = std::fabs( nextFraction - currentFraction ) < fractionTolerance;
+
+            previousFraction = currentFraction;
+            previousValue = currentValue;
+            currentFraction = nextFraction;
+            currentValue = integratedEventFunction( currentFraction );
+            updateBracket( currentFraction, currentValue );
+
+            if( isConverged && ( ( currentValue < 0.0 ) != isStartValueNegative ) )
+            {
+                break;
+            }
+        }
+
+        // Ensure that integrator is at (post-crossing side of) converged zero crossing
+        if( ( currentValue < 0.0 ) == isStartValueNegative && currentValue != 0.0 )
+        {
+            integratedEventFunction( upperFraction );
+        }
+    }
+
+    //! List of events that are monitored.
+    std::vector< std::shared_ptr< IntegrationEvent< StateType, TimeType > > > integrationEvents_;
+
+    //! List of events detected during the integration, in the order in which they occurred.
+    std::vector< IntegrationEventRecord< StateType, TimeType > > eventRecords_;
+
+    //! Boolean denoting whether an event requiring the integration to be stopped has been detected.
+    bool stopIntegration_;
+
+    //! Time at the start of the current step.
+    TimeType stepStartTime_;
+
+    //! State at the start of the current step.
+    StateType stepStartState_;
+
+    //! State derivative at the start of the current step.
+    StateType stepStartStateDerivative_;
+
+    //! Values of the event functions at the start of the current step.
+    std::vector< double > stepStartEventValues_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_INTEGRATIONEVENTS_H
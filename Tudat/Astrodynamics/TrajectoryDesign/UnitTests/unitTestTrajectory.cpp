@@ -36,6 +36,7 @@
 
 #define BOOST_TEST_MAIN
 
+#include <thread>
 #include <vector>
 
 #include <boost/make_shared.hpp>
@@ -56,6 +57,7 @@
 
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
 #include "Tudat/Astrodynamics/TrajectoryDesign/trajectory.h"
+#include "Tudat/Astrodynamics/TrajectoryDesign/trajectoryPopulationEvaluator.h"
 
 namespace tudat
 {
@@ -494,6 +496,122 @@ BOOST_AUTO_TEST_CASE( testUpdateMGA1DSMVFTrajectory )
     BOOST_CHECK_CLOSE_FRACTION( expectedDeltaV, resultingDeltaV, tolerance );
 }
 
+//! Test parallel evaluation of a population of MGA-1DSM trajectories.
+BOOST_AUTO_TEST_CASE( testTrajectoryPopulationEvaluation )
+{
+    // Specify the number of legs and type of legs (Messenger trajectory, see above).
+    const int numberOfLegs = 5;
+    std::vector< TransferLegType > legTypeVector;
+    legTypeVector.resize( numberOfLegs );
+    legTypeVector[0] = mga1DsmVelocity_Departure; legTypeVector[1] = mga1DsmVelocity_Swingby;
+    legTypeVector[2] = mga1DsmVelocity_Swingby; legTypeVector[3] = mga1DsmVelocity_Swingby;
+    legTypeVector[4] = capture;
+
+    // Create the ephemeris vector.
+    std::vector< ephemerides::EphemerisPointer >
+            ephemerisVector( numberOfLegs );
+    ephemerisVector[ 0 ] = std::make_shared< ephemerides::ApproximatePlanetPositions >( ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::earthMoonBarycenter );
+    ephemerisVector[ 1 ] = std::make_shared< ephemerides::ApproximatePlanetPositions >( ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::earthMoonBarycenter );
+    ephemerisVector[ 2 ] = std::make_shared< ephemerides::ApproximatePlanetPositions >( ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::venus );
+    ephemerisVector[ 3 ] = std::make_shared< ephemerides::ApproximatePlanetPositions >( ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::venus );
+    ephemerisVector[ 4 ] = std::make_shared< ephemerides::ApproximatePlanetPositions >( ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::mercury );
+
+    Eigen::VectorXd gravitationalParameterVector( numberOfLegs );
+    gravitationalParameterVector << 3.9860119e14, 3.9860119e14, 3.24860e14, 3.24860e14, 2.2321e13;
+    const double sunGravitationalParameter = 1.32712428e20;
+    Eigen::VectorXd minimumPericenterRadii ( numberOfLegs );
+    minimumPericenterRadii << TUDAT_NAN, TUDAT_NAN, TUDAT_NAN, TUDAT_NAN, TUDAT_NAN;
+    Eigen::VectorXd semiMajorAxes ( 2 ), eccentricities ( 2 );
+    semiMajorAxes << std::numeric_limits< double >::infinity( ),
+                     std::numeric_limits< double >::infinity( );
+    eccentricities << 0., 0.;
+
+    // Create nominal variable vector.
+    Eigen::VectorXd nominalVariableVector ( numberOfLegs + 1 + 4 * ( numberOfLegs - 1 ) );
+    nominalVariableVector << 1171.64503236 * physical_constants::JULIAN_DAY,
+                             399.999999715 * physical_constants::JULIAN_DAY,
+                             178.372255301 * physical_constants::JULIAN_DAY,
+                             299.223139512 * physical_constants::JULIAN_DAY,
+                             180.510754824 * physical_constants::JULIAN_DAY,
+                             1,
+                             0.234594654679, 1408.99421278, 0.37992647165 * 2 * 3.14159265358979,
+                             std::acos(  2 * 0.498004040298 - 1 ) - 3.14159265358979 / 2,
+                             0.0964769387134, 1.35077257078, 1.80629232251 * 6.378e6, 0.0,
+                             0.829948744508, 1.09554368115, 3.04129845698 * 6.052e6, 0.0,
+                             0.317174785637, 1.34317576594, 1.10000000891 * 6.052e6, 0.0;
+
+    // Create population of perturbed variable vectors, where groups of trajectories share the
+    // same epochs (to exercise the ephemeris cache).
+    const int populationSize = 40;
+    Eigen::MatrixXd population( nominalVariableVector.rows( ), populationSize );
+    for( int i = 0; i < populationSize; i++ )
+    {
+        population.col( i ) = nominalVariableVector;
+        population( 0, i ) += static_cast< double >( i / 4 ) * physical_constants::JULIAN_DAY;
+        population( 6, i ) *= 1.0 + 0.01 * static_cast< double >( i % 4 );
+        population( 15, i ) *= 1.0 - 0.005 * static_cast< double >( i % 4 );
+    }
+
+    // Compute expected Delta V by updating single trajectory object.
+    Trajectory messenger ( numberOfLegs, legTypeVector, ephemerisVector,
+                           gravitationalParameterVector, nominalVariableVector,
+                           sunGravitationalParameter, minimumPericenterRadii, semiMajorAxes,
+                           eccentricities );
+    Eigen::VectorXd expectedDeltaV( populationSize );
+    for( int i = 0; i < populationSize; i++ )
+    {
+        messenger.updateVariableVector( population.col( i ) );
+        messenger.updateEphemeris( );
+        messenger.calculateTrajectory( expectedDeltaV( i ) );
+    }
+
+    // Compute Delta V of population with and without ephemeris cache, and with multiple threads.
+    for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+    {
+        for( unsigned int cacheSize = 0; cacheSize <= 100; cacheSize += 100 )
+        {
+            TrajectoryPopulationEvaluator populationEvaluator(
+                        numberOfLegs, legTypeVector, ephemerisVector, gravitationalParameterVector,
+                        sunGravitationalParameter, minimumPericenterRadii, semiMajorAxes, eccentricities,
+                        true, true, numberOfThreads, cacheSize );
+            BOOST_CHECK_EQUAL( populationEvaluator.getNumberOfThreads( ), numberOfThreads );
+
+            Eigen::VectorXd computedDeltaV = populationEvaluator.computeTotalDeltaV( population );
+            for( int i = 0; i < populationSize; i++ )
+            {
+                BOOST_CHECK_EQUAL( computedDeltaV( i ), expectedDeltaV( i ) );
+            }
+
+            // Evaluate again (using cached states).
+            std::vector< Eigen::VectorXd > populationList;
+            for( int i = 0; i < populationSize; i++ )
+            {
+                populationList.push_back( population.col( i ) );
+            }
+            std::vector< double > recomputedDeltaV = populationEvaluator.computeTotalDeltaV( populationList );
+            for( int i = 0; i < populationSize; i++ )
+            {
+                BOOST_CHECK_EQUAL( recomputedDeltaV.at( i ), expectedDeltaV( i ) );
+            }
+
+            // Evaluate concurrently from two threads (calls on the same object are serialized).
+            populationEvaluator.clearEphemerisCache( );
+            std::vector< Eigen::VectorXd > concurrentDeltaV( 2 );
+            std::thread concurrentEvaluation( [ & ]( )
+            {
+                concurrentDeltaV.at( 0 ) = populationEvaluator.computeTotalDeltaV( population );
+            } );
+            concurrentDeltaV.at( 1 ) = populationEvaluator.computeTotalDeltaV( population );
+            concurrentEvaluation.join( );
+            for( int i = 0; i < populationSize; i++ )
+            {
+                BOOST_CHECK_EQUAL( concurrentDeltaV.at( 0 )( i ), expectedDeltaV( i ) );
+                BOOST_CHECK_EQUAL( concurrentDeltaV.at( 1 )( i ), expectedDeltaV( i ) );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -1,3 +1,6 @@
+#include <stdexcept>
+#include <string>
+
 #include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
@@ -164,6 +167,34 @@ void Trajectory::updateEphemeris( )
     // Calculate the ephemeris and store it in the corresponding variables in this class.
     extractEphemeris( );
 
+    // Update the ephemeris variables of the mission legs.
+    updateLegEphemeris( );
+}
+
+//! Update the ephemeris from given planet states.
+void Trajectory::updateEphemeris( const std::vector< Eigen::Vector6d >& planetStates )
+{
+    if ( planetStates.size( ) != numberOfLegs_ )
+    {
+        throw std::runtime_error( "Error when updating trajectory ephemeris, " +
+                                  std::to_string( planetStates.size( ) ) + " planet states provided for " +
+                                  std::to_string( static_cast< int >( numberOfLegs_ ) ) + " legs." );
+    }
+
+    // Set planet positions and velocities from the provided states.
+    for ( int counter = 0; counter < numberOfLegs_ ; counter++ )
+    {
+        planetPositionVector_[ counter ] = planetStates[ counter ].segment( 0, 3 );
+        planetVelocityVector_[ counter ] = planetStates[ counter ].segment( 3, 3 );
+    }
+
+    // Update the ephemeris variables of the mission legs.
+    updateLegEphemeris( );
+}
+
+//! Update the ephemeris variables of the mission legs.
+void Trajectory::updateLegEphemeris( )
+{
     // Loop through all the mission legs and update their ephemeris variables.
     for ( int counter = 0; counter < numberOfLegs_; counter++ )
     {
@@ -268,14 +299,20 @@ void Trajectory::prepareVelocityAndPositionVectors( )
 }
 
 int Trajectory::checkTrajectoryVariableVectorSize( )
+{
+    return getTrajectoryVariableVectorSize( legTypeVector_ );
+}
+
+//! Function to compute the required size of the trajectory variable vector.
+int getTrajectoryVariableVectorSize( const std::vector< TransferLegType >& legTypeVector )
 {
     // The size is always 1, which is the departure epoch.
     int size = 1;
 
     // Go through all the legs and add the appropriate amount of additional variables.
-    for ( int counter = 0; counter < numberOfLegs_; counter++ )
+    for ( unsigned int counter = 0; counter < legTypeVector.size( ); counter++ )
     {
-        switch ( legTypeVector_[ counter ] )
+        switch ( legTypeVector[ counter ] )
         {
             case mga_Departure: case mga_Swingby: case capture:
                 size += 1;
@@ -61,6 +61,16 @@ enum TransferLegType
     capture
 };
 
+//! Function to compute the required size of the trajectory variable vector.
+/*!
+ * Function to compute the required size of the trajectory variable vector for a given sequence of
+ * leg types: one entry for the departure epoch, one time of flight per leg, and four additional
+ * variables for each leg with a deep space maneuver.
+ * \param legTypeVector vector containing the leg types.
+ * \return Required size of the trajectory variable vector.
+ */
+int getTrajectoryVariableVectorSize( const std::vector< TransferLegType >& legTypeVector );
+
 //! Base class for computation of trajectories
 /*!
  * This class can compute entire space trajectories of various kinds by concatenating different
@@ -213,6 +223,17 @@ public:
      */
     void updateEphemeris( );
 
+    //! Update the ephemeris from given planet states.
+    /*!
+     * Sets all the positions and the velocities of the trajectory class and the underlying mission
+     * leg classes to the given values, instead of extracting them from the ephemerides. This allows
+     * the ephemerides to be evaluated (and cached) outside of this class, for instance when
+     * evaluating multiple trajectories in parallel.
+     * \param planetStates Cartesian states of the planets at the visitation times (one entry per
+     * leg), as would be obtained from the ephemeris vector.
+     */
+    void updateEphemeris( const std::vector< Eigen::Vector6d >& planetStates );
+
     //! Update the variable vector.
     /*!
      * Sets the trajectory defining variable vector to the newly specified values. Also sets all
@@ -385,6 +406,12 @@ private:
      */
     void extractEphemeris( );
 
+    //! Update the ephemeris variables of the mission legs.
+    /*!
+     * Passes the current planet positions and velocities to all the mission legs.
+     */
+    void updateLegEphemeris( );
+
 };
 
 } // namespace transfer_trajectories
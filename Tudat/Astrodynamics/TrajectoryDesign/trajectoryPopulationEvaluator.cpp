@@ -0,0 +1,165 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Basics/parallelExecution.h"
+
+#include "Tudat/Astrodynamics/TrajectoryDesign/trajectoryPopulationEvaluator.h"
+
+namespace tudat
+{
+
+namespace transfer_trajectories
+{
+
+//! Constructor.
+TrajectoryPopulationEvaluator::TrajectoryPopulationEvaluator(
+        const int numberOfLegs,
+        const std::vector< TransferLegType >& legTypeVector,
+        const std::vector< ephemerides::EphemerisPointer >& ephemerisVector,
+        const Eigen::VectorXd& gravitationalParameterVector,
+        const double centralBodyGravitationalParameter,
+        const Eigen::VectorXd& minimumPericenterRadiiVector,
+        const Eigen::VectorXd& semiMajorAxesVector,
+        const Eigen::VectorXd& eccentricityVector,
+        const bool includeDepartureDeltaV,
+        const bool includeArrivalDeltaV,
+        const unsigned int numberOfThreads,
+        const unsigned int maximumEphemerisCacheSize ):
+    numberOfLegs_( numberOfLegs ), ephemerisVector_( ephemerisVector ),
+    trajectoryVariableVectorSize_( getTrajectoryVariableVectorSize( legTypeVector ) ),
+    maximumEphemerisCacheSize_( maximumEphemerisCacheSize ),
+    ephemerisCache_( ephemerisVector.size( ) )
+{
+    if ( legTypeVector.size( ) != static_cast< unsigned int >( numberOfLegs ) ||
+         ephemerisVector.size( ) != static_cast< unsigned int >( numberOfLegs ) )
+    {
+        throw std::runtime_error( "Error when creating trajectory population evaluator, number of leg types (" +
+                                  std::to_string( legTypeVector.size( ) ) + ") and ephemerides (" +
+                                  std::to_string( ephemerisVector.size( ) ) +
+                                  ") must be equal to number of legs (" + std::to_string( numberOfLegs ) + ")" );
+    }
+
+    // Create a trajectory object for each thread, with a dummy variable vector (epochs of 0).
+    Eigen::VectorXd dummyVariableVector = Eigen::VectorXd::Zero( trajectoryVariableVectorSize_ );
+    for ( unsigned int i = 0; i < std::max( numberOfThreads, 1u ); i++ )
+    {
+        trajectories_.push_back(
+                    std::make_shared< Trajectory >(
+                        numberOfLegs, legTypeVector, ephemerisVector, gravitationalParameterVector,
+                        dummyVariableVector, centralBodyGravitationalParameter,
+                        minimumPericenterRadiiVector, semiMajorAxesVector, eccentricityVector,
+                        includeDepartureDeltaV, includeArrivalDeltaV ) );
+    }
+}
+
+//! Function to compute the total Delta V of a population of trajectories.
+Eigen::VectorXd TrajectoryPopulationEvaluator::computeTotalDeltaV( const Eigen::MatrixXd& trajectoryVariableVectors )
+{
+    const int numberOfTrajectories = trajectoryVariableVectors.cols( );
+    if ( trajectoryVariableVectors.rows( ) != trajectoryVariableVectorSize_ )
+    {
+        throw std::runtime_error( "Error when evaluating trajectory population, size of trajectory variable vector is " +
+                                  std::to_string( trajectoryVariableVectors.rows( ) ) + ", but " +
+                                  std::to_string( trajectoryVariableVectorSize_ ) + " is required" );
+    }
+
+    std::lock_guard< std::mutex > lock( evaluationMutex_ );
+
+    // Retrieve planet states at all visitation times in the calling thread.
+    std::vector< std::vector< Eigen::Vector6d > > planetStates(
+                numberOfTrajectories, std::vector< Eigen::Vector6d >( numberOfLegs_ ) );
+    for ( int i = 0; i < numberOfTrajectories; i++ )
+    {
+        double time = 0.0;
+        for ( int counter = 0; counter < numberOfLegs_; counter++ )
+        {
+            time = time + trajectoryVariableVectors( counter, i );
+            planetStates[ i ][ counter ] = getPlanetState( counter, time );
+        }
+    }
+
+    // Compute trajectories, using a separate trajectory object for each thread.
+    Eigen::VectorXd totalDeltaV( numberOfTrajectories );
+    utilities::executeParallelForLoop(
+                numberOfTrajectories, [ & ]( const unsigned int trajectoryIndex, const unsigned int threadIndex )
+    {
+        std::shared_ptr< Trajectory > trajectory = trajectories_.at( threadIndex );
+        trajectory->updateVariableVector( trajectoryVariableVectors.col( trajectoryIndex ) );
+        trajectory->updateEphemeris( planetStates[ trajectoryIndex ] );
+        trajectory->calculateTrajectory( totalDeltaV( trajectoryIndex ) );
+    }, trajectories_.size( ) );
+
+    return totalDeltaV;
+}
+
+//! Function to compute the total Delta V of a population of trajectories.
+std::vector< double > TrajectoryPopulationEvaluator::computeTotalDeltaV(
+        const std::vector< Eigen::VectorXd >& trajectoryVariableVectors )
+{
+    Eigen::MatrixXd trajectoryVariableMatrix( trajectoryVariableVectorSize_, trajectoryVariableVectors.size( ) );
+    for ( unsigned int i = 0; i < trajectoryVariableVectors.size( ); i++ )
+    {
+        if ( trajectoryVariableVectors.at( i ).rows( ) != trajectoryVariableVectorSize_ )
+        {
+            throw std::runtime_error( "Error when evaluating trajectory population, size of trajectory variable vector " +
+                                      std::to_string( i ) + " is " +
+                                      std::to_string( trajectoryVariableVectors.at( i ).rows( ) ) + ", but " +
+                                      std::to_string( trajectoryVariableVectorSize_ ) + " is required" );
+        }
+        trajectoryVariableMatrix.col( i ) = trajectoryVariableVectors.at( i );
+    }
+
+    Eigen::VectorXd totalDeltaV = computeTotalDeltaV( trajectoryVariableMatrix );
+    return std::vector< double >( totalDeltaV.data( ), totalDeltaV.data( ) + totalDeltaV.rows( ) );
+}
+
+//! Function to clear the cached planet states.
+void TrajectoryPopulationEvaluator::clearEphemerisCache( )
+{
+    std::lock_guard< std::mutex > lock( evaluationMutex_ );
+    for ( unsigned int i = 0; i < ephemerisCache_.size( ); i++ )
+    {
+        ephemerisCache_.at( i ).clear( );
+    }
+}
+
+//! Function to retrieve the state of a planet at a given epoch, using the cache if possible.
+Eigen::Vector6d TrajectoryPopulationEvaluator::getPlanetState( const int planetIndex, const double epoch )
+{
+    if ( maximumEphemerisCacheSize_ == 0 )
+    {
+        return ephemerisVector_[ planetIndex ]->getCartesianState( epoch );
+    }
+
+    std::map< double, Eigen::Vector6d >& planetCache = ephemerisCache_[ planetIndex ];
+    std::map< double, Eigen::Vector6d >::const_iterator cacheIterator = planetCache.find( epoch );
+    if ( cacheIterator != planetCache.end( ) )
+    {
+        return cacheIterator->second;
+    }
+
+    if ( planetCache.size( ) >= maximumEphemerisCacheSize_ )
+    {
+        planetCache.clear( );
+    }
+
+    Eigen::Vector6d planetState = ephemerisVector_[ planetIndex ]->getCartesianState( epoch );
+    planetCache[ epoch ] = planetState;
+    return planetState;
+}
+
+} // namespace transfer_trajectories
+
+} // namespace tudat
@@ -0,0 +1,151 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_TRAJECTORY_POPULATION_EVALUATOR_H
+#define TUDAT_TRAJECTORY_POPULATION_EVALUATOR_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Astrodynamics/TrajectoryDesign/trajectory.h"
+
+namespace tudat
+{
+
+namespace transfer_trajectories
+{
+
+//! Class for the (parallel) evaluation of the total Delta V of a population of trajectories
+/*!
+ * Class for the (parallel) evaluation of the total Delta V of a population of trajectories with
+ * identical leg sequence, but different trajectory variable vectors, as typically required by
+ * (population-based) global optimizers. Since the Trajectory class stores the state of the
+ * current trajectory, a separate Trajectory object is created for each thread. The planet states
+ * are retrieved from the ephemerides in the calling thread (ephemerides need not be thread-safe),
+ * and are cached per planet and epoch, so that they are not recomputed for trajectories in the
+ * population that visit a planet at the same epoch (e.g. when scanning grids of departure epochs and
+ * times of flight). The legs of the trajectories are then computed in parallel. The results are
+ * identical to those obtained by updating and calculating a single Trajectory object for each
+ * trajectory variable vector. Since the cache and the Trajectory objects are modified during an
+ * evaluation, concurrent calls to the same object are serialized (populations evaluated from
+ * different threads should use separate objects to be evaluated concurrently).
+ */
+class TrajectoryPopulationEvaluator
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, arguments are identical to those of the Trajectory class (except for the
+     *  trajectory variable vector).
+     *  \param numberOfLegs the number of legs in the trajectory.
+     *  \param legTypeVector vector containing the leg types.
+     *  \param ephemerisVector vector of ephemeris pointers to the different planets.
+     *  \param gravitationalParameterVector vector of the gravitational parameters of the visited planets.
+     *  \param centralBodyGravitationalParameter gravitational parameter of the central body.
+     *  \param minimumPericenterRadiiVector vector containing the minimum distance between the spacecraft and body.
+     *  \param semiMajorAxesVector vector containing the semi-major axes for the departure and capture leg.
+     *  \param eccentricityVector vector containing the eccentricities for the departure and capture leg.
+     *  \param includeDepartureDeltaV Boolean denoting whether to include the Delta V of departure.
+     *  \param includeArrivalDeltaV Boolean denoting whether to include the Delta V of arrival.
+     *  \param numberOfThreads Number of threads over which the trajectories are distributed.
+     *  \param maximumEphemerisCacheSize Maximum number of cached planet states per planet (cache of a
+     *  planet is cleared when exceeded). If equal to 0, no caching is used.
+     */
+    TrajectoryPopulationEvaluator( const int numberOfLegs,
+                                   const std::vector< TransferLegType >& legTypeVector,
+                                   const std::vector< ephemerides::EphemerisPointer >& ephemerisVector,
+                                   const Eigen::VectorXd& gravitationalParameterVector,
+                                   const double centralBodyGravitationalParameter,
+                                   const Eigen::VectorXd& minimumPericenterRadiiVector,
+                                   const Eigen::VectorXd& semiMajorAxesVector,
+                                   const Eigen::VectorXd& eccentricityVector,
+                                   const bool includeDepartureDeltaV = true,
+                                   const bool includeArrivalDeltaV = true,
+                                   const unsigned int numberOfThreads = 1,
+                                   const unsigned int maximumEphemerisCacheSize = 1000000 );
+
+    //! Function to compute the total Delta V of a population of trajectories.
+    /*!
+     * Function to compute the total Delta V of a population of trajectories.
+     * \param trajectoryVariableVectors Trajectory variable vectors (one column per trajectory), with
+     * the same definition as for the Trajectory class.
+     * \return Total Delta V of each of the trajectories.
+     */
+    Eigen::VectorXd computeTotalDeltaV( const Eigen::MatrixXd& trajectoryVariableVectors );
+
+    //! Function to compute the total Delta V of a population of trajectories.
+    /*!
+     * Function to compute the total Delta V of a population of trajectories.
+     * \param trajectoryVariableVectors Trajectory variable vectors, with the same definition as for
+     * the Trajectory class.
+     * \return Total Delta V of each of the trajectories.
+     */
+    std::vector< double > computeTotalDeltaV( const std::vector< Eigen::VectorXd >& trajectoryVariableVectors );
+
+    //! Function to clear the cached planet states.
+    void clearEphemerisCache( );
+
+    //! Function to retrieve the number of threads over which the trajectories are distributed.
+    /*!
+     * Function to retrieve the number of threads over which the trajectories are distributed.
+     * \return Number of threads over which the trajectories are distributed.
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return trajectories_.size( );
+    }
+
+private:
+
+    //! Function to retrieve the state of a planet at a given epoch, using the cache if possible.
+    /*!
+     * Function to retrieve the state of a planet at a given epoch, using the cache if possible.
+     * \param planetIndex Index of the planet in the ephemeris vector.
+     * \param epoch Epoch at which the state is to be retrieved.
+     * \return State of planet at given epoch.
+     */
+    Eigen::Vector6d getPlanetState( const int planetIndex, const double epoch );
+
+    //! The number of legs in the trajectory.
+    int numberOfLegs_;
+
+    //! The vector containing the Ephemeris objects.
+    std::vector< ephemerides::EphemerisPointer > ephemerisVector_;
+
+    //! Trajectory objects, one for each thread.
+    std::vector< std::shared_ptr< Trajectory > > trajectories_;
+
+    //! Size of the trajectory variable vector.
+    int trajectoryVariableVectorSize_;
+
+    //! Maximum number of cached planet states per planet (no caching if 0).
+    unsigned int maximumEphemerisCacheSize_;
+
+    //! Cached planet states, per planet (same order as ephemerisVector_), as a function of epoch.
+    std::vector< std::map< double, Eigen::Vector6d > > ephemerisCache_;
+
+    //! Mutex ensuring that the cache and trajectory objects are not modified by concurrent evaluations.
+    std::mutex evaluationMutex_;
+};
+
+} // namespace transfer_trajectories
+
+} // namespace tudat
+
+#endif // TUDAT_TRAJECTORY_POPULATION_EVALUATOR_H
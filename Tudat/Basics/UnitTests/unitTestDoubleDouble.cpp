@@ -0,0 +1,141 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/doubleDouble.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_double_double )
+
+using namespace mathematical_constants;
+
+//! Test basic arithmetic operations of DoubleDouble object
+BOOST_AUTO_TEST_CASE( testDoubleDoubleArithmeticOperations )
+{
+    const long double value1 = 7.0E6L + LONG_PI;
+    const long double value2 = -2.718281828459045235360287L;
+    const DoubleDouble inputValue1( value1 );
+    const DoubleDouble inputValue2( value2 );
+
+    const long double tolerance = 4.0L * std::numeric_limits< long double >::epsilon( );
+
+    // Test conversions
+    BOOST_CHECK_EQUAL( static_cast< long double >( inputValue1 ), value1 );
+    BOOST_CHECK_EQUAL( static_cast< double >( inputValue1 ), static_cast< double >( value1 ) );
+    BOOST_CHECK( std::fabs( inputValue1.getLowComponent( ) ) <=
+                 0.5 * std::numeric_limits< double >::epsilon( ) * std::fabs( inputValue1.getHighComponent( ) ) );
+
+    // Test arithmetic operations between DoubleDouble objects, and with doubles
+    BOOST_CHECK_CLOSE_FRACTION( static_cast< long double >( inputValue1 + inputValue2 ), value1 + value2, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( static_cast< long double >( inputValue1 - inputValue2 ), value1 - value2, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( static_cast< long double >( inputValue1 * inputValue2 ), value1 * value2, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( static_cast< long double >( inputValue1 / inputValue2 ), value1 / value2, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( static_cast< long double >( inputValue1 + 3.0 ), value1 + 3.0L, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( static_cast< long double >( 3.0 - inputValue1 ), 3.0L - value1, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( static_cast< long double >( inputValue1 * 3.0 ), value1 * 3.0L, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( static_cast< long double >( 3.0 / inputValue1 ), 3.0L / value1, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( static_cast< long double >( sqrt( inputValue1 ) ), std::sqrt( value1 ), tolerance );
+    BOOST_CHECK_EQUAL( static_cast< long double >( abs( inputValue2 ) ), -value2 );
+
+    // Division and subsequent multiplication should be (nearly) exact in double-double precision
+    BOOST_CHECK_SMALL( static_cast< double >( ( inputValue1 / 3.0 ) * 3.0 - inputValue1 ), 1.0E-22 );
+    BOOST_CHECK_SMALL( static_cast< double >( sqrt( inputValue1 ) * sqrt( inputValue1 ) - inputValue1 ), 1.0E-22 );
+
+    // Check that accumulation of a large number of small increments retains (close to) full precision, where double
+    // and long double do not.
+    const double increment = 1.0 / 3.0;
+    const int numberOfIncrements = 1000000;
+    DoubleDouble accumulatedValue( 7.0E6 );
+    long double accumulatedLongDoubleValue = 7.0E6L;
+    for( int i = 0; i < numberOfIncrements; i++ )
+    {
+        accumulatedValue += increment;
+        accumulatedLongDoubleValue += increment;
+    }
+    const DoubleDouble expectedValue = DoubleDouble( 7.0E6 ) +
+            DoubleDouble( increment ) * static_cast< double >( numberOfIncrements );
+    BOOST_CHECK_SMALL( static_cast< double >( accumulatedValue - expectedValue ), 1.0E-20 );
+    BOOST_CHECK( std::fabs( static_cast< double >( DoubleDouble( accumulatedLongDoubleValue ) - expectedValue ) ) >
+                 1.0E-15 );
+
+    // Test comparison operators
+    const DoubleDouble slightlyLargerValue = inputValue1 + 1.0E-20;
+    BOOST_CHECK( slightlyLargerValue > inputValue1 );
+    BOOST_CHECK( inputValue1 < slightlyLargerValue );
+    BOOST_CHECK( inputValue1 <= slightlyLargerValue );
+    BOOST_CHECK( slightlyLargerValue != inputValue1 );
+    BOOST_CHECK( inputValue1 == inputValue1 );
+    BOOST_CHECK( slightlyLargerValue > static_cast< double >( inputValue1 ) );
+    BOOST_CHECK( DoubleDouble( 2.0 ) == 2.0 );
+}
+
+//! Test use of DoubleDouble as scalar type of Eigen matrices, and mixed operations with double matrices
+BOOST_AUTO_TEST_CASE( testDoubleDoubleEigenOperations )
+{
+    const Eigen::Vector3d doubleVector = ( Eigen::Vector3d( ) << 7.0E6, -1.0E3, 3.0 ).finished( );
+    const Eigen::Vector3d doubleIncrement = ( Eigen::Vector3d( ) << 1.0 / 3.0, -1.0 / 7.0, 1.0E-20 ).finished( );
+
+    // Add double vector to double-double vector, and check that no precision is lost.
+    Eigen::Matrix< DoubleDouble, 3, 1 > doubleDoubleVector = doubleVector.cast< DoubleDouble >( );
+    doubleDoubleVector += 10.0 * doubleIncrement;
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK( doubleDoubleVector( i ) - doubleVector( i ) == 10.0 * doubleIncrement( i ) );
+    }
+    BOOST_CHECK( doubleDoubleVector( 2 ) > 3.0 );
+
+    // Test reductions
+    BOOST_CHECK_CLOSE_FRACTION( static_cast< double >( doubleDoubleVector.norm( ) ),
+                                ( doubleVector + 10.0 * doubleIncrement ).norm( ),
+                                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_EQUAL( static_cast< double >( doubleDoubleVector.array( ).abs( ).maxCoeff( ) ),
+                       static_cast< double >( doubleDoubleVector( 0 ) ) );
+
+    // Test conversion back to double
+    const Eigen::Vector3d convertedVector = doubleDoubleVector.cast< double >( );
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_EQUAL( convertedVector( i ), doubleDoubleVector( i ).getHighComponent( ) );
+    }
+}
+
+//! Test that the DoubleDouble mathematical functions do not hide those for doubles in the tudat namespace
+BOOST_AUTO_TEST_CASE( testDoubleDoubleFunctionLookup )
+{
+    // Unqualified calls with double arguments should resolve to the (std) double functions
+    const double doubleValue = -2.0;
+    BOOST_CHECK( ( std::is_same< decltype( sqrt( doubleValue ) ), double >::value ) );
+    BOOST_CHECK( ( std::is_same< decltype( fabs( doubleValue ) ), double >::value ) );
+    BOOST_CHECK_EQUAL( sqrt( -doubleValue ), std::sqrt( 2.0 ) );
+    BOOST_CHECK_EQUAL( fabs( doubleValue ), 2.0 );
+
+    // Unqualified calls with DoubleDouble arguments should resolve to the DoubleDouble functions
+    const DoubleDouble doubleDoubleValue( doubleValue );
+    BOOST_CHECK( ( std::is_same< decltype( sqrt( doubleDoubleValue ) ), DoubleDouble >::value ) );
+    BOOST_CHECK( ( std::is_same< decltype( fabs( doubleDoubleValue ) ), DoubleDouble >::value ) );
+    BOOST_CHECK( fabs( doubleDoubleValue ) == 2.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
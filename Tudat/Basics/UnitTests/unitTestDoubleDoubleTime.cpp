@@ -0,0 +1,148 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Basics/doubleDoubleTime.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_double_double_time )
+
+using namespace mathematical_constants;
+
+//! Test if DoubleDoubleTime objects are created and cast at the expected precision, and are consistent with Time.
+BOOST_AUTO_TEST_CASE( testDoubleDoubleTimeConstructionAndCasts )
+{
+    DoubleDoubleTime testTime( 2, LONG_PI );
+
+    BOOST_CHECK_CLOSE_FRACTION( testTime.getSeconds< long double >( ), 2.0L * TIME_NORMALIZATION_TERM + LONG_PI,
+                                std::numeric_limits< long double >::epsilon( ) );
+    BOOST_CHECK_EQUAL( testTime.getSeconds< double >( ),
+                       static_cast< double >( 2.0L * TIME_NORMALIZATION_TERM + LONG_PI ) );
+    BOOST_CHECK_EQUAL( static_cast< double >( testTime ),
+                       static_cast< double >( 2.0L * TIME_NORMALIZATION_TERM + LONG_PI ) );
+    BOOST_CHECK_CLOSE_FRACTION( static_cast< long double >( testTime ), 2.0L * TIME_NORMALIZATION_TERM + LONG_PI,
+                                std::numeric_limits< long double >::epsilon( ) );
+
+    // Test hour/seconds representation, also for negative times.
+    BOOST_CHECK_EQUAL( testTime.getFullPeriods( ), 2 );
+    BOOST_CHECK_CLOSE_FRACTION( testTime.getSecondsIntoFullPeriod( ), LONG_PI,
+                                std::numeric_limits< long double >::epsilon( ) );
+
+    DoubleDoubleTime negativeTime( 759, -2.0L * TIME_NORMALIZATION_TERM - LONG_PI );
+    BOOST_CHECK_EQUAL( negativeTime.getFullPeriods( ), 756 );
+    BOOST_CHECK_CLOSE_FRACTION( negativeTime.getSecondsIntoFullPeriod( ), TIME_NORMALIZATION_TERM - LONG_PI,
+                                TIME_NORMALIZATION_TERM * std::numeric_limits< long double >::epsilon( ) );
+
+    // Test conversion from and to Time
+    Time timeObject( 1000000, LONG_PI );
+    DoubleDoubleTime convertedTime( timeObject );
+    BOOST_CHECK_EQUAL( convertedTime.getFullPeriods( ), timeObject.getFullPeriods( ) );
+    BOOST_CHECK_CLOSE_FRACTION( convertedTime.getSecondsIntoFullPeriod( ), LONG_PI,
+                                std::numeric_limits< long double >::epsilon( ) );
+    BOOST_CHECK_EQUAL( convertedTime.getTime( ).getFullPeriods( ), timeObject.getFullPeriods( ) );
+    BOOST_CHECK_CLOSE_FRACTION( convertedTime.getTime( ).getSecondsIntoFullPeriod( ), LONG_PI,
+                                std::numeric_limits< long double >::epsilon( ) );
+
+    // Check that representation is normalized
+    BOOST_CHECK( std::fabs( convertedTime.getLowComponent( ) ) <=
+                 0.5 * std::numeric_limits< double >::epsilon( ) * std::fabs( convertedTime.getHighComponent( ) ) );
+}
+
+//! Test basic arithmetic operations of DoubleDoubleTime object
+BOOST_AUTO_TEST_CASE( testDoubleDoubleTimeArithmeticOperations )
+{
+    const long double numberOfSeconds1 = 759.0L * TIME_NORMALIZATION_TERM + 2566.8309405984728595902L;
+    const long double numberOfSeconds2 = 2.0L * TIME_NORMALIZATION_TERM + 1432.48492385475949349L;
+    const DoubleDoubleTime inputTime1( numberOfSeconds1 );
+    const DoubleDoubleTime inputTime2( numberOfSeconds2 );
+
+    const long double tolerance = 4.0L * std::numeric_limits< long double >::epsilon( );
+
+    // Test additions and subtractions
+    BOOST_CHECK_CLOSE_FRACTION( ( inputTime1 + inputTime2 ).getSeconds< long double >( ),
+                                numberOfSeconds1 + numberOfSeconds2, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( ( inputTime1 + static_cast< double >( numberOfSeconds2 ) ).getSeconds< long double >( ),
+                                numberOfSeconds1 + static_cast< double >( numberOfSeconds2 ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( ( numberOfSeconds2 + inputTime1 ).getSeconds< long double >( ),
+                                numberOfSeconds1 + numberOfSeconds2, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( ( inputTime2 - inputTime1 ).getSeconds< long double >( ),
+                                numberOfSeconds2 - numberOfSeconds1, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( ( numberOfSeconds2 - inputTime1 ).getSeconds< long double >( ),
+                                numberOfSeconds2 - numberOfSeconds1, tolerance );
+
+    DoubleDoubleTime outputTime = inputTime1;
+    outputTime += inputTime2;
+    outputTime -= inputTime2;
+    BOOST_CHECK( outputTime == inputTime1 );
+
+    // Test multiplications and divisions
+    BOOST_CHECK_CLOSE_FRACTION( ( inputTime1 * 3.0 ).getSeconds< long double >( ), numberOfSeconds1 * 3.0L, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( ( 3.0L * inputTime1 ).getSeconds< long double >( ), numberOfSeconds1 * 3.0L, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( ( inputTime1 / 3.0 ).getSeconds< long double >( ), numberOfSeconds1 / 3.0L, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( ( inputTime1 / 3.0L ).getSeconds< long double >( ), numberOfSeconds1 / 3.0L, tolerance );
+
+    // Division and subsequent multiplication should be (nearly) exact in double-double precision
+    BOOST_CHECK_SMALL( std::fabs( ( ( inputTime1 / 3.0 ) * 3.0 - inputTime1 ).getSeconds< double >( ) ),
+                       1.0E-20 );
+
+    // Check that accumulation of a large number of small time steps retains sub-femtosecond resolution, where the Time
+    // object (with long double representation of seconds into hour) does not.
+    const double timeStep = 10.0 / 3.0;
+    const int numberOfSteps = 1000000;
+    DoubleDoubleTime accumulatedTime( 1.0E9 );
+    for( int i = 0; i < numberOfSteps; i++ )
+    {
+        accumulatedTime += timeStep;
+    }
+    const DoubleDoubleTime expectedTime =
+            DoubleDoubleTime( 1.0E9 ) + static_cast< double >( numberOfSteps ) * DoubleDoubleTime( timeStep );
+    BOOST_CHECK_SMALL( std::fabs( ( accumulatedTime - expectedTime ).getSeconds< double >( ) ), 1.0E-18 );
+}
+
+//! Test comparison operators of DoubleDoubleTime object
+BOOST_AUTO_TEST_CASE( testDoubleDoubleTimeComparisonOperators )
+{
+    const DoubleDoubleTime baseTime( 1.0E9 );
+    const DoubleDoubleTime slightlyLargerTime = baseTime + 1.0E-12;
+
+    // Times differ below double resolution: comparison with other DoubleDoubleTime should resolve difference...
+    BOOST_CHECK( slightlyLargerTime > baseTime );
+    BOOST_CHECK( slightlyLargerTime >= baseTime );
+    BOOST_CHECK( baseTime < slightlyLargerTime );
+    BOOST_CHECK( baseTime <= slightlyLargerTime );
+    BOOST_CHECK( baseTime != slightlyLargerTime );
+    BOOST_CHECK( !( baseTime == slightlyLargerTime ) );
+    BOOST_CHECK( baseTime <= baseTime );
+    BOOST_CHECK( baseTime >= baseTime );
+
+    // ...whereas comparison with double is performed at double precision (as for Time class)
+    BOOST_CHECK( slightlyLargerTime == 1.0E9 );
+    BOOST_CHECK( !( slightlyLargerTime > 1.0E9 ) );
+    BOOST_CHECK( slightlyLargerTime >= 1.0E9 );
+    BOOST_CHECK( 1.0E9 <= slightlyLargerTime );
+    BOOST_CHECK( 2.0E9 > slightlyLargerTime );
+    BOOST_CHECK( slightlyLargerTime < 2.0E9 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -52,6 +52,9 @@ BOOST_AUTO_TEST_CASE( testTypeTraits )
     isTimeType = is_time_type< Time >::value;
     BOOST_CHECK_EQUAL( isTimeType, true );
 
+    isTimeType = is_time_type< DoubleDoubleTime >::value;
+    BOOST_CHECK_EQUAL( isTimeType, true );
+
 
 
     bool isStateType;
@@ -0,0 +1,62 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_DATA_CONTENT_HASH_H
+#define TUDAT_DATA_CONTENT_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to compute the hash of the contents of a data buffer.
+/*!
+ *  Function to compute a 64-bit hash of the contents of a data buffer (FNV-1a, applied to 64-bit words), used to
+ *  identify the contents of files and data arrays, e.g. for cache files. The hash is not cryptographic.
+ *  \param data Pointer to first character of buffer.
+ *  \param dataSize Number of characters in buffer.
+ *  \return Hash of buffer contents.
+ */
+inline std::uint64_t computeDataContentHash( const char* data, const std::size_t dataSize )
+{
+    static const std::uint64_t fnvOffsetBasis = 14695981039346656037ULL;
+    static const std::uint64_t fnvPrime = 1099511628211ULL;
+
+    std::uint64_t hash = fnvOffsetBasis;
+
+    // Process full 64-bit words, followed by remaining characters.
+    const std::size_t numberOfWords = dataSize / sizeof( std::uint64_t );
+    std::uint64_t currentWord;
+    for( std::size_t i = 0; i < numberOfWords; i++ )
+    {
+        std::memcpy( &currentWord, data + i * sizeof( std::uint64_t ), sizeof( std::uint64_t ) );
+        hash = ( hash ^ currentWord ) * fnvPrime;
+        hash ^= hash >> 29;
+    }
+    for( std::size_t i = numberOfWords * sizeof( std::uint64_t ); i < dataSize; i++ )
+    {
+        hash = ( hash ^ static_cast< unsigned char >( data[ i ] ) ) * fnvPrime;
+    }
+
+    // Include buffer size, so that buffers differing only in trailing zeros are distinguished.
+    hash = ( hash ^ static_cast< std::uint64_t >( dataSize ) ) * fnvPrime;
+    return hash ^ ( hash >> 32 );
+}
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_DATA_CONTENT_HASH_H
@@ -0,0 +1,509 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_DOUBLEDOUBLE_H
+#define TUDAT_DOUBLEDOUBLE_H
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+//! Class for a floating point number in double-double precision.
+/*!
+ *  Class for a floating point number in double-double precision, represented as the unevaluated sum of two doubles: the
+ *  value rounded to double precision, and the (small) remainder. This provides a relative precision of about 10^-32
+ *  (106 bits of mantissa), with all operations performed in double precision using error-free transformations, which is
+ *  typically faster than long double (x87) arithmetic, and more precise.
+ *
+ *  The class is intended to be used as scalar type for the state in numerical integration (StateScalarType), in
+ *  particular with the state derivative in double precision: mixed operations with doubles (as used when adding a
+ *  state derivative times the step size to the state) are supported directly, also on Eigen matrices. Conversion to
+ *  double (e.g. to evaluate the force models) must be done explicitly, to prevent silent loss of precision. The
+ *  mathematical functions (abs, sqrt, etc.) are defined as friends inside the class, so that they are only found by
+ *  argument-dependent lookup for DoubleDouble arguments, and do not hide the std functions for double arguments.
+ */
+class DoubleDouble
+{
+public:
+
+    //! Constructor, initialize value to 0
+    DoubleDouble( ):high_( 0.0 ), low_( 0.0 ){ }
+
+    //! Constructor from double
+    /*!
+     * Constructor from double, representation is exact.
+     * \param value Value of number
+     */
+    DoubleDouble( const double value ):high_( value ), low_( 0.0 ){ }
+
+    //! Constructor from long double
+    /*!
+     * Constructor from long double, representation is exact.
+     * \param value Value of number
+     */
+    DoubleDouble( const long double value ):
+        high_( static_cast< double >( value ) ),
+        low_( static_cast< double >( value - static_cast< long double >( high_ ) ) ){ }
+
+    //! Constructor from int
+    /*!
+     * Constructor from int, representation is exact.
+     * \param value Value of number
+     */
+    DoubleDouble( const int value ):high_( static_cast< double >( value ) ), low_( 0.0 ){ }
+
+    //! Addition operator for two DoubleDouble objects
+    friend DoubleDouble operator+( const DoubleDouble& summand1, const DoubleDouble& summand2 )
+    {
+        double sumHigh, sumHighError, sumLow, sumLowError;
+        computeTwoSum( summand1.high_, summand2.high_, sumHigh, sumHighError );
+        computeTwoSum( summand1.low_, summand2.low_, sumLow, sumLowError );
+        sumHighError += sumLow;
+        computeQuickTwoSum( sumHigh, sumHighError, sumHigh, sumHighError );
+        return createFromComponents( sumHigh, sumHighError + sumLowError );
+    }
+
+    //! Addition operator for DoubleDouble object and double
+    friend DoubleDouble operator+( const DoubleDouble& summand1, const double summand2 )
+    {
+        double sum, sumError;
+        computeTwoSum( summand1.high_, summand2, sum, sumError );
+        return createFromComponents( sum, sumError + summand1.low_ );
+    }
+
+    //! Addition operator for double and DoubleDouble object
+    friend DoubleDouble operator+( const double summand1, const DoubleDouble& summand2 )
+    {
+        return summand2 + summand1;
+    }
+
+    //! Unary minus operator
+    friend DoubleDouble operator-( const DoubleDouble& value )
+    {
+        DoubleDouble negatedValue;
+        negatedValue.high_ = -value.high_;
+        negatedValue.low_ = -value.low_;
+        return negatedValue;
+    }
+
+    //! Subtraction operator for two DoubleDouble objects
+    friend DoubleDouble operator-( const DoubleDouble& value1, const DoubleDouble& value2 )
+    {
+        return value1 + ( -value2 );
+    }
+
+    //! Subtraction operator for DoubleDouble object and double
+    friend DoubleDouble operator-( const DoubleDouble& value1, const double value2 )
+    {
+        return value1 + ( -value2 );
+    }
+
+    //! Subtraction operator for double and DoubleDouble object
+    friend DoubleDouble operator-( const double value1, const DoubleDouble& value2 )
+    {
+        return ( -value2 ) + value1;
+    }
+
+    //! Multiplication operator for two DoubleDouble objects
+    friend DoubleDouble operator*( const DoubleDouble& factor1, const DoubleDouble& factor2 )
+    {
+        const double product = factor1.high_ * factor2.high_;
+        const double productError = std::fma( factor1.high_, factor2.high_, -product ) +
+                ( factor1.high_ * factor2.low_ + factor1.low_ * factor2.high_ );
+        return createFromComponents( product, productError );
+    }
+
+    //! Multiplication operator for DoubleDouble object and double
+    friend DoubleDouble operator*( const DoubleDouble& factor1, const double factor2 )
+    {
+        const double product = factor1.high_ * factor2;
+        const double productError = std::fma( factor1.high_, factor2, -product ) + factor1.low_ * factor2;
+        return createFromComponents( product, productError );
+    }
+
+    //! Multiplication operator for double and DoubleDouble object
+    friend DoubleDouble operator*( const double factor1, const DoubleDouble& factor2 )
+    {
+        return factor2 * factor1;
+    }
+
+    //! Division operator for two DoubleDouble objects
+    friend DoubleDouble operator/( const DoubleDouble& dividend, const DoubleDouble& divisor )
+    {
+        // Compute first estimate of quotient, and correct it using the exact remainder.
+        const double quotient = dividend.high_ / divisor.high_;
+        const DoubleDouble remainder = dividend - divisor * quotient;
+        return createFromComponents( quotient, remainder.high_ / divisor.high_ );
+    }
+
+    //! Division operator for DoubleDouble object and double
+    friend DoubleDouble operator/( const DoubleDouble& dividend, const double divisor )
+    {
+        const double quotient = dividend.high_ / divisor;
+        const DoubleDouble remainder = dividend - DoubleDouble( divisor ) * quotient;
+        return createFromComponents( quotient, remainder.high_ / divisor );
+    }
+
+    //! Division operator for double and DoubleDouble object
+    friend DoubleDouble operator/( const double dividend, const DoubleDouble& divisor )
+    {
+        return DoubleDouble( dividend ) / divisor;
+    }
+
+    //! Add and assign operator for adding a DoubleDouble
+    DoubleDouble& operator+=( const DoubleDouble& valueToAdd )
+    {
+        *this = *this + valueToAdd;
+        return *this;
+    }
+
+    //! Add and assign operator for adding a double
+    DoubleDouble& operator+=( const double valueToAdd )
+    {
+        *this = *this + valueToAdd;
+        return *this;
+    }
+
+    //! Subtract and assign operator for subtracting a DoubleDouble
+    DoubleDouble& operator-=( const DoubleDouble& valueToSubtract )
+    {
+        *this = *this - valueToSubtract;
+        return *this;
+    }
+
+    //! Subtract and assign operator for subtracting a double
+    DoubleDouble& operator-=( const double valueToSubtract )
+    {
+        *this = *this - valueToSubtract;
+        return *this;
+    }
+
+    //! Multiply and assign operator for multiplying by a DoubleDouble
+    DoubleDouble& operator*=( const DoubleDouble& factor )
+    {
+        *this = *this * factor;
+        return *this;
+    }
+
+    //! Multiply and assign operator for multiplying by a double
+    DoubleDouble& operator*=( const double factor )
+    {
+        *this = *this * factor;
+        return *this;
+    }
+
+    //! Divide and assign operator for dividing by a DoubleDouble
+    DoubleDouble& operator/=( const DoubleDouble& divisor )
+    {
+        *this = *this / divisor;
+        return *this;
+    }
+
+    //! Divide and assign operator for dividing by a double
+    DoubleDouble& operator/=( const double divisor )
+    {
+        *this = *this / divisor;
+        return *this;
+    }
+
+    //! Equality operator for two DoubleDouble objects
+    friend bool operator==( const DoubleDouble& value1, const DoubleDouble& value2 )
+    {
+        return ( value1.high_ == value2.high_ ) && ( value1.low_ == value2.low_ );
+    }
+
+    //! Inequality operator for two DoubleDouble objects
+    friend bool operator!=( const DoubleDouble& value1, const DoubleDouble& value2 )
+    {
+        return !( value1 == value2 );
+    }
+
+    //! Smaller than operator for two DoubleDouble objects
+    friend bool operator<( const DoubleDouble& value1, const DoubleDouble& value2 )
+    {
+        return ( value1.high_ < value2.high_ ) || ( ( value1.high_ == value2.high_ ) && ( value1.low_ < value2.low_ ) );
+    }
+
+    //! Larger than operator for two DoubleDouble objects
+    friend bool operator>( const DoubleDouble& value1, const DoubleDouble& value2 )
+    {
+        return value2 < value1;
+    }
+
+    //! Smaller than or equal operator for two DoubleDouble objects
+    friend bool operator<=( const DoubleDouble& value1, const DoubleDouble& value2 )
+    {
+        return !( value2 < value1 );
+    }
+
+    //! Larger than or equal operator for two DoubleDouble objects
+    friend bool operator>=( const DoubleDouble& value1, const DoubleDouble& value2 )
+    {
+        return !( value1 < value2 );
+    }
+
+    //! Equality operator for DoubleDouble object and double (comparison is exact)
+    friend bool operator==( const DoubleDouble& value1, const double value2 )
+    {
+        return value1 == DoubleDouble( value2 );
+    }
+
+    //! Equality operator for double and DoubleDouble object (comparison is exact)
+    friend bool operator==( const double value1, const DoubleDouble& value2 )
+    {
+        return DoubleDouble( value1 ) == value2;
+    }
+
+    //! Inequality operator for DoubleDouble object and double (comparison is exact)
+    friend bool operator!=( const DoubleDouble& value1, const double value2 )
+    {
+        return value1 != DoubleDouble( value2 );
+    }
+
+    //! Inequality operator for double and DoubleDouble object (comparison is exact)
+    friend bool operator!=( const double value1, const DoubleDouble& value2 )
+    {
+        return DoubleDouble( value1 ) != value2;
+    }
+
+    //! Smaller than operator for DoubleDouble object and double (comparison is exact)
+    friend bool operator<( const DoubleDouble& value1, const double value2 )
+    {
+        return value1 < DoubleDouble( value2 );
+    }
+
+    //! Smaller than operator for double and DoubleDouble object (comparison is exact)
+    friend bool operator<( const double value1, const DoubleDouble& value2 )
+    {
+        return DoubleDouble( value1 ) < value2;
+    }
+
+    //! Larger than operator for DoubleDouble object and double (comparison is exact)
+    friend bool operator>( const DoubleDouble& value1, const double value2 )
+    {
+        return value1 > DoubleDouble( value2 );
+    }
+
+    //! Larger than operator for double and DoubleDouble object (comparison is exact)
+    friend bool operator>( const double value1, const DoubleDouble& value2 )
+    {
+        return DoubleDouble( value1 ) > value2;
+    }
+
+    //! Smaller than or equal operator for DoubleDouble object and double (comparison is exact)
+    friend bool operator<=( const DoubleDouble& value1, const double value2 )
+    {
+        return value1 <= DoubleDouble( value2 );
+    }
+
+    //! Smaller than or equal operator for double and DoubleDouble object (comparison is exact)
+    friend bool operator<=( const double value1, const DoubleDouble& value2 )
+    {
+        return DoubleDouble( value1 ) <= value2;
+    }
+
+    //! Larger than or equal operator for DoubleDouble object and double (comparison is exact)
+    friend bool operator>=( const DoubleDouble& value1, const double value2 )
+    {
+        return value1 >= DoubleDouble( value2 );
+    }
+
+    //! Larger than or equal operator for double and DoubleDouble object (comparison is exact)
+    friend bool operator>=( const double value1, const DoubleDouble& value2 )
+    {
+        return DoubleDouble( value1 ) >= value2;
+    }
+
+    //! Function to output the number to a stream (at the precision of the leading component)
+    friend std::ostream& operator<<( std::ostream& stream, const DoubleDouble& value )
+    {
+        stream << value.high_;
+        return stream;
+    }
+
+    //! Function to compute the absolute value of a DoubleDouble
+    friend DoubleDouble abs( const DoubleDouble& value )
+    {
+        return ( value.high_ < 0.0 ) ? -value : value;
+    }
+
+    //! Function to compute the absolute value of a DoubleDouble
+    friend DoubleDouble fabs( const DoubleDouble& value )
+    {
+        return abs( value );
+    }
+
+    //! Function to compute the square root of a DoubleDouble (using a single Newton iteration on the double result)
+    friend DoubleDouble sqrt( const DoubleDouble& value )
+    {
+        if( !( value.high_ > 0.0 ) )
+        {
+            return DoubleDouble( std::sqrt( value.high_ ) );
+        }
+        const double rootEstimate = std::sqrt( value.high_ );
+        const DoubleDouble residual = value - DoubleDouble( rootEstimate ) * rootEstimate;
+        return createFromComponents( rootEstimate, residual.high_ / ( 2.0 * rootEstimate ) );
+    }
+
+    //! Function to check whether a DoubleDouble is finite
+    friend bool isfinite( const DoubleDouble& value )
+    {
+        return std::isfinite( value.high_ );
+    }
+
+    //! Function to check whether a DoubleDouble is not-a-number
+    friend bool isnan( const DoubleDouble& value )
+    {
+        return std::isnan( value.high_ );
+    }
+
+    //! Function to check whether a DoubleDouble is infinite
+    friend bool isinf( const DoubleDouble& value )
+    {
+        return std::isinf( value.high_ );
+    }
+
+    //! Explicit conversion to double (rounds to nearest double)
+    explicit operator double( ) const
+    {
+        return high_;
+    }
+
+    //! Explicit conversion to long double
+    explicit operator long double( ) const
+    {
+        return static_cast< long double >( high_ ) + static_cast< long double >( low_ );
+    }
+
+    //! Explicit conversion to int (truncated)
+    explicit operator int( ) const
+    {
+        return static_cast< int >( static_cast< long double >( *this ) );
+    }
+
+    //! Function to get the leading component of the representation (i.e. value rounded to double).
+    double getHighComponent( ) const
+    {
+        return high_;
+    }
+
+    //! Function to get the trailing (correction) component of the representation
+    double getLowComponent( ) const
+    {
+        return low_;
+    }
+
+    //! Function to create number from (possibly unnormalized) leading and trailing components.
+    /*!
+     * Function to create number from (possibly unnormalized) leading and trailing components. The absolute value of the
+     * leading component must be larger than that of the trailing component (or zero).
+     * \param high Leading component
+     * \param low Trailing component
+     * \return Normalized number.
+     */
+    static DoubleDouble createFromComponents( const double high, const double low )
+    {
+        DoubleDouble newValue;
+        computeQuickTwoSum( high, low, newValue.high_, newValue.low_ );
+        return newValue;
+    }
+
+protected:
+
+    //! Function to compute the sum of two doubles, and its rounding error, without error (Knuth's TwoSum algorithm).
+    static void computeTwoSum( const double summand1, const double summand2, double& sum, double& sumError )
+    {
+        sum = summand1 + summand2;
+        const double virtualSummand2 = sum - summand1;
+        sumError = ( summand1 - ( sum - virtualSummand2 ) ) + ( summand2 - virtualSummand2 );
+    }
+
+    //! Function to compute the sum of two doubles, and its rounding error, without error (Dekker's FastTwoSum
+    //! algorithm, requires that the absolute value of the first summand is the largest, or that it is zero).
+    static void computeQuickTwoSum( const double summand1, const double summand2, double& sum, double& sumError )
+    {
+        sum = summand1 + summand2;
+        sumError = summand2 - ( sum - summand1 );
+    }
+
+    //! Leading component of the number (i.e. value rounded to double).
+    double high_;
+
+    //! Trailing component of the number (i.e. remainder w.r.t. high_).
+    double low_;
+
+};
+
+} // namespace tudat
+
+namespace Eigen
+{
+
+//! Numerical traits of DoubleDouble, required to use it as Eigen scalar type.
+template< >
+struct NumTraits< tudat::DoubleDouble > : GenericNumTraits< tudat::DoubleDouble >
+{
+    typedef tudat::DoubleDouble Real;
+    typedef tudat::DoubleDouble NonInteger;
+    typedef tudat::DoubleDouble Nested;
+    typedef tudat::DoubleDouble Literal;
+
+    enum
+    {
+        IsComplex = 0,
+        IsInteger = 0,
+        IsSigned = 1,
+        RequireInitialization = 1,
+        ReadCost = 2,
+        AddCost = 20,
+        MulCost = 10
+    };
+
+    static inline Real epsilon( ) { return Real( std::ldexp( 1.0, -104 ) ); }
+    static inline Real dummy_precision( ) { return Real( 1.0E-28 ); }
+    static inline Real highest( ) { return Real( std::numeric_limits< double >::max( ) ); }
+    static inline Real lowest( ) { return Real( std::numeric_limits< double >::lowest( ) ); }
+    static inline Real infinity( ) { return Real( std::numeric_limits< double >::infinity( ) ); }
+    static inline Real quiet_NaN( ) { return Real( std::numeric_limits< double >::quiet_NaN( ) ); }
+    static inline int digits10( ) { return 31; }
+    static inline int digits( ) { return 106; }
+};
+
+//! Definition of result of (coefficient-wise) operation between DoubleDouble and double, which is DoubleDouble.
+template< typename BinaryOp >
+struct ScalarBinaryOpTraits< tudat::DoubleDouble, double, BinaryOp >
+{
+    typedef tudat::DoubleDouble ReturnType;
+};
+
+//! Definition of result of (coefficient-wise) operation between double and DoubleDouble, which is DoubleDouble.
+template< typename BinaryOp >
+struct ScalarBinaryOpTraits< double, tudat::DoubleDouble, BinaryOp >
+{
+    typedef tudat::DoubleDouble ReturnType;
+};
+
+//! Typedef for VectorXdd (vector of double-double precision entries).
+typedef Eigen::Matrix< tudat::DoubleDouble, Eigen::Dynamic, 1 > VectorXdd;
+
+//! Typedef for Vector6dd (vector of double-double precision entries).
+typedef Eigen::Matrix< tudat::DoubleDouble, 6, 1 > Vector6dd;
+
+//! Typedef for MatrixXdd (matrix of double-double precision entries).
+typedef Eigen::Matrix< tudat::DoubleDouble, Eigen::Dynamic, Eigen::Dynamic > MatrixXdd;
+
+} // namespace Eigen
+
+#endif // TUDAT_DOUBLEDOUBLE_H
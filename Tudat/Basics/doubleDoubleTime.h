@@ -0,0 +1,648 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_DOUBLEDOUBLETIME_H
+#define TUDAT_DOUBLEDOUBLETIME_H
+
+#include <cmath>
+#include <iostream>
+
+#include "Tudat/Basics/doubleDouble.h"
+#include "Tudat/Basics/timeType.h"
+
+namespace tudat
+{
+
+//! Class for defining time with a resolution that is sub-fs for very long periods of time, using double-double arithmetic.
+/*!
+ *  Class for defining time with a resolution that is sub-fs for very long periods of time, using double-double arithmetic.
+ *  The number of seconds since epoch is represented as the unevaluated sum of two doubles, the first of which is the
+ *  number of seconds since epoch rounded to double precision, and the second the (small) remainder. This provides a
+ *  relative precision of about 10^-32 (i.e. a resolution < 10^-22 s over 10^10 s).
+ *
+ *  The class has the same interface as the Time class, and may be used as an alternative TimeType template argument.
+ *  Contrary to the Time class, which uses long double arithmetic, all operations are performed in double precision
+ *  (using error-free transformations), which is typically several times faster, as it does not require the x87 floating
+ *  point unit. Moreover, conversion to double (which is done for the evaluation of most environment models) is
+ *  essentially free. The arithmetic itself is delegated to the DoubleDouble class, which holds the number of seconds
+ *  since epoch.
+ */
+class DoubleDoubleTime
+{
+public:
+
+    //! Constructor, initialize time to 0
+    DoubleDoubleTime( ):secondsSinceEpoch_( 0.0 ){ }
+
+    //! Constructor, sets current hour and time into current hour directly
+    /*!
+     * Constructor, sets current hour and time into current hour directly (see Time class).
+     * \param fullPeriods Number of full hours since epoch
+     * \param secondsIntoFullPeriod Number of seconds into current hour (need not be in the range between 0 and 3600).
+     */
+    DoubleDoubleTime( const int fullPeriods, const long double secondsIntoFullPeriod ):
+        secondsSinceEpoch_( static_cast< double >( fullPeriods ) * static_cast< double >( TIME_NORMALIZATION_TERM ) )
+    {
+        *this += secondsIntoFullPeriod;
+    }
+
+    //! Constructor, sets number of seconds since epoch (with long double representation as input)
+    /*!
+     * Constructor, sets number of seconds since epoch (with long double representation as input)
+     * \param numberOfSeconds Number of seconds since epoch.
+     */
+    DoubleDoubleTime( const long double numberOfSeconds ):
+        secondsSinceEpoch_( numberOfSeconds ){ }
+
+    //! Constructor, sets number of seconds since epoch (with double representation as input)
+    /*!
+     * Constructor, sets number of seconds since epoch (with double representation as input)
+     * \param numberOfSeconds Number of seconds since epoch.
+     */
+    DoubleDoubleTime( const double numberOfSeconds ):
+        secondsSinceEpoch_( numberOfSeconds ){ }
+
+    //! Constructor, sets number of seconds since epoch (with int representation as input)
+    /*!
+     * Constructor, sets number of seconds since epoch (with int representation as input)
+     * \param numberOfSeconds Number of seconds since epoch.
+     */
+    DoubleDoubleTime( const int numberOfSeconds ):
+        secondsSinceEpoch_( numberOfSeconds ){ }
+
+    //! Constructor, sets number of seconds since epoch (with double-double representation as input)
+    /*!
+     * Constructor, sets number of seconds since epoch (with double-double representation as input)
+     * \param numberOfSeconds Number of seconds since epoch.
+     */
+    explicit DoubleDoubleTime( const DoubleDouble& numberOfSeconds ):
+        secondsSinceEpoch_( numberOfSeconds ){ }
+
+    //! Constructor, converts a Time object to its double-double representation.
+    /*!
+     * Constructor, converts a Time object to its double-double representation.
+     * \param timeToConvert Time object that is to be converted.
+     */
+    explicit DoubleDoubleTime( const Time& timeToConvert ):
+        DoubleDoubleTime( timeToConvert.getFullPeriods( ), timeToConvert.getSecondsIntoFullPeriod( ) ){ }
+
+    //! Addition operator for two DoubleDoubleTime objects
+    /*!
+     * Addition operator for two DoubleDoubleTime objects
+     * \param timeToAdd1 First time to add
+     * \param timeToAdd2 Second time to add
+     * \return Sum of times
+     */
+    friend DoubleDoubleTime operator+( const DoubleDoubleTime& timeToAdd1, const DoubleDoubleTime& timeToAdd2 )
+    {
+        return DoubleDoubleTime( timeToAdd1.secondsSinceEpoch_ + timeToAdd2.secondsSinceEpoch_ );
+    }
+
+    //! Addition operator for double variable with DoubleDoubleTime object.
+    /*!
+     * Addition operator for double variable with DoubleDoubleTime object.
+     * \param timeToAdd1 First time to add (as double)
+     * \param timeToAdd2 Second time to add
+     * \return Sum of times
+     */
+    friend DoubleDoubleTime operator+( const double& timeToAdd1, const DoubleDoubleTime& timeToAdd2 )
+    {
+        return DoubleDoubleTime( timeToAdd2.secondsSinceEpoch_ + timeToAdd1 );
+    }
+
+    //! Addition operator for long double variable with DoubleDoubleTime object.
+    /*!
+     * Addition operator for long double variable with DoubleDoubleTime object.
+     * \param timeToAdd1 First time to add (as long double)
+     * \param timeToAdd2 Second time to add
+     * \return Sum of times
+     */
+    friend DoubleDoubleTime operator+( const long double& timeToAdd1, const DoubleDoubleTime& timeToAdd2 )
+    {
+        return DoubleDoubleTime( timeToAdd1 ) + timeToAdd2;
+    }
+
+    //! Addition operator for DoubleDoubleTime object with double variable
+    /*!
+     * Addition operator for DoubleDoubleTime object with double variable
+     * \param timeToAdd2 First time to add
+     * \param timeToAdd1 Second time to add (as double)
+     * \return Sum of times
+     */
+    friend DoubleDoubleTime operator+( const DoubleDoubleTime& timeToAdd2, const double& timeToAdd1 )
+    {
+        return timeToAdd1 + timeToAdd2;
+    }
+
+    //! Addition operator for DoubleDoubleTime object with long double variable
+    /*!
+     * Addition operator for DoubleDoubleTime object with long double variable
+     * \param timeToAdd2 First time to add
+     * \param timeToAdd1 Second time to add (as long double)
+     * \return Sum of times
+     */
+    friend DoubleDoubleTime operator+( const DoubleDoubleTime& timeToAdd2, const long double& timeToAdd1 )
+    {
+        return DoubleDoubleTime( timeToAdd1 ) + timeToAdd2;
+    }
+
+    //! Unary minus operator
+    /*!
+     * Unary minus operator
+     * \param timeToNegate Time that is to be negated
+     * \return Negated time
+     */
+    friend DoubleDoubleTime operator-( const DoubleDoubleTime& timeToNegate )
+    {
+        return DoubleDoubleTime( -timeToNegate.secondsSinceEpoch_ );
+    }
+
+    //! Subtraction operator for two DoubleDoubleTime objects
+    /*!
+     * Subtraction operator for two DoubleDoubleTime objects
+     * \param timeToSubtract1 Time from which to subtract
+     * \param timeToSubtract2 Time that is to be subtracted
+     * \return Difference of times
+     */
+    friend DoubleDoubleTime operator-( const DoubleDoubleTime& timeToSubtract1, const DoubleDoubleTime& timeToSubtract2 )
+    {
+        return timeToSubtract1 + ( -timeToSubtract2 );
+    }
+
+    //! Subtraction operator for double from DoubleDoubleTime object
+    /*!
+     * Subtraction operator for double from DoubleDoubleTime object
+     * \param timeToSubtract1 Time from which to subtract
+     * \param timeToSubtract2 Time that is to be subtracted (as double)
+     * \return Difference of times
+     */
+    friend DoubleDoubleTime operator-( const DoubleDoubleTime& timeToSubtract1, const double timeToSubtract2 )
+    {
+        return timeToSubtract1 + ( -timeToSubtract2 );
+    }
+
+    //! Subtraction operator for long double from DoubleDoubleTime object
+    /*!
+     * Subtraction operator for long double from DoubleDoubleTime object
+     * \param timeToSubtract1 Time from which to subtract
+     * \param timeToSubtract2 Time that is to be subtracted (as long double)
+     * \return Difference of times
+     */
+    friend DoubleDoubleTime operator-( const DoubleDoubleTime& timeToSubtract1, const long double timeToSubtract2 )
+    {
+        return timeToSubtract1 + ( -timeToSubtract2 );
+    }
+
+    //! Subtraction operator for DoubleDoubleTime object from double
+    /*!
+     * Subtraction operator for DoubleDoubleTime object from double
+     * \param timeToSubtract1 Time from which to subtract (as double)
+     * \param timeToSubtract2 Time that is to be subtracted
+     * \return Difference of times
+     */
+    friend DoubleDoubleTime operator-( const double timeToSubtract1, const DoubleDoubleTime& timeToSubtract2 )
+    {
+        return timeToSubtract1 + ( -timeToSubtract2 );
+    }
+
+    //! Subtraction operator for DoubleDoubleTime object from long double
+    /*!
+     * Subtraction operator for DoubleDoubleTime object from long double
+     * \param timeToSubtract1 Time from which to subtract (as long double)
+     * \param timeToSubtract2 Time that is to be subtracted
+     * \return Difference of times
+     */
+    friend DoubleDoubleTime operator-( const long double timeToSubtract1, const DoubleDoubleTime& timeToSubtract2 )
+    {
+        return timeToSubtract1 + ( -timeToSubtract2 );
+    }
+
+    //! Multiplication operator of a double with a DoubleDoubleTime object (i.e. to rescale time)
+    /*!
+     * Multiplication operator of a double with a DoubleDoubleTime object (i.e. to rescale time)
+     * \param timeToMultiply1 Value by which time is to be multiplied
+     * \param timeToMultiply2 Time that is to be multiplied by first input argument
+     * \return Multiplied time.
+     */
+    friend DoubleDoubleTime operator*( const double timeToMultiply1, const DoubleDoubleTime& timeToMultiply2 )
+    {
+        return DoubleDoubleTime( timeToMultiply2.secondsSinceEpoch_ * timeToMultiply1 );
+    }
+
+    //! Multiplication operator of a DoubleDoubleTime object with a double (i.e. to rescale time)
+    /*!
+     * Multiplication operator of a DoubleDoubleTime object with a double (i.e. to rescale time)
+     * \param timeToMultiply1 Time that is to be multiplied by second input argument
+     * \param timeToMultiply2 Value by which time is to be multiplied
+     * \return Multiplied time.
+     */
+    friend DoubleDoubleTime operator*( const DoubleDoubleTime& timeToMultiply1, const double timeToMultiply2 )
+    {
+        return timeToMultiply2 * timeToMultiply1;
+    }
+
+    //! Multiplication operator of a long double with a DoubleDoubleTime object (i.e. to rescale time)
+    /*!
+     * Multiplication operator of a long double with a DoubleDoubleTime object (i.e. to rescale time)
+     * \param timeToMultiply1 Value by which time is to be multiplied
+     * \param timeToMultiply2 Time that is to be multiplied by first input argument
+     * \return Multiplied time.
+     */
+    friend DoubleDoubleTime operator*( const long double timeToMultiply1, const DoubleDoubleTime& timeToMultiply2 )
+    {
+        return DoubleDoubleTime( timeToMultiply2.secondsSinceEpoch_ * DoubleDouble( timeToMultiply1 ) );
+    }
+
+    //! Multiplication operator of a DoubleDoubleTime object with a long double (i.e. to rescale time)
+    /*!
+     * Multiplication operator of a DoubleDoubleTime object with a long double (i.e. to rescale time)
+     * \param timeToMultiply1 Time that is to be multiplied by second input argument
+     * \param timeToMultiply2 Value by which time is to be multiplied
+     * \return Multiplied time.
+     */
+    friend DoubleDoubleTime operator*( const DoubleDoubleTime& timeToMultiply1, const long double timeToMultiply2 )
+    {
+        return timeToMultiply2 * timeToMultiply1;
+    }
+
+    //! Division operator of a DoubleDoubleTime object with a double (i.e. to rescale time)
+    /*!
+     * Division operator of a DoubleDoubleTime object with a double (i.e. to rescale time)
+     * \param original Time that is to be divided by second input argument
+     * \param doubleToDivideBy Value by which first argument is to be divided.
+     * \return Divided time.
+     */
+    friend const DoubleDoubleTime operator/( const DoubleDoubleTime& original, const double doubleToDivideBy )
+    {
+        return DoubleDoubleTime( original.secondsSinceEpoch_ / doubleToDivideBy );
+    }
+
+    //! Division operator of a DoubleDoubleTime object with a long double (i.e. to rescale time)
+    /*!
+     * Division operator of a DoubleDoubleTime object with a long double (i.e. to rescale time)
+     * \param original Time that is to be divided by second input argument
+     * \param doubleToDivideBy Value by which first argument is to be divided.
+     * \return Divided time.
+     */
+    friend const DoubleDoubleTime operator/( const DoubleDoubleTime& original, const long double doubleToDivideBy )
+    {
+        return DoubleDoubleTime( original.secondsSinceEpoch_ / DoubleDouble( doubleToDivideBy ) );
+    }
+
+    //! Add and assign operator for adding a DoubleDoubleTime
+    void operator+=( const DoubleDoubleTime& timeToAdd )
+    {
+        *this = *this + timeToAdd;
+    }
+
+    //! Add and assign operator for adding a double
+    void operator+=( const double timeToAdd )
+    {
+        *this = *this + timeToAdd;
+    }
+
+    //! Add and assign operator for adding a long double
+    void operator+=( const long double timeToAdd )
+    {
+        *this = *this + timeToAdd;
+    }
+
+    //! Subtract and assign operator for subtracting a DoubleDoubleTime
+    void operator-=( const DoubleDoubleTime& timeToSubtract )
+    {
+        *this = *this - timeToSubtract;
+    }
+
+    //! Subtract and assign operator for subtracting a double
+    void operator-=( const double timeToSubtract )
+    {
+        *this = *this - timeToSubtract;
+    }
+
+    //! Subtract and assign operator for subtracting a long double
+    void operator-=( const long double timeToSubtract )
+    {
+        *this = *this - timeToSubtract;
+    }
+
+    //! Multiply and assign operator for multiplying by double
+    void operator*=( const double timeToMultiply )
+    {
+        *this = *this * timeToMultiply;
+    }
+
+    //! Multiply and assign operator for multiplying by long double
+    void operator*=( const long double timeToMultiply )
+    {
+        *this = *this * timeToMultiply;
+    }
+
+    //! Divide and assign operator for dividing by double
+    void operator/=( const double timeToDivide )
+    {
+        *this = *this / timeToDivide;
+    }
+
+    //! Divide and assign operator for dividing by long double
+    void operator/=( const long double timeToDivide )
+    {
+        *this = *this / timeToDivide;
+    }
+
+    //! Equality operator for two DoubleDoubleTime objects (as the representation is normalized, this is exact).
+    friend bool operator==( const DoubleDoubleTime& timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return ( timeToCompare1.secondsSinceEpoch_ == timeToCompare2.secondsSinceEpoch_ );
+    }
+
+    //! Inequality operator for two DoubleDoubleTime objects
+    friend bool operator!=( const DoubleDoubleTime& timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return !operator==( timeToCompare1, timeToCompare2 );
+    }
+
+    //! Equality operator for a DoubleDoubleTime object with an integer (comparison is performed at double precision).
+    friend bool operator==( const DoubleDoubleTime& timeToCompare1, const int timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< double >( ) == static_cast< double >( timeToCompare2 ) );
+    }
+
+    //! Equality operator for a DoubleDoubleTime object with a double (comparison is performed at double precision).
+    friend bool operator==( const DoubleDoubleTime& timeToCompare1, const double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< double >( ) == timeToCompare2 );
+    }
+
+    //! Equality operator for a double with a DoubleDoubleTime object (comparison is performed at double precision).
+    friend bool operator==( const double timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return operator==( timeToCompare2, timeToCompare1 );
+    }
+
+    //! Inequality operator for a DoubleDoubleTime object with a double (comparison is performed at double precision).
+    friend bool operator!=( const DoubleDoubleTime& timeToCompare1, const double timeToCompare2 )
+    {
+        return !operator==( timeToCompare1, timeToCompare2 );
+    }
+
+    //! Inequality operator for a double with a DoubleDoubleTime object (comparison is performed at double precision).
+    friend bool operator!=( const double timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return !operator==( timeToCompare1, timeToCompare2 );
+    }
+
+    //! Equality operator for a DoubleDoubleTime object with a long double (comparison is performed at long double
+    //! precision).
+    friend bool operator==( const DoubleDoubleTime& timeToCompare1, const long double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< long double >( ) == timeToCompare2 );
+    }
+
+    //! Equality operator for a long double with a DoubleDoubleTime object (comparison is performed at long double
+    //! precision).
+    friend bool operator==( const long double timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return operator==( timeToCompare2, timeToCompare1 );
+    }
+
+    //! Inequality operator for a DoubleDoubleTime object with a long double (comparison is performed at long double
+    //! precision).
+    friend bool operator!=( const DoubleDoubleTime& timeToCompare1, const long double timeToCompare2 )
+    {
+        return !operator==( timeToCompare1, timeToCompare2 );
+    }
+
+    //! Inequality operator for a long double with a DoubleDoubleTime object (comparison is performed at long double
+    //! precision).
+    friend bool operator!=( const long double timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return !operator==( timeToCompare1, timeToCompare2 );
+    }
+
+    //! Greater-than operator for two DoubleDoubleTime objects
+    friend bool operator> ( const DoubleDoubleTime& timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return ( timeToCompare1.secondsSinceEpoch_ > timeToCompare2.secondsSinceEpoch_ );
+    }
+
+    //! Greater-than-or-equal-to operator for two DoubleDoubleTime objects
+    friend bool operator>= ( const DoubleDoubleTime& timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return !( timeToCompare2 > timeToCompare1 );
+    }
+
+    //! Smaller-than operator for two DoubleDoubleTime objects
+    friend bool operator< ( const DoubleDoubleTime& timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return ( timeToCompare2 > timeToCompare1 );
+    }
+
+    //! Smaller-than-or-equal-to operator for two DoubleDoubleTime objects
+    friend bool operator<= ( const DoubleDoubleTime& timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return !( timeToCompare1 > timeToCompare2 );
+    }
+
+    //! Smaller-than operator for DoubleDoubleTime object with double
+    friend bool operator< ( const DoubleDoubleTime& timeToCompare1, const double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< double >( ) < timeToCompare2 );
+    }
+
+    //! Smaller-than operator for DoubleDoubleTime object with long double
+    friend bool operator< ( const DoubleDoubleTime& timeToCompare1, const long double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< long double >( ) < timeToCompare2 );
+    }
+
+    //! Smaller-than-or-equal operator for DoubleDoubleTime object with double
+    friend bool operator<= ( const DoubleDoubleTime& timeToCompare1, const double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< double >( ) <= timeToCompare2 );
+    }
+
+    //! Smaller-than-or-equal operator for DoubleDoubleTime object with long double
+    friend bool operator<= ( const DoubleDoubleTime& timeToCompare1, const long double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< long double >( ) <= timeToCompare2 );
+    }
+
+    //! Greater-than operator for DoubleDoubleTime object with double
+    friend bool operator> ( const DoubleDoubleTime& timeToCompare1, const double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< double >( ) > timeToCompare2 );
+    }
+
+    //! Greater-than operator for DoubleDoubleTime object with long double
+    friend bool operator> ( const DoubleDoubleTime& timeToCompare1, const long double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< long double >( ) > timeToCompare2 );
+    }
+
+    //! Greater-than-or-equal operator for DoubleDoubleTime object with double
+    friend bool operator>= ( const DoubleDoubleTime& timeToCompare1, const double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< double >( ) >= timeToCompare2 );
+    }
+
+    //! Greater-than-or-equal operator for DoubleDoubleTime object with long double
+    friend bool operator>= ( const DoubleDoubleTime& timeToCompare1, const long double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< long double >( ) >= timeToCompare2 );
+    }
+
+    //! Smaller-than operator for double with DoubleDoubleTime object
+    friend bool operator< ( const double timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return ( timeToCompare1 < timeToCompare2.getSeconds< double >( ) );
+    }
+
+    //! Smaller-than operator for long double with DoubleDoubleTime object
+    friend bool operator< ( const long double timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return ( timeToCompare1 < timeToCompare2.getSeconds< long double >( ) );
+    }
+
+    //! Smaller-than-or-equal operator for double with DoubleDoubleTime object
+    friend bool operator<= ( const double timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return ( timeToCompare1 <= timeToCompare2.getSeconds< double >( ) );
+    }
+
+    //! Smaller-than-or-equal operator for long double with DoubleDoubleTime object
+    friend bool operator<= ( const long double timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return ( timeToCompare1 <= timeToCompare2.getSeconds< long double >( ) );
+    }
+
+    //! Greater-than operator for double with DoubleDoubleTime object
+    friend bool operator> ( const double timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return ( timeToCompare1 > timeToCompare2.getSeconds< double >( ) );
+    }
+
+    //! Greater-than operator for long double with DoubleDoubleTime object
+    friend bool operator> ( const long double timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return ( timeToCompare1 > timeToCompare2.getSeconds< long double >( ) );
+    }
+
+    //! Greater-than-or-equal operator for double with DoubleDoubleTime object
+    friend bool operator>= ( const double timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return ( timeToCompare1 >= timeToCompare2.getSeconds< double >( ) );
+    }
+
+    //! Greater-than-or-equal operator for long double with DoubleDoubleTime object
+    friend bool operator>= ( const long double timeToCompare1, const DoubleDoubleTime& timeToCompare2 )
+    {
+        return ( timeToCompare1 >= timeToCompare2.getSeconds< long double >( ) );
+    }
+
+    //! Output operator for DoubleDoubleTime object
+    friend std::ostream& operator << ( std::ostream& stream, const DoubleDoubleTime& timeToPrint )
+    {
+        stream << "(" << timeToPrint.getHighComponent( ) << ", " << timeToPrint.getLowComponent( ) << ") ";
+        return stream;
+    }
+
+    //! Function to get the total seconds since epoch, in templated precision
+    /*!
+     *  Function to get the total seconds since epoch, in templated precision. For double precision, this returns the
+     *  leading component of the representation, without any further computations.
+     *  \return Total seconds since epoch.
+     */
+    template< typename ScalarType >
+    ScalarType getSeconds( ) const
+    {
+        return static_cast< ScalarType >( secondsSinceEpoch_.getHighComponent( ) ) +
+                static_cast< ScalarType >( secondsSinceEpoch_.getLowComponent( ) );
+    }
+
+    //! Function to get the total seconds since epoch, in int precision (cast of DoubleDoubleTime to int)
+    operator int( ) const
+    {
+        return static_cast< int >( getSeconds< long double >( ) );
+    }
+
+    //! Function to get the total seconds since epoch, in double precision (cast of DoubleDoubleTime to double)
+    operator double( ) const
+    {
+        return secondsSinceEpoch_.getHighComponent( );
+    }
+
+    //! Function to get the total seconds since epoch, in long double precision (cast of DoubleDoubleTime to long double)
+    operator long double( ) const
+    {
+        return getSeconds< long double >( );
+    }
+
+    //! Function to get the number of full hours since epoch (for compatibility with Time class)
+    /*!
+     * Function to get the number of full hours since epoch (for compatibility with Time class)
+     * \return Number of full hours since epoch
+     */
+    int getFullPeriods( ) const
+    {
+        int fullPeriods = static_cast< int >( std::floor( getHighComponent( ) / static_cast< double >( TIME_NORMALIZATION_TERM ) ) );
+
+        // Correct for rounding of leading component, if needed.
+        if( ( *this - static_cast< double >( fullPeriods ) * static_cast< double >( TIME_NORMALIZATION_TERM ) ) < 0.0 )
+        {
+            fullPeriods--;
+        }
+        return fullPeriods;
+    }
+
+    //! Function to get the number of seconds into current hour (for compatibility with Time class)
+    /*!
+     * Function to get the number of seconds into current hour (for compatibility with Time class)
+     * \return Number of seconds into current hour
+     */
+    long double getSecondsIntoFullPeriod( ) const
+    {
+        return ( *this - static_cast< double >( getFullPeriods( ) ) * static_cast< double >( TIME_NORMALIZATION_TERM ) ).
+                getSeconds< long double >( );
+    }
+
+    //! Function to convert time to a Time object
+    /*!
+     * Function to convert time to a Time object (at the resolution of the Time class)
+     * \return Time object representing the current time.
+     */
+    Time getTime( ) const
+    {
+        const int fullPeriods = getFullPeriods( );
+        return Time( fullPeriods, ( *this - static_cast< double >( fullPeriods ) *
+                                    static_cast< double >( TIME_NORMALIZATION_TERM ) ).getSeconds< long double >( ) );
+    }
+
+    //! Function to get the leading (double precision) component of the time representation
+    double getHighComponent( ) const
+    {
+        return secondsSinceEpoch_.getHighComponent( );
+    }
+
+    //! Function to get the trailing (correction) component of the time representation
+    double getLowComponent( ) const
+    {
+        return secondsSinceEpoch_.getLowComponent( );
+    }
+
+protected:
+
+    //! Number of seconds since epoch, in double-double representation.
+    DoubleDouble secondsSinceEpoch_;
+
+};
+
+} // namespace tudat
+
+#endif // TUDAT_DOUBLEDOUBLETIME_H
@@ -0,0 +1,372 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PARALLEL_EXECUTION_H
+#define TUDAT_PARALLEL_EXECUTION_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to retrieve the number of threads that can be run concurrently on the current machine.
+/*!
+ *  Function to retrieve the number of threads that can be run concurrently on the current machine.
+ *  \return Number of concurrent threads supported by the machine (1 if this cannot be determined).
+ */
+inline unsigned int getNumberOfAvailableThreads( )
+{
+    unsigned int numberOfThreads = std::thread::hardware_concurrency( );
+    return ( numberOfThreads == 0 ) ? 1 : numberOfThreads;
+}
+
+//! Function to execute the iterations of a loop, with mutually independent iterations, in parallel.
+/*!
+ *  Function to execute the iterations of a loop, with mutually independent iterations, in parallel. The iterations are
+ *  distributed dynamically over the threads (each thread retrieves the next unprocessed iteration when it is done with its
+ *  current one), so that iterations of varying computational cost are balanced over the threads. The loop body is called
+ *  with the iteration index and the index of the thread on which it is executed, so that the caller can provide separate
+ *  work memory for each thread. The loop body must not modify any data that is shared between iterations. If the number
+ *  of threads is 1 (or the loop contains a single iteration), the loop is executed directly in the calling thread, in
+ *  order of iteration index. If any iteration throws an exception, the remaining iterations are skipped, and the first
+ *  exception is rethrown in the calling thread once all threads have finished.
+ *  \param numberOfIterations Number of iterations of the loop.
+ *  \param loopBody Function executing a single iteration (first argument: iteration index; second argument: thread index)
+ *  \param numberOfThreads Maximum number of threads that is to be used.
+ */
+inline void executeParallelForLoop(
+        const unsigned int numberOfIterations,
+        const std::function< void( const unsigned int, const unsigned int ) >& loopBody,
+        const unsigned int numberOfThreads )
+{
+    if( numberOfThreads <= 1 || numberOfIterations <= 1 )
+    {
+        for( unsigned int i = 0; i < numberOfIterations; i++ )
+        {
+            loopBody( i, 0 );
+        }
+    }
+    else
+    {
+        std::atomic< unsigned int > nextIteration( 0 );
+        std::atomic< bool > isExceptionThrown( false );
+        std::exception_ptr firstException;
+        std::mutex exceptionMutex;
+
+        // Function run by each of the threads
+        auto threadFunction = [ & ]( const unsigned int threadIndex )
+        {
+            unsigned int currentIteration;
+            while( !isExceptionThrown && ( currentIteration = nextIteration++ ) < numberOfIterations )
+            {
+                try
+                {
+                    loopBody( currentIteration, threadIndex );
+                }
+                catch( ... )
+                {
+                    std::lock_guard< std::mutex > lock( exceptionMutex );
+                    if( !isExceptionThrown )
+                    {
+                        firstException = std::current_exception( );
+                        isExceptionThrown = true;
+                    }
+                }
+            }
+        };
+
+        // Start threads (calling thread executes part of the iterations as well), and wait for them to finish
+        unsigned int numberOfUsedThreads = std::min( numberOfThreads, numberOfIterations );
+        std::vector< std::thread > threads;
+        for( unsigned int i = 1; i < numberOfUsedThreads; i++ )
+        {
+            threads.push_back( std::thread( threadFunction, i ) );
+        }
+        threadFunction( 0 );
+        for( unsigned int i = 0; i < threads.size( ); i++ )
+        {
+            threads.at( i ).join( );
+        }
+
+        if( isExceptionThrown )
+        {
+            std::rethrow_exception( firstException );
+        }
+    }
+}
+
+//! Class to repeatedly execute the iterations of loops, with mutually independent iterations, on a persistent set of
+//! threads.
+/*!
+ *  Class to repeatedly execute the iterations of loops, with mutually independent iterations, on a persistent set of
+ *  threads. The behaviour of each loop is identical to that of the executeParallelForLoop function, but the worker
+ *  threads are created once (in the constructor), and wait for the next loop when they are done with the current one,
+ *  instead of being created and joined for each loop. This class should be used when the loops are short and
+ *  executed many times (e.g. once per state derivative evaluation), so that the overhead of thread creation would be
+ *  significant.
+ *  Calls to executeParallelForLoop from different threads are executed one after the other. A loop body must not call
+ *  executeParallelForLoop of the same object: this would deadlock, so a std::runtime_error is thrown instead.
+ */
+class ParallelForLoopExecutor
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, starts the worker threads.
+     *  \param numberOfThreads Maximum number of threads that is to be used, including the calling thread (no worker
+     *  threads are started if this number is 1 or less).
+     */
+    ParallelForLoopExecutor( const unsigned int numberOfThreads ):
+        loopBody_( nullptr ), numberOfIterations_( 0 ), nextIteration_( 0 ), isExceptionThrown_( false ),
+        currentLoopIndex_( 0 ), numberOfActiveWorkerThreads_( 0 ), isTerminationRequested_( false )
+    {
+        for( unsigned int i = 1; i < numberOfThreads; i++ )
+        {
+            workerThreads_.push_back( std::thread( &ParallelForLoopExecutor::runWorkerThread, this, i ) );
+        }
+    }
+
+    //! Destructor, stops and joins the worker threads.
+    ~ParallelForLoopExecutor( )
+    {
+        {
+            std::lock_guard< std::mutex > lock( stateMutex_ );
+            isTerminationRequested_ = true;
+        }
+        loopStartedCondition_.notify_all( );
+        for( unsigned int i = 0; i < workerThreads_.size( ); i++ )
+        {
+            workerThreads_.at( i ).join( );
+        }
+    }
+
+    //! Function to execute the iterations of a loop, with mutually independent iterations, in parallel.
+    /*!
+     *  Function to execute the iterations of a loop, with mutually independent iterations, in parallel, using the
+     *  calling thread and the worker threads (see executeParallelForLoop free function for details). Throws a
+     *  std::runtime_error if called from a loop body that is executed by this object (which would deadlock).
+     *  \param numberOfIterations Number of iterations of the loop.
+     *  \param loopBody Function executing a single iteration (first argument: iteration index; second argument: thread
+     *  index)
+     */
+    void executeParallelForLoop(
+            const unsigned int numberOfIterations,
+            const std::function< void( const unsigned int, const unsigned int ) >& loopBody )
+    {
+        if( workerThreads_.size( ) == 0 || numberOfIterations <= 1 )
+        {
+            for( unsigned int i = 0; i < numberOfIterations; i++ )
+            {
+                loopBody( i, 0 );
+            }
+        }
+        else
+        {
+            checkIsNotCalledFromLoopBody( );
+            std::lock_guard< std::mutex > executionLock( executionMutex_ );
+
+            // Set loop that is to be executed, and wake up worker threads
+            {
+                std::lock_guard< std::mutex > lock( stateMutex_ );
+                loopBody_ = &loopBody;
+                loopCallingThreadId_ = std::this_thread::get_id( );
+                numberOfIterations_ = numberOfIterations;
+                nextIteration_ = 0;
+                isExceptionThrown_ = false;
+                firstException_ = nullptr;
+                numberOfActiveWorkerThreads_ = static_cast< unsigned int >( workerThreads_.size( ) );
+                currentLoopIndex_++;
+            }
+            loopStartedCondition_.notify_all( );
+
+            // Execute part of the iterations in calling thread, and wait for worker threads to finish
+            executeLoopIterations( 0 );
+            {
+                std::unique_lock< std::mutex > lock( stateMutex_ );
+                loopFinishedCondition_.wait( lock, [ this ]( ){ return numberOfActiveWorkerThreads_ == 0; } );
+                loopBody_ = nullptr;
+                loopCallingThreadId_ = std::thread::id( );
+            }
+
+            if( isExceptionThrown_ )
+            {
+                std::rethrow_exception( firstException_ );
+            }
+        }
+    }
+
+    //! Function to retrieve the maximum number of threads that is used, including the calling thread.
+    /*!
+     *  Function to retrieve the maximum number of threads that is used, including the calling thread.
+     *  \return Maximum number of threads that is used.
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return static_cast< unsigned int >( workerThreads_.size( ) ) + 1;
+    }
+
+private:
+
+    //! Function to check that executeParallelForLoop is not called from a loop body executed by this object.
+    /*!
+     *  Function to check that executeParallelForLoop is not called from a loop body executed by this object, i.e. from
+     *  one of the worker threads, or from the thread executing the current loop. Such a call would wait for the current
+     *  loop to finish, which in turn waits for the calling loop body, so that a std::runtime_error is thrown instead.
+     */
+    void checkIsNotCalledFromLoopBody( )
+    {
+        const std::thread::id currentThreadId = std::this_thread::get_id( );
+        bool isCalledFromLoopBody = false;
+        for( unsigned int i = 0; i < workerThreads_.size( ); i++ )
+        {
+            if( workerThreads_.at( i ).get_id( ) == currentThreadId )
+            {
+                isCalledFromLoopBody = true;
+            }
+        }
+
+        {
+            std::lock_guard< std::mutex > lock( stateMutex_ );
+            if( loopBody_ != nullptr && loopCallingThreadId_ == currentThreadId )
+            {
+                isCalledFromLoopBody = true;
+            }
+        }
+
+        if( isCalledFromLoopBody )
+        {
+            throw std::runtime_error( "Error in parallel for loop, loop body calls executeParallelForLoop of the object "
+                                      "executing it, which would deadlock." );
+        }
+    }
+
+    //! Function run by each of the worker threads, executing loops until termination is requested.
+    /*!
+     *  Function run by each of the worker threads, executing loops until termination is requested.
+     *  \param threadIndex Index of the thread (calling thread of executeParallelForLoop has index 0).
+     */
+    void runWorkerThread( const unsigned int threadIndex )
+    {
+        unsigned long long lastExecutedLoopIndex = 0;
+        while( true )
+        {
+            {
+                std::unique_lock< std::mutex > lock( stateMutex_ );
+                loopStartedCondition_.wait( lock, [ & ]( ){
+                    return isTerminationRequested_ || currentLoopIndex_ != lastExecutedLoopIndex; } );
+                if( isTerminationRequested_ )
+                {
+                    return;
+                }
+                lastExecutedLoopIndex = currentLoopIndex_;
+            }
+
+            executeLoopIterations( threadIndex );
+
+            {
+                std::lock_guard< std::mutex > lock( stateMutex_ );
+                numberOfActiveWorkerThreads_--;
+                if( numberOfActiveWorkerThreads_ == 0 )
+                {
+                    loopFinishedCondition_.notify_one( );
+                }
+            }
+        }
+    }
+
+    //! Function to execute unprocessed iterations of the current loop, until none are left (or an exception is thrown).
+    /*!
+     *  Function to execute unprocessed iterations of the current loop, until none are left (or an exception is thrown).
+     *  \param threadIndex Index of the thread on which the iterations are executed.
+     */
+    void executeLoopIterations( const unsigned int threadIndex )
+    {
+        unsigned int currentIteration;
+        while( !isExceptionThrown_ && ( currentIteration = nextIteration_++ ) < numberOfIterations_ )
+        {
+            try
+            {
+                ( *loopBody_ )( currentIteration, threadIndex );
+            }
+            catch( ... )
+            {
+                std::lock_guard< std::mutex > lock( exceptionMutex_ );
+                if( !isExceptionThrown_ )
+                {
+                    firstException_ = std::current_exception( );
+                    isExceptionThrown_ = true;
+                }
+            }
+        }
+    }
+
+    //! Worker threads (the calling thread of executeParallelForLoop is not included).
+    std::vector< std::thread > workerThreads_;
+
+    //! Loop body of the loop that is currently executed (nullptr if no loop is executed).
+    const std::function< void( const unsigned int, const unsigned int ) >* loopBody_;
+
+    //! Thread from which the loop that is currently executed was started.
+    std::thread::id loopCallingThreadId_;
+
+    //! Number of iterations of the loop that is currently executed.
+    unsigned int numberOfIterations_;
+
+    //! Index of the next iteration of the current loop that is to be executed.
+    std::atomic< unsigned int > nextIteration_;
+
+    //! Boolean denoting whether an iteration of the current loop has thrown an exception.
+    std::atomic< bool > isExceptionThrown_;
+
+    //! First exception thrown by an iteration of the current loop.
+    std::exception_ptr firstException_;
+
+    //! Number of loops that have been started (used by worker threads to detect a new loop).
+    unsigned long long currentLoopIndex_;
+
+    //! Number of worker threads that have not yet finished the current loop.
+    unsigned int numberOfActiveWorkerThreads_;
+
+    //! Boolean denoting whether the worker threads are to be stopped.
+    bool isTerminationRequested_;
+
+    //! Mutex protecting the loop settings and the worker thread status.
+    std::mutex stateMutex_;
+
+    //! Mutex ensuring that only one loop is executed at a time.
+    std::mutex executionMutex_;
+
+    //! Mutex protecting the first exception of the current loop.
+    std::mutex exceptionMutex_;
+
+    //! Condition variable used to notify worker threads that a new loop is started (or that they are to stop).
+    std::condition_variable loopStartedCondition_;
+
+    //! Condition variable used to notify the calling thread that all worker threads have finished the current loop.
+    std::condition_variable loopFinishedCondition_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PARALLEL_EXECUTION_H
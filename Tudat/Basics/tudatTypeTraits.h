@@ -15,6 +15,7 @@
 #include <type_traits>
 
 #include "Tudat/Basics/timeType.h"
+#include "Tudat/Basics/doubleDoubleTime.h"
 
 namespace tudat
 {
@@ -82,6 +83,11 @@ struct is_time_type< Time > {
   static const bool value = true;
 };
 
+template< >
+struct is_time_type< DoubleDoubleTime > {
+  static const bool value = true;
+};
+
 template< typename StateScalarType, typename TimeType >
 struct is_state_scalar_and_time_type {
   static const bool value = ( is_time_type< TimeType >::value && is_state_scalar< StateScalarType >::value );
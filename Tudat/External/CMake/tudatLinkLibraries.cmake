@@ -51,6 +51,9 @@ endif()
    list(APPEND TUDAT_EXTERNAL_LIBRARIES pthread)
  endif( )
 
+ # Add threading library, used for parallel execution of mutually independent computations.
+ list(APPEND TUDAT_EXTERNAL_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+
  list(APPEND TUDAT_PROPAGATION_LIBRARIES tudat_propagation_setup tudat_trajectory_design tudat_environment_setup tudat_ground_stations tudat_propagators
      tudat_aerodynamics tudat_system_models tudat_geometric_shapes tudat_relativity tudat_gravitation tudat_mission_segments
      tudat_electro_magnetism tudat_propulsion tudat_ephemerides ${TUDAT_ITRS_LIBRARIES} tudat_numerical_integrators tudat_reference_frames
@@ -0,0 +1,59 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmark comparing the loading time of a synthetic aerodynamic coefficient table from text files, from a
+ *      binary file (copied) and from a binary file (memory-mapped). Only built if BUILD_BENCHMARKS is set.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "Tudat/InputOutput/binaryAerodynamicCoefficientTable.h"
+#include "Tudat/InputOutput/UnitTests/syntheticAerodynamicCoefficientTable.h"
+
+int main( )
+{
+    using namespace tudat::input_output;
+
+    const boost::filesystem::path outputDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+
+    std::map< int, std::string > files;
+    std::string binaryFile;
+    boost::multi_array< Eigen::Vector3d, 3 > coefficients = tudat::unit_tests::writeSyntheticAerodynamicCoefficientTable(
+                outputDirectory, { 60, 50, 40 }, files, binaryFile );
+
+    // Load tables
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    std::pair< boost::multi_array< Eigen::Vector3d, 3 >, std::vector< std::vector< double > > > textCoefficients =
+            readAerodynamicCoefficients< 3 >( files );
+    const double textLoadingTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    startTime = std::chrono::steady_clock::now( );
+    std::pair< boost::multi_array< Eigen::Vector3d, 3 >, std::vector< std::vector< double > > > binaryCoefficients =
+            readBinaryAerodynamicCoefficients< 3 >( binaryFile );
+    const double binaryLoadingTime =
+            std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    startTime = std::chrono::steady_clock::now( );
+    std::shared_ptr< MappedAerodynamicCoefficientTable< 3 > > mappedTable =
+            std::make_shared< MappedAerodynamicCoefficientTable< 3 > >( binaryFile );
+    const double mappingTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    std::cout << "Loading " << coefficients.num_elements( ) << " coefficients; text files: "
+              << textLoadingTime << " s, binary file (copied): " << binaryLoadingTime
+              << " s, binary file (mapped): " << mappingTime << " s" << std::endl;
+
+    mappedTable.reset( );
+    boost::filesystem::remove_all( outputDirectory );
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,75 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmark of the throughput of the TLE catalogue parser (using a single thread and all available hardware
+ *      threads) and of the TwoLineElementsTextFileReader, for a synthetic catalogue. Only built if BUILD_BENCHMARKS
+ *      is set.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+#include <boost/filesystem.hpp>
+
+#include "Tudat/InputOutput/twoLineElementCatalogue.h"
+#include "Tudat/InputOutput/UnitTests/syntheticTwoLineElementCatalogue.h"
+
+int main( )
+{
+    using namespace tudat::input_output;
+    using namespace tudat::unit_tests;
+
+    const int numberOfRecords = 200000;
+    const int numberOfRecordsForTextFileReader = 20000;
+    const unsigned int maximumNumberOfThreads = std::max( std::thread::hardware_concurrency( ), 2u );
+
+    // Write synthetic catalogues to temporary files.
+    boost::filesystem::path temporaryDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+    boost::filesystem::create_directories( temporaryDirectory );
+    {
+        std::ofstream catalogueFile( ( temporaryDirectory / "catalogue.txt" ).string( ), std::ios::binary );
+        catalogueFile << createSyntheticTwoLineElementCatalogue( numberOfRecords, 1 );
+        std::ofstream smallCatalogueFile( ( temporaryDirectory / "smallCatalogue.txt" ).string( ),
+                                          std::ios::binary );
+        smallCatalogueFile << createSyntheticTwoLineElementCatalogue( numberOfRecordsForTextFileReader, 1 );
+    }
+
+    // Parse small catalogue with TwoLineElementsTextFileReader.
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    std::multimap< int, std::string > corruptedRecordErrors;
+    readTwoLineElementFileWithTextFileReader(
+                temporaryDirectory.string( ) + "/", "smallCatalogue.txt",
+                TwoLineElementsTextFileReader::threeLineType, corruptedRecordErrors );
+    const double textFileReaderTime =
+            std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+    std::cout << "TwoLineElementsTextFileReader: " << numberOfRecordsForTextFileReader / textFileReaderTime
+              << " records/s" << std::endl;
+
+    // Parse full catalogue, using different numbers of threads.
+    for( unsigned int numberOfThreads: { 1u, maximumNumberOfThreads } )
+    {
+        startTime = std::chrono::steady_clock::now( );
+        TwoLineElementCatalogue catalogue = readTwoLineElementCatalogue(
+                    ( temporaryDirectory / "catalogue.txt" ).string( ),
+                    TwoLineElementsTextFileReader::threeLineType, numberOfThreads );
+        const double parsingTime =
+                std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+        std::cout << "readTwoLineElementCatalogue (" << numberOfThreads << " thread(s)): "
+                  << catalogue.getNumberOfRecords( ) / parsingTime << " records/s" << std::endl;
+    }
+
+    boost::filesystem::remove_all( temporaryDirectory );
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,86 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_SYNTHETIC_AERODYNAMIC_COEFFICIENT_TABLE_H
+#define TUDAT_SYNTHETIC_AERODYNAMIC_COEFFICIENT_TABLE_H
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/multi_array.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/InputOutput/binaryAerodynamicCoefficientTable.h"
+#include "Tudat/InputOutput/multiDimensionalArrayWriter.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to write a synthetic 3-dimensional aerodynamic coefficient table to text files and to a binary file.
+/*!
+ *  Function to write a synthetic 3-dimensional aerodynamic coefficient table, with random coefficients, to text files
+ *  (one per coefficient component) and to a binary file. Used by the unit tests and benchmark of the binary
+ *  aerodynamic coefficient tables.
+ *  \param outputDirectory Directory to which the files are written.
+ *  \param independentVariableSizes Number of data points of each independent variable.
+ *  \param files Names of the text files, per coefficient component (returned by reference).
+ *  \param binaryFile Name of the binary file (returned by reference).
+ *  \return Coefficients that were written to the files.
+ */
+inline boost::multi_array< Eigen::Vector3d, 3 > writeSyntheticAerodynamicCoefficientTable(
+        const boost::filesystem::path& outputDirectory, const std::vector< unsigned int >& independentVariableSizes,
+        std::map< int, std::string >& files, std::string& binaryFile )
+{
+    // Create synthetic 3-dimensional table
+    std::vector< std::vector< double > > independentVariables( 3 );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        for( unsigned int j = 0; j < independentVariableSizes.at( i ); j++ )
+        {
+            independentVariables[ i ].push_back( 0.5 * static_cast< double >( j ) );
+        }
+    }
+
+    boost::multi_array< Eigen::Vector3d, 3 > coefficients(
+                boost::extents[ independentVariableSizes[ 0 ] ][ independentVariableSizes[ 1 ] ]
+            [ independentVariableSizes[ 2 ] ] );
+    std::mt19937 randomNumberGenerator( 42 );
+    std::uniform_real_distribution< double > distribution( -1.0, 1.0 );
+    for( unsigned int i = 0; i < coefficients.num_elements( ); i++ )
+    {
+        coefficients.data( )[ i ] << distribution( randomNumberGenerator ), distribution( randomNumberGenerator ),
+                distribution( randomNumberGenerator );
+    }
+
+    // Write table to text and binary files
+    files.clear( );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        files[ i ] = ( outputDirectory / ( "coefficient" + std::to_string( i ) + ".txt" ) ).string( );
+    }
+    input_output::MultiArrayFileWriter< 3, 3 >::writeMultiArrayAndIndependentVariablesToFiles(
+                files, independentVariables, coefficients );
+    binaryFile = ( outputDirectory / "coefficients.bin" ).string( );
+    input_output::convertAerodynamicCoefficientFilesToBinary< 3 >( files, binaryFile );
+
+    return coefficients;
+}
+
+} // namespace unit_tests
+
+} // namespace tudat
+
+#endif // TUDAT_SYNTHETIC_AERODYNAMIC_COEFFICIENT_TABLE_H
@@ -0,0 +1,107 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_SYNTHETIC_TWO_LINE_ELEMENT_CATALOGUE_H
+#define TUDAT_SYNTHETIC_TWO_LINE_ELEMENT_CATALOGUE_H
+
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Tudat/InputOutput/twoLineElementsTextFileReader.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to read a TLE file with the TwoLineElementsTextFileReader, and perform its integrity checks.
+inline std::vector< input_output::TwoLineElementData > readTwoLineElementFileWithTextFileReader(
+        const std::string& directoryPath, const std::string& fileName,
+        const input_output::TwoLineElementsTextFileReader::LineNumberTypesForTwoLineElementInputData lineNumberType,
+        std::multimap< int, std::string >& corruptedTwoLineElementDataErrors )
+{
+    input_output::TwoLineElementsTextFileReader twoLineElementsTextFileReader;
+    twoLineElementsTextFileReader.setLineNumberTypeForTwoLineElementInputData( lineNumberType );
+    twoLineElementsTextFileReader.setAbsoluteDirectoryPath( directoryPath );
+    twoLineElementsTextFileReader.setFileName( fileName );
+    twoLineElementsTextFileReader.openFile( );
+    twoLineElementsTextFileReader.readAndStoreData( );
+    twoLineElementsTextFileReader.closeFile( );
+    twoLineElementsTextFileReader.setCurrentYear( 2011 );
+    twoLineElementsTextFileReader.storeTwoLineElementData( );
+    corruptedTwoLineElementDataErrors = twoLineElementsTextFileReader.checkTwoLineElementsFileIntegrity( );
+    return twoLineElementsTextFileReader.getTwoLineElementData( );
+}
+
+//! Function to append the modulo-10 checksum to a TLE line (without checksum).
+inline std::string appendTwoLineElementChecksum( const std::string& line )
+{
+    int checksum = 0;
+    for( unsigned int i = 0; i < line.size( ); i++ )
+    {
+        if( line[ i ] >= '0' && line[ i ] <= '9' )
+        {
+            checksum += line[ i ] - '0';
+        }
+        else if( line[ i ] == '-' )
+        {
+            checksum++;
+        }
+    }
+    return line + std::to_string( checksum % 10 );
+}
+
+//! Function to create a synthetic (valid) TLE catalogue in the three-line format (without newline at end of file, as
+//! required by the TwoLineElementsTextFileReader).
+inline std::string createSyntheticTwoLineElementCatalogue( const int numberOfRecords, const int seed )
+{
+    std::mt19937 randomNumberGenerator( seed );
+    std::uniform_real_distribution< double > unitDistribution( 0.0, 1.0 );
+    std::uniform_int_distribution< int > digitDistribution( 0, 99999 );
+
+    std::string catalogue;
+    char lineBuffer[ 128 ];
+    for( int i = 0; i < numberOfRecords; i++ )
+    {
+        const int objectIdentificationNumber = i % 100000;
+        catalogue += "OBJECT " + std::to_string( i ) + "    \n";
+
+        std::snprintf( lineBuffer, sizeof( lineBuffer ),
+                       "1 %05dU %02d%03d%-3s %02d%012.8f %c.%08d %c%05d%c%d %c%05d%c%d 0 %4d",
+                       objectIdentificationNumber, ( 57 + i ) % 100, i % 1000, ( i % 2 == 0 ) ? "A" : "BC",
+                       ( 10 + i ) % 100, 1.0 + 365.0 * unitDistribution( randomNumberGenerator ),
+                       ( i % 3 == 0 ) ? '-' : ' ', digitDistribution( randomNumberGenerator ) % 100000,
+                       ( i % 5 == 0 ) ? '-' : ' ', digitDistribution( randomNumberGenerator ), '-', i % 10,
+                       ( i % 7 == 0 ) ? '-' : ' ', digitDistribution( randomNumberGenerator ),
+                       ( i % 4 == 0 ) ? '+' : '-', i % 10, i % 10000 );
+        catalogue += appendTwoLineElementChecksum( lineBuffer ) + ( ( i % 2 == 0 ) ? "\n" : "\r\n" );
+
+        std::snprintf( lineBuffer, sizeof( lineBuffer ),
+                       "2 %05d %8.4f %8.4f %07d %8.4f %8.4f %11.8f%5d",
+                       objectIdentificationNumber, 179.9 * unitDistribution( randomNumberGenerator ),
+                       359.9 * unitDistribution( randomNumberGenerator ),
+                       digitDistribution( randomNumberGenerator ) * 10,
+                       359.9 * unitDistribution( randomNumberGenerator ),
+                       359.9 * unitDistribution( randomNumberGenerator ),
+                       1.0 + 15.0 * unitDistribution( randomNumberGenerator ),
+                       digitDistribution( randomNumberGenerator ) );
+        catalogue += appendTwoLineElementChecksum( lineBuffer ) + ( ( i < numberOfRecords - 1 ) ? "\n" : "" );
+    }
+    return catalogue;
+}
+
+} // namespace unit_tests
+
+} // namespace tudat
+
+#endif // TUDAT_SYNTHETIC_TWO_LINE_ELEMENT_CATALOGUE_H
@@ -0,0 +1,213 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/binaryAerodynamicCoefficientTable.h"
+#include "Tudat/InputOutput/multiDimensionalArrayWriter.h"
+#include "Tudat/InputOutput/UnitTests/syntheticAerodynamicCoefficientTable.h"
+#include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::input_output;
+
+//! Function to check whether two multi-arrays (or views) of Vector3d are exactly equal.
+template< typename FirstArrayType, typename SecondArrayType >
+void checkCoefficientArraysEqual( const FirstArrayType& firstArray, const SecondArrayType& secondArray )
+{
+    BOOST_CHECK_EQUAL( firstArray.num_dimensions( ), secondArray.num_dimensions( ) );
+    for( unsigned int i = 0; i < firstArray.num_dimensions( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( firstArray.shape( )[ i ], secondArray.shape( )[ i ] );
+    }
+    BOOST_CHECK_EQUAL( firstArray.num_elements( ), secondArray.num_elements( ) );
+
+    bool areArraysEqual = true;
+    for( unsigned int i = 0; i < firstArray.num_elements( ); i++ )
+    {
+        if( firstArray.data( )[ i ] != secondArray.data( )[ i ] )
+        {
+            areArraysEqual = false;
+        }
+    }
+    BOOST_CHECK( areArraysEqual );
+}
+
+BOOST_AUTO_TEST_SUITE( test_binary_aerodynamic_coefficient_table )
+
+//! Test conversion of text files to binary tables, and reading of binary tables.
+BOOST_AUTO_TEST_CASE( testBinaryTableConversion )
+{
+    const boost::filesystem::path outputDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+    const std::string aerodynamicsTestPath = getTudatRootPath( ) + "/Astrodynamics/Aerodynamics/UnitTests/";
+
+    // Convert and read 2-dimensional coefficients
+    {
+        std::map< int, std::string > files;
+        files[ 0 ] = aerodynamicsTestPath + "aurora_CD.txt";
+        files[ 2 ] = aerodynamicsTestPath + "aurora_CL.txt";
+
+        const std::string binaryFile = ( outputDirectory / "aurora.bin" ).string( );
+        convertAerodynamicCoefficientFilesToBinary< 2 >( files, binaryFile );
+
+        std::pair< boost::multi_array< Eigen::Vector3d, 2 >, std::vector< std::vector< double > > > textCoefficients =
+                readAerodynamicCoefficients< 2 >( files );
+        std::pair< boost::multi_array< Eigen::Vector3d, 2 >, std::vector< std::vector< double > > >
+                binaryCoefficients = readBinaryAerodynamicCoefficients< 2 >( binaryFile );
+
+        BOOST_CHECK( textCoefficients.second == binaryCoefficients.second );
+        checkCoefficientArraysEqual( textCoefficients.first, binaryCoefficients.first );
+
+        MappedAerodynamicCoefficientTable< 2 > mappedTable( binaryFile );
+        BOOST_CHECK( textCoefficients.second == mappedTable.getIndependentVariables( ) );
+        checkCoefficientArraysEqual( textCoefficients.first, *mappedTable.getCoefficients( ) );
+        BOOST_CHECK_EQUAL( ( *mappedTable.getCoefficients( ) )[ 3 ][ 4 ]( 0 ), 0.0263660 );
+        BOOST_CHECK_EQUAL( ( *mappedTable.getCoefficients( ) )[ 3 ][ 4 ]( 1 ), 0.0 );
+
+        // Check that table with wrong number of independent variables is rejected.
+        BOOST_CHECK_THROW( MappedAerodynamicCoefficientTable< 3 > wrongTable( binaryFile ), std::runtime_error );
+
+        // Check that incomplete table is rejected.
+        boost::filesystem::resize_file( binaryFile, boost::filesystem::file_size( binaryFile ) - 1 );
+        BOOST_CHECK_THROW( MappedAerodynamicCoefficientTable< 2 > incompleteTable( binaryFile ), std::runtime_error );
+    }
+
+    // Convert and read 4-dimensional coefficients
+    {
+        std::map< int, std::string > files;
+        files[ 0 ] = aerodynamicsTestPath + "dCDw4DTest1.txt";
+        files[ 1 ] = aerodynamicsTestPath + "dCDw4DTest2.txt";
+
+        const std::string binaryFile = ( outputDirectory / "dCDw4D.bin" ).string( );
+        convertAerodynamicCoefficientFilesToBinary< 4 >( files, binaryFile );
+
+        std::pair< boost::multi_array< Eigen::Vector3d, 4 >, std::vector< std::vector< double > > > textCoefficients =
+                readAerodynamicCoefficients< 4 >( files );
+        MappedAerodynamicCoefficientTable< 4 > mappedTable( binaryFile );
+        BOOST_CHECK( textCoefficients.second == mappedTable.getIndependentVariables( ) );
+        checkCoefficientArraysEqual( textCoefficients.first, *mappedTable.getCoefficients( ) );
+    }
+
+    boost::filesystem::remove_all( outputDirectory );
+}
+
+//! Test multi-linear interpolation on a view of a memory-mapped table.
+BOOST_AUTO_TEST_CASE( testInterpolationOnMappedTable )
+{
+    using namespace tudat::interpolators;
+
+    const boost::filesystem::path outputDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+    const std::string aerodynamicsTestPath = getTudatRootPath( ) + "/Astrodynamics/Aerodynamics/UnitTests/";
+
+    std::map< int, std::string > files;
+    files[ 0 ] = aerodynamicsTestPath + "dCDw4DTest1.txt";
+    files[ 2 ] = aerodynamicsTestPath + "dCDw4DTest2.txt";
+    const std::string binaryFile = ( outputDirectory / "dCDw4D.bin" ).string( );
+    convertAerodynamicCoefficientFilesToBinary< 4 >( files, binaryFile );
+
+    std::pair< boost::multi_array< Eigen::Vector3d, 4 >, std::vector< std::vector< double > > > textCoefficients =
+            readAerodynamicCoefficients< 4 >( files );
+
+    MultiLinearInterpolator< double, Eigen::Vector3d, 4 > copiedDataInterpolator(
+                textCoefficients.second, textCoefficients.first, huntingAlgorithm,
+                std::vector< BoundaryInterpolationType >( 4, use_boundary_value ) );
+
+    // Create interpolator on mapped table; the table object itself is destroyed, but the view keeps the mapping alive.
+    std::shared_ptr< MultiLinearInterpolator< double, Eigen::Vector3d, 4 > > mappedDataInterpolator;
+    {
+        MappedAerodynamicCoefficientTable< 4 > mappedTable( binaryFile );
+        mappedDataInterpolator = std::make_shared< MultiLinearInterpolator< double, Eigen::Vector3d, 4 > >(
+                    mappedTable.getIndependentVariables( ), mappedTable.getCoefficients( ), huntingAlgorithm,
+                    std::vector< BoundaryInterpolationType >( 4, use_boundary_value ) );
+    }
+
+    // Compare interpolated values at random points (including points outside the table).
+    std::mt19937 randomNumberGenerator( 42 );
+    std::vector< std::uniform_real_distribution< double > > distributions;
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        const double lowerBound = textCoefficients.second.at( i ).front( );
+        const double upperBound = textCoefficients.second.at( i ).back( );
+        const double margin = 0.05 * ( upperBound - lowerBound );
+        distributions.push_back( std::uniform_real_distribution< double >( lowerBound - margin, upperBound + margin ) );
+    }
+
+    bool areInterpolatedValuesEqual = true;
+    std::vector< double > independentVariables( 4 );
+    for( unsigned int i = 0; i < 10000; i++ )
+    {
+        for( unsigned int j = 0; j < 4; j++ )
+        {
+            independentVariables[ j ] = distributions[ j ]( randomNumberGenerator );
+        }
+        if( copiedDataInterpolator.interpolate( independentVariables ) !=
+                mappedDataInterpolator->interpolate( independentVariables ) )
+        {
+            areInterpolatedValuesEqual = false;
+        }
+    }
+    BOOST_CHECK( areInterpolatedValuesEqual );
+
+    // Check retrieval of dependent data.
+    checkCoefficientArraysEqual( copiedDataInterpolator.getDependentValues( ),
+                                 mappedDataInterpolator->getDependentValues( ) );
+
+    mappedDataInterpolator.reset( );
+    boost::filesystem::remove_all( outputDirectory );
+}
+
+//! Test that a larger table is identical when read from text files, read from a binary file, and memory-mapped.
+BOOST_AUTO_TEST_CASE( testBinaryTableLargeTable )
+{
+    const boost::filesystem::path outputDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+
+    std::map< int, std::string > files;
+    std::string binaryFile;
+    boost::multi_array< Eigen::Vector3d, 3 > coefficients = writeSyntheticAerodynamicCoefficientTable(
+                outputDirectory, { 60, 50, 40 }, files, binaryFile );
+
+    // Load tables
+    std::pair< boost::multi_array< Eigen::Vector3d, 3 >, std::vector< std::vector< double > > > textCoefficients =
+            readAerodynamicCoefficients< 3 >( files );
+    std::pair< boost::multi_array< Eigen::Vector3d, 3 >, std::vector< std::vector< double > > > binaryCoefficients =
+            readBinaryAerodynamicCoefficients< 3 >( binaryFile );
+    std::shared_ptr< MappedAerodynamicCoefficientTable< 3 > > mappedTable =
+            std::make_shared< MappedAerodynamicCoefficientTable< 3 > >( binaryFile );
+
+    checkCoefficientArraysEqual( textCoefficients.first, binaryCoefficients.first );
+    checkCoefficientArraysEqual( textCoefficients.first, *mappedTable->getCoefficients( ) );
+    BOOST_CHECK_EQUAL( mappedTable->getCoefficients( )->num_elements( ), coefficients.num_elements( ) );
+
+    mappedTable.reset( );
+    boost::filesystem::remove_all( outputDirectory );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
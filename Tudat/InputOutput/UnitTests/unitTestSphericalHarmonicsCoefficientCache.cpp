@@ -0,0 +1,195 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/sphericalHarmonicsCoefficientCache.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::input_output;
+
+BOOST_AUTO_TEST_SUITE( test_spherical_harmonics_coefficient_cache )
+
+//! Test whether the content hash distinguishes (slightly) different data.
+BOOST_AUTO_TEST_CASE( testDataContentHash )
+{
+    const std::string firstData = "   2   0 -0.484165371736E-03  0.000000000000E+00\n";
+    std::string secondData = firstData;
+    secondData[ 20 ] = '2';
+
+    BOOST_CHECK_EQUAL( utilities::computeDataContentHash( firstData.c_str( ), firstData.size( ) ),
+                       utilities::computeDataContentHash( firstData.c_str( ), firstData.size( ) ) );
+    BOOST_CHECK( utilities::computeDataContentHash( firstData.c_str( ), firstData.size( ) ) !=
+                 utilities::computeDataContentHash( secondData.c_str( ), secondData.size( ) ) );
+    BOOST_CHECK( utilities::computeDataContentHash( firstData.c_str( ), firstData.size( ) ) !=
+                 utilities::computeDataContentHash( firstData.c_str( ), firstData.size( ) - 1 ) );
+
+    // Check hash of file against hash of its contents.
+    const std::string gravityFieldFile = getGravityModelsPath( ) + "Earth/ggm02s.txt";
+    std::ifstream fileStream( gravityFieldFile.c_str( ), std::ios::binary );
+    const std::string fileContents( ( std::istreambuf_iterator< char >( fileStream ) ),
+                                    std::istreambuf_iterator< char >( ) );
+    BOOST_CHECK_EQUAL( computeFileContentHash( gravityFieldFile ),
+                       utilities::computeDataContentHash( fileContents.c_str( ), fileContents.size( ) ) );
+}
+
+//! Test that the cache is disabled by default, and the default per-user cache directory.
+BOOST_AUTO_TEST_CASE( testCacheDirectorySettings )
+{
+    BOOST_CHECK( getSphericalHarmonicsCoefficientCacheDirectory( ).empty( ) );
+    BOOST_CHECK( getSphericalHarmonicsCoefficientCacheFilePath(
+                     "/some/path/model.txt", 1, 10, 10, 0, 1 ).empty( ) );
+
+#if !defined( _WIN32 )
+    const char* originalXdgCacheHome = std::getenv( "XDG_CACHE_HOME" );
+    const std::string originalXdgCacheHomeString = ( originalXdgCacheHome != nullptr ) ? originalXdgCacheHome : "";
+
+    ::setenv( "XDG_CACHE_HOME", "/some/cache", 1 );
+    BOOST_CHECK_EQUAL( getDefaultSphericalHarmonicsCoefficientCacheDirectory( ),
+                       "/some/cache/tudat/spherical_harmonics" );
+    ::setenv( "XDG_CACHE_HOME", "relative/cache", 1 );
+    BOOST_CHECK( getDefaultSphericalHarmonicsCoefficientCacheDirectory( ).find( "relative" ) == std::string::npos );
+
+    if( originalXdgCacheHome != nullptr )
+    {
+        ::setenv( "XDG_CACHE_HOME", originalXdgCacheHomeString.c_str( ), 1 );
+    }
+    else
+    {
+        ::unsetenv( "XDG_CACHE_HOME" );
+    }
+#endif
+}
+
+//! Test writing and mapping of a cache file.
+BOOST_AUTO_TEST_CASE( testCacheFileRoundTrip )
+{
+    const boost::filesystem::path cacheDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+    const std::string originalCacheDirectory = getSphericalHarmonicsCoefficientCacheDirectory( );
+    setSphericalHarmonicsCoefficientCacheDirectory( cacheDirectory.string( ) );
+
+    const int maximumDegree = 120;
+    const int maximumOrder = 80;
+    const std::uint64_t fileHash = 0x0123456789abcdefULL;
+    const Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumOrder + 1 );
+    const Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumOrder + 1 );
+
+    // Check that the cache file depends on all settings.
+    const std::string cacheFilePath = getSphericalHarmonicsCoefficientCacheFilePath(
+                "/some/path/model.txt", fileHash, maximumDegree, maximumOrder, 0, 1 );
+    BOOST_CHECK_EQUAL( boost::filesystem::path( cacheFilePath ).parent_path( ).string( ),
+                       cacheDirectory.string( ) );
+    BOOST_CHECK( cacheFilePath != getSphericalHarmonicsCoefficientCacheFilePath(
+                     "/some/path/model.txt", fileHash + 1, maximumDegree, maximumOrder, 0, 1 ) );
+    BOOST_CHECK( cacheFilePath != getSphericalHarmonicsCoefficientCacheFilePath(
+                     "/some/path/model.txt", fileHash, maximumDegree, maximumOrder + 1, 0, 1 ) );
+    BOOST_CHECK( cacheFilePath != getSphericalHarmonicsCoefficientCacheFilePath(
+                     "/some/path/model.txt", fileHash, maximumDegree, maximumOrder, -1, -1 ) );
+
+    writeSphericalHarmonicsCoefficientCache( cacheFilePath, fileHash, 0, 1, 3.986004418E14, 6378137.0,
+                                             cosineCoefficients, sineCoefficients );
+    BOOST_CHECK( boost::filesystem::exists( cacheFilePath ) );
+
+    // Check that no temporary files remain.
+    BOOST_CHECK_EQUAL( std::distance( boost::filesystem::directory_iterator( cacheDirectory ),
+                                      boost::filesystem::directory_iterator( ) ), 1 );
+
+    {
+        SphericalHarmonicsCoefficientCache coefficientCache( cacheFilePath );
+        BOOST_CHECK( coefficientCache.isCacheOf( fileHash, maximumDegree, maximumOrder, 0, 1 ) );
+        BOOST_CHECK( !coefficientCache.isCacheOf( fileHash + 1, maximumDegree, maximumOrder, 0, 1 ) );
+        BOOST_CHECK( !coefficientCache.isCacheOf( fileHash, maximumDegree - 1, maximumOrder, 0, 1 ) );
+        BOOST_CHECK( !coefficientCache.isCacheOf( fileHash, maximumDegree, maximumOrder, -1, -1 ) );
+
+        BOOST_CHECK_EQUAL( coefficientCache.getMaximumDegree( ), maximumDegree );
+        BOOST_CHECK_EQUAL( coefficientCache.getMaximumOrder( ), maximumOrder );
+        BOOST_CHECK_EQUAL( coefficientCache.getGravitationalParameter( ), 3.986004418E14 );
+        BOOST_CHECK_EQUAL( coefficientCache.getReferenceRadius( ), 6378137.0 );
+
+        // Coefficients must be reproduced exactly.
+        BOOST_CHECK( coefficientCache.getCosineCoefficients( ) == cosineCoefficients );
+        BOOST_CHECK( coefficientCache.getSineCoefficients( ) == sineCoefficients );
+    }
+
+    // Check that an incomplete cache file is rejected.
+    const boost::uintmax_t cacheFileSize = boost::filesystem::file_size( cacheFilePath );
+    boost::filesystem::resize_file( cacheFilePath, cacheFileSize - sizeof( double ) );
+    BOOST_CHECK_THROW( SphericalHarmonicsCoefficientCache coefficientCache( cacheFilePath ), std::runtime_error );
+
+    // Check that a file that is not a cache file is rejected.
+    {
+        std::ofstream invalidFile( cacheFilePath.c_str( ), std::ios::binary | std::ios::trunc );
+        invalidFile << std::string( cacheFileSize, '0' );
+    }
+    BOOST_CHECK_THROW( SphericalHarmonicsCoefficientCache coefficientCache( cacheFilePath ), std::runtime_error );
+
+    // Check that overwriting an existing cache file is supported.
+    writeSphericalHarmonicsCoefficientCache( cacheFilePath, fileHash, 0, 1, 3.986004418E14, 6378137.0,
+                                             cosineCoefficients, sineCoefficients );
+    {
+        SphericalHarmonicsCoefficientCache coefficientCache( cacheFilePath );
+        BOOST_CHECK( coefficientCache.getSineCoefficients( ) == sineCoefficients );
+    }
+
+    // Check that a cache file with modified coefficients is rejected.
+    {
+        std::fstream modifiedFile( cacheFilePath.c_str( ), std::ios::binary | std::ios::in | std::ios::out );
+        const double modifiedCoefficient = sineCoefficients( 2, 0 ) + 1.0E-12;
+        modifiedFile.seekp( static_cast< std::streamoff >( cacheFileSize - sineCoefficients.size( ) * sizeof( double ) +
+                                                           2 * sizeof( double ) ) );
+        modifiedFile.write( reinterpret_cast< const char* >( &modifiedCoefficient ), sizeof( double ) );
+    }
+    BOOST_CHECK_THROW( SphericalHarmonicsCoefficientCache coefficientCache( cacheFilePath ), std::runtime_error );
+
+#if !defined( _WIN32 )
+    // Check that the cache directory is created accessible only to the current user.
+    BOOST_CHECK( isSphericalHarmonicsCoefficientCacheDirectorySafe( cacheDirectory.string( ) ) );
+    BOOST_CHECK( ( boost::filesystem::status( cacheDirectory ).permissions( ) &
+                   ( boost::filesystem::group_all | boost::filesystem::others_all ) ) == 0 );
+
+    // Check that a directory that can be modified by other users is not used.
+    boost::filesystem::permissions( cacheDirectory, boost::filesystem::owner_all | boost::filesystem::others_all );
+    BOOST_CHECK( !isSphericalHarmonicsCoefficientCacheDirectorySafe( cacheDirectory.string( ) ) );
+    BOOST_CHECK( getSphericalHarmonicsCoefficientCacheFilePath(
+                     "/some/path/model.txt", fileHash, maximumDegree, maximumOrder, 0, 1 ).empty( ) );
+    BOOST_CHECK_THROW( writeSphericalHarmonicsCoefficientCache(
+                           cacheFilePath, fileHash, 0, 1, 3.986004418E14, 6378137.0,
+                           cosineCoefficients, sineCoefficients ), std::runtime_error );
+    boost::filesystem::permissions( cacheDirectory, boost::filesystem::owner_all );
+#endif
+
+    // Check that the cache can be disabled.
+    setSphericalHarmonicsCoefficientCacheDirectory( "" );
+    BOOST_CHECK( getSphericalHarmonicsCoefficientCacheFilePath(
+                     "/some/path/model.txt", fileHash, maximumDegree, maximumOrder, 0, 1 ).empty( ) );
+
+    setSphericalHarmonicsCoefficientCacheDirectory( originalCacheDirectory );
+    boost::filesystem::remove_all( cacheDirectory );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
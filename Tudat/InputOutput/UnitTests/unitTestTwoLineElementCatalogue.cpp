@@ -0,0 +1,252 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/stateVectorIndices.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/twoLineElementCatalogue.h"
+#include "Tudat/InputOutput/twoLineElementsTextFileReader.h"
+#include "Tudat/InputOutput/UnitTests/syntheticTwoLineElementCatalogue.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::input_output;
+
+//! Function to check that the data in a catalogue is identical to a list of TwoLineElementData objects.
+void checkCatalogueAgainstTwoLineElementData( const TwoLineElementCatalogue& catalogue,
+                                              const std::vector< TwoLineElementData >& twoLineElementData )
+{
+    BOOST_CHECK_EQUAL( catalogue.getNumberOfRecords( ), twoLineElementData.size( ) );
+    for( unsigned int i = 0; i < std::min< unsigned int >( catalogue.getNumberOfRecords( ),
+                                                           twoLineElementData.size( ) ); i++ )
+    {
+        const TwoLineElementData& expectedData = twoLineElementData.at( i );
+        if( !catalogue.objectName.empty( ) )
+        {
+            BOOST_CHECK_EQUAL( catalogue.objectName.at( i ),
+                               boost::algorithm::trim_right_copy( expectedData.objectNameString ) );
+        }
+        BOOST_CHECK_EQUAL( catalogue.objectIdentificationNumber.at( i ), expectedData.objectIdentificationNumber );
+        BOOST_CHECK_EQUAL( catalogue.tleClassification.at( i ), expectedData.tleClassification );
+        BOOST_CHECK_EQUAL( catalogue.fourDigitLaunchYear.at( i ), expectedData.fourDigitlaunchYear );
+        BOOST_CHECK_EQUAL( catalogue.launchNumber.at( i ), expectedData.launchNumber );
+        BOOST_CHECK_EQUAL( catalogue.launchPart.at( i ), expectedData.launchPart );
+        BOOST_CHECK_EQUAL( catalogue.fourDigitEpochYear.at( i ), expectedData.fourDigitEpochYear );
+        BOOST_CHECK_EQUAL( catalogue.epochDay.at( i ), expectedData.epochDay );
+        BOOST_CHECK_EQUAL( catalogue.firstDerivativeOfMeanMotionDividedByTwo.at( i ),
+                           expectedData.firstDerivativeOfMeanMotionDividedByTwo );
+        BOOST_CHECK_EQUAL( catalogue.secondDerivativeOfMeanMotionDividedBySix.at( i ),
+                           expectedData.secondDerivativeOfMeanMotionDividedBySix );
+        BOOST_CHECK_EQUAL( catalogue.bStar.at( i ), expectedData.bStar );
+        BOOST_CHECK_EQUAL( catalogue.orbitalModel.at( i ), expectedData.orbitalModel );
+        BOOST_CHECK_EQUAL( catalogue.tleNumber.at( i ), expectedData.tleNumber );
+        BOOST_CHECK_EQUAL( catalogue.inclination.at( i ), expectedData.TLEKeplerianElements(
+                               orbital_element_conversions::inclinationIndex ) );
+        BOOST_CHECK_EQUAL( catalogue.rightAscensionOfAscendingNode.at( i ), expectedData.TLEKeplerianElements(
+                               orbital_element_conversions::longitudeOfAscendingNodeIndex ) );
+        BOOST_CHECK_EQUAL( catalogue.eccentricity.at( i ), expectedData.TLEKeplerianElements(
+                               orbital_element_conversions::eccentricityIndex ) );
+        BOOST_CHECK_EQUAL( catalogue.argumentOfPerigee.at( i ), expectedData.TLEKeplerianElements(
+                               orbital_element_conversions::argumentOfPeriapsisIndex ) );
+        BOOST_CHECK_EQUAL( catalogue.meanAnomaly.at( i ), expectedData.meanAnomaly );
+        BOOST_CHECK_EQUAL( catalogue.meanMotionInRevolutionsPerDay.at( i ),
+                           expectedData.meanMotionInRevolutionsPerDay );
+        BOOST_CHECK_EQUAL( catalogue.revolutionNumber.at( i ), expectedData.revolutionNumber );
+
+        // Check conversion to TwoLineElementData
+        TwoLineElementData convertedData = catalogue.getTwoLineElementData( i );
+        BOOST_CHECK_EQUAL( convertedData.launchYear, expectedData.launchYear );
+        BOOST_CHECK_EQUAL( convertedData.epochYear, expectedData.epochYear );
+        BOOST_CHECK_EQUAL( convertedData.perigee, expectedData.perigee );
+        BOOST_CHECK_EQUAL( convertedData.apogee, expectedData.apogee );
+        BOOST_CHECK_EQUAL( convertedData.TLEKeplerianElements( orbital_element_conversions::semiMajorAxisIndex ),
+                           expectedData.TLEKeplerianElements( orbital_element_conversions::semiMajorAxisIndex ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE( test_two_line_element_catalogue )
+
+//! Test parsing of (partly corrupted) catalogues in two- and three-line format, against TwoLineElementsTextFileReader.
+BOOST_AUTO_TEST_CASE( testTwoLineElementCatalogueAgainstTextFileReader )
+{
+    const std::string directoryPath = getTudatRootPath( ) + "InputOutput/UnitTests/";
+    for( int lineNumberType = 0; lineNumberType < 2; lineNumberType++ )
+    {
+        TwoLineElementsTextFileReader::LineNumberTypesForTwoLineElementInputData currentLineNumberType =
+                ( lineNumberType == 0 ) ? TwoLineElementsTextFileReader::twoLineType :
+                                          TwoLineElementsTextFileReader::threeLineType;
+        std::string fileName = ( lineNumberType == 0 ) ? "testTwoLineElementsTextFile2Line.txt" :
+                                                         "testTwoLineElementsTextFile3Line.txt";
+
+        std::multimap< int, std::string > expectedErrors;
+        std::vector< TwoLineElementData > expectedData = readTwoLineElementFileWithTextFileReader(
+                    directoryPath, fileName, currentLineNumberType, expectedErrors );
+
+        for( unsigned int numberOfThreads = 1; numberOfThreads <= 2; numberOfThreads++ )
+        {
+            TwoLineElementCatalogue catalogue = readTwoLineElementCatalogue(
+                        directoryPath + fileName, currentLineNumberType, numberOfThreads );
+
+            // Test input file contains 7 corrupted TLEs, which should be identified and removed.
+            BOOST_CHECK_EQUAL( catalogue.getNumberOfRecords( ), 3 );
+            checkCatalogueAgainstTwoLineElementData( catalogue, expectedData );
+
+            // Check that all errors of the text file reader are found.
+            for( std::multimap< int, std::string >::const_iterator errorIterator = expectedErrors.begin( );
+                 errorIterator != expectedErrors.end( ); errorIterator++ )
+            {
+                bool isErrorFound = false;
+                std::pair< std::multimap< int, std::string >::const_iterator,
+                        std::multimap< int, std::string >::const_iterator > recordErrors =
+                        catalogue.corruptedRecordErrors.equal_range( errorIterator->first );
+                for( std::multimap< int, std::string >::const_iterator recordErrorIterator = recordErrors.first;
+                     recordErrorIterator != recordErrors.second; recordErrorIterator++ )
+                {
+                    if( recordErrorIterator->second == errorIterator->second )
+                    {
+                        isErrorFound = true;
+                    }
+                }
+                BOOST_CHECK( isErrorFound );
+            }
+
+            // Check data and line number of a specific record
+            BOOST_CHECK_EQUAL( catalogue.lineNumber.at( 2 ), 1 + 9 * ( lineNumberType + 2 ) );
+            BOOST_CHECK_EQUAL( catalogue.revolutionNumber.at( 2 ), 57038 );
+
+            // Check that corrupted records are retained if requested.
+            catalogue = readTwoLineElementCatalogue( directoryPath + fileName, currentLineNumberType,
+                                                     numberOfThreads, false );
+            BOOST_CHECK_EQUAL( catalogue.getNumberOfRecords( ), 10 );
+            BOOST_CHECK_EQUAL( catalogue.objectIdentificationNumber.at( 8 ), 37235 );
+            BOOST_CHECK_EQUAL( catalogue.inclination.at( 8 ), 24.6237 );
+        }
+    }
+
+    // Check that a non-existing file is caught.
+    BOOST_CHECK_THROW( readTwoLineElementCatalogue( directoryPath + "nonExistingFile.txt",
+                                                    TwoLineElementsTextFileReader::twoLineType ),
+                       std::runtime_error );
+}
+
+//! Test parsing of records with invalid lengths and fields, and of incomplete records.
+BOOST_AUTO_TEST_CASE( testTwoLineElementCatalogueInvalidRecords )
+{
+    std::string catalogueString =
+            "1 00005U 58002B   11010.22613693  .00000290  00000-0  36608-3 0  7125\r\n"
+            "2 00005  34.2587  38.6665 1850627 332.9238  18.5535 10.84016246831189\r\n"
+            "\r\n"
+            "1 00005U 58002B   11010.22613693  .00000290  00000-0  36608-3 0  712\n"
+            "2 00005  34.2587  38.6665 1850627 332.9238  18.5535 10.84016246831189\n"
+            "1 00005U 58002B   11010.2261369X  .00000290  00000-0  36608-3 0  7125\n"
+            "2 00005  34.2587  38.6665 1850627 332.9238  18.5535 10.84016246831189\n"
+            "1 00005U 58002B   11010.22613693  .00000290  00000-0  36608-3 0  7125\n";
+
+    TwoLineElementCatalogue catalogue = parseTwoLineElementCatalogue(
+                catalogueString.data( ), catalogueString.size( ), TwoLineElementsTextFileReader::twoLineType );
+
+    BOOST_CHECK_EQUAL( catalogue.getNumberOfRecords( ), 1 );
+    BOOST_CHECK_EQUAL( catalogue.lineNumber.at( 0 ), 1 );
+    BOOST_CHECK_SMALL( catalogue.epochJulianDay.at( 0 ) - ( 2455562.5 + 10.22613693 - 1.0 ), 1.0E-8 );
+
+    BOOST_CHECK_EQUAL( catalogue.corruptedRecordErrors.count( 0 ), 0 );
+    BOOST_CHECK_EQUAL( catalogue.corruptedRecordErrors.find( 1 )->second, "Incorrect line length." );
+    BOOST_CHECK_EQUAL( catalogue.corruptedRecordErrors.count( 2 ), 2 );
+    BOOST_CHECK_EQUAL( catalogue.corruptedRecordErrors.find( 3 )->second, "Incomplete record." );
+}
+
+//! Test parsing of a synthetic catalogue against TwoLineElementsTextFileReader, from file and from memory, using
+//! different numbers of threads.
+BOOST_AUTO_TEST_CASE( testTwoLineElementCatalogueSyntheticCatalogue )
+{
+    const int numberOfRecords = 20000;
+    const int numberOfRecordsForTextFileReader = 2000;
+    const unsigned int maximumNumberOfThreads = std::max( std::thread::hardware_concurrency( ), 2u );
+
+    // Write synthetic catalogues to temporary files.
+    std::string catalogueString = createSyntheticTwoLineElementCatalogue( numberOfRecords, 1 );
+    boost::filesystem::path temporaryDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+    boost::filesystem::create_directories( temporaryDirectory );
+    {
+        std::ofstream catalogueFile( ( temporaryDirectory / "catalogue.txt" ).string( ), std::ios::binary );
+        catalogueFile << catalogueString;
+        std::ofstream smallCatalogueFile( ( temporaryDirectory / "smallCatalogue.txt" ).string( ),
+                                          std::ios::binary );
+        smallCatalogueFile << createSyntheticTwoLineElementCatalogue( numberOfRecordsForTextFileReader, 1 );
+    }
+
+    // Parse small catalogue with both readers, and compare results.
+    std::multimap< int, std::string > expectedErrors;
+    std::vector< TwoLineElementData > expectedData = readTwoLineElementFileWithTextFileReader(
+                temporaryDirectory.string( ) + "/", "smallCatalogue.txt",
+                TwoLineElementsTextFileReader::threeLineType, expectedErrors );
+
+    TwoLineElementCatalogue smallCatalogue = readTwoLineElementCatalogue(
+                ( temporaryDirectory / "smallCatalogue.txt" ).string( ), TwoLineElementsTextFileReader::threeLineType );
+    BOOST_CHECK_EQUAL( expectedErrors.size( ), 0 );
+    BOOST_CHECK_EQUAL( smallCatalogue.corruptedRecordErrors.size( ), 0 );
+    checkCatalogueAgainstTwoLineElementData( smallCatalogue, expectedData );
+
+    // Parse full catalogue from file and from memory, using different numbers of threads.
+    std::vector< TwoLineElementCatalogue > catalogues;
+    for( unsigned int numberOfThreads: { 1u, maximumNumberOfThreads } )
+    {
+        catalogues.push_back( readTwoLineElementCatalogue(
+                                  ( temporaryDirectory / "catalogue.txt" ).string( ),
+                                  TwoLineElementsTextFileReader::threeLineType, numberOfThreads ) );
+    }
+    catalogues.push_back( parseTwoLineElementCatalogue(
+                              catalogueString.data( ), catalogueString.size( ),
+                              TwoLineElementsTextFileReader::threeLineType, maximumNumberOfThreads ) );
+
+    for( unsigned int i = 0; i < catalogues.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( catalogues.at( i ).getNumberOfRecords( ), numberOfRecords );
+        BOOST_CHECK_EQUAL( catalogues.at( i ).corruptedRecordErrors.size( ), 0 );
+        if( i > 0 )
+        {
+            BOOST_CHECK( catalogues.at( i ).objectName == catalogues.at( 0 ).objectName );
+            BOOST_CHECK( catalogues.at( i ).lineNumber == catalogues.at( 0 ).lineNumber );
+            BOOST_CHECK( catalogues.at( i ).epochDay == catalogues.at( 0 ).epochDay );
+            BOOST_CHECK( catalogues.at( i ).bStar == catalogues.at( 0 ).bStar );
+            BOOST_CHECK( catalogues.at( i ).meanMotionInRevolutionsPerDay ==
+                         catalogues.at( 0 ).meanMotionInRevolutionsPerDay );
+        }
+    }
+
+    // Records of small catalogue are identical to first records of full catalogue.
+    for( unsigned int i = 0; i < smallCatalogue.getNumberOfRecords( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( smallCatalogue.inclination.at( i ), catalogues.at( 0 ).inclination.at( i ) );
+    }
+
+    boost::filesystem::remove_all( temporaryDirectory );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -8,6 +8,9 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#ifndef TUDAT_AERODYNAMIC_COEFFICIENT_READER_H
+#define TUDAT_AERODYNAMIC_COEFFICIENT_READER_H
+
 #include <map>
 #include "Tudat/Basics/utilities.h"
 
@@ -30,9 +33,9 @@ namespace input_output
  */
 template< unsigned int NumberOfDimensions >
 boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) > mergeNDimensionalCoefficients(
-        boost::multi_array< double, static_cast< size_t >( NumberOfDimensions ) > xComponents,
-        boost::multi_array< double, static_cast< size_t >( NumberOfDimensions ) > yComponents,
-        boost::multi_array< double, static_cast< size_t >( NumberOfDimensions ) > zComponents )
+        const boost::multi_array< double, static_cast< size_t >( NumberOfDimensions ) >& xComponents,
+        const boost::multi_array< double, static_cast< size_t >( NumberOfDimensions ) >& yComponents,
+        const boost::multi_array< double, static_cast< size_t >( NumberOfDimensions ) >& zComponents )
 {
     boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) > vectorArray;
 
@@ -54,28 +57,18 @@ boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions )
     // Resize coefficient multi-array
     vectorArray.resize( sizeVector );
 
-    // Iterate over all elements and combine x,y and z-components into vector3d of associated entry in vectorVector
-    int numberOfEntries = xComponents.num_elements( );
-    Eigen::Vector3d* vectorVector = new Eigen::Vector3d[ numberOfEntries ] ;
-
-    typedef typename boost::multi_array< double, NumberOfDimensions >::index tIndex;
-    typedef boost::array< tIndex, NumberOfDimensions > tIndexArray;
-
-    double* p = xComponents.data( );
-    tIndexArray index;
-    for( int i = 0; i < numberOfEntries; i++ )
+    // Iterate over all elements and combine x,y and z-components into vector3d of associated entry. All multi-arrays
+    // have the same shape and (default) storage order, so that entries with equal index in memory correspond.
+    const size_t numberOfEntries = xComponents.num_elements( );
+    const double* xData = xComponents.data( );
+    const double* yData = yComponents.data( );
+    const double* zData = zComponents.data( );
+    Eigen::Vector3d* vectorData = vectorArray.data( );
+    for( size_t i = 0; i < numberOfEntries; i++ )
     {
-        index = utilities::getMultiArrayIndexArray( xComponents, p );
-
-        vectorVector[ i ] = ( Eigen::Vector3d( ) << xComponents( index ), yComponents( index ), zComponents( index ) ).finished( );
-        ++p;
+        vectorData[ i ] << xData[ i ], yData[ i ], zData[ i ];
     }
 
-    // Assign array of entries to output multi-array
-    vectorArray.assign( vectorVector, vectorVector + numberOfEntries );
-
-    delete[ ] vectorVector;
-
     return vectorArray;
 }
 
@@ -213,3 +206,5 @@ readAerodynamicCoefficients( const std::map< int, std::string >& fileNames )
 } // namespace input_output
 
 } // namespace tudat
+
+#endif // TUDAT_AERODYNAMIC_COEFFICIENT_READER_H
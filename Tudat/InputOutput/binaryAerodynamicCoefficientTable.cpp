@@ -0,0 +1,179 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+
+#include "Tudat/InputOutput/binaryAerodynamicCoefficientTable.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Identifier at start of binary aerodynamic coefficient table file.
+static const char aerodynamicCoefficientTableFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'A', 'C', 'T' };
+
+//! Version of binary aerodynamic coefficient table file format.
+static const std::uint32_t aerodynamicCoefficientTableFileVersion = 1;
+
+static_assert( sizeof( Eigen::Vector3d ) == 3 * sizeof( double ),
+               "Eigen::Vector3d can not be mapped directly on binary aerodynamic coefficient table" );
+
+//! Function to write a table of aerodynamic coefficients to a binary file.
+void writeBinaryAerodynamicCoefficientTable(
+        const std::string& filePath,
+        const std::vector< std::vector< double > >& independentVariables,
+        const Eigen::Vector3d* coefficients,
+        const std::size_t numberOfEntries )
+{
+    // Check input consistency
+    std::size_t expectedNumberOfEntries = 1;
+    for( unsigned int i = 0; i < independentVariables.size( ); i++ )
+    {
+        expectedNumberOfEntries *= independentVariables.at( i ).size( );
+    }
+    if( independentVariables.size( ) == 0 || expectedNumberOfEntries != numberOfEntries )
+    {
+        throw std::runtime_error( "Error when writing binary aerodynamic coefficient table, inconsistent number of "
+                                  "coefficients" );
+    }
+
+    // Create directory (if it does not exist)
+    const boost::filesystem::path outputPath( filePath );
+    if( outputPath.has_parent_path( ) && !boost::filesystem::exists( outputPath.parent_path( ) ) )
+    {
+        boost::filesystem::create_directories( outputPath.parent_path( ) );
+    }
+
+    std::ofstream outputFile( filePath.c_str( ), std::ios::binary );
+    if( !outputFile )
+    {
+        throw std::runtime_error( "Error when writing binary aerodynamic coefficient table, file " + filePath +
+                                  " could not be opened" );
+    }
+
+    // Write header
+    const std::uint32_t numberOfDimensions = static_cast< std::uint32_t >( independentVariables.size( ) );
+    outputFile.write( aerodynamicCoefficientTableFileIdentifier, sizeof( aerodynamicCoefficientTableFileIdentifier ) );
+    outputFile.write( reinterpret_cast< const char* >( &aerodynamicCoefficientTableFileVersion ),
+                      sizeof( std::uint32_t ) );
+    outputFile.write( reinterpret_cast< const char* >( &numberOfDimensions ), sizeof( std::uint32_t ) );
+    for( unsigned int i = 0; i < numberOfDimensions; i++ )
+    {
+        const std::uint64_t currentSize = independentVariables.at( i ).size( );
+        outputFile.write( reinterpret_cast< const char* >( &currentSize ), sizeof( std::uint64_t ) );
+    }
+
+    // Write independent variables and coefficients
+    for( unsigned int i = 0; i < numberOfDimensions; i++ )
+    {
+        outputFile.write( reinterpret_cast< const char* >( independentVariables.at( i ).data( ) ),
+                          independentVariables.at( i ).size( ) * sizeof( double ) );
+    }
+    outputFile.write( reinterpret_cast< const char* >( coefficients ), numberOfEntries * sizeof( Eigen::Vector3d ) );
+
+    outputFile.close( );
+    if( !outputFile )
+    {
+        throw std::runtime_error( "Error when writing binary aerodynamic coefficient table, file " + filePath +
+                                  " could not be written" );
+    }
+}
+
+//! Function to parse the header and independent variables of a memory-mapped binary aerodynamic coefficient table.
+const Eigen::Vector3d* parseBinaryAerodynamicCoefficientTable(
+        const ReadOnlyFileMapping& fileMapping,
+        const std::string& filePath,
+        const unsigned int numberOfDimensions,
+        std::vector< std::vector< double > >& independentVariables )
+{
+    const char* fileData = fileMapping.getData( );
+    const std::size_t fileSize = fileMapping.getDataSize( );
+
+    // Check file identifier and version
+    std::size_t currentOffset = sizeof( aerodynamicCoefficientTableFileIdentifier ) + 2 * sizeof( std::uint32_t );
+    if( fileSize < currentOffset )
+    {
+        throw std::runtime_error( "Error when reading binary aerodynamic coefficient table, file " + filePath +
+                                  " is incomplete" );
+    }
+    if( std::memcmp( fileData, aerodynamicCoefficientTableFileIdentifier,
+                     sizeof( aerodynamicCoefficientTableFileIdentifier ) ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading binary aerodynamic coefficient table, file " + filePath +
+                                  " is not a binary aerodynamic coefficient table" );
+    }
+
+    std::uint32_t fileVersion, fileNumberOfDimensions;
+    std::memcpy( &fileVersion, fileData + sizeof( aerodynamicCoefficientTableFileIdentifier ),
+                 sizeof( std::uint32_t ) );
+    std::memcpy( &fileNumberOfDimensions,
+                 fileData + sizeof( aerodynamicCoefficientTableFileIdentifier ) + sizeof( std::uint32_t ),
+                 sizeof( std::uint32_t ) );
+    if( fileVersion != aerodynamicCoefficientTableFileVersion )
+    {
+        throw std::runtime_error( "Error when reading binary aerodynamic coefficient table, file " + filePath +
+                                  " has unsupported version " + std::to_string( fileVersion ) );
+    }
+    if( fileNumberOfDimensions != numberOfDimensions )
+    {
+        throw std::runtime_error( "Error when reading binary aerodynamic coefficient table, file " + filePath +
+                                  " has " + std::to_string( fileNumberOfDimensions ) +
+                                  " independent variables, expected " + std::to_string( numberOfDimensions ) );
+    }
+
+    // Read sizes of independent variables
+    if( fileSize < currentOffset + numberOfDimensions * sizeof( std::uint64_t ) )
+    {
+        throw std::runtime_error( "Error when reading binary aerodynamic coefficient table, file " + filePath +
+                                  " is incomplete" );
+    }
+    std::vector< std::uint64_t > independentVariableSizes( numberOfDimensions );
+    std::memcpy( independentVariableSizes.data( ), fileData + currentOffset,
+                 numberOfDimensions * sizeof( std::uint64_t ) );
+    currentOffset += numberOfDimensions * sizeof( std::uint64_t );
+
+    std::uint64_t numberOfIndependentVariableValues = 0;
+    std::uint64_t numberOfEntries = 1;
+    for( unsigned int i = 0; i < numberOfDimensions; i++ )
+    {
+        numberOfIndependentVariableValues += independentVariableSizes.at( i );
+        numberOfEntries *= independentVariableSizes.at( i );
+    }
+    if( fileSize != currentOffset + numberOfIndependentVariableValues * sizeof( double ) +
+            numberOfEntries * sizeof( Eigen::Vector3d ) )
+    {
+        throw std::runtime_error( "Error when reading binary aerodynamic coefficient table, file " + filePath +
+                                  " is incomplete" );
+    }
+
+    // Read independent variables
+    independentVariables.resize( numberOfDimensions );
+    for( unsigned int i = 0; i < numberOfDimensions; i++ )
+    {
+        independentVariables[ i ].resize( independentVariableSizes.at( i ) );
+        std::memcpy( independentVariables[ i ].data( ), fileData + currentOffset,
+                     independentVariableSizes.at( i ) * sizeof( double ) );
+        currentOffset += independentVariableSizes.at( i ) * sizeof( double );
+    }
+
+    // Coefficients are aligned, as mapped file starts at page boundary and header size is a multiple of 8.
+    return reinterpret_cast< const Eigen::Vector3d* >( fileData + currentOffset );
+}
+
+} // namespace input_output
+
+} // namespace tudat
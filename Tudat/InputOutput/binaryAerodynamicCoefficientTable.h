@@ -0,0 +1,217 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BINARY_AERODYNAMIC_COEFFICIENT_TABLE_H
+#define TUDAT_BINARY_AERODYNAMIC_COEFFICIENT_TABLE_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/multi_array.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/InputOutput/aerodynamicCoefficientReader.h"
+#include "Tudat/InputOutput/readOnlyFileMapping.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Function to write a table of aerodynamic coefficients to a binary file.
+/*!
+ *  Function to write a table of aerodynamic coefficients to a binary file. The file consists of a header (file
+ *  identifier, format version, number of independent variables and number of data points for each independent
+ *  variable), followed by the values of the independent variables and the coefficients as raw doubles. The coefficients
+ *  are stored in the storage order of boost::multi_array (last index varying fastest), three doubles per entry, so that
+ *  the file can be mapped into memory and used directly (see MappedAerodynamicCoefficientTable). As the data is stored
+ *  in the native binary representation, files are not portable between platforms with different endianness.
+ *  \param filePath Path of binary file.
+ *  \param independentVariables List of independent variables at which coefficients are defined.
+ *  \param coefficients Pointer to first entry of the coefficients.
+ *  \param numberOfEntries Number of entries in the coefficient table (product of independent variable sizes).
+ */
+void writeBinaryAerodynamicCoefficientTable(
+        const std::string& filePath,
+        const std::vector< std::vector< double > >& independentVariables,
+        const Eigen::Vector3d* coefficients,
+        const std::size_t numberOfEntries );
+
+//! Function to write a table of aerodynamic coefficients to a binary file.
+/*!
+ *  Function to write a table of aerodynamic coefficients to a binary file, see non-templated function for details.
+ *  \param filePath Path of binary file.
+ *  \param independentVariables List of independent variables at which coefficients are defined.
+ *  \param coefficients Multi-array of aerodynamic coefficients.
+ */
+template< unsigned int NumberOfDimensions >
+void writeBinaryAerodynamicCoefficientTable(
+        const std::string& filePath,
+        const std::vector< std::vector< double > >& independentVariables,
+        const boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) >& coefficients )
+{
+    if( independentVariables.size( ) != NumberOfDimensions )
+    {
+        throw std::runtime_error( "Error when writing binary aerodynamic coefficient table, inconsistent number of "
+                                  "independent variables" );
+    }
+    for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+    {
+        if( independentVariables.at( i ).size( ) != coefficients.shape( )[ i ] )
+        {
+            throw std::runtime_error( "Error when writing binary aerodynamic coefficient table, inconsistent size of "
+                                      "independent variable " + std::to_string( i ) );
+        }
+    }
+
+    writeBinaryAerodynamicCoefficientTable( filePath, independentVariables, coefficients.data( ),
+                                            coefficients.num_elements( ) );
+}
+
+//! Function to convert a set of aerodynamic coefficient text files to a binary file.
+/*!
+ *  Function to convert a set of aerodynamic coefficient text files (as read by readAerodynamicCoefficients) to a single
+ *  binary file (see writeBinaryAerodynamicCoefficientTable).
+ *  \param fileNames Map of file names, with the key  required to be 0, 1 and/or 2. These indices denote the  x-, y- and
+ *  z-components of the aerodynamic coefficients (components not in the map are set to zero).
+ *  \param binaryFilePath Path of binary file that is to be created.
+ */
+template< unsigned int NumberOfDimensions >
+void convertAerodynamicCoefficientFilesToBinary( const std::map< int, std::string >& fileNames,
+                                                 const std::string& binaryFilePath )
+{
+    std::pair< boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) >,
+            std::vector< std::vector< double > > > aerodynamicCoefficients =
+            readAerodynamicCoefficients< NumberOfDimensions >( fileNames );
+    writeBinaryAerodynamicCoefficientTable< NumberOfDimensions >(
+                binaryFilePath, aerodynamicCoefficients.second, aerodynamicCoefficients.first );
+}
+
+//! Function to parse the header and independent variables of a memory-mapped binary aerodynamic coefficient table.
+/*!
+ *  Function to parse the header and independent variables of a memory-mapped binary aerodynamic coefficient table,
+ *  checking the consistency of the file.
+ *  \param fileMapping Mapping of binary file.
+ *  \param filePath Path of binary file (used in error messages).
+ *  \param numberOfDimensions Expected number of independent variables.
+ *  \param independentVariables List of independent variables at which coefficients are defined (returned by
+ *  reference).
+ *  \return Pointer to the first coefficient in the mapped file.
+ */
+const Eigen::Vector3d* parseBinaryAerodynamicCoefficientTable(
+        const ReadOnlyFileMapping& fileMapping,
+        const std::string& filePath,
+        const unsigned int numberOfDimensions,
+        std::vector< std::vector< double > >& independentVariables );
+
+//! Class providing access to a memory-mapped binary aerodynamic coefficient table.
+/*!
+ *  Class providing access to a memory-mapped binary aerodynamic coefficient table (see
+ *  writeBinaryAerodynamicCoefficientTable). The coefficients are not copied, but accessed through a
+ *  boost::const_multi_array_ref on the mapped file, so that the table is loaded on demand by the operating system, and
+ *  shared (through the page cache) by all processes using the same file. The view on the coefficients can be provided
+ *  directly to a MultiLinearInterpolator.
+ */
+template< unsigned int NumberOfDimensions >
+class MappedAerodynamicCoefficientTable
+{
+public:
+
+    //! Typedef for the (read-only) view on the coefficients.
+    typedef boost::const_multi_array_ref< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) >
+    CoefficientArrayView;
+
+    //! Constructor, maps the binary file and checks its consistency.
+    /*!
+     * Constructor, maps the binary file and checks its consistency.
+     * \param filePath Path of binary file.
+     */
+    MappedAerodynamicCoefficientTable( const std::string& filePath )
+    {
+        std::shared_ptr< ReadOnlyFileMapping > fileMapping =
+                std::make_shared< ReadOnlyFileMapping >( filePath, false );
+        const Eigen::Vector3d* coefficientData = parseBinaryAerodynamicCoefficientTable(
+                    *fileMapping, filePath, NumberOfDimensions, independentVariables_ );
+
+        boost::array< size_t, NumberOfDimensions > coefficientArrayShape;
+        for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            coefficientArrayShape[ i ] = independentVariables_.at( i ).size( );
+        }
+
+        // Create view, which keeps the file mapping alive for as long as it is in use.
+        coefficients_ = std::shared_ptr< const CoefficientArrayView >(
+                    new CoefficientArrayView( coefficientData, coefficientArrayShape ),
+                    [ fileMapping ]( const CoefficientArrayView* view ){ delete view; } );
+    }
+
+    //! Function to retrieve the list of independent variables at which coefficients are defined.
+    const std::vector< std::vector< double > >& getIndependentVariables( ) const
+    {
+        return independentVariables_;
+    }
+
+    //! Function to retrieve the view on the coefficients.
+    /*!
+     * Function to retrieve the view on the coefficients. The mapped file remains valid for as long as the returned
+     * pointer (or a copy of it) exists, also after this object is destroyed.
+     * \return View on the coefficients.
+     */
+    std::shared_ptr< const CoefficientArrayView > getCoefficients( ) const
+    {
+        return coefficients_;
+    }
+
+    //! Function to retrieve a copy of the coefficients.
+    boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) > getCoefficientsCopy( ) const
+    {
+        boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) > coefficientsCopy(
+                    reinterpret_cast< boost::array< size_t, NumberOfDimensions > const& >( *coefficients_->shape( ) ) );
+        coefficientsCopy = *coefficients_;
+        return coefficientsCopy;
+    }
+
+private:
+
+    //! List of independent variables at which coefficients are defined.
+    std::vector< std::vector< double > > independentVariables_;
+
+    //! View on the coefficients in the mapped file.
+    std::shared_ptr< const CoefficientArrayView > coefficients_;
+};
+
+//! Function to read aerodynamic coefficients and associated independent variables from a binary file.
+/*!
+ *  Function to read aerodynamic coefficients and associated independent variables from a binary file (see
+ *  writeBinaryAerodynamicCoefficientTable), in the same form as readAerodynamicCoefficients. The coefficients are
+ *  copied from the mapped file; use MappedAerodynamicCoefficientTable to access them without copying.
+ *  \param filePath Path of binary file.
+ *  \return  Pair: first entry containing multi-array of aerodynamic coefficients, second containing list of independent
+ *  variables at which coefficients are defined.
+ */
+template< unsigned int NumberOfDimensions >
+std::pair< boost::multi_array< Eigen::Vector3d, static_cast< size_t >( NumberOfDimensions ) >,
+std::vector< std::vector< double > > >
+readBinaryAerodynamicCoefficients( const std::string& filePath )
+{
+    MappedAerodynamicCoefficientTable< NumberOfDimensions > coefficientTable( filePath );
+    return std::make_pair( coefficientTable.getCoefficientsCopy( ), coefficientTable.getIndependentVariables( ) );
+}
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_BINARY_AERODYNAMIC_COEFFICIENT_TABLE_H
@@ -0,0 +1,89 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <fstream>
+#include <stdexcept>
+
+#if !defined( _WIN32 )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Tudat/InputOutput/readOnlyFileMapping.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Constructor, maps (or reads) the contents of the file.
+ReadOnlyFileMapping::ReadOnlyFileMapping( const std::string& filePath, const bool isAccessSequential ):
+    data_( nullptr ), dataSize_( 0 ), isMapped_( false )
+{
+#if !defined( _WIN32 )
+    int fileDescriptor = open( filePath.c_str( ), O_RDONLY );
+    if( fileDescriptor < 0 )
+    {
+        throw std::runtime_error( "Data file could not be opened: " + filePath );
+    }
+
+    struct stat fileStatus;
+    if( fstat( fileDescriptor, &fileStatus ) != 0 )
+    {
+        close( fileDescriptor );
+        throw std::runtime_error( "Data file could not be accessed: " + filePath );
+    }
+
+    dataSize_ = static_cast< std::size_t >( fileStatus.st_size );
+    if( dataSize_ > 0 )
+    {
+        void* mappedData = mmap( nullptr, dataSize_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+        if( mappedData != MAP_FAILED )
+        {
+            madvise( mappedData, dataSize_, isAccessSequential ? MADV_SEQUENTIAL : MADV_RANDOM );
+            data_ = static_cast< const char* >( mappedData );
+            isMapped_ = true;
+        }
+    }
+    close( fileDescriptor );
+
+    if( isMapped_ || dataSize_ == 0 )
+    {
+        return;
+    }
+#endif
+    // Read file in single block if it could not be mapped.
+    std::ifstream dataFile( filePath.c_str( ), std::ios::binary | std::ios::ate );
+    if( !dataFile )
+    {
+        throw std::runtime_error( "Data file could not be opened: " + filePath );
+    }
+    dataSize_ = static_cast< std::size_t >( dataFile.tellg( ) );
+    fileContents_.resize( dataSize_ );
+    dataFile.seekg( 0 );
+    dataFile.read( fileContents_.data( ), dataSize_ );
+    data_ = fileContents_.data( );
+}
+
+//! Destructor, unmaps the file.
+ReadOnlyFileMapping::~ReadOnlyFileMapping( )
+{
+#if !defined( _WIN32 )
+    if( isMapped_ )
+    {
+        munmap( const_cast< char* >( data_ ), dataSize_ );
+    }
+#endif
+}
+
+} // namespace input_output
+} // namespace tudat
@@ -0,0 +1,87 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_READ_ONLY_FILE_MAPPING_H
+#define TUDAT_READ_ONLY_FILE_MAPPING_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Class to provide read-only access to the contents of a file, which is memory-mapped if supported by the platform.
+/*!
+ *  Class to provide read-only access to the contents of a file, which is memory-mapped if supported by the platform
+ *  (POSIX systems). A mapped file is paged in by the operating system when accessed, and its pages are shared (through
+ *  the page cache) by all processes mapping the same file. On other platforms, the file is read in a single block.
+ */
+class ReadOnlyFileMapping
+{
+public:
+
+    //! Constructor, maps (or reads) the contents of the file.
+    /*!
+     * Constructor, maps (or reads) the contents of the file.
+     * \param filePath Path to file.
+     * \param isAccessSequential Boolean denoting whether the file is (mostly) accessed sequentially, or randomly (used
+     * as a hint to the operating system for reading ahead).
+     */
+    ReadOnlyFileMapping( const std::string& filePath, const bool isAccessSequential = true );
+
+    //! Destructor, unmaps the file.
+    ~ReadOnlyFileMapping( );
+
+    //! Function to retrieve pointer to the first character of the file.
+    const char* getData( ) const
+    {
+        return data_;
+    }
+
+    //! Function to retrieve the number of characters in the file.
+    std::size_t getDataSize( ) const
+    {
+        return dataSize_;
+    }
+
+    //! Function to retrieve whether the file is memory-mapped (or read into memory).
+    bool isMapped( ) const
+    {
+        return isMapped_;
+    }
+
+private:
+
+    //! Copy constructor (deleted, file mapping can not be shared)
+    ReadOnlyFileMapping( const ReadOnlyFileMapping& );
+
+    //! Assignment operator (deleted, file mapping can not be shared)
+    ReadOnlyFileMapping& operator=( const ReadOnlyFileMapping& );
+
+    //! Pointer to first character of file.
+    const char* data_;
+
+    //! Number of characters in file.
+    std::size_t dataSize_;
+
+    //! Boolean denoting whether file is memory-mapped.
+    bool isMapped_;
+
+    //! Contents of file, if it is not memory-mapped.
+    std::vector< char > fileContents_;
+};
+
+} // namespace input_output
+} // namespace tudat
+
+#endif // TUDAT_READ_ONLY_FILE_MAPPING_H
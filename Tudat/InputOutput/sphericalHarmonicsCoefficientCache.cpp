@@ -0,0 +1,315 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#if !defined( _WIN32 )
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <boost/filesystem.hpp>
+
+#include "Tudat/InputOutput/sphericalHarmonicsCoefficientCache.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Identifier at start of spherical harmonics coefficient cache file.
+static const char sphericalHarmonicsCacheFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'S', 'H', 'C' };
+
+//! Version of spherical harmonics coefficient cache file format.
+static const std::uint32_t sphericalHarmonicsCacheFileVersion = 2;
+
+//! Header of spherical harmonics coefficient cache file (size is a multiple of 8, so that coefficients are aligned).
+struct SphericalHarmonicsCacheFileHeader
+{
+    char fileIdentifier[ 8 ];
+    std::uint32_t fileVersion;
+    std::int32_t maximumDegree;
+    std::int32_t maximumOrder;
+    std::int32_t gravitationalParameterIndex;
+    std::int32_t referenceRadiusIndex;
+    std::uint32_t reserved;
+    std::uint64_t gravityFieldFileHash;
+    std::uint64_t coefficientDataHash;
+    double gravitationalParameter;
+    double referenceRadius;
+};
+
+static_assert( sizeof( SphericalHarmonicsCacheFileHeader ) == 64,
+               "Unexpected padding in spherical harmonics cache file header" );
+
+//! Function to compute the checksum of the cosine and sine coefficients stored in a cache file.
+std::uint64_t computeCoefficientDataHash( const double* cosineCoefficients, const double* sineCoefficients,
+                                          const std::size_t numberOfCoefficients )
+{
+    const std::size_t dataSize = numberOfCoefficients * sizeof( double );
+    const std::uint64_t cosineHash =
+            utilities::computeDataContentHash( reinterpret_cast< const char* >( cosineCoefficients ), dataSize );
+    const std::uint64_t sineHash =
+            utilities::computeDataContentHash( reinterpret_cast< const char* >( sineCoefficients ), dataSize );
+    return cosineHash ^ ( ( sineHash << 1 ) | ( sineHash >> 63 ) );
+}
+
+//! Function to compute the hash of the contents of a file.
+std::uint64_t computeFileContentHash( const std::string& filePath )
+{
+    ReadOnlyFileMapping fileMapping( filePath );
+    return utilities::computeDataContentHash( fileMapping.getData( ), fileMapping.getDataSize( ) );
+}
+
+//! Function to retrieve (modifiable) directory in which spherical harmonics coefficient cache files are stored.
+std::string& getModifiableSphericalHarmonicsCoefficientCacheDirectory( )
+{
+    static std::string cacheDirectory = "";
+    return cacheDirectory;
+}
+
+//! Function to retrieve the default per-user directory for spherical harmonics coefficient cache files.
+std::string getDefaultSphericalHarmonicsCoefficientCacheDirectory( )
+{
+    boost::filesystem::path userCacheDirectory;
+    const char* xdgCacheHome = std::getenv( "XDG_CACHE_HOME" );
+    if( xdgCacheHome != nullptr && boost::filesystem::path( xdgCacheHome ).is_absolute( ) )
+    {
+        userCacheDirectory = xdgCacheHome;
+    }
+    else
+    {
+#if defined( _WIN32 )
+        const char* homeDirectory = std::getenv( "LOCALAPPDATA" );
+#else
+        const char* homeDirectory = std::getenv( "HOME" );
+#endif
+        if( homeDirectory == nullptr || std::string( homeDirectory ).empty( ) )
+        {
+            return "";
+        }
+#if defined( _WIN32 )
+        userCacheDirectory = homeDirectory;
+#else
+        userCacheDirectory = boost::filesystem::path( homeDirectory ) / ".cache";
+#endif
+    }
+    return ( userCacheDirectory / "tudat" / "spherical_harmonics" ).string( );
+}
+
+//! Function to check whether a spherical harmonics coefficient cache directory may be used.
+bool isSphericalHarmonicsCoefficientCacheDirectorySafe( const std::string& cacheDirectory )
+{
+#if !defined( _WIN32 )
+    struct stat directoryStatus;
+    if( ::lstat( cacheDirectory.c_str( ), &directoryStatus ) != 0 )
+    {
+        return false;
+    }
+    return S_ISDIR( directoryStatus.st_mode ) && ( directoryStatus.st_uid == ::geteuid( ) ) &&
+            ( ( directoryStatus.st_mode & ( S_IWGRP | S_IWOTH ) ) == 0 );
+#else
+    return boost::filesystem::is_directory( cacheDirectory );
+#endif
+}
+
+//! Function to set the directory in which spherical harmonics coefficient cache files are stored.
+void setSphericalHarmonicsCoefficientCacheDirectory( const std::string& cacheDirectory )
+{
+    getModifiableSphericalHarmonicsCoefficientCacheDirectory( ) = cacheDirectory;
+}
+
+//! Function to retrieve the directory in which spherical harmonics coefficient cache files are stored.
+std::string getSphericalHarmonicsCoefficientCacheDirectory( )
+{
+    return getModifiableSphericalHarmonicsCoefficientCacheDirectory( );
+}
+
+//! Function to retrieve the path of the spherical harmonics coefficient cache file for a given gravity field file.
+std::string getSphericalHarmonicsCoefficientCacheFilePath(
+        const std::string& gravityFieldFilePath, const std::uint64_t gravityFieldFileHash,
+        const int maximumDegree, const int maximumOrder,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex )
+{
+    // Cache is not used if disabled, or if the directory exists, but may have been modified by another user.
+    const std::string cacheDirectory = getSphericalHarmonicsCoefficientCacheDirectory( );
+    if( cacheDirectory.empty( ) || ( boost::filesystem::exists( cacheDirectory ) &&
+                                     !isSphericalHarmonicsCoefficientCacheDirectorySafe( cacheDirectory ) ) )
+    {
+        return "";
+    }
+
+    std::ostringstream cacheFileName;
+    cacheFileName << boost::filesystem::path( gravityFieldFilePath ).stem( ).string( ) << "_"
+                  << std::hex << std::setw( 16 ) << std::setfill( '0' ) << gravityFieldFileHash << std::dec << "_"
+                  << maximumDegree << "_" << maximumOrder << "_"
+                  << gravitationalParameterIndex << "_" << referenceRadiusIndex << ".tsh";
+    return ( boost::filesystem::path( cacheDirectory ) / cacheFileName.str( ) ).string( );
+}
+
+//! Function to write a spherical harmonics coefficient cache file.
+void writeSphericalHarmonicsCoefficientCache(
+        const std::string& cacheFilePath, const std::uint64_t gravityFieldFileHash,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex,
+        const double gravitationalParameter, const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients, const Eigen::MatrixXd& sineCoefficients )
+{
+    if( ( cosineCoefficients.rows( ) != sineCoefficients.rows( ) ) ||
+            ( cosineCoefficients.cols( ) != sineCoefficients.cols( ) ) ||
+            ( cosineCoefficients.rows( ) == 0 ) || ( cosineCoefficients.cols( ) == 0 ) )
+    {
+        throw std::runtime_error( "Error when writing spherical harmonics cache, coefficient sizes are inconsistent" );
+    }
+
+    SphericalHarmonicsCacheFileHeader fileHeader;
+    std::memset( &fileHeader, 0, sizeof( fileHeader ) );
+    std::memcpy( fileHeader.fileIdentifier, sphericalHarmonicsCacheFileIdentifier,
+                 sizeof( sphericalHarmonicsCacheFileIdentifier ) );
+    fileHeader.fileVersion = sphericalHarmonicsCacheFileVersion;
+    fileHeader.maximumDegree = static_cast< std::int32_t >( cosineCoefficients.rows( ) - 1 );
+    fileHeader.maximumOrder = static_cast< std::int32_t >( cosineCoefficients.cols( ) - 1 );
+    fileHeader.gravitationalParameterIndex = gravitationalParameterIndex;
+    fileHeader.referenceRadiusIndex = referenceRadiusIndex;
+    fileHeader.gravityFieldFileHash = gravityFieldFileHash;
+    fileHeader.coefficientDataHash = computeCoefficientDataHash( cosineCoefficients.data( ), sineCoefficients.data( ),
+                                                                 cosineCoefficients.size( ) );
+    fileHeader.gravitationalParameter = gravitationalParameter;
+    fileHeader.referenceRadius = referenceRadius;
+
+    // Create cache directory (accessible only to current user), and check that no other user can modify it.
+    const boost::filesystem::path cacheFile( cacheFilePath );
+    const boost::filesystem::path cacheDirectory =
+            cacheFile.has_parent_path( ) ? cacheFile.parent_path( ) : boost::filesystem::current_path( );
+    if( boost::filesystem::create_directories( cacheDirectory ) )
+    {
+        boost::filesystem::permissions( cacheDirectory, boost::filesystem::owner_all );
+    }
+    if( !isSphericalHarmonicsCoefficientCacheDirectorySafe( cacheDirectory.string( ) ) )
+    {
+        throw std::runtime_error( "Error when writing spherical harmonics cache, directory " +
+                                  cacheDirectory.string( ) + " can be modified by other users" );
+    }
+
+    // Write to temporary file in the same directory, which is renamed when complete.
+    const boost::filesystem::path temporaryFile =
+            cacheFile.string( ) + "." + boost::filesystem::unique_path( ).string( ) + ".tmp";
+
+    {
+        std::ofstream outputFile( temporaryFile.string( ).c_str( ), std::ios::binary );
+        if( !outputFile )
+        {
+            throw std::runtime_error( "Error when writing spherical harmonics cache, file " +
+                                      temporaryFile.string( ) + " could not be opened" );
+        }
+
+        const std::streamsize coefficientDataSize = static_cast< std::streamsize >(
+                    cosineCoefficients.size( ) * sizeof( double ) );
+        outputFile.write( reinterpret_cast< const char* >( &fileHeader ), sizeof( fileHeader ) );
+        outputFile.write( reinterpret_cast< const char* >( cosineCoefficients.data( ) ), coefficientDataSize );
+        outputFile.write( reinterpret_cast< const char* >( sineCoefficients.data( ) ), coefficientDataSize );
+        outputFile.close( );
+
+        if( !outputFile )
+        {
+            boost::filesystem::remove( temporaryFile );
+            throw std::runtime_error( "Error when writing spherical harmonics cache, file " +
+                                      temporaryFile.string( ) + " could not be written" );
+        }
+    }
+
+    boost::system::error_code renameError;
+    boost::filesystem::rename( temporaryFile, cacheFile, renameError );
+    if( renameError )
+    {
+        boost::filesystem::remove( temporaryFile, renameError );
+        throw std::runtime_error( "Error when writing spherical harmonics cache, file " +
+                                  cacheFilePath + " could not be created" );
+    }
+}
+
+//! Constructor, maps the cache file and checks its consistency.
+SphericalHarmonicsCoefficientCache::SphericalHarmonicsCoefficientCache( const std::string& cacheFilePath ):
+    fileMapping_( std::make_shared< ReadOnlyFileMapping >( cacheFilePath ) )
+{
+    if( fileMapping_->getDataSize( ) < sizeof( SphericalHarmonicsCacheFileHeader ) )
+    {
+        throw std::runtime_error( "Error when reading spherical harmonics cache, file " + cacheFilePath +
+                                  " is incomplete" );
+    }
+
+    SphericalHarmonicsCacheFileHeader fileHeader;
+    std::memcpy( &fileHeader, fileMapping_->getData( ), sizeof( fileHeader ) );
+    if( std::memcmp( fileHeader.fileIdentifier, sphericalHarmonicsCacheFileIdentifier,
+                     sizeof( sphericalHarmonicsCacheFileIdentifier ) ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading spherical harmonics cache, file " + cacheFilePath +
+                                  " is not a spherical harmonics cache file" );
+    }
+    if( fileHeader.fileVersion != sphericalHarmonicsCacheFileVersion )
+    {
+        throw std::runtime_error( "Error when reading spherical harmonics cache, file " + cacheFilePath +
+                                  " has unsupported version " + std::to_string( fileHeader.fileVersion ) );
+    }
+    if( fileHeader.maximumDegree < 0 || fileHeader.maximumOrder < 0 )
+    {
+        throw std::runtime_error( "Error when reading spherical harmonics cache, file " + cacheFilePath +
+                                  " has invalid degree/order" );
+    }
+
+    // Check that coefficients have not been modified since the cache file was written.
+    const double* coefficientData = reinterpret_cast< const double* >(
+                fileMapping_->getData( ) + sizeof( SphericalHarmonicsCacheFileHeader ) );
+    const std::size_t numberOfCoefficients =
+            static_cast< std::size_t >( fileHeader.maximumDegree + 1 ) *
+            static_cast< std::size_t >( fileHeader.maximumOrder + 1 );
+    if( fileMapping_->getDataSize( ) !=
+            sizeof( SphericalHarmonicsCacheFileHeader ) + 2 * numberOfCoefficients * sizeof( double ) )
+    {
+        throw std::runtime_error( "Error when reading spherical harmonics cache, file " + cacheFilePath +
+                                  " is incomplete" );
+    }
+    if( computeCoefficientDataHash( coefficientData, coefficientData + numberOfCoefficients, numberOfCoefficients ) !=
+            fileHeader.coefficientDataHash )
+    {
+        throw std::runtime_error( "Error when reading spherical harmonics cache, coefficients in file " +
+                                  cacheFilePath + " do not match their checksum" );
+    }
+
+    gravityFieldFileHash_ = fileHeader.gravityFieldFileHash;
+    maximumDegree_ = fileHeader.maximumDegree;
+    maximumOrder_ = fileHeader.maximumOrder;
+    gravitationalParameterIndex_ = fileHeader.gravitationalParameterIndex;
+    referenceRadiusIndex_ = fileHeader.referenceRadiusIndex;
+    gravitationalParameter_ = fileHeader.gravitationalParameter;
+    referenceRadius_ = fileHeader.referenceRadius;
+
+    // Coefficients are aligned, as mapped file starts at page boundary and header size is a multiple of 8.
+    cosineCoefficients_ = coefficientData;
+    sineCoefficients_ = cosineCoefficients_ + numberOfCoefficients;
+}
+
+//! Function to check whether the cache file was created from a given gravity field file and settings.
+bool SphericalHarmonicsCoefficientCache::isCacheOf(
+        const std::uint64_t gravityFieldFileHash, const int maximumDegree, const int maximumOrder,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex ) const
+{
+    return ( gravityFieldFileHash_ == gravityFieldFileHash ) &&
+            ( maximumDegree_ == maximumDegree ) && ( maximumOrder_ == maximumOrder ) &&
+            ( gravitationalParameterIndex_ == gravitationalParameterIndex ) &&
+            ( referenceRadiusIndex_ == referenceRadiusIndex );
+}
+
+} // namespace input_output
+} // namespace tudat
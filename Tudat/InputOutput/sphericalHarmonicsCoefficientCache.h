@@ -0,0 +1,224 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_SPHERICAL_HARMONICS_COEFFICIENT_CACHE_H
+#define TUDAT_SPHERICAL_HARMONICS_COEFFICIENT_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/dataContentHash.h"
+#include "Tudat/InputOutput/readOnlyFileMapping.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Function to compute the hash of the contents of a file.
+/*!
+ *  Function to compute the hash of the contents of a file, using utilities::computeDataContentHash on the
+ *  memory-mapped file.
+ *  \param filePath Path to file.
+ *  \return Hash of file contents.
+ */
+std::uint64_t computeFileContentHash( const std::string& filePath );
+
+//! Function to retrieve the default per-user directory for spherical harmonics coefficient cache files.
+/*!
+ *  Function to retrieve the default per-user directory for spherical harmonics coefficient cache files:
+ *  $XDG_CACHE_HOME/tudat/spherical_harmonics, or $HOME/.cache/tudat/spherical_harmonics if XDG_CACHE_HOME is not set
+ *  (%LOCALAPPDATA%/tudat/spherical_harmonics on Windows). The cache is not enabled by this function, the
+ *  directory must be passed to setSphericalHarmonicsCoefficientCacheDirectory to do so.
+ *  \return Default per-user cache directory (empty if no home directory could be determined).
+ */
+std::string getDefaultSphericalHarmonicsCoefficientCacheDirectory( );
+
+//! Function to check whether a spherical harmonics coefficient cache directory may be used.
+/*!
+ *  Function to check whether a spherical harmonics coefficient cache directory may be used, which requires that it is
+ *  an existing directory (not a symbolic link) that is owned by the current user, and that cannot be written by other
+ *  users. On Windows, only the existence of the directory is checked.
+ *  \param cacheDirectory Directory that is to be checked.
+ *  \return True if the directory may be used to store cache files.
+ */
+bool isSphericalHarmonicsCoefficientCacheDirectorySafe( const std::string& cacheDirectory );
+
+//! Function to set the directory in which spherical harmonics coefficient cache files are stored.
+/*!
+ *  Function to set the directory in which spherical harmonics coefficient cache files are stored (created, accessible
+ *  only to the current user, when first writing a cache file). The cache is disabled by default (empty directory); it
+ *  is enabled by setting a directory, typically getDefaultSphericalHarmonicsCoefficientCacheDirectory( ). A directory
+ *  that can be modified by other users (see isSphericalHarmonicsCoefficientCacheDirectorySafe) is not used. Setting an
+ *  empty string disables the cache.
+ *  \param cacheDirectory Directory in which cache files are stored (empty to disable cache).
+ */
+void setSphericalHarmonicsCoefficientCacheDirectory( const std::string& cacheDirectory );
+
+//! Function to retrieve the directory in which spherical harmonics coefficient cache files are stored.
+/*!
+ *  Function to retrieve the directory in which spherical harmonics coefficient cache files are stored.
+ *  \return Directory in which cache files are stored (empty if cache is disabled).
+ */
+std::string getSphericalHarmonicsCoefficientCacheDirectory( );
+
+//! Function to retrieve the path of the spherical harmonics coefficient cache file for a given gravity field file.
+/*!
+ *  Function to retrieve the path of the spherical harmonics coefficient cache file for a given gravity field file, in
+ *  the current cache directory. The name of the cache file is composed of the name of the gravity field file, the hash
+ *  of its contents and the settings with which it is read, so that a modified gravity field file, or a different
+ *  maximum degree/order, results in a different cache file.
+ *  \param gravityFieldFilePath Path to (text) gravity field file.
+ *  \param gravityFieldFileHash Hash of contents of gravity field file (see computeFileContentHash).
+ *  \param maximumDegree Maximum degree of coefficients that are read from the gravity field file.
+ *  \param maximumOrder Maximum order of coefficients that are read from the gravity field file.
+ *  \param gravitationalParameterIndex Index of gravitational parameter in header of gravity field file (-1 if none).
+ *  \param referenceRadiusIndex Index of reference radius in header of gravity field file (-1 if none).
+ *  \return Path of cache file (empty if cache is disabled, or if the cache directory is not safe to use).
+ */
+std::string getSphericalHarmonicsCoefficientCacheFilePath(
+        const std::string& gravityFieldFilePath, const std::uint64_t gravityFieldFileHash,
+        const int maximumDegree, const int maximumOrder,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex );
+
+//! Function to write a spherical harmonics coefficient cache file.
+/*!
+ *  Function to write a spherical harmonics coefficient cache file. The file consists of a fixed-size header (file
+ *  identifier, format version, the settings with which the gravity field file was read, the hash of the gravity field
+ *  file, a checksum of the coefficients, the gravitational parameter and reference radius), followed by the cosine
+ *  and sine coefficients as raw (column-major) doubles, so that they can be mapped directly into memory when reading.
+ *  The file is first written under a unique temporary name, and subsequently renamed, so that processes concurrently
+ *  reading the cache never encounter an incomplete file. The cache directory is created accessible only to the current
+ *  user, and an exception is thrown if it can be modified by other users. As the data is stored in the native binary
+ *  representation, cache files are not portable between platforms.
+ *  \param cacheFilePath Path of cache file.
+ *  \param gravityFieldFileHash Hash of contents of gravity field file.
+ *  \param gravitationalParameterIndex Index of gravitational parameter in header of gravity field file (-1 if none).
+ *  \param referenceRadiusIndex Index of reference radius in header of gravity field file (-1 if none).
+ *  \param gravitationalParameter Gravitational parameter read from the gravity field file (NaN if none).
+ *  \param referenceRadius Reference radius read from the gravity field file (NaN if none).
+ *  \param cosineCoefficients Cosine coefficients read from the gravity field file.
+ *  \param sineCoefficients Sine coefficients read from the gravity field file.
+ */
+void writeSphericalHarmonicsCoefficientCache(
+        const std::string& cacheFilePath, const std::uint64_t gravityFieldFileHash,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex,
+        const double gravitationalParameter, const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients, const Eigen::MatrixXd& sineCoefficients );
+
+//! Class providing access to the contents of a memory-mapped spherical harmonics coefficient cache file.
+/*!
+ *  Class providing access to the contents of a memory-mapped spherical harmonics coefficient cache file (see
+ *  writeSphericalHarmonicsCoefficientCache). The coefficients are accessed through an Eigen::Map directly on the mapped
+ *  file, so that no parsing is required, and the data is shared (through the page cache) by all processes using the
+ *  same cache file. The maps remain valid for the lifetime of this object.
+ */
+class SphericalHarmonicsCoefficientCache
+{
+public:
+
+    //! Constructor, maps the cache file and checks its consistency.
+    /*!
+     * Constructor, maps the cache file and checks its file identifier, format version, size and the checksum of the
+     * coefficients, throwing an exception if any of these is inconsistent.
+     * \param cacheFilePath Path of cache file.
+     */
+    SphericalHarmonicsCoefficientCache( const std::string& cacheFilePath );
+
+    //! Function to check whether the cache file was created from a given gravity field file and settings.
+    /*!
+     * Function to check whether the cache file was created from a given gravity field file and settings.
+     * \param gravityFieldFileHash Hash of contents of gravity field file.
+     * \param maximumDegree Maximum degree of coefficients that are read from the gravity field file.
+     * \param maximumOrder Maximum order of coefficients that are read from the gravity field file.
+     * \param gravitationalParameterIndex Index of gravitational parameter in header of gravity field file.
+     * \param referenceRadiusIndex Index of reference radius in header of gravity field file.
+     * \return True if the cache file matches the given gravity field file and settings.
+     */
+    bool isCacheOf( const std::uint64_t gravityFieldFileHash, const int maximumDegree, const int maximumOrder,
+                    const int gravitationalParameterIndex, const int referenceRadiusIndex ) const;
+
+    //! Function to retrieve the maximum degree of the cached coefficients.
+    int getMaximumDegree( ) const
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to retrieve the maximum order of the cached coefficients.
+    int getMaximumOrder( ) const
+    {
+        return maximumOrder_;
+    }
+
+    //! Function to retrieve the gravitational parameter read from the gravity field file (NaN if none).
+    double getGravitationalParameter( ) const
+    {
+        return gravitationalParameter_;
+    }
+
+    //! Function to retrieve the reference radius read from the gravity field file (NaN if none).
+    double getReferenceRadius( ) const
+    {
+        return referenceRadius_;
+    }
+
+    //! Function to retrieve the cosine coefficients, mapped directly on the cache file.
+    Eigen::Map< const Eigen::MatrixXd > getCosineCoefficients( ) const
+    {
+        return Eigen::Map< const Eigen::MatrixXd >( cosineCoefficients_, maximumDegree_ + 1, maximumOrder_ + 1 );
+    }
+
+    //! Function to retrieve the sine coefficients, mapped directly on the cache file.
+    Eigen::Map< const Eigen::MatrixXd > getSineCoefficients( ) const
+    {
+        return Eigen::Map< const Eigen::MatrixXd >( sineCoefficients_, maximumDegree_ + 1, maximumOrder_ + 1 );
+    }
+
+private:
+
+    //! Mapping of the cache file.
+    std::shared_ptr< ReadOnlyFileMapping > fileMapping_;
+
+    //! Hash of contents of gravity field file from which cache was created.
+    std::uint64_t gravityFieldFileHash_;
+
+    //! Maximum degree of the cached coefficients.
+    int maximumDegree_;
+
+    //! Maximum order of the cached coefficients.
+    int maximumOrder_;
+
+    //! Index of gravitational parameter in header of gravity field file (-1 if none).
+    int gravitationalParameterIndex_;
+
+    //! Index of reference radius in header of gravity field file (-1 if none).
+    int referenceRadiusIndex_;
+
+    //! Gravitational parameter read from the gravity field file (NaN if none).
+    double gravitationalParameter_;
+
+    //! Reference radius read from the gravity field file (NaN if none).
+    double referenceRadius_;
+
+    //! Pointer to first cosine coefficient in mapped file.
+    const double* cosineCoefficients_;
+
+    //! Pointer to first sine coefficient in mapped file.
+    const double* sineCoefficients_;
+};
+
+} // namespace input_output
+} // namespace tudat
+
+#endif // TUDAT_SPHERICAL_HARMONICS_COEFFICIENT_CACHE_H
@@ -0,0 +1,674 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Celestrak (c). NORAD Two-Line Element Set Format,
+ *          http://celestrak.com/NORAD/documentation/tle-fmt.asp, 2004. Last
+ *          accessed: 5 August, 2011.
+ *
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/stateVectorIndices.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+#include "Tudat/InputOutput/readOnlyFileMapping.h"
+#include "Tudat/InputOutput/twoLineElementCatalogue.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Integrity errors that can be detected in a TLE record (bit flags).
+enum TwoLineElementRecordError
+{
+    incorrect_line_1_leading_integer = 1 << 0,
+    incorrect_line_2_leading_integer = 1 << 1,
+    invalid_tle_classification = 1 << 2,
+    incorrect_orbital_model = 1 << 3,
+    incorrect_line_1_checksum = 1 << 4,
+    incorrect_line_2_checksum = 1 << 5,
+    object_identification_number_mismatch = 1 << 6,
+    incorrect_line_length = 1 << 7,
+    invalid_numerical_field = 1 << 8,
+    incomplete_record = 1 << 9
+};
+
+//! Function to retrieve the error message associated with each of the integrity errors of a TLE record.
+const std::vector< std::pair< int, std::string > >& getTwoLineElementRecordErrorMessages( )
+{
+    static const std::vector< std::pair< int, std::string > > errorMessages =
+    {
+        { incorrect_line_1_leading_integer, "Incorrect line-1 leading integer." },
+        { incorrect_line_2_leading_integer, "Incorrect line-2 leading integer." },
+        { invalid_tle_classification, "Invalid TLE classification." },
+        { incorrect_orbital_model, "Incorrect orbital model." },
+        { incorrect_line_1_checksum, "Incorrect line-1 modulo-10 checksum." },
+        { incorrect_line_2_checksum, "Incorrect line-2 modulo-10 checksum." },
+        { object_identification_number_mismatch, "Line-1 and line-2 object idenfitication number mismatch." },
+        { incorrect_line_length, "Incorrect line length." },
+        { invalid_numerical_field, "Invalid numerical field." },
+        { incomplete_record, "Incomplete record." }
+    };
+    return errorMessages;
+}
+
+//! Minimum length of TLE line 1 and line 2 (excluding end-of-line characters).
+static const unsigned int minimumTwoLineElementLineLength = 69;
+
+//! Function to parse a fixed-width integer field, with optional leading/trailing spaces and sign.
+/*!
+ * Function to parse a fixed-width integer field, with optional leading/trailing spaces and sign.
+ * \param field Pointer to first character of field.
+ * \param fieldWidth Number of characters in field.
+ * \param value Value of field (returned by reference).
+ * \param isEmptyFieldAllowed Boolean denoting whether a field containing only spaces is valid (and zero).
+ * \return True if field is valid, false otherwise.
+ */
+bool parseFixedWidthInteger( const char* field, const int fieldWidth, int& value,
+                             const bool isEmptyFieldAllowed = false )
+{
+    int i = 0;
+    while( i < fieldWidth && field[ i ] == ' ' )
+    {
+        i++;
+    }
+
+    bool isNegative = false;
+    if( i < fieldWidth && ( field[ i ] == '-' || field[ i ] == '+' ) )
+    {
+        isNegative = ( field[ i ] == '-' );
+        i++;
+    }
+
+    int numberOfDigits = 0;
+    value = 0;
+    for( ; i < fieldWidth && field[ i ] != ' '; i++ )
+    {
+        if( field[ i ] < '0' || field[ i ] > '9' )
+        {
+            return false;
+        }
+        value = 10 * value + ( field[ i ] - '0' );
+        numberOfDigits++;
+    }
+
+    for( ; i < fieldWidth; i++ )
+    {
+        if( field[ i ] != ' ' )
+        {
+            return false;
+        }
+    }
+
+    if( isNegative )
+    {
+        value = -value;
+    }
+    return ( numberOfDigits > 0 ) || isEmptyFieldAllowed;
+}
+
+//! Function to parse a fixed-width decimal field, with optional leading/trailing spaces, sign and decimal point.
+/*!
+ * Function to parse a fixed-width decimal field (e.g. " -.00000055" or "34.2587"), with optional leading/trailing
+ * spaces, sign and decimal point. The digits are accumulated in an integer, which is divided by the (exactly
+ * representable) power of ten of the number of decimals, so that the result is correctly rounded.
+ * \param field Pointer to first character of field.
+ * \param fieldWidth Number of characters in field.
+ * \param value Value of field (returned by reference).
+ * \return True if field is valid, false otherwise.
+ */
+bool parseFixedWidthDecimal( const char* field, const int fieldWidth, double& value )
+{
+    static const double powersOfTen[ ] =
+    { 1.0E0, 1.0E1, 1.0E2, 1.0E3, 1.0E4, 1.0E5, 1.0E6, 1.0E7, 1.0E8,
+      1.0E9, 1.0E10, 1.0E11, 1.0E12, 1.0E13, 1.0E14, 1.0E15 };
+
+    int i = 0;
+    while( i < fieldWidth && field[ i ] == ' ' )
+    {
+        i++;
+    }
+
+    bool isNegative = false;
+    if( i < fieldWidth && ( field[ i ] == '-' || field[ i ] == '+' ) )
+    {
+        isNegative = ( field[ i ] == '-' );
+        i++;
+    }
+
+    std::uint64_t mantissa = 0;
+    int numberOfDigits = 0;
+    int numberOfDecimals = 0;
+    bool isDecimalPointFound = false;
+    for( ; i < fieldWidth && field[ i ] != ' '; i++ )
+    {
+        if( field[ i ] == '.' && !isDecimalPointFound )
+        {
+            isDecimalPointFound = true;
+        }
+        else if( field[ i ] >= '0' && field[ i ] <= '9' )
+        {
+            mantissa = 10 * mantissa + static_cast< std::uint64_t >( field[ i ] - '0' );
+            numberOfDigits++;
+            if( isDecimalPointFound )
+            {
+                numberOfDecimals++;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    for( ; i < fieldWidth; i++ )
+    {
+        if( field[ i ] != ' ' )
+        {
+            return false;
+        }
+    }
+
+    if( numberOfDigits == 0 || numberOfDigits > 15 )
+    {
+        return false;
+    }
+
+    value = static_cast< double >( mantissa ) / powersOfTen[ numberOfDecimals ];
+    if( isNegative )
+    {
+        value = -value;
+    }
+    return true;
+}
+
+//! Function to parse a field in the TLE format with implied leading decimal point and exponent (e.g. "-55493-4").
+/*!
+ * Function to parse an 8-character field in the TLE format with implied leading decimal point and exponent (e.g.
+ * "-55493-4" for -0.55493E-4).
+ * \param field Pointer to first character of field.
+ * \param value Value of field (returned by reference).
+ * \return True if field is valid, false otherwise.
+ */
+bool parseImpliedDecimalExponentField( const char* field, double& value )
+{
+    int coefficient, exponent;
+    if( !parseFixedWidthInteger( field, 6, coefficient ) || !parseFixedWidthInteger( field + 6, 2, exponent ) )
+    {
+        return false;
+    }
+
+    value = ( static_cast< double >( coefficient ) / 100000.0 ) * std::pow( 10.0, exponent );
+    return true;
+}
+
+//! Function to compute the modulo-10 checksum of a TLE line.
+/*!
+ * Function to compute the modulo-10 checksum of a TLE line: the sum of all digits of the first 68 characters, with
+ * minus signs counting as one, modulo 10.
+ * \param line Pointer to first character of line.
+ * \return Modulo-10 checksum of line.
+ */
+int computeTwoLineElementChecksum( const char* line )
+{
+    int checksum = 0;
+    for( unsigned int i = 0; i < minimumTwoLineElementLineLength - 1; i++ )
+    {
+        if( line[ i ] >= '0' && line[ i ] <= '9' )
+        {
+            checksum += line[ i ] - '0';
+        }
+        else if( line[ i ] == '-' )
+        {
+            checksum++;
+        }
+    }
+    return checksum % 10;
+}
+
+//! Function to resize all arrays of the catalogue.
+void TwoLineElementCatalogue::resize( const unsigned int numberOfRecords, const bool hasObjectNames )
+{
+    objectName.resize( hasObjectNames ? numberOfRecords : 0 );
+    lineNumber.resize( numberOfRecords );
+    objectIdentificationNumber.resize( numberOfRecords );
+    tleClassification.resize( numberOfRecords );
+    fourDigitLaunchYear.resize( numberOfRecords );
+    launchNumber.resize( numberOfRecords );
+    launchPart.resize( numberOfRecords );
+    fourDigitEpochYear.resize( numberOfRecords );
+    epochDay.resize( numberOfRecords );
+    epochJulianDay.resize( numberOfRecords );
+    firstDerivativeOfMeanMotionDividedByTwo.resize( numberOfRecords );
+    secondDerivativeOfMeanMotionDividedBySix.resize( numberOfRecords );
+    bStar.resize( numberOfRecords );
+    orbitalModel.resize( numberOfRecords );
+    tleNumber.resize( numberOfRecords );
+    inclination.resize( numberOfRecords );
+    rightAscensionOfAscendingNode.resize( numberOfRecords );
+    eccentricity.resize( numberOfRecords );
+    argumentOfPerigee.resize( numberOfRecords );
+    meanAnomaly.resize( numberOfRecords );
+    meanMotionInRevolutionsPerDay.resize( numberOfRecords );
+    revolutionNumber.resize( numberOfRecords );
+}
+
+//! Function to remove the entries of a vector for which the associated flag is set, retaining the order.
+template< typename DataType >
+void removeFlaggedEntries( std::vector< DataType >& vector, const std::vector< char >& isEntryRemoved )
+{
+    if( vector.empty( ) )
+    {
+        return;
+    }
+
+    std::size_t numberOfRetainedEntries = 0;
+    for( std::size_t i = 0; i < vector.size( ); i++ )
+    {
+        if( !isEntryRemoved[ i ] )
+        {
+            if( numberOfRetainedEntries != i )
+            {
+                vector[ numberOfRetainedEntries ] = std::move( vector[ i ] );
+            }
+            numberOfRetainedEntries++;
+        }
+    }
+    vector.resize( numberOfRetainedEntries );
+}
+
+//! Function to remove a set of records from the catalogue.
+void TwoLineElementCatalogue::removeRecords( const std::vector< char >& isRecordRemoved )
+{
+    if( isRecordRemoved.size( ) != getNumberOfRecords( ) )
+    {
+        throw std::runtime_error( "Error when removing TLE records, size of flag vector is inconsistent." );
+    }
+
+    removeFlaggedEntries( objectName, isRecordRemoved );
+    removeFlaggedEntries( lineNumber, isRecordRemoved );
+    removeFlaggedEntries( objectIdentificationNumber, isRecordRemoved );
+    removeFlaggedEntries( tleClassification, isRecordRemoved );
+    removeFlaggedEntries( fourDigitLaunchYear, isRecordRemoved );
+    removeFlaggedEntries( launchNumber, isRecordRemoved );
+    removeFlaggedEntries( launchPart, isRecordRemoved );
+    removeFlaggedEntries( fourDigitEpochYear, isRecordRemoved );
+    removeFlaggedEntries( epochDay, isRecordRemoved );
+    removeFlaggedEntries( epochJulianDay, isRecordRemoved );
+    removeFlaggedEntries( firstDerivativeOfMeanMotionDividedByTwo, isRecordRemoved );
+    removeFlaggedEntries( secondDerivativeOfMeanMotionDividedBySix, isRecordRemoved );
+    removeFlaggedEntries( bStar, isRecordRemoved );
+    removeFlaggedEntries( orbitalModel, isRecordRemoved );
+    removeFlaggedEntries( tleNumber, isRecordRemoved );
+    removeFlaggedEntries( inclination, isRecordRemoved );
+    removeFlaggedEntries( rightAscensionOfAscendingNode, isRecordRemoved );
+    removeFlaggedEntries( eccentricity, isRecordRemoved );
+    removeFlaggedEntries( argumentOfPerigee, isRecordRemoved );
+    removeFlaggedEntries( meanAnomaly, isRecordRemoved );
+    removeFlaggedEntries( meanMotionInRevolutionsPerDay, isRecordRemoved );
+    removeFlaggedEntries( revolutionNumber, isRecordRemoved );
+}
+
+//! Function to create a TwoLineElementData object from a record in the catalogue.
+TwoLineElementData TwoLineElementCatalogue::getTwoLineElementData( const unsigned int recordIndex ) const
+{
+    // Reference: Table 2 in (Vallado, D.A., et al., 2006).
+    const double earthWithWorldGeodeticSystem72GravitationalParameter = 398600.8e9;
+
+    TwoLineElementData twoLineElementData;
+    if( !objectName.empty( ) )
+    {
+        twoLineElementData.objectNameString = objectName.at( recordIndex );
+    }
+    twoLineElementData.lineNumberLine1 = 1;
+    twoLineElementData.objectIdentificationNumber = objectIdentificationNumber.at( recordIndex );
+    twoLineElementData.tleClassification = tleClassification.at( recordIndex );
+    twoLineElementData.fourDigitlaunchYear = fourDigitLaunchYear.at( recordIndex );
+    twoLineElementData.launchYear = fourDigitLaunchYear.at( recordIndex ) % 100;
+    twoLineElementData.launchNumber = launchNumber.at( recordIndex );
+    twoLineElementData.launchPart = launchPart.at( recordIndex );
+    twoLineElementData.fourDigitEpochYear = fourDigitEpochYear.at( recordIndex );
+    twoLineElementData.epochYear = fourDigitEpochYear.at( recordIndex ) % 100;
+    twoLineElementData.epochDay = epochDay.at( recordIndex );
+    twoLineElementData.firstDerivativeOfMeanMotionDividedByTwo =
+            firstDerivativeOfMeanMotionDividedByTwo.at( recordIndex );
+    twoLineElementData.secondDerivativeOfMeanMotionDividedBySix =
+            secondDerivativeOfMeanMotionDividedBySix.at( recordIndex );
+    twoLineElementData.bStar = bStar.at( recordIndex );
+    twoLineElementData.orbitalModel = orbitalModel.at( recordIndex );
+    twoLineElementData.tleNumber = tleNumber.at( recordIndex );
+    twoLineElementData.lineNumberLine2 = 2;
+    twoLineElementData.objectIdentificationNumberLine2 = objectIdentificationNumber.at( recordIndex );
+    twoLineElementData.meanAnomaly = meanAnomaly.at( recordIndex );
+    twoLineElementData.meanMotionInRevolutionsPerDay = meanMotionInRevolutionsPerDay.at( recordIndex );
+    twoLineElementData.revolutionNumber = revolutionNumber.at( recordIndex );
+    twoLineElementData.totalRevolutionNumber = revolutionNumber.at( recordIndex );
+
+    twoLineElementData.TLEKeplerianElements( orbital_element_conversions::inclinationIndex ) =
+            inclination.at( recordIndex );
+    twoLineElementData.TLEKeplerianElements( orbital_element_conversions::longitudeOfAscendingNodeIndex ) =
+            rightAscensionOfAscendingNode.at( recordIndex );
+    twoLineElementData.TLEKeplerianElements( orbital_element_conversions::eccentricityIndex ) =
+            eccentricity.at( recordIndex );
+    twoLineElementData.TLEKeplerianElements( orbital_element_conversions::argumentOfPeriapsisIndex ) =
+            argumentOfPerigee.at( recordIndex );
+    twoLineElementData.TLEKeplerianElements( orbital_element_conversions::semiMajorAxisIndex ) =
+            orbital_element_conversions::convertEllipticalMeanMotionToSemiMajorAxis(
+                meanMotionInRevolutionsPerDay.at( recordIndex ) * 2.0 * mathematical_constants::PI /
+                physical_constants::JULIAN_DAY, earthWithWorldGeodeticSystem72GravitationalParameter );
+    twoLineElementData.TLEKeplerianElements( orbital_element_conversions::trueAnomalyIndex ) = TUDAT_NAN;
+
+    twoLineElementData.perigee =
+            twoLineElementData.TLEKeplerianElements( orbital_element_conversions::semiMajorAxisIndex ) *
+            ( 1.0 - eccentricity.at( recordIndex ) );
+    twoLineElementData.apogee =
+            twoLineElementData.TLEKeplerianElements( orbital_element_conversions::semiMajorAxisIndex ) *
+            ( 1.0 + eccentricity.at( recordIndex ) );
+
+    return twoLineElementData;
+}
+
+//! Function to convert a two-digit year of the TLE format to a four-digit year.
+unsigned int convertTwoLineElementYearToFourDigitYear( const int twoDigitYear )
+{
+    return ( twoDigitYear > 56 ) ? ( twoDigitYear + 1900 ) : ( twoDigitYear + 2000 );
+}
+
+//! Function to parse a single record into the catalogue, and perform its integrity checks.
+/*!
+ * Function to parse a single record into the catalogue, and perform its integrity checks.
+ * \param nameLine Pointer to first character of name line (nullptr for two-line format).
+ * \param nameLineLength Number of characters in name line.
+ * \param line1 Pointer to first character of line 1.
+ * \param line1Length Number of characters in line 1.
+ * \param line2 Pointer to first character of line 2.
+ * \param line2Length Number of characters in line 2.
+ * \param recordIndex Index of record in catalogue.
+ * \param catalogue Catalogue in which the parsed data is stored.
+ * \return Integrity errors found in the record (combination of TwoLineElementRecordError flags).
+ */
+int parseTwoLineElementRecord( const char* nameLine, const std::size_t nameLineLength,
+                               const char* line1, const std::size_t line1Length,
+                               const char* line2, const std::size_t line2Length,
+                               const unsigned int recordIndex, TwoLineElementCatalogue& catalogue )
+{
+    if( nameLine != nullptr )
+    {
+        std::size_t nameLength = nameLineLength;
+        while( nameLength > 0 && ( nameLine[ nameLength - 1 ] == ' ' || nameLine[ nameLength - 1 ] == '\t' ) )
+        {
+            nameLength--;
+        }
+        catalogue.objectName[ recordIndex ].assign( nameLine, nameLength );
+    }
+
+    if( line1Length < minimumTwoLineElementLineLength || line2Length < minimumTwoLineElementLineLength )
+    {
+        return incorrect_line_length;
+    }
+
+    int recordErrors = 0;
+    if( line1[ 0 ] != '1' )
+    {
+        recordErrors |= incorrect_line_1_leading_integer;
+    }
+    if( line2[ 0 ] != '2' )
+    {
+        recordErrors |= incorrect_line_2_leading_integer;
+    }
+
+    // Parse line 1.
+    bool areFieldsValid = true;
+    int integerValue, secondIntegerValue;
+
+    areFieldsValid &= parseFixedWidthInteger( line1 + 2, 5, integerValue );
+    catalogue.objectIdentificationNumber[ recordIndex ] = integerValue;
+
+    catalogue.tleClassification[ recordIndex ] = line1[ 7 ];
+    if( line1[ 7 ] != 'U' && line1[ 7 ] != 'C' )
+    {
+        recordErrors |= invalid_tle_classification;
+    }
+
+    areFieldsValid &= parseFixedWidthInteger( line1 + 9, 2, integerValue, true );
+    catalogue.fourDigitLaunchYear[ recordIndex ] = convertTwoLineElementYearToFourDigitYear( integerValue );
+    areFieldsValid &= parseFixedWidthInteger( line1 + 11, 3, integerValue, true );
+    catalogue.launchNumber[ recordIndex ] = integerValue;
+    catalogue.launchPart[ recordIndex ].assign( line1 + 14, 3 );
+
+    areFieldsValid &= parseFixedWidthInteger( line1 + 18, 2, integerValue );
+    catalogue.fourDigitEpochYear[ recordIndex ] = convertTwoLineElementYearToFourDigitYear( integerValue );
+    areFieldsValid &= parseFixedWidthDecimal( line1 + 20, 12, catalogue.epochDay[ recordIndex ] );
+    catalogue.epochJulianDay[ recordIndex ] =
+            basic_astrodynamics::convertCalendarDateToJulianDay< double >(
+                catalogue.fourDigitEpochYear[ recordIndex ], 1, 1, 0, 0, 0.0 ) +
+            catalogue.epochDay[ recordIndex ] - 1.0;
+
+    areFieldsValid &= parseFixedWidthDecimal(
+                line1 + 33, 10, catalogue.firstDerivativeOfMeanMotionDividedByTwo[ recordIndex ] );
+    areFieldsValid &= parseImpliedDecimalExponentField(
+                line1 + 44, catalogue.secondDerivativeOfMeanMotionDividedBySix[ recordIndex ] );
+    areFieldsValid &= parseImpliedDecimalExponentField( line1 + 53, catalogue.bStar[ recordIndex ] );
+
+    if( parseFixedWidthInteger( line1 + 62, 1, integerValue ) )
+    {
+        catalogue.orbitalModel[ recordIndex ] = integerValue;
+        if( integerValue != 0 )
+        {
+            recordErrors |= incorrect_orbital_model;
+        }
+    }
+    else
+    {
+        areFieldsValid = false;
+    }
+    areFieldsValid &= parseFixedWidthInteger( line1 + 64, 4, integerValue );
+    catalogue.tleNumber[ recordIndex ] = integerValue;
+
+    if( !parseFixedWidthInteger( line1 + 68, 1, integerValue ) ||
+            integerValue != computeTwoLineElementChecksum( line1 ) )
+    {
+        recordErrors |= incorrect_line_1_checksum;
+    }
+
+    // Parse line 2.
+    areFieldsValid &= parseFixedWidthInteger( line2 + 2, 5, secondIntegerValue );
+    if( secondIntegerValue != static_cast< int >( catalogue.objectIdentificationNumber[ recordIndex ] ) )
+    {
+        recordErrors |= object_identification_number_mismatch;
+    }
+
+    areFieldsValid &= parseFixedWidthDecimal( line2 + 8, 8, catalogue.inclination[ recordIndex ] );
+    areFieldsValid &= parseFixedWidthDecimal( line2 + 17, 8, catalogue.rightAscensionOfAscendingNode[ recordIndex ] );
+    areFieldsValid &= parseFixedWidthInteger( line2 + 26, 7, integerValue );
+    catalogue.eccentricity[ recordIndex ] = static_cast< double >( integerValue ) / 10000000.0;
+    areFieldsValid &= parseFixedWidthDecimal( line2 + 34, 8, catalogue.argumentOfPerigee[ recordIndex ] );
+    areFieldsValid &= parseFixedWidthDecimal( line2 + 43, 8, catalogue.meanAnomaly[ recordIndex ] );
+    areFieldsValid &= parseFixedWidthDecimal( line2 + 52, 11, catalogue.meanMotionInRevolutionsPerDay[ recordIndex ] );
+    areFieldsValid &= parseFixedWidthInteger( line2 + 63, 5, integerValue );
+    catalogue.revolutionNumber[ recordIndex ] = integerValue;
+
+    if( !parseFixedWidthInteger( line2 + 68, 1, integerValue ) ||
+            integerValue != computeTwoLineElementChecksum( line2 ) )
+    {
+        recordErrors |= incorrect_line_2_checksum;
+    }
+
+    if( !areFieldsValid )
+    {
+        recordErrors |= invalid_numerical_field;
+    }
+
+    return recordErrors;
+}
+
+//! Function to parse a catalogue of TLE data from a character buffer.
+TwoLineElementCatalogue parseTwoLineElementCatalogue(
+        const char* data, const std::size_t dataSize,
+        const TwoLineElementsTextFileReader::LineNumberTypesForTwoLineElementInputData lineNumberType,
+        const unsigned int numberOfThreads,
+        const bool removeCorruptedRecords )
+{
+    // Number of characters per chunk in search for lines, and number of records per block in parsing of records.
+    static const std::size_t lineSearchChunkSize = 1 << 20;
+    static const unsigned int recordBlockSize = 1024;
+
+    const unsigned int numberOfLinesPerRecord =
+            ( lineNumberType == TwoLineElementsTextFileReader::threeLineType ) ? 3 : 2;
+
+    // Locate start, length and line number of all non-empty lines, by (in parallel) searching chunks of the buffer
+    // for the lines that start in it.
+    const unsigned int numberOfChunks = static_cast< unsigned int >(
+                ( dataSize + lineSearchChunkSize - 1 ) / lineSearchChunkSize );
+    std::vector< std::vector< std::size_t > > chunkLineStarts( numberOfChunks );
+    std::vector< std::vector< unsigned int > > chunkLineLengths( numberOfChunks );
+    std::vector< std::vector< unsigned int > > chunkLineIndices( numberOfChunks );
+    std::vector< unsigned int > chunkNumberOfLines( numberOfChunks );
+    utilities::executeParallelForLoop( numberOfChunks, [ & ]( const unsigned int chunkIndex, const unsigned int )
+    {
+        const std::size_t chunkStart = chunkIndex * lineSearchChunkSize;
+        const std::size_t chunkEnd = std::min( chunkStart + lineSearchChunkSize, dataSize );
+
+        // Move to start of first line that starts in this chunk.
+        std::size_t currentPosition = chunkStart;
+        if( chunkStart > 0 && data[ chunkStart - 1 ] != '\n' )
+        {
+            const void* nextLineEnd = std::memchr( data + chunkStart, '\n', chunkEnd - chunkStart );
+            currentPosition = ( nextLineEnd == nullptr ) ?
+                        chunkEnd : static_cast< const char* >( nextLineEnd ) - data + 1;
+        }
+
+        unsigned int lineIndex = 0;
+        while( currentPosition < chunkEnd )
+        {
+            const void* lineEnd = std::memchr( data + currentPosition, '\n', dataSize - currentPosition );
+            std::size_t lineEndPosition = ( lineEnd == nullptr ) ?
+                        dataSize : static_cast< std::size_t >( static_cast< const char* >( lineEnd ) - data );
+
+            std::size_t lineLength = lineEndPosition - currentPosition;
+            if( lineLength > 0 && data[ lineEndPosition - 1 ] == '\r' )
+            {
+                lineLength--;
+            }
+
+            if( lineLength > 0 )
+            {
+                chunkLineStarts[ chunkIndex ].push_back( currentPosition );
+                chunkLineLengths[ chunkIndex ].push_back( static_cast< unsigned int >( lineLength ) );
+                chunkLineIndices[ chunkIndex ].push_back( lineIndex );
+            }
+
+            lineIndex++;
+            currentPosition = lineEndPosition + 1;
+        }
+        chunkNumberOfLines[ chunkIndex ] = lineIndex;
+    }, numberOfThreads );
+
+    // Merge lines of all chunks.
+    std::vector< std::size_t > lineStarts;
+    std::vector< unsigned int > lineLengths;
+    std::vector< unsigned int > lineNumbers;
+    unsigned int numberOfPreviousLines = 0;
+    for( unsigned int i = 0; i < numberOfChunks; i++ )
+    {
+        lineStarts.insert( lineStarts.end( ), chunkLineStarts[ i ].begin( ), chunkLineStarts[ i ].end( ) );
+        lineLengths.insert( lineLengths.end( ), chunkLineLengths[ i ].begin( ), chunkLineLengths[ i ].end( ) );
+        for( unsigned int j = 0; j < chunkLineIndices[ i ].size( ); j++ )
+        {
+            lineNumbers.push_back( numberOfPreviousLines + chunkLineIndices[ i ][ j ] + 1 );
+        }
+        numberOfPreviousLines += chunkNumberOfLines[ i ];
+
+        std::vector< std::size_t >( ).swap( chunkLineStarts[ i ] );
+        std::vector< unsigned int >( ).swap( chunkLineLengths[ i ] );
+        std::vector< unsigned int >( ).swap( chunkLineIndices[ i ] );
+    }
+
+    // Parse all complete records, in blocks of records distributed over the threads.
+    const unsigned int numberOfRecords = lineStarts.size( ) / numberOfLinesPerRecord;
+    const unsigned int firstLineOffset = numberOfLinesPerRecord - 2;
+
+    TwoLineElementCatalogue catalogue;
+    catalogue.resize( numberOfRecords, numberOfLinesPerRecord == 3 );
+    std::vector< int > recordErrors( numberOfRecords );
+
+    utilities::executeParallelForLoop(
+                ( numberOfRecords + recordBlockSize - 1 ) / recordBlockSize,
+                [ & ]( const unsigned int blockIndex, const unsigned int )
+    {
+        const unsigned int blockEnd = std::min( ( blockIndex + 1 ) * recordBlockSize, numberOfRecords );
+        for( unsigned int i = blockIndex * recordBlockSize; i < blockEnd; i++ )
+        {
+            const unsigned int firstLineIndex = i * numberOfLinesPerRecord;
+            const unsigned int line1Index = firstLineIndex + firstLineOffset;
+            catalogue.lineNumber[ i ] = lineNumbers[ firstLineIndex ];
+            recordErrors[ i ] = parseTwoLineElementRecord(
+                        ( numberOfLinesPerRecord == 3 ) ? data + lineStarts[ firstLineIndex ] : nullptr,
+                        lineLengths[ firstLineIndex ],
+                        data + lineStarts[ line1Index ], lineLengths[ line1Index ],
+                        data + lineStarts[ line1Index + 1 ], lineLengths[ line1Index + 1 ],
+                        i, catalogue );
+        }
+    }, numberOfThreads );
+
+    // Collect errors, and remove corrupted records if requested.
+    std::vector< char > isRecordCorrupted( numberOfRecords, false );
+    for( unsigned int i = 0; i < numberOfRecords; i++ )
+    {
+        if( recordErrors[ i ] != 0 )
+        {
+            isRecordCorrupted[ i ] = true;
+            for( const std::pair< int, std::string >& errorMessage: getTwoLineElementRecordErrorMessages( ) )
+            {
+                if( recordErrors[ i ] & errorMessage.first )
+                {
+                    catalogue.corruptedRecordErrors.insert( std::make_pair( i, errorMessage.second ) );
+                }
+            }
+        }
+    }
+
+    if( lineStarts.size( ) % numberOfLinesPerRecord != 0 )
+    {
+        catalogue.corruptedRecordErrors.insert(
+                    std::make_pair( numberOfRecords, getTwoLineElementRecordErrorMessages( ).back( ).second ) );
+    }
+
+    if( removeCorruptedRecords && !catalogue.corruptedRecordErrors.empty( ) )
+    {
+        catalogue.removeRecords( isRecordCorrupted );
+    }
+
+    return catalogue;
+}
+
+//! Function to read a catalogue of TLE data from a file.
+TwoLineElementCatalogue readTwoLineElementCatalogue(
+        const std::string& filePath,
+        const TwoLineElementsTextFileReader::LineNumberTypesForTwoLineElementInputData lineNumberType,
+        const unsigned int numberOfThreads,
+        const bool removeCorruptedRecords )
+{
+    ReadOnlyFileMapping fileMapping( filePath );
+    return parseTwoLineElementCatalogue( fileMapping.getData( ), fileMapping.getDataSize( ), lineNumberType,
+                                         numberOfThreads, removeCorruptedRecords );
+}
+
+} // namespace input_output
+} // namespace tudat
@@ -0,0 +1,196 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Celestrak (c). NORAD Two-Line Element Set Format,
+ *          http://celestrak.com/NORAD/documentation/tle-fmt.asp, 2004. Last
+ *          accessed: 5 August, 2011.
+ *
+ */
+
+#ifndef TUDAT_TWO_LINE_ELEMENT_CATALOGUE_H
+#define TUDAT_TWO_LINE_ELEMENT_CATALOGUE_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Tudat/InputOutput/twoLineElementData.h"
+#include "Tudat/InputOutput/twoLineElementsTextFileReader.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Table of TLE data of a (large) catalogue, stored as a structure of arrays.
+/*!
+ *  Table of TLE data of a (large) catalogue, stored as a structure of arrays: entry i of each of the vectors contains
+ *  the data of record i, so that (for instance) all mean motions of the catalogue are stored contiguously. The elements
+ *  are stored in the units of the TLE format (degrees, revolutions per day), as required for the initialization of the
+ *  SGP4/SDP4 propagators. Objects of this type are created by the parseTwoLineElementCatalogue and
+ *  readTwoLineElementCatalogue functions.
+ */
+struct TwoLineElementCatalogue
+{
+    //! Function to retrieve the number of records in the catalogue.
+    /*!
+     * Function to retrieve the number of records in the catalogue.
+     * \return Number of records in the catalogue.
+     */
+    unsigned int getNumberOfRecords( ) const
+    {
+        return objectIdentificationNumber.size( );
+    }
+
+    //! Function to resize all arrays of the catalogue.
+    /*!
+     * Function to resize all arrays of the catalogue.
+     * \param numberOfRecords Number of records in the catalogue.
+     * \param hasObjectNames Boolean denoting whether the records contain a name line (three-line format).
+     */
+    void resize( const unsigned int numberOfRecords, const bool hasObjectNames );
+
+    //! Function to remove a set of records from the catalogue.
+    /*!
+     * Function to remove a set of records from the catalogue, retaining the order of the remaining records.
+     * \param isRecordRemoved Vector of flags (one per record) denoting whether the associated record is to be removed.
+     */
+    void removeRecords( const std::vector< char >& isRecordRemoved );
+
+    //! Function to create a TwoLineElementData object from a record in the catalogue.
+    /*!
+     * Function to create a TwoLineElementData object from a record in the catalogue, including the derived
+     * quantities (semi-major axis, perigee and apogee). The total revolution number is not corrected for the roll-over
+     * of the revolution number, and is set equal to the revolution number.
+     * \param recordIndex Index of record in the catalogue.
+     * \return TLE data of record.
+     */
+    TwoLineElementData getTwoLineElementData( const unsigned int recordIndex ) const;
+
+    //! Name of object, with trailing whitespace removed (empty if catalogue is in two-line format).
+    std::vector< std::string > objectName;
+
+    //! Line number (one-based) in the input of the first line of each record.
+    std::vector< unsigned int > lineNumber;
+
+    //! Object identification number (line 1).
+    std::vector< unsigned int > objectIdentificationNumber;
+
+    //! TLE classification.
+    std::vector< char > tleClassification;
+
+    //! Launch year, four digits.
+    std::vector< unsigned int > fourDigitLaunchYear;
+
+    //! Launch number of launch year.
+    std::vector< unsigned int > launchNumber;
+
+    //! Part of the launch.
+    std::vector< std::string > launchPart;
+
+    //! TLE epoch year, four digits.
+    std::vector< unsigned int > fourDigitEpochYear;
+
+    //! Epoch day of the year.
+    std::vector< double > epochDay;
+
+    //! TLE epoch as Julian day (UTC).
+    std::vector< double > epochJulianDay;
+
+    //! First derivative of the mean motion divided by two (revolutions per day squared).
+    std::vector< double > firstDerivativeOfMeanMotionDividedByTwo;
+
+    //! Second derivative of the mean motion divided by six (revolutions per day cubed).
+    std::vector< double > secondDerivativeOfMeanMotionDividedBySix;
+
+    //! B* drag term (inverse Earth radii).
+    std::vector< double > bStar;
+
+    //! Orbital model.
+    std::vector< unsigned int > orbitalModel;
+
+    //! TLE number.
+    std::vector< unsigned int > tleNumber;
+
+    //! Inclination (degrees).
+    std::vector< double > inclination;
+
+    //! Right ascension of ascending node (degrees).
+    std::vector< double > rightAscensionOfAscendingNode;
+
+    //! Eccentricity.
+    std::vector< double > eccentricity;
+
+    //! Argument of perigee (degrees).
+    std::vector< double > argumentOfPerigee;
+
+    //! Mean anomaly (degrees).
+    std::vector< double > meanAnomaly;
+
+    //! Mean motion (revolutions per day).
+    std::vector< double > meanMotionInRevolutionsPerDay;
+
+    //! Revolution number at epoch.
+    std::vector< unsigned int > revolutionNumber;
+
+    //! Errors found by the integrity checks.
+    /*!
+     * Errors found by the integrity checks, with the index of the record in the input as key (the same record may have
+     * multiple entries). The error messages are identical to those of
+     * TwoLineElementsTextFileReader::checkTwoLineElementsFileIntegrity.
+     */
+    std::multimap< int, std::string > corruptedRecordErrors;
+};
+
+//! Function to parse a catalogue of TLE data from a character buffer.
+/*!
+ *  Function to parse a catalogue of TLE data from a character buffer, directly into a structure of arrays. The fields
+ *  are extracted from their fixed columns without copying the lines or creating intermediate strings. The input is
+ *  processed in two passes, each distributed over a number of threads: first, the (non-empty) lines are located, after
+ *  which the records are parsed. The integrity checks of the TLE data (see
+ *  TwoLineElementsTextFileReader::checkTwoLineElementsFileIntegrity, in addition to checks on the line length and the
+ *  format of the numerical fields) are performed in the same pass in which the record is parsed. Empty lines are
+ *  skipped, and both Unix and Windows line endings are supported.
+ *  \param data Pointer to first character of buffer.
+ *  \param dataSize Number of characters in buffer.
+ *  \param lineNumberType Line number type of the records (two-line or three-line).
+ *  \param numberOfThreads Number of threads over which the parsing is distributed.
+ *  \param removeCorruptedRecords Boolean denoting whether records that fail the integrity checks are removed from the
+ *  catalogue (the errors are stored in the catalogue in either case).
+ *  \return Catalogue of TLE data.
+ */
+TwoLineElementCatalogue parseTwoLineElementCatalogue(
+        const char* data, const std::size_t dataSize,
+        const TwoLineElementsTextFileReader::LineNumberTypesForTwoLineElementInputData lineNumberType,
+        const unsigned int numberOfThreads = 1,
+        const bool removeCorruptedRecords = true );
+
+//! Function to read a catalogue of TLE data from a file.
+/*!
+ *  Function to read a catalogue of TLE data from a file. The file is memory-mapped (on platforms where this is
+ *  supported; otherwise it is read in a single block) and parsed with parseTwoLineElementCatalogue.
+ *  \param filePath Path to TLE catalogue file.
+ *  \param lineNumberType Line number type of the records (two-line or three-line).
+ *  \param numberOfThreads Number of threads over which the parsing is distributed.
+ *  \param removeCorruptedRecords Boolean denoting whether records that fail the integrity checks are removed from the
+ *  catalogue (the errors are stored in the catalogue in either case).
+ *  \return Catalogue of TLE data.
+ */
+TwoLineElementCatalogue readTwoLineElementCatalogue(
+        const std::string& filePath,
+        const TwoLineElementsTextFileReader::LineNumberTypesForTwoLineElementInputData lineNumberType,
+        const unsigned int numberOfThreads = 1,
+        const bool removeCorruptedRecords = true );
+
+} // namespace input_output
+} // namespace tudat
+
+#endif // TUDAT_TWO_LINE_ELEMENT_CATALOGUE_H
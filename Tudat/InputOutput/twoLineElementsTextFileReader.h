@@ -48,7 +48,8 @@ namespace input_output
 
 //! TLE catalog text file reader class.
 /*!
- * Definition of TLE catalog text file reader class.
+ * Definition of TLE catalog text file reader class. For large catalogues and archives, the
+ * readTwoLineElementCatalogue function (twoLineElementCatalogue.h) is considerably faster.
  */
 class TwoLineElementsTextFileReader
 {
@@ -93,7 +93,8 @@ static std::map< AtmosphereTypes, std::string > atmosphereTypes =
 };
 
 //! `AtmosphereTypes` not supported by `json_interface`.
-static std::vector< AtmosphereTypes > unsupportedAtmosphereTypes = { custom_constant_temperature_atmosphere };
+static std::vector< AtmosphereTypes > unsupportedAtmosphereTypes = { custom_constant_temperature_atmosphere,
+                                                                     gridded_atmosphere };
 
 //! Convert `AtmosphereTypes` to `json`.
 inline void to_json( nlohmann::json& jsonObject, const AtmosphereTypes& atmosphereType )
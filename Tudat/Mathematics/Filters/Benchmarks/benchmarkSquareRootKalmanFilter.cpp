@@ -0,0 +1,76 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmark comparing the run time per measurement update of the (square-root) extended and unscented Kalman
+ *      filters, for linear problems with 6, 20 and 60 states. Only built if BUILD_BENCHMARKS is set.
+ *
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include "Tudat/Mathematics/Filters/createFilter.h"
+#include "Tudat/Mathematics/Filters/UnitTests/linearFilteringProblem.h"
+
+int main( )
+{
+    using namespace tudat::filters;
+    using namespace tudat::unit_tests;
+
+    const std::vector< int > stateDimensions = { 6, 20, 60 };
+    const unsigned int numberOfSteps = 50;
+    const std::pair< double, double > unscentedParameters = std::make_pair( 1.0, 0.0 );
+    for ( unsigned int i = 0; i < stateDimensions.size( ); i++ )
+    {
+        LinearFilteringProblem problem( stateDimensions.at( i ) );
+
+        // Create filters
+        std::map< std::string, std::shared_ptr< FilterBase< > > > filters;
+        filters[ "EKF" ] = problem.createFilter(
+                    std::make_shared< ExtendedKalmanFilterSettings< > >(
+                        problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                        problem.initialStateEstimate, problem.initialCovarianceEstimate ) );
+        filters[ "SR-EKF" ] = problem.createFilter(
+                    std::make_shared< SquareRootExtendedKalmanFilterSettings< > >(
+                        problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                        problem.initialStateEstimate, problem.initialCovarianceEstimate ) );
+        filters[ "SR-EKF (sequential)" ] = problem.createFilter(
+                    std::make_shared< SquareRootExtendedKalmanFilterSettings< > >(
+                        problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                        problem.initialStateEstimate, problem.initialCovarianceEstimate, nullptr, true ) );
+        filters[ "UKF" ] = problem.createFilter(
+                    std::make_shared< UnscentedKalmanFilterSettings< > >(
+                        problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                        problem.initialStateEstimate, problem.initialCovarianceEstimate, nullptr,
+                        custom_parameters, unscentedParameters ) );
+        filters[ "SR-UKF" ] = problem.createFilter(
+                    std::make_shared< SquareRootUnscentedKalmanFilterSettings< > >(
+                        problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                        problem.initialStateEstimate, problem.initialCovarianceEstimate, nullptr,
+                        custom_parameters, unscentedParameters ) );
+
+        // Run filters and report time per measurement update
+        for ( std::map< std::string, std::shared_ptr< FilterBase< > > >::const_iterator filterIterator = filters.begin( );
+              filterIterator != filters.end( ); filterIterator++ )
+        {
+            std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+            runFilter( filterIterator->second, problem.measurements, numberOfSteps );
+            const double runTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+            std::cout << "Number of states: " << stateDimensions.at( i ) << ", filter: " << filterIterator->first
+                      << ", time per step: " << runTime / static_cast< double >( numberOfSteps ) << " s" << std::endl;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
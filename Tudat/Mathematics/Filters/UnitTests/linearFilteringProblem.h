@@ -0,0 +1,137 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_LINEAR_FILTERING_PROBLEM_H
+#define TUDAT_LINEAR_FILTERING_PROBLEM_H
+
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Filters/createFilter.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+//! Typedefs of filter functions.
+typedef std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > FilterFunction;
+typedef std::function< Eigen::MatrixXd( const double, const Eigen::VectorXd& ) > FilterMatrixFunction;
+
+//! Linear estimation problem with n states and n/2 (correlated) measurements.
+/*!
+ *  Linear estimation problem with n states and n/2 (correlated) measurements, for which the (square-root) extended and
+ *  unscented Kalman filters are equivalent. Used by the unit tests and benchmark of the square-root Kalman filters.
+ */
+struct LinearFilteringProblem
+{
+    LinearFilteringProblem( const int stateDimension )
+    {
+        const int measurementDimension = stateDimension / 2;
+
+        // Set system and measurement matrices
+        stateTransitionMatrix = Eigen::MatrixXd::Identity( stateDimension, stateDimension );
+        for ( int i = 0; i < stateDimension; i++ )
+        {
+            stateTransitionMatrix( i, ( i + 1 ) % stateDimension ) += 0.05;
+            stateTransitionMatrix( i, i ) -= 0.01 * static_cast< double >( i % 3 );
+        }
+        measurementMatrix = Eigen::MatrixXd::Zero( measurementDimension, stateDimension );
+        for ( int i = 0; i < measurementDimension; i++ )
+        {
+            measurementMatrix( i, 2 * i ) = 1.0;
+            measurementMatrix( i, 2 * i + 1 ) = 0.5;
+        }
+
+        // Set uncertainties (measurement uncertainty is not diagonal)
+        systemUncertainty = 0.05 * Eigen::MatrixXd::Identity( stateDimension, stateDimension );
+        measurementUncertainty = 0.1 * Eigen::MatrixXd::Identity( measurementDimension, measurementDimension );
+        for ( int i = 0; i < measurementDimension - 1; i++ )
+        {
+            measurementUncertainty( i, i + 1 ) = 0.02;
+            measurementUncertainty( i + 1, i ) = 0.02;
+        }
+        initialStateEstimate = Eigen::VectorXd::Constant( stateDimension, 1.0 );
+        initialCovarianceEstimate = Eigen::MatrixXd::Identity( stateDimension, stateDimension );
+
+        // Generate (deterministic) measurements of perturbed trajectory
+        Eigen::VectorXd currentState = Eigen::VectorXd::Zero( stateDimension );
+        for ( int i = 0; i < 50; i++ )
+        {
+            for ( int j = 0; j < stateDimension; j++ )
+            {
+                currentState( j ) = ( stateTransitionMatrix.row( j ) * currentState )( 0 ) + 0.2 * std::sin( 0.7 * i + j );
+            }
+            measurements.push_back( measurementMatrix * currentState +
+                                    0.3 * Eigen::VectorXd::NullaryExpr( measurementDimension, [ & ]( const int k ){
+                                        return std::cos( 1.3 * i + 2.1 * k ); } ) );
+        }
+    }
+
+    FilterFunction getSystemFunction( )
+    {
+        Eigen::MatrixXd matrix = stateTransitionMatrix;
+        return [ = ]( const double, const Eigen::VectorXd& state ){ return Eigen::VectorXd( matrix * state ); };
+    }
+
+    FilterFunction getMeasurementFunction( )
+    {
+        Eigen::MatrixXd matrix = measurementMatrix;
+        return [ = ]( const double, const Eigen::VectorXd& state ){ return Eigen::VectorXd( matrix * state ); };
+    }
+
+    FilterMatrixFunction getConstantMatrixFunction( const Eigen::MatrixXd& matrix )
+    {
+        return [ = ]( const double, const Eigen::VectorXd& ){ return matrix; };
+    }
+
+    std::shared_ptr< filters::FilterBase< > > createFilter(
+            const std::shared_ptr< filters::FilterSettings< > > filterSettings )
+    {
+        return filters::createFilter< double, double >(
+                    filterSettings, getSystemFunction( ), getMeasurementFunction( ),
+                    getConstantMatrixFunction( stateTransitionMatrix ),
+                    getConstantMatrixFunction( Eigen::MatrixXd::Identity( stateTransitionMatrix.rows( ),
+                                                                          stateTransitionMatrix.rows( ) ) ),
+                    getConstantMatrixFunction( measurementMatrix ),
+                    getConstantMatrixFunction( Eigen::MatrixXd::Identity( measurementMatrix.rows( ),
+                                                                          measurementMatrix.rows( ) ) ) );
+    }
+
+    Eigen::MatrixXd stateTransitionMatrix;
+    Eigen::MatrixXd measurementMatrix;
+    Eigen::MatrixXd systemUncertainty;
+    Eigen::MatrixXd measurementUncertainty;
+    Eigen::VectorXd initialStateEstimate;
+    Eigen::MatrixXd initialCovarianceEstimate;
+    std::vector< Eigen::VectorXd > measurements;
+};
+
+//! Function to run a filter over a given number of measurements.
+inline void runFilter( const std::shared_ptr< filters::FilterBase< > > filter,
+                       const std::vector< Eigen::VectorXd >& measurements, const unsigned int numberOfSteps )
+{
+    for ( unsigned int i = 0; i < numberOfSteps; i++ )
+    {
+        filter->updateFilter( measurements.at( i ) );
+    }
+}
+
+} // namespace unit_tests
+
+} // namespace tudat
+
+#endif // TUDAT_LINEAR_FILTERING_PROBLEM_H
@@ -0,0 +1,249 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/utilities.h"
+
+#include "Tudat/Mathematics/Filters/createFilter.h"
+#include "Tudat/Mathematics/Filters/UnitTests/linearFilteringProblem.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_square_root_kalman_filter )
+
+//! Function to check whether two matrices are equal, to within a tolerance relative to the norm of the reference matrix.
+void checkMatrixClose( const Eigen::MatrixXd& matrix, const Eigen::MatrixXd& referenceMatrix, const double tolerance )
+{
+    BOOST_CHECK_EQUAL( matrix.rows( ), referenceMatrix.rows( ) );
+    BOOST_CHECK_EQUAL( matrix.cols( ), referenceMatrix.cols( ) );
+    BOOST_CHECK_SMALL( ( matrix - referenceMatrix ).norm( ) / referenceMatrix.norm( ), tolerance );
+}
+
+//! Function to check whether the state and covariance estimates of two filters are equal.
+void checkFilterEstimates( const std::shared_ptr< filters::FilterBase< > > filter,
+                           const std::shared_ptr< filters::FilterBase< > > referenceFilter,
+                           const double tolerance )
+{
+    checkMatrixClose( filter->getCurrentStateEstimate( ), referenceFilter->getCurrentStateEstimate( ), tolerance );
+    checkMatrixClose( filter->getCurrentCovarianceEstimate( ), referenceFilter->getCurrentCovarianceEstimate( ), tolerance );
+    BOOST_CHECK_EQUAL( filter->getEstimatedCovarianceHistory( ).size( ),
+                       referenceFilter->getEstimatedCovarianceHistory( ).size( ) );
+}
+
+// Test square-root filters against the extended Kalman filter, for a linear system (for which the filters are equivalent).
+BOOST_AUTO_TEST_CASE( testSquareRootKalmanFiltersLinearSystem )
+{
+    using namespace tudat::filters;
+
+    LinearFilteringProblem problem( 6 );
+    const std::pair< double, double > unscentedParameters = std::make_pair( 1.0, 0.0 );
+
+    // Create filters
+    std::shared_ptr< FilterBase< > > extendedFilter = problem.createFilter(
+                std::make_shared< ExtendedKalmanFilterSettings< > >(
+                    problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                    problem.initialStateEstimate, problem.initialCovarianceEstimate ) );
+    std::shared_ptr< FilterBase< > > squareRootExtendedFilter = problem.createFilter(
+                std::make_shared< SquareRootExtendedKalmanFilterSettings< > >(
+                    problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                    problem.initialStateEstimate, problem.initialCovarianceEstimate ) );
+    std::shared_ptr< FilterBase< > > sequentialSquareRootExtendedFilter = problem.createFilter(
+                std::make_shared< SquareRootExtendedKalmanFilterSettings< > >(
+                    problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                    problem.initialStateEstimate, problem.initialCovarianceEstimate, nullptr, true ) );
+    std::shared_ptr< FilterBase< > > squareRootUnscentedFilter = problem.createFilter(
+                std::make_shared< SquareRootUnscentedKalmanFilterSettings< > >(
+                    problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                    problem.initialStateEstimate, problem.initialCovarianceEstimate, nullptr,
+                    custom_parameters, unscentedParameters ) );
+
+    // Run filters and compare to extended Kalman filter
+    const unsigned int numberOfSteps = problem.measurements.size( );
+    runFilter( extendedFilter, problem.measurements, numberOfSteps );
+    runFilter( squareRootExtendedFilter, problem.measurements, numberOfSteps );
+    runFilter( sequentialSquareRootExtendedFilter, problem.measurements, numberOfSteps );
+    runFilter( squareRootUnscentedFilter, problem.measurements, numberOfSteps );
+
+    checkFilterEstimates( squareRootExtendedFilter, extendedFilter, 1.0E-10 );
+    checkFilterEstimates( sequentialSquareRootExtendedFilter, extendedFilter, 1.0E-10 );
+    checkFilterEstimates( squareRootUnscentedFilter, extendedFilter, 1.0E-10 );
+
+    // Check that covariance square root is consistent with covariance, also after external modification
+    std::shared_ptr< SquareRootKalmanFilterBase< > > squareRootFilter =
+            std::dynamic_pointer_cast< SquareRootKalmanFilterBase< > >( sequentialSquareRootExtendedFilter );
+    Eigen::MatrixXd covarianceSquareRoot = squareRootFilter->getCurrentCovarianceSquareRoot( );
+    checkMatrixClose( Eigen::MatrixXd( covarianceSquareRoot * covarianceSquareRoot.transpose( ) ),
+                      squareRootFilter->getCurrentCovarianceEstimate( ), 1.0E-14 );
+
+    Eigen::MatrixXd modifiedCovariance = 2.0 * problem.initialCovarianceEstimate;
+    modifiedCovariance( 0, 0 ) = 0.0;
+    squareRootFilter->modifyCurrentStateAndCovarianceEstimates( problem.initialStateEstimate, modifiedCovariance );
+    covarianceSquareRoot = squareRootFilter->getCurrentCovarianceSquareRoot( );
+    checkMatrixClose( Eigen::MatrixXd( covarianceSquareRoot * covarianceSquareRoot.transpose( ) ),
+                      modifiedCovariance, 1.0E-14 );
+}
+
+// Constant parameters for example
+const double gravitationalParameter = 32.2;
+
+// Functions for extended Kalman filter (falling body, with unknown ballistic coefficient).
+Eigen::VectorXd stateFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 3 );
+    stateDerivative[ 0 ] = state[ 1 ];
+    stateDerivative[ 1 ] = 0.0034 * gravitationalParameter * std::exp( - state[ 0 ] / 22000.0 ) *
+            std::pow( state[ 1 ], 2 ) / ( 2.0 * state[ 2 ] ) - gravitationalParameter;
+    return stateDerivative;
+}
+Eigen::MatrixXd stateJacobianFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    const double dragFactor = 0.0034 * gravitationalParameter * std::exp( - state[ 0 ] / 22000.0 );
+    Eigen::MatrixXd stateJacobian = Eigen::MatrixXd::Zero( 3, 3 );
+    stateJacobian( 0, 1 ) = 1.0;
+    stateJacobian( 1, 0 ) = - dragFactor * std::pow( state[ 1 ], 2 ) / ( 44000.0 * state[ 2 ] );
+    stateJacobian( 1, 1 ) = dragFactor * state[ 1 ] / state[ 2 ];
+    stateJacobian( 1, 2 ) = - dragFactor * std::pow( state[ 1 ], 2 ) / ( 2.0 * std::pow( state[ 2 ], 2 ) );
+    return stateJacobian;
+}
+Eigen::VectorXd measurementFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    return state.segment( 0, 1 );
+}
+
+// Test square-root extended Kalman filter against extended Kalman filter, for an integrated nonlinear system.
+BOOST_AUTO_TEST_CASE( testSquareRootExtendedKalmanFilterIntegratedSystem )
+{
+    using namespace tudat::filters;
+
+    // Set initial conditions and uncertainties
+    const double initialTime = 0.0;
+    const double timeStep = 0.1;
+    Eigen::Vector3d initialStateVector( 200000.0, -6000.0, 500.0 );
+    Eigen::VectorXd initialEstimatedStateVector = Eigen::Vector3d( 200025.0, -6150.0, 800.0 );
+    Eigen::MatrixXd initialEstimatedStateCovarianceMatrix =
+            Eigen::Vector3d( std::pow( 1000.0, 2 ), 20000.0, std::pow( 300.0, 2 ) ).asDiagonal( );
+    Eigen::MatrixXd systemUncertainty = Eigen::Vector3d( std::pow( 100.0, 2 ), std::pow( 10.0, 2 ), 0.0 ).asDiagonal( );
+    Eigen::MatrixXd measurementUncertainty = Eigen::MatrixXd::Constant( 1, 1, std::pow( 25.0, 2 ) );
+
+    std::shared_ptr< numerical_integrators::IntegratorSettings< > > integratorSettings =
+            std::make_shared< numerical_integrators::IntegratorSettings< > > (
+                numerical_integrators::euler, initialTime, timeStep );
+
+    // Create filters
+    ExtendedKalmanFilterDoublePointer extendedFilter = std::make_shared< ExtendedKalmanFilterDouble >(
+                &stateFunction, &measurementFunction, &stateJacobianFunction,
+                [ ]( const double, const Eigen::VectorXd& ){ return Eigen::MatrixXd::Identity( 3, 3 ); },
+                [ ]( const double, const Eigen::VectorXd& ){ return Eigen::MatrixXd::Identity( 1, 3 ); },
+                [ ]( const double, const Eigen::VectorXd& ){ return Eigen::MatrixXd::Identity( 1, 1 ); },
+                systemUncertainty, measurementUncertainty, timeStep, initialTime, initialEstimatedStateVector,
+                initialEstimatedStateCovarianceMatrix, integratorSettings );
+    std::vector< SquareRootExtendedKalmanFilterDoublePointer > squareRootFilters;
+    for ( unsigned int i = 0; i < 2; i++ )
+    {
+        squareRootFilters.push_back(
+                    std::make_shared< SquareRootExtendedKalmanFilterDouble >(
+                        &stateFunction, &measurementFunction, &stateJacobianFunction,
+                        [ ]( const double, const Eigen::VectorXd& ){ return Eigen::MatrixXd::Identity( 3, 3 ); },
+                        [ ]( const double, const Eigen::VectorXd& ){ return Eigen::MatrixXd::Identity( 1, 3 ); },
+                        [ ]( const double, const Eigen::VectorXd& ){ return Eigen::MatrixXd::Identity( 1, 1 ); },
+                        systemUncertainty, measurementUncertainty, timeStep, initialTime, initialEstimatedStateVector,
+                        initialEstimatedStateCovarianceMatrix, integratorSettings, i == 1 ) );
+    }
+
+    // Simulate measurements and update filters
+    Eigen::VectorXd currentActualStateVector = initialStateVector;
+    for ( unsigned int i = 0; i < 300; i++ )
+    {
+        currentActualStateVector += stateFunction( 0.0, currentActualStateVector ) * timeStep;
+        Eigen::VectorXd currentMeasurementVector = measurementFunction( 0.0, currentActualStateVector ) +
+                Eigen::VectorXd::Constant( 1, 25.0 * std::sin( 3.7 * i ) );
+
+        extendedFilter->updateFilter( currentMeasurementVector );
+        for ( unsigned int j = 0; j < squareRootFilters.size( ); j++ )
+        {
+            squareRootFilters.at( j )->updateFilter( currentMeasurementVector );
+        }
+    }
+
+    // Check consistency of results
+    for ( unsigned int j = 0; j < squareRootFilters.size( ); j++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( squareRootFilters.at( j )->getCurrentTime( ), extendedFilter->getCurrentTime( ),
+                                    std::numeric_limits< double >::epsilon( ) );
+        checkMatrixClose( squareRootFilters.at( j )->getCurrentStateEstimate( ),
+                          extendedFilter->getCurrentStateEstimate( ), 1.0E-10 );
+        checkMatrixClose( squareRootFilters.at( j )->getCurrentCovarianceEstimate( ),
+                          extendedFilter->getCurrentCovarianceEstimate( ), 1.0E-8 );
+    }
+}
+
+// Test consistency of square-root filters and conventional filters, for problems with 6, 20 and 60 states.
+BOOST_AUTO_TEST_CASE( testSquareRootKalmanFiltersStateDimensions )
+{
+    using namespace tudat::filters;
+
+    const std::vector< int > stateDimensions = { 6, 20, 60 };
+    const unsigned int numberOfSteps = 10;
+    const std::pair< double, double > unscentedParameters = std::make_pair( 1.0, 0.0 );
+    for ( unsigned int i = 0; i < stateDimensions.size( ); i++ )
+    {
+        LinearFilteringProblem problem( stateDimensions.at( i ) );
+
+        // Create filters
+        std::map< std::string, std::shared_ptr< FilterBase< > > > filters;
+        filters[ "EKF" ] = problem.createFilter(
+                    std::make_shared< ExtendedKalmanFilterSettings< > >(
+                        problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                        problem.initialStateEstimate, problem.initialCovarianceEstimate ) );
+        filters[ "SR-EKF" ] = problem.createFilter(
+                    std::make_shared< SquareRootExtendedKalmanFilterSettings< > >(
+                        problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                        problem.initialStateEstimate, problem.initialCovarianceEstimate ) );
+        filters[ "SR-EKF (sequential)" ] = problem.createFilter(
+                    std::make_shared< SquareRootExtendedKalmanFilterSettings< > >(
+                        problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                        problem.initialStateEstimate, problem.initialCovarianceEstimate, nullptr, true ) );
+        filters[ "SR-UKF" ] = problem.createFilter(
+                    std::make_shared< SquareRootUnscentedKalmanFilterSettings< > >(
+                        problem.systemUncertainty, problem.measurementUncertainty, 1.0, 0.0,
+                        problem.initialStateEstimate, problem.initialCovarianceEstimate, nullptr,
+                        custom_parameters, unscentedParameters ) );
+
+        // Run filters, and check that results are consistent with the extended Kalman filter
+        for ( std::map< std::string, std::shared_ptr< FilterBase< > > >::const_iterator filterIterator = filters.begin( );
+              filterIterator != filters.end( ); filterIterator++ )
+        {
+            runFilter( filterIterator->second, problem.measurements, numberOfSteps );
+        }
+        for ( std::map< std::string, std::shared_ptr< FilterBase< > > >::const_iterator filterIterator = filters.begin( );
+              filterIterator != filters.end( ); filterIterator++ )
+        {
+            checkFilterEstimates( filterIterator->second, filters.at( "EKF" ), 1.0E-8 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
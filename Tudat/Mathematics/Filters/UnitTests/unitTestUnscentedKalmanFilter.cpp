@@ -391,6 +391,104 @@ BOOST_AUTO_TEST_CASE( testUnscentedKalmanFilterThirdCase )
     }
 }
 
+// Test that propagating the sigma points over multiple threads gives the same results as serial propagation.
+BOOST_AUTO_TEST_CASE( testUnscentedKalmanFilterMultiThreaded )
+{
+    using namespace tudat::filters;
+
+    // Set initial conditions
+    const double initialTime = 0.0;
+    const double timeStep = 0.1;
+    const unsigned int numberOfTimeSteps = 100;
+
+    Eigen::Vector3d initialStateVector;
+    initialStateVector << 200000.0, -6000.0, 500.0;
+    Eigen::Vector3d initialEstimatedStateVector;
+    initialEstimatedStateVector << 200025.0, -6150.0, 800.0;
+    Eigen::Matrix3d initialEstimatedStateCovarianceMatrix = Eigen::Vector3d( 1.0e6, 2.0e4, 9.0e4 ).asDiagonal( );
+
+    // Set system and measurement uncertainty
+    Eigen::Matrix3d systemUncertainty = Eigen::Vector3d( 1.0e4, 1.0e2, 1.0 ).asDiagonal( );
+    Eigen::Vector1d measurementUncertainty = Eigen::Vector1d::Constant( 625.0 );
+
+    // Set integrator settings
+    std::shared_ptr< numerical_integrators::IntegratorSettings< > > integratorSettings =
+            std::make_shared< numerical_integrators::IntegratorSettings< > > (
+                numerical_integrators::rungeKutta4, initialTime, timeStep );
+
+    // Create filters with one and four threads, and one filter without sigma point history
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > systemFunction =
+            [ ]( const double time, const Eigen::VectorXd& state )
+    {
+        return Eigen::VectorXd( stateFunction3( time, state, Eigen::Vector3d::Zero( ) ) );
+    };
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > measurementFunction =
+            [ ]( const double time, const Eigen::VectorXd& state )
+    {
+        return Eigen::VectorXd( measurementFunction3( time, state ) );
+    };
+    std::vector< UnscentedKalmanFilterDoublePointer > unscentedFilters;
+    for ( unsigned int i = 0; i < 3; i++ )
+    {
+        unscentedFilters.push_back(
+                    std::make_shared< UnscentedKalmanFilterDouble >(
+                        systemFunction, measurementFunction, systemUncertainty, measurementUncertainty, timeStep,
+                        initialTime, initialEstimatedStateVector, initialEstimatedStateCovarianceMatrix,
+                        integratorSettings, reference_Wan_and_Van_der_Merwe,
+                        std::make_pair( TUDAT_NAN, TUDAT_NAN ), ( i == 0 ) ? 1 : 4, i != 2 ) );
+    }
+    BOOST_CHECK_EQUAL( unscentedFilters.at( 0 )->getNumberOfThreads( ), 1 );
+    BOOST_CHECK_EQUAL( unscentedFilters.at( 1 )->getNumberOfThreads( ), 4 );
+
+    // Loop over each time step
+    double currentTime = initialTime;
+    Eigen::Vector3d currentActualStateVector = initialStateVector;
+    Eigen::Vector1d currentMeasurementVector;
+    for ( unsigned int i = 0; i < numberOfTimeSteps; i++ )
+    {
+        // Compute actual values and measurement
+        currentActualStateVector += stateFunction3( currentTime, currentActualStateVector, Eigen::Vector3d::Zero( ) ) * timeStep;
+        currentMeasurementVector = measurementFunction3( currentTime, currentActualStateVector );
+        currentMeasurementVector[ 0 ] += 25.0 * std::sin( static_cast< double >( i ) );
+
+        // Update filters
+        for ( unsigned int j = 0; j < unscentedFilters.size( ); j++ )
+        {
+            unscentedFilters.at( j )->updateFilter( currentMeasurementVector );
+        }
+        currentTime = unscentedFilters.at( 0 )->getCurrentTime( );
+    }
+
+    // Check that results are identical, regardless of number of threads
+    for ( unsigned int j = 1; j < unscentedFilters.size( ); j++ )
+    {
+        for ( int i = 0; i < initialStateVector.rows( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( unscentedFilters.at( j )->getCurrentStateEstimate( )[ i ],
+                               unscentedFilters.at( 0 )->getCurrentStateEstimate( )[ i ] );
+            for ( int k = 0; k < initialStateVector.rows( ); k++ )
+            {
+                BOOST_CHECK_EQUAL( unscentedFilters.at( j )->getCurrentCovarianceEstimate( )( i, k ),
+                                   unscentedFilters.at( 0 )->getCurrentCovarianceEstimate( )( i, k ) );
+            }
+        }
+    }
+
+    // Check sigma point history
+    std::map< double, Eigen::MatrixXd > serialSigmaPointHistory = unscentedFilters.at( 0 )->getHistoryOfSigmaPoints( );
+    std::map< double, Eigen::MatrixXd > parallelSigmaPointHistory = unscentedFilters.at( 1 )->getHistoryOfSigmaPoints( );
+    BOOST_CHECK_EQUAL( serialSigmaPointHistory.size( ), numberOfTimeSteps );
+    BOOST_CHECK_EQUAL( parallelSigmaPointHistory.size( ), numberOfTimeSteps );
+    for ( std::map< double, Eigen::MatrixXd >::const_iterator historyIterator = serialSigmaPointHistory.begin( );
+          historyIterator != serialSigmaPointHistory.end( ); historyIterator++ )
+    {
+        BOOST_CHECK_EQUAL( historyIterator->second.rows( ), 7 );
+        BOOST_CHECK_EQUAL( historyIterator->second.cols( ), 15 );
+        BOOST_CHECK( historyIterator->second == parallelSigmaPointHistory.at( historyIterator->first ) );
+    }
+    BOOST_CHECK( unscentedFilters.at( 2 )->getHistoryOfSigmaPoints( ).empty( ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -22,6 +22,8 @@
 
 #include "Tudat/Mathematics/Filters/extendedKalmanFilter.h"
 #include "Tudat/Mathematics/Filters/linearKalmanFilter.h"
+#include "Tudat/Mathematics/Filters/squareRootExtendedKalmanFilter.h"
+#include "Tudat/Mathematics/Filters/squareRootUnscentedKalmanFilter.h"
 #include "Tudat/Mathematics/Filters/unscentedKalmanFilter.h"
 
 namespace tudat
@@ -35,7 +37,9 @@ enum AvailableFilteringTechniques
 {
     linear_kalman_filter = 0,
     extended_kalman_filter = 1,
-    unscented_kalman_filter = 2
+    unscented_kalman_filter = 2,
+    square_root_extended_kalman_filter = 3,
+    square_root_unscented_kalman_filter = 4
 };
 
 //! Filter settings.
@@ -207,6 +211,8 @@ public:
      *      variable has to be part of the ConstantParameterReferences enumeration (custom parameters are supported).
      *  \param customConstantParameters Values of the constant parameters \f$ \alpha \f$ and \f$ \kappa \f$, in case the custom_parameters
      *      enumeration is used in the previous field.
+     *  \param numberOfThreads Number of threads over which the propagation of the sigma points is distributed.
+     *  \param saveSigmaPointHistory Boolean denoting whether the sigma points are to be stored at each time step.
      */
     UnscentedKalmanFilterSettings( const DependentMatrix& systemUncertainty,
                                    const DependentMatrix& measurementUncertainty,
@@ -218,11 +224,130 @@ public:
                                    const ConstantParameterReferences constantValueReference = reference_Wan_and_Van_der_Merwe,
                                    const std::pair< DependentVariableType, DependentVariableType > customConstantParameters =
             std::make_pair( static_cast< DependentVariableType >( TUDAT_NAN ),
-                            static_cast< DependentVariableType >( TUDAT_NAN ) ) ) :
+                            static_cast< DependentVariableType >( TUDAT_NAN ) ),
+                                   const unsigned int numberOfThreads = 1,
+                                   const bool saveSigmaPointHistory = true ) :
         FilterSettings< IndependentVariableType, DependentVariableType >( unscented_kalman_filter,
                                                                           systemUncertainty, measurementUncertainty,
                                                                           filteringStepSize, initialTime, initialStateVector,
                                                                           initialCovarianceMatrix, integratorSettings ),
+        constantValueReference_( constantValueReference ), customConstantParameters_( customConstantParameters ),
+        numberOfThreads_( numberOfThreads ), saveSigmaPointHistory_( saveSigmaPointHistory )
+    { }
+
+    //! Enumeration denoting the reference to use for the alpha and kappa paramters.
+    const ConstantParameterReferences constantValueReference_;
+
+    //! Custom value of the alpha and kappa paramters.
+    const std::pair< DependentVariableType, DependentVariableType > customConstantParameters_;
+
+    //! Number of threads over which the propagation of the sigma points is distributed.
+    const unsigned int numberOfThreads_;
+
+    //! Boolean denoting whether the sigma points are to be stored at each time step.
+    const bool saveSigmaPointHistory_;
+
+};
+
+//! Square-root extended Kalman filter settings.
+/*!
+ *  Square-root extended Kalman filter settings.
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class SquareRootExtendedKalmanFilterSettings : public FilterSettings< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::IntegratorSettings IntegratorSettings;
+
+    //! Default constructor.
+    /*!
+     *  Default constructor.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system. It is used as first
+     *      a-priori estimate of the state vector.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system. It is used as first
+     *      a-priori estimate of the covariance matrix.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     *  \param processMeasurementsSequentially Boolean denoting whether the elements of the measurement vector are to be
+     *      processed sequentially as scalar measurements (true), or simultaneously (false).
+     */
+    SquareRootExtendedKalmanFilterSettings( const DependentMatrix& systemUncertainty,
+                                            const DependentMatrix& measurementUncertainty,
+                                            const IndependentVariableType filteringStepSize,
+                                            const IndependentVariableType initialTime,
+                                            const DependentVector& initialStateVector,
+                                            const DependentMatrix& initialCovarianceMatrix,
+                                            const std::shared_ptr< IntegratorSettings > integratorSettings = nullptr,
+                                            const bool processMeasurementsSequentially = false ) :
+        FilterSettings< IndependentVariableType, DependentVariableType >( square_root_extended_kalman_filter,
+                                                                          systemUncertainty, measurementUncertainty,
+                                                                          filteringStepSize, initialTime, initialStateVector,
+                                                                          initialCovarianceMatrix, integratorSettings ),
+        processMeasurementsSequentially_( processMeasurementsSequentially )
+    { }
+
+    //! Boolean denoting whether the elements of the measurement vector are to be processed sequentially.
+    const bool processMeasurementsSequentially_;
+
+};
+
+//! Square-root unscented Kalman filter settings.
+/*!
+ *  Square-root unscented Kalman filter settings.
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class SquareRootUnscentedKalmanFilterSettings : public FilterSettings< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::IntegratorSettings IntegratorSettings;
+
+    //! Default constructor.
+    /*!
+     *  Default constructor.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system. It is used as first
+     *      a-priori estimate of the state vector.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system. It is used as first
+     *      a-priori estimate of the covariance matrix.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     *  \param constantValueReference Reference to be used for the values of the \f$ \alpha \f$ and \f$ \kappa \f$ parameters. This
+     *      variable has to be part of the ConstantParameterReferences enumeration (custom parameters are supported).
+     *  \param customConstantParameters Values of the constant parameters \f$ \alpha \f$ and \f$ \kappa \f$, in case the custom_parameters
+     *      enumeration is used in the previous field.
+     */
+    SquareRootUnscentedKalmanFilterSettings( const DependentMatrix& systemUncertainty,
+                                             const DependentMatrix& measurementUncertainty,
+                                             const IndependentVariableType filteringStepSize,
+                                             const IndependentVariableType initialTime,
+                                             const DependentVector& initialStateVector,
+                                             const DependentMatrix& initialCovarianceMatrix,
+                                             const std::shared_ptr< IntegratorSettings > integratorSettings = nullptr,
+                                             const ConstantParameterReferences constantValueReference = reference_Wan_and_Van_der_Merwe,
+                                             const std::pair< DependentVariableType, DependentVariableType > customConstantParameters =
+            std::make_pair( static_cast< DependentVariableType >( TUDAT_NAN ),
+                            static_cast< DependentVariableType >( TUDAT_NAN ) ) ) :
+        FilterSettings< IndependentVariableType, DependentVariableType >( square_root_unscented_kalman_filter,
+                                                                          systemUncertainty, measurementUncertainty,
+                                                                          filteringStepSize, initialTime, initialStateVector,
+                                                                          initialCovarianceMatrix, integratorSettings ),
         constantValueReference_( constantValueReference ), customConstantParameters_( customConstantParameters )
     { }
 
@@ -333,7 +458,71 @@ createFilter( const std::shared_ptr< FilterSettings< IndependentVariableType, De
                     unscentedKalmanFilterSettings->filteringStepSize_, unscentedKalmanFilterSettings->initialTime_,
                     unscentedKalmanFilterSettings->initialStateEstimate_, unscentedKalmanFilterSettings->initialCovarianceEstimate_,
                     unscentedKalmanFilterSettings->integratorSettings_, unscentedKalmanFilterSettings->constantValueReference_,
-                    unscentedKalmanFilterSettings->customConstantParameters_ );
+                    unscentedKalmanFilterSettings->customConstantParameters_,
+                    unscentedKalmanFilterSettings->numberOfThreads_, unscentedKalmanFilterSettings->saveSigmaPointHistory_ );
+        break;
+    }
+    case square_root_extended_kalman_filter:
+    {
+        // Cast filter settings to square-root extended Kalman filter
+        std::shared_ptr< SquareRootExtendedKalmanFilterSettings< IndependentVariableType, DependentVariableType > >
+                squareRootExtendedKalmanFilterSettings = std::dynamic_pointer_cast<
+                SquareRootExtendedKalmanFilterSettings< IndependentVariableType, DependentVariableType > >( filterSettings );
+        if ( squareRootExtendedKalmanFilterSettings == nullptr )
+        {
+            throw std::runtime_error( "Error while creating square-root extended Kalman filter object. Type of filter settings "
+                                      "(SquareRootExtendedKalmanFilter) not compatible with selected filter (derived class of "
+                                      "FilterSettings must be SquareRootExtendedKalmanFilterSettings for this type)." );
+        }
+
+        // Check that optional inputs are present
+        if ( ( stateJacobianFunction == nullptr ) || ( stateNoiseJacobianFunction == nullptr ) ||
+             ( measurementJacobianFunction == nullptr ) || ( measurementNoiseJacobianFunction == nullptr ) )
+        {
+            throw std::runtime_error( "Error while creating square-root extended Kalman filter object. A "
+                                      "SquareRootExtendedKalmanFilter object requires the input of the four Jacobian functions "
+                                      "for state and measurement (including noise)." );
+        }
+
+        // Create filter
+        createdFilter = std::make_shared< SquareRootExtendedKalmanFilter< IndependentVariableType, DependentVariableType > >(
+                    systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+                    measurementJacobianFunction, measurementNoiseJacobianFunction,
+                    squareRootExtendedKalmanFilterSettings->systemUncertainty_,
+                    squareRootExtendedKalmanFilterSettings->measurementUncertainty_,
+                    squareRootExtendedKalmanFilterSettings->filteringStepSize_,
+                    squareRootExtendedKalmanFilterSettings->initialTime_,
+                    squareRootExtendedKalmanFilterSettings->initialStateEstimate_,
+                    squareRootExtendedKalmanFilterSettings->initialCovarianceEstimate_,
+                    squareRootExtendedKalmanFilterSettings->integratorSettings_,
+                    squareRootExtendedKalmanFilterSettings->processMeasurementsSequentially_ );
+        break;
+    }
+    case square_root_unscented_kalman_filter:
+    {
+        // Cast filter settings to square-root unscented Kalman filter
+        std::shared_ptr< SquareRootUnscentedKalmanFilterSettings< IndependentVariableType, DependentVariableType > >
+                squareRootUnscentedKalmanFilterSettings = std::dynamic_pointer_cast<
+                SquareRootUnscentedKalmanFilterSettings< IndependentVariableType, DependentVariableType > >( filterSettings );
+        if ( squareRootUnscentedKalmanFilterSettings == nullptr )
+        {
+            throw std::runtime_error( "Error while creating square-root unscented Kalman filter object. Type of filter settings "
+                                      "(SquareRootUnscentedKalmanFilter) not compatible with selected filter (derived class of "
+                                      "FilterSettings must be SquareRootUnscentedKalmanFilterSettings for this type)." );
+        }
+
+        // Create filter
+        createdFilter = std::make_shared< SquareRootUnscentedKalmanFilter< IndependentVariableType, DependentVariableType > >(
+                    systemFunction, measurementFunction,
+                    squareRootUnscentedKalmanFilterSettings->systemUncertainty_,
+                    squareRootUnscentedKalmanFilterSettings->measurementUncertainty_,
+                    squareRootUnscentedKalmanFilterSettings->filteringStepSize_,
+                    squareRootUnscentedKalmanFilterSettings->initialTime_,
+                    squareRootUnscentedKalmanFilterSettings->initialStateEstimate_,
+                    squareRootUnscentedKalmanFilterSettings->initialCovarianceEstimate_,
+                    squareRootUnscentedKalmanFilterSettings->integratorSettings_,
+                    squareRootUnscentedKalmanFilterSettings->constantValueReference_,
+                    squareRootUnscentedKalmanFilterSettings->customConstantParameters_ );
         break;
     }
     default:
@@ -184,25 +184,8 @@ private:
     std::pair< DependentMatrix, DependentMatrix > generateDiscreteTimeSystemJacobians(
             const DependentVector& currentStateVector )
     {
-        // Pre-compute Jacobians
-        DependentMatrix stateJacobian = stateJacobianFunction_( this->currentTime_, currentStateVector );
-        DependentMatrix noiseJacobian = stateNoiseJacobianFunction_( this->currentTime_, currentStateVector );
-
-        // Get sizes
-        unsigned int stateDimension = stateJacobian.rows( );
-        unsigned int noiseCols = noiseJacobian.cols( );
-
-        // Merge Jacobians in one matrix
-        DependentMatrix continuousJacobians = DependentMatrix::Zero( stateDimension + noiseCols, stateDimension + noiseCols );
-        continuousJacobians.block( 0, 0, stateDimension, stateDimension ) = stateJacobian;
-        continuousJacobians.block( 0, stateDimension, stateDimension, noiseCols ) = noiseJacobian;
-
-        // Generate discrete-time Jacobians
-        DependentMatrix discreteJacobians = ( continuousJacobians * this->filteringStepSize_ ).exp( );
-
-        // Extract state and noise Jacobians
-        return std::make_pair( discreteJacobians.block( 0, 0, stateDimension, stateDimension ),
-                               discreteJacobians.block( 0, stateDimension, stateDimension, noiseCols ) );
+        return this->computeDiscreteTimeSystemJacobians( stateJacobianFunction_( this->currentTime_, currentStateVector ),
+                                                         stateNoiseJacobianFunction_( this->currentTime_, currentStateVector ) );
     }
 
     //! System function input by user.
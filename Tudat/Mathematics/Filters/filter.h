@@ -89,7 +89,8 @@ public:
                 const std::shared_ptr< IntegratorSettings > integratorSettings ) :
         systemUncertainty_( systemUncertainty ), measurementUncertainty_( measurementUncertainty ),
         filteringStepSize_( filteringStepSize ), initialTime_( initialTime ), currentTime_( initialTime ),
-        aPosterioriStateEstimate_( initialStateVector ), aPosterioriCovarianceEstimate_( initialCovarianceMatrix )
+        aPosterioriStateEstimate_( initialStateVector ), aPosterioriCovarianceEstimate_( initialCovarianceMatrix ),
+        integratorSettings_( integratorSettings )
     {
         // Check that uncertainty matrices are square
         if ( systemUncertainty_.rows( ) != systemUncertainty_.cols( ) )
@@ -120,7 +121,7 @@ public:
         isStateToBeIntegrated_ = integratorSettings != nullptr;
         if ( isStateToBeIntegrated_ )
         {
-            generateNumericalIntegrator( integratorSettings );
+            generateNumericalIntegrator( );
         }
 
         // Generate identity matrix
@@ -284,6 +285,7 @@ public:
         if ( !newCovarianceEstimate.isZero( ) )
         {
             aPosterioriCovarianceEstimate_ = newCovarianceEstimate;
+            specificModifyCurrentCovarianceEstimate( );
         }
     }
 
@@ -408,6 +410,50 @@ protected:
      */
     virtual void specificRevertToPreviousTimeStep( const double timeToBeRemoved ) { TUDAT_UNUSED_PARAMETER( timeToBeRemoved ); }
 
+    //! Function to update derived class-specific variables after the covariance estimate has been modified externally.
+    /*!
+     *  Function to update derived class-specific variables after the a-posteriori covariance estimate has been modified with
+     *  external data. This function can be overwritten in a derived class, e.g., to recompute a factorization of the covariance.
+     */
+    virtual void specificModifyCurrentCovarianceEstimate( ) { }
+
+    //! Function to create a numerical integrator to be used for propagation of the state.
+    /*!
+     *  Function to create a numerical integrator to be used for propagation of the state, based on the integrator settings
+     *  provided upon construction and the input differential equation. This function is used to create the integrator of the
+     *  filter, and can be used by derived classes to create additional integrators (e.g., one per thread) with identical
+     *  settings, but with a different system function.
+     *  \param systemFunction Function returning the state derivative as a function of time and state vector.
+     *  \return Numerical integrator, with step-size control turned off.
+     */
+    std::shared_ptr< Integrator > createNumericalIntegrator( const Function& systemFunction )
+    {
+        std::shared_ptr< Integrator > integrator;
+        switch ( integratorSettings_->integratorType_ )
+        {
+        case numerical_integrators::euler:
+        case numerical_integrators::rungeKutta4:
+        {
+            integrator = numerical_integrators::createIntegrator< IndependentVariableType, DependentVector >(
+                        systemFunction, aPosterioriStateEstimate_, integratorSettings_ );
+            break;
+        }
+        case numerical_integrators::rungeKuttaVariableStepSize:
+        {
+            // Create integrator object
+            integrator = numerical_integrators::createIntegrator< IndependentVariableType, DependentVector >(
+                        systemFunction, aPosterioriStateEstimate_, integratorSettings_ );
+
+            // Turn off step-size control
+            integrator->setStepSizeControl( false );
+            break;
+        }
+        default:
+            throw std::runtime_error( "Error in setting up filter. Only Euler and Runge-Kutta integrators are supported." );
+        }
+        return integrator;
+    }
+
     //! System function.
     /*!
      *  System function that will be used to retrieve the a-priori estimated state for the next step.
@@ -459,6 +505,9 @@ protected:
      */
     std::shared_ptr< Integrator > integrator_;
 
+    //! Pointer to the integrator settings (nullptr if the state is not integrated).
+    const std::shared_ptr< IntegratorSettings > integratorSettings_;
+
     //! Indentity matrix.
     /*!
      *  Indentity matrix with the correct dimensions for the specific application.
@@ -523,43 +572,24 @@ private:
      *  Function to generate the numerical integrator to be used for propagation of the state, based on the integrator
      *  settings and the systemFunction_ input by the user. The systemFunction_ therefore acts as the differential equation
      *  for the system.
-     *  \param integratorSettings Pointer to integration settings.
      */
-    void generateNumericalIntegrator( const std::shared_ptr< IntegratorSettings > integratorSettings )
+    void generateNumericalIntegrator( )
     {
         // Check that integration time-step matches filtering time-step
-        if ( filteringStepSize_ != integratorSettings->initialTimeStep_ )
+        if ( filteringStepSize_ != integratorSettings_->initialTimeStep_ )
         {
             throw std::runtime_error( "Error while setting up filter. The filtering and integration step sizes do not match." );
         }
 
-        // Generate integrator
-        switch ( integratorSettings->integratorType_ )
-        {
-        case numerical_integrators::euler:
-        case numerical_integrators::rungeKutta4:
-        {
-            integrator_ = numerical_integrators::createIntegrator< IndependentVariableType, DependentVector >(
-                        systemFunction_, aPosterioriStateEstimate_, integratorSettings );
-            break;
-        }
-        case numerical_integrators::rungeKuttaVariableStepSize:
+        // Warn user of changes that will be made
+        if ( integratorSettings_->integratorType_ == numerical_integrators::rungeKuttaVariableStepSize )
         {
-            // Warn user of changes that will be made
             std::cerr << "Warning in setting up filter. Integrator requested is variable step-size, but only constant "
                          "step-size integrators are supported. Step-size control will be turned off." << std::endl;
-
-            // Create integrator object
-            integrator_ = numerical_integrators::createIntegrator< IndependentVariableType, DependentVector >(
-                        systemFunction_, aPosterioriStateEstimate_, integratorSettings );
-
-            // Turn off step-size control
-            integrator_->setStepSizeControl( false );
-            break;
-        }
-        default:
-            throw std::runtime_error( "Error in setting up filter. Only Euler and Runge-Kutta integrators are supported." );
         }
+
+        // Generate integrator
+        integrator_ = createNumericalIntegrator( systemFunction_ );
     }
 
     //! Vector where the system noise generators are stored.
@@ -89,10 +89,27 @@ protected:
      */
     DependentVector predictState( const DependentVector& currentStateVector )
     {
-        return this->isStateToBeIntegrated_ ? propagateState( currentStateVector ) :
+        return this->isStateToBeIntegrated_ ? propagateState( currentStateVector, this->integrator_ ) :
                                               this->systemFunction_( this->currentTime_, currentStateVector );
     }
 
+    //! Function to propagate state to the next time step, with a given integrator.
+    /*!
+     *  Function to propagate state to the next time step, by overwriting the state of the given integrator, which must have
+     *  been created with the settings of the filter (see createNumericalIntegrator).
+     *  \param currentStateVector Vector representing the current state (which overwrites the previous state).
+     *  \param integrator Integrator to be used for the propagation.
+     *  \return Propagated state at the requested time.
+     */
+    DependentVector propagateState( const DependentVector& currentStateVector, const std::shared_ptr< Integrator > integrator )
+    {
+        // Reset time and state
+        integrator->modifyCurrentIntegrationVariables( currentStateVector, this->currentTime_ );
+
+        // Integrate equations
+        return integrator->performIntegrationStep( this->filteringStepSize_ );
+    }
+
     //! Function to correct the covariance for the next time step.
     /*!
      *  Function to correct the covariance for the next time step.
@@ -110,22 +127,32 @@ protected:
         this->historyOfCovarianceEstimates_[ this->currentTime_ ] = this->aPosterioriCovarianceEstimate_;
     }
 
-private:
-
-    //! Function to propagate state to the next time step, by overwriting previous state.
+    //! Function to generate the discrete-time version of the system Jacobians.
     /*!
-     *  Function to propagate state to the next time step, by overwriting previous state, with the use of the integrator
-     *  provided in the integratorSettings.
-     *  \param currentStateVector Vector representing the current state (which overwrites the previous state).
-     *  \return Propagated state at the requested time.
+     *  Function to generate the discrete-time version of the system Jacobians, from the continuous-time
+     *  versions. The transformation is carried out by using the matrix exponential.
+     *  \param stateJacobian Continuous-time Jacobian of the system w.r.t. the state.
+     *  \param noiseJacobian Continuous-time Jacobian of the system w.r.t. the system noise.
+     *  \return Pair of discrete-time state and noise Jacobians.
      */
-    DependentVector propagateState( const DependentVector& currentStateVector )
+    std::pair< DependentMatrix, DependentMatrix > computeDiscreteTimeSystemJacobians( const DependentMatrix& stateJacobian,
+                                                                                      const DependentMatrix& noiseJacobian )
     {
-        // Reset time and state
-        this->integrator_->modifyCurrentIntegrationVariables( currentStateVector, this->currentTime_ );
+        // Get sizes
+        unsigned int stateDimension = stateJacobian.rows( );
+        unsigned int noiseCols = noiseJacobian.cols( );
 
-        // Integrate equations
-        return this->integrator_->performIntegrationStep( this->filteringStepSize_ );
+        // Merge Jacobians in one matrix
+        DependentMatrix continuousJacobians = DependentMatrix::Zero( stateDimension + noiseCols, stateDimension + noiseCols );
+        continuousJacobians.block( 0, 0, stateDimension, stateDimension ) = stateJacobian;
+        continuousJacobians.block( 0, stateDimension, stateDimension, noiseCols ) = noiseJacobian;
+
+        // Generate discrete-time Jacobians
+        DependentMatrix discreteJacobians = ( continuousJacobians * this->filteringStepSize_ ).exp( );
+
+        // Extract state and noise Jacobians
+        return std::make_pair( discreteJacobians.block( 0, 0, stateDimension, stateDimension ),
+                               discreteJacobians.block( 0, stateDimension, stateDimension, noiseCols ) );
     }
 
 };
@@ -0,0 +1,355 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Bierman, G. J., Factorization Methods for Discrete Sequential Estimation, Academic Press, 1977.
+ *      Kaminski, P., Bryson, A., and Schmidt, S., "Discrete Square Root Filtering: A Survey of Current Techniques,"
+ *          IEEE Transactions on Automatic Control, vol. 16, no. 6, pp. 727-736, 1971.
+ */
+
+#ifndef TUDAT_SQUARE_ROOT_EXTENDED_KALMAN_FILTER_H
+#define TUDAT_SQUARE_ROOT_EXTENDED_KALMAN_FILTER_H
+
+#include "Tudat/Mathematics/Filters/squareRootKalmanFilter.h"
+
+namespace tudat
+{
+
+namespace filters
+{
+
+//! Square-root extended Kalman filter class.
+/*!
+ *  Class for the set up and use of the square-root extended Kalman filter. The system and measurement models, and their
+ *  Jacobians, are defined identically to those of the ExtendedKalmanFilter class, but a square root of the covariance is
+ *  propagated instead of the covariance itself. In the prediction step, the square root is obtained by triangularizing the
+ *  compound square root \f$ [ F S, G S_Q ] \f$. The measurements can be processed either simultaneously, by triangularizing
+ *  the pre-array of the measurement update (array algorithm of [Kaminski, P., et al.]), or sequentially, one scalar
+ *  measurement at a time, with Potter's square-root update [Bierman, G. J.]. In the latter case, the measurements are first
+ *  decorrelated with the (triangular) square root of the measurement uncertainty, after which each scalar update only
+ *  requires matrix-vector operations. In neither case is a matrix inverse computed.
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class SquareRootExtendedKalmanFilter: public SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >::Function Function;
+    typedef typename SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >::MatrixFunction MatrixFunction;
+    typedef typename SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >::IntegratorSettings
+    IntegratorSettings;
+    typedef typename SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >::Integrator Integrator;
+
+    //! Default constructor.
+    /*!
+     *  Default constructor. This constructor takes state and measurement functions and their respective
+     *  Jacobian functions as inputs. These functions can be a function of time and state vector.
+     *  \param systemFunction Function returning the state as a function of time and state vector. Can be a differential
+     *      equation if the integratorSettings is set (i.e., if it is not a nullptr).
+     *  \param measurementFunction Function returning the measurement as a function of time and state.
+     *  \param stateJacobianFunction Function returning the Jacobian of the system w.r.t. the state. The input values can
+     *      be time and state vector.
+     *  \param stateNoiseJacobianFunction Function returning the Jacobian of the system function w.r.t. the system noise. The
+     *      input values can be time and state vector.
+     *  \param measurementJacobianFunction Function returning the Jacobian of the measurement function w.r.t. the state. The input
+     *      values can be time and state vector.
+     *  \param measurementNoiseJacobianFunction Function returning the Jacobian of the measurement function w.r.t. the measurement
+     *      noise. The input values can be time and state vector.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system. It is used as first
+     *      a-priori estimate of the state vector.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system. It is used as first
+     *      a-priori estimate of the covariance matrix.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     *  \param processMeasurementsSequentially Boolean denoting whether the elements of the measurement vector are to be
+     *      processed sequentially as scalar measurements (true), or simultaneously (false).
+     */
+    SquareRootExtendedKalmanFilter( const Function& systemFunction,
+                                    const Function& measurementFunction,
+                                    const MatrixFunction& stateJacobianFunction,
+                                    const MatrixFunction& stateNoiseJacobianFunction,
+                                    const MatrixFunction& measurementJacobianFunction,
+                                    const MatrixFunction& measurementNoiseJacobianFunction,
+                                    const DependentMatrix& systemUncertainty,
+                                    const DependentMatrix& measurementUncertainty,
+                                    const IndependentVariableType filteringStepSize,
+                                    const IndependentVariableType initialTime,
+                                    const DependentVector& initialStateVector,
+                                    const DependentMatrix& initialCovarianceMatrix,
+                                    const std::shared_ptr< IntegratorSettings > integratorSettings = nullptr,
+                                    const bool processMeasurementsSequentially = false ) :
+        SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >(
+            systemUncertainty, measurementUncertainty, filteringStepSize, initialTime, initialStateVector,
+            initialCovarianceMatrix, integratorSettings ),
+        inputSystemFunction_( systemFunction ), inputMeasurementFunction_( measurementFunction ),
+        stateJacobianFunction_( stateJacobianFunction ), stateNoiseJacobianFunction_( stateNoiseJacobianFunction ),
+        measurementJacobianFunction_( measurementJacobianFunction ),
+        measurementNoiseJacobianFunction_( measurementNoiseJacobianFunction ),
+        processMeasurementsSequentially_( processMeasurementsSequentially )
+    {
+        // Set dimensions
+        stateDimension_ = systemUncertainty.rows( );
+        measurementNoiseDimension_ = measurementUncertainty.rows( );
+
+        // Allocate compound square root used in prediction step
+        predictionCompoundSquareRoot_ = DependentMatrix::Zero( stateDimension_, 2 * stateDimension_ );
+    }
+
+    //! Destructor.
+    ~SquareRootExtendedKalmanFilter( ){ }
+
+    //! Function to update the filter with the new step data.
+    /*!
+     *  Function to update the filter with the new step data.
+     *  \param currentMeasurementVector Vector representing current measurement.
+     */
+    void updateFilter( const DependentVector& currentMeasurementVector )
+    {
+        // Prediction step
+        DependentVector aPrioriStateEstimate = this->predictState( );
+        DependentMatrix currentStateJacobianMatrix;
+        DependentMatrix currentStateNoiseJacobianMatrix;
+        if ( this->isStateToBeIntegrated_ )
+        {
+            std::pair< DependentMatrix, DependentMatrix > discreteTimeJacobians =
+                    this->computeDiscreteTimeSystemJacobians(
+                        stateJacobianFunction_( this->currentTime_, aPrioriStateEstimate ),
+                        stateNoiseJacobianFunction_( this->currentTime_, aPrioriStateEstimate ) );
+            currentStateJacobianMatrix = discreteTimeJacobians.first;
+            currentStateNoiseJacobianMatrix = discreteTimeJacobians.second;
+        }
+        else
+        {
+            currentStateJacobianMatrix = stateJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
+            currentStateNoiseJacobianMatrix = stateNoiseJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
+        }
+        DependentVector measurementEstimate = this->measurementFunction_( this->currentTime_, aPrioriStateEstimate );
+
+        // Compute remaining Jacobians
+        DependentMatrix currentMeasurementJacobianMatrix =
+                measurementJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
+        DependentMatrix currentMeasurementNoiseJacobianMatrix =
+                measurementNoiseJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
+
+        // Prediction step (continued), compute a-priori covariance square root
+        predictionCompoundSquareRoot_.leftCols( stateDimension_ ).noalias( ) =
+                currentStateJacobianMatrix * this->covarianceSquareRoot_;
+        predictionCompoundSquareRoot_.rightCols( stateDimension_ ).noalias( ) =
+                currentStateNoiseJacobianMatrix * this->systemUncertaintySquareRoot_;
+        this->triangularizeSquareRoot( predictionCompoundSquareRoot_, this->covarianceSquareRoot_ );
+
+        // Correction step
+        this->currentTime_ += this->filteringStepSize_;
+        if ( processMeasurementsSequentially_ )
+        {
+            correctStateAndCovarianceSequentially(
+                        aPrioriStateEstimate, currentMeasurementVector - measurementEstimate,
+                        currentMeasurementJacobianMatrix, currentMeasurementNoiseJacobianMatrix );
+        }
+        else
+        {
+            correctStateAndCovariance( aPrioriStateEstimate, currentMeasurementVector - measurementEstimate,
+                                       currentMeasurementJacobianMatrix, currentMeasurementNoiseJacobianMatrix );
+        }
+        this->storeCovarianceEstimate( );
+    }
+
+    //! Function to retrieve whether the measurements are processed sequentially.
+    bool getProcessMeasurementsSequentially( ) { return processMeasurementsSequentially_; }
+
+    //! Function to reset whether the measurements are to be processed sequentially.
+    /*!
+     *  Function to reset whether the elements of the measurement vector are to be processed sequentially as scalar
+     *  measurements, or simultaneously.
+     *  \param processMeasurementsSequentially Boolean denoting whether measurements are to be processed sequentially.
+     */
+    void setProcessMeasurementsSequentially( const bool processMeasurementsSequentially )
+    {
+        processMeasurementsSequentially_ = processMeasurementsSequentially;
+    }
+
+private:
+
+    //! Function to create the function that defines the system model.
+    /*!
+     *  Function to create the function that defines the system model. The output of this function is then bound
+     *  to the systemFunction_ variable, via the std::bind command.
+     *  \param currentTime Scalar representing the current time.
+     *  \param currentStateVector Vector representing the current state.
+     *  \return Vector representing the estimated state.
+     */
+    DependentVector createSystemFunction( const IndependentVariableType currentTime,
+                                          const DependentVector& currentStateVector )
+    {
+        return inputSystemFunction_( currentTime, currentStateVector );
+    }
+
+    //! Function to create the function that defines the system model.
+    /*!
+     *  Function to create the function that defines the system model. The output of this function is then bound
+     *  to the measurementFunction_ variable, via the std::bind command.
+     *  \param currentTime Scalar representing the current time.
+     *  \param currentStateVector Vector representing the current state.
+     *  \return Vector representing the estimated measurement.
+     */
+    DependentVector createMeasurementFunction( const IndependentVariableType currentTime,
+                                               const DependentVector& currentStateVector )
+    {
+        return inputMeasurementFunction_( currentTime, currentStateVector );
+    }
+
+    //! Function to correct the state and covariance square root, by processing all measurements simultaneously.
+    /*!
+     *  Function to correct the state and covariance square root, by processing all measurements simultaneously. The
+     *  pre-array \f$ [ [ M S_R, H S ], [ 0, S ] ] \f$ is triangularized, after which the lower-triangular result contains the
+     *  square root of the innovation covariance \f$ S_e \f$, the scaled gain \f$ \bar{K} = K S_e \f$ and the a-posteriori
+     *  covariance square root. The state is corrected by solving a triangular system with \f$ S_e \f$.
+     *  \param aPrioriStateEstimate Vector denoting the a-priori state estimate.
+     *  \param measurementResidual Vector denoting the difference between the external and estimated measurements.
+     *  \param measurementJacobian Jacobian of the measurement function w.r.t. the state.
+     *  \param measurementNoiseJacobian Jacobian of the measurement function w.r.t. the measurement noise.
+     */
+    void correctStateAndCovariance( const DependentVector& aPrioriStateEstimate,
+                                    const DependentVector& measurementResidual,
+                                    const DependentMatrix& measurementJacobian,
+                                    const DependentMatrix& measurementNoiseJacobian )
+    {
+        // Allocate pre-array (only if size of measurement vector changes)
+        const int measurementDimension = measurementResidual.rows( );
+        const int preArrayColumns = std::max( measurementDimension, measurementNoiseDimension_ ) + stateDimension_;
+        if ( updatePreArray_.rows( ) != measurementDimension + stateDimension_ || updatePreArray_.cols( ) != preArrayColumns )
+        {
+            updatePreArray_ = DependentMatrix::Zero( measurementDimension + stateDimension_, preArrayColumns );
+        }
+
+        // Fill pre-array and triangularize
+        updatePreArray_.topLeftCorner( measurementDimension, measurementNoiseDimension_ ).noalias( ) =
+                measurementNoiseJacobian * this->measurementUncertaintySquareRoot_;
+        updatePreArray_.topRightCorner( measurementDimension, stateDimension_ ).noalias( ) =
+                measurementJacobian * this->covarianceSquareRoot_;
+        updatePreArray_.bottomRightCorner( stateDimension_, stateDimension_ ) = this->covarianceSquareRoot_;
+        this->triangularizeSquareRoot( updatePreArray_, updatePostArray_ );
+
+        // Correct state and extract a-posteriori covariance square root
+        DependentVector normalizedResidual = updatePostArray_.topLeftCorner( measurementDimension, measurementDimension ).
+                template triangularView< Eigen::Lower >( ).solve( measurementResidual );
+        this->storeStateEstimate( aPrioriStateEstimate + updatePostArray_.bottomLeftCorner(
+                                      stateDimension_, measurementDimension ) * normalizedResidual );
+        this->covarianceSquareRoot_ = updatePostArray_.bottomRightCorner( stateDimension_, stateDimension_ );
+    }
+
+    //! Function to correct the state and covariance square root, by processing the measurements sequentially.
+    /*!
+     *  Function to correct the state and covariance square root, by processing the measurements sequentially, as scalar
+     *  measurements. The measurement residual and Jacobian are first decorrelated, by solving a triangular system with the
+     *  square root of the (effective) measurement uncertainty, after which each scalar measurement is processed with
+     *  Potter's square-root update [Bierman, G. J.].
+     *  \param aPrioriStateEstimate Vector denoting the a-priori state estimate.
+     *  \param measurementResidual Vector denoting the difference between the external and estimated measurements.
+     *  \param measurementJacobian Jacobian of the measurement function w.r.t. the state.
+     *  \param measurementNoiseJacobian Jacobian of the measurement function w.r.t. the measurement noise.
+     */
+    void correctStateAndCovarianceSequentially( const DependentVector& aPrioriStateEstimate,
+                                                const DependentVector& measurementResidual,
+                                                const DependentMatrix& measurementJacobian,
+                                                const DependentMatrix& measurementNoiseJacobian )
+    {
+        // Compute triangular square root of effective measurement uncertainty
+        const int measurementDimension = measurementResidual.rows( );
+        DependentMatrix measurementCompoundSquareRoot = DependentMatrix::Zero(
+                    measurementDimension, std::max( measurementDimension, measurementNoiseDimension_ ) );
+        measurementCompoundSquareRoot.leftCols( measurementNoiseDimension_ ).noalias( ) =
+                measurementNoiseJacobian * this->measurementUncertaintySquareRoot_;
+        this->triangularizeSquareRoot( measurementCompoundSquareRoot, effectiveMeasurementUncertaintySquareRoot_ );
+
+        // Decorrelate measurements
+        DependentVector decorrelatedResidual = effectiveMeasurementUncertaintySquareRoot_.
+                template triangularView< Eigen::Lower >( ).solve( measurementResidual );
+        DependentMatrix decorrelatedJacobian = effectiveMeasurementUncertaintySquareRoot_.
+                template triangularView< Eigen::Lower >( ).solve( measurementJacobian );
+
+        // Process scalar measurements (with unit variance)
+        DependentVector stateCorrection = DependentVector::Zero( stateDimension_ );
+        DependentVector scaledJacobian( stateDimension_ );
+        DependentVector gain( stateDimension_ );
+        for ( int i = 0; i < measurementDimension; i++ )
+        {
+            scaledJacobian.noalias( ) = this->covarianceSquareRoot_.transpose( ) * decorrelatedJacobian.row( i ).transpose( );
+            const DependentVariableType alpha = static_cast< DependentVariableType >( 1.0 ) /
+                    ( scaledJacobian.squaredNorm( ) + static_cast< DependentVariableType >( 1.0 ) );
+            const DependentVariableType gamma = static_cast< DependentVariableType >( 1.0 ) /
+                    ( static_cast< DependentVariableType >( 1.0 ) + std::sqrt( alpha ) );
+            gain.noalias( ) = alpha * ( this->covarianceSquareRoot_ * scaledJacobian );
+
+            stateCorrection += gain * ( decorrelatedResidual( i ) - decorrelatedJacobian.row( i ).dot( stateCorrection ) );
+            this->covarianceSquareRoot_.noalias( ) -= ( gamma * gain ) * scaledJacobian.transpose( );
+        }
+        this->storeStateEstimate( aPrioriStateEstimate + stateCorrection );
+    }
+
+    //! System function input by user.
+    Function inputSystemFunction_;
+
+    //! Measurement function input by user.
+    Function inputMeasurementFunction_;
+
+    //! State Jacobian matrix function.
+    MatrixFunction stateJacobianFunction_;
+
+    //! State noise Jacobian matrix function.
+    MatrixFunction stateNoiseJacobianFunction_;
+
+    //! Measurement Jacobian matrix function.
+    MatrixFunction measurementJacobianFunction_;
+
+    //! Measurement noise Jacobian matrix function.
+    MatrixFunction measurementNoiseJacobianFunction_;
+
+    //! Boolean denoting whether the measurements are processed sequentially as scalar measurements.
+    bool processMeasurementsSequentially_;
+
+    //! Integer specifying length of state vector.
+    int stateDimension_;
+
+    //! Integer specifying length of measurement noise vector.
+    int measurementNoiseDimension_;
+
+    //! Compound square root of a-priori covariance, i.e., \f$ [ F S, G S_Q ] \f$ (storage re-used between steps).
+    DependentMatrix predictionCompoundSquareRoot_;
+
+    //! Pre-array of simultaneous measurement update (storage re-used between steps).
+    DependentMatrix updatePreArray_;
+
+    //! Triangularized post-array of simultaneous measurement update (storage re-used between steps).
+    DependentMatrix updatePostArray_;
+
+    //! Lower-triangular square root of effective measurement uncertainty, used for sequential measurement update.
+    DependentMatrix effectiveMeasurementUncertaintySquareRoot_;
+
+};
+
+//! Typedef for a filter with double data type.
+typedef SquareRootExtendedKalmanFilter< > SquareRootExtendedKalmanFilterDouble;
+
+//! Typedef for a shared-pointer to a filter with double data type.
+typedef std::shared_ptr< SquareRootExtendedKalmanFilterDouble > SquareRootExtendedKalmanFilterDoublePointer;
+
+} // namespace filters
+
+} // namespace tudat
+
+#endif // TUDAT_SQUARE_ROOT_EXTENDED_KALMAN_FILTER_H
@@ -0,0 +1,254 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Bierman, G. J., Factorization Methods for Discrete Sequential Estimation, Academic Press, 1977.
+ *      Van der Merwe, R. and Wan, E., "The Square-Root Unscented Kalman Filter for State and Parameter-Estimation,"
+ *          IEEE International Conference on Acoustics, Speech, and Signal Processing, vol. 6, pp. 3461-3464, 2001.
+ */
+
+#ifndef TUDAT_SQUARE_ROOT_KALMAN_FILTER_H
+#define TUDAT_SQUARE_ROOT_KALMAN_FILTER_H
+
+#include <algorithm>
+#include <string>
+
+#include <Eigen/Cholesky>
+#include <Eigen/QR>
+
+#include "Tudat/Mathematics/Filters/kalmanFilter.h"
+
+namespace tudat
+{
+
+namespace filters
+{
+
+//! Square-root Kalman filter class.
+/*!
+ *  Base class for the set up and use of square-root Kalman filters. Instead of the covariance matrix \f$ P \f$ itself,
+ *  these filters propagate and update a square root \f$ S \f$ of the covariance, such that \f$ P = S S^T \f$. The square
+ *  root is (re-)triangularized by means of QR decompositions and modified with Cholesky rank-one updates, such that the
+ *  covariance remains symmetric and positive definite, and no matrix inverses are required [Bierman, G. J.]. The
+ *  a-posteriori covariance estimate of the base class is still computed from the square root at each step, such that the
+ *  interface (and covariance history) is identical to that of the other filters.
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class SquareRootKalmanFilterBase: public KalmanFilterBase< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename KalmanFilterBase< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename KalmanFilterBase< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename KalmanFilterBase< IndependentVariableType, DependentVariableType >::Function Function;
+    typedef typename KalmanFilterBase< IndependentVariableType, DependentVariableType >::MatrixFunction MatrixFunction;
+    typedef typename KalmanFilterBase< IndependentVariableType, DependentVariableType >::IntegratorSettings IntegratorSettings;
+    typedef typename KalmanFilterBase< IndependentVariableType, DependentVariableType >::Integrator Integrator;
+
+    //! Constructor.
+    /*!
+     *  Constructor. The square roots of the initial covariance and of the system and measurement uncertainties are computed
+     *  upon construction.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system. It is used as first
+     *      a-priori estimate of the state vector.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system. It is used as first
+     *      a-priori estimate of the covariance matrix.
+     *  \param integratorSettings Settings for the numerical integrator to be used to propagate state.
+     */
+    SquareRootKalmanFilterBase( const DependentMatrix& systemUncertainty,
+                                const DependentMatrix& measurementUncertainty,
+                                const IndependentVariableType filteringStepSize,
+                                const IndependentVariableType initialTime,
+                                const DependentVector& initialStateVector,
+                                const DependentMatrix& initialCovarianceMatrix,
+                                const std::shared_ptr< IntegratorSettings > integratorSettings ) :
+        KalmanFilterBase< IndependentVariableType, DependentVariableType >( systemUncertainty, measurementUncertainty,
+                                                                            filteringStepSize, initialTime, initialStateVector,
+                                                                            initialCovarianceMatrix, integratorSettings )
+    {
+        // Compute square roots of covariance and uncertainty matrices
+        covarianceSquareRoot_ = computeCovarianceSquareRoot( initialCovarianceMatrix, "initial covariance" );
+        systemUncertaintySquareRoot_ = computeCovarianceSquareRoot( systemUncertainty, "system uncertainty" );
+        measurementUncertaintySquareRoot_ = computeCovarianceSquareRoot( measurementUncertainty, "measurement uncertainty" );
+    }
+
+    //! Destructor.
+    virtual ~SquareRootKalmanFilterBase( ){ }
+
+    //! Function to retrieve the square root of the current covariance estimate.
+    /*!
+     *  Function to retrieve the square root \f$ S \f$ of the current covariance estimate, such that \f$ P = S S^T \f$. Note
+     *  that the square root is not necessarily lower-triangular.
+     *  \return Square root of current covariance estimate.
+     */
+    DependentMatrix getCurrentCovarianceSquareRoot( ) { return covarianceSquareRoot_; }
+
+protected:
+
+    //! Function to compute the square root of a symmetric positive (semi-)definite matrix.
+    /*!
+     *  Function to compute the square root of a symmetric positive (semi-)definite matrix, by means of its Cholesky
+     *  decomposition. If the matrix is only semi-definite (e.g., zero uncertainty for some of the states), a pivoted
+     *  \f$ L D L^T \f$ decomposition is used instead.
+     *  \param covarianceMatrix Matrix of which the square root is to be computed.
+     *  \param matrixName Name of the matrix, used for error messages.
+     *  \return Square root \f$ S \f$ of the input matrix, such that \f$ S S^T \f$ is equal to the input matrix.
+     */
+    DependentMatrix computeCovarianceSquareRoot( const DependentMatrix& covarianceMatrix, const std::string& matrixName )
+    {
+        // Try Cholesky decomposition first
+        Eigen::LLT< DependentMatrix > choleskyDecomposition( covarianceMatrix );
+        if ( choleskyDecomposition.info( ) == Eigen::Success )
+        {
+            return choleskyDecomposition.matrixL( );
+        }
+
+        // Use pivoted LDL decomposition for semi-definite matrices
+        Eigen::LDLT< DependentMatrix > pivotedDecomposition( covarianceMatrix );
+        DependentVector diagonalElements = pivotedDecomposition.vectorD( );
+        if ( pivotedDecomposition.info( ) != Eigen::Success ||
+             diagonalElements.minCoeff( ) < -std::numeric_limits< DependentVariableType >::epsilon( ) *
+             std::max( diagonalElements.maxCoeff( ), static_cast< DependentVariableType >( 1.0 ) ) )
+        {
+            throw std::runtime_error( "Error in square-root Kalman filter. The " + matrixName + " matrix is not positive "
+                                      "semi-definite. Its square-root cannot be computed." );
+        }
+        diagonalElements = diagonalElements.cwiseMax( static_cast< DependentVariableType >( 0.0 ) ).cwiseSqrt( );
+        DependentMatrix squareRoot = pivotedDecomposition.matrixL( );
+        squareRoot = pivotedDecomposition.transpositionsP( ).transpose( ) * ( squareRoot * diagonalElements.asDiagonal( ) );
+        return squareRoot;
+    }
+
+    //! Function to compute the lower-triangular square root of a matrix, from a compound (non-square) square root.
+    /*!
+     *  Function to compute the lower-triangular square root \f$ S \f$ of the matrix \f$ A A^T \f$, where \f$ A \f$ is a
+     *  compound (non-square) square root, i.e., \f$ S S^T = A A^T \f$. The square root is obtained from the QR decomposition
+     *  of \f$ A^T \f$, and its diagonal is made positive. The number of columns of \f$ A \f$ must be larger than, or equal to,
+     *  its number of rows.
+     *  \param compoundSquareRoot Compound square root \f$ A \f$.
+     *  \param lowerTriangularSquareRoot Lower-triangular square root \f$ S \f$ (returned by reference).
+     */
+    void triangularizeSquareRoot( const DependentMatrix& compoundSquareRoot, DependentMatrix& lowerTriangularSquareRoot )
+    {
+        const int numberOfRows = compoundSquareRoot.rows( );
+        householderDecomposition_.compute( compoundSquareRoot.transpose( ) );
+        lowerTriangularSquareRoot = householderDecomposition_.matrixQR( ).topRows( numberOfRows ).
+                template triangularView< Eigen::Upper >( ).transpose( );
+        for ( int i = 0; i < numberOfRows; i++ )
+        {
+            if ( lowerTriangularSquareRoot( i, i ) < static_cast< DependentVariableType >( 0.0 ) )
+            {
+                lowerTriangularSquareRoot.col( i ) *= static_cast< DependentVariableType >( -1.0 );
+            }
+        }
+    }
+
+    //! Function to perform a rank-one update or downdate of a lower-triangular square root.
+    /*!
+     *  Function to perform a rank-one update or downdate of a lower-triangular square root \f$ S \f$ (with positive
+     *  diagonal), such that the updated square root satisfies \f$ S' S'^T = S S^T \pm v v^T \f$.
+     *  \param lowerTriangularSquareRoot Lower-triangular square root, which is modified in place.
+     *  \param updateVector Vector \f$ v \f$ defining the update (modified during the computation).
+     *  \param isDowndate Boolean denoting whether a downdate (subtraction) is to be performed.
+     */
+    void performRankOneUpdate( DependentMatrix& lowerTriangularSquareRoot, DependentVector& updateVector,
+                               const bool isDowndate )
+    {
+        const DependentVariableType updateSign = static_cast< DependentVariableType >( isDowndate ? -1.0 : 1.0 );
+        const int dimension = lowerTriangularSquareRoot.rows( );
+        for ( int k = 0; k < dimension; k++ )
+        {
+            const DependentVariableType diagonalElement = lowerTriangularSquareRoot( k, k );
+            const DependentVariableType squaredNewDiagonalElement =
+                    diagonalElement * diagonalElement + updateSign * updateVector( k ) * updateVector( k );
+            if ( !( squaredNewDiagonalElement > static_cast< DependentVariableType >( 0.0 ) ) )
+            {
+                throw std::runtime_error( "Error in square-root Kalman filter. Downdate of covariance square root results "
+                                          "in a matrix that is not positive definite." );
+            }
+            const DependentVariableType newDiagonalElement = std::sqrt( squaredNewDiagonalElement );
+            const DependentVariableType cosine = newDiagonalElement / diagonalElement;
+            const DependentVariableType sine = updateVector( k ) / diagonalElement;
+            lowerTriangularSquareRoot( k, k ) = newDiagonalElement;
+
+            const int remainingRows = dimension - k - 1;
+            if ( remainingRows > 0 )
+            {
+                lowerTriangularSquareRoot.col( k ).tail( remainingRows ) =
+                        ( lowerTriangularSquareRoot.col( k ).tail( remainingRows ) +
+                          updateSign * sine * updateVector.tail( remainingRows ) ) / cosine;
+                updateVector.tail( remainingRows ) = cosine * updateVector.tail( remainingRows ) -
+                        sine * lowerTriangularSquareRoot.col( k ).tail( remainingRows );
+            }
+        }
+    }
+
+    //! Function to store the current covariance estimate, as computed from its square root.
+    void storeCovarianceEstimate( )
+    {
+        this->aPosterioriCovarianceEstimate_.noalias( ) = covarianceSquareRoot_ * covarianceSquareRoot_.transpose( );
+        this->historyOfCovarianceEstimates_[ this->currentTime_ ] = this->aPosterioriCovarianceEstimate_;
+    }
+
+    //! Function to store the current state estimate.
+    /*!
+     *  Function to store the current state estimate.
+     *  \param stateEstimate Vector denoting the a-posteriori state estimate.
+     */
+    void storeStateEstimate( const DependentVector& stateEstimate )
+    {
+        this->aPosterioriStateEstimate_ = stateEstimate;
+        this->historyOfStateEstimates_[ this->currentTime_ ] = this->aPosterioriStateEstimate_;
+    }
+
+    //! Function to recompute the covariance square root after the covariance estimate has been modified externally.
+    void specificModifyCurrentCovarianceEstimate( )
+    {
+        covarianceSquareRoot_ = computeCovarianceSquareRoot( this->aPosterioriCovarianceEstimate_, "modified covariance" );
+    }
+
+    //! Function to recompute the covariance square root after reverting to the previous time step.
+    /*!
+     *  Function to recompute the covariance square root after reverting to the previous time step.
+     *  \param timeToBeRemoved Double denoting the current time, i.e., the instant that has to be discarded.
+     */
+    virtual void specificRevertToPreviousTimeStep( const double timeToBeRemoved )
+    {
+        TUDAT_UNUSED_PARAMETER( timeToBeRemoved );
+        covarianceSquareRoot_ = computeCovarianceSquareRoot( this->aPosterioriCovarianceEstimate_, "reverted covariance" );
+    }
+
+    //! Matrix representing the square root of the a-posteriori estimated covariance.
+    DependentMatrix covarianceSquareRoot_;
+
+    //! Matrix representing the square root of the uncertainty in system modeling.
+    DependentMatrix systemUncertaintySquareRoot_;
+
+    //! Matrix representing the square root of the uncertainty in measurement modeling.
+    DependentMatrix measurementUncertaintySquareRoot_;
+
+private:
+
+    //! QR decomposition used to triangularize compound square roots (storage is re-used between time steps).
+    Eigen::HouseholderQR< DependentMatrix > householderDecomposition_;
+
+};
+
+} // namespace filters
+
+} // namespace tudat
+
+#endif // TUDAT_SQUARE_ROOT_KALMAN_FILTER_H
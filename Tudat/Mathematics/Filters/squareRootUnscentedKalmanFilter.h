@@ -0,0 +1,361 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Van der Merwe, R. and Wan, E., "The Square-Root Unscented Kalman Filter for State and Parameter-Estimation,"
+ *          IEEE International Conference on Acoustics, Speech, and Signal Processing, vol. 6, pp. 3461-3464, 2001.
+ */
+
+#ifndef TUDAT_SQUARE_ROOT_UNSCENTED_KALMAN_FILTER_H
+#define TUDAT_SQUARE_ROOT_UNSCENTED_KALMAN_FILTER_H
+
+#include "Tudat/Mathematics/Filters/squareRootKalmanFilter.h"
+#include "Tudat/Mathematics/Filters/unscentedKalmanFilter.h"
+
+namespace tudat
+{
+
+namespace filters
+{
+
+//! Square-root unscented Kalman filter class.
+/*!
+ *  Class for the set up and use of the square-root unscented Kalman filter [Van der Merwe, R., et al.]. Contrary to the
+ *  UnscentedKalmanFilter class, the system and measurement noise are assumed to be additive, such that the sigma points
+ *  only span the state vector (\f$ 2 n + 1 \f$ sigma points, with \f$ n \f$ the length of the state vector). If the state is
+ *  integrated, the system noise is assumed to act on the state derivative, and is approximated as additive noise on the
+ *  propagated state with uncertainty \f$ Q \Delta t^2 \f$. The covariance square root is obtained by triangularizing the
+ *  weighted sigma point deviations, followed by a Cholesky rank-one update with the central sigma point, and the measurement
+ *  update is applied as a sequence of rank-one downdates (one for each element of the measurement vector). The Kalman gain is
+ *  computed by solving two triangular systems, instead of inverting the innovation matrix. All sigma point matrices are
+ *  allocated upon construction, and re-used at each time step.
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class SquareRootUnscentedKalmanFilter: public SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >::Function Function;
+    typedef typename SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >::IntegratorSettings
+    IntegratorSettings;
+    typedef typename SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >::Integrator Integrator;
+
+    //! Default constructor.
+    /*!
+     *  Default constructor. This constructor takes the system and measurement functions as models for the simulation.
+     *  These functions can be a function of time and state vector.
+     *  \param systemFunction Function returning the state as a function of time and state vector. Can be a differential
+     *      equation if the integratorSettings is set (i.e., if it is not a nullptr).
+     *  \param measurementFunction Function returning the measurement as a function of time and state.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system. It is used as first
+     *      a-priori estimate of the state vector.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system. It is used as first
+     *      a-priori estimate of the covariance matrix.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     *  \param constantValueReference Reference to be used for the values of the \f$ \alpha \f$ and \f$ \kappa \f$ parameters. This
+     *      variable has to be part of the ConstantParameterReferences enumeration (custom parameters are supported).
+     *  \param customConstantParameters Values of the constant parameters \f$ \alpha \f$ and \f$ \kappa \f$, in case the custom_parameters
+     *      enumeration is used in the previous field.
+     */
+    SquareRootUnscentedKalmanFilter( const Function& systemFunction,
+                                     const Function& measurementFunction,
+                                     const DependentMatrix& systemUncertainty,
+                                     const DependentMatrix& measurementUncertainty,
+                                     const IndependentVariableType filteringStepSize,
+                                     const IndependentVariableType initialTime,
+                                     const DependentVector& initialStateVector,
+                                     const DependentMatrix& initialCovarianceMatrix,
+                                     const std::shared_ptr< IntegratorSettings > integratorSettings = nullptr,
+                                     const ConstantParameterReferences constantValueReference = reference_Wan_and_Van_der_Merwe,
+                                     const std::pair< DependentVariableType, DependentVariableType > customConstantParameters =
+            std::make_pair( static_cast< DependentVariableType >( TUDAT_NAN ),
+                            static_cast< DependentVariableType >( TUDAT_NAN ) ) ) :
+        SquareRootKalmanFilterBase< IndependentVariableType, DependentVariableType >(
+            systemUncertainty, measurementUncertainty, filteringStepSize, initialTime, initialStateVector,
+            initialCovarianceMatrix, integratorSettings ),
+        inputSystemFunction_( systemFunction ), inputMeasurementFunction_( measurementFunction )
+    {
+        // Set dimensions
+        stateDimension_ = systemUncertainty.rows( );
+        measurementDimension_ = measurementUncertainty.rows( );
+        numberOfSigmaPoints_ = 2 * stateDimension_ + 1;
+
+        // Set contant parameter values and weights
+        setConstantParameterValues( constantValueReference, customConstantParameters );
+
+        // Scale system uncertainty to propagated state, if state derivative is integrated
+        if ( this->isStateToBeIntegrated_ )
+        {
+            this->systemUncertaintySquareRoot_ *= static_cast< DependentVariableType >( this->filteringStepSize_ );
+        }
+
+        // Allocate sigma point storage
+        sigmaPoints_ = DependentMatrix::Zero( stateDimension_, numberOfSigmaPoints_ );
+        stateSigmaPointEstimates_ = DependentMatrix::Zero( stateDimension_, numberOfSigmaPoints_ );
+        measurementSigmaPointEstimates_ = DependentMatrix::Zero( measurementDimension_, numberOfSigmaPoints_ );
+        stateCompoundSquareRoot_ = DependentMatrix::Zero( stateDimension_, 3 * stateDimension_ );
+        measurementCompoundSquareRoot_ = DependentMatrix::Zero( measurementDimension_, 2 * stateDimension_ + measurementDimension_ );
+        stateCompoundSquareRoot_.rightCols( stateDimension_ ) = this->systemUncertaintySquareRoot_;
+        measurementCompoundSquareRoot_.rightCols( measurementDimension_ ) = this->measurementUncertaintySquareRoot_;
+    }
+
+    //! Destructor.
+    ~SquareRootUnscentedKalmanFilter( ){ }
+
+    //! Function to update the filter with the new step data.
+    /*!
+     *  Function to update the filter with the new step data.
+     *  \param currentMeasurementVector Vector representing current measurement.
+     */
+    void updateFilter( const DependentVector& currentMeasurementVector )
+    {
+        // Prediction step
+        // Compute sigma points and propagate them
+        computeSigmaPoints( this->aPosterioriStateEstimate_ );
+        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
+        {
+            stateSigmaPointEstimates_.col( i ) = this->predictState( sigmaPoints_.col( i ) );
+        }
+
+        // Compute the weighted average to find the a-priori state vector and covariance square root
+        DependentVector aPrioriStateEstimate = stateSigmaPointEstimates_ * stateEstimationWeights_;
+        computeSquareRootFromSigmaPointEstimates( stateSigmaPointEstimates_, aPrioriStateEstimate, stateCompoundSquareRoot_,
+                                                  this->covarianceSquareRoot_ );
+
+        // Re-compute sigma points and compute measurement estimates
+        computeSigmaPoints( aPrioriStateEstimate );
+        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
+        {
+            measurementSigmaPointEstimates_.col( i ) = this->measurementFunction_( this->currentTime_, sigmaPoints_.col( i ) );
+        }
+
+        // Compute the weighted average to find the expected measurement vector and innovation square root
+        DependentVector measurementEstimate = measurementSigmaPointEstimates_ * stateEstimationWeights_;
+        computeSquareRootFromSigmaPointEstimates( measurementSigmaPointEstimates_, measurementEstimate,
+                                                  measurementCompoundSquareRoot_, innovationSquareRoot_ );
+
+        // Compute cross-correlation matrix (sigma points are overwritten by their deviations from the estimates)
+        sigmaPoints_.colwise( ) -= aPrioriStateEstimate;
+        measurementSigmaPointEstimates_.colwise( ) -= measurementEstimate;
+        DependentMatrix crossCorrelationMatrix = sigmaPoints_ * covarianceEstimationWeights_.asDiagonal( ) *
+                measurementSigmaPointEstimates_.transpose( );
+
+        // Compute Kalman gain, by solving K S_y S_y^T = P_xy
+        DependentMatrix kalmanGain = innovationSquareRoot_.template triangularView< Eigen::Lower >( ).solve(
+                    crossCorrelationMatrix.transpose( ) );
+        innovationSquareRoot_.transpose( ).template triangularView< Eigen::Upper >( ).solveInPlace( kalmanGain );
+        kalmanGain.transposeInPlace( );
+
+        // Correction step
+        this->currentTime_ += this->filteringStepSize_;
+        this->storeStateEstimate( aPrioriStateEstimate + kalmanGain * ( currentMeasurementVector - measurementEstimate ) );
+        DependentMatrix covarianceDowndateVectors = kalmanGain * innovationSquareRoot_;
+        DependentVector downdateVector;
+        for ( unsigned int i = 0; i < measurementDimension_; i++ )
+        {
+            downdateVector = covarianceDowndateVectors.col( i );
+            this->performRankOneUpdate( this->covarianceSquareRoot_, downdateVector, true );
+        }
+        this->storeCovarianceEstimate( );
+    }
+
+private:
+
+    //! Function to create the function that defines the system model.
+    /*!
+     *  Function to create the function that defines the system model. The output of this function is then bound
+     *  to the systemFunction_ variable, via the std::bind command.
+     *  \param currentTime Scalar representing the current time.
+     *  \param currentStateVector Vector representing the current state.
+     *  \return Vector representing the estimated state.
+     */
+    DependentVector createSystemFunction( const IndependentVariableType currentTime,
+                                          const DependentVector& currentStateVector )
+    {
+        return inputSystemFunction_( currentTime, currentStateVector );
+    }
+
+    //! Function to create the function that defines the system model.
+    /*!
+     *  Function to create the function that defines the system model. The output of this function is then bound
+     *  to the measurementFunction_ variable, via the std::bind command.
+     *  \param currentTime Scalar representing the current time.
+     *  \param currentStateVector Vector representing the current state.
+     *  \return Vector representing the estimated measurement.
+     */
+    DependentVector createMeasurementFunction( const IndependentVariableType currentTime,
+                                               const DependentVector& currentStateVector )
+    {
+        return inputMeasurementFunction_( currentTime, currentStateVector );
+    }
+
+    //! Function to set the values of the constant parameters, and the weights for state and covariance estimation.
+    /*!
+     *  Function to set the values of the constant parameters, and the weights for state and covariance estimation. The
+     *  definition of the parameters is identical to the one of the UnscentedKalmanFilter class, with the length of the state
+     *  vector taking the place of the length of the augmented state vector.
+     *  \param constantValueReference Reference to be used for the values of the alpha and kappa parameters. This variable has to
+     *      be part of the ConstantParameterReferences enumeration (custom parameters are supported).
+     *  \param customConstantParameters Values of the constant parameters alpha and kappa, in case the custom_parameters enumerate
+     *      is used in the previous field.
+     */
+    void setConstantParameterValues( const ConstantParameterReferences constantValueReference,
+                                     const std::pair< DependentVariableType, DependentVariableType >& customConstantParameters )
+    {
+        // Set parameters based on input
+        DependentVariableType alpha, kappa;
+        switch ( constantValueReference )
+        {
+        case reference_Wan_and_Van_der_Merwe:
+            alpha = static_cast< DependentVariableType >( 0.003 );
+            kappa = static_cast< DependentVariableType >( 0.0 );
+            break;
+        case reference_Lisano_and_Born_and_Axelrad:
+            alpha = static_cast< DependentVariableType >( 1.0 );
+            kappa = static_cast< DependentVariableType >( 3.0 ) - static_cast< DependentVariableType >( stateDimension_ );
+            break;
+        case reference_Challa_and_Moore_and_Rogers:
+            alpha = static_cast< DependentVariableType >( 0.001 );
+            kappa = static_cast< DependentVariableType >( 1.0 );
+            break;
+        case custom_parameters:
+            if ( customConstantParameters.first != customConstantParameters.first ||
+                 customConstantParameters.second != customConstantParameters.second )
+            {
+                throw std::runtime_error( "Error in square-root unscented Kalman filter. The value of the alpha and kappa "
+                                          "parameters have not been specified, but the selected method is custom_parameters." );
+            }
+            alpha = customConstantParameters.first;
+            kappa = customConstantParameters.second;
+            break;
+        default:
+            throw std::runtime_error( "Error in square-root unscented Kalman filter. The name of the reference for the alpha "
+                                      "and kappa parameters is not recognized. To enter a custom pair of coefficients, "
+                                      "use the value custom_parameters." );
+        }
+        const DependentVariableType beta = static_cast< DependentVariableType >( 2.0 );
+        const DependentVariableType lambda = alpha * alpha * ( stateDimension_ + kappa ) - stateDimension_;
+        gamma_ = std::sqrt( stateDimension_ + lambda );
+
+        // Generate state and covariance estimation weights
+        stateEstimationWeights_ = DependentVector::Constant(
+                    numberOfSigmaPoints_, static_cast< DependentVariableType >( 1.0 ) / ( 2.0 * ( stateDimension_ + lambda ) ) );
+        stateEstimationWeights_( 0 ) = lambda / ( stateDimension_ + lambda );
+        covarianceEstimationWeights_ = stateEstimationWeights_;
+        covarianceEstimationWeights_( 0 ) += static_cast< DependentVariableType >( 1.0 ) - alpha * alpha + beta;
+    }
+
+    //! Function to compute the sigma points, based on the current state vector and covariance square root.
+    /*!
+     *  Function to compute the sigma points, based on the current state vector and the current covariance square root, which
+     *  are stored in the pre-allocated sigmaPoints_ matrix.
+     *  \param currentStateEstimate Vector denoting the current state estimate.
+     */
+    void computeSigmaPoints( const DependentVector& currentStateEstimate )
+    {
+        sigmaPoints_.col( 0 ) = currentStateEstimate;
+        sigmaPoints_.middleCols( 1, stateDimension_ ) = gamma_ * this->covarianceSquareRoot_;
+        sigmaPoints_.middleCols( 1, stateDimension_ ).colwise( ) += currentStateEstimate;
+        sigmaPoints_.rightCols( stateDimension_ ) = -gamma_ * this->covarianceSquareRoot_;
+        sigmaPoints_.rightCols( stateDimension_ ).colwise( ) += currentStateEstimate;
+    }
+
+    //! Function to compute the lower-triangular square root of the weighted covariance of the sigma point estimates.
+    /*!
+     *  Function to compute the lower-triangular square root of the weighted covariance of the sigma point estimates, plus the
+     *  (system or measurement) uncertainty, the square root of which is stored in the last columns of the compound square root.
+     *  \param sigmaPointEstimates Matrix of sigma point estimates (one column per sigma point).
+     *  \param referenceVector Vector representing the a-priori state or measurement estimates.
+     *  \param compoundSquareRoot Pre-allocated compound square root, with uncertainty square root in its last columns.
+     *  \param lowerTriangularSquareRoot Lower-triangular square root of the weighted covariance (returned by reference).
+     */
+    void computeSquareRootFromSigmaPointEstimates( const DependentMatrix& sigmaPointEstimates,
+                                                   const DependentVector& referenceVector,
+                                                   DependentMatrix& compoundSquareRoot,
+                                                   DependentMatrix& lowerTriangularSquareRoot )
+    {
+        // Triangularize weighted deviations of all but the central sigma point
+        const int numberOfDeviations = numberOfSigmaPoints_ - 1;
+        compoundSquareRoot.leftCols( numberOfDeviations ) =
+                std::sqrt( covarianceEstimationWeights_( 1 ) ) * sigmaPointEstimates.rightCols( numberOfDeviations );
+        compoundSquareRoot.leftCols( numberOfDeviations ).colwise( ) -=
+                std::sqrt( covarianceEstimationWeights_( 1 ) ) * referenceVector;
+        this->triangularizeSquareRoot( compoundSquareRoot, lowerTriangularSquareRoot );
+
+        // Add central sigma point, which may have a negative weight
+        DependentVector updateVector = std::sqrt( std::fabs( covarianceEstimationWeights_( 0 ) ) ) *
+                ( sigmaPointEstimates.col( 0 ) - referenceVector );
+        this->performRankOneUpdate( lowerTriangularSquareRoot, updateVector,
+                                    covarianceEstimationWeights_( 0 ) < static_cast< DependentVariableType >( 0.0 ) );
+    }
+
+    //! System function input by user.
+    Function inputSystemFunction_;
+
+    //! Measurement function input by user.
+    Function inputMeasurementFunction_;
+
+    //! Integer specifying length of state vector.
+    unsigned int stateDimension_;
+
+    //! Integer specifying length of measurement vector.
+    unsigned int measurementDimension_;
+
+    //! Integer specifying number of sigma points.
+    unsigned int numberOfSigmaPoints_;
+
+    //! Scaling of the covariance square root used to generate the sigma points, i.e., \f$ \sqrt{ n + \lambda } \f$.
+    DependentVariableType gamma_;
+
+    //! Vector of weights used for the computation of the weighted average of the state and measurement vectors.
+    DependentVector stateEstimationWeights_;
+
+    //! Vector of weights used for the computation of the weighted average of the covariance and innovation matrices.
+    DependentVector covarianceEstimationWeights_;
+
+    //! Matrix of sigma points (one column per sigma point).
+    DependentMatrix sigmaPoints_;
+
+    //! Matrix of propagated sigma points (one column per sigma point).
+    DependentMatrix stateSigmaPointEstimates_;
+
+    //! Matrix of measurement estimates of the sigma points (one column per sigma point).
+    DependentMatrix measurementSigmaPointEstimates_;
+
+    //! Compound square root of a-priori covariance, with system uncertainty square root in last columns.
+    DependentMatrix stateCompoundSquareRoot_;
+
+    //! Compound square root of innovation matrix, with measurement uncertainty square root in last columns.
+    DependentMatrix measurementCompoundSquareRoot_;
+
+    //! Lower-triangular square root of innovation matrix.
+    DependentMatrix innovationSquareRoot_;
+
+};
+
+//! Typedef for a filter with double data type.
+typedef SquareRootUnscentedKalmanFilter< > SquareRootUnscentedKalmanFilterDouble;
+
+//! Typedef for a shared-pointer to a filter with double data type.
+typedef std::shared_ptr< SquareRootUnscentedKalmanFilterDouble > SquareRootUnscentedKalmanFilterDoublePointer;
+
+} // namespace filters
+
+} // namespace tudat
+
+#endif // TUDAT_SQUARE_ROOT_UNSCENTED_KALMAN_FILTER_H
@@ -23,6 +23,8 @@
 #ifndef TUDAT_UNSCENTED_KALMAN_FILTER_H
 #define TUDAT_UNSCENTED_KALMAN_FILTER_H
 
+#include "Tudat/Basics/parallelExecution.h"
+
 #include "Tudat/Mathematics/Filters/kalmanFilter.h"
 
 namespace tudat
@@ -52,7 +54,10 @@ enum ConstantParameterReferences
 
 //! Unscented Kalman filter class.
 /*!
- *  Class for the set up and use of the unscented Kalman filter.
+ *  Class for the set up and use of the unscented Kalman filter. The propagation of the sigma points through the system
+ *  and measurement functions can be distributed over multiple threads, in which case each thread uses its own numerical
+ *  integrator (created with the same settings). The sigma points, and their propagated states and measurements, are
+ *  stored as contiguous matrices (one column per sigma point), which are allocated upon construction.
  *  \tparam IndependentVariableType Type of independent variable. Default is double.
  *  \tparam DependentVariableType Type of dependent variable. Default is double.
  */
@@ -88,6 +93,9 @@ public:
      *      variable has to be part of the ConstantParameterReferences enumeration (custom parameters are supported).
      *  \param customConstantParameters Values of the constant parameters \f$ \alpha \f$ and \f$ \kappa \f$, in case the custom_parameters
      *      enumeration is used in the previous field.
+     *  \param numberOfThreads Number of threads over which the propagation of the sigma points is distributed. If larger
+     *      than one, the system and measurement functions are evaluated concurrently, and must therefore be thread-safe.
+     *  \param saveSigmaPointHistory Boolean denoting whether the sigma points are to be stored at each time step.
      */
     UnscentedKalmanFilter( const Function& systemFunction,
                            const Function& measurementFunction,
@@ -101,11 +109,14 @@ public:
                            const ConstantParameterReferences constantValueReference = reference_Wan_and_Van_der_Merwe,
                            const std::pair< DependentVariableType, DependentVariableType > customConstantParameters =
             std::make_pair( static_cast< DependentVariableType >( TUDAT_NAN ),
-                            static_cast< DependentVariableType >( TUDAT_NAN ) ) ) :
+                            static_cast< DependentVariableType >( TUDAT_NAN ) ),
+                           const unsigned int numberOfThreads = 1,
+                           const bool saveSigmaPointHistory = true ) :
         KalmanFilterBase< IndependentVariableType, DependentVariableType >( systemUncertainty, measurementUncertainty,
                                                                             filteringStepSize, initialTime, initialStateVector,
                                                                             initialCovarianceMatrix, integratorSettings ),
-        inputSystemFunction_( systemFunction ), inputMeasurementFunction_( measurementFunction )
+        inputSystemFunction_( systemFunction ), inputMeasurementFunction_( measurementFunction ),
+        saveSigmaPointHistory_( saveSigmaPointHistory )
     {
         // Set dimensions
         stateDimension_ = systemUncertainty.rows( );
@@ -123,6 +134,26 @@ public:
         augmentedCovarianceMatrix_.block( stateDimension_, stateDimension_, stateDimension_, stateDimension_ ) = systemUncertainty;
         augmentedCovarianceMatrix_.block( 2 * stateDimension_, 2 * stateDimension_,
                                           measurementDimension_, measurementDimension_ ) = measurementUncertainty;
+
+        // Allocate sigma point storage
+        sigmaPoints_ = DependentMatrix::Zero( augmentedStateDimension_, numberOfSigmaPoints_ );
+        stateSigmaPointEstimates_ = DependentMatrix::Zero( stateDimension_, numberOfSigmaPoints_ );
+        measurementSigmaPointEstimates_ = DependentMatrix::Zero( measurementDimension_, numberOfSigmaPoints_ );
+
+        // Create one integrator per thread (the first thread uses the integrator of the base class)
+        numberOfThreads_ = std::max( 1u, std::min( numberOfThreads, numberOfSigmaPoints_ ) );
+        currentSigmaPoints_.resize( numberOfThreads_, 0 );
+        if ( this->isStateToBeIntegrated_ )
+        {
+            threadIntegrators_.push_back( this->integrator_ );
+            for ( unsigned int i = 1; i < numberOfThreads_; i++ )
+            {
+                threadIntegrators_.push_back( this->createNumericalIntegrator(
+                                                  std::bind( &UnscentedKalmanFilter< IndependentVariableType, DependentVariableType >::
+                                                             computeSigmaPointSystemFunction, this, i,
+                                                             std::placeholders::_1, std::placeholders::_2 ) ) );
+            }
+        }
     }
 
     //! Destructor.
@@ -137,54 +168,51 @@ public:
     {
         // Compute sigma points
         computeSigmaPoints( this->aPosterioriStateEstimate_, this->aPosterioriCovarianceEstimate_ );
-        historyOfSigmaPoints_[ this->currentTime_ ] = mapOfSigmaPoints_; // store points
+        if ( saveSigmaPointHistory_ )
+        {
+            historyOfSigmaPoints_[ this->currentTime_ ] = sigmaPoints_; // store points
+        }
 
         // Prediction step
-        // Compute series of state estimates based on sigma points
-        std::map< unsigned int, DependentVector > sigmaPointsStateEstimates;
-        for ( sigmaPointConstantIterator_ = mapOfSigmaPoints_.begin( );
-              sigmaPointConstantIterator_ != mapOfSigmaPoints_.end( ); sigmaPointConstantIterator_++ )
+        // Compute series of state estimates based on sigma points (distributed over threads)
+        utilities::executeParallelForLoop(
+                    numberOfSigmaPoints_, [ & ]( const unsigned int sigmaPointIndex, const unsigned int threadIndex )
         {
-            currentSigmaPoint_ = sigmaPointConstantIterator_->first;
-            sigmaPointsStateEstimates[ currentSigmaPoint_ ] = this->predictState(
-                        sigmaPointConstantIterator_->second.segment( 0, stateDimension_ ) );
-        }
+            stateSigmaPointEstimates_.col( sigmaPointIndex ) = propagateSigmaPoint( sigmaPointIndex, threadIndex );
+        }, numberOfThreads_ );
 
         // Compute the weighted average to find the a-priori state vector
         DependentVector aPrioriStateEstimate = DependentVector::Zero( stateDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( aPrioriStateEstimate, sigmaPointsStateEstimates );
+        computeWeightedAverageFromSigmaPointEstimates( aPrioriStateEstimate, stateSigmaPointEstimates_ );
 
         // Compute the weighted average to find the a-priori covariance matrix
         DependentMatrix aPrioriCovarianceEstimate = DependentMatrix::Zero( stateDimension_, stateDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( aPrioriCovarianceEstimate, aPrioriStateEstimate, sigmaPointsStateEstimates );
+        computeWeightedAverageFromSigmaPointEstimates( aPrioriCovarianceEstimate, aPrioriStateEstimate, stateSigmaPointEstimates_ );
 
         // Re-compute sigma points
         computeSigmaPoints( aPrioriStateEstimate, aPrioriCovarianceEstimate );
 
-        // Compute series of measurement estimates based on sigma points
-        std::map< unsigned int, DependentVector > sigmaPointsMeasurementEstimates;
-        for ( sigmaPointConstantIterator_ = mapOfSigmaPoints_.begin( );
-              sigmaPointConstantIterator_ != mapOfSigmaPoints_.end( ); sigmaPointConstantIterator_++ )
+        // Compute series of measurement estimates based on sigma points (distributed over threads)
+        utilities::executeParallelForLoop(
+                    numberOfSigmaPoints_, [ & ]( const unsigned int sigmaPointIndex, const unsigned int )
         {
-            currentSigmaPoint_ = sigmaPointConstantIterator_->first;
-            sigmaPointsMeasurementEstimates[ currentSigmaPoint_ ] = this->measurementFunction_(
-                        this->currentTime_, sigmaPointConstantIterator_->second.segment( 0, stateDimension_ ) );
-        }
+            measurementSigmaPointEstimates_.col( sigmaPointIndex ) = computeSigmaPointMeasurementFunction(
+                        sigmaPointIndex, this->currentTime_, sigmaPoints_.col( sigmaPointIndex ).segment( 0, stateDimension_ ) );
+        }, numberOfThreads_ );
 
         // Compute the weighted average to find the expected measurement vector
         DependentVector measurementEstimate = DependentVector::Zero( measurementDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( measurementEstimate, sigmaPointsMeasurementEstimates );
+        computeWeightedAverageFromSigmaPointEstimates( measurementEstimate, measurementSigmaPointEstimates_ );
 
         // Compute innovation and cross-correlation matrices
         DependentMatrix innovationMatrix = DependentMatrix::Zero( measurementDimension_, measurementDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( innovationMatrix, measurementEstimate, sigmaPointsMeasurementEstimates );
+        computeWeightedAverageFromSigmaPointEstimates( innovationMatrix, measurementEstimate, measurementSigmaPointEstimates_ );
         DependentMatrix crossCorrelationMatrix = DependentMatrix::Zero( stateDimension_, measurementDimension_ );
-        for ( sigmaPointConstantIterator_ = sigmaPointsStateEstimates.begin( );
-              sigmaPointConstantIterator_ != sigmaPointsStateEstimates.end( ); sigmaPointConstantIterator_++ )
+        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
         {
-            crossCorrelationMatrix += covarianceEstimationWeights_.at( sigmaPointConstantIterator_->first ) *
-                    ( sigmaPointConstantIterator_->second - aPrioriStateEstimate ) *
-                    ( sigmaPointsMeasurementEstimates[ sigmaPointConstantIterator_->first ] - measurementEstimate ).transpose( );
+            crossCorrelationMatrix += covarianceEstimationWeights_.at( i ) *
+                    ( stateSigmaPointEstimates_.col( i ) - aPrioriStateEstimate ) *
+                    ( measurementSigmaPointEstimates_.col( i ) - measurementEstimate ).transpose( );
         }
 
         // Compute Kalman gain
@@ -198,30 +226,19 @@ public:
 
     //! Function to return the history of sigma points.
     /*!
-     *  Function to return the history of sigma points.
-     *  \return History of map of sigma points for each time step.
+     *  Function to return the history of sigma points. The history is only stored if the saveSigmaPointHistory input to the
+     *  constructor is set to true.
+     *  \return History of sigma points for each time step, stored as matrices of augmented state vectors (one column
+     *      per sigma point).
      */
     std::map< IndependentVariableType, DependentMatrix > getHistoryOfSigmaPoints( )
     {
-        // Convert map of maps into map of Eigen::Matrix
-        DependentVector vectorOfSigmaPoints;
-        std::map< IndependentVariableType, DependentMatrix > mapOfSigmaPointsHistory;
-        for ( typename std::map< IndependentVariableType, std::map< unsigned int, DependentVector > >::const_iterator
-              mapIterator = historyOfSigmaPoints_.begin( ); mapIterator != historyOfSigmaPoints_.end( ); mapIterator++ )
-        {
-            // Extract current map of sigma points and turn it into a vector
-            vectorOfSigmaPoints = utilities::createConcatenatedEigenMatrixFromMapValues( mapIterator->second );
-
-            // Reshape the vector into a matrix and store it into the output map
-            Eigen::Map< Eigen::MatrixXd > matrixOfSigmaPoints( vectorOfSigmaPoints.data( ),
-                                                               augmentedStateDimension_, numberOfSigmaPoints_ );
-            mapOfSigmaPointsHistory[ mapIterator->first ] = matrixOfSigmaPoints;
-        }
-
-        // Give output
-        return mapOfSigmaPointsHistory;
+        return historyOfSigmaPoints_;
     }
 
+    //! Function to retrieve the number of threads over which the propagation of the sigma points is distributed.
+    unsigned int getNumberOfThreads( ) { return numberOfThreads_; }
+
 private:
 
     //! Function to create the function that defines the system model.
@@ -235,8 +252,7 @@ private:
     DependentVector createSystemFunction( const IndependentVariableType currentTime,
                                           const DependentVector& currentStateVector )
     {
-        return inputSystemFunction_( currentTime, currentStateVector ) +
-                mapOfSigmaPoints_[ currentSigmaPoint_ ].segment( stateDimension_, stateDimension_ ); // add system noise
+        return computeSigmaPointSystemFunction( 0, currentTime, currentStateVector );
     }
 
     //! Function to create the function that defines the system model.
@@ -249,9 +265,64 @@ private:
      */
     DependentVector createMeasurementFunction( const IndependentVariableType currentTime,
                                                const DependentVector& currentStateVector )
+    {
+        return computeSigmaPointMeasurementFunction( currentSigmaPoints_.at( 0 ), currentTime, currentStateVector );
+    }
+
+    //! Function to evaluate the system model, including the system noise of the sigma point that is currently propagated.
+    /*!
+     *  Function to evaluate the system model, including the system noise of the sigma point that is currently propagated by
+     *  the given thread.
+     *  \param threadIndex Index of the thread that propagates the sigma point.
+     *  \param currentTime Scalar representing the current time.
+     *  \param currentStateVector Vector representing the current state.
+     *  \return Vector representing the estimated state.
+     */
+    DependentVector computeSigmaPointSystemFunction( const unsigned int threadIndex,
+                                                     const IndependentVariableType currentTime,
+                                                     const DependentVector& currentStateVector )
+    {
+        return inputSystemFunction_( currentTime, currentStateVector ) +
+                sigmaPoints_.col( currentSigmaPoints_[ threadIndex ] ).segment( stateDimension_, stateDimension_ ); // add system noise
+    }
+
+    //! Function to evaluate the measurement model, including the measurement noise of a sigma point.
+    /*!
+     *  Function to evaluate the measurement model, including the measurement noise of a sigma point.
+     *  \param sigmaPointIndex Index of the sigma point.
+     *  \param currentTime Scalar representing the current time.
+     *  \param currentStateVector Vector representing the current state.
+     *  \return Vector representing the estimated measurement.
+     */
+    DependentVector computeSigmaPointMeasurementFunction( const unsigned int sigmaPointIndex,
+                                                          const IndependentVariableType currentTime,
+                                                          const DependentVector& currentStateVector )
     {
         return inputMeasurementFunction_( currentTime, currentStateVector ) +
-                mapOfSigmaPoints_[ currentSigmaPoint_ ].segment( 2 * stateDimension_, measurementDimension_ ); // add measurement noise
+                sigmaPoints_.col( sigmaPointIndex ).segment( 2 * stateDimension_, measurementDimension_ ); // add measurement noise
+    }
+
+    //! Function to propagate a sigma point to the next time step.
+    /*!
+     *  Function to propagate a sigma point to the next time step, using the integrator of the given thread (if the state is
+     *  integrated).
+     *  \param sigmaPointIndex Index of the sigma point.
+     *  \param threadIndex Index of the thread that propagates the sigma point.
+     *  \return Propagated state at the requested time.
+     */
+    DependentVector propagateSigmaPoint( const unsigned int sigmaPointIndex, const unsigned int threadIndex )
+    {
+        currentSigmaPoints_[ threadIndex ] = sigmaPointIndex;
+        if ( this->isStateToBeIntegrated_ )
+        {
+            return this->propagateState( sigmaPoints_.col( sigmaPointIndex ).segment( 0, stateDimension_ ),
+                                         threadIntegrators_.at( threadIndex ) );
+        }
+        else
+        {
+            return computeSigmaPointSystemFunction( threadIndex, this->currentTime_,
+                                                    sigmaPoints_.col( sigmaPointIndex ).segment( 0, stateDimension_ ) );
+        }
     }
 
     //! Function to clear the history of stored variables for derived class-specific variables.
@@ -345,16 +416,16 @@ private:
         {
             if ( i == 0 )
             {
-                mapOfSigmaPoints_[ i ] = augmentedStateVector_;
+                sigmaPoints_.col( i ) = augmentedStateVector_;
             }
             else if ( i < ( augmentedCovarianceMatrixSquareRoot.cols( ) + 1 ) )
             {
-                mapOfSigmaPoints_[ i ] = augmentedStateVector_ + constantParameters_.at( gamma_index ) *
+                sigmaPoints_.col( i ) = augmentedStateVector_ + constantParameters_.at( gamma_index ) *
                         augmentedCovarianceMatrixSquareRoot.col( i - 1 );
             }
             else
             {
-                mapOfSigmaPoints_[ i ] = augmentedStateVector_ - constantParameters_.at( gamma_index ) *
+                sigmaPoints_.col( i ) = augmentedStateVector_ - constantParameters_.at( gamma_index ) *
                         augmentedCovarianceMatrixSquareRoot.col( ( i - 1 ) - augmentedCovarianceMatrixSquareRoot.cols( ) );
             }
         }
@@ -364,19 +435,17 @@ private:
     /*!
      *  Function to compute the weighted average of the state and measurement vectors.
      *  \param weightedAverageVector Vector to which the weighted average is added (initially set to zero).
-     *  \param sigmaPointEstimates Map of the sigma points generated by the computeSigmaPoints function.
+     *  \param sigmaPointEstimates Matrix of the estimates of the sigma points (one column per sigma point).
      *  \return Weighted average of the state or measurement vector, i.e., the new a-priori state and the
      *      measurement estimates (returned by reference).
      */
     void computeWeightedAverageFromSigmaPointEstimates( DependentVector& weightedAverageVector,
-                                                        const std::map< unsigned int, DependentVector >& sigmaPointEstimates )
+                                                        const DependentMatrix& sigmaPointEstimates )
     {
         // Loop over each sigma point
-        for ( sigmaPointConstantIterator_ = sigmaPointEstimates.begin( );
-              sigmaPointConstantIterator_ != sigmaPointEstimates.end( ); sigmaPointConstantIterator_++ )
+        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
         {
-            weightedAverageVector += stateEstimationWeights_.at( sigmaPointConstantIterator_->first ) *
-                    sigmaPointConstantIterator_->second;
+            weightedAverageVector += stateEstimationWeights_.at( i ) * sigmaPointEstimates.col( i );
         }
     }
 
@@ -385,21 +454,20 @@ private:
      *  Function to compute the weighted average of the covariance and innovation matrices.
      *  \param weightedAverageMatrix Matrix to which the weighted average is added (initially set to zero).
      *  \param referenceVector Vector representing the a-priori state or measurement estimates.
-     *  \param sigmaPointEstimates Map of the sigma points generated by the computeSigmaPoints function.
+     *  \param sigmaPointEstimates Matrix of the estimates of the sigma points (one column per sigma point).
      *  \return Weighted average of the covariance and innovation matrices, i.e., the new a-priori covariance and the
      *      innovation estimates (returned by reference).
      */
     void computeWeightedAverageFromSigmaPointEstimates( DependentMatrix& weightedAverageMatrix,
                                                         const DependentVector& referenceVector,
-                                                        const std::map< unsigned int, DependentVector >& sigmaPointEstimates )
+                                                        const DependentMatrix& sigmaPointEstimates )
     {
         // Loop over each sigma point
-        for ( sigmaPointConstantIterator_ = sigmaPointEstimates.begin( );
-              sigmaPointConstantIterator_ != sigmaPointEstimates.end( ); sigmaPointConstantIterator_++ )
+        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
         {
-            weightedAverageMatrix += covarianceEstimationWeights_.at( sigmaPointConstantIterator_->first ) *
-                    ( sigmaPointConstantIterator_->second - referenceVector ) *
-                    ( sigmaPointConstantIterator_->second - referenceVector ).transpose( );
+            weightedAverageMatrix += covarianceEstimationWeights_.at( i ) *
+                    ( sigmaPointEstimates.col( i ) - referenceVector ) *
+                    ( sigmaPointEstimates.col( i ) - referenceVector ).transpose( );
         }
     }
 
@@ -462,26 +530,37 @@ private:
      */
     DependentMatrix augmentedCovarianceMatrix_;
 
-    //! Map of sigma points.
+    //! Matrix of sigma points.
     /*!
-     *  Map of sigma points, as output by the computeSigmaPoints function. See the description of this function for more
-     *  details of the sigma points and their use.
+     *  Matrix of sigma points (one column per sigma point), as output by the computeSigmaPoints function. See the description
+     *  of this function for more details of the sigma points and their use.
      */
-    std::map< unsigned int, DependentVector > mapOfSigmaPoints_;
+    DependentMatrix sigmaPoints_;
+
+    //! Matrix of propagated sigma points (one column per sigma point).
+    DependentMatrix stateSigmaPointEstimates_;
+
+    //! Matrix of measurement estimates of the sigma points (one column per sigma point).
+    DependentMatrix measurementSigmaPointEstimates_;
+
+    //! Boolean denoting whether the sigma points are to be stored at each time step.
+    bool saveSigmaPointHistory_;
+
+    //! Map of matrices of sigma points, used to store the history of sigma points.
+    std::map< IndependentVariableType, DependentMatrix > historyOfSigmaPoints_;
 
-    //! Map of map of sigma points, used to store the history of sigma points.
-    std::map< IndependentVariableType, std::map< unsigned int, DependentVector > > historyOfSigmaPoints_;
+    //! Number of threads over which the propagation of the sigma points is distributed.
+    unsigned int numberOfThreads_;
 
-    //! Constant iterator to loop over sigma points (introduced for convenience).
-    typename std::map< unsigned int, DependentVector >::const_iterator sigmaPointConstantIterator_;
+    //! Integrators used to propagate the sigma points, one for each thread (empty if the state is not integrated).
+    std::vector< std::shared_ptr< Integrator > > threadIntegrators_;
 
-    //! Integer specifying current sigma point.
+    //! Indices of the sigma points currently propagated, one for each thread.
     /*!
-     *  Integer specifying current sigma point, while iterating over the mapOfSigmaPoints_. This parameter is specifically used
-     *  when evaluating the systemFunction_ and measurementFunction_, such that the correct value of system and measurement
-     *  noise can be added.
+     *  Indices of the sigma points currently propagated, one for each thread. These indices are used when evaluating the
+     *  system function, such that the correct value of system noise can be added.
      */
-    unsigned int currentSigmaPoint_;
+    std::vector< unsigned int > currentSigmaPoints_;
 
 };
 
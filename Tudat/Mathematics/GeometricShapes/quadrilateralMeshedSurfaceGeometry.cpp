@@ -39,6 +39,11 @@ void QuadrilateralMeshedSurfaceGeometry::performPanelCalculations( )
     panelSurfaceNormals_.resize(boost::extents[ numberOfLines_ - 1 ][ numberOfPoints_ - 1 ]);
     panelAreas_.resize(boost::extents[ numberOfLines_ - 1 ][ numberOfPoints_ - 1 ]);
 
+    int numberOfPanels = ( numberOfLines_ - 1 ) * ( numberOfPoints_ - 1 );
+    panelCentroidMatrix_.resize( numberOfPanels, 3 );
+    panelSurfaceNormalMatrix_.resize( numberOfPanels, 3 );
+    panelAreaVector_.resize( numberOfPanels );
+
     // Declare local variables for normal and area determination.
     Eigen::Vector3d crossVector1;
     Eigen::Vector3d crossVector2;
@@ -81,6 +86,12 @@ void QuadrilateralMeshedSurfaceGeometry::performPanelCalculations( )
 
             // Add panel area to total area.
             totalArea_ += panelAreas_[ i ][ j ];
+
+            // Set panel properties in contiguous containers.
+            panelCentroidMatrix_.row( i * ( numberOfPoints_ - 1 ) + j ) = panelCentroids_[ i ][ j ].transpose( );
+            panelSurfaceNormalMatrix_.row( i * ( numberOfPoints_ - 1 ) + j ) =
+                    panelSurfaceNormals_[ i ][ j ].transpose( );
+            panelAreaVector_( i * ( numberOfPoints_ - 1 ) + j ) = panelAreas_[ i ][ j ];
         }
     }
 }
@@ -177,6 +177,38 @@ public:
          return panelSurfaceNormals_;
      }
 
+     //! Get panel centroids of all panels in contiguous form.
+     /*!
+      * Returns panel centroids of all panels, one panel per row (panels ordered by line and then by point, i.e.
+      * row lineIndex * ( numberOfPoints - 1 ) + pointIndex), so that each component is stored contiguously.
+      * \return Panel centroids of all panels.
+      */
+     const Eigen::Matrix< double, Eigen::Dynamic, 3 >& getPanelCentroidMatrix( )
+     {
+         return panelCentroidMatrix_;
+     }
+
+     //! Get outward surface normals of all panels in contiguous form.
+     /*!
+      * Returns outward surface normals of all panels, one panel per row (ordered as in getPanelCentroidMatrix),
+      * so that each component is stored contiguously.
+      * \return Outward surface normals of all panels.
+      */
+     const Eigen::Matrix< double, Eigen::Dynamic, 3 >& getPanelSurfaceNormalMatrix( )
+     {
+         return panelSurfaceNormalMatrix_;
+     }
+
+     //! Get areas of all panels in contiguous form.
+     /*!
+      * Returns areas of all panels (ordered as in getPanelCentroidMatrix).
+      * \return Areas of all panels.
+      */
+     const Eigen::VectorXd& getPanelAreaVector( )
+     {
+         return panelAreaVector_;
+     }
+
 protected:
 
      //! Calculate panel characteristics.
@@ -228,6 +260,15 @@ protected:
      */
     boost::multi_array< double, 2 > panelAreas_;
 
+    //! Panel centroids, one panel per row, with panels ordered by line and then by point.
+    Eigen::Matrix< double, Eigen::Dynamic, 3 > panelCentroidMatrix_;
+
+    //! Outward panel surface normals, one panel per row, with panels ordered by line and then by point.
+    Eigen::Matrix< double, Eigen::Dynamic, 3 > panelSurfaceNormalMatrix_;
+
+    //! Panel areas, with panels ordered by line and then by point.
+    Eigen::VectorXd panelAreaVector_;
+
     //! Total mesh surface area/
     /*!
      * Total mesh surface area, contains the sum of all areas in panelAreas_.
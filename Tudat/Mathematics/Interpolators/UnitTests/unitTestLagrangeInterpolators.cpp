@@ -564,7 +564,40 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
     }
 }
 
+// Test to check whether the interpolator works with double-double dependent variables, as used for integrated states in
+// double-double precision.
+BOOST_AUTO_TEST_CASE( test_lagrange_interpolation_double_double )
+{
+    std::map< double, double > dataMap;
+    std::map< double, Eigen::VectorXdd > doubleDoubleDataMap;
+    std::vector< double > independentVariableVector = getIndependentVariableVector( );
+
+    const unsigned int stages = 8;
+    std::map< int, double > coefficients = getPolynomialCoefficients( stages - 1 );
+    for( unsigned int i = 0; i < independentVariableVector.size( ); i++ )
+    {
+        dataMap[ independentVariableVector.at( i ) ] =
+                evaluatePolynomial( coefficients, independentVariableVector.at( i ) );
+        doubleDoubleDataMap[ independentVariableVector.at( i ) ] =
+                Eigen::VectorXdd::Constant( 1, dataMap[ independentVariableVector.at( i ) ] );
+    }
+
+    // Create interpolators
+    interpolators::LagrangeInterpolator< double, double > interpolator(
+                dataMap, stages, interpolators::huntingAlgorithm, interpolators::lagrange_no_boundary_interpolation );
+    interpolators::LagrangeInterpolator< double, Eigen::VectorXdd > doubleDoubleInterpolator(
+                doubleDoubleDataMap, stages, interpolators::huntingAlgorithm,
+                interpolators::lagrange_no_boundary_interpolation );
 
+    // Check that double-double interpolation is consistent with double interpolation
+    int offsetEntries = stages / 2 - 1;
+    for( unsigned int i = offsetEntries; i < independentVariableVector.size( ) - ( offsetEntries + 2 ); i++ )
+    {
+        double currentDataPoint = ( independentVariableVector.at( i + 1 ) + independentVariableVector.at( i ) ) / 2.0;
+        BOOST_CHECK_CLOSE_FRACTION( static_cast< double >( doubleDoubleInterpolator.interpolate( currentDataPoint )( 0 ) ),
+                                    interpolator.interpolate( currentDataPoint ), 5.0E-15 );
+    }
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
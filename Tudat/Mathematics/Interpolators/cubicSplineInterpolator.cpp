@@ -21,6 +21,10 @@ template class CubicSplineInterpolator< double, Eigen::Matrix< long double, Eige
 template class CubicSplineInterpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 1 >, long double >;
 template class CubicSplineInterpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 6 >, long double >;
 template class CubicSplineInterpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic,  Eigen::Dynamic >, long double >;
+
+template class CubicSplineInterpolator< DoubleDoubleTime, Eigen::VectorXd, double >;
+template class CubicSplineInterpolator< DoubleDoubleTime, Eigen::Vector6d, double >;
+template class CubicSplineInterpolator< DoubleDoubleTime, Eigen::MatrixXd, double >;
 #endif
 
 } // namespace interpolators
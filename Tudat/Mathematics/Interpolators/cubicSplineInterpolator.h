@@ -426,6 +426,10 @@ extern template class CubicSplineInterpolator< double, Eigen::Matrix< long doubl
 extern template class CubicSplineInterpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 1 >, long double >;
 extern template class CubicSplineInterpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 6 >, long double >;
 extern template class CubicSplineInterpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic,  Eigen::Dynamic >, long double >;
+
+extern template class CubicSplineInterpolator< DoubleDoubleTime, Eigen::VectorXd, double >;
+extern template class CubicSplineInterpolator< DoubleDoubleTime, Eigen::Vector6d, double >;
+extern template class CubicSplineInterpolator< DoubleDoubleTime, Eigen::MatrixXd, double >;
 #endif
 
 //! Typedef for cubic spline interpolator with (in)dependent = double.
@@ -21,6 +21,14 @@ template class Interpolator< double, Eigen::Matrix< long double, Eigen::Dynamic,
 template class Interpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 1 > >;
 template class Interpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 6 > >;
 template class Interpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > >;
+
+template class Interpolator< DoubleDoubleTime, Eigen::VectorXd >;
+template class Interpolator< DoubleDoubleTime, Eigen::Vector6d >;
+template class Interpolator< DoubleDoubleTime, Eigen::MatrixXd >;
+
+template class Interpolator< double, Eigen::VectorXdd >;
+template class Interpolator< double, Eigen::Vector6dd >;
+template class Interpolator< double, Eigen::MatrixXdd >;
 #endif
 
 } // namespace interpolators
@@ -15,6 +15,8 @@
 #include <vector>
 
 #include "Tudat/Basics/timeType.h"
+#include "Tudat/Basics/doubleDoubleTime.h"
+#include "Tudat/Basics/doubleDouble.h"
 #include "Tudat/Basics/basicTypedefs.h"
 #include "Tudat/Basics/identityElements.h"
 
@@ -97,6 +99,14 @@ extern template class Interpolator< double, Eigen::Matrix< long double, Eigen::D
 extern template class Interpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 1 > >;
 extern template class Interpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 6 > >;
 extern template class Interpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > >;
+
+extern template class Interpolator< DoubleDoubleTime, Eigen::VectorXd >;
+extern template class Interpolator< DoubleDoubleTime, Eigen::Vector6d >;
+extern template class Interpolator< DoubleDoubleTime, Eigen::MatrixXd >;
+
+extern template class Interpolator< double, Eigen::VectorXdd >;
+extern template class Interpolator< double, Eigen::Vector6dd >;
+extern template class Interpolator< double, Eigen::MatrixXdd >;
 #endif
 
 } // namespace interpolators
@@ -22,6 +22,14 @@ template class LagrangeInterpolator< double, Eigen::Matrix< long double, Eigen::
 template class LagrangeInterpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 1 >, long double >;
 template class LagrangeInterpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 6 >, long double >;
 template class LagrangeInterpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic,  Eigen::Dynamic >, long double >;
+
+template class LagrangeInterpolator< DoubleDoubleTime, Eigen::VectorXd, double >;
+template class LagrangeInterpolator< DoubleDoubleTime, Eigen::Vector6d, double >;
+template class LagrangeInterpolator< DoubleDoubleTime, Eigen::MatrixXd, double >;
+
+template class LagrangeInterpolator< double, Eigen::VectorXdd >;
+template class LagrangeInterpolator< double, Eigen::Vector6dd >;
+template class LagrangeInterpolator< double, Eigen::MatrixXdd >;
 #endif
 
 } // namespace interpolators
@@ -499,6 +499,14 @@ extern template class LagrangeInterpolator< double, Eigen::Matrix< long double,
 extern template class LagrangeInterpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 1 >, long double >;
 extern template class LagrangeInterpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 6 >, long double >;
 extern template class LagrangeInterpolator< Time, Eigen::Matrix< long double, Eigen::Dynamic,  Eigen::Dynamic >, long double >;
+
+extern template class LagrangeInterpolator< DoubleDoubleTime, Eigen::VectorXd, double >;
+extern template class LagrangeInterpolator< DoubleDoubleTime, Eigen::Vector6d, double >;
+extern template class LagrangeInterpolator< DoubleDoubleTime, Eigen::MatrixXd, double >;
+
+extern template class LagrangeInterpolator< double, Eigen::VectorXdd >;
+extern template class LagrangeInterpolator< double, Eigen::Vector6dd >;
+extern template class LagrangeInterpolator< double, Eigen::MatrixXdd >;
 #endif
 
 //! Typedef for LagrangeInterpolator with double as both its dependent and independent data type.
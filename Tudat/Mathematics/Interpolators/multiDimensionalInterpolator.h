@@ -165,7 +165,7 @@ public:
      *  Function to return the ector with dependent variables used by the interpolator.
      *  \return Dependent variables used by the interpolator.
      */
-    boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions ) > getDependentValues( )
+    virtual boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions ) > getDependentValues( )
     {
         return dependentData_;
     }
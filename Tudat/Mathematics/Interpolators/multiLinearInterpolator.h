@@ -106,25 +106,52 @@ public:
                                    *dependentData.shape( ) ) ); // resize dependent data container
         dependentData_ = dependentData;
 
-        // Check consistency of template arguments and input variables.
-        if ( independentValues.size( ) != NumberOfDimensions )
-        {
-            throw std::runtime_error( "Error: dimension of independent value vector provided to constructor "
-                                      "incompatible with template parameter." );
-        }
+        // Check consistency of input and create lookup scheme from independent variable data points.
+        checkInputConsistency( dependentData.shape( ) );
+        this->makeLookupSchemes( selectedLookupScheme );
+    }
 
-        // Check consistency of input data of dependent and independent data.
-        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+    //! Constructor taking independent variable data and a view on dependent variable data, which is not copied.
+    /*!
+     *  Constructor taking independent variable data and a view on dependent variable data. The dependent data is not
+     *  copied, but accessed through the view (for instance on a memory-mapped file, see
+     *  input_output::MappedAerodynamicCoefficientTable) for each interpolation. The data must remain valid for as long
+     *  as the shared pointer to the view (which is retained by this object) exists.
+     *  \param independentValues Vector of vectors containing data points of independent variables,
+     *      each must be sorted in ascending order.
+     *  \param dependentDataView View on multi-dimensional array of dependent data at each point of
+     *      hyper-rectangular grid formed by independent variable points.
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used
+     *      to find the nearest lower data point in the independent variables when requesting
+     *      interpolation.
+     *  \param boundaryHandling Vector of boundary handling methods, in case independent variable is outside the
+     *      specified range.
+     *  \param defaultExtrapolationValue Vector of pairs of default values to be used for extrapolation, in case
+     *      of use_default_value or use_default_value_with_warning as methods for boundaryHandling.
+     */
+    MultiLinearInterpolator(
+            const std::vector< std::vector< IndependentVariableType > >& independentValues,
+            const std::shared_ptr< const boost::const_multi_array_ref<
+            DependentVariableType, static_cast< size_t >( NumberOfDimensions ) > > dependentDataView,
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
+            const std::vector< BoundaryInterpolationType >& boundaryHandling =
+            std::vector< BoundaryInterpolationType >( NumberOfDimensions, extrapolate_at_boundary ),
+            const std::vector< std::pair< DependentVariableType, DependentVariableType > >& defaultExtrapolationValue =
+            std::vector< std::pair< DependentVariableType, DependentVariableType > >(
+                NumberOfDimensions, std::make_pair( IdentityElement::getAdditionIdentity< DependentVariableType >( ),
+                                                    IdentityElement::getAdditionIdentity< DependentVariableType >( ) ) ) ) :
+        MultiDimensionalInterpolator< IndependentVariableType, DependentVariableType, NumberOfDimensions >(
+            boundaryHandling, defaultExtrapolationValue ),
+        dependentDataView_( dependentDataView )
+    {
+        if( dependentDataView_ == nullptr )
         {
-            if ( independentValues[ i ].size( ) != dependentData.shape( )[ i ] )
-            {
-                std::string errorMessage = "Error: number of data points in dimension " +
-                        std::to_string( i ) + " of independent and dependent data incompatible.";
-                throw std::runtime_error( errorMessage );
-            }
+            throw std::runtime_error( "Error: no dependent data provided to multi-linear interpolator." );
         }
 
-        // Create lookup scheme from independent variable data points.
+        // Save independent variables, check consistency of input and create lookup scheme.
+        independentValues_ = independentValues;
+        checkInputConsistency( dependentDataView_->shape( ) );
         this->makeLookupSchemes( selectedLookupScheme );
     }
 
@@ -162,6 +189,26 @@ public:
      */
     ~MultiLinearInterpolator( ){ }
 
+    //! Function to return the dependent variables used by the interpolator.
+    /*!
+     *  Function to return the dependent variables used by the interpolator (copied from the view on the dependent
+     *  data, if the interpolator was created from a view).
+     *  \return Dependent variables used by the interpolator.
+     */
+    boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions ) > getDependentValues( )
+    {
+        if( dependentDataView_ == nullptr )
+        {
+            return dependentData_;
+        }
+
+        boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions ) > dependentValues(
+                    reinterpret_cast< boost::array< size_t, NumberOfDimensions > const& >(
+                        *dependentDataView_->shape( ) ) );
+        dependentValues = *dependentDataView_;
+        return dependentValues;
+    }
+
     //! Function to perform interpolation.
     /*!
      *  This function performs the multilinear interpolation.
@@ -220,6 +267,45 @@ public:
 
 private:
 
+    //! Function to check the consistency of the independent variables and the dependent data.
+    /*!
+     *  Function to check the consistency of the independent variables and the dependent data, throwing an exception if
+     *  they are inconsistent.
+     *  \param dependentDataShape Number of data points of the dependent data in each dimension.
+     */
+    void checkInputConsistency( const size_t* dependentDataShape )
+    {
+        // Check consistency of template arguments and input variables.
+        if ( independentValues_.size( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error( "Error: dimension of independent value vector provided to constructor "
+                                      "incompatible with template parameter." );
+        }
+
+        // Check consistency of input data of dependent and independent data.
+        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            if ( independentValues_[ i ].size( ) != dependentDataShape[ i ] )
+            {
+                std::string errorMessage = "Error: number of data points in dimension " +
+                        std::to_string( i ) + " of independent and dependent data incompatible.";
+                throw std::runtime_error( errorMessage );
+            }
+        }
+    }
+
+    //! Function to retrieve an entry of the dependent data, from the owned data or the view (if provided).
+    /*!
+     *  Function to retrieve an entry of the dependent data, from the owned data or the view (if provided).
+     *  \param arrayIndices Indices of the entry in the dependent data.
+     *  \return Entry of the dependent data.
+     */
+    const DependentVariableType& getDependentDataEntry(
+            const boost::array< unsigned int, NumberOfDimensions >& arrayIndices ) const
+    {
+        return ( dependentDataView_ == nullptr ) ? dependentData_( arrayIndices ) : ( *dependentDataView_ )( arrayIndices );
+    }
+
     //! Make the lookup scheme that is to be used.
     /*!
      * This function creates the look up scheme that is to be used in determining the interval of
@@ -313,10 +399,10 @@ private:
         if ( currentDimension == NumberOfDimensions - 1 )
         {
             currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentDimension ];
-            lowerContribution = dependentData_( currentArrayIndices );
+            lowerContribution = getDependentDataEntry( currentArrayIndices );
             currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentDimension ]
                     + 1;
-            upperContribution = dependentData_( currentArrayIndices );
+            upperContribution = getDependentDataEntry( currentArrayIndices );
         }
 
         // If at lower dimension, update currentArrayIndices and call function with
@@ -338,6 +424,10 @@ private:
                 lowerFraction * lowerContribution;
         return returnValue;
     }
+
+    //! View on dependent data, if provided to the constructor (in which case dependentData_ is empty).
+    std::shared_ptr< const boost::const_multi_array_ref<
+    DependentVariableType, static_cast< size_t >( NumberOfDimensions ) > > dependentDataView_;
 };
 
 extern template class MultiLinearInterpolator< double, Eigen::Vector6d, 1 >;
@@ -0,0 +1,79 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmark comparing the computational cost, and precision of the final position, of fixed-step numerical
+ *      integration of a Kepler orbit with double, long double and double-double states. Only built if
+ *      BUILD_BENCHMARKS is set.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "Tudat/Mathematics/NumericalIntegrators/UnitTests/mixedPrecisionKeplerOrbitIntegration.h"
+
+//! Function to integrate a Kepler orbit with given integrator, and return the wall-clock time (in seconds) taken.
+template< typename StateType, typename StateDerivativeType >
+double timeKeplerOrbitIntegration(
+        const std::shared_ptr< tudat::numerical_integrators::NumericalIntegrator<
+        double, StateType, StateDerivativeType, double > > integrator,
+        const double timeStep, const int numberOfSteps, Eigen::Matrix< long double, Eigen::Dynamic, 1 >& finalState )
+{
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    tudat::unit_tests::integrateMixedPrecisionKeplerOrbit< StateType, StateDerivativeType >(
+                integrator, timeStep, numberOfSteps, finalState );
+    return std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+}
+
+int main( )
+{
+    using namespace tudat;
+    using namespace tudat::unit_tests;
+
+    const double timeStep = 10.0;
+    const int numberOfSteps = 100000;
+
+    const Eigen::VectorXd initialState = getKeplerOrbitInitialState( );
+
+    std::vector< numerical_integrators::AvailableIntegrators > integratorTypes =
+    { numerical_integrators::rungeKutta4, numerical_integrators::rungeKuttaVariableStepSize };
+    for( unsigned int i = 0; i < integratorTypes.size( ); i++ )
+    {
+        std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings =
+                getFixedStepIntegratorSettings( integratorTypes.at( i ), 0.0, timeStep );
+
+        Eigen::VectorXld finalStateDouble, finalStateLongDouble, finalStateDoubleDouble;
+
+        const double cpuTimeDouble = timeKeplerOrbitIntegration< Eigen::VectorXd, Eigen::VectorXd >(
+                    numerical_integrators::createIntegrator< double, Eigen::VectorXd, double >(
+                        &computeCastKeplerOrbitStateDerivative< double >, initialState, integratorSettings ),
+                    timeStep, numberOfSteps, finalStateDouble );
+        const double cpuTimeLongDouble = timeKeplerOrbitIntegration< Eigen::VectorXld, Eigen::VectorXld >(
+                    numerical_integrators::createIntegrator< double, Eigen::VectorXld, double >(
+                        &computeCastKeplerOrbitStateDerivative< long double >,
+                        initialState.cast< long double >( ), integratorSettings ),
+                    timeStep, numberOfSteps, finalStateLongDouble );
+        const double cpuTimeDoubleDouble = timeKeplerOrbitIntegration< Eigen::VectorXdd, Eigen::VectorXd >(
+                    numerical_integrators::createMixedPrecisionIntegrator<
+                    double, Eigen::VectorXdd, Eigen::VectorXd, double >(
+                        &computeMixedPrecisionKeplerOrbitStateDerivative,
+                        initialState.cast< DoubleDouble >( ), integratorSettings ),
+                    timeStep, numberOfSteps, finalStateDoubleDouble );
+
+        std::cout << "Integrator " << integratorTypes.at( i ) << ", " << numberOfSteps << " steps" << std::endl
+                  << "  double:        " << cpuTimeDouble << " s, position difference w.r.t. double-double "
+                  << ( finalStateDouble - finalStateDoubleDouble ).segment( 0, 3 ).norm( ) << " m" << std::endl
+                  << "  long double:   " << cpuTimeLongDouble << " s, position difference w.r.t. double-double "
+                  << ( finalStateLongDouble - finalStateDoubleDouble ).segment( 0, 3 ).norm( ) << " m" << std::endl
+                  << "  double-double: " << cpuTimeDoubleDouble << " s" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
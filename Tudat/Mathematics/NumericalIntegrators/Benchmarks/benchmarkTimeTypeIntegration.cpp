@@ -0,0 +1,79 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Benchmark comparing the computational cost, and precision of the final time, of fixed-step numerical
+ *      integration of a Kepler orbit with double, Time and DoubleDoubleTime as independent variable. Only built if
+ *      BUILD_BENCHMARKS is set.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "Tudat/Basics/timeType.h"
+#include "Tudat/Basics/doubleDoubleTime.h"
+#include "Tudat/Mathematics/NumericalIntegrators/UnitTests/timeTypeKeplerOrbitIntegration.h"
+
+//! Function to integrate a Kepler orbit with given time type, and return the wall-clock time (in seconds) taken.
+template< typename TimeType, typename TimeStepType >
+double timeKeplerOrbitIntegration( const TimeType initialTime, const TimeStepType timeStep, const int numberOfSteps,
+                                   const tudat::numerical_integrators::AvailableIntegrators integratorType,
+                                   TimeType& finalTime )
+{
+    Eigen::VectorXd finalState;
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    tudat::unit_tests::integrateTimeTypeKeplerOrbit< TimeType, TimeStepType >(
+                initialTime, timeStep, numberOfSteps, integratorType, finalState, finalTime );
+    return std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+}
+
+int main( )
+{
+    using namespace tudat;
+
+    const double initialTime = 1.0E9;
+    const double timeStep = 10.0 / 3.0;
+    const int numberOfSteps = 100000;
+
+    // Final time, computed exactly (product of step size and number of steps fits in double-double).
+    const DoubleDoubleTime expectedFinalTime =
+            DoubleDoubleTime( initialTime ) + static_cast< double >( numberOfSteps ) * DoubleDoubleTime( timeStep );
+
+    std::vector< numerical_integrators::AvailableIntegrators > integratorTypes =
+    { numerical_integrators::rungeKutta4, numerical_integrators::rungeKuttaVariableStepSize };
+    for( unsigned int i = 0; i < integratorTypes.size( ); i++ )
+    {
+        double finalTimeDouble;
+        Time finalTimeTime;
+        DoubleDoubleTime finalTimeDoubleDoubleTime;
+
+        const double cpuTimeDouble = timeKeplerOrbitIntegration< double, double >(
+                    initialTime, timeStep, numberOfSteps, integratorTypes.at( i ), finalTimeDouble );
+        const double cpuTimeTime = timeKeplerOrbitIntegration< Time, long double >(
+                    Time( initialTime ), static_cast< long double >( timeStep ), numberOfSteps, integratorTypes.at( i ),
+                    finalTimeTime );
+        const double cpuTimeDoubleDoubleTime = timeKeplerOrbitIntegration< DoubleDoubleTime, double >(
+                    DoubleDoubleTime( initialTime ), timeStep, numberOfSteps, integratorTypes.at( i ),
+                    finalTimeDoubleDoubleTime );
+
+        std::cout << "Integrator " << integratorTypes.at( i ) << ", " << numberOfSteps << " steps" << std::endl
+                  << "  double:           " << cpuTimeDouble << " s, final time error "
+                  << std::fabs( ( finalTimeDouble - expectedFinalTime ).getSeconds< double >( ) ) << " s" << std::endl
+                  << "  Time:             " << cpuTimeTime << " s, final time error "
+                  << std::fabs( ( DoubleDoubleTime( finalTimeTime ) - expectedFinalTime ).getSeconds< double >( ) )
+                  << " s" << std::endl
+                  << "  DoubleDoubleTime: " << cpuTimeDoubleDoubleTime << " s, final time error "
+                  << std::fabs( ( finalTimeDoubleDoubleTime - expectedFinalTime ).getSeconds< double >( ) )
+                  << " s" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
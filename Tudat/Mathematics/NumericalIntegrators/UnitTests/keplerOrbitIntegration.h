@@ -0,0 +1,75 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_KEPLER_ORBIT_INTEGRATION_H
+#define TUDAT_KEPLER_ORBIT_INTEGRATION_H
+
+#include <cmath>
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to retrieve the initial Cartesian state of the Kepler orbit used in the integrator precision tests (in SI
+//! units)
+inline Eigen::VectorXd getKeplerOrbitInitialState( )
+{
+    return ( Eigen::VectorXd( 6 ) << 7.0E6, 0.0, 0.0, 0.0, 7.5E3, 1.0E3 ).finished( );
+}
+
+//! Function to compute the state derivative of a Kepler orbit around the Earth (in SI units), in double precision
+inline Eigen::VectorXd computeKeplerOrbitStateDerivative( const Eigen::VectorXd& state )
+{
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd( 6 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -3.986004418E14 * state.segment( 0, 3 ) /
+            std::pow( state.segment( 0, 3 ).norm( ), 3.0 );
+    return stateDerivative;
+}
+
+//! Function to create integrator settings for fixed-step integration.
+/*!
+ *  Function to create integrator settings for fixed-step integration. For a variable step size integrator (RKF7(8)),
+ *  step size control is switched off by setting the minimum and maximum step size to the nominal step size, with
+ *  tolerances of 1, so that each step is taken with the nominal step size.
+ *  \param integratorType Type of integrator to use (rungeKutta4 or rungeKuttaVariableStepSize).
+ *  \param initialTime Time at which integration is started
+ *  \param timeStep Time step of integration
+ *  \return Integrator settings for fixed-step integration.
+ */
+template< typename TimeType >
+std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > getFixedStepIntegratorSettings(
+        const numerical_integrators::AvailableIntegrators integratorType,
+        const TimeType initialTime, const TimeType timeStep )
+{
+    if( integratorType == numerical_integrators::rungeKutta4 )
+    {
+        return std::make_shared< numerical_integrators::IntegratorSettings< TimeType > >(
+                    integratorType, initialTime, timeStep );
+    }
+    else
+    {
+        return std::make_shared< numerical_integrators::RungeKuttaVariableStepSizeSettingsScalarTolerances< TimeType > >(
+                    initialTime, timeStep, numerical_integrators::RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                    timeStep, timeStep, 1.0, 1.0 );
+    }
+}
+
+} // namespace unit_tests
+
+} // namespace tudat
+
+#endif // TUDAT_KEPLER_ORBIT_INTEGRATION_H
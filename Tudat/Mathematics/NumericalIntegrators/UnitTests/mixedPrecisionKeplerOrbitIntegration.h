@@ -0,0 +1,63 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_MIXED_PRECISION_KEPLER_ORBIT_INTEGRATION_H
+#define TUDAT_MIXED_PRECISION_KEPLER_ORBIT_INTEGRATION_H
+
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/doubleDouble.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/UnitTests/keplerOrbitIntegration.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to compute the Kepler orbit state derivative for a state of given scalar type, in the same manner as the
+//! propagators do for extended precision states (i.e. force model evaluated in double, result cast to state scalar type).
+template< typename StateScalarType >
+Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > computeCastKeplerOrbitStateDerivative(
+        const double, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& state )
+{
+    return computeKeplerOrbitStateDerivative( state.template cast< double >( ) ).template cast< StateScalarType >( );
+}
+
+//! Function to compute the Kepler orbit state derivative for a double-double state, with the derivative in double
+//! precision (i.e. only the accumulation of the state by the integrator is done in double-double precision).
+inline Eigen::VectorXd computeMixedPrecisionKeplerOrbitStateDerivative( const double, const Eigen::VectorXdd& state )
+{
+    return computeKeplerOrbitStateDerivative( state.cast< double >( ) );
+}
+
+//! Function to integrate a Kepler orbit with fixed step size, for given (mixed precision) integrator
+template< typename StateType, typename StateDerivativeType >
+void integrateMixedPrecisionKeplerOrbit(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator<
+        double, StateType, StateDerivativeType, double > > integrator,
+        const double timeStep, const int numberOfSteps, Eigen::Matrix< long double, Eigen::Dynamic, 1 >& finalState )
+{
+    for( int i = 0; i < numberOfSteps; i++ )
+    {
+        integrator->performIntegrationStep( timeStep );
+    }
+
+    finalState = integrator->getCurrentState( ).template cast< long double >( );
+}
+
+} // namespace unit_tests
+
+} // namespace tudat
+
+#endif // TUDAT_MIXED_PRECISION_KEPLER_ORBIT_INTEGRATION_H
@@ -0,0 +1,70 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TIME_TYPE_KEPLER_ORBIT_INTEGRATION_H
+#define TUDAT_TIME_TYPE_KEPLER_ORBIT_INTEGRATION_H
+
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/UnitTests/keplerOrbitIntegration.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to compute the state derivative of a Kepler orbit around the Earth (in SI units), for the templated time
+//! representation
+template< typename TimeType >
+Eigen::VectorXd computeTimeTypeKeplerOrbitStateDerivative( const TimeType, const Eigen::VectorXd& state )
+{
+    return computeKeplerOrbitStateDerivative( state );
+}
+
+//! Function to integrate a Kepler orbit with fixed step size, using the templated time representation.
+/*!
+ *  Function to integrate a Kepler orbit with fixed step size, using the templated time representation.
+ *  \param initialTime Time at which integration is started
+ *  \param timeStep Time step of integration
+ *  \param numberOfSteps Number of integration steps to take
+ *  \param integratorType Type of integrator to use.
+ *  \param finalState Final integrated state (returned by reference).
+ *  \param finalTime Final time of integration (returned by reference).
+ */
+template< typename TimeType, typename TimeStepType >
+void integrateTimeTypeKeplerOrbit( const TimeType initialTime, const TimeStepType timeStep, const int numberOfSteps,
+                                   const numerical_integrators::AvailableIntegrators integratorType,
+                                   Eigen::VectorXd& finalState, TimeType& finalTime )
+{
+    std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings =
+            getFixedStepIntegratorSettings< TimeType >( integratorType, initialTime, timeStep );
+
+    std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, Eigen::VectorXd, Eigen::VectorXd, TimeStepType > >
+            integrator = numerical_integrators::createIntegrator< TimeType, Eigen::VectorXd, TimeStepType >(
+                &computeTimeTypeKeplerOrbitStateDerivative< TimeType >, getKeplerOrbitInitialState( ),
+                integratorSettings );
+
+    for( int i = 0; i < numberOfSteps; i++ )
+    {
+        integrator->performIntegrationStep( timeStep );
+    }
+
+    finalState = integrator->getCurrentState( );
+    finalTime = integrator->getCurrentIndependentVariable( );
+}
+
+} // namespace unit_tests
+
+} // namespace tudat
+
+#endif // TUDAT_TIME_TYPE_KEPLER_ORBIT_INTEGRATION_H
@@ -0,0 +1,87 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/doubleDouble.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/UnitTests/mixedPrecisionKeplerOrbitIntegration.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_mixed_precision_integration )
+
+//! Compare numerical precision of integration with double, long double and double-double states
+BOOST_AUTO_TEST_CASE( testMixedPrecisionIntegration )
+{
+    const double timeStep = 10.0;
+    const int numberOfSteps = 100000;
+
+    const Eigen::VectorXd initialState = getKeplerOrbitInitialState( );
+
+    std::vector< numerical_integrators::AvailableIntegrators > integratorTypes =
+    { numerical_integrators::rungeKutta4, numerical_integrators::rungeKuttaVariableStepSize };
+    for( unsigned int i = 0; i < integratorTypes.size( ); i++ )
+    {
+        std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings =
+                getFixedStepIntegratorSettings( integratorTypes.at( i ), 0.0, timeStep );
+
+        Eigen::VectorXld finalStateDouble, finalStateLongDouble, finalStateDoubleDouble;
+
+        integrateMixedPrecisionKeplerOrbit< Eigen::VectorXd, Eigen::VectorXd >(
+                    numerical_integrators::createIntegrator< double, Eigen::VectorXd, double >(
+                        &computeCastKeplerOrbitStateDerivative< double >, initialState, integratorSettings ),
+                    timeStep, numberOfSteps, finalStateDouble );
+        integrateMixedPrecisionKeplerOrbit< Eigen::VectorXld, Eigen::VectorXld >(
+                    numerical_integrators::createIntegrator< double, Eigen::VectorXld, double >(
+                        &computeCastKeplerOrbitStateDerivative< long double >,
+                        initialState.cast< long double >( ), integratorSettings ),
+                    timeStep, numberOfSteps, finalStateLongDouble );
+        integrateMixedPrecisionKeplerOrbit< Eigen::VectorXdd, Eigen::VectorXd >(
+                    numerical_integrators::createMixedPrecisionIntegrator<
+                    double, Eigen::VectorXdd, Eigen::VectorXd, double >(
+                        &computeMixedPrecisionKeplerOrbitStateDerivative,
+                        initialState.cast< DoubleDouble >( ), integratorSettings ),
+                    timeStep, numberOfSteps, finalStateDoubleDouble );
+
+        // Use double-double result as reference: the truncation error is identical for all three cases, so that the
+        // differences are caused by the rounding errors of the state accumulation
+        const long double positionErrorDouble =
+                ( finalStateDouble - finalStateDoubleDouble ).segment( 0, 3 ).norm( );
+        const long double positionErrorLongDouble =
+                ( finalStateLongDouble - finalStateDoubleDouble ).segment( 0, 3 ).norm( );
+
+        // Check that double-double state accumulation is at least as precise as long double, which is more precise than
+        // double.
+        BOOST_CHECK( positionErrorLongDouble < positionErrorDouble );
+        BOOST_CHECK_SMALL( static_cast< double >( positionErrorLongDouble ), 1.0E-5 );
+
+        // Check that results are consistent
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( finalStateDoubleDouble( j ), finalStateDouble( j ), 1.0E-8 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,83 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/timeType.h"
+#include "Tudat/Basics/doubleDoubleTime.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/UnitTests/timeTypeKeplerOrbitIntegration.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_time_type_integration )
+
+//! Compare precision of final time, and integrated state, of numerical integration with different time types.
+BOOST_AUTO_TEST_CASE( testTimeTypeIntegrationPrecision )
+{
+    const double initialTime = 1.0E9;
+    const double timeStep = 10.0 / 3.0;
+    const int numberOfSteps = 100000;
+
+    // Final time, computed exactly (product of step size and number of steps fits in double-double).
+    const DoubleDoubleTime expectedFinalTime =
+            DoubleDoubleTime( initialTime ) + static_cast< double >( numberOfSteps ) * DoubleDoubleTime( timeStep );
+
+    std::vector< numerical_integrators::AvailableIntegrators > integratorTypes =
+    { numerical_integrators::rungeKutta4, numerical_integrators::rungeKuttaVariableStepSize };
+    for( unsigned int i = 0; i < integratorTypes.size( ); i++ )
+    {
+        Eigen::VectorXd finalStateDouble, finalStateTime, finalStateDoubleDoubleTime;
+        double finalTimeDouble;
+        Time finalTimeTime;
+        DoubleDoubleTime finalTimeDoubleDoubleTime;
+
+        integrateTimeTypeKeplerOrbit< double, double >(
+                    initialTime, timeStep, numberOfSteps, integratorTypes.at( i ), finalStateDouble, finalTimeDouble );
+        integrateTimeTypeKeplerOrbit< Time, long double >(
+                    Time( initialTime ), static_cast< long double >( timeStep ), numberOfSteps, integratorTypes.at( i ),
+                    finalStateTime, finalTimeTime );
+        integrateTimeTypeKeplerOrbit< DoubleDoubleTime, double >(
+                    DoubleDoubleTime( initialTime ), timeStep, numberOfSteps, integratorTypes.at( i ),
+                    finalStateDoubleDoubleTime, finalTimeDoubleDoubleTime );
+
+        const double timeErrorDouble = std::fabs( ( finalTimeDouble - expectedFinalTime ).getSeconds< double >( ) );
+        const double timeErrorTime = std::fabs(
+                    ( DoubleDoubleTime( finalTimeTime ) - expectedFinalTime ).getSeconds< double >( ) );
+        const double timeErrorDoubleDoubleTime = std::fabs(
+                    ( finalTimeDoubleDoubleTime - expectedFinalTime ).getSeconds< double >( ) );
+
+        // Check that double-double time accumulation is (close to) exact, and at least as good as Time.
+        BOOST_CHECK_SMALL( timeErrorDoubleDoubleTime, 1.0E-18 );
+        BOOST_CHECK( timeErrorDoubleDoubleTime <= timeErrorTime );
+        BOOST_CHECK( timeErrorTime <= timeErrorDouble );
+
+        // As the dynamics are autonomous, integrated states should be (near-)identical.
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( finalStateDoubleDoubleTime( j ), finalStateDouble( j ), 1.0E-12 );
+            BOOST_CHECK_CLOSE_FRACTION( finalStateDoubleDoubleTime( j ), finalStateTime( j ), 1.0E-12 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -21,12 +21,23 @@ Eigen::VectorXd, long double > > createIntegrator< Time, Eigen::VectorXd, long d
         std::function< Eigen::VectorXd( const Time, const Eigen::VectorXd& ) > stateDerivativeFunction,
         const Eigen::VectorXd initialState, std::shared_ptr< IntegratorSettings< Time > > integratorSettings );
 
+template std::shared_ptr< numerical_integrators::NumericalIntegrator< DoubleDoubleTime, Eigen::VectorXd,
+Eigen::VectorXd, double > > createIntegrator< DoubleDoubleTime, Eigen::VectorXd, double >(
+        std::function< Eigen::VectorXd( const DoubleDoubleTime, const Eigen::VectorXd& ) > stateDerivativeFunction,
+        const Eigen::VectorXd initialState, std::shared_ptr< IntegratorSettings< DoubleDoubleTime > > integratorSettings );
+
 template std::shared_ptr< numerical_integrators::NumericalIntegrator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 1 >,
 Eigen::Matrix< long double, Eigen::Dynamic, 1 >, long double > > createIntegrator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 1 >, long double >(
         std::function< Eigen::Matrix< long double, Eigen::Dynamic, 1 >(
             const Time, const Eigen::Matrix< long double, Eigen::Dynamic, 1 >& ) > stateDerivativeFunction,
         const Eigen::Matrix< long double, Eigen::Dynamic, 1 > initialState, std::shared_ptr< IntegratorSettings< Time > > integratorSettings );
 
+template std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::VectorXdd,
+Eigen::VectorXd, double > > createMixedPrecisionIntegrator< double, Eigen::VectorXdd, Eigen::VectorXd, double >(
+        std::function< Eigen::VectorXd( const double, const Eigen::VectorXdd& ) > stateDerivativeFunction,
+        const Eigen::VectorXdd initialState, std::shared_ptr< IntegratorSettings< double > > integratorSettings );
+
+
 
 
 
@@ -46,6 +57,11 @@ Eigen::MatrixXd, long double > > createIntegrator< Time, Eigen::MatrixXd, long d
         std::function< Eigen::MatrixXd( const Time, const Eigen::MatrixXd& ) > stateDerivativeFunction,
         const Eigen::MatrixXd initialState, std::shared_ptr< IntegratorSettings< Time > > integratorSettings );
 
+template std::shared_ptr< numerical_integrators::NumericalIntegrator< DoubleDoubleTime, Eigen::MatrixXd,
+Eigen::MatrixXd, double > > createIntegrator< DoubleDoubleTime, Eigen::MatrixXd, double >(
+        std::function< Eigen::MatrixXd( const DoubleDoubleTime, const Eigen::MatrixXd& ) > stateDerivativeFunction,
+        const Eigen::MatrixXd initialState, std::shared_ptr< IntegratorSettings< DoubleDoubleTime > > integratorSettings );
+
 template std::shared_ptr< numerical_integrators::NumericalIntegrator< Time, Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic >,
 Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic >, long double > > createIntegrator< Time, Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic >, long double >(
         std::function< Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic >(
@@ -16,6 +16,8 @@
 #include <boost/lexical_cast.hpp>
 
 #include "Tudat/Basics/timeType.h"
+#include "Tudat/Basics/doubleDoubleTime.h"
+#include "Tudat/Basics/doubleDouble.h"
 #include "Tudat/Mathematics/NumericalIntegrators/bulirschStoerVariableStepsizeIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/numericalIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKutta4Integrator.h"
@@ -80,6 +82,16 @@ public:
      */
     virtual ~IntegratorSettings( ) { }
 
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings.
+     *  \return Copy of the integrator settings.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< IntegratorSettings< IndependentVariableType > >( *this );
+    }
+
     //! Type of numerical integrator
     /*!
      *  Type of numerical integrator, from enum of available integrators.
@@ -174,6 +186,27 @@ public:
      */
     virtual ~RungeKuttaVariableStepSizeBaseSettings( ) { }
 
+    //! Function to set the values of the independent variable across which no integration step may be taken.
+    /*!
+     *  Function to set the values of the independent variable across which no integration step may be taken, for
+     *  instance eclipse entry and exit times (see RungeKuttaVariableStepSizeIntegrator::setForcedStepBoundaries).
+     *  \param forcedStepBoundaries Values of independent variable at which integration steps are to end.
+     */
+    void setForcedStepBoundaries( const std::vector< double >& forcedStepBoundaries )
+    {
+        forcedStepBoundaries_ = forcedStepBoundaries;
+    }
+
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings.
+     *  \return Copy of the integrator settings.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType > >( *this );
+    }
+
     //! Boolean denoting whether integration error tolerances are defined as a scalar (or vector).
     bool areTolerancesDefinedAsScalar_;
 
@@ -198,6 +231,9 @@ public:
     //! Minimum decrease factor in time step in subsequent iterations.
     IndependentVariableType minimumFactorDecreaseForNextStepSize_;
 
+    //! Values of independent variable at which integration steps are to end (empty if none).
+    std::vector< double > forcedStepBoundaries_;
+
 };
 
 //! Class to define settings of variable step RK numerical integrator with scalar tolerances.
@@ -310,6 +346,16 @@ public:
      */
     ~RungeKuttaVariableStepSizeSettingsScalarTolerances( ) { }
 
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings.
+     *  \return Copy of the integrator settings.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType > >( *this );
+    }
+
     //! Relative error tolerance for step size control.
     IndependentVariableType relativeErrorTolerance_;
 
@@ -376,6 +422,16 @@ public:
      */
     ~RungeKuttaVariableStepSizeSettingsVectorTolerances( ) { }
 
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings.
+     *  \return Copy of the integrator settings.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType, DependentVariableType > >( *this );
+    }
+
     //! Relative error tolerance for step size control.
     DependentVariableType relativeErrorTolerance_;
 
@@ -440,6 +496,16 @@ public:
      */
     ~BulirschStoerIntegratorSettings( ){ }
 
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings.
+     *  \return Copy of the integrator settings.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< BulirschStoerIntegratorSettings< IndependentVariableType > >( *this );
+    }
+
     //! Type of sequence that is to be used for Bulirsch-Stoer integrator
     ExtrapolationMethodStepSequences extrapolationSequence_;
 
@@ -528,6 +594,16 @@ public:
      */
     ~AdamsBashforthMoultonSettings( ){ }
 
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings.
+     *  \return Copy of the integrator settings.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< AdamsBashforthMoultonSettings< IndependentVariableType > >( *this );
+    }
+
     //! Minimum step size for integration.
     /*!
      *  Minimum step size for integration. Integration stops (exception thrown) if time step comes below this value.
@@ -554,6 +630,126 @@ public:
 
 };
 
+//! Function to create a Runge-Kutta variable step size numerical integrator.
+/*!
+ *  Function to create a Runge-Kutta variable step size numerical integrator from given integrator settings, state
+ *  derivative function and initial state. The state derivative type may differ from the state type (e.g. to use a
+ *  state derivative in double precision for a state in extended precision).
+ *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+ *  \param initialState Initial state for numerical integration.
+ *  \param integratorSettings Settings for numerical integrator.
+ *  \return Numerical integrator object.
+ */
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType,
+          typename IndependentVariableStepType = IndependentVariableType >
+std::shared_ptr< numerical_integrators::NumericalIntegrator< IndependentVariableType, StateType,
+StateDerivativeType, IndependentVariableStepType > > createRungeKuttaVariableStepSizeIntegrator(
+        std::function< StateDerivativeType(
+            const IndependentVariableType, const StateType& ) > stateDerivativeFunction,
+        const StateType& initialState,
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > integratorSettings )
+{
+    // Declare eventual output
+    std::shared_ptr< NumericalIntegrator
+            < IndependentVariableType, StateType, StateDerivativeType, IndependentVariableStepType > > integrator;
+
+    // Cast integrator
+    std::shared_ptr< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType > >
+            variableStepIntegratorSettings = std::dynamic_pointer_cast< RungeKuttaVariableStepSizeBaseSettings<
+            IndependentVariableType > >( integratorSettings );
+
+    // Check input consistency
+    if ( variableStepIntegratorSettings == nullptr )
+    {
+        throw std::runtime_error( "Error, type of integrator settings (rungeKuttaVariableStepSize) not compatible with "
+                                  "selected integrator (derived class of IntegratorSettings must be "
+                                  "RungeKuttaVariableStepSizeBaseSettings for this type)." );
+    }
+
+    // Get requested RK coefficients
+    RungeKuttaCoefficients coefficients = RungeKuttaCoefficients::get( variableStepIntegratorSettings->coefficientSet_ );
+
+    // Check which constructor is being used
+    if ( variableStepIntegratorSettings->areTolerancesDefinedAsScalar_ )
+    {
+        // Settings with scalar tolerances
+        std::shared_ptr< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType > >
+                scalarTolerancesIntegratorSettings = std::dynamic_pointer_cast<
+                RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType > >( variableStepIntegratorSettings );
+
+        // Check input consistency
+        if ( scalarTolerancesIntegratorSettings == nullptr )
+        {
+            throw std::runtime_error( "Error while creating Runge-Kutta variable step size integrator. Input class must be of "
+                                      "RungeKuttaVariableStepSizeSettingsScalarTolerances type." );
+        }
+
+        // Create Runge-Kutta integrator with scalar tolerances
+        integrator = std::make_shared< RungeKuttaVariableStepSizeIntegrator
+                < IndependentVariableType, StateType, StateDerivativeType, IndependentVariableStepType > >
+                ( coefficients, stateDerivativeFunction, integratorSettings->initialTime_, initialState,
+                  static_cast< IndependentVariableStepType >( scalarTolerancesIntegratorSettings->minimumStepSize_ ),
+                  static_cast< IndependentVariableStepType >( scalarTolerancesIntegratorSettings->maximumStepSize_ ),
+                  static_cast< typename StateType::Scalar >( scalarTolerancesIntegratorSettings->relativeErrorTolerance_ ),
+                  static_cast< typename StateType::Scalar >( scalarTolerancesIntegratorSettings->absoluteErrorTolerance_ ),
+                  static_cast< IndependentVariableStepType >( scalarTolerancesIntegratorSettings->safetyFactorForNextStepSize_ ),
+                  static_cast< IndependentVariableStepType >( scalarTolerancesIntegratorSettings->maximumFactorIncreaseForNextStepSize_ ),
+                  static_cast< IndependentVariableStepType >( scalarTolerancesIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ) );
+    }
+    else
+    {
+        // Settings with vector tolerances
+        std::shared_ptr< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType, StateType > >
+                vectorTolerancesIntegratorSettings = std::dynamic_pointer_cast<
+                RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType, StateType > >(
+                    variableStepIntegratorSettings );
+
+        // Check input consistency
+        if ( vectorTolerancesIntegratorSettings == nullptr )
+        {
+            throw std::runtime_error( "Error while creating Runge-Kutta variable step size integrator. Input class must be of "
+                                      "RungeKuttaVariableStepSizeSettingsVectorTolerances type." );
+        }
+
+        // Check that sizes of tolerances and initial state match
+        StateType relativeErrorTolerance = vectorTolerancesIntegratorSettings->relativeErrorTolerance_.template cast<
+                typename StateType::Scalar >( );
+        StateType absoluteErrorTolerance = vectorTolerancesIntegratorSettings->absoluteErrorTolerance_.template cast<
+                typename StateType::Scalar >( );
+        if ( ( relativeErrorTolerance.rows( ) != initialState.rows( ) ) ||
+             ( relativeErrorTolerance.cols( ) != initialState.cols( ) ) ||
+             ( absoluteErrorTolerance.rows( ) != initialState.rows( ) ) ||
+             ( absoluteErrorTolerance.cols( ) != initialState.cols( ) ) )
+        {
+            throw std::runtime_error( "Error while creating Runge-Kutta variable step size integrator. The sizes of the "
+                                      "relative and absolute tolerance vectors do not match the size of the initial state. "
+                                      "This could be the case if you are propagating more than just one state, e.g., translational "
+                                      "and/or rotational dynamics and mass, or more than one body." );
+        }
+
+        // Create Runge-Kutta integrator with vector tolerances
+        integrator = std::make_shared< RungeKuttaVariableStepSizeIntegrator
+                < IndependentVariableType, StateType, StateDerivativeType, IndependentVariableStepType > >
+                ( coefficients, stateDerivativeFunction, integratorSettings->initialTime_, initialState,
+                  static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->minimumStepSize_ ),
+                  static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->maximumStepSize_ ),
+                  relativeErrorTolerance, absoluteErrorTolerance,
+                  static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->safetyFactorForNextStepSize_ ),
+                  static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->maximumFactorIncreaseForNextStepSize_ ),
+                  static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ) );
+    }
+
+    // Set times across which integration steps may not be taken
+    if( variableStepIntegratorSettings->forcedStepBoundaries_.size( ) > 0 )
+    {
+        std::dynamic_pointer_cast< RungeKuttaVariableStepSizeIntegrator
+                < IndependentVariableType, StateType, StateDerivativeType, IndependentVariableStepType > >(
+                    integrator )->setForcedStepBoundaries( variableStepIntegratorSettings->forcedStepBoundaries_ );
+    }
+
+    return integrator;
+}
+
 //! Function to create a numerical integrator.
 /*!
  *  Function to create a numerical integrator from given integrator settings, state derivative function and initial state.
@@ -596,91 +792,9 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
     }
     case rungeKuttaVariableStepSize:
     {
-        // Cast integrator
-        std::shared_ptr< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType > >
-                variableStepIntegratorSettings = std::dynamic_pointer_cast< RungeKuttaVariableStepSizeBaseSettings<
-                IndependentVariableType > >( integratorSettings );
-
-        // Check input consistency
-        if ( variableStepIntegratorSettings == nullptr )
-        {
-            throw std::runtime_error( "Error, type of integrator settings (rungeKuttaVariableStepSize) not compatible with "
-                                      "selected integrator (derived class of IntegratorSettings must be "
-                                      "RungeKuttaVariableStepSizeBaseSettings for this type)." );
-        }
-
-        // Get requested RK coefficients
-        RungeKuttaCoefficients coefficients = RungeKuttaCoefficients::get( variableStepIntegratorSettings->coefficientSet_ );
-
-        // Check which constructor is being used
-        if ( variableStepIntegratorSettings->areTolerancesDefinedAsScalar_ )
-        {
-            // Settings with scalar tolerances
-            std::shared_ptr< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType > >
-                    scalarTolerancesIntegratorSettings = std::dynamic_pointer_cast<
-                    RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType > >( variableStepIntegratorSettings );
-
-            // Check input consistency
-            if ( scalarTolerancesIntegratorSettings == nullptr )
-            {
-                throw std::runtime_error( "Error while creating Runge-Kutta variable step size integrator. Input class must be of "
-                                          "RungeKuttaVariableStepSizeSettingsScalarTolerances type." );
-            }
-
-            // Create Runge-Kutta integrator with scalar tolerances
-            integrator = std::make_shared< RungeKuttaVariableStepSizeIntegrator
-                    < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
-                    ( coefficients, stateDerivativeFunction, integratorSettings->initialTime_, initialState,
-                      static_cast< IndependentVariableStepType >( scalarTolerancesIntegratorSettings->minimumStepSize_ ),
-                      static_cast< IndependentVariableStepType >( scalarTolerancesIntegratorSettings->maximumStepSize_ ),
-                      static_cast< typename DependentVariableType::Scalar >( scalarTolerancesIntegratorSettings->relativeErrorTolerance_ ),
-                      static_cast< typename DependentVariableType::Scalar >( scalarTolerancesIntegratorSettings->absoluteErrorTolerance_ ),
-                      static_cast< IndependentVariableStepType >( scalarTolerancesIntegratorSettings->safetyFactorForNextStepSize_ ),
-                      static_cast< IndependentVariableStepType >( scalarTolerancesIntegratorSettings->maximumFactorIncreaseForNextStepSize_ ),
-                      static_cast< IndependentVariableStepType >( scalarTolerancesIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ) );
-        }
-        else
-        {
-            // Settings with vector tolerances
-            std::shared_ptr< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType, DependentVariableType > >
-                    vectorTolerancesIntegratorSettings = std::dynamic_pointer_cast<
-                    RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType, DependentVariableType > >(
-                        variableStepIntegratorSettings );
-
-            // Check input consistency
-            if ( vectorTolerancesIntegratorSettings == nullptr )
-            {
-                throw std::runtime_error( "Error while creating Runge-Kutta variable step size integrator. Input class must be of "
-                                          "RungeKuttaVariableStepSizeSettingsVectorTolerances type." );
-            }
-
-            // Check that sizes of tolerances and initial state match
-            DependentVariableType relativeErrorTolerance = vectorTolerancesIntegratorSettings->relativeErrorTolerance_.template cast<
-                    typename DependentVariableType::Scalar >( );
-            DependentVariableType absoluteErrorTolerance = vectorTolerancesIntegratorSettings->absoluteErrorTolerance_.template cast<
-                    typename DependentVariableType::Scalar >( );
-            if ( ( relativeErrorTolerance.rows( ) != initialState.rows( ) ) ||
-                 ( relativeErrorTolerance.cols( ) != initialState.cols( ) ) ||
-                 ( absoluteErrorTolerance.rows( ) != initialState.rows( ) ) ||
-                 ( absoluteErrorTolerance.cols( ) != initialState.cols( ) ) )
-            {
-                throw std::runtime_error( "Error while creating Runge-Kutta variable step size integrator. The sizes of the "
-                                          "relative and absolute tolerance vectors do not match the size of the initial state. "
-                                          "This could be the case if you are propagating more than just one state, e.g., translational "
-                                          "and/or rotational dynamics and mass, or more than one body." );
-            }
-
-            // Create Runge-Kutta integrator with vector tolerances
-            integrator = std::make_shared< RungeKuttaVariableStepSizeIntegrator
-                    < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
-                    ( coefficients, stateDerivativeFunction, integratorSettings->initialTime_, initialState,
-                      static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->minimumStepSize_ ),
-                      static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->maximumStepSize_ ),
-                      relativeErrorTolerance, absoluteErrorTolerance,
-                      static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->safetyFactorForNextStepSize_ ),
-                      static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->maximumFactorIncreaseForNextStepSize_ ),
-                      static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ) );
-        }
+        integrator = createRungeKuttaVariableStepSizeIntegrator<
+                IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType >(
+                    stateDerivativeFunction, initialState, integratorSettings );
         break;
     }
     case bulirschStoer:
@@ -778,6 +892,63 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
     return integrator;
 }
 
+//! Function to create a numerical integrator with a state derivative type that differs from the state type.
+/*!
+ *  Function to create a numerical integrator with a state derivative type that differs from the state type, from given
+ *  integrator settings, state derivative function and initial state. This is typically used to integrate a state in
+ *  extended precision (e.g. Eigen::VectorXdd), using a state derivative in double precision, so that only the
+ *  accumulation of the state by the integrator is done in extended precision, while the (comparatively expensive) state
+ *  derivative function can be evaluated in double precision. Only Euler and Runge-Kutta integrators are supported.
+ *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+ *  \param initialState Initial state for numerical integration.
+ *  \param integratorSettings Settings for numerical integrator.
+ *  \return Numerical integrator object.
+ */
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType,
+          typename IndependentVariableStepType = IndependentVariableType >
+std::shared_ptr< numerical_integrators::NumericalIntegrator< IndependentVariableType, StateType,
+StateDerivativeType, IndependentVariableStepType > > createMixedPrecisionIntegrator(
+        std::function< StateDerivativeType(
+            const IndependentVariableType, const StateType& ) > stateDerivativeFunction,
+        const StateType initialState,
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > integratorSettings )
+{
+    // Declare eventual output
+    std::shared_ptr< NumericalIntegrator
+            < IndependentVariableType, StateType, StateDerivativeType, IndependentVariableStepType > > integrator;
+
+    // Retrieve requested type of integrator
+    switch( integratorSettings->integratorType_ )
+    {
+    case euler:
+    {
+        integrator = std::make_shared< EulerIntegrator
+                < IndependentVariableType, StateType, StateDerivativeType, IndependentVariableStepType > >
+                ( stateDerivativeFunction, integratorSettings->initialTime_, initialState ) ;
+        break;
+    }
+    case rungeKutta4:
+    {
+        integrator = std::make_shared< RungeKutta4Integrator
+                < IndependentVariableType, StateType, StateDerivativeType, IndependentVariableStepType > >
+                ( stateDerivativeFunction, integratorSettings->initialTime_, initialState ) ;
+        break;
+    }
+    case rungeKuttaVariableStepSize:
+    {
+        integrator = createRungeKuttaVariableStepSizeIntegrator<
+                IndependentVariableType, StateType, StateDerivativeType, IndependentVariableStepType >(
+                    stateDerivativeFunction, initialState, integratorSettings );
+        break;
+    }
+    default:
+        throw std::runtime_error( "Error, integrator " +  std::to_string( integratorSettings->integratorType_ ) +
+                                  " not supported when using different state and state derivative types." );
+    }
+
+    return integrator;
+}
+
 
 extern template std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::VectorXd,
 Eigen::VectorXd, double > > createIntegrator< double, Eigen::VectorXd, double >(
@@ -795,11 +966,21 @@ Eigen::VectorXd, long double > > createIntegrator< Time, Eigen::VectorXd, long d
         std::function< Eigen::VectorXd( const Time, const Eigen::VectorXd& ) > stateDerivativeFunction,
         const Eigen::VectorXd initialState, std::shared_ptr< IntegratorSettings< Time > > integratorSettings );
 
+extern template std::shared_ptr< numerical_integrators::NumericalIntegrator< DoubleDoubleTime, Eigen::VectorXd,
+Eigen::VectorXd, double > > createIntegrator< DoubleDoubleTime, Eigen::VectorXd, double >(
+        std::function< Eigen::VectorXd( const DoubleDoubleTime, const Eigen::VectorXd& ) > stateDerivativeFunction,
+        const Eigen::VectorXd initialState, std::shared_ptr< IntegratorSettings< DoubleDoubleTime > > integratorSettings );
+
 extern template std::shared_ptr< numerical_integrators::NumericalIntegrator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 1 >,
 Eigen::Matrix< long double, Eigen::Dynamic, 1 >, long double > > createIntegrator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 1 >, long double >(
         std::function< Eigen::Matrix< long double, Eigen::Dynamic, 1 >(
             const Time, const Eigen::Matrix< long double, Eigen::Dynamic, 1 >& ) > stateDerivativeFunction,
         const Eigen::Matrix< long double, Eigen::Dynamic, 1 > initialState, std::shared_ptr< IntegratorSettings< Time > > integratorSettings );
+
+extern template std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::VectorXdd,
+Eigen::VectorXd, double > > createMixedPrecisionIntegrator< double, Eigen::VectorXdd, Eigen::VectorXd, double >(
+        std::function< Eigen::VectorXd( const double, const Eigen::VectorXdd& ) > stateDerivativeFunction,
+        const Eigen::VectorXdd initialState, std::shared_ptr< IntegratorSettings< double > > integratorSettings );
 } // namespace numerical_integrators
 
 } // namespace tudat
@@ -83,6 +83,13 @@ public:
      */
     virtual TimeStepType getNextStepSize( ) const { return stepSize_; }
 
+    //! Set step size of the next step.
+    /*!
+     * Sets the step size of the next step.
+     * \param nextStepSize Step size to be used for the next step.
+     */
+    virtual void setNextStepSize( const TimeStepType nextStepSize ) { stepSize_ = nextStepSize; }
+
     //! Get current state.
     /*!
      * Returns the current state of the Euler integrator.
@@ -78,6 +78,20 @@ public:
      */
     virtual TimeStepType getNextStepSize( ) const = 0;
 
+    //! Set step size of the next step.
+    /*!
+     * Sets the step size of the next step, as returned by getNextStepSize( ) (for instance to continue with the step
+     * size that was planned before the integrator was moved to an intermediate time). Derived classes should override
+     * this function.
+     * \param nextStepSize Step size to be used for the next step.
+     */
+    virtual void setNextStepSize( const TimeStepType nextStepSize )
+    {
+        TUDAT_UNUSED_PARAMETER( nextStepSize );
+        throw std::runtime_error(
+                    "Error in numerical integrator. The function to set the next step size has not been implemented" );
+    }
+
     //! Get current state.
     /*!
      * Returns the current state of the integrator. Derived classes should override this and
@@ -168,6 +182,20 @@ public:
         return stateDerivativeFunction_;
     }
 
+    //! Function to retrieve the state derivative at the current independent variable and state.
+    /*!
+     * Function to retrieve the state derivative at the current independent variable and state. Derived classes that
+     * evaluate the state derivative at the start of each step may override this function to store the result, so that
+     * it is not recomputed by the next call to performIntegrationStep.
+     * Note that, in that case, the state derivative function is evaluated fewer times than before, which changes the
+     * number of evaluations of any side effects of that function (e.g. environment updates).
+     * \return State derivative at the current independent variable and state.
+     */
+    virtual StateDerivativeType getCurrentStateDerivative( )
+    {
+        return stateDerivativeFunction_( getCurrentIndependentVariable( ), getCurrentState( ) );
+    }
+
     //! Function to return the termination condition was reached during the current step
     /*!
      *  Function to return the termination condition was reached during the current step
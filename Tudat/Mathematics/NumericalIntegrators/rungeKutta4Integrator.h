@@ -71,7 +71,8 @@ public:
         : ReinitializableNumericalIntegratorBase( stateDerivativeFunction ),
           currentIndependentVariable_( intervalStart ),
           currentState_( initialState ),
-          lastIndependentVariable_( intervalStart )
+          lastIndependentVariable_( intervalStart ),
+          isCurrentStateDerivativeSet_( false )
     { }
 
     //! Get step size of the next step.
@@ -81,6 +82,13 @@ public:
      */
     virtual TimeStepType getNextStepSize( ) const { return stepSize_; }
 
+    //! Set step size of the next step.
+    /*!
+     * Sets the step size of the next step.
+     * \param nextStepSize Step size to be used for the next step.
+     */
+    virtual void setNextStepSize( const TimeStepType nextStepSize ) { stepSize_ = nextStepSize; }
+
     //! Get current state.
     /*!
      * Returns the current state of the integrator.
@@ -98,6 +106,24 @@ public:
         return currentIndependentVariable_;
     }
 
+    //! Function to retrieve the state derivative at the current independent variable and state.
+    /*!
+     * Function to retrieve the state derivative at the current independent variable and state. The result is stored,
+     * and used to compute k1 in the next integration step.
+     * The state derivative function is therefore not evaluated again at the start of the next step, so that its side
+     * effects (e.g. environment updates) are not repeated for the current state.
+     * \return State derivative at the current independent variable and state.
+     */
+    virtual StateDerivativeType getCurrentStateDerivative( )
+    {
+        if( !isCurrentStateDerivativeSet_ )
+        {
+            currentStateDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+            isCurrentStateDerivativeSet_ = true;
+        }
+        return currentStateDerivative_;
+    }
+
     //! Perform a single integration step.
     /*!
      * Perform a single integration step.
@@ -120,7 +146,7 @@ public:
             case 1:
                 time = currentIndependentVariable_;
                 state = currentState_;
-                k1 = stepSize * this->stateDerivativeFunction_( time, state );
+                k1 = stepSize * getCurrentStateDerivative( );
                 break;
             case 2:
                 time = currentIndependentVariable_ + stepSize / 2.0;
@@ -152,6 +178,7 @@ public:
         stepSize_ = stepSize;
         currentIndependentVariable_ += stepSize_;
         currentState_ += ( k1 + 2.0 * k2 + 2.0 * k3 + k4 ) / 6.0;
+        isCurrentStateDerivativeSet_ = false;
 
         // Return the integration result.
         return currentState_;
@@ -174,6 +201,7 @@ public:
 
         currentIndependentVariable_ = lastIndependentVariable_;
         currentState_ = lastState_;
+        isCurrentStateDerivativeSet_ = false;
         return true;
     }
 
@@ -210,6 +238,7 @@ public:
     void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
     {
         currentState_ = newState;
+        isCurrentStateDerivativeSet_ = false;
         if ( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
@@ -228,6 +257,7 @@ public:
     {
         currentState_ = newState;
         currentIndependentVariable_ = newTime;
+        isCurrentStateDerivativeSet_ = false;
         if ( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
@@ -266,6 +296,12 @@ protected:
      */
     StateType lastState_;
 
+    //! State derivative at the current independent variable and state (only valid if isCurrentStateDerivativeSet_).
+    StateDerivativeType currentStateDerivative_;
+
+    //! Boolean denoting whether currentStateDerivative_ has been computed for current independent variable and state.
+    bool isCurrentStateDerivativeSet_;
+
 };
 
 extern template class RungeKutta4Integrator < double, Eigen::VectorXd, Eigen::VectorXd >;
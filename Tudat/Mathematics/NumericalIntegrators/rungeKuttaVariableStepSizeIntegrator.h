@@ -16,6 +16,7 @@
 #ifndef TUDAT_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
 #define TUDAT_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
 
+#include <algorithm>
 #include <boost/bind.hpp>
 #include <functional>
 #include <memory>
@@ -135,7 +136,8 @@ public:
         safetyFactorForNextStepSize_( std::fabs( static_cast< double >( safetyFactorForNextStepSize ) ) ),
         maximumFactorIncreaseForNextStepSize_( std::fabs( static_cast< double >( maximumFactorIncreaseForNextStepSize ) ) ),
         minimumFactorDecreaseForNextStepSize_( std::fabs( static_cast< double >( minimumFactorDecreaseForNextStepSize ) ) ),
-        newStepSizeFunction_( newStepSizeFunction ), useStepSizeControl_( true )
+        newStepSizeFunction_( newStepSizeFunction ), useStepSizeControl_( true ), numberOfRejectedSteps_( 0 ),
+        isCurrentStateDerivativeSet_( false )
     {
         // Set default newStepSizeFunction_ to the class method.
         if ( this->newStepSizeFunction_ == 0 )
@@ -192,13 +194,14 @@ public:
         minimumStepSize_( std::fabs( static_cast< double >( minimumStepSize ) ) ),
         maximumStepSize_( std::fabs( static_cast< double >( maximumStepSize ) ) ),
         relativeErrorTolerance_( StateType::Constant( initialState.rows( ), initialState.cols( ),
-                                                      std::fabs( relativeErrorTolerance ) ) ),
+                                                      relativeErrorTolerance ).array( ).abs( ) ),
         absoluteErrorTolerance_( StateType::Constant( initialState.rows( ), initialState.cols( ),
-                                                      std::fabs( absoluteErrorTolerance ) ) ),
+                                                      absoluteErrorTolerance ).array( ).abs( ) ),
         safetyFactorForNextStepSize_( std::fabs( static_cast< double >( safetyFactorForNextStepSize ) ) ),
         maximumFactorIncreaseForNextStepSize_( std::fabs( static_cast< double >( maximumFactorIncreaseForNextStepSize ) ) ),
         minimumFactorDecreaseForNextStepSize_( std::fabs( static_cast< double >( minimumFactorDecreaseForNextStepSize ) ) ),
-        newStepSizeFunction_( newStepSizeFunction ), useStepSizeControl_( true )
+        newStepSizeFunction_( newStepSizeFunction ), useStepSizeControl_( true ), numberOfRejectedSteps_( 0 ),
+        isCurrentStateDerivativeSet_( false )
     {
         // Set default newStepSizeFunction_ to the class method.
         if ( newStepSizeFunction_ == 0 )
@@ -217,6 +220,13 @@ public:
      */
     virtual TimeStepType getNextStepSize( ) const { return this->stepSize_; }
 
+    //! Set step size of the next step.
+    /*!
+     * Sets the step size of the next step.
+     * \param nextStepSize Step size to be used for the next step.
+     */
+    virtual void setNextStepSize( const TimeStepType nextStepSize ) { this->stepSize_ = nextStepSize; }
+
     //! Get current state.
     /*!
      * Returns the current state of the integrator.
@@ -245,14 +255,33 @@ public:
         return currentStateDerivatives_;
     }
 
+    //! Function to retrieve the state derivative at the current independent variable and state.
+    /*!
+     * Function to retrieve the state derivative at the current independent variable and state. The result is stored,
+     * and used as the first stage of the next integration step (also when that step is rejected and retried).
+     * The state derivative function is therefore not evaluated again at the start of the next step, so that its side
+     * effects (e.g. environment updates) are not repeated for the current state.
+     * \return State derivative at the current independent variable and state.
+     */
+    virtual StateDerivativeType getCurrentStateDerivative( )
+    {
+        if( !isCurrentStateDerivativeSet_ )
+        {
+            currentStateDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+            isCurrentStateDerivativeSet_ = true;
+        }
+        return currentStateDerivative_;
+    }
+
     //! Perform a single integration step.
     /*!
      * Perform a single integration step and compute a new step size.
-     * \param stepSize The step size to take. If the time step is too large to satisfy the error
-     *          constraints, the step is redone until the error constraint is satisfied.
+     * \param requestedStepSize The step size to take. If the time step is too large to satisfy the error
+     *          constraints, the step is redone until the error constraint is satisfied. If the step would cross
+     *          one of the forcedStepBoundaries_, it is truncated to end at the boundary.
      * \return The state at the end of the interval.
      */
-    virtual StateType performIntegrationStep( const TimeStepType stepSize );
+    virtual StateType performIntegrationStep( const TimeStepType requestedStepSize );
 
     //! Rollback internal state to the last state.
     /*!
@@ -271,6 +300,7 @@ public:
 
         this->currentIndependentVariable_ = this->lastIndependentVariable_;
         this->currentState_ = this->lastState_;
+        isCurrentStateDerivativeSet_ = false;
         return true;
     }
 
@@ -307,6 +337,7 @@ public:
     void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
     {
         currentState_ = newState;
+        isCurrentStateDerivativeSet_ = false;
         if ( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
@@ -325,6 +356,7 @@ public:
     {
         currentState_ = newState;
         currentIndependentVariable_ = newTime;
+        isCurrentStateDerivativeSet_ = false;
         if ( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
@@ -341,6 +373,48 @@ public:
         useStepSizeControl_ = useStepSizeControl;
     }
 
+    //! Function to set the values of the independent variable across which no integration step may be taken.
+    /*!
+     * Function to set the values of the independent variable across which no integration step may be taken (for
+     * instance the times of eclipse entry and exit, at which the state derivative is not smooth). A step that would
+     * cross such a boundary is truncated to end exactly at the boundary, after which the integration continues with
+     * the step size that was requested before the truncation. This prevents repeated step rejections when stepping
+     * across discontinuities in the (derivatives of the) state derivative.
+     * \param forcedStepBoundaries Values of independent variable at which integration steps are to end.
+     */
+    void setForcedStepBoundaries( const std::vector< double >& forcedStepBoundaries )
+    {
+        forcedStepBoundaries_ = forcedStepBoundaries;
+        std::sort( forcedStepBoundaries_.begin( ), forcedStepBoundaries_.end( ) );
+    }
+
+    //! Function to retrieve the values of the independent variable across which no integration step may be taken.
+    /*!
+     * Function to retrieve the values of the independent variable across which no integration step may be taken.
+     * \return Values of independent variable at which integration steps are to end (sorted in ascending order).
+     */
+    std::vector< double > getForcedStepBoundaries( )
+    {
+        return forcedStepBoundaries_;
+    }
+
+    //! Function to retrieve the number of steps that have been rejected by the step size control.
+    /*!
+     * Function to retrieve the number of steps that have been rejected by the step size control, since creation of
+     * the integrator or the last call to resetNumberOfRejectedSteps.
+     * \return Number of rejected steps.
+     */
+    int getNumberOfRejectedSteps( ) const
+    {
+        return numberOfRejectedSteps_;
+    }
+
+    //! Function to reset the number of steps that have been rejected by the step size control to zero.
+    void resetNumberOfRejectedSteps( )
+    {
+        numberOfRejectedSteps_ = 0;
+    }
+
 protected:
 
     //! Computes the next step size and validates the result.
@@ -483,6 +557,18 @@ protected:
     //! Boolean denoting whether step size control is to be used
     bool useStepSizeControl_;
 
+    //! Values of independent variable at which integration steps are to end (sorted in ascending order).
+    std::vector< double > forcedStepBoundaries_;
+
+    //! Number of steps that have been rejected by the step size control.
+    int numberOfRejectedSteps_;
+
+    //! State derivative at the current independent variable and state (only valid if isCurrentStateDerivativeSet_).
+    StateDerivativeType currentStateDerivative_;
+
+    //! Boolean denoting whether currentStateDerivative_ has been computed for current independent variable and state.
+    bool isCurrentStateDerivativeSet_;
+
 };
 
 extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
@@ -494,8 +580,43 @@ extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::Matr
 template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
 StateType
 RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
-::performIntegrationStep( const TimeStepType stepSize )
+::performIntegrationStep( const TimeStepType requestedStepSize )
 {
+    // Truncate step if it would cross a forced step boundary.
+    TimeStepType stepSize = requestedStepSize;
+    bool isStepTruncated = false;
+    double forcedStepBoundary = TUDAT_NAN;
+    if( !forcedStepBoundaries_.empty( ) )
+    {
+        const double currentIndependentVariable = static_cast< double >( this->currentIndependentVariable_ );
+        const double stepEnd = currentIndependentVariable + static_cast< double >( requestedStepSize );
+        if( requestedStepSize > 0.0 )
+        {
+            std::vector< double >::const_iterator boundaryIterator = std::upper_bound(
+                        forcedStepBoundaries_.begin( ), forcedStepBoundaries_.end( ), currentIndependentVariable );
+            if( boundaryIterator != forcedStepBoundaries_.end( ) && *boundaryIterator < stepEnd )
+            {
+                forcedStepBoundary = *boundaryIterator;
+                isStepTruncated = true;
+            }
+        }
+        else
+        {
+            std::vector< double >::const_iterator boundaryIterator = std::lower_bound(
+                        forcedStepBoundaries_.begin( ), forcedStepBoundaries_.end( ), currentIndependentVariable );
+            if( boundaryIterator != forcedStepBoundaries_.begin( ) && *( boundaryIterator - 1 ) > stepEnd )
+            {
+                forcedStepBoundary = *( boundaryIterator - 1 );
+                isStepTruncated = true;
+            }
+        }
+
+        if( isStepTruncated )
+        {
+            stepSize = static_cast< TimeStepType >( forcedStepBoundary - currentIndependentVariable );
+        }
+    }
+
     // Define and allocated vector for the number of stages.
     currentStateDerivatives_.clear( );
     currentStateDerivatives_.reserve( this->coefficients_.cCoefficients.rows( ) );
@@ -516,10 +637,17 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
                     currentStateDerivatives_[ column ];
         }
 
-        // Compute the state derivative.
+        // Compute the state derivative (first stage is evaluated at the current state, and may be available already).
         const IndependentVariableType time = this->currentIndependentVariable_ +
                 this->coefficients_.cCoefficients( stage ) * stepSize;
-        currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
+        if( stage == 0 && this->coefficients_.cCoefficients( stage ) == 0.0 )
+        {
+            currentStateDerivatives_.push_back( getCurrentStateDerivative( ) );
+        }
+        else
+        {
+            currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
+        }
 
         // Check if propagation should terminate because the propagation termination condition has been reached
         // while computing the intermediate state.
@@ -544,7 +672,25 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
         // Accept the current step.
         this->lastIndependentVariable_ = this->currentIndependentVariable_;
         this->lastState_ = this->currentState_;
-        this->currentIndependentVariable_ += stepSize;
+        isCurrentStateDerivativeSet_ = false;
+        if( isStepTruncated )
+        {
+            // Set independent variable to boundary exactly. If the step size control did not reduce the step size
+            // w.r.t. the truncated step, continue with (at most) the originally requested step size, since the current
+            // step was shortened due to the boundary, not due to the step size control. Otherwise, the reduced step
+            // size computed by the step size control is used.
+            this->currentIndependentVariable_ = static_cast< IndependentVariableType >( forcedStepBoundary );
+            const double nextStepSizeMagnitude = std::fabs( static_cast< double >( this->stepSize_ ) );
+            if( nextStepSizeMagnitude >= std::fabs( static_cast< double >( stepSize ) ) &&
+                    nextStepSizeMagnitude < std::fabs( static_cast< double >( requestedStepSize ) ) )
+            {
+                this->stepSize_ = requestedStepSize;
+            }
+        }
+        else
+        {
+            this->currentIndependentVariable_ += stepSize;
+        }
 
         switch ( this->coefficients_.orderEstimateToIntegrate )
         {
@@ -563,6 +709,7 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
     else
     {
         // Reject current step.
+        numberOfRejectedSteps_++;
         return performIntegrationStep( this->stepSize_ );
     }
 }
@@ -673,9 +820,10 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
             = relativeTruncationError_.array( ).abs( ).maxCoeff( );
 
     // Compute the new step size. This is based off of the equation given in
-    // (Montenbruck and Gill, 2005).
+    // (Montenbruck and Gill, 2005). The error is converted to the time step type, so that state scalar types without
+    // std::pow overload (e.g. DoubleDouble) can be used.
     const TimeStepType newStepSize = safetyFactorForNextStepSize * stepSize
-            * std::pow( 1.0 / maximumErrorInState_, 1.0 / orders.second );
+            * std::pow( 1.0 / static_cast< TimeStepType >( maximumErrorInState_ ), 1.0 / orders.second );
 
     // Check if the current state can be accepted.
     const bool isIntegrationStepAccepted = maximumErrorInState_ <= 1.0;
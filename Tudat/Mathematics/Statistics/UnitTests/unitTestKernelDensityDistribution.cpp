@@ -590,6 +590,86 @@ BOOST_AUTO_TEST_CASE( testProbabilityFunctionsUncorrelated2D )
     }
 }
 
+//! Test tree-based evaluation of Epanechnikov kernel density, by comparison with direct evaluation.
+BOOST_AUTO_TEST_CASE( testTreeBasedKernelEvaluation )
+{
+    using namespace tudat::statistics;
+
+    // Generate samples
+    Eigen::VectorXd lowerBound( 3 ), upperBound( 3 );
+    lowerBound << -2.0, 0.0, 10.0;
+    upperBound << 3.0, 0.01, 40.0;
+    std::vector< Eigen::VectorXd > samples = generateRandomVectorUniform( 42, 5000, lowerBound, upperBound );
+
+    // Create distributions with direct and tree-based evaluation
+    KernelDensityDistribution directDistribution( samples, 1.0, KernelType::epanechnikov_kernel );
+    KernelDensityDistribution treeDistribution(
+                samples, 1.0, KernelType::epanechnikov_kernel, Eigen::VectorXd::Zero( 0 ), Eigen::VectorXd::Zero( 0 ),
+                tree_kernel_evaluation );
+    BOOST_CHECK_EQUAL( treeDistribution.getEvaluationMethod( ), tree_kernel_evaluation );
+
+    // Generate evaluation points, partly outside of the sample domain
+    std::vector< Eigen::VectorXd > points = generateRandomVectorUniform(
+                1, 200, 1.1 * lowerBound - 0.1 * upperBound, 1.1 * upperBound - 0.1 * lowerBound );
+    Eigen::MatrixXd pointMatrix( 3, points.size( ) );
+    for( unsigned int i = 0; i < points.size( ); i++ )
+    {
+        pointMatrix.col( i ) = points[ i ];
+    }
+
+    std::vector< int > marginalDimensions = { 2, 0 };
+    Eigen::MatrixXd marginalPointMatrix( 2, points.size( ) );
+    marginalPointMatrix.row( 0 ) = pointMatrix.row( 2 );
+    marginalPointMatrix.row( 1 ) = pointMatrix.row( 0 );
+
+    const double tolerance = 1.0E-12;
+    for( unsigned int i = 0; i < points.size( ); i++ )
+    {
+        // Check pdf
+        double expectedDensity = directDistribution.evaluatePdf( points[ i ] );
+        BOOST_CHECK_SMALL( treeDistribution.evaluatePdf( points[ i ] ) - expectedDensity,
+                           tolerance * std::max( expectedDensity, 1.0 ) );
+
+        // Check joint marginal pdf
+        expectedDensity = directDistribution.evaluateMarginalProbabilityDensity(
+                    marginalDimensions, marginalPointMatrix.col( i ) );
+        BOOST_CHECK_SMALL( treeDistribution.evaluateMarginalProbabilityDensity(
+                               marginalDimensions, marginalPointMatrix.col( i ) ) - expectedDensity,
+                           tolerance * std::max( expectedDensity, 1.0 ) );
+
+        // Check single-dimension marginal pdf and cdf
+        for( int j = 0; j < 3; j++ )
+        {
+            expectedDensity = directDistribution.evaluateMarginalProbabilityDensity( j, points[ i ]( j ) );
+            BOOST_CHECK_SMALL( treeDistribution.evaluateMarginalProbabilityDensity( j, points[ i ]( j ) ) - expectedDensity,
+                               tolerance * std::max( expectedDensity, 1.0 ) );
+
+            BOOST_CHECK_SMALL( treeDistribution.evaluateCumulativeMarginalProbability( j, points[ i ]( j ) ) -
+                               directDistribution.evaluateCumulativeMarginalProbability( j, points[ i ]( j ) ), tolerance );
+        }
+    }
+
+    // Check that batch evaluation gives identical results, regardless of the number of threads
+    Eigen::VectorXd serialDensities = treeDistribution.evaluatePdfs( pointMatrix );
+    Eigen::VectorXd parallelDensities = treeDistribution.evaluatePdfs( pointMatrix, 4 );
+    Eigen::VectorXd directParallelDensities = directDistribution.evaluatePdfs( pointMatrix, 4 );
+    Eigen::VectorXd parallelMarginalDensities = treeDistribution.evaluateMarginalProbabilityDensities(
+                marginalDimensions, marginalPointMatrix, 4 );
+    for( unsigned int i = 0; i < points.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( serialDensities( i ), treeDistribution.evaluatePdf( points[ i ] ) );
+        BOOST_CHECK_EQUAL( parallelDensities( i ), serialDensities( i ) );
+        BOOST_CHECK_EQUAL( directParallelDensities( i ), directDistribution.evaluatePdf( points[ i ] ) );
+        BOOST_CHECK_EQUAL( parallelMarginalDensities( i ), treeDistribution.evaluateMarginalProbabilityDensity(
+                               marginalDimensions, marginalPointMatrix.col( i ) ) );
+    }
+
+    // Check that inconsistent input is rejected
+    BOOST_CHECK_THROW( treeDistribution.evaluatePdfs( marginalPointMatrix ), std::runtime_error );
+    BOOST_CHECK_THROW( KernelDensityDistribution(
+                           samples, 1.0, KernelType::gaussian_kernel, Eigen::VectorXd::Zero( 0 ),
+                           Eigen::VectorXd::Zero( 0 ), tree_kernel_evaluation ), std::runtime_error );
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -21,6 +21,7 @@
 #include "Tudat/Basics/testMacros.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 #include "Tudat/Mathematics/Statistics/randomSampling.h"
+#include "Tudat/Mathematics/Statistics/randomSampleGenerator.h"
 #include "Tudat/Mathematics/Statistics/basicStatistics.h"
 
 namespace tudat
@@ -126,6 +127,123 @@ BOOST_AUTO_TEST_CASE( test_randomVectorGaussian )
 }
 
 
+//! Test generation of random samples into matrices, in parallel and in chunks.
+BOOST_AUTO_TEST_CASE( test_randomSampleMatrix )
+{
+    using namespace tudat::statistics;
+
+    int numberOfSamples = 1E6;
+    int seed = 511;
+
+    Eigen::VectorXd mean( 3 );
+    Eigen::VectorXd standardDeviation( 3 );
+    mean << 0.0, 1.0, -2.0;
+    standardDeviation << 1.0, 3.0, 4.0;
+
+    // Check sample statistics
+    Eigen::MatrixXd samples = generateGaussianRandomSampleMatrix( seed, numberOfSamples, mean, standardDeviation, 4 );
+    BOOST_CHECK_EQUAL( samples.rows( ), 3 );
+    BOOST_CHECK_EQUAL( samples.cols( ), numberOfSamples );
+
+    Eigen::VectorXd sampleMean = samples.rowwise( ).mean( );
+    Eigen::VectorXd sampleStandardDeviations =
+            ( ( samples.colwise( ) - sampleMean ).rowwise( ).squaredNorm( ) / ( numberOfSamples - 1.0 ) ).cwiseSqrt( );
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( mean( i ) - sampleMean( i ) ), 5.0E-3 * standardDeviation( i ) );
+        BOOST_CHECK_SMALL( std::fabs( standardDeviation( i ) - sampleStandardDeviations( i ) ), 5.0E-3 * standardDeviation( i ) );
+    }
+
+    // Check that samples do not depend on number of threads
+    Eigen::MatrixXd serialSamples = generateGaussianRandomSampleMatrix( seed, numberOfSamples, mean, standardDeviation );
+    BOOST_CHECK( serialSamples == samples );
+
+    // Check that samples do not depend on starting index or chunk size
+    RandomSampleGenerator sampleGenerator( mean - standardDeviation, mean + standardDeviation, pseudo_random_sequence,
+                                           seed, 1000 );
+    Eigen::MatrixXd uniformSamples = sampleGenerator.generateSamples( 10000 );
+    BOOST_CHECK( ( uniformSamples.colwise( ) - ( mean - standardDeviation ) ).minCoeff( ) > 0.0 );
+    BOOST_CHECK( ( uniformSamples.colwise( ) - ( mean + standardDeviation ) ).maxCoeff( ) < 0.0 );
+
+    Eigen::MatrixXd partialSamples( 3, 2345 );
+    sampleGenerator.generateSamples( 1234, partialSamples, 3 );
+    BOOST_CHECK( partialSamples == uniformSamples.middleCols( 1234, 2345 ) );
+
+    int numberOfChunks = 0;
+    sampleGenerator.streamSamples(
+                10000, 3333, [ & ]( const Eigen::MatrixXd& chunk, const std::uint64_t firstSampleIndex )
+    {
+        BOOST_CHECK( chunk == uniformSamples.middleCols( firstSampleIndex, chunk.cols( ) ) );
+        numberOfChunks++;
+    }, 2 );
+    BOOST_CHECK_EQUAL( numberOfChunks, 4 );
+
+    // Check that different seeds give different samples
+    BOOST_CHECK( generateUniformRandomSampleMatrix( seed + 1, 10, mean, mean + standardDeviation ) !=
+                 generateUniformRandomSampleMatrix( seed, 10, mean, mean + standardDeviation ) );
+}
+
+//! Test Sobol sequence generation (without GSL).
+BOOST_AUTO_TEST_CASE( test_SobolSequence )
+{
+    using namespace tudat::statistics;
+
+    const int numberOfDimensions = SobolSequence::getMaximumNumberOfDimensions( );
+    BOOST_CHECK( numberOfDimensions >= 20 );
+
+    // Check first points (origin, and then 1/2 and 3/4, 1/4 in all dimensions)
+    SobolSequence sobolSequence( numberOfDimensions );
+    Eigen::MatrixXd points( numberOfDimensions, 1024 );
+    sobolSequence.computePoints( 0, points );
+    BOOST_CHECK_EQUAL( points.col( 0 ).norm( ), 0.0 );
+    BOOST_CHECK( points.col( 1 ) == Eigen::VectorXd::Constant( numberOfDimensions, 0.5 ) );
+    BOOST_CHECK_EQUAL( points( 0, 2 ), 0.75 );
+    BOOST_CHECK_EQUAL( points( 1, 2 ), 0.25 );
+    BOOST_CHECK_EQUAL( points( 0, 3 ), 0.25 );
+    BOOST_CHECK_EQUAL( points( 1, 3 ), 0.75 );
+
+    // Check that the first 2^m points are stratified in each dimension, and in the first two dimensions jointly
+    for( int d = 0; d < numberOfDimensions; d++ )
+    {
+        std::vector< int > numberOfPointsPerInterval( 1024, 0 );
+        for( int i = 0; i < 1024; i++ )
+        {
+            numberOfPointsPerInterval[ static_cast< int >( points( d, i ) * 1024.0 ) ]++;
+        }
+        BOOST_CHECK( *std::min_element( numberOfPointsPerInterval.begin( ), numberOfPointsPerInterval.end( ) ) == 1 );
+        BOOST_CHECK( *std::max_element( numberOfPointsPerInterval.begin( ), numberOfPointsPerInterval.end( ) ) == 1 );
+    }
+    std::vector< int > numberOfPointsPerCell( 1024, 0 );
+    for( int i = 0; i < 1024; i++ )
+    {
+        numberOfPointsPerCell[ static_cast< int >( points( 0, i ) * 32.0 ) * 32 +
+                static_cast< int >( points( 1, i ) * 32.0 ) ]++;
+    }
+    BOOST_CHECK( *std::max_element( numberOfPointsPerCell.begin( ), numberOfPointsPerCell.end( ) ) == 1 );
+
+    // Check that points computed from arbitrary index are consistent with sequential computation
+    Eigen::MatrixXd partialPoints( numberOfDimensions, 100 );
+    sobolSequence.computePoints( 777, partialPoints );
+    BOOST_CHECK( partialPoints == points.middleCols( 777, 100 ) );
+
+    // Check sample generation
+    int numberOfSamples = 1E6;
+    Eigen::VectorXd lower( 3 );
+    Eigen::VectorXd upper( 3 );
+    lower << 0.0, 1.0, -2.0;
+    upper << 1.0, 3.0, 4.0;
+    Eigen::MatrixXd sobolSamples = generateSobolSampleMatrix( numberOfSamples, lower, upper, 4 );
+    Eigen::VectorXd sampleMean = sobolSamples.rowwise( ).mean( );
+    Eigen::VectorXd average = ( upper + lower ) / 2.0;
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( average( i ) - sampleMean( i ) ), 2.0E-6 * ( upper( i ) - lower( i ) ) );
+    }
+    BOOST_CHECK( sobolSamples == generateSobolSampleMatrix( numberOfSamples, lower, upper ) );
+
+    BOOST_CHECK_THROW( SobolSequence( numberOfDimensions + 1 ), std::runtime_error );
+}
+
 #if USE_GSL
 
 //! Test if Sobol sampler interface is working correctly. Note that this test is somewhat minimal, but the core of the
@@ -8,6 +8,10 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+#include <numeric>
+
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Mathematics/Statistics/kernelDensityDistribution.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 #include "Tudat/Mathematics/Statistics/basicStatistics.h"
@@ -18,12 +22,12 @@ namespace tudat
 namespace statistics
 {
 
-//! Get probability density
-double EpanechnikovKernelDistribution::evaluatePdf( const double& independentVariable )
+//! Function to evaluate the probability density of a single Epanechnikov kernel.
+double evaluateEpanechnikovKernelPdf( const double distanceFromMean, const double bandWidth )
 {
-    if( ( independentVariable - mean_ ) >= ( -bandWidth_ ) && ( independentVariable - mean_ ) <= ( bandWidth_ ) )
+    if( distanceFromMean >= ( -bandWidth ) && distanceFromMean <= ( bandWidth ) )
     {
-        return ( 3.0 / ( 4.0 * bandWidth_ ) ) * ( 1.0 - std::pow( ( independentVariable - mean_ ) / bandWidth_, 2.0 ) );
+        return ( 3.0 / ( 4.0 * bandWidth ) ) * ( 1.0 - std::pow( distanceFromMean / bandWidth, 2.0 ) );
     }
     else
     {
@@ -31,16 +35,15 @@ double EpanechnikovKernelDistribution::evaluatePdf( const double& independentVar
     }
 }
 
-//! Get probability mass
-double EpanechnikovKernelDistribution::evaluateCdf( const double& independentVariable )
+//! Function to evaluate the cumulative probability of a single Epanechnikov kernel.
+double evaluateEpanechnikovKernelCdf( const double distanceFromMean, const double bandWidth )
 {
-    if( ( independentVariable - mean_ ) >= ( -bandWidth_ ) && ( independentVariable - mean_ ) <= ( bandWidth_ ) )
+    if( distanceFromMean >= ( -bandWidth ) && distanceFromMean <= ( bandWidth ) )
     {
-        return ( 3.0 / ( 4.0 * bandWidth_ ) ) *
-                ( ( independentVariable - mean_ ) - ( std::pow( ( independentVariable - mean_ ), 3.0 )
-                                                      / ( 3.0 * std::pow( bandWidth_, 2.0 ) ) ) ) + 0.5;
+        return ( 3.0 / ( 4.0 * bandWidth ) ) *
+                ( distanceFromMean - ( std::pow( distanceFromMean, 3.0 ) / ( 3.0 * std::pow( bandWidth, 2.0 ) ) ) ) + 0.5;
     }
-    else if( ( independentVariable - mean_ ) < ( -bandWidth_ ) )
+    else if( distanceFromMean < ( -bandWidth ) )
     {
         return 0.0;
     }
@@ -48,7 +51,18 @@ double EpanechnikovKernelDistribution::evaluateCdf( const double& independentVar
     {
         return 1.0;
     }
+}
 
+//! Get probability density
+double EpanechnikovKernelDistribution::evaluatePdf( const double& independentVariable )
+{
+    return evaluateEpanechnikovKernelPdf( independentVariable - mean_, bandWidth_ );
+}
+
+//! Get probability mass
+double EpanechnikovKernelDistribution::evaluateCdf( const double& independentVariable )
+{
+    return evaluateEpanechnikovKernelCdf( independentVariable - mean_, bandWidth_ );
 }
 
 //! Constructor
@@ -57,7 +71,9 @@ KernelDensityDistribution::KernelDensityDistribution(
         const double bandWidthFactor,
         const KernelType kernelType,
         const Eigen::VectorXd& standardDeviation,
-        const Eigen::VectorXd& manualBandwidth )
+        const Eigen::VectorXd& manualBandwidth,
+        const KernelDensityEvaluationMethod evaluationMethod ):
+    evaluationMethod_( evaluationMethod )
 {
     // Load data
     dataSamples_ = samples;
@@ -122,6 +138,19 @@ KernelDensityDistribution::KernelDensityDistribution(
     kernelType_ = kernelType;
 
     generateKernelPointerMatrix( );
+
+    // Create k-d tree of samples, if required
+    allDimensions_.resize( dimensions_ );
+    std::iota( allDimensions_.begin( ), allDimensions_.end( ), 0 );
+    if( evaluationMethod_ == tree_kernel_evaluation )
+    {
+        if( kernelType_ != KernelType::epanechnikov_kernel )
+        {
+            throw std::runtime_error( "Error when creating KernelDensityDistribution, tree-based evaluation is only "
+                                      "supported for kernels with compact support (Epanechnikov kernel)" );
+        }
+        generateSampleTree( );
+    }
 }
 
 //! Function that generates the kernel density distribution based on the samples and kernel type that is provided
@@ -244,9 +273,147 @@ Eigen::VectorXd KernelDensityDistribution::getMedian(
     return medianOfSamples;
 }
 
+//! Function that stores the samples in a k-d tree, and sorts them per dimension.
+void KernelDensityDistribution::generateSampleTree( )
+{
+    // Create tree, reordering the sample indices such that the samples of each node are contiguous
+    std::vector< int > sampleIndices( numberOfSamples_ );
+    std::iota( sampleIndices.begin( ), sampleIndices.end( ), 0 );
+    treeNodes_.clear( );
+    generateSampleTreeNode( sampleIndices, 0, numberOfSamples_ );
+
+    // Store samples in tree ordering
+    treeSamples_.resize( dimensions_, numberOfSamples_ );
+    for( int i = 0; i < numberOfSamples_; i++ )
+    {
+        treeSamples_.col( i ) = dataSamples_[ sampleIndices[ i ] ];
+    }
+
+    // Sort entries of samples per dimension
+    sortedSamples_.resize( dimensions_ );
+    for( int j = 0; j < dimensions_; j++ )
+    {
+        sortedSamples_[ j ].resize( numberOfSamples_ );
+        for( int i = 0; i < numberOfSamples_; i++ )
+        {
+            sortedSamples_[ j ][ i ] = dataSamples_[ i ]( j );
+        }
+        std::sort( sortedSamples_[ j ].begin( ), sortedSamples_[ j ].end( ) );
+    }
+}
+
+//! Function that creates a node of the k-d tree, and (recursively) its child nodes.
+int KernelDensityDistribution::generateSampleTreeNode(
+        std::vector< int >& sampleIndices, const int firstSample, const int endSample )
+{
+    // Maximum number of samples in a leaf node
+    static const int maximumNumberOfSamplesPerLeaf = 16;
+
+    // Create node, and compute bounding box of its samples
+    KernelDensityTreeNode node;
+    node.firstSample_ = firstSample;
+    node.endSample_ = endSample;
+    node.leftChild_ = -1;
+    node.rightChild_ = -1;
+    node.lowerBound_ = dataSamples_[ sampleIndices[ firstSample ] ];
+    node.upperBound_ = dataSamples_[ sampleIndices[ firstSample ] ];
+    for( int i = firstSample + 1; i < endSample; i++ )
+    {
+        node.lowerBound_ = node.lowerBound_.cwiseMin( dataSamples_[ sampleIndices[ i ] ] );
+        node.upperBound_ = node.upperBound_.cwiseMax( dataSamples_[ sampleIndices[ i ] ] );
+    }
+
+    const int nodeIndex = static_cast< int >( treeNodes_.size( ) );
+    treeNodes_.push_back( node );
+
+    // Split node at median of dimension with largest extent (relative to bandwidth)
+    if( endSample - firstSample > maximumNumberOfSamplesPerLeaf )
+    {
+        Eigen::VectorXd::Index splitDimension;
+        ( node.upperBound_ - node.lowerBound_ ).cwiseQuotient( bandWidth_ ).maxCoeff( &splitDimension );
+
+        const int middleSample = firstSample + ( endSample - firstSample ) / 2;
+        std::nth_element( sampleIndices.begin( ) + firstSample, sampleIndices.begin( ) + middleSample,
+                          sampleIndices.begin( ) + endSample,
+                          [ & ]( const int firstIndex, const int secondIndex )
+        {
+            return dataSamples_[ firstIndex ]( splitDimension ) < dataSamples_[ secondIndex ]( splitDimension );
+        } );
+
+        const int leftChild = generateSampleTreeNode( sampleIndices, firstSample, middleSample );
+        const int rightChild = generateSampleTreeNode( sampleIndices, middleSample, endSample );
+        treeNodes_[ nodeIndex ].leftChild_ = leftChild;
+        treeNodes_[ nodeIndex ].rightChild_ = rightChild;
+    }
+
+    return nodeIndex;
+}
+
+//! Function to compute the sum of the (marginal) Epanechnikov kernels at a point, using the k-d tree.
+double KernelDensityDistribution::sumEpanechnikovKernelsFromSampleTree(
+        const std::vector< int >& dimensions, const Eigen::VectorXd& independentVariables )
+{
+    double kernelSum = 0.0;
+
+    std::vector< int > nodesToVisit;
+    nodesToVisit.reserve( 64 );
+    nodesToVisit.push_back( 0 );
+    while( !nodesToVisit.empty( ) )
+    {
+        const KernelDensityTreeNode& currentNode = treeNodes_[ nodesToVisit.back( ) ];
+        nodesToVisit.pop_back( );
+
+        // Skip node if its bounding box does not intersect the support of the kernels around the point
+        bool isNodeInSupport = true;
+        for( unsigned int j = 0; j < dimensions.size( ); j++ )
+        {
+            const int currentDimension = dimensions[ j ];
+            if( currentNode.lowerBound_( currentDimension ) > independentVariables( j ) + bandWidth_( currentDimension ) ||
+                    currentNode.upperBound_( currentDimension ) < independentVariables( j ) - bandWidth_( currentDimension ) )
+            {
+                isNodeInSupport = false;
+                break;
+            }
+        }
+
+        if( !isNodeInSupport )
+        {
+            continue;
+        }
+        else if( currentNode.leftChild_ >= 0 )
+        {
+            nodesToVisit.push_back( currentNode.leftChild_ );
+            nodesToVisit.push_back( currentNode.rightChild_ );
+        }
+        else
+        {
+            // Evaluate kernels of all samples in leaf node
+            for( int i = currentNode.firstSample_; i < currentNode.endSample_; i++ )
+            {
+                double currentKernelPdf = 1.0;
+                for( unsigned int j = 0; j < dimensions.size( ) && currentKernelPdf > 0.0; j++ )
+                {
+                    currentKernelPdf *= evaluateEpanechnikovKernelPdf(
+                                independentVariables( j ) - treeSamples_( dimensions[ j ], i ),
+                                bandWidth_( dimensions[ j ] ) );
+                }
+                kernelSum += currentKernelPdf;
+            }
+        }
+    }
+
+    return kernelSum;
+}
+
 //! Get probability density of the kernel density distribution
 double KernelDensityDistribution::evaluatePdf( const Eigen::VectorXd& independentVariables )
 {
+    if( evaluationMethod_ == tree_kernel_evaluation )
+    {
+        return sumEpanechnikovKernelsFromSampleTree( allDimensions_, independentVariables ) /
+                static_cast< double >( numberOfSamples_ );
+    }
+
     double propbabilityDensity = 0.0;
     double currentKernelPdf = 1.0;
 
@@ -268,6 +435,26 @@ double KernelDensityDistribution::evaluatePdf( const Eigen::VectorXd& independen
     return propbabilityDensity / static_cast< double >( numberOfSamples_ );
 }
 
+//! Get probability density of the kernel density distribution at a set of points
+Eigen::VectorXd KernelDensityDistribution::evaluatePdfs(
+        const Eigen::MatrixXd& independentVariables, const unsigned int numberOfThreads )
+{
+    if( independentVariables.rows( ) != dimensions_ )
+    {
+        throw std::runtime_error( "Error when evaluating kernel density at set of points, points have size " +
+                                  std::to_string( independentVariables.rows( ) ) + ", but should have size " +
+                                  std::to_string( dimensions_ ) );
+    }
+
+    Eigen::VectorXd probabilityDensities( independentVariables.cols( ) );
+    utilities::executeParallelForLoop(
+                independentVariables.cols( ), [ & ]( const unsigned int pointIndex, const unsigned int )
+    {
+        probabilityDensities( pointIndex ) = evaluatePdf( independentVariables.col( pointIndex ) );
+    }, numberOfThreads );
+    return probabilityDensities;
+}
+
 //! Get cumulative probability of the kernel density distribution
 double KernelDensityDistribution::evaluateCdf( const Eigen::VectorXd& independentVariables )
 {
@@ -296,6 +483,26 @@ double KernelDensityDistribution::evaluateCdf( const Eigen::VectorXd& independen
 double KernelDensityDistribution::evaluateCumulativeMarginalProbability(
         const int marginalDimension, const double independentVariable )
 {
+    if( evaluationMethod_ == tree_kernel_evaluation )
+    {
+        // Kernels with support fully below independentVariable contribute 1; only those with support containing
+        // independentVariable need to be evaluated
+        const std::vector< double >& sortedSamples = sortedSamples_[ marginalDimension ];
+        const double bandWidth = bandWidth_( marginalDimension );
+        std::vector< double >::const_iterator lowerIterator = std::lower_bound(
+                    sortedSamples.begin( ), sortedSamples.end( ), independentVariable - bandWidth );
+        std::vector< double >::const_iterator upperIterator = std::upper_bound(
+                    lowerIterator, sortedSamples.end( ), independentVariable + bandWidth );
+
+        double cumulativeProbability = static_cast< double >( lowerIterator - sortedSamples.begin( ) );
+        for( std::vector< double >::const_iterator sampleIterator = lowerIterator; sampleIterator != upperIterator;
+             sampleIterator++ )
+        {
+            cumulativeProbability += evaluateEpanechnikovKernelCdf( independentVariable - *sampleIterator, bandWidth );
+        }
+        return cumulativeProbability / static_cast< double >( numberOfSamples_ );
+    }
+
     // Compute cdf at independentVariable in marginalDimension, averaged over all samples
     double cumulativeProbability = 0.0;
     for( int i = 0; i < numberOfSamples_; i++ )
@@ -309,6 +516,12 @@ double KernelDensityDistribution::evaluateCumulativeMarginalProbability(
 double KernelDensityDistribution::evaluateMarginalProbabilityDensity(
         const std::vector< int >& marginalDimensions, const Eigen::VectorXd& independentVariables )
 {
+    if( evaluationMethod_ == tree_kernel_evaluation )
+    {
+        return sumEpanechnikovKernelsFromSampleTree( marginalDimensions, independentVariables ) /
+                static_cast< double >( numberOfSamples_ );
+    }
+
     double probabilityDensity = 0.0;
     double marginalPdfOfCurrentKernel = 1.0;
 
@@ -330,10 +543,51 @@ double KernelDensityDistribution::evaluateMarginalProbabilityDensity(
     return probabilityDensity / static_cast< double >( numberOfSamples_ );
 }
 
+//! Function to evaluate probability density of joint marginal distribution at a set of points.
+Eigen::VectorXd KernelDensityDistribution::evaluateMarginalProbabilityDensities(
+        const std::vector< int >& marginalDimensions, const Eigen::MatrixXd& independentVariables,
+        const unsigned int numberOfThreads )
+{
+    if( independentVariables.rows( ) != static_cast< int >( marginalDimensions.size( ) ) )
+    {
+        throw std::runtime_error( "Error when evaluating marginal kernel density at set of points, points have size " +
+                                  std::to_string( independentVariables.rows( ) ) + ", but should have size " +
+                                  std::to_string( marginalDimensions.size( ) ) );
+    }
+
+    Eigen::VectorXd probabilityDensities( independentVariables.cols( ) );
+    utilities::executeParallelForLoop(
+                independentVariables.cols( ), [ & ]( const unsigned int pointIndex, const unsigned int )
+    {
+        probabilityDensities( pointIndex ) = evaluateMarginalProbabilityDensity(
+                    marginalDimensions, independentVariables.col( pointIndex ) );
+    }, numberOfThreads );
+    return probabilityDensities;
+}
+
 //! Function to evaluate marginal distribution density at single dimension.
 double KernelDensityDistribution::evaluateMarginalProbabilityDensity(
         const int marginalDimension, const double independentVariable )
 {
+    if( evaluationMethod_ == tree_kernel_evaluation )
+    {
+        // Only evaluate kernels with support containing independentVariable
+        const std::vector< double >& sortedSamples = sortedSamples_[ marginalDimension ];
+        const double bandWidth = bandWidth_( marginalDimension );
+        std::vector< double >::const_iterator lowerIterator = std::lower_bound(
+                    sortedSamples.begin( ), sortedSamples.end( ), independentVariable - bandWidth );
+        std::vector< double >::const_iterator upperIterator = std::upper_bound(
+                    lowerIterator, sortedSamples.end( ), independentVariable + bandWidth );
+
+        double probabilityDensity = 0.0;
+        for( std::vector< double >::const_iterator sampleIterator = lowerIterator; sampleIterator != upperIterator;
+             sampleIterator++ )
+        {
+            probabilityDensity += evaluateEpanechnikovKernelPdf( independentVariable - *sampleIterator, bandWidth );
+        }
+        return probabilityDensity / static_cast< double >( numberOfSamples_ );
+    }
+
     double probabilityDensity = 0.0;
 
     // Compute pdf at independentVariable in marginalDimension, averaged over all samples
@@ -14,6 +14,7 @@
 #include <map>
 #include <boost/make_shared.hpp>
 #include <memory>
+#include <vector>
 
 #include "Tudat/Mathematics/Statistics/continuousProbabilityDistributions.h"
 #include "Tudat/Mathematics/Statistics/boostProbabilityDistributions.h"
@@ -64,6 +65,24 @@ private:
     double bandWidth_;
 };
 
+//! Function to evaluate the probability density of a single Epanechnikov kernel.
+/*!
+ *  Function to evaluate the probability density of a single Epanechnikov kernel.
+ *  \param distanceFromMean Difference between independent variable and kernel mean.
+ *  \param bandWidth Kernel bandwidth
+ *  \return Evaluated pdf (zero outside of the support [-bandWidth, bandWidth] of the kernel).
+ */
+double evaluateEpanechnikovKernelPdf( const double distanceFromMean, const double bandWidth );
+
+//! Function to evaluate the cumulative probability of a single Epanechnikov kernel.
+/*!
+ *  Function to evaluate the cumulative probability of a single Epanechnikov kernel.
+ *  \param distanceFromMean Difference between independent variable and kernel mean.
+ *  \param bandWidth Kernel bandwidth
+ *  \return Evaluated cdf
+ */
+double evaluateEpanechnikovKernelCdf( const double distanceFromMean, const double bandWidth );
+
 //! Kernel type that is used in the Kernel Density Estimate
 enum KernelType
 {
@@ -71,6 +90,42 @@ enum KernelType
     epanechnikov_kernel = 1
 };
 
+//! Method by which the kernels contributing to the Kernel Density Estimate at a given point are selected.
+/*!
+ *  Method by which the kernels contributing to the Kernel Density Estimate at a given point are selected. For the
+ *  direct_kernel_evaluation, all kernels are evaluated. For the tree_kernel_evaluation, the samples are stored in a k-d
+ *  tree, and only the kernels of which the (compact) support contains the point are evaluated, reducing the cost of a
+ *  single evaluation from O(N) to roughly O(log N + k), with k the number of contributing kernels. The latter is only
+ *  available for kernels with compact support (i.e. the Epanechnikov kernel).
+ */
+enum KernelDensityEvaluationMethod
+{
+    direct_kernel_evaluation = 0,
+    tree_kernel_evaluation = 1
+};
+
+//! Node of the k-d tree in which the samples of a kernel density distribution are stored.
+struct KernelDensityTreeNode
+{
+    //! Index (in the tree ordering of the samples) of the first sample in the node.
+    int firstSample_;
+
+    //! Index (in the tree ordering of the samples) one past the last sample in the node.
+    int endSample_;
+
+    //! Index of the child node containing the lower half of the samples (-1 for leaf nodes).
+    int leftChild_;
+
+    //! Index of the child node containing the upper half of the samples (-1 for leaf nodes).
+    int rightChild_;
+
+    //! Lower corner of the bounding box of the samples in the node.
+    Eigen::VectorXd lowerBound_;
+
+    //! Upper corner of the bounding box of the samples in the node.
+    Eigen::VectorXd upperBound_;
+};
+
 //! Class that uses random samples to generate a multivariate probability distribution using Kernel Density distribution.
 /*!
  *  Class that uses random samples to generate a multivariate probability distribution using Kernel Density distribution.
@@ -95,13 +150,16 @@ public:
      * deviation computed from the samples/
      * \param manualBandwidth Vector of bandwidths for each dimension that is to be used in the kernels. By default this
      * vector is empty and not used. Optimal bandwidths (scaled by bandWidthFactor) are used in this default case.
+     * \param evaluationMethod Method by which the kernels contributing to the probability density are selected. The
+     * tree_kernel_evaluation is only supported for the Epanechnikov kernel.
      */
     KernelDensityDistribution(
             const std::vector< Eigen::VectorXd >& samples,
             const double bandWidthFactor = 1.0,
             const KernelType kernel_type = KernelType::gaussian_kernel,
             const Eigen::VectorXd& manualStandardDeviation = Eigen::VectorXd::Zero( 0 ),
-            const Eigen::VectorXd& manualBandwidth = Eigen::VectorXd::Zero( 0 ) );
+            const Eigen::VectorXd& manualBandwidth = Eigen::VectorXd::Zero( 0 ),
+            const KernelDensityEvaluationMethod evaluationMethod = direct_kernel_evaluation );
 
     //! Function to evaluate pdf of distribution
     /*!
@@ -111,6 +169,16 @@ public:
      */
     double evaluatePdf( const Eigen::VectorXd& independentVariables );
 
+    //! Function to evaluate pdf of distribution at a set of points
+    /*!
+     *  Function to evaluate probability distribution function at a set of points, which may be distributed over
+     *  multiple threads.
+     *  \param independentVariables Values of independent variables, with each column a point at which the pdf is evaluated.
+     *  \param numberOfThreads Number of threads over which the evaluations are distributed.
+     *  \return Evaluated pdf at each of the points.
+     */
+    Eigen::VectorXd evaluatePdfs( const Eigen::MatrixXd& independentVariables, const unsigned int numberOfThreads = 1 );
+
     //! Function to evaluate cdf of distribution
     /*!
      *  Function to evaluate cumulative distribution function at given independentVariable value.
@@ -130,6 +198,20 @@ public:
     double evaluateMarginalProbabilityDensity(
             const std::vector< int >& marginalDimensions, const Eigen::VectorXd& independentVariables );
 
+    //! Function to evaluate probability density of marginal (in one or more dimensions) distribution at a set of points.
+    /*!
+     * Function to evaluate probability density of marginal (in one or more dimensions) distribution at a set of points,
+     * which may be distributed over multiple threads.
+     * \param marginalDimensions Dimensions over which the marginal probaility is to be computed
+     * \param independentVariables Values of independent variables (in marginalDimensions), with each column a point at
+     * which the marginal probability is to be computed
+     * \param numberOfThreads Number of threads over which the evaluations are distributed.
+     * \return Probability density of marginal distribution at each of the points.
+     */
+    Eigen::VectorXd evaluateMarginalProbabilityDensities(
+            const std::vector< int >& marginalDimensions, const Eigen::MatrixXd& independentVariables,
+            const unsigned int numberOfThreads = 1 );
+
     //! Function to evaluate marginal distribution density at single dimension.
     /*!
      * Function to evaluate marginal distribution density at single dimension.
@@ -265,6 +347,16 @@ public:
         return numberOfSamples_;
     }
 
+    //! Function to retrieve the method by which the kernels contributing to the probability density are selected.
+    /*!
+     * Function to retrieve the method by which the kernels contributing to the probability density are selected.
+     * \return Kernel density evaluation method.
+     */
+    KernelDensityEvaluationMethod getEvaluationMethod( )
+    {
+        return evaluationMethod_;
+    }
+
 protected:
 
 private:
@@ -334,6 +426,36 @@ private:
      */
     Eigen::VectorXd getMedian( const std::vector< Eigen::VectorXd >& samples );
 
+    //! Function that stores the samples in a k-d tree, and sorts them per dimension.
+    /*!
+     *  Function that stores the samples in a k-d tree (treeNodes_ and treeSamples_ variables), and sorts the entries of the
+     *  samples per dimension (sortedSamples_ variable), for use with the tree_kernel_evaluation method.
+     */
+    void generateSampleTree( );
+
+    //! Function that creates a node of the k-d tree, and (recursively) its child nodes.
+    /*!
+     *  Function that creates a node of the k-d tree, and (recursively) its child nodes. The node is split at the median of
+     *  the samples in the dimension in which the bounding box of the node is largest (relative to the bandwidth).
+     *  \param sampleIndices Indices of the samples in dataSamples_, reordered by this function such that the samples of
+     *  each node are contiguous.
+     *  \param firstSample Index in sampleIndices of the first sample in the node.
+     *  \param endSample Index in sampleIndices one past the last sample in the node.
+     *  \return Index of the created node in treeNodes_.
+     */
+    int generateSampleTreeNode( std::vector< int >& sampleIndices, const int firstSample, const int endSample );
+
+    //! Function to compute the sum of the (marginal) Epanechnikov kernels at a point, using the k-d tree.
+    /*!
+     *  Function to compute the sum of the (marginal) Epanechnikov kernels at a point, using the k-d tree. Only the samples
+     *  in nodes of which the bounding box intersects the support of the kernels around the point are evaluated.
+     *  \param dimensions Dimensions in which the kernels are evaluated.
+     *  \param independentVariables Values of independent variables (in dimensions) at which the kernels are evaluated.
+     *  \return Sum of the products (over dimensions) of the kernel densities of all samples.
+     */
+    double sumEpanechnikovKernelsFromSampleTree(
+            const std::vector< int >& dimensions, const Eigen::VectorXd& independentVariables );
+
     //! Datasamples
     std::vector< Eigen::VectorXd > dataSamples_;
 
@@ -364,6 +486,21 @@ private:
     //! Matrix (vector of vectors) of 1D kernel pointers that define full kernel density distribution.
     std::vector< std::vector< std::shared_ptr< ContinuousProbabilityDistribution< double > > > > kernelPointersMatrix_;
 
+    //! Method by which the kernels contributing to the probability density are selected.
+    KernelDensityEvaluationMethod evaluationMethod_;
+
+    //! List of all dimensions (0 to dimensions_ - 1) of the distribution.
+    std::vector< int > allDimensions_;
+
+    //! Nodes of the k-d tree of samples (root node at index 0); only used for tree_kernel_evaluation.
+    std::vector< KernelDensityTreeNode > treeNodes_;
+
+    //! Samples (one per column), ordered such that the samples of each node in treeNodes_ are contiguous.
+    Eigen::MatrixXd treeSamples_;
+
+    //! Entries of the samples, sorted in ascending order, for each dimension; only used for tree_kernel_evaluation.
+    std::vector< std::vector< double > > sortedSamples_;
+
 };
 
 //! Pointer to Kernel Density distribution class
@@ -0,0 +1,397 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <boost/random/mersenne_twister.hpp>
+
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Mathematics/Statistics/randomSampleGenerator.h"
+#include "Tudat/Mathematics/Statistics/boostProbabilityDistributions.h"
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+//! Primitive polynomial and initial direction numbers for a single dimension of the Sobol sequence.
+struct SobolDirectionNumberSettings
+{
+    //! Degree of the primitive polynomial.
+    int degree;
+
+    //! Coefficients of the primitive polynomial (excluding the leading and trailing coefficients), as bits.
+    unsigned int coefficients;
+
+    //! Initial direction numbers (degree entries are used).
+    unsigned int initialDirectionNumbers[ 7 ];
+};
+
+//! Direction number settings for dimensions 2 and up, from Joe and Kuo (2008), file new-joe-kuo-6.21201.
+static const SobolDirectionNumberSettings sobolDirectionNumberSettings[ ] =
+{
+    { 1, 0, { 1 } },
+    { 2, 1, { 1, 3 } },
+    { 3, 1, { 1, 3, 1 } },
+    { 3, 2, { 1, 1, 1 } },
+    { 4, 1, { 1, 1, 3, 3 } },
+    { 4, 4, { 1, 3, 5, 13 } },
+    { 5, 2, { 1, 1, 5, 5, 17 } },
+    { 5, 4, { 1, 1, 5, 5, 5 } },
+    { 5, 7, { 1, 1, 7, 11, 19 } },
+    { 5, 11, { 1, 1, 5, 1, 1 } },
+    { 5, 13, { 1, 1, 1, 3, 11 } },
+    { 5, 14, { 1, 3, 5, 5, 31 } },
+    { 6, 1, { 1, 3, 3, 9, 7, 49 } },
+    { 6, 13, { 1, 1, 1, 15, 21, 21 } },
+    { 6, 16, { 1, 3, 1, 13, 27, 49 } },
+    { 6, 19, { 1, 1, 1, 15, 7, 5 } },
+    { 6, 22, { 1, 3, 1, 15, 13, 25 } },
+    { 6, 25, { 1, 1, 5, 5, 19, 61 } },
+    { 7, 1, { 1, 3, 7, 11, 23, 15, 103 } },
+    { 7, 4, { 1, 3, 7, 13, 13, 15, 69 } }
+};
+
+//! Number of bits of the Sobol sequence points.
+static const int numberOfSobolBits = 32;
+
+//! Constructor
+SobolSequence::SobolSequence( const int numberOfDimensions ):
+    numberOfDimensions_( numberOfDimensions )
+{
+    if( numberOfDimensions_ < 1 || numberOfDimensions_ > getMaximumNumberOfDimensions( ) )
+    {
+        throw std::runtime_error( "Error when creating Sobol sequence, number of dimensions is " +
+                                  std::to_string( numberOfDimensions_ ) + ", but must be between 1 and " +
+                                  std::to_string( getMaximumNumberOfDimensions( ) ) );
+    }
+
+    directionNumbers_.resize( numberOfDimensions_ * numberOfSobolBits );
+
+    // First dimension: van der Corput sequence in base 2
+    for( int k = 0; k < numberOfSobolBits; k++ )
+    {
+        directionNumbers_[ k ] = 1u << ( numberOfSobolBits - 1 - k );
+    }
+
+    // Other dimensions: recurrence relation defined by primitive polynomial
+    for( int d = 1; d < numberOfDimensions_; d++ )
+    {
+        const SobolDirectionNumberSettings& settings = sobolDirectionNumberSettings[ d - 1 ];
+        std::uint32_t* currentDirectionNumbers = &directionNumbers_[ d * numberOfSobolBits ];
+        for( int k = 0; k < numberOfSobolBits; k++ )
+        {
+            if( k < settings.degree )
+            {
+                currentDirectionNumbers[ k ] = settings.initialDirectionNumbers[ k ] << ( numberOfSobolBits - 1 - k );
+            }
+            else
+            {
+                currentDirectionNumbers[ k ] = currentDirectionNumbers[ k - settings.degree ] ^
+                        ( currentDirectionNumbers[ k - settings.degree ] >> settings.degree );
+                for( int j = 1; j < settings.degree; j++ )
+                {
+                    if( ( settings.coefficients >> ( settings.degree - 1 - j ) ) & 1u )
+                    {
+                        currentDirectionNumbers[ k ] ^= currentDirectionNumbers[ k - j ];
+                    }
+                }
+            }
+        }
+    }
+}
+
+//! Function to retrieve the maximum number of dimensions for which direction numbers are available.
+int SobolSequence::getMaximumNumberOfDimensions( )
+{
+    return 1 + static_cast< int >( sizeof( sobolDirectionNumberSettings ) / sizeof( SobolDirectionNumberSettings ) );
+}
+
+//! Function to compute a sequence of consecutive points.
+void SobolSequence::computePoints( const std::uint64_t firstPointIndex, Eigen::Ref< Eigen::MatrixXd > points ) const
+{
+    if( points.rows( ) != numberOfDimensions_ )
+    {
+        throw std::runtime_error( "Error when computing Sobol sequence, point size is " + std::to_string( points.rows( ) ) +
+                                  ", but should be " + std::to_string( numberOfDimensions_ ) );
+    }
+    if( firstPointIndex + static_cast< std::uint64_t >( points.cols( ) ) > ( std::uint64_t( 1 ) << numberOfSobolBits ) )
+    {
+        throw std::runtime_error( "Error when computing Sobol sequence, requested point index exceeds maximum" );
+    }
+
+    static const double normalizationFactor = 1.0 / static_cast< double >( std::uint64_t( 1 ) << numberOfSobolBits );
+
+    // Compute first point directly from the Gray code of its index
+    std::vector< std::uint32_t > currentPoint( numberOfDimensions_, 0 );
+    std::uint64_t grayCode = firstPointIndex ^ ( firstPointIndex >> 1 );
+    for( int bit = 0; grayCode != 0; bit++, grayCode >>= 1 )
+    {
+        if( grayCode & 1u )
+        {
+            for( int d = 0; d < numberOfDimensions_; d++ )
+            {
+                currentPoint[ d ] ^= directionNumbers_[ d * numberOfSobolBits + bit ];
+            }
+        }
+    }
+
+    for( int i = 0; i < points.cols( ); i++ )
+    {
+        // Gray codes of consecutive indices differ in the lowest zero bit of the previous index
+        if( i > 0 )
+        {
+            std::uint64_t previousIndex = firstPointIndex + i - 1;
+            int bit = 0;
+            while( ( previousIndex >> bit ) & 1u )
+            {
+                bit++;
+            }
+            for( int d = 0; d < numberOfDimensions_; d++ )
+            {
+                currentPoint[ d ] ^= directionNumbers_[ d * numberOfSobolBits + bit ];
+            }
+        }
+
+        for( int d = 0; d < numberOfDimensions_; d++ )
+        {
+            points( d, i ) = static_cast< double >( currentPoint[ d ] ) * normalizationFactor;
+        }
+    }
+}
+
+//! Constructor for uniformly distributed samples.
+RandomSampleGenerator::RandomSampleGenerator(
+        const Eigen::VectorXd& lowerBound, const Eigen::VectorXd& upperBound,
+        const RandomSampleSequenceType sequenceType,
+        const int seed,
+        const int numberOfSamplesPerSubstream ):
+    numberOfDimensions_( lowerBound.rows( ) ), sequenceType_( sequenceType ), seed_( seed ),
+    numberOfSamplesPerSubstream_( numberOfSamplesPerSubstream ),
+    lowerBound_( lowerBound ), width_( upperBound - lowerBound )
+{
+    if( lowerBound.rows( ) != upperBound.rows( ) )
+    {
+        throw std::runtime_error( "Error when creating random sample generator, input bounds are inconsistent" );
+    }
+    if( numberOfDimensions_ < 1 || numberOfSamplesPerSubstream_ < 1 )
+    {
+        throw std::runtime_error( "Error when creating random sample generator, sample and substream size must be positive" );
+    }
+
+    if( sequenceType_ == sobol_sequence )
+    {
+        sobolSequence_ = std::make_shared< SobolSequence >( numberOfDimensions_ );
+    }
+}
+
+//! Constructor for samples with entries from arbitrary (invertible) distributions.
+RandomSampleGenerator::RandomSampleGenerator(
+        const std::vector< std::shared_ptr< InvertibleContinuousProbabilityDistribution< double > > >& distributions,
+        const RandomSampleSequenceType sequenceType,
+        const int seed,
+        const int numberOfSamplesPerSubstream ):
+    numberOfDimensions_( static_cast< int >( distributions.size( ) ) ), sequenceType_( sequenceType ), seed_( seed ),
+    numberOfSamplesPerSubstream_( numberOfSamplesPerSubstream ), distributions_( distributions )
+{
+    if( numberOfDimensions_ < 1 || numberOfSamplesPerSubstream_ < 1 )
+    {
+        throw std::runtime_error( "Error when creating random sample generator, sample and substream size must be positive" );
+    }
+    for( unsigned int i = 0; i < distributions_.size( ); i++ )
+    {
+        if( distributions_.at( i ) == nullptr )
+        {
+            throw std::runtime_error( "Error when creating random sample generator, distribution " +
+                                      std::to_string( i ) + " is not defined" );
+        }
+    }
+
+    if( sequenceType_ == sobol_sequence )
+    {
+        sobolSequence_ = std::make_shared< SobolSequence >( numberOfDimensions_ );
+    }
+}
+
+//! Function to generate a set of consecutive samples.
+void RandomSampleGenerator::generateSamples( const std::uint64_t firstSampleIndex, Eigen::Ref< Eigen::MatrixXd > samples,
+                                             const unsigned int numberOfThreads ) const
+{
+    if( samples.rows( ) != numberOfDimensions_ )
+    {
+        throw std::runtime_error( "Error when generating random samples, sample size is " + std::to_string( samples.rows( ) ) +
+                                  ", but should be " + std::to_string( numberOfDimensions_ ) );
+    }
+
+    const std::uint64_t endSampleIndex = firstSampleIndex + samples.cols( );
+    if( endSampleIndex == firstSampleIndex )
+    {
+        return;
+    }
+
+    // Split samples into blocks aligned with the substreams, and distribute these over the threads
+    const std::uint64_t blockSize = static_cast< std::uint64_t >( numberOfSamplesPerSubstream_ );
+    const std::uint64_t firstBlock = firstSampleIndex / blockSize;
+    const std::uint64_t endBlock = ( endSampleIndex + blockSize - 1 ) / blockSize;
+    utilities::executeParallelForLoop(
+                static_cast< unsigned int >( endBlock - firstBlock ),
+                [ & ]( const unsigned int blockIndex, const unsigned int )
+    {
+        const std::uint64_t blockStart = std::max( firstSampleIndex, ( firstBlock + blockIndex ) * blockSize );
+        const std::uint64_t blockEnd = std::min( endSampleIndex, ( firstBlock + blockIndex + 1 ) * blockSize );
+        generateSamplesInSingleThread(
+                    blockStart, samples.middleCols( blockStart - firstSampleIndex, blockEnd - blockStart ) );
+    }, numberOfThreads );
+}
+
+//! Function to generate a set of samples, starting from the first sample.
+Eigen::MatrixXd RandomSampleGenerator::generateSamples( const int numberOfSamples, const unsigned int numberOfThreads ) const
+{
+    Eigen::MatrixXd samples( numberOfDimensions_, numberOfSamples );
+    generateSamples( 0, samples, numberOfThreads );
+    return samples;
+}
+
+//! Function to generate a set of samples in chunks, and pass each chunk to a user-defined function.
+void RandomSampleGenerator::streamSamples(
+        const std::uint64_t numberOfSamples, const int chunkSize,
+        const std::function< void( const Eigen::MatrixXd&, const std::uint64_t ) > chunkFunction,
+        const unsigned int numberOfThreads ) const
+{
+    if( chunkSize < 1 )
+    {
+        throw std::runtime_error( "Error when streaming random samples, chunk size must be positive" );
+    }
+
+    Eigen::MatrixXd chunk;
+    for( std::uint64_t chunkStart = 0; chunkStart < numberOfSamples; chunkStart += chunkSize )
+    {
+        const int currentChunkSize = static_cast< int >(
+                    std::min( static_cast< std::uint64_t >( chunkSize ), numberOfSamples - chunkStart ) );
+        if( chunk.cols( ) != currentChunkSize )
+        {
+            chunk.resize( numberOfDimensions_, currentChunkSize );
+        }
+        generateSamples( chunkStart, chunk, numberOfThreads );
+        chunkFunction( chunk, chunkStart );
+    }
+}
+
+//! Function to generate a set of consecutive samples in a single thread.
+void RandomSampleGenerator::generateSamplesInSingleThread(
+        const std::uint64_t firstSampleIndex, Eigen::Ref< Eigen::MatrixXd > samples ) const
+{
+    if( sequenceType_ == sobol_sequence )
+    {
+        // Skip origin of Sobol sequence, which is on the boundary of the domain.
+        sobolSequence_->computePoints( firstSampleIndex + 1, samples );
+    }
+    else
+    {
+        static const double normalizationFactor = 1.0 / 4294967296.0;
+
+        // Each sample uses exactly numberOfDimensions_ draws, so that the generator may be advanced to any sample.
+        boost::random::mt19937 randomNumberGenerator;
+        std::uint64_t currentSubstream = 0;
+        for( int i = 0; i < samples.cols( ); i++ )
+        {
+            const std::uint64_t sampleIndex = firstSampleIndex + i;
+            const std::uint64_t substream = sampleIndex / static_cast< std::uint64_t >( numberOfSamplesPerSubstream_ );
+            if( i == 0 || substream != currentSubstream )
+            {
+                std::seed_seq seedSequence = { static_cast< std::uint32_t >( seed_ ),
+                                               static_cast< std::uint32_t >( substream ),
+                                               static_cast< std::uint32_t >( substream >> 32 ) };
+                randomNumberGenerator.seed( seedSequence );
+                randomNumberGenerator.discard(
+                            ( sampleIndex % static_cast< std::uint64_t >( numberOfSamplesPerSubstream_ ) ) *
+                            static_cast< std::uint64_t >( numberOfDimensions_ ) );
+                currentSubstream = substream;
+            }
+
+            // Generate values in (0,1), excluding the boundaries
+            for( int j = 0; j < numberOfDimensions_; j++ )
+            {
+                samples( j, i ) = ( static_cast< double >( randomNumberGenerator( ) ) + 0.5 ) * normalizationFactor;
+            }
+        }
+    }
+
+    mapUniformSamplesToDistributions( samples );
+}
+
+//! Function to map uniformly distributed values in (0,1) to the distributions of the entries of the samples.
+void RandomSampleGenerator::mapUniformSamplesToDistributions( Eigen::Ref< Eigen::MatrixXd > samples ) const
+{
+    if( distributions_.empty( ) )
+    {
+        samples = ( width_.asDiagonal( ) * samples ).colwise( ) + lowerBound_;
+    }
+    else
+    {
+        for( int i = 0; i < samples.cols( ); i++ )
+        {
+            for( int j = 0; j < numberOfDimensions_; j++ )
+            {
+                samples( j, i ) = distributions_[ j ]->evaluateInverseCdf( samples( j, i ) );
+            }
+        }
+    }
+}
+
+//! Generate matrix of random vectors, with entries of each vector independently uniformly distributed.
+Eigen::MatrixXd generateUniformRandomSampleMatrix(
+        const int seed, const int numberOfSamples,
+        const Eigen::VectorXd& lowerBound, const Eigen::VectorXd& upperBound,
+        const unsigned int numberOfThreads )
+{
+    return RandomSampleGenerator( lowerBound, upperBound, pseudo_random_sequence, seed ).generateSamples(
+                numberOfSamples, numberOfThreads );
+}
+
+//! Generate matrix of random vectors, with entries of each vector independently Gaussian distributed.
+Eigen::MatrixXd generateGaussianRandomSampleMatrix(
+        const int seed, const int numberOfSamples,
+        const Eigen::VectorXd& mean, const Eigen::VectorXd& standardDeviation,
+        const unsigned int numberOfThreads )
+{
+    if( mean.rows( ) != standardDeviation.rows( ) )
+    {
+        throw std::runtime_error( "Error when making Gaussian distributed sample matrix, input is inconsistent" );
+    }
+
+    std::vector< std::shared_ptr< InvertibleContinuousProbabilityDistribution< double > > > distributions;
+    for( int i = 0; i < mean.rows( ); i++ )
+    {
+        distributions.push_back( createBoostRandomVariable(
+                                     normal_boost_distribution, { mean( i ), standardDeviation( i ) } ) );
+    }
+
+    return RandomSampleGenerator( distributions, pseudo_random_sequence, seed ).generateSamples(
+                numberOfSamples, numberOfThreads );
+}
+
+//! Generate matrix of vectors, using a Sobol sequence.
+Eigen::MatrixXd generateSobolSampleMatrix(
+        const int numberOfSamples,
+        const Eigen::VectorXd& lowerBound, const Eigen::VectorXd& upperBound,
+        const unsigned int numberOfThreads )
+{
+    return RandomSampleGenerator( lowerBound, upperBound, sobol_sequence ).generateSamples(
+                numberOfSamples, numberOfThreads );
+}
+
+} // namespace statistics
+
+} // namespace tudat
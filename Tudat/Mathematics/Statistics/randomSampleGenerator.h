@@ -0,0 +1,276 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_RANDOM_SAMPLE_GENERATOR_H
+#define TUDAT_RANDOM_SAMPLE_GENERATOR_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Statistics/continuousProbabilityDistributions.h"
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+//! Class to generate points of a Sobol low-discrepancy sequence.
+/*!
+ *  Class to generate points of a Sobol low-discrepancy sequence, with the direction numbers of Joe and Kuo (2008,
+ *  new-joe-kuo-6.21201), in Gray code order. Any point of the sequence can be computed directly from its index, so that
+ *  (parts of) the sequence can be generated independently, and in parallel. At most 2^32 points, in at most
+ *  getMaximumNumberOfDimensions( ) dimensions, can be generated.
+ */
+class SobolSequence
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param numberOfDimensions Number of dimensions of the points of the sequence.
+     */
+    SobolSequence( const int numberOfDimensions );
+
+    //! Function to compute a sequence of consecutive points.
+    /*!
+     *  Function to compute a sequence of consecutive points of the Sobol sequence, with values in [0,1).
+     *  \param firstPointIndex Index of the first point that is to be computed (point 0 is the origin).
+     *  \param points Matrix in which the points are stored, one point per column. The number of columns defines the number
+     *  of points that are computed, the number of rows must be equal to the number of dimensions of the sequence.
+     */
+    void computePoints( const std::uint64_t firstPointIndex, Eigen::Ref< Eigen::MatrixXd > points ) const;
+
+    //! Function to retrieve the number of dimensions of the points of the sequence.
+    /*!
+     * Function to retrieve the number of dimensions of the points of the sequence.
+     * \return Number of dimensions of the points of the sequence.
+     */
+    int getNumberOfDimensions( ) const
+    {
+        return numberOfDimensions_;
+    }
+
+    //! Function to retrieve the maximum number of dimensions for which direction numbers are available.
+    /*!
+     * Function to retrieve the maximum number of dimensions for which direction numbers are available.
+     * \return Maximum number of dimensions of the sequence.
+     */
+    static int getMaximumNumberOfDimensions( );
+
+private:
+
+    //! Number of dimensions of the points of the sequence.
+    int numberOfDimensions_;
+
+    //! Direction numbers, stored per dimension (32 entries per dimension, one for each bit).
+    std::vector< std::uint32_t > directionNumbers_;
+};
+
+//! Type of sequence from which random samples are generated.
+enum RandomSampleSequenceType
+{
+    pseudo_random_sequence = 0,
+    sobol_sequence = 1
+};
+
+//! Class to generate large sets of random vectors, directly into contiguous matrices.
+/*!
+ *  Class to generate large sets of random vectors, with entries of each vector independently (but not necessarily
+ *  identically) distributed. The samples are stored in matrices, one sample per column, which may be filled in parallel,
+ *  or streamed in chunks to a user-defined function. Each sample is defined by its index, and the set of samples only
+ *  depends on the seed (and not on the number of threads or the chunk size) so that results are reproducible.
+ *
+ *  For a pseudo_random_sequence, the samples are split into substreams of a fixed number of samples, each of which uses
+ *  an independent Mersenne twister generator, seeded from the seed and the index of the substream. For a sobol_sequence,
+ *  the Sobol point with index i + 1 is used for sample i (skipping the origin). In both cases, the uniform values in (0,1)
+ *  are mapped to the requested distribution with its inverse cdf.
+ */
+class RandomSampleGenerator
+{
+public:
+
+    //! Constructor for uniformly distributed samples.
+    /*!
+     * Constructor for uniformly distributed samples.
+     * \param lowerBound Vector of lower bounds for the distributions for the entries of the random vectors.
+     * \param upperBound Vector of upper bounds for the distributions for the entries of the random vectors.
+     * \param sequenceType Type of sequence from which the samples are generated.
+     * \param seed Seed of random number generator (not used for Sobol sequence).
+     * \param numberOfSamplesPerSubstream Number of samples generated by each independent substream (not used for Sobol
+     * sequence). Changing this value changes the samples that are generated.
+     */
+    RandomSampleGenerator(
+            const Eigen::VectorXd& lowerBound, const Eigen::VectorXd& upperBound,
+            const RandomSampleSequenceType sequenceType = pseudo_random_sequence,
+            const int seed = 0,
+            const int numberOfSamplesPerSubstream = 4096 );
+
+    //! Constructor for samples with entries from arbitrary (invertible) distributions.
+    /*!
+     * Constructor for samples with entries from arbitrary (invertible) distributions.
+     * \param distributions Probability distributions for the entries of the random vectors (i.e. entry i of this vector is
+     * distribution of entry i of each sample). The inverse cdf functions of these distributions must be thread-safe.
+     * \param sequenceType Type of sequence from which the samples are generated.
+     * \param seed Seed of random number generator (not used for Sobol sequence).
+     * \param numberOfSamplesPerSubstream Number of samples generated by each independent substream (not used for Sobol
+     * sequence). Changing this value changes the samples that are generated.
+     */
+    RandomSampleGenerator(
+            const std::vector< std::shared_ptr< InvertibleContinuousProbabilityDistribution< double > > >& distributions,
+            const RandomSampleSequenceType sequenceType = pseudo_random_sequence,
+            const int seed = 0,
+            const int numberOfSamplesPerSubstream = 4096 );
+
+    //! Function to generate a set of consecutive samples.
+    /*!
+     *  Function to generate a set of consecutive samples, distributed over a number of threads.
+     *  \param firstSampleIndex Index of the first sample that is to be generated.
+     *  \param samples Matrix in which the samples are stored, one sample per column. The number of columns defines the
+     *  number of samples that are generated, the number of rows must be equal to the size of each sample.
+     *  \param numberOfThreads Number of threads over which the generation of the samples is distributed.
+     */
+    void generateSamples( const std::uint64_t firstSampleIndex, Eigen::Ref< Eigen::MatrixXd > samples,
+                          const unsigned int numberOfThreads = 1 ) const;
+
+    //! Function to generate a set of samples, starting from the first sample.
+    /*!
+     *  Function to generate a set of samples, starting from the first sample, distributed over a number of threads.
+     *  \param numberOfSamples Number of samples that are to be generated.
+     *  \param numberOfThreads Number of threads over which the generation of the samples is distributed.
+     *  \return Matrix of samples, one sample per column.
+     */
+    Eigen::MatrixXd generateSamples( const int numberOfSamples, const unsigned int numberOfThreads = 1 ) const;
+
+    //! Function to generate a set of samples in chunks, and pass each chunk to a user-defined function.
+    /*!
+     *  Function to generate a set of samples in chunks, and pass each chunk to a user-defined function (for instance a
+     *  batch propagation), such that the full set of samples never needs to be stored. The samples that are generated
+     *  are identical to those generated by generateSamples.
+     *  \param numberOfSamples Total number of samples that are to be generated.
+     *  \param chunkSize Maximum number of samples in each chunk.
+     *  \param chunkFunction Function that is called with each chunk of samples (one sample per column), and the index of
+     *  the first sample in the chunk.
+     *  \param numberOfThreads Number of threads over which the generation of each chunk is distributed.
+     */
+    void streamSamples( const std::uint64_t numberOfSamples, const int chunkSize,
+                        const std::function< void( const Eigen::MatrixXd&, const std::uint64_t ) > chunkFunction,
+                        const unsigned int numberOfThreads = 1 ) const;
+
+    //! Function to retrieve the size of each sample.
+    /*!
+     * Function to retrieve the size of each sample.
+     * \return Size of each sample.
+     */
+    int getNumberOfDimensions( ) const
+    {
+        return numberOfDimensions_;
+    }
+
+private:
+
+    //! Function to generate a set of consecutive samples in a single thread.
+    /*!
+     *  Function to generate a set of consecutive samples in a single thread.
+     *  \param firstSampleIndex Index of the first sample that is to be generated.
+     *  \param samples Matrix in which the samples are stored, one sample per column.
+     */
+    void generateSamplesInSingleThread( const std::uint64_t firstSampleIndex,
+                                        Eigen::Ref< Eigen::MatrixXd > samples ) const;
+
+    //! Function to map uniformly distributed values in (0,1) to the distributions of the entries of the samples.
+    /*!
+     *  Function to map uniformly distributed values in (0,1) to the distributions of the entries of the samples.
+     *  \param samples Matrix of uniformly distributed values, which are replaced by the mapped values.
+     */
+    void mapUniformSamplesToDistributions( Eigen::Ref< Eigen::MatrixXd > samples ) const;
+
+    //! Size of each sample.
+    int numberOfDimensions_;
+
+    //! Type of sequence from which the samples are generated.
+    RandomSampleSequenceType sequenceType_;
+
+    //! Seed of random number generator.
+    int seed_;
+
+    //! Number of samples generated by each independent substream.
+    int numberOfSamplesPerSubstream_;
+
+    //! Lower bounds of uniformly distributed entries (empty if distributions_ are used).
+    Eigen::VectorXd lowerBound_;
+
+    //! Widths of uniformly distributed entries (empty if distributions_ are used).
+    Eigen::VectorXd width_;
+
+    //! Probability distributions for the entries of the random vectors (empty if samples are uniformly distributed).
+    std::vector< std::shared_ptr< InvertibleContinuousProbabilityDistribution< double > > > distributions_;
+
+    //! Sobol sequence generator (nullptr for pseudo-random sequence).
+    std::shared_ptr< SobolSequence > sobolSequence_;
+};
+
+//! Generate matrix of random vectors, with entries of each vector independently uniformly distributed.
+/*!
+ *  Function to generate matrix of random vectors (one per column), with entries of each vector independently, but not
+ *  identically, uniformly distributed. See RandomSampleGenerator for details.
+ *  \param seed Seed of random number generator.
+ *  \param numberOfSamples Number of samples that are to be generated.
+ *  \param lowerBound Vector of lower bounds for the distributions for the entries of the random vectors.
+ *  \param upperBound Vector of upper bounds for the distributions for the entries of the random vectors.
+ *  \param numberOfThreads Number of threads over which the generation of the samples is distributed.
+ *  \return Matrix of samples, one sample per column.
+ */
+Eigen::MatrixXd generateUniformRandomSampleMatrix(
+        const int seed, const int numberOfSamples,
+        const Eigen::VectorXd& lowerBound, const Eigen::VectorXd& upperBound,
+        const unsigned int numberOfThreads = 1 );
+
+//! Generate matrix of random vectors, with entries of each vector independently Gaussian distributed.
+/*!
+ *  Function to generate matrix of random vectors (one per column), with entries of each vector independently, but not
+ *  identically, Gaussian distributed. See RandomSampleGenerator for details.
+ *  \param seed Seed of random number generator.
+ *  \param numberOfSamples Number of samples that are to be generated.
+ *  \param mean Vector of mean values for the distributions for the entries of the random vectors.
+ *  \param standardDeviation Vector of standard deviations for the distributions for the entries of the random vectors.
+ *  \param numberOfThreads Number of threads over which the generation of the samples is distributed.
+ *  \return Matrix of samples, one sample per column.
+ */
+Eigen::MatrixXd generateGaussianRandomSampleMatrix(
+        const int seed, const int numberOfSamples,
+        const Eigen::VectorXd& mean, const Eigen::VectorXd& standardDeviation,
+        const unsigned int numberOfThreads = 1 );
+
+//! Generate matrix of vectors, using a Sobol sequence.
+/*!
+ *  Function to generate matrix of vectors (one per column), using a Sobol sequence (without requiring GSL). See
+ *  RandomSampleGenerator for details.
+ *  \param numberOfSamples Number of samples that are to be generated.
+ *  \param lowerBound Vector of lower bounds for the entries of the samples.
+ *  \param upperBound Vector of upper bounds for the entries of the samples.
+ *  \param numberOfThreads Number of threads over which the generation of the samples is distributed.
+ *  \return Matrix of samples, one sample per column.
+ */
+Eigen::MatrixXd generateSobolSampleMatrix(
+        const int numberOfSamples,
+        const Eigen::VectorXd& lowerBound, const Eigen::VectorXd& upperBound,
+        const unsigned int numberOfThreads = 1 );
+
+} // namespace statistics
+
+} // namespace tudat
+
+#endif // TUDAT_RANDOM_SAMPLE_GENERATOR_H
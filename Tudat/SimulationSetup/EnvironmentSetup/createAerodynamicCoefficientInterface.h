@@ -16,6 +16,7 @@
 
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamicCoefficientInterface.h"
 #include "Tudat/Astrodynamics/Aerodynamics/customAerodynamicCoefficientInterface.h"
+#include "Tudat/InputOutput/binaryAerodynamicCoefficientTable.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createAerodynamicControlSurfaces.h"
 #include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/createInterpolator.h"
@@ -1151,6 +1152,83 @@ createTabulatedCoefficientAerodynamicCoefficientInterface(
                 areCoefficientsInAerodynamicFrame, areCoefficientsInNegativeAxisDirection );
 }
 
+//! Factory function for tabulated aerodynamic coefficient interface from memory-mapped binary coefficient tables.
+/*!
+ *  Factory function for tabulated aerodynamic coefficient interface from memory-mapped binary coefficient tables (see
+ *  input_output::MappedAerodynamicCoefficientTable). The coefficients are interpolated with multi-linear interpolators
+ *  operating directly on the mapped tables, so that the (potentially large) tables are not copied.
+ *  \param forceCoefficientTable Binary table of force coefficients.
+ *  \param momentCoefficientTable Binary table of moment coefficients (must have same independent variables as force
+ *  coefficient table).
+ *  \param independentVariableNames Vector with identifiers the physical meaning of each independent variable of the
+ *  aerodynamic coefficients.
+ *  \param referenceLength Reference length with which aerodynamic moments (about x- and z- axes) are non-dimensionalized.
+ *  \param referenceArea Reference area with which aerodynamic forces and moments are non-dimensionalized.
+ *  \param lateralReferenceLength Reference length with which aerodynamic moments (about y-axis) is non-dimensionalized.
+ *  \param momentReferencePoint Point w.r.t. aerodynamic moment is calculated
+ *  \param areCoefficientsInAerodynamicFrame Boolean to define whether the aerodynamic coefficients are defined in the
+ *  aerodynamic frame (drag, side, lift force) or in the body frame (typically denoted as Cx, Cy, Cz).
+ *  \param areCoefficientsInNegativeAxisDirection Boolean to define whether the aerodynamic coefficients are positive
+ *  along tyhe positive axes of the body or aerodynamic frame (see areCoefficientsInAerodynamicFrame).
+ *  \param lookupScheme Lookup scheme used by the interpolators.
+ *  \param boundaryHandling Boundary handling used by the interpolators.
+ *  \return Tabulated aerodynamic coefficient interface pointer.
+ */
+template< unsigned int NumberOfDimensions >
+std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface >
+createTabulatedCoefficientAerodynamicCoefficientInterface(
+        const std::shared_ptr< input_output::MappedAerodynamicCoefficientTable< NumberOfDimensions > >
+        forceCoefficientTable,
+        const std::shared_ptr< input_output::MappedAerodynamicCoefficientTable< NumberOfDimensions > >
+        momentCoefficientTable,
+        const std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables > independentVariableNames,
+        const double referenceLength,
+        const double referenceArea,
+        const double lateralReferenceLength,
+        const Eigen::Vector3d& momentReferencePoint,
+        const bool areCoefficientsInAerodynamicFrame = false,
+        const bool areCoefficientsInNegativeAxisDirection = true,
+        const interpolators::AvailableLookupScheme lookupScheme = interpolators::huntingAlgorithm,
+        const interpolators::BoundaryInterpolationType boundaryHandling = interpolators::use_boundary_value )
+{
+    using namespace tudat::interpolators;
+
+    // Check input consistency.
+    if( !input_output::compareIndependentVariables(
+                forceCoefficientTable->getIndependentVariables( ),
+                momentCoefficientTable->getIndependentVariables( ) ) )
+    {
+        throw std::runtime_error( "Error when creating tabulated aerodynamic coefficient interface from binary tables, "
+                                  "inconsistent independent variables" );
+    }
+
+    if( independentVariableNames.size( ) != NumberOfDimensions )
+    {
+        throw std::runtime_error( "Error when creating tabulated aerodynamic coefficient interface, "
+                                  "inconsistent variable name vector dimensioning" );
+    }
+
+    // Create interpolators for coefficients, operating on the mapped tables.
+    std::shared_ptr< MultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions > > forceInterpolator =
+            std::make_shared< MultiLinearInterpolator< double, Eigen::Vector3d, NumberOfDimensions > >(
+                forceCoefficientTable->getIndependentVariables( ), forceCoefficientTable->getCoefficients( ),
+                lookupScheme, std::vector< BoundaryInterpolationType >( NumberOfDimensions, boundaryHandling ) );
+    std::shared_ptr< MultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions > > momentInterpolator =
+            std::make_shared< MultiLinearInterpolator< double, Eigen::Vector3d, NumberOfDimensions > >(
+                momentCoefficientTable->getIndependentVariables( ), momentCoefficientTable->getCoefficients( ),
+                lookupScheme, std::vector< BoundaryInterpolationType >( NumberOfDimensions, boundaryHandling ) );
+
+    // Create aerodynamic coefficient interface.
+    return std::make_shared< aerodynamics::CustomAerodynamicCoefficientInterface >(
+                std::bind( &MultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
+                             forceInterpolator, std::placeholders::_1 ),
+                std::bind( &MultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
+                             momentInterpolator, std::placeholders::_1 ),
+                referenceLength, referenceArea, lateralReferenceLength, momentReferencePoint,
+                independentVariableNames,
+                areCoefficientsInAerodynamicFrame, areCoefficientsInNegativeAxisDirection );
+}
+
 //! Factory function for tabulated (1-D independent variables) aerodynamic coefficient interface from coefficient settings.
 /*!
  *  Factory function for tabulated (1-D independent variables) aerodynamic coefficient interface from coefficient settings.
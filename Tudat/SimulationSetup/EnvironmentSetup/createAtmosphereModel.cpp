@@ -12,6 +12,7 @@
 #include <boost/bind.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/exponentialAtmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/griddedAtmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/tabulatedAtmosphere.h"
 #if USE_NRLMSISE00
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
@@ -161,6 +162,23 @@ std::shared_ptr< aerodynamics::AtmosphereModel > createAtmosphereModel(
         }
         break;
     }
+    case gridded_atmosphere:
+    {
+        // Check whether settings for atmosphere are consistent with its type
+        std::shared_ptr< GriddedAtmosphereSettings > griddedAtmosphereSettings =
+                std::dynamic_pointer_cast< GriddedAtmosphereSettings >( atmosphereSettings );
+        if( griddedAtmosphereSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, expected gridded atmosphere settings for body " + body );
+        }
+        else
+        {
+            atmosphereModel = aerodynamics::readGriddedAtmosphereFromFile(
+                        griddedAtmosphereSettings->getGriddedAtmosphereFile( ),
+                        griddedAtmosphereSettings->getBoundaryHandling( ) );
+        }
+        break;
+    }
 #if USE_NRLMSISE00
     case nrlmsise00:
     {
@@ -182,11 +200,13 @@ std::shared_ptr< aerodynamics::AtmosphereModel > createAtmosphereModel(
         tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
                 tudat::input_output::solar_activity::readSolarActivityData( spaceWeatherFilePath ) ;
 
-        // Create atmosphere model using NRLMISE00 input function
+        // Create atmosphere model using NRLMISE00 input function, with time-dependent input computed once per epoch
+        std::shared_ptr< tudat::aerodynamics::NRLMSISE00TimeDependentInputCache > inputCache =
+                std::make_shared< tudat::aerodynamics::NRLMSISE00TimeDependentInputCache >(
+                    solarActivityData, false, TUDAT_NAN );
         std::function< tudat::aerodynamics::NRLMSISE00Input( double, double, double, double ) > inputFunction =
-                std::bind( &tudat::aerodynamics::nrlmsiseInputFunction,
-                           std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
-                           solarActivityData, false, TUDAT_NAN );
+                std::bind( &tudat::aerodynamics::NRLMSISE00TimeDependentInputCache::getInput, inputCache,
+                           std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4 );
         atmosphereModel = std::make_shared< aerodynamics::NRLMSISE00Atmosphere >( inputFunction );
         break;
     }
@@ -135,7 +135,8 @@ enum AtmosphereTypes
     exponential_atmosphere,
     custom_constant_temperature_atmosphere,
     tabulated_atmosphere,
-    nrlmsise00
+    nrlmsise00,
+    gridded_atmosphere
 };
 
 //! Class for providing settings for atmosphere model.
@@ -488,6 +489,51 @@ private:
     std::string spaceWeatherFile_;
 };
 
+//! AtmosphereSettings for defining an atmosphere from a precomputed grid, stored in a binary file.
+/*!
+ *  AtmosphereSettings for defining an atmosphere from a precomputed grid in altitude, latitude, local solar time and
+ *  epoch, stored in a binary file (see aerodynamics::GriddedAtmosphere and aerodynamics::writeGriddedAtmosphereToFile)
+ */
+class GriddedAtmosphereSettings: public AtmosphereSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param griddedAtmosphereFile Binary file containing the gridded atmosphere.
+     *  \param boundaryHandling Method for handling altitudes, latitudes and epochs outside of the grid (see
+     *  aerodynamics::GriddedAtmosphere constructor).
+     */
+    GriddedAtmosphereSettings( const std::string& griddedAtmosphereFile,
+                               const interpolators::BoundaryInterpolationType boundaryHandling =
+            interpolators::use_boundary_value ):
+        AtmosphereSettings( gridded_atmosphere ), griddedAtmosphereFile_( griddedAtmosphereFile ),
+        boundaryHandling_( boundaryHandling ){ }
+
+    //! Function to return binary file containing the gridded atmosphere.
+    /*!
+     *  Function to return binary file containing the gridded atmosphere.
+     *  \return Binary file containing the gridded atmosphere.
+     */
+    std::string getGriddedAtmosphereFile( ){ return griddedAtmosphereFile_; }
+
+    //! Function to return method for handling independent variables outside of the grid.
+    /*!
+     *  Function to return method for handling altitudes, latitudes and epochs outside of the grid.
+     *  \return Method for handling independent variables outside of the grid.
+     */
+    interpolators::BoundaryInterpolationType getBoundaryHandling( ){ return boundaryHandling_; }
+
+private:
+
+    //! Binary file containing the gridded atmosphere.
+    std::string griddedAtmosphereFile_;
+
+    //! Method for handling altitudes, latitudes and epochs outside of the grid.
+    interpolators::BoundaryInterpolationType boundaryHandling_;
+};
+
 
 //! AtmosphereSettings for defining an atmosphere with tabulated data from file.
 class TabulatedAtmosphereSettings: public AtmosphereSettings
@@ -8,6 +8,7 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <boost/filesystem.hpp>
 #include <boost/make_shared.hpp>
 
 #if USE_CSPICE
@@ -18,6 +19,7 @@
 #include "Tudat/Astrodynamics/Gravitation/triAxialEllipsoidGravity.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createGravityField.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/sphericalHarmonicsCoefficientCache.h"
 
 namespace tudat
 {
@@ -103,8 +105,8 @@ FromFileSphericalHarmonicsGravityFieldSettings::FromFileSphericalHarmonicsGravit
 }
 
 
-//! Function to read a gravity field file
-std::pair< double, double  > readGravityFieldFile(
+//! Function to read a gravity field text file, without using the binary coefficient cache
+std::pair< double, double  > readGravityFieldTextFile(
         const std::string& fileName, const int maximumDegree, const int maximumOrder,
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
         const int gravitationalParameterIndex, const int referenceRadiusIndex )
@@ -213,6 +215,62 @@ std::pair< double, double  > readGravityFieldFile(
     return std::make_pair( gravitationalParameter, referenceRadius );
 }
 
+//! Function to read a gravity field file
+std::pair< double, double  > readGravityFieldFile(
+        const std::string& fileName, const int maximumDegree, const int maximumOrder,
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex )
+{
+    // Retrieve coefficients from binary cache, if it exists for this file and settings. Any problem with the cache
+    // (e.g. unreadable source file, or corrupted cache file) is handled by reading the text file.
+    std::string cacheFilePath;
+    std::uint64_t gravityFieldFileHash = 0;
+    if( !input_output::getSphericalHarmonicsCoefficientCacheDirectory( ).empty( ) )
+    {
+        try
+        {
+            gravityFieldFileHash = input_output::computeFileContentHash( fileName );
+            cacheFilePath = input_output::getSphericalHarmonicsCoefficientCacheFilePath(
+                        fileName, gravityFieldFileHash, maximumDegree, maximumOrder,
+                        gravitationalParameterIndex, referenceRadiusIndex );
+            if( boost::filesystem::exists( cacheFilePath ) )
+            {
+                input_output::SphericalHarmonicsCoefficientCache coefficientCache( cacheFilePath );
+                if( coefficientCache.isCacheOf( gravityFieldFileHash, maximumDegree, maximumOrder,
+                                                gravitationalParameterIndex, referenceRadiusIndex ) )
+                {
+                    coefficients = std::make_pair( Eigen::MatrixXd( coefficientCache.getCosineCoefficients( ) ),
+                                                   Eigen::MatrixXd( coefficientCache.getSineCoefficients( ) ) );
+                    return std::make_pair( coefficientCache.getGravitationalParameter( ),
+                                           coefficientCache.getReferenceRadius( ) );
+                }
+            }
+        }
+        catch( std::exception& )
+        {
+            cacheFilePath.clear( );
+        }
+    }
+
+    std::pair< double, double > referenceData = readGravityFieldTextFile(
+                fileName, maximumDegree, maximumOrder, coefficients,
+                gravitationalParameterIndex, referenceRadiusIndex );
+
+    // Create cache for subsequent calls; failure to do so (e.g. for a read-only cache directory) is not an error.
+    if( !cacheFilePath.empty( ) )
+    {
+        try
+        {
+            input_output::writeSphericalHarmonicsCoefficientCache(
+                        cacheFilePath, gravityFieldFileHash, gravitationalParameterIndex, referenceRadiusIndex,
+                        referenceData.first, referenceData.second, coefficients.first, coefficients.second );
+        }
+        catch( std::exception& ) { }
+    }
+
+    return referenceData;
+}
+
 //! Function to create a gravity field model.
 std::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
         const std::shared_ptr< GravityFieldSettings > gravityFieldSettings,
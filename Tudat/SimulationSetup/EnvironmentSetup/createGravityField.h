@@ -396,6 +396,25 @@ std::shared_ptr< SphericalHarmonicsGravityFieldSettings > createHomogeneousTriAx
         const int maximumDegree, const int maximumOrder,
         const std::string& associatedReferenceFrame  );
 
+//! Function to read a spherical harmonic gravity field text file, without using the binary coefficient cache
+/*!
+ *  Function to read a spherical harmonic gravity field text file, returns (by reference) cosine and sine
+ *  spherical harmomic coefficients. The file is always parsed, see readGravityFieldFile for the file structure and
+ *  input parameters.
+ *  \param fileName Name of PDS gravity field file to be loaded.
+ *  \param maximumDegree Maximum degree of gravity field to be loaded.
+ *  \param maximumOrder Maximum order of gravity field to be loaded.
+ *  \param gravitationalParameterIndex
+ *  \param referenceRadiusIndex
+ *  \param coefficients Spherical harmonics coefficients (first is cosine, second is sine).
+ *  \return Pair of gravitational parameter and reference radius, values are non-NaN if
+ *  gravitationalParameterIndex and referenceRadiusIndex are >=0.
+ */
+std::pair< double, double > readGravityFieldTextFile(
+        const std::string& fileName, const int maximumDegree, const int maximumOrder,
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
+        const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1 );
+
 //! Function to read a spherical harmonic gravity field file
 /*!
  *  Function to read a spherical harmonic gravity field file, returns (by reference) cosine and sine
@@ -407,6 +426,13 @@ std::shared_ptr< SphericalHarmonicsGravityFieldSettings > createHomogeneousTriAx
  *  Degree, Order, Cosine Coefficient, Sine Coefficients
  *  Subsequent columns may be present in the file, but are ignored when parsing.
  *  All coefficients not defined in the file are set to zero (except C(0,0) which is always 1.0)
+ *  Since parsing a large text file is slow, the coefficients may be cached in a binary file (see
+ *  input_output::writeSphericalHarmonicsCoefficientCache). The cache is disabled by default, and is enabled by setting
+ *  a cache directory with input_output::setSphericalHarmonicsCoefficientCacheDirectory. The cache file is identified
+ *  by the hash of the contents of the gravity field file and the requested degree, order and header indices, and is
+ *  created automatically the first time a file is read with a given set of settings. Subsequent calls memory-map the
+ *  cache file, verify the checksum of its coefficients, and copy the coefficients from it, instead of parsing the text
+ *  file.
  *  \param fileName Name of PDS gravity field file to be loaded.
  *  \param maximumDegree Maximum degree of gravity field to be loaded.
  *  \param maximumOrder Maximum order of gravity field to be loaded.
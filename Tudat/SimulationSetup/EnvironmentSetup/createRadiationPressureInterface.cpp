@@ -11,6 +11,7 @@
 #include <boost/bind.hpp>
 
 #include "Tudat/SimulationSetup/EnvironmentSetup/createRadiationPressureInterface.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/oblateSpheroidBodyShapeModel.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/sphericalBodyShapeModel.h"
 #include "Tudat/Astrodynamics/ReferenceFrames/referenceFrameTransformations.h"
 
@@ -50,6 +51,49 @@ void getOccultingBodiesInformation(
     }
 }
 
+//! Function to obtain (by reference) the shape properties of (possibly oblate) occulting bodies
+void getOblateOccultingBodiesInformation(
+        const NamedBodyMap& bodyMap, const std::vector< std::string >& occultingBodies,
+        std::vector< double >& occultingBodyRadii,
+        std::vector< double >& occultingBodyFlattenings,
+        std::vector< std::function< Eigen::Vector3d( const double ) > >& occultingBodyPoleDirections )
+{
+    occultingBodyRadii.clear( );
+    occultingBodyFlattenings.clear( );
+    occultingBodyPoleDirections.clear( );
+
+    for( unsigned int i = 0; i < occultingBodies.size( ); i++ )
+    {
+        std::shared_ptr< Body > occultingBody = bodyMap.at( occultingBodies.at( i ) );
+        std::shared_ptr< basic_astrodynamics::OblateSpheroidBodyShapeModel > oblateShapeModel =
+                std::dynamic_pointer_cast< basic_astrodynamics::OblateSpheroidBodyShapeModel >(
+                    occultingBody->getShapeModel( ) );
+        std::shared_ptr< ephemerides::RotationalEphemeris > rotationModel = occultingBody->getRotationalEphemeris( );
+
+        if( oblateShapeModel != nullptr )
+        {
+            if( rotationModel == nullptr )
+            {
+                throw std::runtime_error( "Error, no rotation model for " + occultingBodies[ i ] +
+                                          " when making oblate occulting body settings" );
+            }
+            occultingBodyRadii.push_back( oblateShapeModel->getEquatorialRadius( ) );
+            occultingBodyFlattenings.push_back( oblateShapeModel->getFlattening( ) );
+            occultingBodyPoleDirections.push_back(
+                        [ = ]( const double currentTime )
+            {
+                return Eigen::Vector3d( rotationModel->getRotationToBaseFrame( currentTime ) * Eigen::Vector3d::UnitZ( ) );
+            } );
+        }
+        else
+        {
+            occultingBodyRadii.push_back( occultingBody->getShapeModel( )->getAverageRadius( ) );
+            occultingBodyFlattenings.push_back( 0.0 );
+            occultingBodyPoleDirections.push_back( [ ]( const double ){ return Eigen::Vector3d::UnitZ( ); } );
+        }
+    }
+}
+
 //! Function to create a radiation pressure interface.
 std::shared_ptr< electro_magnetism::RadiationPressureInterface > createRadiationPressureInterface(
         const std::shared_ptr< RadiationPressureInterfaceSettings > radiationPressureInterfaceSettings,
@@ -87,6 +131,18 @@ std::shared_ptr< electro_magnetism::RadiationPressureInterface > createRadiation
         getOccultingBodiesInformation(
                     bodyMap, occultingBodies, occultingBodyPositions, occultingBodyRadii );
 
+        // Retrieve (equatorial) radii, flattenings and pole directions if oblate occulting bodies are used.
+        const bool useOblateOccultingBodies =
+                cannonBallSettings->getUseOblateOccultingBodies( ) && ( occultingBodies.size( ) > 0 );
+        std::vector< double > occultingBodyFlattenings;
+        std::vector< std::function< Eigen::Vector3d( const double ) > > occultingBodyPoleDirections;
+        if( useOblateOccultingBodies )
+        {
+            getOblateOccultingBodiesInformation(
+                        bodyMap, occultingBodies, occultingBodyRadii, occultingBodyFlattenings,
+                        occultingBodyPoleDirections );
+        }
+
         // Retrive radius of source if occultations are used.
         double sourceRadius;
         if( occultingBodyPositions.size( ) > 0 )
@@ -134,6 +190,13 @@ std::shared_ptr< electro_magnetism::RadiationPressureInterface > createRadiation
                     cannonBallSettings->getRadiationPressureCoefficient( ),
                     cannonBallSettings->getArea( ), occultingBodyPositions, occultingBodyRadii,
                     sourceRadius );
+
+        // Set oblate occulting body shapes, if requested.
+        if( useOblateOccultingBodies )
+        {
+            radiationPressureInterface->setOblateOccultingBodies(
+                        occultingBodyFlattenings, occultingBodyPoleDirections );
+        }
         break;
 
     }
@@ -55,7 +55,7 @@ public:
             const std::string& sourceBody,
             const std::vector< std::string > occultingBodies = std::vector< std::string >( ) ):
         radiationPressureType_( radiationPressureType ), sourceBody_( sourceBody ),
-        occultingBodies_( occultingBodies ){  }
+        occultingBodies_( occultingBodies ), useOblateOccultingBodies_( false ){  }
 
     //! Destructor
     virtual ~RadiationPressureInterfaceSettings( ){ }
@@ -81,6 +81,25 @@ public:
      */
     std::vector< std::string > getOccultingBodies( ){ return occultingBodies_; }
 
+    //! Function to set whether occulting bodies with an oblate spheroid shape model are modelled as such.
+    /*!
+     *  Function to set whether occulting bodies with an oblate spheroid shape model are modelled as such when computing
+     *  the shadow function (using their equatorial radius, flattening and rotation model). If false (default), all
+     *  occulting bodies are modelled as spheres with the average radius of their shape model.
+     *  \param useOblateOccultingBodies Boolean denoting whether oblate occulting bodies are to be modelled as such.
+     */
+    void setUseOblateOccultingBodies( const bool useOblateOccultingBodies )
+    {
+        useOblateOccultingBodies_ = useOblateOccultingBodies;
+    }
+
+    //! Function returning whether occulting bodies with an oblate spheroid shape model are modelled as such.
+    /*!
+     *  Function returning whether occulting bodies with an oblate spheroid shape model are modelled as such.
+     *  \return Boolean denoting whether oblate occulting bodies are to be modelled as such.
+     */
+    bool getUseOblateOccultingBodies( ){ return useOblateOccultingBodies_; }
+
 protected:
 
     //! Type of radiation pressure interface that is to be made.
@@ -91,6 +110,9 @@ protected:
 
     //! List of bodies causing (partial) occultation
     std::vector< std::string > occultingBodies_;
+
+    //! Boolean denoting whether occulting bodies with an oblate spheroid shape model are modelled as such.
+    bool useOblateOccultingBodies_;
 };
 
 //! Class providing settings for the creation of a cannonball radiation pressure interface
@@ -157,6 +179,24 @@ void getOccultingBodiesInformation(
         std::vector< std::function< Eigen::Vector3d( ) > >& occultingBodyPositions,
         std::vector< double >& occultingBodyRadii );
 
+//! Function to obtain (by reference) the shape properties of (possibly oblate) occulting bodies
+/*!
+ * Function to obtain (by reference) the shape properties of (possibly oblate) occulting bodies. For bodies with an
+ * oblate spheroid shape model, the equatorial radius and flattening are returned, and the pole direction is obtained
+ * from the body's rotation model. Other bodies are modelled as spheres with their average radius.
+ * \param bodyMap List of body objects.
+ * \param occultingBodies List of bodies causing occultation.
+ * \param occultingBodyRadii List of (equatorial) radii of occulting bodies (return by reference output variable).
+ * \param occultingBodyFlattenings List of flattenings of occulting bodies (return by reference output variable).
+ * \param occultingBodyPoleDirections List of functions returning pole directions of occulting bodies as a function
+ * of time (return by reference output variable).
+ */
+void getOblateOccultingBodiesInformation(
+        const NamedBodyMap& bodyMap, const std::vector< std::string >& occultingBodies,
+        std::vector< double >& occultingBodyRadii,
+        std::vector< double >& occultingBodyFlattenings,
+        std::vector< std::function< Eigen::Vector3d( const double ) > >& occultingBodyPoleDirections );
+
 //! Function to create a radiation pressure interface.
 /*!
  *  Function to create a radiation pressure interface.
@@ -135,9 +135,23 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
             std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > earthOrientationCalculator =
                     std::make_shared< earth_orientation::EarthOrientationAnglesCalculator >(
                         polarMotionCalculator, precessionNutationCalculator, terrestrialTimeScaleConverter );
+
+            // Create object for on-demand tabulation of angles, if required
+            std::shared_ptr< earth_orientation::TabulatedEarthOrientationAnglesCalculator > tabulatedAnglesCalculator;
+            std::shared_ptr< EarthOrientationAnglesTabulationSettings > anglesTabulationSettings =
+                    gcrsToItrsRotationSettings->getAnglesTabulationSettings( );
+            if( anglesTabulationSettings != nullptr )
+            {
+                tabulatedAnglesCalculator = std::make_shared< earth_orientation::TabulatedEarthOrientationAnglesCalculator >(
+                            earthOrientationCalculator, gcrsToItrsRotationSettings->getInputTimeScale( ),
+                            anglesTabulationSettings->blockDuration_, anglesTabulationSettings->timeStep_,
+                            anglesTabulationSettings->numberOfInterpolationPoints_,
+                            anglesTabulationSettings->maximumNumberOfBlocks_ );
+            }
+
             rotationalEphemeris = std::make_shared< ephemerides::GcrsToItrsRotationModel >(
                         earthOrientationCalculator, gcrsToItrsRotationSettings->getInputTimeScale( ),
-                        gcrsToItrsRotationSettings->getOriginalFrame( ) );
+                        gcrsToItrsRotationSettings->getOriginalFrame( ), tabulatedAnglesCalculator );
 
             break;
         }
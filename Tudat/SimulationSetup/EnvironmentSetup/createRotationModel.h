@@ -205,6 +205,42 @@ struct EopCorrectionSettings
     std::vector< std::string > argumentMultipliersFile_;
 };
 
+//! Struct that holds settings for on-demand tabulation of Earth orientation angles
+/*!
+ *  Struct that holds settings for on-demand tabulation of Earth orientation angles, see
+ *  TabulatedEarthOrientationAnglesCalculator for details. Default settings provide angles to better than 1.0E-11 rad.
+ */
+struct EarthOrientationAnglesTabulationSettings
+{
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param blockDuration Duration of single block of tabulated values.
+     *  \param timeStep Time step between tabulated values.
+     *  \param numberOfInterpolationPoints Number of points used in Lagrange interpolation (must be even)
+     *  \param maximumNumberOfBlocks Maximum number of blocks that is retained in memory.
+     */
+    EarthOrientationAnglesTabulationSettings(
+            const double blockDuration = physical_constants::JULIAN_DAY,
+            const double timeStep = 3600.0,
+            const int numberOfInterpolationPoints = 8,
+            const unsigned int maximumNumberOfBlocks = 8 ):
+        blockDuration_( blockDuration ), timeStep_( timeStep ),
+        numberOfInterpolationPoints_( numberOfInterpolationPoints ), maximumNumberOfBlocks_( maximumNumberOfBlocks ){ }
+
+    //! Duration of single block of tabulated values.
+    double blockDuration_;
+
+    //! Time step between tabulated values.
+    double timeStep_;
+
+    //! Number of points used in Lagrange interpolation
+    int numberOfInterpolationPoints_;
+
+    //! Maximum number of blocks that is retained in memory.
+    unsigned int maximumNumberOfBlocks_;
+};
+
 //! Settings for creating a GCRS<->ITRS rotation model
 class GcrsToItrsRotationModelSettings: public RotationModelSettings
 {
@@ -219,6 +255,8 @@ public:
      * \param eopFileFormat Identifier for file format that is provided
      * \param ut1CorrectionSettings Settings for short-period UT1-UTC variations
      * \param polarMotionCorrectionSettings Settings for short-period polar motion variations
+     * \param anglesTabulationSettings Settings for on-demand tabulation of Earth orientation angles (if nullptr, angles
+     * are computed directly at each evaluation)
      */
     GcrsToItrsRotationModelSettings(
             const basic_astrodynamics::IAUConventions nutationTheory = basic_astrodynamics::iau_2006,
@@ -246,11 +284,13 @@ public:
                     input_output::getEarthOrientationDataFilesPath( ) +
                     "polarMotionLibrationFundamentalArgumentMultipliersQuasiDiurnalOnly.txt",
                     input_output::getEarthOrientationDataFilesPath( ) +
-                    "polarMotionOceanTidesFundamentalArgumentMultipliers.txt" } ) ):
+                    "polarMotionOceanTidesFundamentalArgumentMultipliers.txt" } ),
+            const std::shared_ptr< EarthOrientationAnglesTabulationSettings > anglesTabulationSettings = nullptr ):
         RotationModelSettings( gcrs_to_itrs_rotation_model, baseFrameName, "ITRS" ),
         inputTimeScale_( inputTimeScale ), nutationTheory_( nutationTheory ), eopFile_( eopFile ),
         eopFileFormat_( "C04" ), ut1CorrectionSettings_( ut1CorrectionSettings ),
-        polarMotionCorrectionSettings_( polarMotionCorrectionSettings ){ }
+        polarMotionCorrectionSettings_( polarMotionCorrectionSettings ),
+        anglesTabulationSettings_( anglesTabulationSettings ){ }
 
     //! Destructor
     ~GcrsToItrsRotationModelSettings( ){ }
@@ -314,6 +354,28 @@ public:
         return polarMotionCorrectionSettings_;
     }
 
+    //! Function to retrieve the settings for on-demand tabulation of Earth orientation angles
+    /*!
+     * Function to retrieve the settings for on-demand tabulation of Earth orientation angles
+     * \return Settings for on-demand tabulation of Earth orientation angles (nullptr if no tabulation is used)
+     */
+    std::shared_ptr< EarthOrientationAnglesTabulationSettings > getAnglesTabulationSettings( )
+    {
+        return anglesTabulationSettings_;
+    }
+
+    //! Function to reset the settings for on-demand tabulation of Earth orientation angles
+    /*!
+     * Function to reset the settings for on-demand tabulation of Earth orientation angles
+     * \param anglesTabulationSettings Settings for on-demand tabulation of Earth orientation angles (nullptr if no
+     * tabulation is to be used)
+     */
+    void setAnglesTabulationSettings(
+            const std::shared_ptr< EarthOrientationAnglesTabulationSettings > anglesTabulationSettings )
+    {
+        anglesTabulationSettings_ = anglesTabulationSettings;
+    }
+
 private:
 
     //! Time scale in which input to the rotation model class is provided
@@ -334,6 +396,9 @@ private:
     //! Settings for short-period polar motion variations
     std::shared_ptr< EopCorrectionSettings > polarMotionCorrectionSettings_;
 
+    //! Settings for on-demand tabulation of Earth orientation angles (nullptr if no tabulation is used)
+    std::shared_ptr< EarthOrientationAnglesTabulationSettings > anglesTabulationSettings_;
+
 };
 #endif
 
@@ -1372,6 +1372,51 @@ SelectedAccelerationList orderSelectedAccelerationMap( const SelectedAcceleratio
 }
 
 
+//! Function to let third-body point-mass accelerations with the same central and perturbing body share a single
+//! model for the acceleration of the central body.
+void shareThirdBodyCentralBodyAccelerationModels( basic_astrodynamics::AccelerationMap& accelerationModelMap )
+{
+    // Models for acceleration of central body, with central body name and perturbing body name as key.
+    std::map< std::pair< std::string, std::string >, std::shared_ptr< CentralGravitationalAccelerationModel3d > >
+            centralBodyAccelerationModels;
+
+    for( basic_astrodynamics::AccelerationMap::iterator bodyIterator = accelerationModelMap.begin( );
+         bodyIterator != accelerationModelMap.end( ); bodyIterator++ )
+    {
+        for( basic_astrodynamics::SingleBodyAccelerationMap::iterator exertingBodyIterator =
+             bodyIterator->second.begin( ); exertingBodyIterator != bodyIterator->second.end( );
+             exertingBodyIterator++ )
+        {
+            for( unsigned int i = 0; i < exertingBodyIterator->second.size( ); i++ )
+            {
+                std::shared_ptr< ThirdBodyCentralGravityAcceleration > thirdBodyAcceleration =
+                        std::dynamic_pointer_cast< ThirdBodyCentralGravityAcceleration >(
+                            exertingBodyIterator->second.at( i ) );
+                if( thirdBodyAcceleration == nullptr )
+                {
+                    continue;
+                }
+
+                // Store central body model if it is the first for this combination, replace acceleration otherwise.
+                std::pair< std::string, std::string > centralBodyModelKey =
+                        std::make_pair( thirdBodyAcceleration->getCentralBodyName( ), exertingBodyIterator->first );
+                if( centralBodyAccelerationModels.count( centralBodyModelKey ) == 0 )
+                {
+                    centralBodyAccelerationModels[ centralBodyModelKey ] =
+                            thirdBodyAcceleration->getAccelerationModelForCentralBody( );
+                }
+                else
+                {
+                    exertingBodyIterator->second[ i ] = std::make_shared< ThirdBodyCentralGravityAcceleration >(
+                                thirdBodyAcceleration->getAccelerationModelForBodyUndergoingAcceleration( ),
+                                centralBodyAccelerationModels.at( centralBodyModelKey ),
+                                thirdBodyAcceleration->getCentralBodyName( ) );
+                }
+            }
+        }
+    }
+}
+
 //! Function to create a set of acceleration models from a map of bodies and acceleration model types.
 basic_astrodynamics::AccelerationMap createAccelerationModelsMap(
         const NamedBodyMap& bodyMap,
@@ -1494,6 +1539,8 @@ basic_astrodynamics::AccelerationMap createAccelerationModelsMap(
         accelerationModelMap[ bodyUndergoingAcceleration ] = mapOfAccelerationsForBody;
     }
 
+    shareThirdBodyCentralBodyAccelerationModels( accelerationModelMap );
+
     return accelerationModelMap;
 }
 
@@ -416,6 +416,19 @@ createAccelerationModel(
  */
 SelectedAccelerationList orderSelectedAccelerationMap( const SelectedAccelerationMap& selectedAccelerationPerBody );
 
+//! Function to let third-body point-mass accelerations with the same central and perturbing body share a single
+//! model for the acceleration of the central body.
+/*!
+ * Function to let third-body point-mass accelerations (ThirdBodyCentralGravityAcceleration) with the same central and
+ * perturbing body share a single model for the acceleration of the central body due to the perturbing body. Since
+ * this model caches its acceleration per time, the central body term (e.g. the acceleration of the Earth due to the
+ * Sun and Moon) is then computed only once per state derivative evaluation, instead of once for each propagated body
+ * (e.g. each satellite of a constellation). The third-body acceleration models for which this applies are replaced
+ * in the input map by new objects, which use the same model for the direct acceleration of the perturbing body.
+ * \param accelerationModelMap List of acceleration model objects, modified by this function.
+ */
+void shareThirdBodyCentralBodyAccelerationModels( basic_astrodynamics::AccelerationMap& accelerationModelMap );
+
 //! Function to create acceleration models from a map of bodies and acceleration model types.
 /*!
  *  Function to create acceleration models from a map of bodies and acceleration model types.
@@ -425,7 +438,8 @@ SelectedAccelerationList orderSelectedAccelerationMap( const SelectedAcceleratio
  *  \param selectedAccelerationPerBody List identifying which bodies exert which type of
  *  acceleration(s) on which bodies.
  *  \param centralBodies Map of central bodies for each body undergoing acceleration.
- *  \return List of acceleration model objects, in form of AccelerationMap.
+ *  \return List of acceleration model objects, in form of AccelerationMap. Third-body point-mass accelerations w.r.t.
+ *  the same central body share their central body term (see shareThirdBodyCentralBodyAccelerationModels).
  */
 basic_astrodynamics::AccelerationMap createAccelerationModelsMap(
         const NamedBodyMap& bodyMap,
@@ -16,6 +16,7 @@
 #include "Tudat/Astrodynamics/Gravitation/unitConversionsCircularRestrictedThreeBodyProblem.h"
 #include "Tudat/Mathematics/Interpolators/createInterpolator.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/celestialBodyConstants.h"
+#include "Tudat/Basics/parallelExecution.h"
 
 namespace tudat
 {
@@ -92,6 +93,116 @@ std::map< double, Eigen::Vector6d > performCR3BPIntegration(
 
 }
 
+//! Function to integrate a state from the current time of an integrator up to a given final time.
+/*!
+ *  Function to integrate a state from the current time of an integrator up to a given final time, saving the state after
+ *  each step.
+ * \param integrator Numerical integrator, set to the initial time and state.
+ * \param initialTimeStep Initial time step (negative for backward integration).
+ * \param finalTime End time for the numerical integration
+ * \param propagateToExactFinalTime Boolean denoting whether the last step is shortened to end exactly at finalTime
+ * \return Propagated state history.
+ */
+static std::map< double, Eigen::MatrixXd > integrateConstellationStateToFinalTime(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::MatrixXd > > integrator,
+        const double initialTimeStep,
+        const double finalTime,
+        const bool propagateToExactFinalTime )
+{
+    std::map< double, Eigen::MatrixXd > stateHistory;
+
+    double currentTime = integrator->getCurrentIndependentVariable( );
+    stateHistory[ currentTime ] = integrator->getCurrentState( );
+
+    if( !( initialTimeStep * ( finalTime - currentTime ) > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when propagating constellation, initial time step is not in the direction of the "
+                                  "final time." );
+    }
+
+    double timeStep = initialTimeStep;
+    while( ( finalTime - currentTime ) * initialTimeStep > 0.0 )
+    {
+        // Shorten step to end at final time, if required.
+        if( propagateToExactFinalTime && ( currentTime + timeStep - finalTime ) * initialTimeStep > 0.0 )
+        {
+            timeStep = finalTime - currentTime;
+        }
+
+        Eigen::MatrixXd currentState = integrator->performIntegrationStep( timeStep );
+        currentTime = integrator->getCurrentIndependentVariable( );
+        timeStep = integrator->getNextStepSize( );
+        stateHistory[ currentTime ] = currentState;
+    }
+
+    return stateHistory;
+}
+
+//! Function to propagate a constellation of satellites, using a single step size for all satellites.
+std::map< double, Eigen::MatrixXd > performConstellationIntegration(
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+        const std::shared_ptr< ConstellationStateDerivative > stateDerivativeModel,
+        const Eigen::MatrixXd& initialStates,
+        const double finalTime,
+        const bool propagateToExactFinalTime )
+{
+    std::function< Eigen::MatrixXd( const double, const Eigen::MatrixXd& ) > stateDerivativeFunction =
+            std::bind( &ConstellationStateDerivative::computeStateDerivative, stateDerivativeModel,
+                       std::placeholders::_1, std::placeholders::_2 );
+
+    return integrateConstellationStateToFinalTime(
+                numerical_integrators::createIntegrator< double, Eigen::MatrixXd >(
+                    stateDerivativeFunction, initialStates, integratorSettings ),
+                integratorSettings->initialTimeStep_, finalTime, propagateToExactFinalTime );
+}
+
+//! Function to propagate a constellation of satellites, using a separate step size for each satellite.
+std::vector< std::map< double, Eigen::Vector6d > > performConstellationIntegrationPerSatellite(
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+        const std::shared_ptr< ConstellationStateDerivative > stateDerivativeModel,
+        const Eigen::MatrixXd& initialStates,
+        const double finalTime,
+        const bool propagateToExactFinalTime )
+{
+    if( initialStates.rows( ) != stateDerivativeModel->getNumberOfSatellites( ) || initialStates.cols( ) != 6 )
+    {
+        throw std::runtime_error( "Error when propagating constellation, initial states have incorrect size." );
+    }
+
+    // Create integrator per satellite (in calling thread, as integrator creation is not thread-safe).
+    std::vector< std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::MatrixXd > > > integrators;
+    for( int i = 0; i < initialStates.rows( ); i++ )
+    {
+        std::function< Eigen::MatrixXd( const double, const Eigen::MatrixXd& ) > stateDerivativeFunction =
+                std::bind( &ConstellationStateDerivative::computeSatelliteStateDerivative, stateDerivativeModel,
+                           std::placeholders::_1, std::placeholders::_2, i );
+        integrators.push_back( numerical_integrators::createIntegrator< double, Eigen::MatrixXd >(
+                                   stateDerivativeFunction, Eigen::MatrixXd( initialStates.row( i ) ),
+                                   integratorSettings ) );
+    }
+
+    // Propagate satellites independently, distributed over the threads of the state derivative model (which are
+    // otherwise idle, as computeSatelliteStateDerivative does not use them).
+    std::vector< std::map< double, Eigen::Vector6d > > stateHistories( initialStates.rows( ) );
+    stateDerivativeModel->getParallelForLoopExecutor( )->executeParallelForLoop(
+                static_cast< unsigned int >( initialStates.rows( ) ),
+                [ & ]( const unsigned int satelliteIndex, const unsigned int )
+    {
+        std::map< double, Eigen::MatrixXd > satelliteStateHistory = integrateConstellationStateToFinalTime(
+                    integrators.at( satelliteIndex ), integratorSettings->initialTimeStep_, finalTime,
+                    propagateToExactFinalTime );
+        integrators[ satelliteIndex ] = nullptr;
+
+        for( std::map< double, Eigen::MatrixXd >::const_iterator stateIterator = satelliteStateHistory.begin( );
+             stateIterator != satelliteStateHistory.end( ); stateIterator++ )
+        {
+            stateHistories[ satelliteIndex ][ stateIterator->first ] = stateIterator->second.row( 0 ).transpose( );
+        }
+    } );
+
+    return stateHistories;
+}
+
 
 template std::vector< std::shared_ptr< SingleStateTypeDerivative< double, double > > > createStateDerivativeModels< double, double >(
         const std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings,
@@ -32,6 +32,7 @@
 #include "Tudat/Astrodynamics/Propagators/bodyMassStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/customStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/stateDerivativeCircularRestrictedThreeBodyProblem.h"
+#include "Tudat/Astrodynamics/Propagators/constellationStateDerivative.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 
@@ -696,6 +697,48 @@ std::map< double, Eigen::Vector6d > performCR3BPIntegration(
         const double finalTime,
         const bool propagateToExactFinalTime = false );
 
+//! Function to propagate a constellation of satellites, using a single step size for all satellites.
+/*!
+ *  Function to propagate a constellation of mutually non-interacting satellites, with the state of the full
+ *  constellation (in structure-of-arrays form, see ConstellationStateDerivative) integrated as a single state, so that
+ *  all satellites use the same (fixed or adaptive) step size. Each state derivative evaluation computes the
+ *  accelerations of all satellites in a single vectorized (and, if requested, multi-threaded) pass. For adaptive
+ *  integrators, the step size is limited by the satellite with the most demanding dynamics.
+ * \param integratorSettings Settings for the numerical integration
+ * \param stateDerivativeModel Model for the state derivative of the constellation
+ * \param initialStates Initial states of the satellites (one row per satellite, columns x, y, z, vx, vy, vz)
+ * \param finalTime End time for the numerical integration
+ * \param propagateToExactFinalTime Boolean denoting whether the last step is shortened to end exactly at finalTime
+ * \return Propagated state history of constellation (one row per satellite in each state).
+ */
+std::map< double, Eigen::MatrixXd > performConstellationIntegration(
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+        const std::shared_ptr< ConstellationStateDerivative > stateDerivativeModel,
+        const Eigen::MatrixXd& initialStates,
+        const double finalTime,
+        const bool propagateToExactFinalTime = true );
+
+//! Function to propagate a constellation of satellites, using a separate step size for each satellite.
+/*!
+ *  Function to propagate a constellation of mutually non-interacting satellites, with each satellite integrated
+ *  separately, so that an adaptive integrator controls the step size of each satellite independently (e.g. a shorter
+ *  step for satellites in low or eccentric orbits). The satellites are distributed over the number of threads of the
+ *  state derivative model. The Sun and third-body position functions of the state derivative model are called by one
+ *  thread at a time.
+ * \param integratorSettings Settings for the numerical integration
+ * \param stateDerivativeModel Model for the state derivative of the constellation
+ * \param initialStates Initial states of the satellites (one row per satellite, columns x, y, z, vx, vy, vz)
+ * \param finalTime End time for the numerical integration
+ * \param propagateToExactFinalTime Boolean denoting whether the last step is shortened to end exactly at finalTime
+ * \return Propagated state history per satellite, in the order of the rows of initialStates.
+ */
+std::vector< std::map< double, Eigen::Vector6d > > performConstellationIntegrationPerSatellite(
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+        const std::shared_ptr< ConstellationStateDerivative > stateDerivativeModel,
+        const Eigen::MatrixXd& initialStates,
+        const double finalTime,
+        const bool propagateToExactFinalTime = true );
+
 
 } // namespace propagators
 
@@ -511,6 +511,7 @@ public:
         dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
         dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
         dynamicsStateDerivative_->resetCumulativeFunctionEvaluationCounter( );
+        environmentUpdater_->resetCurrentTime( );
 
         // Reset initial time to ensure consistency with multi-arc propagation.
         integratorSettings_->initialTime_ = this->initialPropagationTime_;
@@ -528,7 +529,8 @@ public:
                     dependentVariablesFunctions_,
                     statePostProcessingFunction_,
                     propagatorSettings_->getPrintInterval( ),
-                    initialClockTime_ );
+                    initialClockTime_,
+                    integrationEventHandler_ );
 
         // Convert numerical solution to conventional state
         dynamicsStateDerivative_->convertNumericalStateSolutionsToOutputSolutions(
@@ -758,7 +760,36 @@ public:
      */
     virtual bool integrationCompletedSuccessfully( ) const
     {
-        return ( propagationTerminationReason_->getPropagationTerminationReason( ) == termination_condition_reached );
+        return ( propagationTerminationReason_->getPropagationTerminationReason( ) == termination_condition_reached ) ||
+                ( propagationTerminationReason_->getPropagationTerminationReason( ) == integration_event_reached );
+    }
+
+    //! Function to set the events that are to be monitored during the numerical integration
+    /*!
+     * Function to set the events that are to be monitored during the numerical integration (see IntegrationEvent). The
+     * event functions are evaluated using the state in the propagated coordinates (i.e. as in
+     * getEquationsOfMotionNumericalSolutionRaw). To use the events in the propagation, the simulator should be created
+     * without integrating the equations of motion, and integrateEquationsOfMotion called after calling this function.
+     * \param integrationEvents List of events that are to be monitored during the numerical integration.
+     */
+    void setIntegrationEvents(
+            const std::vector< std::shared_ptr< IntegrationEvent<
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType > > >& integrationEvents )
+    {
+        integrationEventHandler_ = std::make_shared< IntegrationEventHandler<
+                Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType > >( integrationEvents );
+    }
+
+    //! Function to retrieve the object detecting and processing the integration events.
+    /*!
+     * Function to retrieve the object detecting and processing the integration events, from which the events detected
+     * during the last propagation can be retrieved.
+     * \return Object detecting and processing the integration events (nullptr if none set).
+     */
+    std::shared_ptr< IntegrationEventHandler< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType > >
+    getIntegrationEventHandler( )
+    {
+        return integrationEventHandler_;
     }
 
     //! Function to retrieve the dependent variables IDs
@@ -935,6 +966,10 @@ protected:
     //! Event that triggered the termination of the propagation
     std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason_;
 
+    //! Object detecting and processing the integration events (nullptr if none set).
+    std::shared_ptr< IntegrationEventHandler< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType > >
+    integrationEventHandler_;
+
 };
 
 //! Function to get a vector of initial states from a vector of propagator settings
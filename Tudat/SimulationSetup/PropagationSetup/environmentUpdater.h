@@ -11,6 +11,7 @@
 #ifndef TUDAT_ENVIRONMENTUPDATER_H
 #define TUDAT_ENVIRONMENTUPDATER_H
 
+#include <chrono>
 #include <vector>
 #include <string>
 #include <map>
@@ -32,12 +33,52 @@ namespace tudat
 namespace propagators
 {
 
+//! Structure holding the dependency type and evaluation statistics of a single environment update function.
+struct EnvironmentUpdateStatistics
+{
+    //! Constructor
+    /*!
+     * Constructor
+     * \param updateType Type of environment model that is updated.
+     * \param bodyName Name of body for which the environment model is updated.
+     * \param isTimeOnlyUpdate Boolean denoting whether the environment model depends only on time (and not on the
+     * integrated states).
+     */
+    EnvironmentUpdateStatistics( const EnvironmentModelsToUpdate updateType,
+                                 const std::string& bodyName,
+                                 const bool isTimeOnlyUpdate ):
+        updateType_( updateType ), bodyName_( bodyName ), isTimeOnlyUpdate_( isTimeOnlyUpdate ),
+        numberOfEvaluations_( 0 ), numberOfSkippedEvaluations_( 0 ), totalEvaluationTime_( 0.0 ){ }
+
+    //! Type of environment model that is updated.
+    EnvironmentModelsToUpdate updateType_;
+
+    //! Name of body for which the environment model is updated.
+    std::string bodyName_;
+
+    //! Boolean denoting whether the environment model depends only on time (and not on the integrated states).
+    bool isTimeOnlyUpdate_;
+
+    //! Number of times the update function was evaluated.
+    unsigned int numberOfEvaluations_;
+
+    //! Number of times the update function was skipped, as the environment model was already up to date.
+    unsigned int numberOfSkippedEvaluations_;
+
+    //! Total wall-clock time (in seconds) spent evaluating the update function (only computed if timing is active).
+    double totalEvaluationTime_;
+};
+
 //! Class used to update the environment during numerical integration.
 /*!
  *  Class used to update the environment during numerical integration. The class ensures that the
  *  current state of the numerical integration is properly set, and that all the environment models
  *  that are used during the numerical integration are updated to the current time and state in the
- *  correct order.
+ *  correct order. Each environment model update is classified as either depending only on time (e.g. the state of a
+ *  body from its ephemeris, or its orientation from its rotational ephemeris), or as depending on the integrated states
+ *  (e.g. flight conditions and radiation pressure interfaces). When the environment is updated several times at the
+ *  same time (e.g. in subsequent stages of a Runge-Kutta integrator that share a node) only the state-dependent models
+ *  are re-evaluated.
  */
 template< typename StateScalarType, typename TimeType >
 class EnvironmentUpdater
@@ -103,9 +144,16 @@ public:
                                       std::to_string( integratedStates_.size( ) ) );
         }
 
+        // Check if time-only environment models are still up to date.
+        const bool skipTimeOnlyUpdates =
+                skipUnchangedTimeOnlyUpdates_ && timeOnlyUpdatesAreCurrent_ && ( currentTime == timeOfLastUpdate_ );
+
         for( unsigned int i = 0; i < resetFunctionVector_.size( ); i++ )
         {
-            resetFunctionVector_.at( i ).template get< 2 >( )( );
+            if( !( skipTimeOnlyUpdates && isResetFunctionTimeOnly_.at( i ) ) )
+            {
+                resetFunctionVector_.at( i ).template get< 2 >( )( );
+            }
         }
 
         // Set integrated state variables in environment.
@@ -118,12 +166,116 @@ public:
         // determined by setUpdateFunctions
         for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
         {
-            updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+            EnvironmentUpdateStatistics& currentStatistics = updateStatistics_[ i ];
+            if( skipTimeOnlyUpdates && currentStatistics.isTimeOnlyUpdate_ )
+            {
+                currentStatistics.numberOfSkippedEvaluations_++;
+            }
+            else if( updateTimingIsActive_ )
+            {
+                std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+                updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+                currentStatistics.totalEvaluationTime_ += std::chrono::duration< double >(
+                            std::chrono::steady_clock::now( ) - startTime ).count( );
+                currentStatistics.numberOfEvaluations_++;
+            }
+            else
+            {
+                updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+                currentStatistics.numberOfEvaluations_++;
+            }
+        }
+
+        timeOfLastUpdate_ = currentTime;
+        timeOnlyUpdatesAreCurrent_ = true;
+    }
+
+    //! Function to force re-evaluation of all environment models on the next call to updateEnvironment.
+    /*!
+     * Function to force re-evaluation of all environment models on the next call to updateEnvironment, including those
+     * that depend only on time. This function must be called when the environment models are modified between two calls
+     * to updateEnvironment (e.g. when starting a new propagation after resetting estimated parameters).
+     */
+    void resetCurrentTime( )
+    {
+        timeOnlyUpdatesAreCurrent_ = false;
+    }
+
+    //! Function to set whether time-only environment updates are skipped when the time is unchanged.
+    /*!
+     * Function to set whether time-only environment updates are skipped when the time is unchanged (true by default).
+     * \param skipUnchangedTimeOnlyUpdates Boolean denoting whether time-only environment updates are skipped when the
+     * time is unchanged w.r.t. the previous call to updateEnvironment.
+     */
+    void setSkipUnchangedTimeOnlyUpdates( const bool skipUnchangedTimeOnlyUpdates )
+    {
+        skipUnchangedTimeOnlyUpdates_ = skipUnchangedTimeOnlyUpdates;
+    }
+
+    //! Function to set whether the wall-clock time spent in each environment update function is measured.
+    /*!
+     * Function to set whether the wall-clock time spent in each environment update function is measured (false by
+     * default, as timing adds a small overhead to each update).
+     * \param updateTimingIsActive Boolean denoting whether the time spent in each update function is measured.
+     */
+    void setUpdateTimingActive( const bool updateTimingIsActive )
+    {
+        updateTimingIsActive_ = updateTimingIsActive;
+    }
+
+    //! Function to retrieve the dependency type and evaluation statistics of all environment update functions.
+    /*!
+     * Function to retrieve the dependency type and evaluation statistics of all environment update functions, in the
+     * order in which they are evaluated.
+     * \return Dependency type and evaluation statistics of all environment update functions.
+     */
+    const std::vector< EnvironmentUpdateStatistics >& getUpdateStatistics( ) const
+    {
+        return updateStatistics_;
+    }
+
+    //! Function to reset the evaluation statistics of all environment update functions to zero.
+    void resetUpdateStatistics( )
+    {
+        for( unsigned int i = 0; i < updateStatistics_.size( ); i++ )
+        {
+            updateStatistics_[ i ].numberOfEvaluations_ = 0;
+            updateStatistics_[ i ].numberOfSkippedEvaluations_ = 0;
+            updateStatistics_[ i ].totalEvaluationTime_ = 0.0;
         }
     }
 
 private:
 
+    //! Function to determine whether an environment model update depends only on time.
+    /*!
+     * Function to determine whether an environment model update depends only on time, or (possibly) also on the
+     * integrated states. Updates of translational states of non-integrated bodies, orientations from rotational
+     * ephemerides and masses from mass functions depend only on time. Spherical harmonic gravity field variations may
+     * depend on the current states of the deforming bodies, and are only considered to depend on time only if no
+     * translational or rotational states are integrated.
+     * \param updateType Type of environment model that is updated.
+     * \param bodyName Name of body for which the environment model is updated.
+     * \return True if the environment model update depends only on time.
+     */
+    bool isEnvironmentUpdateTimeOnly( const EnvironmentModelsToUpdate updateType, const std::string& bodyName )
+    {
+        switch( updateType )
+        {
+        case body_translational_state_update:
+            return true;
+        case body_rotational_state_update:
+            return ( bodyList_.at( bodyName )->getRotationalEphemeris( ) != nullptr );
+        case body_mass_update:
+            return true;
+        case spherical_harmonic_gravity_field_update:
+            return ( integratedStates_.count( translational_state ) == 0 &&
+                     integratedStates_.count( rotational_state ) == 0 );
+        default:
+            return false;
+        }
+    }
+
     //! Function to set numerically integrated states in environment.
     /*!
      * Function to set numerically integrated states in environment.  Note that these states must
@@ -657,6 +809,24 @@ private:
 
         // Set update order of functions.
         setUpdateFunctionOrder( );
+
+        // Set dependency type of update and reset functions.
+        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        {
+            updateStatistics_.push_back(
+                        EnvironmentUpdateStatistics(
+                            updateFunctionVector_.at( i ).template get< 0 >( ),
+                            updateFunctionVector_.at( i ).template get< 1 >( ),
+                            isEnvironmentUpdateTimeOnly( updateFunctionVector_.at( i ).template get< 0 >( ),
+                                                         updateFunctionVector_.at( i ).template get< 1 >( ) ) ) );
+        }
+
+        for( unsigned int i = 0; i < resetFunctionVector_.size( ); i++ )
+        {
+            isResetFunctionTimeOnly_.push_back(
+                        isEnvironmentUpdateTimeOnly( resetFunctionVector_.at( i ).template get< 0 >( ),
+                                                     resetFunctionVector_.at( i ).template get< 1 >( ) ) );
+        }
     }
 
     //! List of body objects, this list encompasses all environment object in the simulation.
@@ -682,8 +852,23 @@ private:
     //! time step).
     std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, std::function< void( ) > > > resetFunctionVector_;
 
+    //! Dependency type and evaluation statistics of each entry in updateFunctionVector_.
+    std::vector< EnvironmentUpdateStatistics > updateStatistics_;
+
+    //! List of booleans denoting whether each entry in resetFunctionVector_ belongs to a time-only environment model.
+    std::vector< bool > isResetFunctionTimeOnly_;
+
+    //! Time of last call to updateEnvironment.
+    TimeType timeOfLastUpdate_ = TimeType( 0.0 );
+
+    //! Boolean denoting whether time-only environment models have been updated to timeOfLastUpdate_
+    bool timeOnlyUpdatesAreCurrent_ = false;
 
+    //! Boolean denoting whether time-only environment updates are skipped when the time is unchanged.
+    bool skipUnchangedTimeOnlyUpdates_ = true;
 
+    //! Boolean denoting whether the wall-clock time spent in each update function is measured.
+    bool updateTimingIsActive_ = false;
 
     //! Predefined state history iterator for computational efficiency.
     typename std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >::const_iterator
@@ -9,6 +9,7 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationPatchedConicFullProblem.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationLambertTargeterFullProblem.h"
 #include "Tudat/Astrodynamics/TrajectoryDesign/exportTrajectory.h"
@@ -299,45 +300,30 @@ void propagateMgaWithoutDsmAndFullProblem(
 
 
 
-//! Function to both calculate a patched conics leg including a DSM and propagate the corresponding full dynamics problem.
-void propagateMga1DsmVelocityAndFullProblem(
-        simulation_setup::NamedBodyMap& bodyMap,
-        const std::vector< std::string > departureAndArrivalBodies,
-        const std::string& dsm,
+//! Function to calculate a patched conics leg including a DSM (velocity formulation).
+void calculateMga1DsmVelocityLeg(
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string >& departureAndArrivalBodies,
         const std::string& centralBody,
-        const Eigen::Vector3d cartesianPositionAtDeparture,
-        const Eigen::Vector3d cartesianPositionDSM,
-        const Eigen::Vector3d cartesianPositionAtArrival,
+        const Eigen::Vector3d& cartesianPositionAtDeparture,
+        const Eigen::Vector3d& cartesianPositionAtArrival,
         const double initialTime,
-        const double timeDsm,
         const double timeArrival,
         const transfer_trajectories::TransferLegType& legType,
         const std::vector< double >& trajectoryVariableVector,
         const double semiMajorAxis,
         const double eccentricity,
         Eigen::Vector3d& velocityAfterDeparture,
-        Eigen::Vector3d& velocityBeforeArrival,
-        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
-        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsBeforeDsm,
-        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
-        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsAfterDsm,
-        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > >& integratorSettings,
-        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDepartureToDsm,
-        std::map< double, Eigen::Vector6d >& fullProblemResultFromDepartureToDsm,
-        std::map< double, Eigen::VectorXd >& dependentVariablesFromDepartureToDsm,
-        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDsmToArrival,
-        std::map< double, Eigen::Vector6d >& fullProblemResultFromDsmToArrival,
-        std::map< double, Eigen::VectorXd >& dependentVariablesFromDsmToArrival )
+        Eigen::Vector3d& velocityBeforeArrival )
 {
-
     if( legType == transfer_trajectories::mga1DsmVelocity_Departure )
     {
         std::shared_ptr< transfer_trajectories::DepartureLegMga1DsmVelocity > departureLegMga1DsmVelocity =
                 std::make_shared< transfer_trajectories::DepartureLegMga1DsmVelocity >(
                     cartesianPositionAtDeparture, cartesianPositionAtArrival, timeArrival - initialTime,
-                    bodyMap[ departureAndArrivalBodies[ 0 ] ]->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
-                bodyMap[ centralBody ]->getGravityFieldModel( )->getGravitationalParameter( ),
-                bodyMap[ departureAndArrivalBodies[ 0 ] ]->getGravityFieldModel( )->getGravitationalParameter( ),
+                    bodyMap.at( departureAndArrivalBodies[ 0 ] )->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
+                bodyMap.at( centralBody )->getGravityFieldModel( )->getGravitationalParameter( ),
+                bodyMap.at( departureAndArrivalBodies[ 0 ] )->getGravityFieldModel( )->getGravitationalParameter( ),
                 semiMajorAxis, eccentricity,
                 trajectoryVariableVector[ 0 ],
                 trajectoryVariableVector[ 1 ],
@@ -361,9 +347,9 @@ void propagateMga1DsmVelocityAndFullProblem(
         std::shared_ptr< transfer_trajectories::SwingbyLegMga1DsmVelocity > swingbyLegMga1DsmVelocity =
                 std::make_shared< transfer_trajectories::SwingbyLegMga1DsmVelocity >(
                     cartesianPositionAtDeparture, cartesianPositionAtArrival, timeArrival - initialTime,
-                    bodyMap[ departureAndArrivalBodies[ 0 ] ]->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
-                bodyMap[ centralBody ]->getGravityFieldModel( )->getGravitationalParameter( ),
-                bodyMap[ departureAndArrivalBodies[ 0 ] ]->getGravityFieldModel( )->getGravitationalParameter( ),
+                    bodyMap.at( departureAndArrivalBodies[ 0 ] )->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
+                bodyMap.at( centralBody )->getGravityFieldModel( )->getGravitationalParameter( ),
+                bodyMap.at( departureAndArrivalBodies[ 0 ] )->getGravityFieldModel( )->getGravitationalParameter( ),
                 pointerToVelocityBeforeArrival,
                 trajectoryVariableVector[ 0 ],
                 trajectoryVariableVector[ 1 ],
@@ -380,7 +366,43 @@ void propagateMga1DsmVelocityAndFullProblem(
         // Update value of velocity after departure.
         swingbyLegMga1DsmVelocity->returnDepartureVariables( departureBodyPosition, departureBodyVelocity, velocityAfterDeparture );
     }
+}
 
+//! Function to both calculate a patched conics leg including a DSM and propagate the corresponding full dynamics problem.
+void propagateMga1DsmVelocityAndFullProblem(
+        simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string > departureAndArrivalBodies,
+        const std::string& dsm,
+        const std::string& centralBody,
+        const Eigen::Vector3d cartesianPositionAtDeparture,
+        const Eigen::Vector3d cartesianPositionDSM,
+        const Eigen::Vector3d cartesianPositionAtArrival,
+        const double initialTime,
+        const double timeDsm,
+        const double timeArrival,
+        const transfer_trajectories::TransferLegType& legType,
+        const std::vector< double >& trajectoryVariableVector,
+        const double semiMajorAxis,
+        const double eccentricity,
+        Eigen::Vector3d& velocityAfterDeparture,
+        Eigen::Vector3d& velocityBeforeArrival,
+        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
+        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsBeforeDsm,
+        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
+        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsAfterDsm,
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > >& integratorSettings,
+        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDepartureToDsm,
+        std::map< double, Eigen::Vector6d >& fullProblemResultFromDepartureToDsm,
+        std::map< double, Eigen::VectorXd >& dependentVariablesFromDepartureToDsm,
+        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDsmToArrival,
+        std::map< double, Eigen::Vector6d >& fullProblemResultFromDsmToArrival,
+        std::map< double, Eigen::VectorXd >& dependentVariablesFromDsmToArrival )
+{
+    // Calculate the patched conics leg.
+    calculateMga1DsmVelocityLeg(
+                bodyMap, departureAndArrivalBodies, centralBody, cartesianPositionAtDeparture, cartesianPositionAtArrival,
+                initialTime, timeArrival, legType, trajectoryVariableVector, semiMajorAxis, eccentricity,
+                velocityAfterDeparture, velocityBeforeArrival );
 
     // First part of the leg: propagation of the state from departure body to DSM location.
     integratorSettings->initialTime_ = initialTime;
@@ -414,17 +436,14 @@ void propagateMga1DsmVelocityAndFullProblem(
 
 
 
-//! Function to both calculate a patched conics leg including a DSM and propagate the corresponding full dynamics problem.
-void propagateMga1DsmPositionAndFullProblem(
-        simulation_setup::NamedBodyMap& bodyMap,
-        const std::vector< std::string > departureAndArrivalBodies,
-        const std::string& dsm,
+//! Function to calculate a patched conics leg including a DSM (position formulation).
+void calculateMga1DsmPositionLeg(
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string >& departureAndArrivalBodies,
         const std::string& centralBody,
-        const Eigen::Vector3d cartesianPositionAtDeparture,
-        const Eigen::Vector3d cartesianPositionDSM,
-        const Eigen::Vector3d cartesianPositionAtArrival,
+        const Eigen::Vector3d& cartesianPositionAtDeparture,
+        const Eigen::Vector3d& cartesianPositionAtArrival,
         const double initialTime,
-        const double timeDsm,
         const double timeArrival,
         const transfer_trajectories::TransferLegType& legType,
         const std::vector< double >& trajectoryVariableVector,
@@ -432,18 +451,7 @@ void propagateMga1DsmPositionAndFullProblem(
         const double semiMajorAxis,
         const double eccentricity,
         Eigen::Vector3d& velocityAfterDeparture,
-        Eigen::Vector3d& velocityBeforeArrival,
-        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
-        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsBeforeDsm,
-        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
-        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsAfterDsm,
-        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > >& integratorSettings,
-        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDepartureToDsm,
-        std::map< double, Eigen::Vector6d >& fullProblemResultFromDepartureToDsm,
-        std::map< double, Eigen::VectorXd >& dependentVariablesFromDepartureToDsm,
-        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDsmToArrival,
-        std::map< double, Eigen::Vector6d >& fullProblemResultFromDsmToArrival,
-        std::map< double, Eigen::VectorXd >& dependentVariablesFromDsmToArrival )
+        Eigen::Vector3d& velocityBeforeArrival )
 {
     if( legType == transfer_trajectories::mga1DsmPosition_Departure )
     {
@@ -451,9 +459,9 @@ void propagateMga1DsmPositionAndFullProblem(
         std::shared_ptr< transfer_trajectories::DepartureLegMga1DsmPosition > departureLegMga1DsmPosition =
                 std::make_shared< transfer_trajectories::DepartureLegMga1DsmPosition >(
                     cartesianPositionAtDeparture, cartesianPositionAtArrival, timeArrival - initialTime,
-                    bodyMap[ departureAndArrivalBodies[ 0 ] ]->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
-                bodyMap[ centralBody ]->getGravityFieldModel( )->getGravitationalParameter( ),
-                bodyMap[ departureAndArrivalBodies[ 0 ] ]->getGravityFieldModel( )->getGravitationalParameter( ),
+                    bodyMap.at( departureAndArrivalBodies[ 0 ] )->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
+                bodyMap.at( centralBody )->getGravityFieldModel( )->getGravitationalParameter( ),
+                bodyMap.at( departureAndArrivalBodies[ 0 ] )->getGravityFieldModel( )->getGravitationalParameter( ),
                 semiMajorAxis, eccentricity,
                 trajectoryVariableVector[ 0 ],
                 trajectoryVariableVector[ 1 ],
@@ -481,9 +489,9 @@ void propagateMga1DsmPositionAndFullProblem(
         std::shared_ptr< transfer_trajectories::SwingbyLegMga1DsmPosition > swingbyLegMga1DsmPosition =
                 std::make_shared< transfer_trajectories::SwingbyLegMga1DsmPosition >(
                     cartesianPositionAtDeparture, cartesianPositionAtArrival, timeArrival - initialTime,
-                    bodyMap[ departureAndArrivalBodies[ 0 ] ]->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
-                bodyMap[ centralBody ]->getGravityFieldModel( )->getGravitationalParameter( ),
-                bodyMap[ departureAndArrivalBodies[ 0 ] ]->getGravityFieldModel( )->getGravitationalParameter( ),
+                    bodyMap.at( departureAndArrivalBodies[ 0 ] )->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
+                bodyMap.at( centralBody )->getGravityFieldModel( )->getGravitationalParameter( ),
+                bodyMap.at( departureAndArrivalBodies[ 0 ] )->getGravityFieldModel( )->getGravitationalParameter( ),
                 pointerToVelocityBeforeArrival, minimumPericenterRadius,
                 trajectoryVariableVector[ 0 ],
                 trajectoryVariableVector[ 1 ],
@@ -502,8 +510,44 @@ void propagateMga1DsmPositionAndFullProblem(
 
 
     }
+}
 
-
+//! Function to both calculate a patched conics leg including a DSM and propagate the corresponding full dynamics problem.
+void propagateMga1DsmPositionAndFullProblem(
+        simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string > departureAndArrivalBodies,
+        const std::string& dsm,
+        const std::string& centralBody,
+        const Eigen::Vector3d cartesianPositionAtDeparture,
+        const Eigen::Vector3d cartesianPositionDSM,
+        const Eigen::Vector3d cartesianPositionAtArrival,
+        const double initialTime,
+        const double timeDsm,
+        const double timeArrival,
+        const transfer_trajectories::TransferLegType& legType,
+        const std::vector< double >& trajectoryVariableVector,
+        const double minimumPericenterRadius,
+        const double semiMajorAxis,
+        const double eccentricity,
+        Eigen::Vector3d& velocityAfterDeparture,
+        Eigen::Vector3d& velocityBeforeArrival,
+        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
+        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsBeforeDsm,
+        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
+        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsAfterDsm,
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > >& integratorSettings,
+        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDepartureToDsm,
+        std::map< double, Eigen::Vector6d >& fullProblemResultFromDepartureToDsm,
+        std::map< double, Eigen::VectorXd >& dependentVariablesFromDepartureToDsm,
+        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDsmToArrival,
+        std::map< double, Eigen::Vector6d >& fullProblemResultFromDsmToArrival,
+        std::map< double, Eigen::VectorXd >& dependentVariablesFromDsmToArrival )
+{
+    // Calculate the patched conics leg.
+    calculateMga1DsmPositionLeg(
+                bodyMap, departureAndArrivalBodies, centralBody, cartesianPositionAtDeparture, cartesianPositionAtArrival,
+                initialTime, timeArrival, legType, trajectoryVariableVector, minimumPericenterRadius, semiMajorAxis, eccentricity,
+                velocityAfterDeparture, velocityBeforeArrival );
 
     // First part of the leg: Lambert targeter from departure body to DSM location.
 
@@ -839,51 +883,20 @@ std::shared_ptr< propagators::PropagationTerminationSettings > > getSingleLegSph
 }
 
 
-//! Function to calculate the patched conics trajectory and to propagate the corresponding full problem.
-std::vector< std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
-std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > > getPatchedConicPropagatorSettings(
+//! Function to create the termination settings for the propagation of the full problem along each leg of a patched conics trajectory.
+std::vector< std::pair< std::shared_ptr< propagators::PropagationTerminationSettings >,
+std::shared_ptr< propagators::PropagationTerminationSettings > > > getPatchedConicTerminationSettings(
         simulation_setup::NamedBodyMap& bodyMap,
-        const std::vector< basic_astrodynamics::AccelerationMap >& accelerationMap,
         const std::vector< std::string >& transferBodyOrder,
         const std::string& centralBody,
         const std::string& bodyToPropagate,
-        const std::vector< transfer_trajectories::TransferLegType>& legTypeVector,
-        const std::vector< double >& trajectoryVariableVector,
-        const std::vector< double >& minimumPericenterRadiiVector,
-        const std::vector< double >& semiMajorAxesVector,
-        const std::vector< double >& eccentricitiesVector,
-        const std::vector< std::shared_ptr< DependentVariableSaveSettings > > dependentVariablesToSave,
-        const TranslationalPropagatorType propagator,
+        const std::vector< transfer_trajectories::TransferLegType >& legTypeVector,
+        const std::vector< double >& timeVector,
         const bool terminationSphereOfInfluence,
         const double terminationDistanceScaler )
 {
-
-    // Define the patched conic trajectory from the body map.
-    transfer_trajectories::Trajectory trajectory = propagators::createTransferTrajectoryObject(
-                bodyMap, transferBodyOrder, centralBody, legTypeVector, trajectoryVariableVector, minimumPericenterRadiiVector, true,
-                semiMajorAxesVector[ 0 ], eccentricitiesVector[ 0 ], true, semiMajorAxesVector[ 1 ], eccentricitiesVector[ 1 ] );
-
-    // Calculate the trajectory.
-    std::vector< double > timeVector;
-    {
-        std::vector< Eigen::Vector3d > positionVector;
-        std::vector< double > deltaVVector;
-        double totalDeltaV;
-        trajectory.calculateTrajectory( totalDeltaV );
-        trajectory.maneuvers( positionVector, timeVector, deltaVVector );
-    }
     int numberOfLegs = legTypeVector.size( );
 
-
-    std::vector< std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
-            std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > > propagatorSettings;
-
-    std::vector< std::string > centralBodyPropagation;
-    centralBodyPropagation.push_back( centralBody );
-    std::vector< std::string > bodyToPropagatePropagation;
-    bodyToPropagatePropagation.push_back( bodyToPropagate );
-
-
     std::vector< std::pair< std::shared_ptr< propagators::PropagationTerminationSettings >,
             std::shared_ptr< propagators::PropagationTerminationSettings > > > terminationSettings;
 
@@ -965,8 +978,62 @@ std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > >
         }
     }
 
+    return terminationSettings;
+}
+
+//! Function to calculate the patched conics trajectory and to propagate the corresponding full problem.
+std::vector< std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
+std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > > getPatchedConicPropagatorSettings(
+        simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< basic_astrodynamics::AccelerationMap >& accelerationMap,
+        const std::vector< std::string >& transferBodyOrder,
+        const std::string& centralBody,
+        const std::string& bodyToPropagate,
+        const std::vector< transfer_trajectories::TransferLegType>& legTypeVector,
+        const std::vector< double >& trajectoryVariableVector,
+        const std::vector< double >& minimumPericenterRadiiVector,
+        const std::vector< double >& semiMajorAxesVector,
+        const std::vector< double >& eccentricitiesVector,
+        const std::vector< std::shared_ptr< DependentVariableSaveSettings > > dependentVariablesToSave,
+        const TranslationalPropagatorType propagator,
+        const bool terminationSphereOfInfluence,
+        const double terminationDistanceScaler )
+{
+
+    // Define the patched conic trajectory from the body map.
+    transfer_trajectories::Trajectory trajectory = propagators::createTransferTrajectoryObject(
+                bodyMap, transferBodyOrder, centralBody, legTypeVector, trajectoryVariableVector, minimumPericenterRadiiVector, true,
+                semiMajorAxesVector[ 0 ], eccentricitiesVector[ 0 ], true, semiMajorAxesVector[ 1 ], eccentricitiesVector[ 1 ] );
+
+    // Calculate the trajectory.
+    std::vector< double > timeVector;
+    {
+        std::vector< Eigen::Vector3d > positionVector;
+        std::vector< double > deltaVVector;
+        double totalDeltaV;
+        trajectory.calculateTrajectory( totalDeltaV );
+        trajectory.maneuvers( positionVector, timeVector, deltaVVector );
+    }
+    int numberOfLegs = legTypeVector.size( );
+
+
+    std::vector< std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
+            std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > > propagatorSettings;
+
+    std::vector< std::string > centralBodyPropagation;
+    centralBodyPropagation.push_back( centralBody );
+    std::vector< std::string > bodyToPropagatePropagation;
+    bodyToPropagatePropagation.push_back( bodyToPropagate );
+
+    // Create termination settings.
+    std::vector< std::pair< std::shared_ptr< propagators::PropagationTerminationSettings >,
+            std::shared_ptr< propagators::PropagationTerminationSettings > > > terminationSettings =
+            getPatchedConicTerminationSettings(
+                bodyMap, transferBodyOrder, centralBody, bodyToPropagate, legTypeVector, timeVector,
+                terminationSphereOfInfluence, terminationDistanceScaler );
+
     // Create propagator settings.
-    counterLegsIncludingDsm = 0;
+    int counterLegsIncludingDsm = 0;
     Eigen::Vector6d initialState;
 
     for( int i = 0 ; i <  numberOfLegs - 1 ; i ++ )
@@ -1439,6 +1506,276 @@ std::map< int, std::pair< Eigen::Vector6d, Eigen::Vector6d > > getDifferenceFull
 
 }
 
+//! Constructor.
+PatchedConicsFullProblemPropagator::PatchedConicsFullProblemPropagator(
+        const std::function< simulation_setup::NamedBodyMap( ) > bodyMapCreationFunction,
+        const std::vector< simulation_setup::SelectedAccelerationMap >& accelerationSettings,
+        const std::vector< std::string >& transferBodyOrder,
+        const std::string& centralBody,
+        const std::string& bodyToPropagate,
+        const std::vector< transfer_trajectories::TransferLegType >& legTypeVector,
+        const std::vector< double >& minimumPericenterRadiiVector,
+        const std::vector< double >& semiMajorAxesVector,
+        const std::vector< double >& eccentricitiesVector,
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+        const unsigned int numberOfThreads,
+        const bool terminationSphereOfInfluence,
+        const std::vector< std::shared_ptr< DependentVariableSaveSettings > > dependentVariablesToSave,
+        const TranslationalPropagatorType propagator,
+        const double terminationDistanceScaler ):
+    transferBodyOrder_( transferBodyOrder ), centralBody_( centralBody ), bodyToPropagate_( bodyToPropagate ),
+    legTypeVector_( legTypeVector ), minimumPericenterRadiiVector_( minimumPericenterRadiiVector ),
+    semiMajorAxesVector_( semiMajorAxesVector ), eccentricitiesVector_( eccentricitiesVector ),
+    integratorSettings_( integratorSettings ), terminationSphereOfInfluence_( terminationSphereOfInfluence ),
+    terminationDistanceScaler_( terminationDistanceScaler ), dependentVariablesToSave_( dependentVariablesToSave ),
+    propagator_( propagator )
+{
+    if( accelerationSettings.size( ) != 1 && accelerationSettings.size( ) != legTypeVector.size( ) )
+    {
+        throw std::runtime_error( "Error when creating patched conics full problem propagator, number of acceleration settings (" +
+                                  std::to_string( accelerationSettings.size( ) ) + ") must be 1 or equal to number of legs (" +
+                                  std::to_string( legTypeVector.size( ) ) + ")" );
+    }
+
+    // Determine number of (sub-)legs, each of which is propagated independently.
+    unsigned int numberOfSubLegs = 0;
+    for( unsigned int i = 0; i + 1 < legTypeVector.size( ); i++ )
+    {
+        if( legTypeVector[ i ] == transfer_trajectories::mga_Departure || legTypeVector[ i ] == transfer_trajectories::mga_Swingby )
+        {
+            numberOfSubLegs += 1;
+        }
+        else
+        {
+            numberOfSubLegs += 2;
+        }
+    }
+
+    std::vector< std::string > centralBodies = { centralBody };
+    std::vector< std::string > bodiesToPropagate = { bodyToPropagate };
+
+    // Create body map and acceleration models for each thread.
+    unsigned int numberOfBodyMaps = std::max( 1u, std::min( numberOfThreads, numberOfSubLegs ) );
+    for( unsigned int i = 0; i < numberOfBodyMaps; i++ )
+    {
+        bodyMaps_.push_back( bodyMapCreationFunction( ) );
+
+        std::vector< basic_astrodynamics::AccelerationMap > currentAccelerationModelMaps;
+        for( unsigned int j = 0; j < accelerationSettings.size( ); j++ )
+        {
+            currentAccelerationModelMaps.push_back(
+                        createAccelerationModelsMap( bodyMaps_.at( i ), accelerationSettings.at( j ), bodiesToPropagate, centralBodies ) );
+        }
+        accelerationModelMaps_.push_back( currentAccelerationModelMaps );
+    }
+}
+
+//! Function to calculate the patched conics trajectory and to propagate the corresponding full problem.
+void PatchedConicsFullProblemPropagator::propagateTrajectory(
+        const std::vector< double >& trajectoryVariableVector,
+        std::map< int, std::map< double, Eigen::Vector6d > >& patchedConicsResultForEachLeg,
+        std::map< int, std::map< double, Eigen::Vector6d > >& fullProblemResultForEachLeg,
+        std::map< int, std::map< double, Eigen::VectorXd > >& dependentVariableResultForEachLeg )
+{
+    int numberOfLegs = legTypeVector_.size( );
+    simulation_setup::NamedBodyMap& bodyMap = bodyMaps_.at( 0 );
+
+    // Clear output maps.
+    patchedConicsResultForEachLeg.clear( );
+    fullProblemResultForEachLeg.clear( );
+    dependentVariableResultForEachLeg.clear( );
+
+    // Calculate the patched conics trajectory.
+    transfer_trajectories::Trajectory trajectory = createTransferTrajectoryObject(
+                bodyMap, transferBodyOrder_, centralBody_, legTypeVector_, trajectoryVariableVector, minimumPericenterRadiiVector_, true,
+                semiMajorAxesVector_[ 0 ], eccentricitiesVector_[ 0 ], true, semiMajorAxesVector_[ 1 ], eccentricitiesVector_[ 1 ] );
+
+    std::vector< Eigen::Vector3d > positionVector;
+    std::vector< double > timeVector;
+    std::vector< double > deltaVVector;
+    double totalDeltaV;
+    trajectory.calculateTrajectory( totalDeltaV );
+    trajectory.maneuvers( positionVector, timeVector, deltaVVector );
+
+    std::vector< std::pair< std::shared_ptr< propagators::PropagationTerminationSettings >,
+            std::shared_ptr< propagators::PropagationTerminationSettings > > > terminationSettings =
+            getPatchedConicTerminationSettings(
+                bodyMap, transferBodyOrder_, centralBody_, bodyToPropagate_, legTypeVector_, timeVector,
+                terminationSphereOfInfluence_, terminationDistanceScaler_ );
+
+    // Include manoeuvres between transfer bodies when required (considering that a deep space manoeuvre divides a leg into two smaller ones).
+    std::vector< std::string > bodiesAndManoeuvresOrder;
+    int counterDSMs = 1;
+    for( int i = 0 ; i < numberOfLegs ; i ++ )
+    {
+        bodiesAndManoeuvresOrder.push_back( transferBodyOrder_[ i ] );
+        if( legTypeVector_[ i ] != transfer_trajectories::mga_Departure && legTypeVector_[ i ] != transfer_trajectories::mga_Swingby )
+        {
+            bodiesAndManoeuvresOrder.push_back( "DSM" + std::to_string( counterDSMs ) );
+            counterDSMs++;
+        }
+    }
+
+    // Calculate the velocity after departure for the legs with a DSM (sequentially, as the velocity before arrival is used by
+    // the next leg), and determine for each (sub-)leg whether it follows a Keplerian orbit (first part of a leg with a DSM in the
+    // velocity formulation) or the solution of a Lambert targeter.
+    std::vector< int > legIndices;
+    std::vector< bool > isKeplerianOrbitLeg;
+    std::vector< Eigen::Vector3d > velocitiesAfterDeparture;
+
+    int counterLegs = 0;
+    int counterLegWithDSM = 0;
+    Eigen::Vector3d velocityAfterDeparture = Eigen::Vector3d::Constant( TUDAT_NAN );
+    Eigen::Vector3d velocityBeforeArrival = Eigen::Vector3d::Constant( TUDAT_NAN );
+    for( int i = 0 ; i < numberOfLegs - 1 ; i ++ )
+    {
+        if( legTypeVector_[ i ] == transfer_trajectories::mga_Departure || legTypeVector_[ i ] == transfer_trajectories::mga_Swingby )
+        {
+            legIndices.push_back( i );
+            isKeplerianOrbitLeg.push_back( false );
+            velocitiesAfterDeparture.push_back( velocityAfterDeparture );
+            counterLegs++;
+        }
+        else
+        {
+            std::vector< std::string > departureAndArrivalBodies =
+            { bodiesAndManoeuvresOrder[ counterLegs ], bodiesAndManoeuvresOrder[ counterLegs + 2 ] };
+
+            std::vector< double > trajectoryVariableVectorLeg;
+            for( int j = 1; j <= 4; j++ )
+            {
+                trajectoryVariableVectorLeg.push_back( trajectoryVariableVector[ numberOfLegs + j + ( counterLegWithDSM * 4 ) ] );
+            }
+
+            bool isVelocityFormulation = ( legTypeVector_[ i ] == transfer_trajectories::mga1DsmVelocity_Departure ||
+                                           legTypeVector_[ i ] == transfer_trajectories::mga1DsmVelocity_Swingby );
+            if( isVelocityFormulation )
+            {
+                calculateMga1DsmVelocityLeg(
+                            bodyMap, departureAndArrivalBodies, centralBody_, positionVector[ counterLegs ],
+                            positionVector[ counterLegs + 2 ], timeVector[ counterLegs ], timeVector[ counterLegs + 2 ],
+                            legTypeVector_[ i ], trajectoryVariableVectorLeg, semiMajorAxesVector_[ 0 ], eccentricitiesVector_[ 0 ],
+                            velocityAfterDeparture, velocityBeforeArrival );
+            }
+            else
+            {
+                calculateMga1DsmPositionLeg(
+                            bodyMap, departureAndArrivalBodies, centralBody_, positionVector[ counterLegs ],
+                            positionVector[ counterLegs + 2 ], timeVector[ counterLegs ], timeVector[ counterLegs + 2 ],
+                            legTypeVector_[ i ], trajectoryVariableVectorLeg, minimumPericenterRadiiVector_[ i ],
+                            semiMajorAxesVector_[ 0 ], eccentricitiesVector_[ 0 ], velocityAfterDeparture, velocityBeforeArrival );
+            }
+
+            // First part of the leg: from departure body to DSM location.
+            legIndices.push_back( i );
+            isKeplerianOrbitLeg.push_back( isVelocityFormulation );
+            velocitiesAfterDeparture.push_back( velocityAfterDeparture );
+
+            // Second part of the leg: from DSM location to arrival body.
+            legIndices.push_back( i );
+            isKeplerianOrbitLeg.push_back( false );
+            velocitiesAfterDeparture.push_back( velocityAfterDeparture );
+
+            counterLegs += 2;
+            counterLegWithDSM++;
+        }
+    }
+
+    // Propagate the full problem along each (sub-)leg, using the body map and acceleration models of the current thread.
+    int numberOfSubLegs = legIndices.size( );
+    std::vector< std::map< double, Eigen::Vector6d > > patchedConicsResults( numberOfSubLegs );
+    std::vector< std::map< double, Eigen::Vector6d > > fullProblemResults( numberOfSubLegs );
+    std::vector< std::map< double, Eigen::VectorXd > > dependentVariableResults( numberOfSubLegs );
+
+    std::vector< std::string > centralBodies = { centralBody_ };
+    std::vector< std::string > bodiesToPropagate = { bodyToPropagate_ };
+
+    utilities::executeParallelForLoop(
+                numberOfSubLegs, [ & ]( const unsigned int subLegIndex, const unsigned int threadIndex )
+    {
+        int legIndex = legIndices.at( subLegIndex );
+        const simulation_setup::NamedBodyMap& currentBodyMap = bodyMaps_.at( threadIndex );
+
+        // Create settings for current (sub-)leg.
+        std::shared_ptr< numerical_integrators::IntegratorSettings< double > > currentIntegratorSettings =
+                integratorSettings_->clone( );
+        currentIntegratorSettings->initialTime_ = timeVector[ subLegIndex ];
+
+        const std::vector< basic_astrodynamics::AccelerationMap >& currentAccelerationModelMaps =
+                accelerationModelMaps_.at( threadIndex );
+        const basic_astrodynamics::AccelerationMap& currentAccelerationModelMap =
+                currentAccelerationModelMaps.at( std::min< int >( legIndex, currentAccelerationModelMaps.size( ) - 1 ) );
+        std::shared_ptr< DependentVariableSaveSettings > currentDependentVariablesToSave =
+                ( dependentVariablesToSave_.size( ) != 0 ) ? dependentVariablesToSave_.at( legIndex ) : nullptr;
+        std::pair< std::shared_ptr< TranslationalStatePropagatorSettings< double > >,
+                std::shared_ptr< TranslationalStatePropagatorSettings< double > > > currentPropagatorSettings =
+                std::make_pair(
+                    std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                        centralBodies, currentAccelerationModelMap, bodiesToPropagate, Eigen::Vector6d::Zero( ),
+                        terminationSettings.at( subLegIndex ).first, propagator_, currentDependentVariablesToSave ),
+                    std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                        centralBodies, currentAccelerationModelMap, bodiesToPropagate, Eigen::Vector6d::Zero( ),
+                        terminationSettings.at( subLegIndex ).second, propagator_, currentDependentVariablesToSave ) );
+
+        std::vector< std::string > departureAndArrivalBodies =
+        { bodiesAndManoeuvresOrder[ subLegIndex ], bodiesAndManoeuvresOrder[ subLegIndex + 1 ] };
+        double centralBodyGravitationalParameter =
+                currentBodyMap.at( centralBody_ )->getGravityFieldModel( )->getGravitationalParameter( );
+
+        // Compute patched conics and full problem results along the (sub-)leg.
+        if( isKeplerianOrbitLeg.at( subLegIndex ) )
+        {
+            propagateKeplerianOrbitLegAndFullProblem(
+                        timeVector[ subLegIndex + 1 ] - timeVector[ subLegIndex ], timeVector[ subLegIndex ], currentBodyMap,
+                        centralBody_, departureAndArrivalBodies, velocitiesAfterDeparture.at( subLegIndex ),
+                        currentPropagatorSettings, currentIntegratorSettings, patchedConicsResults[ subLegIndex ],
+                        fullProblemResults[ subLegIndex ], dependentVariableResults[ subLegIndex ],
+                        centralBodyGravitationalParameter, positionVector[ subLegIndex ] );
+        }
+        else
+        {
+            propagateLambertTargeterAndFullProblem(
+                        timeVector[ subLegIndex + 1 ] - timeVector[ subLegIndex ], timeVector[ subLegIndex ], currentBodyMap,
+                        centralBody_, currentPropagatorSettings, currentIntegratorSettings, patchedConicsResults[ subLegIndex ],
+                        fullProblemResults[ subLegIndex ], dependentVariableResults[ subLegIndex ], departureAndArrivalBodies,
+                        centralBodyGravitationalParameter, positionVector[ subLegIndex ], positionVector[ subLegIndex + 1 ] );
+        }
+    }, bodyMaps_.size( ) );
+
+    for( int i = 0; i < numberOfSubLegs; i++ )
+    {
+        patchedConicsResultForEachLeg[ i ] = patchedConicsResults.at( i );
+        fullProblemResultForEachLeg[ i ] = fullProblemResults.at( i );
+        dependentVariableResultForEachLeg[ i ] = dependentVariableResults.at( i );
+    }
+}
+
+//! Function to compute the difference in cartesian state between patched conics trajectory and full dynamics problem,
+//! at both departure and arrival positions for each leg.
+std::map< int, std::pair< Eigen::Vector6d, Eigen::Vector6d > >
+PatchedConicsFullProblemPropagator::getDifferenceFullProblemWrtPatchedConicsTrajectory(
+        const std::vector< double >& trajectoryVariableVector )
+{
+    std::map< int, std::map< double, Eigen::Vector6d > > patchedConicsResultForEachLeg;
+    std::map< int, std::map< double, Eigen::Vector6d > > fullProblemResultForEachLeg;
+    std::map< int, std::map< double, Eigen::VectorXd > > dependentVariableResultForEachLeg;
+
+    propagateTrajectory( trajectoryVariableVector, patchedConicsResultForEachLeg, fullProblemResultForEachLeg,
+                         dependentVariableResultForEachLeg );
+
+    // Compute difference at departure and at arrival for each leg (considering that a leg including a DSM consists of two sub-legs).
+    std::map< int, std::pair< Eigen::Vector6d, Eigen::Vector6d > > stateDifferenceAtArrivalAndDepartureForEachLeg;
+    for( auto itr : patchedConicsResultForEachLeg )
+    {
+        const std::map< double, Eigen::Vector6d >& fullProblemResultCurrentLeg = fullProblemResultForEachLeg.at( itr.first );
+        stateDifferenceAtArrivalAndDepartureForEachLeg[ itr.first ] = std::make_pair(
+                    itr.second.begin( )->second - fullProblemResultCurrentLeg.begin( )->second,
+                    itr.second.rbegin( )->second - fullProblemResultCurrentLeg.rbegin( )->second );
+    }
+
+    return stateDifferenceAtArrivalAndDepartureForEachLeg;
+}
+
 
 
 }
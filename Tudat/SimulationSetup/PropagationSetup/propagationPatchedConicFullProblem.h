@@ -11,6 +11,8 @@
 #ifndef TUDAT_PROPAGATION_PATCHED_CONIC_FULL
 #define TUDAT_PROPAGATION_PATCHED_CONIC_FULL
 
+#include <functional>
+
 #include "Tudat/SimulationSetup/tudatSimulationHeader.h"
 #include "Tudat/Astrodynamics/TrajectoryDesign/trajectory.h"
 
@@ -144,6 +146,41 @@ void propagateMgaWithoutDsmAndFullProblem(
         std::map< double, Eigen::Vector6d >& fullProblemResult,
         std::map< double, Eigen::VectorXd >& dependentVariableResultCurrentLeg );
 
+//! Function to calculate a patched conics leg including a DSM (velocity formulation).
+/*!
+ * Function to calculate a patched conics leg including a DSM, using the velocity formulation, without propagating the full dynamics
+ * problem. The velocities after departure and before arrival are updated.
+ * \param bodyMap Body map for the patched conics leg.
+ * \param departureAndArrivalBodies Vector containing the names of the departure and arrival bodies of the leg.
+ * \param centralBody Name of the central body of the patched conics trajectory.
+ * \param cartesianPositionAtDeparture Cartesian position of the body to be propagated at the leg departure [m].
+ * \param cartesianPositionAtArrival Cartesian position of the body to be propagated at the leg arrival [m].
+ * \param initialTime Time at departure [s].
+ * \param timeArrival Time at arrival [s].
+ * \param legType Type of the leg.
+ * \param trajectoryVariableVector Trajectory variable vector characterising the leg.
+ * \param semiMajorAxis Semi-major axis at trajectory departure (only used for a departure leg and not a swing-by one) [m].
+ * \param eccentricity Eccentricity at trajectory departure (only used for a departure leg and not a swing-by one).
+ * \param velocityAfterDeparture Velocity coordinates of the body to be propagated just after the swing-by it has performed about the
+ * departure body of the leg [m/s] (returned by reference).
+ * \param velocityBeforeArrival Velocity coordinates of the body to be propagated just before it reaches the arrival body of the leg
+ * [m/s]. For a swing-by leg, the input value is used as the velocity before the swing-by (returned by reference).
+ */
+void calculateMga1DsmVelocityLeg(
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string >& departureAndArrivalBodies,
+        const std::string& centralBody,
+        const Eigen::Vector3d& cartesianPositionAtDeparture,
+        const Eigen::Vector3d& cartesianPositionAtArrival,
+        const double initialTime,
+        const double timeArrival,
+        const transfer_trajectories::TransferLegType& legType,
+        const std::vector< double >& trajectoryVariableVector,
+        const double semiMajorAxis,
+        const double eccentricity,
+        Eigen::Vector3d& velocityAfterDeparture,
+        Eigen::Vector3d& velocityBeforeArrival );
+
 //! Function to both calculate a patched conics leg including a DSM and propagate the corresponding full dynamics problem.
 /*!
  * Function to both calculate a patched conics leg including a DSM and propagate the corresponding full dynamics problem. The patched
@@ -206,6 +243,43 @@ void propagateMga1DsmVelocityAndFullProblem(
 
 
 
+//! Function to calculate a patched conics leg including a DSM (position formulation).
+/*!
+ * Function to calculate a patched conics leg including a DSM, using the position formulation, without propagating the full dynamics
+ * problem. The velocities after departure and before arrival are updated.
+ * \param bodyMap Body map for the patched conics leg.
+ * \param departureAndArrivalBodies Vector containing the names of the departure and arrival bodies of the leg.
+ * \param centralBody Name of the central body of the patched conics trajectory.
+ * \param cartesianPositionAtDeparture Cartesian position of the body to be propagated at the leg departure [m].
+ * \param cartesianPositionAtArrival Cartesian position of the body to be propagated at the leg arrival [m].
+ * \param initialTime Time at departure [s].
+ * \param timeArrival Time at arrival [s].
+ * \param legType Type of the leg.
+ * \param trajectoryVariableVector Trajectory variable vector characterising the leg.
+ * \param minimumPericenterRadius Minimum pericenter radius for the swing-by at the departure body of the leg [m].
+ * \param semiMajorAxis Semi-major axis at trajectory departure (only used for a departure leg and not a swing-by one) [m].
+ * \param eccentricity Eccentricity at trajectory departure (only used for a departure leg and not a swing-by one).
+ * \param velocityAfterDeparture Velocity coordinates of the body to be propagated just after the swing-by it has performed about the
+ * departure body of the leg [m/s] (returned by reference).
+ * \param velocityBeforeArrival Velocity coordinates of the body to be propagated just before it reaches the arrival body of the leg
+ * [m/s]. For a swing-by leg, the input value is used as the velocity before the swing-by (returned by reference).
+ */
+void calculateMga1DsmPositionLeg(
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string >& departureAndArrivalBodies,
+        const std::string& centralBody,
+        const Eigen::Vector3d& cartesianPositionAtDeparture,
+        const Eigen::Vector3d& cartesianPositionAtArrival,
+        const double initialTime,
+        const double timeArrival,
+        const transfer_trajectories::TransferLegType& legType,
+        const std::vector< double >& trajectoryVariableVector,
+        const double minimumPericenterRadius,
+        const double semiMajorAxis,
+        const double eccentricity,
+        Eigen::Vector3d& velocityAfterDeparture,
+        Eigen::Vector3d& velocityBeforeArrival );
+
 //! Function to both calculate a patched conics leg including a DSM and propagate the corresponding full dynamics problem.
 /*!
  * Function to both calculate a patched conics leg including a DSM and propagate the corresponding full dynamics problem. The patched
@@ -290,6 +364,33 @@ std::shared_ptr< propagators::PropagationTerminationSettings > > getSingleLegSph
         const double finalTimeCurrentLeg,
         const double terminationDistanceScaler = 1.0 );
 
+//! Function to create the termination settings for the propagation of the full problem along each leg of a patched conics trajectory.
+/*!
+ * Function to create the termination settings for the backward and forward propagation of the full problem along each leg of a patched
+ * conics trajectory (where a leg including a DSM consists of two sub-legs), starting from the middle of the (sub-)leg.
+ * \param bodyMap Body map for the patched conics trajectory.
+ * \param transferBodyOrder Vector containing the names of the transfer bodies involved in the trajectory.
+ * \param centralBody Name of the central body of the patched conics trajectory.
+ * \param bodyToPropagate Name of the body to be propagated.
+ * \param legTypeVector Vector containing the leg types.
+ * \param timeVector Times of the manoeuvres (swing-bys and DSMs) of the patched conics trajectory, as returned by
+ * Trajectory::maneuvers [s].
+ * \param terminationSphereOfInfluence Boolean denoting whether the propagation stops at the exact position (false) or at the sphere of
+ * influence (true) of the departure and arrival body of each leg of the trajectory.
+ * \param terminationDistanceScaler Scaling factor of the sphere of influence radius, used if terminationSphereOfInfluence is true.
+ * \return Termination settings for the backward (first) and forward (second) propagation of each (sub-)leg.
+ */
+std::vector< std::pair< std::shared_ptr< propagators::PropagationTerminationSettings >,
+std::shared_ptr< propagators::PropagationTerminationSettings > > > getPatchedConicTerminationSettings(
+        simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string >& transferBodyOrder,
+        const std::string& centralBody,
+        const std::string& bodyToPropagate,
+        const std::vector< transfer_trajectories::TransferLegType >& legTypeVector,
+        const std::vector< double >& timeVector,
+        const bool terminationSphereOfInfluence,
+        const double terminationDistanceScaler = 1.0 );
+
 //! Function to calculate the patched conics trajectory and to propagate the corresponding full problem.
 std::vector< std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
 std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > > getPatchedConicPropagatorSettings(
@@ -588,6 +689,162 @@ std::map< int, std::pair< Eigen::Vector6d, Eigen::Vector6d > > getDifferenceFull
         const std::shared_ptr< DependentVariableSaveSettings > dependentVariablesToSave = std::shared_ptr< DependentVariableSaveSettings > ( ) ,
         const TranslationalPropagatorType propagator = cowell);
 
+//! Class to repeatedly propagate the full dynamics problem along patched conics trajectories, with concurrent propagation of the legs.
+/*!
+ * Class to repeatedly propagate the full dynamics problem along patched conics trajectories with a fixed leg sequence, as is typically
+ * done when verifying a large number of trajectories (e.g. from an optimization) in the full dynamics problem. The body map and
+ * acceleration models are created only once (upon construction), and are reused for each trajectory that is propagated. Once the
+ * patched conics trajectory has been computed, the (sub-)legs are independent, so that the (sub-)legs can be distributed over a
+ * number of threads, each of which propagates a (sub-)leg with propagateLambertTargeterAndFullProblem or
+ * propagateKeplerianOrbitLegAndFullProblem, as done by fullPropagationPatchedConicsTrajectory. Since the body map and acceleration
+ * models are modified during the propagation, a separate body map (with associated acceleration models) is created for each thread.
+ * The results are identical to those of the fullPropagationPatchedConicsTrajectory function (for the same body map, accelerations
+ * and settings).
+ */
+class PatchedConicsFullProblemPropagator
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor, creates the body map(s) and acceleration models.
+     * \param bodyMapCreationFunction Function returning a new body map for the patched conics trajectory (e.g. a call to
+     * setupBodyMapFromUserDefinedEphemeridesForPatchedConicsTrajectory), called once for each thread. When using multiple threads,
+     * each call must return new body objects. Ephemerides used during the propagation (e.g. by third-body accelerations, dependent
+     * variables or sphere-of-influence termination) must either be thread-safe, or be created anew for each call. Note that
+     * ApproximatePlanetPositions objects and the SPICE interface are not thread-safe.
+     * \param accelerationSettings Settings for the accelerations acting on the body to be propagated, for each leg of the trajectory.
+     * If a single entry is provided, it is used for all legs.
+     * \param transferBodyOrder Vector containing the names of the transfer bodies involved in the trajectory.
+     * \param centralBody Name of the central body of the patched conics trajectory.
+     * \param bodyToPropagate Name of the body to be propagated.
+     * \param legTypeVector Vector containing the leg types.
+     * \param minimumPericenterRadiiVector Vector containing the minimum distance between the spacecraft and the body.
+     * \param semiMajorAxesVector Vector containing the semi-major axes of the departure and arrival legs.
+     * \param eccentricitiesVector Vector containing the eccentricities of the departure and arrival legs.
+     * \param integratorSettings Integrator settings for the propagation of the full problem (copied for each propagation, initial
+     * time is set for each (sub-)leg).
+     * \param numberOfThreads Number of threads over which the propagations are distributed (default 1).
+     * \param terminationSphereOfInfluence Boolean denoting whether the propagation stops at the exact position (false) or at the
+     * sphere of influence (true) of the departure and arrival body of each leg of the trajectory. The default value is false.
+     * \param dependentVariablesToSave Vector containing the dependent variables to be saved during the full problem propagation for
+     * each leg (none if empty).
+     * \param propagator Type of propagator to be used for the full problem propagation.
+     * \param terminationDistanceScaler Scaling factor of the sphere of influence radius, used if terminationSphereOfInfluence is
+     * true.
+     */
+    PatchedConicsFullProblemPropagator(
+            const std::function< simulation_setup::NamedBodyMap( ) > bodyMapCreationFunction,
+            const std::vector< simulation_setup::SelectedAccelerationMap >& accelerationSettings,
+            const std::vector< std::string >& transferBodyOrder,
+            const std::string& centralBody,
+            const std::string& bodyToPropagate,
+            const std::vector< transfer_trajectories::TransferLegType >& legTypeVector,
+            const std::vector< double >& minimumPericenterRadiiVector,
+            const std::vector< double >& semiMajorAxesVector,
+            const std::vector< double >& eccentricitiesVector,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+            const unsigned int numberOfThreads = 1,
+            const bool terminationSphereOfInfluence = false,
+            const std::vector< std::shared_ptr< DependentVariableSaveSettings > > dependentVariablesToSave =
+            std::vector< std::shared_ptr< DependentVariableSaveSettings > >( ),
+            const TranslationalPropagatorType propagator = cowell,
+            const double terminationDistanceScaler = 1.0 );
+
+    //! Function to calculate the patched conics trajectory and to propagate the corresponding full problem.
+    /*!
+     * Function to calculate the patched conics trajectory and to propagate the corresponding full problem, with output identical
+     * to that of the fullPropagationPatchedConicsTrajectory function.
+     * \param trajectoryVariableVector Vector containing all the defining variables for the whole trajectory.
+     * \param patchedConicsResultForEachLeg Map containing the patched conics solution for each (sub-)leg (returned by reference).
+     * \param fullProblemResultForEachLeg Map containing the full problem propagation results for each (sub-)leg (returned by
+     * reference).
+     * \param dependentVariableResultForEachLeg Map containing the dependent variables for each (sub-)leg (returned by reference).
+     */
+    void propagateTrajectory(
+            const std::vector< double >& trajectoryVariableVector,
+            std::map< int, std::map< double, Eigen::Vector6d > >& patchedConicsResultForEachLeg,
+            std::map< int, std::map< double, Eigen::Vector6d > >& fullProblemResultForEachLeg,
+            std::map< int, std::map< double, Eigen::VectorXd > >& dependentVariableResultForEachLeg );
+
+    //! Function to compute the difference in cartesian state between patched conics trajectory and full dynamics problem,
+    //! at both departure and arrival positions for each leg.
+    /*!
+     * Function to compute the difference in cartesian state between patched conics trajectory and full dynamics problem, at both
+     * departure and arrival positions for each (sub-)leg.
+     * \param trajectoryVariableVector Vector containing all the defining variables for the whole trajectory.
+     * \return Map of vector pairs. Each vector pair contains the difference in cartesian state between patched conics trajectory and
+     * full problem for a given (sub-)leg, at departure and arrival respectively.
+     */
+    std::map< int, std::pair< Eigen::Vector6d, Eigen::Vector6d > > getDifferenceFullProblemWrtPatchedConicsTrajectory(
+            const std::vector< double >& trajectoryVariableVector );
+
+    //! Function to retrieve the body maps that are used for the propagation.
+    /*!
+     * Function to retrieve the body maps that are used for the propagation (one for each thread, the first of which is also used
+     * to compute the patched conics trajectory).
+     * \return Body maps that are used for the propagation.
+     */
+    std::vector< simulation_setup::NamedBodyMap > getBodyMaps( )
+    {
+        return bodyMaps_;
+    }
+
+    //! Function to retrieve the number of threads over which the propagations are distributed.
+    /*!
+     * Function to retrieve the number of threads over which the propagations are distributed.
+     * \return Number of threads over which the propagations are distributed.
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return bodyMaps_.size( );
+    }
+
+private:
+
+    //! Vector containing the names of the transfer bodies involved in the trajectory.
+    std::vector< std::string > transferBodyOrder_;
+
+    //! Name of the central body of the patched conics trajectory.
+    std::string centralBody_;
+
+    //! Name of the body to be propagated.
+    std::string bodyToPropagate_;
+
+    //! Vector containing the leg types.
+    std::vector< transfer_trajectories::TransferLegType > legTypeVector_;
+
+    //! Vector containing the minimum distance between the spacecraft and the body.
+    std::vector< double > minimumPericenterRadiiVector_;
+
+    //! Vector containing the semi-major axes of the departure and arrival legs.
+    std::vector< double > semiMajorAxesVector_;
+
+    //! Vector containing the eccentricities of the departure and arrival legs.
+    std::vector< double > eccentricitiesVector_;
+
+    //! Integrator settings for the propagation of the full problem.
+    std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings_;
+
+    //! Boolean denoting whether the propagation stops at the sphere of influence of the departure and arrival bodies.
+    bool terminationSphereOfInfluence_;
+
+    //! Scaling factor of the sphere of influence radius, used if terminationSphereOfInfluence_ is true.
+    double terminationDistanceScaler_;
+
+    //! Vector containing the dependent variables to be saved during the full problem propagation for each leg.
+    std::vector< std::shared_ptr< DependentVariableSaveSettings > > dependentVariablesToSave_;
+
+    //! Type of propagator to be used for the full problem propagation.
+    TranslationalPropagatorType propagator_;
+
+    //! Body maps, one for each thread.
+    std::vector< simulation_setup::NamedBodyMap > bodyMaps_;
+
+    //! Acceleration models, for each thread (outer vector) and each leg (inner vector, single entry if identical for all legs).
+    std::vector< std::vector< basic_astrodynamics::AccelerationMap > > accelerationModelMaps_;
+};
+
 }
 
 }
@@ -45,6 +45,7 @@
 #include "Tudat/InputOutput/matrixTextFileReader.h"
 #include "Tudat/InputOutput/solarActivityData.h"
 #include "Tudat/InputOutput/parseSolarActivityData.h"
+#include "Tudat/InputOutput/sphericalHarmonicsCoefficientCache.h"
 #include "Tudat/Mathematics/BasicMathematics/coordinateConversions.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createAtmosphereModel.h"
@@ -428,6 +429,51 @@ BOOST_AUTO_TEST_CASE( test_gravityFieldSetup )
 
 }
 
+//! Test reading of gravity field file through binary coefficient cache
+BOOST_AUTO_TEST_CASE( test_gravityFieldFileCache )
+{
+    const boost::filesystem::path cacheDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+    const std::string originalCacheDirectory = input_output::getSphericalHarmonicsCoefficientCacheDirectory( );
+    const std::string gravityFieldFile = input_output::getGravityModelsPath( ) + "Earth/egm96.txt";
+
+    // Read file without cache
+    input_output::setSphericalHarmonicsCoefficientCacheDirectory( "" );
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > textFileCoefficients;
+    std::pair< double, double > textFileReferenceData =
+            readGravityFieldFile( gravityFieldFile, 200, 200, textFileCoefficients, 0, 1 );
+
+    // Read file twice with cache: first call creates cache file, second call uses it.
+    input_output::setSphericalHarmonicsCoefficientCacheDirectory( cacheDirectory.string( ) );
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > cachedCoefficients;
+        std::pair< double, double > cachedReferenceData =
+                readGravityFieldFile( gravityFieldFile, 200, 200, cachedCoefficients, 0, 1 );
+
+        BOOST_CHECK( boost::filesystem::exists( input_output::getSphericalHarmonicsCoefficientCacheFilePath(
+                                                    gravityFieldFile,
+                                                    input_output::computeFileContentHash( gravityFieldFile ),
+                                                    200, 200, 0, 1 ) ) );
+        BOOST_CHECK_EQUAL( cachedReferenceData.first, textFileReferenceData.first );
+        BOOST_CHECK_EQUAL( cachedReferenceData.second, textFileReferenceData.second );
+        BOOST_CHECK( cachedCoefficients.first == textFileCoefficients.first );
+        BOOST_CHECK( cachedCoefficients.second == textFileCoefficients.second );
+    }
+
+    // Check that different settings use a different cache file.
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > cachedCoefficients;
+    readGravityFieldFile( gravityFieldFile, 20, 10, cachedCoefficients, 0, 1 );
+    BOOST_CHECK_EQUAL( cachedCoefficients.first.rows( ), 21 );
+    BOOST_CHECK_EQUAL( cachedCoefficients.first.cols( ), 11 );
+    BOOST_CHECK( cachedCoefficients.first == textFileCoefficients.first.block( 0, 0, 21, 11 ) );
+    BOOST_CHECK_EQUAL( std::distance( boost::filesystem::directory_iterator( cacheDirectory ),
+                                      boost::filesystem::directory_iterator( ) ), 2 );
+
+    input_output::setSphericalHarmonicsCoefficientCacheDirectory( originalCacheDirectory );
+    boost::filesystem::remove_all( cacheDirectory );
+}
+
 //! Test set up of triaxial ellipsoid gravity field model settings
 BOOST_AUTO_TEST_CASE( test_triaxialEllipsoidGravityFieldSetup )
 {
@@ -820,6 +866,49 @@ BOOST_AUTO_TEST_CASE( test_earthRotationModelSetup )
         }
     }
 }
+
+//! Test set up of GCRS<->ITRS rotation model with on-demand tabulated Earth orientation angles
+BOOST_AUTO_TEST_CASE( test_tabulatedEarthRotationModelSetup )
+{
+    // Create rotation models with and without tabulated angles using setup function
+    std::shared_ptr< GcrsToItrsRotationModelSettings > rotationSettings =
+            std::make_shared< GcrsToItrsRotationModelSettings >( );
+    std::shared_ptr< GcrsToItrsRotationModelSettings > tabulatedRotationSettings =
+            std::make_shared< GcrsToItrsRotationModelSettings >( );
+    tabulatedRotationSettings->setAnglesTabulationSettings(
+                std::make_shared< EarthOrientationAnglesTabulationSettings >( ) );
+
+    std::shared_ptr< ephemerides::GcrsToItrsRotationModel > earthRotationModel =
+            std::dynamic_pointer_cast< ephemerides::GcrsToItrsRotationModel >(
+                createRotationModel( rotationSettings, "Earth" ) );
+    std::shared_ptr< ephemerides::GcrsToItrsRotationModel > tabulatedEarthRotationModel =
+            std::dynamic_pointer_cast< ephemerides::GcrsToItrsRotationModel >(
+                createRotationModel( tabulatedRotationSettings, "Earth" ) );
+
+    // Check that tabulation is only used when requested
+    BOOST_CHECK_EQUAL( earthRotationModel->getTabulatedAnglesCalculator( ) == nullptr, true );
+    BOOST_CHECK_EQUAL( tabulatedEarthRotationModel->getTabulatedAnglesCalculator( ) != nullptr, true );
+
+    // Compare rotation matrices at times not coinciding with tabulation nodes
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        double testTime = 5.0E7 + 123.4 + static_cast< double >( i ) * 4321.0;
+
+        Eigen::Matrix3d rotationMatrix =
+                earthRotationModel->getRotationToBaseFrame( testTime ).toRotationMatrix( );
+        Eigen::Matrix3d tabulatedRotationMatrix =
+                tabulatedEarthRotationModel->getRotationToBaseFrame( testTime ).toRotationMatrix( );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( rotationMatrix( j, k ) - tabulatedRotationMatrix( j, k ) ), 1.0E-10 );
+            }
+        }
+    }
+    BOOST_CHECK_EQUAL( tabulatedEarthRotationModel->getTabulatedAnglesCalculator( )->getNumberOfGeneratedBlocks( ) > 0,
+                       true );
+}
 #endif
 
 #if USE_CSPICE